@@ -0,0 +1,724 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Builds tests/performanceTest.cpp: perl -I. BuildBenchmark.pl > ../tests/performanceTest.cpp
+
+# Operations on one vector or swizzle: name, result kind, expression, dimensions
+# In expressions A and B are vector arguments, X is a unit axis, S is a scalar, M is a matrix and Q is a quaternion
+@benchmarkOperations = (
+	["ToParent", "vector", "VEC(A)", "234"],
+	["ToString", "string", "ToString(A)", "234"],
+	["ToChars", "chars", "ToChars(outChars, outChars + 256, A)", "234"],
+	["Negate", "vector", "-A", "234"],
+	["Add", "vector", "A + B", "234"],
+	["Subtract", "vector", "A - B", "234"],
+	["Multiply", "vector", "A * B", "234"],
+	["Divide", "vector", "A / B", "234"],
+	["MultiplyScalar", "vector", "A * S", "234"],
+	["MultiplyScalarLeft", "vector", "S * A", "234"],
+	["DivideScalar", "vector", "A / S", "234"],
+	["DivideScalarLeft", "vector", "S / A", "234"],
+	["EqualTo", "bool", "A == B", "234"],
+	["NotEqualTo", "bool", "A != B", "234"],
+	["AlmostEqual", "bool", "AlmostEqual(A, B)", "234"],
+	["LessThan", "bool", "A < B", "234"],
+	["GreaterThan", "bool", "A > B", "234"],
+	["LessThanOrEqual", "bool", "A <= B", "234"],
+	["GreaterThanOrEqual", "bool", "A >= B", "234"],
+	["Select", "vector", "Select(LessThan(A, B), A, B)", "234"],
+	["Normalize", "vector", "Normalize(A)", "234"],
+	["Length", "scalar", "VEC(A).Length", "234"],
+	["Dot", "scalar", "Dot(A, B)", "234"],
+	["Perpendicular", "vector", "Perpendicular(A)", "2"],
+	["Cross", "vector", "Cross(A, B)", "34"],
+	["Project", "vector", "Project(A, B)", "234"],
+	["Rotate", "vector", "Rotate(A, S)", "2"],
+	["Rotate", "vector", "Rotate(A, X, S)", "34"],
+	["Lerp", "vector", "Lerp(A, B, S)", "234"],
+	["Max", "vector", "Max(A, B)", "234"],
+	["Min", "vector", "Min(A, B)", "234"],
+	["MaxScalar", "vector", "Max(A, S)", "234"],
+	["MinScalar", "vector", "Min(A, S)", "234"],
+	["Ceil", "vector", "Ceil(A)", "234"],
+	["Floor", "vector", "Floor(A)", "234"],
+	["Clamp", "vector", "Clamp(A, S, S + 1)", "234"],
+	["Exp", "vector", "Exp(A)", "234"],
+	["Sin", "vector", "Sin(A)", "234"],
+	["Atan2", "vector", "Atan2(A, B)", "234"],
+	["Distance", "scalar", "Distance(A, B)", "234"],
+	["DistanceSquared", "scalar", "DistanceSquared(A, B)", "234"],
+	["MatrixMultiplyVector", "vector", "M * A", "234"],
+	["RotateQuaternion", "vector", "Rotate(A, Q)", "34"]
+);
+
+# Operations on one matrix: name, result kind (matrix, scalar or array), expression, dimensions
+# M and N are matrices and Q is a quaternion; array cases run over the whole working set of vectors
+@matrixOperations = (
+	["MatrixMultiply", "matrix", "M * N", "234"],
+	["Transpose", "matrix", "Transpose(M)", "234"],
+	["Determinant", "scalar", "Determinant(M)", "234"],
+	["Inverse", "matrix", "Inverse(M)", "234"],
+	["Transform", "array", "Transform(OUT_ARRAY, M, A_ARRAY, DATA_SIZE)", "234"],
+	["RotateQuaternion", "array", "Rotate(OUT_ARRAY, A_ARRAY, Q, DATA_SIZE)", "34"]
+);
+
+# Operations on quaternions: name, expression, with P and Q quaternions and S a scalar
+@quaternionOperations = (
+	["QuaternionMultiply", "P * Q"],
+	["Nlerp", "Nlerp(P, Q, S)"],
+	["Slerp", "Slerp(P, Q, S)"],
+	["ToMatrix", "ToMatrix(P)"]
+);
+
+# Whole-array kernels on the batch types: name, call, dimensions
+# OUT, A and B are batches, R is the scalar result array, X is an axis, S is a scalar, M is a matrix and Q is a quaternion
+@batchOperations = (
+	["Negate", "Negate(OUT, A)", "234"],
+	["Add", "Add(OUT, A, B)", "234"],
+	["Subtract", "Subtract(OUT, A, B)", "234"],
+	["Multiply", "Multiply(OUT, A, B)", "234"],
+	["Divide", "Divide(OUT, A, B)", "234"],
+	["MultiplyScalar", "Multiply(OUT, A, S)", "234"],
+	["DivideScalar", "Divide(OUT, A, S)", "234"],
+	["Normalize", "Normalize(OUT, A)", "234"],
+	["Dot", "Dot(R, A, B)", "234"],
+	["Cross", "Cross(OUT, A, B)", "34"],
+	["Project", "Project(OUT, A, B)", "234"],
+	["Rotate", "Rotate(OUT, A, S)", "2"],
+	["Rotate", "Rotate(OUT, A, X, S)", "34"],
+	["Lerp", "Lerp(OUT, A, B, S)", "234"],
+	["Max", "Max(OUT, A, B)", "234"],
+	["Min", "Min(OUT, A, B)", "234"],
+	["Ceil", "Ceil(OUT, A)", "234"],
+	["Floor", "Floor(OUT, A)", "234"],
+	["Distance", "Distance(R, A, B)", "234"],
+	["DistanceSquared", "DistanceSquared(R, A, B)", "234"],
+	["Transform", "Transform(OUT, M, A)", "234"],
+	["RotateQuaternion", "Rotate(OUT, A, Q)", "34"]
+);
+
+# Bounding box operations: name, result (BOX or HIT), call, items per call, dimensions
+# P is the working set of points and BATCH the same points as a batch, B is a box, K4 and K8 are packets of 4 and 8 boxes,
+# O is a ray origin, I its inverse direction, and D the distance output (one for a box, an array for a packet)
+@boxOperations = (
+	["Fit", "BOX", "Fit(P, DATA_SIZE)", "DATA_SIZE", "23"],
+	["BatchFit", "BOX", "Fit(BATCH)", "DATA_SIZE", "23"],
+	["IntersectRay", "HIT", "IntersectRay(B, O, I, 100.0f, D[0])", "1", "23"],
+	["IntersectRayPacket4", "HIT", "IntersectRay(K4, O, I, 100.0f, D)", "4", "23"],
+	["IntersectRayPacket8", "HIT", "IntersectRay(K8, O, I, 100.0f, D)", "8", "23"]
+);
+
+# Reductions over the working set P: name, result (VECTOR or MATRIX), call, items per call, dimensions
+@reductionOperations = (
+	["Sum", "VECTOR", "Sum(P, DATA_SIZE)", "DATA_SIZE", "234"],
+	["Centroid", "VECTOR", "Centroid(P, DATA_SIZE)", "DATA_SIZE", "234"],
+	["Covariance", "MATRIX", "Covariance(P, DATA_SIZE)", "DATA_SIZE", "23"]
+);
+
+@reversedSwizzles = ("", "", "yx", "zyx", "wzyx");
+@registered = ();
+
+sub PrintBenchmarkTop
+{
+	print "// SVML benchmarks, generated by generation/BuildBenchmark.pl\n";
+	print "//\n";
+	print "// Build with optimizations and run from the repository root:\n";
+	print "//   g++ -O2 -I. tests/performanceTest.cpp -o performanceTest\n";
+	print "//   ./performanceTest --benchmark_min_time=0.5 --benchmark_filter=/3D/ > results.json\n";
+	print "//\n";
+	print "// The output is in the Google Benchmark JSON format, so two runs can be compared with its tools/compare.py.\n";
+	print "// \"throughput\" cases work on independent elements, \"latency\" cases feed each result into the next call.\n";
+	print "// The \"swizzle\" form passes reversed swizzles (.yx, .zyx, .wzyx) where the \"vector\" form passes vectors,\n";
+	print "// so the difference between the two is the cost of going through the swizzle overloads.\n";
+	print "\n";
+	print "#include <iostream>\n";
+	print "#include <string>\n";
+	print "#include <stdlib.h> // atof\n";
+	print "#include <time.h>\n";
+	print "#if __cplusplus >= 201103L\n";
+	print "#include <chrono>\n";
+	print "#endif\n";
+	print "#ifdef __SSE__\n";
+	print "#include <xmmintrin.h>\n";
+	print "#endif\n";
+	print "\n";
+	print "#include \"svml.h\"\n";
+	print "\n";
+	print "using std::cout;\n";
+	print "using std::string;\n";
+	print "using SVML::SCALAR_TYPE;\n";
+	print "using SVML::vec2;\n";
+	print "using SVML::vec3;\n";
+	print "using SVML::vec4;\n";
+	print "using SVML::mat2;\n";
+	print "using SVML::mat3;\n";
+	print "using SVML::mat4;\n";
+	print "using SVML::quat;\n";
+	print "using SVML::vec2_soa;\n";
+	print "using SVML::vec3_soa;\n";
+	print "using SVML::vec4_soa;\n";
+	print "using SVML::aabb2;\n";
+	print "using SVML::aabb3;\n";
+	print "using SVML::AABB2_PACKET;\n";
+	print "using SVML::AABB3_PACKET;\n";
+	print "\n";
+	print "// Working set, a power of two that fits in L1\n";
+	print "const unsigned DATA_SIZE = 256;\n";
+	print "const unsigned DATA_MASK = DATA_SIZE - 1;\n";
+	print "\n";
+	print "vec2 a2[DATA_SIZE], b2[DATA_SIZE], axis2[DATA_SIZE], out2[DATA_SIZE];\n";
+	print "vec3 a3[DATA_SIZE], b3[DATA_SIZE], axis3[DATA_SIZE], out3[DATA_SIZE];\n";
+	print "vec4 a4[DATA_SIZE], b4[DATA_SIZE], axis4[DATA_SIZE], out4[DATA_SIZE];\n";
+	print "mat2 matrix2[DATA_SIZE], otherMatrix2[DATA_SIZE], outMatrix2[DATA_SIZE];\n";
+	print "mat3 matrix3[DATA_SIZE], otherMatrix3[DATA_SIZE], outMatrix3[DATA_SIZE];\n";
+	print "mat4 matrix4[DATA_SIZE], otherMatrix4[DATA_SIZE], outMatrix4[DATA_SIZE];\n";
+	print "quat rotations[DATA_SIZE], otherRotations[DATA_SIZE], outRotations[DATA_SIZE];\n";
+	print "mat3 outRotationMatrix[DATA_SIZE];\n";
+	print "SCALAR_TYPE scalars[DATA_SIZE];\n";
+	print "SCALAR_TYPE outScalar[DATA_SIZE];\n";
+	print "bool outBool[DATA_SIZE];\n";
+	print "string outString;\n";
+	print "char outChars[256];\n";
+	print "\n";
+	print "aabb2 boxes2[DATA_SIZE], outBox2;\n";
+	print "aabb3 boxes3[DATA_SIZE], outBox3;\n";
+	print "AABB2_PACKET<float, 4> packets4x2[DATA_SIZE / 4];\n";
+	print "AABB3_PACKET<float, 4> packets4x3[DATA_SIZE / 4];\n";
+	print "AABB2_PACKET<float, 8> packets8x2[DATA_SIZE / 8];\n";
+	print "AABB3_PACKET<float, 8> packets8x3[DATA_SIZE / 8];\n";
+	print "vec2 rayOrigins2[DATA_SIZE], rayInverses2[DATA_SIZE];\n";
+	print "vec3 rayOrigins3[DATA_SIZE], rayInverses3[DATA_SIZE];\n";
+	print "unsigned outHits[DATA_SIZE];\n";
+	print "\n";
+	print "vec2_soa soaA2, soaB2, soaOut2;\n";
+	print "vec3_soa soaA3, soaB3, soaOut3;\n";
+	print "vec4_soa soaA4, soaB4, soaOut4;\n";
+	print "\n";
+	print "// Forces the value to be computed and stored\n";
+	print "template <typename TYPE> inline void DoNotOptimize(const TYPE& value)\n";
+	print "{\n";
+	print "#if defined(__GNUC__)\n";
+	print "\tasm volatile(\"\" : : \"m\"(value) : \"memory\");\n";
+	print "#else\n";
+	print "\tstatic const void* volatile sink;\n";
+	print "\tsink = &value;\n";
+	print "#endif\n";
+	print "}\n";
+	print "\n";
+	print "inline double WallSeconds()\n";
+	print "{\n";
+	print "#if __cplusplus >= 201103L\n";
+	print "\treturn std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();\n";
+	print "#else\n";
+	print "\treturn (double)clock() / CLOCKS_PER_SEC;\n";
+	print "#endif\n";
+	print "}\n";
+	print "\n";
+	print "inline double CpuSeconds()\n";
+	print "{\n";
+	print "\treturn (double)clock() / CLOCKS_PER_SEC;\n";
+	print "}\n";
+	print "\n";
+	print "void SetUp()\n";
+	print "{\n";
+	print "\tfor (unsigned n = 0; n < DATA_SIZE; n++)\n";
+	print "\t{\n";
+	print "\t\tSCALAR_TYPE t = (SCALAR_TYPE)n / DATA_SIZE;\n";
+	print "\t\t\n";
+	print "\t\ta4[n] = vec4(t + 0.5f, 1.5f - t, t * 2.0f - 1.0f, 1.0f);\n";
+	print "\t\tb4[n] = vec4(1.0f - t, t + 0.25f, 0.75f, t - 0.5f);\n";
+	print "\t\taxis4[n] = vec4(Normalize(vec3(t, 1.0f - t, 0.5f)), 0.0f);\n";
+	print "\t\ta3[n] = a4[n].xyz;\n";
+	print "\t\tb3[n] = b4[n].xyz;\n";
+	print "\t\taxis3[n] = axis4[n].xyz;\n";
+	print "\t\ta2[n] = a4[n].xy;\n";
+	print "\t\tb2[n] = b4[n].xy;\n";
+	print "\t\taxis2[n] = axis4[n].xy;\n";
+	print "\t\tscalars[n] = t + 0.5f;\n";
+	print "\t\t\n";
+	print "\t\tmatrix4[n] = mat4(a4[n], b4[n], axis4[n], vec4(t, -t, 0.5f, 1.0f));\n";
+	print "\t\totherMatrix4[n] = mat4(b4[n], axis4[n], a4[n], vec4(0.25f, t, -t, 1.0f));\n";
+	print "\t\tmatrix3[n] = mat3(a3[n], b3[n], axis3[n]);\n";
+	print "\t\totherMatrix3[n] = mat3(b3[n], axis3[n], a3[n]);\n";
+	print "\t\tmatrix2[n] = mat2(a2[n], b2[n]);\n";
+	print "\t\totherMatrix2[n] = mat2(b2[n], a2[n]);\n";
+	print "\t\trotations[n] = quat(axis3[n], scalars[n]);\n";
+	print "\t\totherRotations[n] = quat(Normalize(b3[n]), t * 3.0f);\n";
+	print "\t}\n";
+	print "\t\n";
+	print "\tsoaA2 = vec2_soa(a2, DATA_SIZE);\n";
+	print "\tsoaB2 = vec2_soa(b2, DATA_SIZE);\n";
+	print "\tsoaOut2 = vec2_soa(DATA_SIZE);\n";
+	print "\tsoaA3 = vec3_soa(a3, DATA_SIZE);\n";
+	print "\tsoaB3 = vec3_soa(b3, DATA_SIZE);\n";
+	print "\tsoaOut3 = vec3_soa(DATA_SIZE);\n";
+	print "\tsoaA4 = vec4_soa(a4, DATA_SIZE);\n";
+	print "\tsoaB4 = vec4_soa(b4, DATA_SIZE);\n";
+	print "\tsoaOut4 = vec4_soa(DATA_SIZE);\n";
+	print "\t\n";
+	print "#ifdef __SSE__\n";
+	print "\t// Flush denormals to zero, so long latency chains that drift towards zero do not slow down\n";
+	print "\t_mm_setcsr(_mm_getcsr() | 0x8040);\n";
+	print "#endif\n";
+	print "}\n";
+	print "\n";
+	print "typedef void (*BENCHMARK_FUNCTION)(const unsigned& iterations);\n";
+	print "\n";
+	print "struct BENCHMARK\n";
+	print "{\n";
+	print "\tconst char* name;\n";
+	print "\tBENCHMARK_FUNCTION function;\n";
+	print "\tunsigned itemsPerIteration;\n";
+	print "};\n";
+	print "\n";
+}
+
+# Replaces the placeholders of an expression, leaving names such as AlmostEqual alone
+sub FillExpression
+{
+	my($expression, %values) = @_;
+	
+	foreach $placeholder (keys %values)
+	{
+		$expression =~ s/\b$placeholder\b/$values{$placeholder}/g;
+	}
+	
+	return $expression;
+}
+
+sub PrintOperationBenchmarks
+{
+	my($name, $kind, $expression, $dimension, $form) = @_;
+	
+	$suffix = ($form eq "swizzle") ? "." . $reversedSwizzles[$dimension] : "";
+	$function = $name . "_" . $dimension . "D_" . $form;
+	$benchmark = "BM_" . $name . "/" . $dimension . "D/" . $form;
+	
+	# Throughput, independent elements
+	$call = FillExpression($expression, "VEC" => "vec" . $dimension, "A" => "a" . $dimension . "[n]" . $suffix, "B" => "b" . $dimension . "[n]" . $suffix, "X" => "axis" . $dimension . "[n]" . $suffix, "S" => "scalars[n]", "M" => "matrix" . $dimension . "[n]", "Q" => "rotations[n]");
+	if ($kind eq "vector")
+	{
+		$store = "out" . $dimension . "[n] = " . $call . "; DoNotOptimize(out" . $dimension . "[n]);";
+	}
+	elsif ($kind eq "scalar")
+	{
+		$store = "outScalar[n] = " . $call . "; DoNotOptimize(outScalar[n]);";
+	}
+	elsif ($kind eq "bool")
+	{
+		$store = "outBool[n] = " . $call . "; DoNotOptimize(outBool[n]);";
+	}
+	elsif ($kind eq "chars")
+	{
+		$store = "DoNotOptimize(" . $call . ");";
+	}
+	else
+	{
+		$store = "outString = " . $call . "; DoNotOptimize(outString);";
+	}
+	
+	print "void Throughput_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	print "\t\tunsigned n = i & DATA_MASK;\n";
+	print "\t\t" . $store . "\n";
+	print "\t}\n";
+	print "}\n\n";
+	push(@registered, "{ \"" . $benchmark . "/throughput\", Throughput_" . $function . ", 1 }");
+	
+	# Latency, each result is the next first argument (non-vector results are fed back through x)
+	$call = FillExpression($expression, "VEC" => "vec" . $dimension, "A" => "r" . $suffix, "B" => "b" . $dimension . "[n]" . $suffix, "X" => "axis" . $dimension . "[n]" . $suffix, "S" => "scalars[n]", "M" => "matrix" . $dimension . "[n]", "Q" => "rotations[n]");
+	if ($kind eq "vector")
+	{
+		$store = "r = " . $call . ";";
+	}
+	elsif ($kind eq "scalar")
+	{
+		$store = "r.x = " . $call . ";";
+	}
+	elsif ($kind eq "bool")
+	{
+		$store = "r.x += " . $call . ";";
+	}
+	elsif ($kind eq "chars")
+	{
+		$store = "r.x = (SCALAR_TYPE)(" . $call . " - outChars);";
+	}
+	else
+	{
+		$store = "r.x = (SCALAR_TYPE)" . $call . ".size();";
+	}
+	
+	print "void Latency_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tvec" . $dimension . " r = a" . $dimension . "[0];\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	if ($call =~ /\[n\]/)
+	{
+		print "\t\tunsigned n = i & DATA_MASK;\n";
+	}
+	print "\t\t" . $store . "\n";
+	print "\t}\n";
+	print "\tDoNotOptimize(r);\n";
+	print "}\n\n";
+	push(@registered, "{ \"" . $benchmark . "/latency\", Latency_" . $function . ", 1 }");
+}
+
+# One iteration processes the whole working set
+sub PrintBatchBenchmark
+{
+	my($name, $call, $dimension, $form) = @_;
+	
+	$suffix = ($form eq "swizzle") ? "." . $reversedSwizzles[$dimension] : "";
+	$function = "Batch" . $name . "_" . $dimension . "D_" . $form;
+	
+	$call = FillExpression($call, "OUT" => "soaOut" . $dimension, "A" => "soaA" . $dimension . $suffix, "B" => "soaB" . $dimension . $suffix, "R" => "outScalar", "X" => "axis" . $dimension . "[0]", "S" => "scalars[0]", "M" => "matrix" . $dimension . "[0]", "Q" => "rotations[0]");
+	
+	print "void Throughput_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	print "\t\t" . $call . ";\n";
+	print "\t\tDoNotOptimize(outScalar);\n";
+	print "\t}\n";
+	print "}\n\n";
+	push(@registered, "{ \"BM_Batch" . $name . "/" . $dimension . "D/" . $form . "/throughput\", Throughput_" . $function . ", DATA_SIZE }");
+}
+
+# Matrix operations have no swizzle form; latency cases feed the result (or, for scalars, its first element) back into M
+sub PrintMatrixBenchmarks
+{
+	my($name, $kind, $expression, $dimension) = @_;
+	
+	$form = ($kind eq "array") ? "array" : "matrix";
+	$function = $name . "_" . $dimension . "D_" . $form;
+	$benchmark = "BM_" . $name . "/" . $dimension . "D/" . $form;
+	
+	$call = FillExpression($expression, "M" => "matrix" . $dimension . "[n]", "N" => "otherMatrix" . $dimension . "[n]", "OUT_ARRAY" => "out" . $dimension, "A_ARRAY" => "a" . $dimension);
+	if ($kind eq "array")
+	{
+		$call = FillExpression($expression, "M" => "matrix" . $dimension . "[0]", "Q" => "rotations[0]", "OUT_ARRAY" => "out" . $dimension, "A_ARRAY" => "a" . $dimension);
+		$store = $call . "; DoNotOptimize(out" . $dimension . ");";
+	}
+	elsif ($kind eq "matrix")
+	{
+		$store = "outMatrix" . $dimension . "[n] = " . $call . "; DoNotOptimize(outMatrix" . $dimension . "[n]);";
+	}
+	else
+	{
+		$store = "outScalar[n] = " . $call . "; DoNotOptimize(outScalar[n]);";
+	}
+	
+	print "void Throughput_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	if ($store =~ /\[n\]/)
+	{
+		print "\t\tunsigned n = i & DATA_MASK;\n";
+	}
+	print "\t\t" . $store . "\n";
+	print "\t}\n";
+	print "}\n\n";
+	push(@registered, "{ \"" . $benchmark . "/throughput\", Throughput_" . $function . ", " . (($kind eq "array") ? "DATA_SIZE" : "1") . " }");
+	
+	if ($kind eq "array")
+	{
+		return;
+	}
+	
+	$call = FillExpression($expression, "M" => "r", "N" => "otherMatrix" . $dimension . "[n]");
+	$store = ($kind eq "matrix") ? "r = " . $call . ";" : "r[0].x = " . $call . ";";
+	
+	print "void Latency_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tmat" . $dimension . " r = matrix" . $dimension . "[0];\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	if ($call =~ /\[n\]/)
+	{
+		print "\t\tunsigned n = i & DATA_MASK;\n";
+	}
+	print "\t\t" . $store . "\n";
+	print "\t}\n";
+	print "\tDoNotOptimize(r);\n";
+	print "}\n\n";
+	push(@registered, "{ \"" . $benchmark . "/latency\", Latency_" . $function . ", 1 }");
+}
+
+# Latency cases feed each result back in as P
+sub PrintQuaternionBenchmarks
+{
+	my($name, $expression) = @_;
+	
+	$function = $name . "_quaternion";
+	$benchmark = "BM_" . $name . "/quaternion";
+	$output = ($expression =~ /ToMatrix/) ? "outRotationMatrix" : "outRotations";
+	
+	$call = FillExpression($expression, "P" => "rotations[n]", "Q" => "otherRotations[n]", "S" => "scalars[n]");
+	print "void Throughput_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	print "\t\tunsigned n = i & DATA_MASK;\n";
+	print "\t\t" . $output . "[n] = " . $call . "; DoNotOptimize(" . $output . "[n]);\n";
+	print "\t}\n";
+	print "}\n\n";
+	push(@registered, "{ \"" . $benchmark . "/throughput\", Throughput_" . $function . ", 1 }");
+	
+	if ($output ne "outRotations")
+	{
+		return;
+	}
+	
+	$call = FillExpression($expression, "P" => "r", "Q" => "otherRotations[n]", "S" => "scalars[n]");
+	print "void Latency_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tquat r = rotations[0];\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	print "\t\tunsigned n = i & DATA_MASK;\n";
+	print "\t\tr = " . $call . ";\n";
+	print "\t}\n";
+	print "\tDoNotOptimize(r);\n";
+	print "}\n\n";
+	push(@registered, "{ \"" . $benchmark . "/latency\", Latency_" . $function . ", 1 }");
+}
+
+# Fits run over the whole working set per call, ray tests take the next box (or packet) and ray
+sub PrintReductionBenchmarks
+{
+	my($name, $result, $call, $items, $dimension) = @_;
+	
+	$function = $name . "_" . $dimension . "D";
+	$benchmark = "BM_" . $name . "/" . $dimension . "D";
+	
+	$call = FillExpression($call, "P" => "a" . $dimension);
+	$output = (($result eq "VECTOR") ? "out" : "outMatrix") . $dimension . "[0]";
+	
+	print "void Throughput_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	print "\t\t" . $output . " = " . $call . "; DoNotOptimize(" . $output . ");\n";
+	print "\t}\n";
+	print "}\n\n";
+	push(@registered, "{ \"" . $benchmark . "/throughput\", Throughput_" . $function . ", " . $items . " }");
+}
+
+sub PrintBoxBenchmarks
+{
+	my($name, $result, $call, $items, $dimension) = @_;
+	
+	$function = $name . "_" . $dimension . "D";
+	$benchmark = "BM_" . $name . "/" . $dimension . "D";
+	
+	$call = FillExpression($call, "P" => "a" . $dimension, "BATCH" => "soaA" . $dimension, "B" => "boxes" . $dimension . "[n]", "K4" => "packets4x" . $dimension . "[n & (DATA_MASK / 4)]", "K8" => "packets8x" . $dimension . "[n & (DATA_MASK / 8)]", "O" => "rayOrigins" . $dimension . "[n]", "I" => "rayInverses" . $dimension . "[n]", "D" => "outScalar");
+	if ($result eq "BOX")
+	{
+		$store = "outBox" . $dimension . " = " . $call . "; DoNotOptimize(outBox" . $dimension . ");";
+	}
+	else
+	{
+		$store = "outHits[n] = " . $call . "; DoNotOptimize(outHits[n]);";
+	}
+	
+	print "void Throughput_" . $function . "(const unsigned& iterations)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < iterations; i++)\n";
+	print "\t{\n";
+	if ($store =~ /\[n/)
+	{
+		print "\t\tunsigned n = i & DATA_MASK;\n";
+	}
+	print "\t\t" . $store . "\n";
+	print "\t}\n";
+	print "}\n\n";
+	push(@registered, "{ \"" . $benchmark . "/throughput\", Throughput_" . $function . ", " . $items . " }");
+}
+
+sub PrintBenchmarkMain
+{
+	print "const BENCHMARK benchmarks[] =\n";
+	print "{\n";
+	print "\t" . join(",\n\t", @registered) . "\n";
+	print "};\n\n";
+	print "int main(int argc, char* argv[])\n";
+	print "{\n";
+	print "\tdouble minTime = 0.1;\n";
+	print "\tstring filter = \"\";\n";
+	print "\t\n";
+	print "\tfor (int i = 1; i < argc; i++)\n";
+	print "\t{\n";
+	print "\t\tstring argument = argv[i];\n";
+	print "\t\t\n";
+	print "\t\tif (argument.find(\"--benchmark_min_time=\") == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tminTime = atof(argument.substr(21).c_str());\n";
+	print "\t\t}\n";
+	print "\t\telse if (argument.find(\"--benchmark_filter=\") == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tfilter = argument.substr(19);\n";
+	print "\t\t}\n";
+	print "\t\telse\n";
+	print "\t\t{\n";
+	print "\t\t\tstd::cerr << \"Usage: \" << argv[0] << \" [--benchmark_min_time=<seconds>] [--benchmark_filter=<substring>]\" << std::endl;\n";
+	print "\t\t\treturn 1;\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\t\n";
+	print "\tSetUp();\n";
+	print "\t\n";
+	print "\tchar date[32];\n";
+	print "\ttime_t now = time(0);\n";
+	print "\tstrftime(date, sizeof(date), \"%Y-%m-%dT%H:%M:%S\", localtime(&now));\n";
+	print "\t\n";
+	print "\tcout << \"{\\n\";\n";
+	print "\tcout << \"  \\\"context\\\": {\\n\";\n";
+	print "\tcout << \"    \\\"date\\\": \\\"\" << date << \"\\\",\\n\";\n";
+	print "\tcout << \"    \\\"executable\\\": \\\"\" << argv[0] << \"\\\",\\n\";\n";
+	print "#ifdef NDEBUG\n";
+	print "\tcout << \"    \\\"library_build_type\\\": \\\"release\\\",\\n\";\n";
+	print "#else\n";
+	print "\tcout << \"    \\\"library_build_type\\\": \\\"debug\\\",\\n\";\n";
+	print "#endif\n";
+	print "\tcout << \"    \\\"svml_precision\\\": \" << SVML_PRECISION << \",\\n\";\n";
+	print "#ifdef SVML_USE_SSE\n";
+	print "\tcout << \"    \\\"svml_use_sse\\\": true\\n\";\n";
+	print "#else\n";
+	print "\tcout << \"    \\\"svml_use_sse\\\": false\\n\";\n";
+	print "#endif\n";
+	print "\tcout << \"  },\\n\";\n";
+	print "\tcout << \"  \\\"benchmarks\\\": [\";\n";
+	print "\t\n";
+	print "\tbool first = true;\n";
+	print "\tfor (unsigned b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++)\n";
+	print "\t{\n";
+	print "\t\tif (string(benchmarks[b].name).find(filter) == string::npos)\n";
+	print "\t\t{\n";
+	print "\t\t\tcontinue;\n";
+	print "\t\t}\n";
+	print "\t\t\n";
+	print "\t\t// Grow the iteration count until one run takes at least minTime\n";
+	print "\t\tdouble iterations = 1;\n";
+	print "\t\tdouble wall = 0;\n";
+	print "\t\tdouble cpu = 0;\n";
+	print "\t\twhile (true)\n";
+	print "\t\t{\n";
+	print "\t\t\tdouble wallStart = WallSeconds();\n";
+	print "\t\t\tdouble cpuStart = CpuSeconds();\n";
+	print "\t\t\tbenchmarks[b].function((unsigned)iterations);\n";
+	print "\t\t\twall = WallSeconds() - wallStart;\n";
+	print "\t\t\tcpu = CpuSeconds() - cpuStart;\n";
+	print "\t\t\t\n";
+	print "\t\t\tif (wall >= minTime || iterations >= 1e9)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tbreak;\n";
+	print "\t\t\t}\n";
+	print "\t\t\t\n";
+	print "\t\t\tdouble multiplier = (wall > minTime / 100) ? (minTime * 1.4 / wall) : 10;\n";
+	print "\t\t\titerations = (multiplier > 10) ? iterations * 10 : (double)(unsigned)(iterations * multiplier + 1);\n";
+	print "\t\t}\n";
+	print "\t\t\n";
+	print "\t\tcout << (first ? \"\\n\" : \",\\n\");\n";
+	print "\t\tfirst = false;\n";
+	print "\t\tcout << \"    {\\n\";\n";
+	print "\t\tcout << \"      \\\"name\\\": \\\"\" << benchmarks[b].name << \"\\\",\\n\";\n";
+	print "\t\tcout << \"      \\\"run_name\\\": \\\"\" << benchmarks[b].name << \"\\\",\\n\";\n";
+	print "\t\tcout << \"      \\\"run_type\\\": \\\"iteration\\\",\\n\";\n";
+	print "\t\tcout << \"      \\\"repetitions\\\": 1,\\n\";\n";
+	print "\t\tcout << \"      \\\"repetition_index\\\": 0,\\n\";\n";
+	print "\t\tcout << \"      \\\"threads\\\": 1,\\n\";\n";
+	print "\t\tcout << \"      \\\"iterations\\\": \" << (unsigned)iterations << \",\\n\";\n";
+	print "\t\tcout << \"      \\\"real_time\\\": \" << wall * 1e9 / iterations << \",\\n\";\n";
+	print "\t\tcout << \"      \\\"cpu_time\\\": \" << cpu * 1e9 / iterations << \",\\n\";\n";
+	print "\t\tcout << \"      \\\"time_unit\\\": \\\"ns\\\",\\n\";\n";
+	print "\t\tcout << \"      \\\"items_per_second\\\": \" << ((wall > 0) ? iterations * benchmarks[b].itemsPerIteration / wall : 0) << \"\\n\";\n";
+	print "\t\tcout << \"    }\";\n";
+	print "\t}\n";
+	print "\tcout << \"\\n  ]\\n\";\n";
+	print "\tcout << \"}\\n\";\n";
+	print "\t\n";
+	print "\treturn 0;\n";
+	print "}\n";
+}
+
+
+PrintBenchmarkTop();
+
+for ($z = 2; $z <= 4; $z++)
+{
+	print "//----------------------------------------------------------------------\n";
+	print "// " . $z . "D\n";
+	print "//----------------------------------------------------------------------\n\n";
+	
+	foreach $operation (@benchmarkOperations)
+	{
+		if (index($operation->[3], $z) >= 0)
+		{
+			PrintOperationBenchmarks($operation->[0], $operation->[1], $operation->[2], $z, "vector");
+			PrintOperationBenchmarks($operation->[0], $operation->[1], $operation->[2], $z, "swizzle");
+		}
+	}
+	
+	foreach $operation (@matrixOperations)
+	{
+		if (index($operation->[3], $z) >= 0)
+		{
+			PrintMatrixBenchmarks($operation->[0], $operation->[1], $operation->[2], $z);
+		}
+	}
+	
+	foreach $operation (@batchOperations)
+	{
+		if (index($operation->[2], $z) >= 0)
+		{
+			PrintBatchBenchmark($operation->[0], $operation->[1], $z, "vector");
+			PrintBatchBenchmark($operation->[0], $operation->[1], $z, "swizzle");
+		}
+	}
+}
+
+print "//----------------------------------------------------------------------\n";
+print "// Quaternions\n";
+print "//----------------------------------------------------------------------\n\n";
+
+foreach $operation (@quaternionOperations)
+{
+	PrintQuaternionBenchmarks($operation->[0], $operation->[1]);
+}
+
+print "//----------------------------------------------------------------------\n";
+print "// Bounding boxes\n";
+print "//----------------------------------------------------------------------\n\n";
+
+for ($z = 2; $z <= 3; $z++)
+{
+	foreach $operation (@boxOperations)
+	{
+		if (index($operation->[4], $z) >= 0)
+		{
+			PrintBoxBenchmarks($operation->[0], $operation->[1], $operation->[2], $operation->[3], $z);
+		}
+	}
+}
+
+print "//----------------------------------------------------------------------\n";
+print "// Reductions\n";
+print "//----------------------------------------------------------------------\n\n";
+
+for ($z = 2; $z <= 4; $z++)
+{
+	foreach $operation (@reductionOperations)
+	{
+		if (index($operation->[4], $z) >= 0)
+		{
+			PrintReductionBenchmarks($operation->[0], $operation->[1], $operation->[2], $operation->[3], $z);
+		}
+	}
+}
+
+PrintBenchmarkMain();
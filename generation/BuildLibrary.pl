@@ -1,6 +1,8 @@
 #!/usr/bin/perl -w
 
 require "support.pl";
+require "simd.pl";
+require "expression.pl";
 require "vectorType.pl";
 require "swizzles.pl";
 require "asmd.pl";
@@ -8,20 +10,58 @@ require "comparisons.pl";
 require "otherArithmetic.pl";
 require "standardVectorFunctions.pl";
 require "mathFunctions.pl";
+require "commonFunctions.pl";
 require "2DSpecificFunctions.pl";
 require "3DSpecificFunctions.pl";
 require "4DSpecificFunctions.pl";
+require "soa.pl";
+require "matrix.pl";
+require "quaternion.pl";
+require "rotation2.pl";
+require "aabb.pl";
+require "reduction.pl";
+require "half.pl";
+require "fixed.pl";
+require "wide.pl";
+require "bulk.pl";
+require "dispatch.pl";
+require "hashGrid.pl";
+require "spatialTrees.pl";
+require "binaryFile.pl";
+require "text.pl";
 
+use FindBin;
 
+# Each header is written next to this directory: svml_core.h, svml_vector2.h to svml_vector4.h, svml.h and svml_io.h
+sub OpenHeader
+{
+	my($name) = @_;
+	
+	open(HEADER, ">", $FindBin::Bin . "/../" . $name) or die "Can't write " . $name . ": " . $!;
+	select(HEADER);
+}
+
+sub CloseHeader
+{
+	select(STDOUT);
+	close(HEADER);
+}
+
+
+OpenHeader("svml_core.h");
 TopData();
+BottomData();
+CloseHeader();
 
 for ($z = 2; $z <= 4; $z++)
 {
+	OpenHeader("svml_vector" . $z . ".h");
+	HeaderTopData("SVML_VECTOR" . $z . "_H", ($z == 2) ? "\"svml_core.h\"" : "\"svml_vector" . ($z - 1) . ".h\"");
+	
 	VectorSectionContent($z, 2);
 	
 	MakeVectorType($z);
 	
-	ToString($z);
 	Negate($z);
 	
 	Addition($z);
@@ -32,6 +72,8 @@ for ($z = 2; $z <= 4; $z++)
 	ScalarMultiplication($z);
 	ScalarDivision($z);
 	
+	MakeMaskType($z);
+	
 	EqualTo($z);
 	NotEqualTo($z);
 	AlmostEqual($z);
@@ -39,6 +81,12 @@ for ($z = 2; $z <= 4; $z++)
 	GreaterThan($z);
 	LessThanOrEqual($z);
 	GreaterThanOrEqual($z);
+	ComparisonMasks($z);
+	Select($z);
+	print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+	WideMasks($z);
+	print "#endif // SVML_HAS_CLASS_COMPONENTS\n";
+	print "\n";
 	
 	Normalize($z);
 	Dot($z);
@@ -75,12 +123,245 @@ for ($z = 2; $z <= 4; $z++)
 	ScalarMin($z);
 	Ceil($z);
 	Floor($z);
+	CommonFunctions($z);
 	
 	Distance($z);
 	DistanceSquared($z);
 	
+	HeaderBottomData("SVML_VECTOR" . $z . "_H");
+	CloseHeader();
+}
+
+OpenHeader("svml.h");
+HeaderTopData("SVML_H", "\"svml_core.h\"", "\"svml_vector2.h\"", "\"svml_vector3.h\"", "\"svml_vector4.h\"");
+
+SectionHeader("Structure-of-arrays batch types and associated functions");
+
+PrintSoaUtilities();
+
+for ($z = 2; $z <= 4; $z++)
+{
+	MakeSoaViewType($z);
+}
+
+PrintSoaSwizzleTemplate();
+
+for ($z = 2; $z <= 4; $z++)
+{
+	MakeSoaType($z);
+	
+	SoaNegate($z);
+	
+	SoaComponentFunction($z, "Add", "+");
+	SoaComponentFunction($z, "Subtract", "-");
+	SoaComponentFunction($z, "Multiply", "*");
+	SoaComponentFunction($z, "Divide", "/");
+	
+	SoaScalarFunction($z, "Multiply", "*");
+	SoaScalarFunction($z, "Divide", "/");
+	
+	SoaNormalize($z);
+	SoaDot($z);
+	if ($z > 2)
+	{
+		SoaCross($z);
+	}
+	SoaProjection($z);
+	SoaRotation($z);
+	SoaLerp($z);
+	
+	SoaMinMax($z, "Max");
+	SoaMinMax($z, "Min");
+	SoaRound($z, "Ceil", "ceil");
+	SoaRound($z, "Floor", "floor");
+	
+	SoaDistance($z, "Distance");
+	SoaDistance($z, "DistanceSquared");
+	
 	print "\n";
 	print "\n";
 }
 
-BottomData();
+SectionHeader("Matrix types and associated functions");
+
+PrintSimdMatrixUtilities();
+
+for ($z = 2; $z <= 4; $z++)
+{
+	MakeMatrixType($z);
+	
+	MatrixArithmetic($z);
+	MatrixMultiplication($z);
+	MatrixComparisons($z);
+	
+	MatrixTranspose($z);
+	MatrixDeterminant($z);
+	MatrixInverse($z);
+	MatrixTransform($z);
+	
+	PrintSimdMatrix($z);
+	
+	print "\n";
+	print "\n";
+}
+
+SectionHeader("Quaternion type and associated functions");
+
+MakeQuaternionType();
+QuaternionFunctions();
+
+for ($z = 3; $z <= 4; $z++)
+{
+	QuaternionRotation($z);
+	QuaternionBatchRotation($z);
+}
+
+SectionHeader("2D rotation type and associated functions");
+
+MakeRotation2Type();
+Rotation2Functions();
+Rotation2BatchRotation();
+
+PrintSimdRotation2();
+
+SectionHeader("Bounding box types and associated functions");
+
+PrintAabbUtilities();
+
+for ($z = 2; $z <= 3; $z++)
+{
+	MakeAabbType($z);
+	MakeAabbPacketType($z);
+	
+	AabbFunctions($z);
+	AabbFit($z);
+	AabbIntersectRay($z);
+	
+	PrintSimdAabb($z);
+	
+	print "\n";
+	print "\n";
+}
+
+SectionHeader("Deterministic reductions over arrays of points");
+
+PrintReductionUtilities();
+PrintSimdReductionUtilities();
+
+for ($z = 2; $z <= 4; $z++)
+{
+	ReductionFunctions($z);
+	
+	print "\n";
+}
+
+SectionHeader("Conversions to and from half-precision storage");
+
+PrintHalfConversionUtilities();
+
+print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+for ($z = 2; $z <= 4; $z++)
+{
+	HalfConversions($z);
+}
+print "#endif // SVML_HAS_CLASS_COMPONENTS\n";
+print "\n";
+
+SectionHeader("Lane-packed vectors");
+
+print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+for ($z = 2; $z <= 4; $z++)
+{
+	WideConversions($z);
+}
+print "#endif // SVML_HAS_CLASS_COMPONENTS\n";
+print "\n";
+
+SectionHeader("Parallel bulk operations on spans of vectors");
+
+BulkBegin();
+PrintBulkUtilities();
+
+for ($z = 2; $z <= 4; $z++)
+{
+	BulkFunctions($z);
+}
+DispatchBegin();
+PrintDispatchUtilities();
+for ($z = 2; $z <= 4; $z++)
+{
+	DispatchFunctions($z);
+}
+DispatchEnd();
+BulkEnd();
+
+SectionHeader("Spatial hash grids");
+
+PrintHashGridUtilities();
+
+for ($z = 2; $z <= 3; $z++)
+{
+	MakeHashGridType($z);
+}
+
+SectionHeader("Kd-trees and bounding volume hierarchies");
+
+PrintSpatialTreeUtilities();
+
+for ($z = 2; $z <= 3; $z++)
+{
+	MakeKdTreeType($z);
+}
+MakeBvhType();
+
+SectionHeader("Binary files of vectors");
+
+print "#ifdef SVML_USE_FILES\n";
+PrintVectorFileUtilities();
+MakeVectorFileWriterType();
+MakeVectorFileType();
+print "#endif // SVML_USE_FILES\n";
+print "\n";
+
+SectionHeader("Text formatting and parsing without allocation");
+
+PrintTextUtilities();
+
+for ($z = 2; $z <= 4; $z++)
+{
+	TextFunctions($z);
+}
+
+LibraryBottomData();
+CloseHeader();
+
+OpenHeader("svml_io.h");
+IoTopData();
+
+print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+FixedToString();
+WideToString();
+print "#endif // SVML_HAS_CLASS_COMPONENTS\n";
+print "\n";
+
+for ($z = 2; $z <= 4; $z++)
+{
+	ToString($z);
+	MaskToString($z);
+}
+
+for ($z = 2; $z <= 4; $z++)
+{
+	MatrixToString($z);
+}
+
+QuaternionToString();
+Rotation2ToString();
+
+for ($z = 2; $z <= 3; $z++)
+{
+	AabbToString($z);
+}
+
+HeaderBottomData("SVML_IO_H");
+CloseHeader();
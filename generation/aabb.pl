@@ -0,0 +1,397 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Axis-aligned bounding boxes (AABB2, AABB3): fitting to points, union/intersection, and ray/box slab tests,
+# one box at a time or a packet of boxes against one ray
+
+sub PrintAabbUtilities
+{
+	print "// Corners of the empty box\n";
+	print "template <typename TYPE> TYPE AabbHighest() { return std::numeric_limits<TYPE>::max(); }\n";
+	print "template <typename TYPE> TYPE AabbLowest() { return std::numeric_limits<TYPE>::is_integer ? std::numeric_limits<TYPE>::min() : -std::numeric_limits<TYPE>::max(); }\n";
+	print "\n";
+	print "// Min and max that return b when either side is NaN, like _mm_min_ps() and _mm_max_ps(), so the scalar and SSE\n";
+	print "// code agree (the slab tests pass the running distance as b, which drops the NaN of 0 * infinity)\n";
+	print "template <typename TYPE> inline TYPE AabbMin(const TYPE& a, const TYPE& b) { return (a < b) ? a : b; }\n";
+	print "template <typename TYPE> inline TYPE AabbMax(const TYPE& a, const TYPE& b) { return (a > b) ? a : b; }\n";
+	print "\n";
+}
+
+sub MakeAabbType
+{
+	my($dimension) = @_;
+
+	$type = "AABB" . $dimension;
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+
+	print "template <typename TYPE>\n";
+	print "struct " . $type . "\n";
+	print "{\n";
+	print "\t" . $vector . " minimum, maximum; // Corners, a box with maximum < minimum on any axis is empty\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\t" . $type . "() {}\n";
+	print "\t" . $type . "(const " . $vector . "& minimum, const " . $vector . "& maximum) : minimum(minimum), maximum(maximum) {}\n";
+	print "\texplicit " . $type . "(const " . $vector . "& point) : minimum(point), maximum(point) {}\n";
+	print "\n";
+	print "\t// Contains nothing and no ray hits it, Union() with it returns the other operand\n";
+	print "\tstatic " . $type . " Empty() { return " . $type . "(" . $vector . "(" . join(", ", ("AabbHighest<TYPE>()") x $dimension) . "), " . $vector . "(" . join(", ", ("AabbLowest<TYPE>()") x $dimension) . ")); }\n";
+	print "};\n";
+	print "\n";
+}
+
+sub AabbFunctions
+{
+	my($dimension) = @_;
+
+	$type = "AABB" . $dimension . "<TYPE>";
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	@components = SoaComponents($dimension);
+
+	print "// " . $dimension . "D box comparisons\n";
+	print "template <typename TYPE> bool operator==(const " . $type . "& lhs, const " . $type . "& rhs) { return lhs.minimum == rhs.minimum && lhs.maximum == rhs.maximum; }\n";
+	print "template <typename TYPE> bool operator!=(const " . $type . "& lhs, const " . $type . "& rhs) { return !(lhs == rhs); }\n";
+	print "\n";
+	print "// " . $dimension . "D box IsEmpty(), Center(), Size()\n";
+	print "template <typename TYPE> bool IsEmpty(const " . $type . "& box) { return " . join(" || ", map { "box.maximum." . $_ . " < box.minimum." . $_ } @components) . "; }\n";
+	print "template <typename TYPE> " . $vector . " Center(const " . $type . "& box) { return (box.minimum + box.maximum) / (TYPE)2; }\n";
+	print "template <typename TYPE> " . $vector . " Size(const " . $type . "& box) { return box.maximum - box.minimum; }\n";
+	if ($dimension == 2)
+	{
+		print "template <typename TYPE> TYPE Area(const " . $type . "& box) { " . $vector . " size = Size(box); return size.x * size.y; }\n";
+	}
+	else
+	{
+		print "template <typename TYPE> TYPE SurfaceArea(const " . $type . "& box) { " . $vector . " size = Size(box); return 2 * (size.x * size.y + size.y * size.z + size.z * size.x); }\n";
+		print "template <typename TYPE> TYPE Volume(const " . $type . "& box) { " . $vector . " size = Size(box); return size.x * size.y * size.z; }\n";
+	}
+	print "\n";
+	print "// " . $dimension . "D box Union() and Intersection() (empty when the boxes do not overlap)\n";
+	print "template <typename TYPE> " . $type . " Union(const " . $type . "& a, const " . $type . "& b)\n";
+	print "{\n";
+	print "\treturn " . $type . "(" . $vector . "(" . join(", ", map { "AabbMin<TYPE>(a.minimum." . $_ . ", b.minimum." . $_ . ")" } @components) . "),\n";
+	print "\t" . (" " x (length($type) + 8)) . $vector . "(" . join(", ", map { "AabbMax<TYPE>(a.maximum." . $_ . ", b.maximum." . $_ . ")" } @components) . "));\n";
+	print "}\n";
+	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, " . $type . " >::type Union(const " . $type . "& box, const SWIZZLE& point) { return Union(box, " . $type . "(typename SWIZZLE::PARENT(point))); }\n";
+	print "template <typename TYPE> " . $type . " Union(const " . $type . "& box, const " . $vector . "& point) { return Union(box, " . $type . "(point)); }\n";
+	print "template <typename TYPE> " . $type . " Intersection(const " . $type . "& a, const " . $type . "& b)\n";
+	print "{\n";
+	print "\treturn " . $type . "(" . $vector . "(" . join(", ", map { "AabbMax<TYPE>(a.minimum." . $_ . ", b.minimum." . $_ . ")" } @components) . "),\n";
+	print "\t" . (" " x (length($type) + 8)) . $vector . "(" . join(", ", map { "AabbMin<TYPE>(a.maximum." . $_ . ", b.maximum." . $_ . ")" } @components) . "));\n";
+	print "}\n";
+	print "\n";
+	print "// " . $dimension . "D box Overlaps() and Contains() (touching faces count)\n";
+	print "template <typename TYPE> bool Overlaps(const " . $type . "& a, const " . $type . "& b) { return " . join(" && ", map { "a.minimum." . $_ . " <= b.maximum." . $_ . " && b.minimum." . $_ . " <= a.maximum." . $_ } @components) . "; }\n";
+	print "template <typename TYPE> bool Contains(const " . $type . "& box, const " . $type . "& inner) { return " . join(" && ", map { "box.minimum." . $_ . " <= inner.minimum." . $_ . " && inner.maximum." . $_ . " <= box.maximum." . $_ } @components) . "; }\n";
+	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type Contains(const " . $type . "& box, const SWIZZLE& point) { return Contains(box, typename SWIZZLE::PARENT(point)); }\n";
+	print "template <typename TYPE> bool Contains(const " . $type . "& box, const " . $vector . "& point) { return " . join(" && ", map { "box.minimum." . $_ . " <= point." . $_ . " && point." . $_ . " <= box.maximum." . $_ } @components) . "; }\n";
+	print "\n";
+}
+
+# Smallest box around an array or batch of points. Each axis keeps its own running minimum and maximum in locals;
+# the SoA version keeps one per lane, so the loop vectorizes, and folds the lanes at the end
+sub AabbFit
+{
+	my($dimension) = @_;
+
+	$type = "AABB" . $dimension . "<TYPE>";
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+	@components = SoaComponents($dimension);
+
+	print "// " . $dimension . "D Fit(): the smallest box containing every point (empty when count is 0)\n";
+	print "template <typename TYPE> " . $type . " Fit(const " . $vector . "* points, const unsigned& count)\n";
+	print "{\n";
+	print "\tTYPE " . join(", ", map { "low" . uc($_) . " = AabbHighest<TYPE>()" } @components) . ";\n";
+	print "\tTYPE " . join(", ", map { "high" . uc($_) . " = AabbLowest<TYPE>()" } @components) . ";\n";
+	print "\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t{\n";
+	foreach $c (@components)
+	{
+		print "\t\tTYPE " . $c . " = points[i]." . $c . ";\n";
+	}
+	foreach $c (@components)
+	{
+		print "\t\tlow" . uc($c) . " = AabbMin(" . $c . ", low" . uc($c) . ");\n";
+		print "\t\thigh" . uc($c) . " = AabbMax(" . $c . ", high" . uc($c) . ");\n";
+	}
+	print "\t}\n";
+	print "\treturn " . $type . "(" . $vector . "(" . join(", ", map { "low" . uc($_) } @components) . "), " . $vector . "(" . join(", ", map { "high" . uc($_) } @components) . "));\n";
+	print "}\n";
+	print "\n";
+
+	print "// " . $dimension . "D batch Fit()\n";
+	print "template <typename A> inline " . SoaWrapperCondition($dimension, "AABB" . $dimension . "< typename ComponentType< typename A::PARENT >::type >", "A") . " Fit(const A& points) { return Fit(typename A::PARENT(points)); }\n";
+	print "template <typename TYPE> " . $type . " Fit(const " . $view . "& points)\n";
+	print "{\n";
+	print "\tTYPE " . join(", ", map { "low" . uc($_) . "[SOA_LANES]" } @components) . ";\n";
+	print "\tTYPE " . join(", ", map { "high" . uc($_) . "[SOA_LANES]" } @components) . ";\n";
+	print "\tfor (size_t lane = 0; lane < SOA_LANES; lane++)\n";
+	print "\t{\n";
+	print "\t\t" . join(" = ", map { "low" . uc($_) . "[lane]" } @components) . " = AabbHighest<TYPE>();\n";
+	print "\t\t" . join(" = ", map { "high" . uc($_) . "[lane]" } @components) . " = AabbLowest<TYPE>();\n";
+	print "\t}\n";
+	print "\tsize_t n = 0;\n";
+	print "\tfor (; n + SOA_LANES <= points.count; n += SOA_LANES)\n";
+	print "\t{\n";
+	print "\t\tfor (size_t lane = 0; lane < SOA_LANES; lane++)\n";
+	print "\t\t{\n";
+	foreach $c (@components)
+	{
+		print "\t\t\tlow" . uc($c) . "[lane] = AabbMin(points." . $c . "[n + lane], low" . uc($c) . "[lane]);\n";
+		print "\t\t\thigh" . uc($c) . "[lane] = AabbMax(points." . $c . "[n + lane], high" . uc($c) . "[lane]);\n";
+	}
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\tfor (size_t i = n; i < points.count; i++)\n";
+	print "\t{\n";
+	foreach $c (@components)
+	{
+		print "\t\tlow" . uc($c) . "[0] = AabbMin(points." . $c . "[i], low" . uc($c) . "[0]);\n";
+		print "\t\thigh" . uc($c) . "[0] = AabbMax(points." . $c . "[i], high" . uc($c) . "[0]);\n";
+	}
+	print "\t}\n";
+	print "\tfor (size_t lane = 1; lane < SOA_LANES; lane++)\n";
+	print "\t{\n";
+	foreach $c (@components)
+	{
+		print "\t\tlow" . uc($c) . "[0] = AabbMin(low" . uc($c) . "[lane], low" . uc($c) . "[0]);\n";
+		print "\t\thigh" . uc($c) . "[0] = AabbMax(high" . uc($c) . "[lane], high" . uc($c) . "[0]);\n";
+	}
+	print "\t}\n";
+	print "\treturn " . $type . "(" . $vector . "(" . join(", ", map { "low" . uc($_) . "[0]" } @components) . "), " . $vector . "(" . join(", ", map { "high" . uc($_) . "[0]" } @components) . "));\n";
+	print "}\n";
+	print "\n";
+}
+
+# The slab test: each axis clips the ray to the distances between its two planes, and the ray hits when the
+# nearest exit is not before the farthest entry. Each axis is entered through the plane facing the ray (picked
+# by the sign of inverseDirection), so an inverted box, like Empty(), is never hit; an origin inside is entered at 0
+sub AabbIntersectRay
+{
+	my($dimension) = @_;
+
+	$type = "AABB" . $dimension . "<TYPE>";
+	$packet = "AABB" . $dimension . "_PACKET<TYPE, SIZE>";
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	@components = SoaComponents($dimension);
+
+	print "// " . $dimension . "D IntersectRay(): inverseDirection is 1 / direction per component (infinite components are\n";
+	print "// fine), true when the ray hits the box within maxDistance, distance is where it enters\n";
+	print "template <typename TYPE> bool IntersectRay(const " . $type . "& box, const " . $vector . "& origin, const " . $vector . "& inverseDirection, const TYPE& maxDistance, TYPE& distance)\n";
+	print "{\n";
+	print "\tTYPE nearest = 0;\n";
+	print "\tTYPE farthest = maxDistance;\n";
+	foreach $c (@components)
+	{
+		print "\tbool flip" . uc($c) . " = inverseDirection." . $c . " < 0;\n";
+		print "\tnearest = AabbMax(((flip" . uc($c) . " ? box.maximum." . $c . " : box.minimum." . $c . ") - origin." . $c . ") * inverseDirection." . $c . ", nearest);\n";
+		print "\tfarthest = AabbMin(((flip" . uc($c) . " ? box.minimum." . $c . " : box.maximum." . $c . ") - origin." . $c . ") * inverseDirection." . $c . ", farthest);\n";
+	}
+	print "\tdistance = nearest;\n";
+	print "\treturn nearest <= farthest;\n";
+	print "}\n";
+	print "\n";
+
+	print "// " . $dimension . "D packet IntersectRay(): bit i of the result is set when box i is hit, entered at distances[i]\n";
+	print "template <typename TYPE, unsigned SIZE> unsigned IntersectRay(const " . $packet . "& boxes, const " . $vector . "& origin, const " . $vector . "& inverseDirection, const TYPE& maxDistance, TYPE* distances)\n";
+	print "{\n";
+	print "\tTYPE " . join(", ", map { "origin" . uc($_) . " = origin." . $_ } @components) . ";\n";
+	print "\tTYPE " . join(", ", map { "inverse" . uc($_) . " = inverseDirection." . $_ } @components) . ";\n";
+	for ($d = 0; $d < $dimension; $d++)
+	{
+		$c = uc($components[$d]);
+		print "\tconst TYPE* entries" . $c . " = (inverse" . $c . " < 0) ? boxes.maximum[" . $d . "] : boxes.minimum[" . $d . "];\n";
+		print "\tconst TYPE* exits" . $c . " = (inverse" . $c . " < 0) ? boxes.minimum[" . $d . "] : boxes.maximum[" . $d . "];\n";
+	}
+	print "\tunsigned hits = 0;\n";
+	print "\tfor (unsigned i = 0; i < SIZE; i++)\n";
+	print "\t{\n";
+	print "\t\tTYPE nearest = 0;\n";
+	print "\t\tTYPE farthest = maxDistance;\n";
+	foreach $c (map { uc($_) } @components)
+	{
+		print "\t\tnearest = AabbMax((entries" . $c . "[i] - origin" . $c . ") * inverse" . $c . ", nearest);\n";
+		print "\t\tfarthest = AabbMin((exits" . $c . "[i] - origin" . $c . ") * inverse" . $c . ", farthest);\n";
+	}
+	print "\t\tdistances[i] = nearest;\n";
+	print "\t\thits |= (unsigned)(nearest <= farthest) << i;\n";
+	print "\t}\n";
+	print "\treturn hits;\n";
+	print "}\n";
+	print "\n";
+}
+
+# SIZE boxes stored axis by axis, so a ray is tested against all of them with the same instructions
+sub MakeAabbPacketType
+{
+	my($dimension) = @_;
+
+	$type = "AABB" . $dimension . "_PACKET";
+	$box = "AABB" . $dimension . "<TYPE>";
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	@components = SoaComponents($dimension);
+
+	print "template <typename TYPE, unsigned SIZE>\n";
+	print "struct " . $type . "\n";
+	print "{\n";
+	print "\tTYPE minimum[" . $dimension . "][SIZE], maximum[" . $dimension . "][SIZE]; // [axis][box]\n";
+	print "\n";
+	print "\t// Constructors (every box starts empty, so unused slots are never hit)\n";
+	print "\t" . $type . "() { for (unsigned i = 0; i < SIZE; i++) { Set(i, " . $box . "::Empty()); } }\n";
+	print "\n";
+	print "\t// Box access\n";
+	print "\t" . $box . " Get(const unsigned& index) const { return " . $box . "(" . $vector . "(" . join(", ", map { "minimum[" . $_ . "][index]" } (0 .. $dimension - 1)) . "), " . $vector . "(" . join(", ", map { "maximum[" . $_ . "][index]" } (0 .. $dimension - 1)) . ")); }\n";
+	print "\tvoid Set(const unsigned& index, const " . $box . "& box) { ";
+	for ($d = 0; $d < $dimension; $d++)
+	{
+		print "minimum[" . $d . "][index] = box.minimum." . $components[$d] . "; maximum[" . $d . "][index] = box.maximum." . $components[$d] . "; ";
+	}
+	print "}\n";
+	print "};\n";
+	print "\n";
+}
+
+# SSE versions: float packets four boxes per step, the 3D single box in the vectors' own registers, and Fit()
+# with the running corners in registers (two 2D points per load)
+sub PrintSimdAabb
+{
+	my($dimension) = @_;
+
+	$box = "AABB" . $dimension . "<float>";
+	$vector = SimdVector($dimension);
+	@components = SoaComponents($dimension);
+
+	SimdBegin();
+	if ($dimension == 2)
+	{
+		print "inline " . $box . " Fit(const " . $vector . "* points, const unsigned& count)\n";
+		print "{\n";
+		print "\t__m128 low = _mm_set1_ps(AabbHighest<float>());\n";
+		print "\t__m128 high = _mm_set1_ps(AabbLowest<float>());\n";
+		print "\tunsigned i = 0;\n";
+		print "\tfor (; i + 2 <= count; i += 2)\n";
+		print "\t{\n";
+		print "\t\t__m128 xyxy = _mm_loadu_ps((const float*)(points + i));\n";
+		print "\t\tlow = _mm_min_ps(xyxy, low);\n";
+		print "\t\thigh = _mm_max_ps(xyxy, high);\n";
+		print "\t}\n";
+		print "\tif (i < count)\n";
+		print "\t{\n";
+		print "\t\t__m128 xy = _mm_setr_ps(points[i].x, points[i].y, points[i].x, points[i].y);\n";
+		print "\t\tlow = _mm_min_ps(xy, low);\n";
+		print "\t\thigh = _mm_max_ps(xy, high);\n";
+		print "\t}\n";
+		print "\tlow = _mm_min_ps(low, _mm_movehl_ps(low, low));\n";
+		print "\thigh = _mm_max_ps(high, _mm_movehl_ps(high, high));\n";
+		print "\tfloat lanes[8];\n";
+		print "\t_mm_storeu_ps(lanes, low);\n";
+		print "\t_mm_storeu_ps(lanes + 4, high);\n";
+		print "\treturn " . $box . "(" . $vector . "(lanes[0], lanes[1]), " . $vector . "(lanes[4], lanes[5]));\n";
+		print "}\n";
+		print "\n";
+	}
+	else
+	{
+		print "inline " . $box . " Fit(const " . $vector . "* points, const unsigned& count)\n";
+		print "{\n";
+		print "\t// Two sets of corners, so consecutive points do not wait on each other\n";
+		print "\t__m128 low0 = _mm_set1_ps(AabbHighest<float>()), low1 = low0;\n";
+		print "\t__m128 high0 = _mm_set1_ps(AabbLowest<float>()), high1 = high0;\n";
+		print "\tunsigned i = 0;\n";
+		print "\tfor (; i + 2 <= count; i += 2)\n";
+		print "\t{\n";
+		print "\t\tlow0 = _mm_min_ps(points[i].Simd(), low0);\n";
+		print "\t\thigh0 = _mm_max_ps(points[i].Simd(), high0);\n";
+		print "\t\tlow1 = _mm_min_ps(points[i + 1].Simd(), low1);\n";
+		print "\t\thigh1 = _mm_max_ps(points[i + 1].Simd(), high1);\n";
+		print "\t}\n";
+		print "\tif (i < count)\n";
+		print "\t{\n";
+		print "\t\tlow0 = _mm_min_ps(points[i].Simd(), low0);\n";
+		print "\t\thigh0 = _mm_max_ps(points[i].Simd(), high0);\n";
+		print "\t}\n";
+		print "\treturn " . $box . "(" . $vector . "(_mm_min_ps(low0, low1)), " . $vector . "(_mm_max_ps(high0, high1)));\n";
+		print "}\n";
+		print "\n";
+		print "inline bool IntersectRay(const " . $box . "& box, const " . $vector . "& origin, const " . $vector . "& inverseDirection, const float& maxDistance, float& distance)\n";
+		print "{\n";
+		print "\t// Entered through the planes facing the ray: the maximum corner where the direction is negative\n";
+		print "\t__m128 flip = _mm_cmplt_ps(inverseDirection.Simd(), _mm_setzero_ps());\n";
+		print "\t__m128 entryCorner = _mm_or_ps(_mm_and_ps(flip, box.maximum.Simd()), _mm_andnot_ps(flip, box.minimum.Simd()));\n";
+		print "\t__m128 exitCorner = _mm_or_ps(_mm_and_ps(flip, box.minimum.Simd()), _mm_andnot_ps(flip, box.maximum.Simd()));\n";
+		print "\t__m128 entries = _mm_mul_ps(_mm_sub_ps(entryCorner, origin.Simd()), inverseDirection.Simd());\n";
+		print "\t__m128 exits = _mm_mul_ps(_mm_sub_ps(exitCorner, origin.Simd()), inverseDirection.Simd());\n";
+		print "\t// Folds x, y, and z in the scalar order (w is not an axis)\n";
+		print "\t__m128 nearest = _mm_max_ss(entries, _mm_setzero_ps());\n";
+		print "\t__m128 farthest = _mm_min_ss(exits, _mm_set_ss(maxDistance));\n";
+		print "\tnearest = _mm_max_ss(_mm_shuffle_ps(entries, entries, _MM_SHUFFLE(1, 1, 1, 1)), nearest);\n";
+		print "\tfarthest = _mm_min_ss(_mm_shuffle_ps(exits, exits, _MM_SHUFFLE(1, 1, 1, 1)), farthest);\n";
+		print "\tnearest = _mm_max_ss(_mm_movehl_ps(entries, entries), nearest);\n";
+		print "\tfarthest = _mm_min_ss(_mm_movehl_ps(exits, exits), farthest);\n";
+		print "\tdistance = _mm_cvtss_f32(nearest);\n";
+		print "\treturn distance <= _mm_cvtss_f32(farthest);\n";
+		print "}\n";
+		print "\n";
+	}
+
+	print "template <unsigned SIZE> unsigned IntersectRay(const AABB" . $dimension . "_PACKET<float, SIZE>& boxes, const " . $vector . "& origin, const " . $vector . "& inverseDirection, const float& maxDistance, float* distances)\n";
+	print "{\n";
+	print "\t__m128 " . join(", ", map { "origin" . uc($_) . " = _mm_set1_ps(origin." . $_ . ")" } @components) . ";\n";
+	print "\t__m128 " . join(", ", map { "inverse" . uc($_) . " = _mm_set1_ps(inverseDirection." . $_ . ")" } @components) . ";\n";
+	for ($d = 0; $d < $dimension; $d++)
+	{
+		$c = uc($components[$d]);
+		print "\tconst float* entries" . $c . " = (inverseDirection." . $components[$d] . " < 0) ? boxes.maximum[" . $d . "] : boxes.minimum[" . $d . "];\n";
+		print "\tconst float* exits" . $c . " = (inverseDirection." . $components[$d] . " < 0) ? boxes.minimum[" . $d . "] : boxes.maximum[" . $d . "];\n";
+	}
+	print "\tunsigned hits = 0;\n";
+	print "\tunsigned i = 0;\n";
+	print "\tfor (; i + 4 <= SIZE; i += 4)\n";
+	print "\t{\n";
+	print "\t\t__m128 nearest = _mm_setzero_ps();\n";
+	print "\t\t__m128 farthest = _mm_set1_ps(maxDistance);\n";
+	foreach $c (map { uc($_) } @components)
+	{
+		print "\t\tnearest = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(entries" . $c . " + i), origin" . $c . "), inverse" . $c . "), nearest);\n";
+		print "\t\tfarthest = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(exits" . $c . " + i), origin" . $c . "), inverse" . $c . "), farthest);\n";
+	}
+	print "\t\t_mm_storeu_ps(distances + i, nearest);\n";
+	print "\t\thits |= (unsigned)_mm_movemask_ps(_mm_cmple_ps(nearest, farthest)) << i;\n";
+	print "\t}\n";
+	print "\tfor (; i < SIZE; i++)\n";
+	print "\t{\n";
+	print "\t\tfloat distance;\n";
+	print "\t\thits |= (unsigned)IntersectRay(boxes.Get(i), origin, inverseDirection, maxDistance, distance) << i;\n";
+	print "\t\tdistances[i] = distance;\n";
+	print "\t}\n";
+	print "\treturn hits;\n";
+	print "}\n";
+	SimdEnd();
+	print "\n";
+}
+
+# Box operator<< and ToString() (printed in svml_io.h)
+sub AabbToString
+{
+	my($dimension) = @_;
+
+	$type = "AABB" . $dimension . "<TYPE>";
+
+	print "// " . $dimension . "D box operator<< and ToString()\n";
+	print "template <typename TYPE> ostream& operator<<(ostream& os, const " . $type . "& printBox)\n";
+	print "{\n";
+	print "\tos << \"(\" << printBox.minimum << \", \" << printBox.maximum << \")\";\n";
+	print "\treturn os;\n";
+	print "}\n";
+	print "template <typename TYPE> string ToString(const " . $type . "& printBox)\n";
+	print "{\n";
+	print "\tstd::ostringstream buffer;\n";
+	print "\tbuffer << printBox;\n";
+	print "\treturn buffer.str();\n";
+	print "}\n";
+	print "\n";
+}
+
+return 1;
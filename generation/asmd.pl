@@ -9,10 +9,8 @@ sub Addition
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Addition [+]\n";
-	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator+(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) + typename SWIZZLE1::PARENT(rhs); }\n";
-	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator+(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) + rhs; }\n";
-	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator+(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs + typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> operator+(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	PrintExpressionOperators($dimension, "+", "EXPRESSION_ADD");
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> operator+(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -22,11 +20,13 @@ sub Addition
 			{
 				print ", ";
 			}
-			print "lhs." . NumberToSwizzle($d) . " + rhs." . NumberToSwizzle($d);
+			print ComponentOf("lhs", $d) . " + " . ComponentOf("rhs", $d);
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdOperator($dimension, "+", "_mm_add_ps");
 }
 
 sub Subtraction
@@ -34,10 +34,8 @@ sub Subtraction
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Subtraction [-]\n";
-	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator-(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) - typename SWIZZLE1::PARENT(rhs); }\n";
-	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) - rhs; }\n";
-	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs - typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> operator-(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	PrintExpressionOperators($dimension, "-", "EXPRESSION_SUBTRACT");
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> operator-(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -47,11 +45,13 @@ sub Subtraction
 			{
 				print ", ";
 			}
-			print "lhs." . NumberToSwizzle($d) . " - rhs." . NumberToSwizzle($d);
+			print ComponentOf("lhs", $d) . " - " . ComponentOf("rhs", $d);
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdOperator($dimension, "-", "_mm_sub_ps");
 }
 
 sub Multiplication
@@ -59,10 +59,8 @@ sub Multiplication
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Multiplication [*]: Component-wise\n";
-	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator*(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) * typename SWIZZLE1::PARENT(rhs); }\n";
-	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) * rhs; }\n";
-	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> operator*(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	PrintExpressionOperators($dimension, "*", "EXPRESSION_MULTIPLY");
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> operator*(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -72,11 +70,13 @@ sub Multiplication
 			{
 				print ", ";
 			}
-			print "lhs." . NumberToSwizzle($d) . " * rhs." . NumberToSwizzle($d);
+			print ComponentOf("lhs", $d) . " * " . ComponentOf("rhs", $d);
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdOperator($dimension, "*", "_mm_mul_ps");
 }
 
 sub Division
@@ -84,10 +84,8 @@ sub Division
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Division [/]: Component-wise\n";
-	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator/(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) / typename SWIZZLE1::PARENT(rhs); }\n";
-	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) / rhs; }\n";
-	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs / typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> operator/(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	PrintExpressionOperators($dimension, "/", "EXPRESSION_DIVIDE");
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> operator/(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -97,11 +95,13 @@ sub Division
 			{
 				print ", ";
 			}
-			print "lhs." . NumberToSwizzle($d) . " / rhs." . NumberToSwizzle($d);
+			print ComponentOf("lhs", $d) . " / " . ComponentOf("rhs", $d);
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdOperator($dimension, "/", "_mm_div_ps");
 }
 
 return 1;
\ No newline at end of file
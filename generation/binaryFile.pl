@@ -0,0 +1,461 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Binary files of vectors (SVML_USE_FILES): a 64-byte VECTOR_FILE_HEADER, then the vectors, either whole (AOS, exactly
+# as they are in memory) or as one array per component (SOA). VECTOR_FILE_WRITER streams them out, and VECTOR_FILE
+# maps a file and hands out pointers into the mapping when its layout is the one in memory
+
+sub PrintVectorFileUtilities
+{
+	print "// Version of the format VECTOR_FILE_WRITER writes (VECTOR_FILE reads this one and earlier), and the bytes before the\n";
+	print "// first vector, so vectors start on a cache line of the mapping\n";
+	print "const unsigned VECTOR_FILE_VERSION = 1;\n";
+	print "const unsigned VECTOR_FILE_HEADER_BYTES = 64;\n";
+	print "\n";
+	print "// Layouts\n";
+	print "const unsigned VECTOR_FILE_AOS = 0; // Whole vectors one after another, as they are in memory (SSE vec3 keeps its fourth lane)\n";
+	print "const unsigned VECTOR_FILE_SOA = 1; // Every x, then every y and so on, each array starting on a 64-byte boundary\n";
+	print "\n";
+	print "// Component kinds (VECTOR_FILE_NATIVE asks a writer for the vectors' own)\n";
+	print "const unsigned VECTOR_FILE_NATIVE = 0;\n";
+	print "const unsigned VECTOR_FILE_FLOAT32 = 1;\n";
+	print "const unsigned VECTOR_FILE_FLOAT64 = 2;\n";
+	print "const unsigned VECTOR_FILE_INT32 = 3;\n";
+	print "const unsigned VECTOR_FILE_FLOAT16 = 4; // HALF\n";
+	print "const unsigned VECTOR_FILE_BFLOAT16 = 5;\n";
+	print "const unsigned VECTOR_FILE_FIXED = 6; // FIXED's raw Q16.16 int32_t\n";
+	print "\n";
+	print "// Vectors written in blocks of this many, when they have to be converted or split into components first\n";
+	print "const unsigned VECTOR_FILE_BLOCK = 256;\n";
+	print "\n";
+	print "// Everything before the vectors. Multibyte fields and components are in the writer's byte order, which byteOrder\n";
+	print "// records: 0x0102 as written, so it reads 0x0201 on a machine of the other order\n";
+	print "struct VECTOR_FILE_HEADER\n";
+	print "{\n";
+	print "\tchar magic[4]; // \"SVML\"\n";
+	print "\tuint16_t version;\n";
+	print "\tuint16_t byteOrder;\n";
+	print "\tuint64_t count;\n";
+	print "\tuint8_t kind;\n";
+	print "\tuint8_t dimension;\n";
+	print "\tuint8_t layout;\n";
+	print "\tuint8_t stride; // Bytes from one vector to the next in AOS files\n";
+	print "\tuint8_t reserved[44];\n";
+	print "};\n";
+	print "\n";
+	print "// Kind of components of TYPE (there is none for other types, which can't be stored)\n";
+	print "template <typename TYPE> struct VectorFileKind;\n";
+	print "template <> struct VectorFileKind<float> { enum { value = VECTOR_FILE_FLOAT32 }; };\n";
+	print "template <> struct VectorFileKind<double> { enum { value = VECTOR_FILE_FLOAT64 }; };\n";
+	print "template <> struct VectorFileKind<int> { enum { value = VECTOR_FILE_INT32 }; };\n";
+	print "template <> struct VectorFileKind<HALF> { enum { value = VECTOR_FILE_FLOAT16 }; };\n";
+	print "template <> struct VectorFileKind<BFLOAT16> { enum { value = VECTOR_FILE_BFLOAT16 }; };\n";
+	print "template <> struct VectorFileKind<FIXED> { enum { value = VECTOR_FILE_FIXED }; };\n";
+	print "\n";
+	print "// Bytes of a component of kind (0 for no kind)\n";
+	print "inline unsigned VectorFileComponentBytes(const unsigned& kind)\n";
+	print "{\n";
+	print "\tstatic const unsigned bytes[7] = { 0, 4, 8, 4, 2, 2, 4 };\n";
+	print "\treturn (kind < 7) ? bytes[kind] : 0;\n";
+	print "}\n";
+	print "\n";
+	print "// Offset of the array of component axis in a SOA file of count components of kind\n";
+	print "inline uint64_t VectorFileArrayOffset(const uint64_t& count, const unsigned& kind, const unsigned& axis)\n";
+	print "{\n";
+	print "\tuint64_t arrayBytes = (count * VectorFileComponentBytes(kind) + SOA_ALIGNMENT - 1) / SOA_ALIGNMENT * SOA_ALIGNMENT;\n";
+	print "\treturn VECTOR_FILE_HEADER_BYTES + axis * arrayBytes;\n";
+	print "}\n";
+	print "\n";
+	print "// value with its bytes reversed\n";
+	print "template <typename TYPE> TYPE VectorFileSwap(const TYPE& value)\n";
+	print "{\n";
+	print "\tunsigned char bytes[sizeof(TYPE)];\n";
+	print "\tmemcpy(bytes, &value, sizeof(TYPE));\n";
+	print "\tstd::reverse(bytes, bytes + sizeof(TYPE));\n";
+	print "\tTYPE swapped;\n";
+	print "\tmemcpy(&swapped, bytes, sizeof(TYPE));\n";
+	print "\treturn swapped;\n";
+	print "}\n";
+	print "\n";
+	print "// A component as a double, which holds every kind exactly\n";
+	print "template <typename TYPE> double VectorFileValue(const TYPE& value) { return (double)value; }\n";
+	print "inline double VectorFileValue(const FIXED& value) { return value.ToDouble(); }\n";
+	print "\n";
+	print "// The component of kind at bytes, reversed first when swap is set\n";
+	print "inline double VectorFileDecode(const unsigned char* bytes, const unsigned& kind, const bool& swap)\n";
+	print "{\n";
+	print "\tunsigned char value[8];\n";
+	print "\tunsigned size = VectorFileComponentBytes(kind);\n";
+	print "\tfor (unsigned i = 0; i < size; i++)\n";
+	print "\t{\n";
+	print "\t\tvalue[i] = bytes[swap ? size - 1 - i : i];\n";
+	print "\t}\n";
+	print "\tfloat single;\n";
+	print "\tdouble wide;\n";
+	print "\tint32_t integer;\n";
+	print "\tuint16_t bits;\n";
+	print "\tswitch (kind)\n";
+	print "\t{\n";
+	print "\t\tcase VECTOR_FILE_FLOAT32: memcpy(&single, value, 4); return single;\n";
+	print "\t\tcase VECTOR_FILE_FLOAT64: memcpy(&wide, value, 8); return wide;\n";
+	print "\t\tcase VECTOR_FILE_INT32: memcpy(&integer, value, 4); return integer;\n";
+	print "\t\tcase VECTOR_FILE_FLOAT16: memcpy(&bits, value, 2); return HalfBitsToFloat(bits);\n";
+	print "\t\tcase VECTOR_FILE_BFLOAT16: memcpy(&bits, value, 2); return Bfloat16BitsToFloat(bits);\n";
+	print "\t\tcase VECTOR_FILE_FIXED: memcpy(&integer, value, 4); return integer / 65536.0;\n";
+	print "\t}\n";
+	print "\treturn 0;\n";
+	print "}\n";
+	print "\n";
+	print "// Seeks file to offset (past 2 GB where the platform can)\n";
+	print "inline bool VectorFileSeek(FILE* file, const uint64_t& offset)\n";
+	print "{\n";
+	print "#if defined(_WIN32)\n";
+	print "\treturn _fseeki64(file, (__int64)offset, SEEK_SET) == 0;\n";
+	print "#elif defined(SVML_HAS_MMAP)\n";
+	print "\treturn fseeko(file, (off_t)offset, SEEK_SET) == 0;\n";
+	print "#else\n";
+	print "\treturn fseek(file, (long)offset, SEEK_SET) == 0;\n";
+	print "#endif\n";
+	print "}\n";
+	print "\n";
+	print "// Dimension of VECTOR, and a VECTOR from the doubles of its components\n";
+	print "template <typename VECTOR> struct VectorFileDimension;\n";
+
+	for (my $dimension = 2; $dimension <= 4; $dimension++)
+	{
+		my $vector = "VECTOR" . $dimension . "<TYPE>";
+		my @values = map { "(TYPE)values[" . $_ . "]" } (0 .. $dimension - 1);
+		print "template <typename TYPE> struct VectorFileDimension< " . $vector . " > { enum { value = " . $dimension . " }; };\n";
+		print "template <typename TYPE> void VectorFromComponents(" . $vector . "& out, const double* values) { out = " . $vector . "(" . join(", ", @values) . "); }\n";
+	}
+	print "\n";
+}
+
+sub MakeVectorFileWriterType
+{
+	print "// Streams vectors of VECTOR to a file: Write() blocks of them, as many times as needed, then Close() (the destructor\n";
+	print "// closes too). kind VECTOR_FILE_FLOAT16 or VECTOR_FILE_BFLOAT16 halves the vectors on the way out. A SOA file takes\n";
+	print "// its count up front, since each component array starts where the one before it ends\n";
+	print "template <typename VECTOR>\n";
+	print "class VECTOR_FILE_WRITER\n";
+	print "{\n";
+	print "public:\n";
+	print "\ttypedef typename ComponentType<VECTOR>::type TYPE;\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\tVECTOR_FILE_WRITER(const char* path, const unsigned& layout = VECTOR_FILE_AOS, const unsigned& kind = VECTOR_FILE_NATIVE, const uint64_t& count = 0) : file(0), written(0), failed(false)\n";
+	print "\t{\n";
+	print "\t\tmemset(&header, 0, sizeof(header));\n";
+	print "\t\tmemcpy(header.magic, \"SVML\", 4);\n";
+	print "\t\theader.version = VECTOR_FILE_VERSION;\n";
+	print "\t\theader.byteOrder = 0x0102;\n";
+	print "\t\theader.count = (layout == VECTOR_FILE_SOA) ? count : 0;\n";
+	print "\t\theader.kind = (uint8_t)((kind == VECTOR_FILE_NATIVE) ? (unsigned)VectorFileKind<TYPE>::value : kind);\n";
+	print "\t\theader.dimension = (uint8_t)VectorFileDimension<VECTOR>::value;\n";
+	print "\t\theader.layout = (uint8_t)layout;\n";
+	print "\t\theader.stride = (uint8_t)(Native() ? sizeof(VECTOR) : header.dimension * VectorFileComponentBytes(header.kind));\n";
+	print "\t\tif (!Native() && header.kind != VECTOR_FILE_FLOAT16 && header.kind != VECTOR_FILE_BFLOAT16)\n";
+	print "\t\t{\n";
+	print "\t\t\tFatalError(\"vector files store the vectors' own components, VECTOR_FILE_FLOAT16 or VECTOR_FILE_BFLOAT16\");\n";
+	print "\t\t}\n";
+	print "\t\tfile = fopen(path, \"wb\");\n";
+	print "\t\tfailed = (file == 0) || fwrite(&header, sizeof(header), 1, file) != 1;\n";
+	print "\t}\n";
+	print "\t~VECTOR_FILE_WRITER() { Close(); }\n";
+	print "\n";
+	print "\tbool IsOpen() const { return file != 0; }\n";
+	print "\tuint64_t Count() const { return written; }\n";
+	print "\n";
+	print "\t// Appends vectors[0] to vectors[count - 1]: false if the file didn't open or a write failed (then every later\n";
+	print "\t// call fails too), or if a SOA file would pass its count\n";
+	print "\tbool Write(const VECTOR* vectors, const size_t& count)\n";
+	print "\t{\n";
+	print "\t\tif (file == 0 || failed || (header.layout == VECTOR_FILE_SOA && count > header.count - written))\n";
+	print "\t\t{\n";
+	print "\t\t\treturn false;\n";
+	print "\t\t}\n";
+	print "\t\tif (header.layout == VECTOR_FILE_AOS && Native())\n";
+	print "\t\t{\n";
+	print "\t\t\tfailed = fwrite(vectors, sizeof(VECTOR), count, file) != count;\n";
+	print "\t\t}\n";
+	print "\t\telse\n";
+	print "\t\t{\n";
+	print "\t\t\tfor (size_t first = 0; first < count && !failed; first += VECTOR_FILE_BLOCK)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tsize_t block = min(count - first, (size_t)VECTOR_FILE_BLOCK);\n";
+	print "\t\t\t\tif (header.layout == VECTOR_FILE_AOS)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tWriteComponents(vectors + first, block, 0, header.dimension);\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tfor (unsigned axis = 0; axis < header.dimension && header.layout == VECTOR_FILE_SOA; axis++)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tuint64_t offset = VectorFileArrayOffset(header.count, header.kind, axis) + (written + first) * VectorFileComponentBytes(header.kind);\n";
+	print "\t\t\t\t\tfailed = failed || !VectorFileSeek(file, offset);\n";
+	print "\t\t\t\t\tWriteComponents(vectors + first, block, axis, 1);\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\twritten += failed ? 0 : count;\n";
+	print "\t\treturn !failed;\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Finishes the file: false if it didn't open, anything failed to write or a SOA file got fewer vectors than its count\n";
+	print "\tbool Close()\n";
+	print "\t{\n";
+	print "\t\tif (file == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn false;\n";
+	print "\t\t}\n";
+	print "\t\tif (header.layout == VECTOR_FILE_AOS)\n";
+	print "\t\t{\n";
+	print "\t\t\theader.count = written;\n";
+	print "\t\t\tfailed = failed || !VectorFileSeek(file, 0) || fwrite(&header, sizeof(header), 1, file) != 1;\n";
+	print "\t\t}\n";
+	print "\t\tfailed = failed || written != header.count;\n";
+	print "\t\tfailed = (fclose(file) != 0) || failed;\n";
+	print "\t\tfile = 0;\n";
+	print "\t\treturn !failed;\n";
+	print "\t}\n";
+	print "\n";
+	print "private:\n";
+	print "\tVECTOR_FILE_HEADER header;\n";
+	print "\tFILE* file;\n";
+	print "\tuint64_t written;\n";
+	print "\tbool failed;\n";
+	print "\n";
+	print "\tVECTOR_FILE_WRITER(const VECTOR_FILE_WRITER&);\n";
+	print "\tconst VECTOR_FILE_WRITER& operator=(const VECTOR_FILE_WRITER&);\n";
+	print "\n";
+	print "\tbool Native() const { return header.kind == VectorFileKind<TYPE>::value; }\n";
+	print "\n";
+	print "\t// Components firstAxis to firstAxis + axes - 1 of count vectors (no more than VECTOR_FILE_BLOCK), interleaved, in\n";
+	print "\t// the file's kind\n";
+	print "\tvoid WriteComponents(const VECTOR* vectors, const size_t& count, const unsigned& firstAxis, const unsigned& axes)\n";
+	print "\t{\n";
+	print "\t\tsize_t components = count * axes;\n";
+	print "\t\tif (Native())\n";
+	print "\t\t{\n";
+	print "\t\t\tTYPE values[VECTOR_FILE_BLOCK * 4];\n";
+	print "\t\t\tfor (size_t i = 0; i < components; i++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tvalues[i] = vectors[i / axes].Component(firstAxis + (unsigned)(i % axes));\n";
+	print "\t\t\t}\n";
+	print "\t\t\tfailed = failed || fwrite(values, sizeof(TYPE), components, file) != components;\n";
+	print "\t\t\treturn;\n";
+	print "\t\t}\n";
+	print "\t\tfloat values[VECTOR_FILE_BLOCK * 4];\n";
+	print "\t\tfor (size_t i = 0; i < components; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tvalues[i] = (float)VectorFileValue(vectors[i / axes].Component(firstAxis + (unsigned)(i % axes)));\n";
+	print "\t\t}\n";
+	print "\t\tif (header.kind == VECTOR_FILE_FLOAT16)\n";
+	print "\t\t{\n";
+	print "\t\t\tHALF halves[VECTOR_FILE_BLOCK * 4];\n";
+	print "\t\t\tConvertComponents(halves, values, components);\n";
+	print "\t\t\tfailed = failed || fwrite(halves, sizeof(HALF), components, file) != components;\n";
+	print "\t\t}\n";
+	print "\t\telse\n";
+	print "\t\t{\n";
+	print "\t\t\tBFLOAT16 bfloats[VECTOR_FILE_BLOCK * 4];\n";
+	print "\t\t\tConvertComponents(bfloats, values, components);\n";
+	print "\t\t\tfailed = failed || fwrite(bfloats, sizeof(BFLOAT16), components, file) != components;\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "};\n";
+	print "\n";
+}
+
+sub MakeVectorFileType
+{
+	print "// A vector file mapped into memory (read into aligned memory where there's no mmap()). When it holds exactly the\n";
+	print "// type asked for, in this machine's byte order, Vectors() and the views point straight into the mapping, with no\n";
+	print "// copy or parse step; Read() converts any file. The mapping is private: changes through them never reach the file\n";
+	print "class VECTOR_FILE\n";
+	print "{\n";
+	print "public:\n";
+	print "\t// Constructors\n";
+	print "\tVECTOR_FILE() : bytes(0), size(0) { Close(); }\n";
+	print "\texplicit VECTOR_FILE(const char* path) : bytes(0), size(0) { Open(path); }\n";
+	print "\t~VECTOR_FILE() { Close(); }\n";
+	print "\n";
+	print "\t// Maps path: false if it's missing, not a vector file, of a later version or shorter than its header says\n";
+	print "\tbool Open(const char* path)\n";
+	print "\t{\n";
+	print "\t\tClose();\n";
+	print "\t\tif (!Map(path) || size < sizeof(header))\n";
+	print "\t\t{\n";
+	print "\t\t\tClose();\n";
+	print "\t\t\treturn false;\n";
+	print "\t\t}\n";
+	print "\t\tmemcpy(&header, bytes, sizeof(header));\n";
+	print "\t\tswapped = header.byteOrder == 0x0201;\n";
+	print "\t\tif (swapped)\n";
+	print "\t\t{\n";
+	print "\t\t\theader.version = VectorFileSwap(header.version);\n";
+	print "\t\t\theader.count = VectorFileSwap(header.count);\n";
+	print "\t\t}\n";
+	print "\t\tunsigned componentBytes = VectorFileComponentBytes(header.kind);\n";
+	print "\t\tbool valid = memcmp(header.magic, \"SVML\", 4) == 0 && (header.byteOrder == 0x0102 || swapped) && header.version >= 1 && header.version <= VECTOR_FILE_VERSION &&\n";
+	print "\t\t             componentBytes != 0 && header.dimension >= 2 && header.dimension <= 4 && header.layout <= VECTOR_FILE_SOA &&\n";
+	print "\t\t             (header.layout == VECTOR_FILE_SOA || header.stride >= header.dimension * componentBytes);\n";
+	print "\t\tif (!valid || header.count > (size - VECTOR_FILE_HEADER_BYTES) / componentBytes || End() > size)\n";
+	print "\t\t{\n";
+	print "\t\t\tClose();\n";
+	print "\t\t\treturn false;\n";
+	print "\t\t}\n";
+	print "\t\treturn true;\n";
+	print "\t}\n";
+	print "\n";
+	print "\tvoid Close()\n";
+	print "\t{\n";
+	print "#ifdef SVML_HAS_MMAP\n";
+	print "\t\tif (bytes != 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tmunmap(bytes, (size_t)size);\n";
+	print "\t\t}\n";
+	print "#else\n";
+	print "\t\tAlignedFree(bytes);\n";
+	print "#endif\n";
+	print "\t\tbytes = 0;\n";
+	print "\t\tsize = 0;\n";
+	print "\t\tswapped = false;\n";
+	print "\t\tmemset(&header, 0, sizeof(header));\n";
+	print "\t}\n";
+	print "\n";
+	print "\tbool IsOpen() const { return bytes != 0; }\n";
+	print "\tsize_t Count() const { return (size_t)header.count; }\n";
+	print "\tunsigned Dimension() const { return header.dimension; }\n";
+	print "\tunsigned Kind() const { return header.kind; }\n";
+	print "\tunsigned Layout() const { return header.layout; }\n";
+	print "\tunsigned Stride() const { return header.stride; }\n";
+	print "\tbool NativeByteOrder() const { return !swapped; }\n";
+	print "\n";
+	print "\t// The vectors, in the mapping, if this is an AOS file of VECTOR (same components, dimension and size) in this\n";
+	print "\t// machine's byte order: 0 otherwise\n";
+	print "\ttemplate <typename VECTOR> VECTOR* Vectors() const\n";
+	print "\t{\n";
+	print "\t\tbool same = Holds<typename ComponentType<VECTOR>::type>(VECTOR_FILE_AOS) && header.dimension == VectorFileDimension<VECTOR>::value && header.stride == sizeof(VECTOR);\n";
+	print "\t\treturn same ? (VECTOR*)(bytes + VECTOR_FILE_HEADER_BYTES) : 0;\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// The array of component axis, in the mapping, if this is a SOA file of TYPE in this machine's byte order: 0 otherwise\n";
+	print "\ttemplate <typename TYPE> TYPE* Components(const unsigned& axis) const\n";
+	print "\t{\n";
+	print "\t\treturn (Holds<TYPE>(VECTOR_FILE_SOA) && axis < header.dimension) ? (TYPE*)(bytes + VectorFileArrayOffset(header.count, header.kind, axis)) : 0;\n";
+	print "\t}\n";
+	print "\n";
+	for (my $dimension = 2; $dimension <= 4; $dimension++)
+	{
+		my $view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+		my @arrays = map { "same ? Components<TYPE>(" . $_ . ") : 0" } (0 .. $dimension - 1);
+		print "\t// View of a SOA file of " . $dimension . "D vectors of TYPE, in the mapping: empty (no arrays, count 0) otherwise\n";
+		print "\ttemplate <typename TYPE> " . $view . " View" . $dimension . "() const\n";
+		print "\t{\n";
+		print "\t\tbool same = header.dimension == " . $dimension . " && Components<TYPE>(0) != 0;\n";
+		print "\t\treturn " . $view . "(" . join(", ", @arrays) . ", same ? (unsigned)header.count : 0);\n";
+		print "\t}\n";
+		print "\n";
+	}
+	print "\t// Vectors first to first + count - 1 into out, whatever the file's layout, kind and byte order: false (and out\n";
+	print "\t// unchanged) if out's vectors have another dimension or the range passes Count()\n";
+	print "\ttemplate <typename VECTOR> bool Read(VECTOR* out, const size_t& first, const size_t& count) const\n";
+	print "\t{\n";
+	print "\t\tif (!IsOpen() || header.dimension != VectorFileDimension<VECTOR>::value || first > header.count || count > header.count - first)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn false;\n";
+	print "\t\t}\n";
+	print "\t\tif (Vectors<VECTOR>() != 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tmemcpy(out, Vectors<VECTOR>() + first, count * sizeof(VECTOR));\n";
+	print "\t\t\treturn true;\n";
+	print "\t\t}\n";
+	print "\t\tdouble values[4];\n";
+	print "\t\tfor (size_t i = 0; i < count; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tfor (unsigned axis = 0; axis < header.dimension; axis++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tvalues[axis] = VectorFileDecode(Address(first + i, axis), header.kind, swapped);\n";
+	print "\t\t\t}\n";
+	print "\t\t\tVectorFromComponents(out[i], values);\n";
+	print "\t\t}\n";
+	print "\t\treturn true;\n";
+	print "\t}\n";
+	print "\n";
+	print "private:\n";
+	print "\tVECTOR_FILE_HEADER header;\n";
+	print "\tunsigned char* bytes;\n";
+	print "\tuint64_t size;\n";
+	print "\tbool swapped;\n";
+	print "\n";
+	print "\tVECTOR_FILE(const VECTOR_FILE&);\n";
+	print "\tconst VECTOR_FILE& operator=(const VECTOR_FILE&);\n";
+	print "\n";
+	print "\t// Maps (or reads) the whole of path into bytes\n";
+	print "\tbool Map(const char* path)\n";
+	print "\t{\n";
+	print "#ifdef SVML_HAS_MMAP\n";
+	print "\t\tint descriptor = open(path, O_RDONLY);\n";
+	print "\t\tif (descriptor < 0)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn false;\n";
+	print "\t\t}\n";
+	print "\t\tstruct stat status;\n";
+	print "\t\tif (fstat(descriptor, &status) == 0 && status.st_size > 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tvoid* mapping = mmap(0, (size_t)status.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);\n";
+	print "\t\t\tif (mapping != MAP_FAILED)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tbytes = (unsigned char*)mapping;\n";
+	print "\t\t\t\tsize = (uint64_t)status.st_size;\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\tclose(descriptor);\n";
+	print "#else\n";
+	print "\t\tFILE* file = fopen(path, \"rb\");\n";
+	print "\t\tif (file == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn false;\n";
+	print "\t\t}\n";
+	print "\t\tlong length = (fseek(file, 0, SEEK_END) == 0) ? ftell(file) : -1;\n";
+	print "\t\tif (length > 0 && fseek(file, 0, SEEK_SET) == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tbytes = (unsigned char*)AlignedAllocate((size_t)length);\n";
+	print "\t\t\tsize = (uint64_t)length;\n";
+	print "\t\t\tif (bytes != 0 && fread(bytes, 1, (size_t)length, file) != (size_t)length)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tClose();\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\tfclose(file);\n";
+	print "#endif\n";
+	print "\t\treturn bytes != 0;\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// One past the last byte of the vectors\n";
+	print "\tuint64_t End() const\n";
+	print "\t{\n";
+	print "\t\tif (header.layout == VECTOR_FILE_AOS)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn VECTOR_FILE_HEADER_BYTES + header.count * header.stride;\n";
+	print "\t\t}\n";
+	print "\t\treturn VectorFileArrayOffset(header.count, header.kind, header.dimension - 1) + header.count * VectorFileComponentBytes(header.kind);\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Whether the vectors are components of TYPE in layout, in this machine's byte order\n";
+	print "\ttemplate <typename TYPE> bool Holds(const unsigned& layout) const { return IsOpen() && !swapped && header.layout == layout && header.kind == (unsigned)VectorFileKind<TYPE>::value; }\n";
+	print "\n";
+	print "\t// Component axis of vector index\n";
+	print "\tconst unsigned char* Address(const size_t& index, const unsigned& axis) const\n";
+	print "\t{\n";
+	print "\t\tif (header.layout == VECTOR_FILE_AOS)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn bytes + VECTOR_FILE_HEADER_BYTES + index * header.stride + axis * VectorFileComponentBytes(header.kind);\n";
+	print "\t\t}\n";
+	print "\t\treturn bytes + VectorFileArrayOffset(header.count, header.kind, axis) + index * VectorFileComponentBytes(header.kind);\n";
+	print "\t}\n";
+	print "};\n";
+	print "\n";
+}
+
+return 1;
@@ -0,0 +1,387 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Parallel bulk operations on spans of vectors (namespace SVML::Bulk, opt-in with SVML_USE_THREADS): a work-stealing
+# thread pool, for-each/transform/reduce on top of it, and the vector functions over whole arrays
+
+sub BulkBegin
+{
+	print "#ifdef SVML_USE_THREADS\n";
+	print "namespace Bulk\n";
+	print "{\n";
+	print "\n";
+}
+
+sub BulkEnd
+{
+	print "} // Bulk namespace\n";
+	print "#endif // SVML_USE_THREADS\n";
+	print "\n";
+}
+
+sub PrintBulkUtilities
+{
+	print "// Contiguous elements (like C++20 std::span). SPAN<TYPE> converts to SPAN<const TYPE>, its base, so functions that\n";
+	print "// only read take either\n";
+	print "template <typename TYPE> struct SPAN;\n";
+	print "\n";
+	print "template <typename TYPE>\n";
+	print "struct SPAN<const TYPE>\n";
+	print "{\n";
+	print "\tconst TYPE* data;\n";
+	print "\tsize_t count;\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\tSPAN() : data(0), count(0) {}\n";
+	print "\tSPAN(const TYPE* data, const size_t& count) : data(data), count(count) {}\n";
+	print "\ttemplate <size_t SIZE> SPAN(const TYPE (&array)[SIZE]) : data(array), count(SIZE) {}\n";
+	print "\n";
+	print "\tconst TYPE& operator[](const size_t& index) const { return data[index]; }\n";
+	print "};\n";
+	print "\n";
+	print "template <typename TYPE>\n";
+	print "struct SPAN : SPAN<const TYPE>\n";
+	print "{\n";
+	print "\t// Constructors\n";
+	print "\tSPAN() {}\n";
+	print "\tSPAN(TYPE* data, const size_t& count) : SPAN<const TYPE>(data, count) {}\n";
+	print "\ttemplate <size_t SIZE> SPAN(TYPE (&array)[SIZE]) : SPAN<const TYPE>(array, SIZE) {}\n";
+	print "\n";
+	print "\tTYPE* Data() const { return const_cast<TYPE*>(this->data); }\n";
+	print "\tTYPE& operator[](const size_t& index) const { return Data()[index]; }\n";
+	print "};\n";
+	print "\n";
+	print "// Elements per chunk unless told otherwise: enough work to hide the scheduling, and small enough to balance\n";
+	print "const size_t DEFAULT_GRAIN = 4096;\n";
+	print "\n";
+	print "// Elements per chunk actually used (chunk indices are 32 bits, so huge counts get bigger chunks)\n";
+	print "inline size_t ChunkSize(const size_t& count, const size_t& grain) { return std::max(std::max(grain, (size_t)1), count / 0xFFFFFFFFu + 1); }\n";
+	print "\n";
+	print "// Work-stealing thread pool. A job is split into chunks of at most grain elements, and every worker (the calling\n";
+	print "// thread is one of them) starts with its own contiguous run of chunks, taking them from the front. A worker that\n";
+	print "// runs out steals from the back of the others' runs. Contiguous runs keep each thread on its own part of the\n";
+	print "// arrays, and on the memory it touched first, which on NUMA systems is the memory of its own node\n";
+	print "class WORK_POOL\n";
+	print "{\n";
+	print "public:\n";
+	print "\t// Constructors (0 threads is one per hardware thread)\n";
+	print "\texplicit WORK_POOL(const unsigned& threadCount = 0) : workerCount((threadCount > 0) ? threadCount : std::max(1u, std::thread::hardware_concurrency())), runs(new RUN[workerCount]), generation(0), busy(0), stopping(false), invoke(0), body(0), count(0), grain(1)\n";
+	print "\t{\n";
+	print "\t\tfor (unsigned i = 1; i < workerCount; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tthreads.push_back(std::thread(&WORK_POOL::Work, this, i));\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\t~WORK_POOL()\n";
+	print "\t{\n";
+	print "\t\t{\n";
+	print "\t\t\tstd::lock_guard<std::mutex> lock(mutex);\n";
+	print "\t\t\tstopping = true;\n";
+	print "\t\t}\n";
+	print "\t\twake.notify_all();\n";
+	print "\t\tfor (size_t i = 0; i < threads.size(); i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tthreads[i].join();\n";
+	print "\t\t}\n";
+	print "\t\tdelete[] runs;\n";
+	print "\t}\n";
+	print "\n";
+	print "\tunsigned Threads() const { return workerCount; }\n";
+	print "\n";
+	print "\t// Calls body(begin, end) for the chunks [0, grain), [grain, 2 * grain), ... of [0, count) and returns when all\n";
+	print "\t// are done. The chunks are the same for any number of threads. A job started while another is running (from\n";
+	print "\t// another thread, or from inside a body) runs on the calling thread alone. Bodies must not throw\n";
+	print "\ttemplate <typename BODY> void Run(const size_t& count, const size_t& grain, const BODY& body)\n";
+	print "\t{\n";
+	print "\t\tsize_t chunk = ChunkSize(count, grain);\n";
+	print "\t\tsize_t chunks = (count + chunk - 1) / chunk;\n";
+	print "\t\tstd::unique_lock<std::mutex> running(runMutex, std::try_to_lock);\n";
+	print "\t\tif (chunks <= 1 || workerCount == 1 || !running.owns_lock())\n";
+	print "\t\t{\n";
+	print "\t\t\tfor (size_t begin = 0; begin < count; begin += chunk)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tbody(begin, std::min(begin + chunk, count));\n";
+	print "\t\t\t}\n";
+	print "\t\t\treturn;\n";
+	print "\t\t}\n";
+	print "\n";
+	print "\t\tfor (unsigned i = 0; i < workerCount; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\truns[i].chunks.store(Pack(chunks * i / workerCount, chunks * (i + 1) / workerCount));\n";
+	print "\t\t}\n";
+	print "\t\t{\n";
+	print "\t\t\tstd::lock_guard<std::mutex> lock(mutex);\n";
+	print "\t\t\tthis->invoke = &Invoke<BODY>;\n";
+	print "\t\t\tthis->body = &body;\n";
+	print "\t\t\tthis->count = count;\n";
+	print "\t\t\tthis->grain = chunk;\n";
+	print "\t\t\tbusy = workerCount - 1;\n";
+	print "\t\t\tgeneration++;\n";
+	print "\t\t}\n";
+	print "\t\twake.notify_all();\n";
+	print "\t\tProcess(0);\n";
+	print "\t\tstd::unique_lock<std::mutex> lock(mutex);\n";
+	print "\t\tdone.wait(lock, [this] { return busy == 0; });\n";
+	print "\t}\n";
+	print "\n";
+	print "private:\n";
+	print "\tWORK_POOL(const WORK_POOL&);\n";
+	print "\tconst WORK_POOL& operator=(const WORK_POOL&);\n";
+	print "\n";
+	print "\t// The chunks [begin, end) a worker has left, packed in one word so taking and stealing are single exchanges\n";
+	print "\tstruct RUN\n";
+	print "\t{\n";
+	print "\t\tstd::atomic<unsigned long long> chunks;\n";
+	print "\t\tchar padding[64 - sizeof(std::atomic<unsigned long long>)]; // One cache line each\n";
+	print "\t\tRUN() : chunks(0) {}\n";
+	print "\t};\n";
+	print "\n";
+	print "\tstatic unsigned long long Pack(const size_t& begin, const size_t& end) { return ((unsigned long long)begin << 32) | end; }\n";
+	print "\n";
+	print "\ttemplate <typename BODY> static void Invoke(const void* body, const size_t& begin, const size_t& end) { (*(const BODY*)body)(begin, end); }\n";
+	print "\n";
+	print "\t// Takes the first chunk of a run (fromBack false) or the last one\n";
+	print "\tbool Take(RUN& run, const bool& fromBack, size_t& chunk)\n";
+	print "\t{\n";
+	print "\t\tunsigned long long packed = run.chunks.load();\n";
+	print "\t\tfor (;;)\n";
+	print "\t\t{\n";
+	print "\t\t\tsize_t begin = (size_t)(packed >> 32);\n";
+	print "\t\t\tsize_t end = (size_t)(packed & 0xFFFFFFFFu);\n";
+	print "\t\t\tif (begin >= end)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\treturn false;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tchunk = fromBack ? end - 1 : begin;\n";
+	print "\t\t\tif (run.chunks.compare_exchange_weak(packed, fromBack ? Pack(begin, end - 1) : Pack(begin + 1, end)))\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\treturn true;\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\tvoid Process(const unsigned& worker)\n";
+	print "\t{\n";
+	print "\t\tsize_t chunk;\n";
+	print "\t\tfor (unsigned i = 0; i < workerCount; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tRUN& run = runs[(worker + i) % workerCount];\n";
+	print "\t\t\twhile (Take(run, i > 0, chunk))\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tsize_t begin = chunk * grain;\n";
+	print "\t\t\t\tinvoke(body, begin, std::min(begin + grain, count));\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\tvoid Work(const unsigned worker)\n";
+	print "\t{\n";
+	print "\t\tunsigned long long seen = 0;\n";
+	print "\t\tfor (;;)\n";
+	print "\t\t{\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tstd::unique_lock<std::mutex> lock(mutex);\n";
+	print "\t\t\t\twake.wait(lock, [this, seen] { return stopping || generation != seen; });\n";
+	print "\t\t\t\tif (stopping)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\treturn;\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tseen = generation;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tProcess(worker);\n";
+	print "\t\t\tstd::lock_guard<std::mutex> lock(mutex);\n";
+	print "\t\t\tif (--busy == 0)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tdone.notify_one();\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\tunsigned workerCount;\n";
+	print "\tRUN* runs;\n";
+	print "\tstd::vector<std::thread> threads;\n";
+	print "\tstd::mutex runMutex; // Held while a job runs\n";
+	print "\tstd::mutex mutex; // Guards everything below\n";
+	print "\tstd::condition_variable wake;\n";
+	print "\tstd::condition_variable done;\n";
+	print "\tunsigned long long generation; // Counts jobs, so workers see each one once\n";
+	print "\tunsigned busy; // Workers still on the current job\n";
+	print "\tbool stopping;\n";
+	print "\tvoid (*invoke)(const void* body, const size_t& begin, const size_t& end);\n";
+	print "\tconst void* body;\n";
+	print "\tsize_t count;\n";
+	print "\tsize_t grain; // Chunk size of the current job\n";
+	print "};\n";
+	print "\n";
+	print "// Shared by every call that does not name a pool, started on first use with one thread per hardware thread\n";
+	print "inline WORK_POOL& DefaultPool()\n";
+	print "{\n";
+	print "\tstatic WORK_POOL pool;\n";
+	print "\treturn pool;\n";
+	print "}\n";
+	print "\n";
+	print "// The loop every bulk function runs on: body(begin, end) for each chunk of [0, count)\n";
+	print "template <typename BODY> void ParallelFor(const size_t& count, const BODY& body, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())\n";
+	print "{\n";
+	print "\tpool.Run(count, grain, body);\n";
+	print "}\n";
+	print "\n";
+	print "// ForEach(): function(element) for every element, which it may modify\n";
+	print "template <typename TYPE, typename FUNCTION> void ForEach(const SPAN<TYPE>& elements, const FUNCTION& function, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())\n";
+	print "{\n";
+	print "\tParallelFor(elements.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { function(elements[i]); } }, grain, pool);\n";
+	print "}\n";
+	print "\n";
+	print "// Transform(): out[i] = function(in[i]), out may be in\n";
+	print "template <typename OUT, typename IN, typename FUNCTION> void Transform(const SPAN<OUT>& out, const SPAN<const IN>& in, const FUNCTION& function, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())\n";
+	print "{\n";
+	print "\tParallelFor(in.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = function(in[i]); } }, grain, pool);\n";
+	print "}\n";
+	print "\n";
+	print "// ReduceChunks(): reduceChunk(begin, end) for every chunk, with the chunk results combined in order by\n";
+	print "// combine(result, result). The chunks depend only on count and grain, so the result is the same for any number of threads\n";
+	print "template <typename RESULT, typename REDUCE_CHUNK, typename COMBINE> RESULT ReduceChunks(const size_t& count, const RESULT& identity, const REDUCE_CHUNK& reduceChunk, const COMBINE& combine, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())\n";
+	print "{\n";
+	print "\tsize_t chunk = ChunkSize(count, grain);\n";
+	print "\tstd::vector<RESULT> partials((count + chunk - 1) / chunk, identity);\n";
+	print "\tParallelFor(count, [&](size_t begin, size_t end) { partials[begin / chunk] = reduceChunk(begin, end); }, grain, pool);\n";
+	print "\tRESULT result = identity;\n";
+	print "\tfor (size_t i = 0; i < partials.size(); i++)\n";
+	print "\t{\n";
+	print "\t\tresult = combine(result, partials[i]);\n";
+	print "\t}\n";
+	print "\treturn result;\n";
+	print "}\n";
+	print "\n";
+	print "// Reduce(): each chunk folds its elements in order, from identity, with fold(result, element)\n";
+	print "template <typename RESULT, typename IN, typename FOLD, typename COMBINE> RESULT Reduce(const SPAN<const IN>& in, const RESULT& identity, const FOLD& fold, const COMBINE& combine, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())\n";
+	print "{\n";
+	print "\treturn ReduceChunks(in.count, identity, [&](size_t begin, size_t end)\n";
+	print "\t{\n";
+	print "\t\tRESULT result = identity;\n";
+	print "\t\tfor (size_t i = begin; i < end; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tresult = fold(result, in[i]);\n";
+	print "\t\t}\n";
+	print "\t\treturn result;\n";
+	print "\t}, combine, grain, pool);\n";
+	print "}\n";
+	print "\n";
+	print "// ReduceBlocks(): reduceBlock(begin, end) for blocks of REDUCTION_BLOCK elements, combined pairwise with + in the order\n";
+	print "// of the serial Sum() and Scatter(), so the result depends only on count (neither on grain nor on the number of threads)\n";
+	print "template <typename RESULT> RESULT CombinePairwise(const std::vector<RESULT>& partials, const size_t& first, const size_t& last)\n";
+	print "{\n";
+	print "\tif (last - first == 1) { return partials[first]; }\n";
+	print "\tsize_t middle = first + (last - first) / 2;\n";
+	print "\treturn CombinePairwise(partials, first, middle) + CombinePairwise(partials, middle, last);\n";
+	print "}\n";
+	print "template <typename RESULT, typename REDUCE_BLOCK> RESULT ReduceBlocks(const size_t& count, const REDUCE_BLOCK& reduceBlock, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())\n";
+	print "{\n";
+	print "\tsize_t blocks = (count + REDUCTION_BLOCK - 1) / REDUCTION_BLOCK;\n";
+	print "\tif (blocks <= 1) { return reduceBlock(0, count); }\n";
+	print "\tstd::vector<RESULT> partials(blocks);\n";
+	print "\tParallelFor(blocks, [&](size_t first, size_t last) { for (size_t block = first; block < last; block++) { partials[block] = reduceBlock(block * REDUCTION_BLOCK, std::min(count, (block + 1) * REDUCTION_BLOCK)); } },\n";
+	print "\t            std::max<size_t>(grain / REDUCTION_BLOCK, 1), pool);\n";
+	print "\treturn CombinePairwise(partials, 0, blocks);\n";
+	print "}\n";
+	print "\n";
+}
+
+# Every element of out from the same elements of the inputs (out may be one of them)
+sub PrintBulkFunction
+{
+	my($dimension, $name, $output, $inputs, $extra, $expression) = @_;
+
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	$outSpan = ($output eq "scalar") ? "SPAN<TYPE>" : "SPAN< " . $vector . " >";
+	$parameters = "const " . $outSpan . "& out, " . join(", ", map { "const SPAN< const " . $vector . " >& " . $_ } @$inputs) . (($extra ne "") ? ", " . $extra : "");
+
+	print "template <typename TYPE> void " . $name . "(" . $parameters . ", " . BulkScheduleParameters() . ") { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = " . $expression . "; } }, grain, pool); }\n";
+}
+
+sub BulkScheduleParameters
+{
+	return "const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()";
+}
+
+sub BulkFunctions
+{
+	my($dimension) = @_;
+
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	$span = "SPAN< " . $vector . " >";
+	$input = "SPAN< const " . $vector . " >";
+	$zero = $vector . "(" . join(", ", ("(TYPE)0") x $dimension) . ")";
+
+	print "// " . $dimension . "D bulk component-wise functions\n";
+	PrintBulkFunction($dimension, "Negate", "vector", ["a"], "", "-a[i]");
+	foreach $operation (["Add", "+"], ["Subtract", "-"], ["Multiply", "*"], ["Divide", "/"])
+	{
+		PrintBulkFunction($dimension, $operation->[0], "vector", ["a", "b"], "", "a[i] " . $operation->[1] . " b[i]");
+	}
+	PrintBulkFunction($dimension, "Multiply", "vector", ["a"], "const typename ScalarType<TYPE>::type& scalar", "a[i] * scalar");
+	PrintBulkFunction($dimension, "Divide", "vector", ["a"], "const typename ScalarType<TYPE>::type& scalar", "a[i] / scalar");
+	foreach $function ("Max", "Min")
+	{
+		PrintBulkFunction($dimension, $function, "vector", ["a", "b"], "", $function . "(a[i], b[i])");
+	}
+	foreach $function ("Ceil", "Floor")
+	{
+		PrintBulkFunction($dimension, $function, "vector", ["a"], "", $function . "(a[i])");
+	}
+	PrintBulkFunction($dimension, "Lerp", "vector", ["a", "b"], "const typename RealType<TYPE>::type& delta", "Lerp(a[i], b[i], delta)");
+	print "\n";
+
+	print "// " . $dimension . "D bulk geometric functions\n";
+	PrintBulkFunction($dimension, "Normalize", "vector", ["a"], "", "Normalize(a[i])");
+	PrintBulkFunction($dimension, "Dot", "scalar", ["a", "b"], "", "Dot(a[i], b[i])");
+	if ($dimension > 2)
+	{
+		PrintBulkFunction($dimension, "Cross", "vector", ["a", "b"], "", "Cross(a[i], b[i])");
+	}
+	PrintBulkFunction($dimension, "Project", "vector", ["a", "b"], "", "Project(a[i], b[i])");
+	PrintBulkFunction($dimension, "Distance", "scalar", ["a", "b"], "", "Distance(a[i], b[i])");
+	PrintBulkFunction($dimension, "DistanceSquared", "scalar", ["a", "b"], "", "DistanceSquared(a[i], b[i])");
+	print "\n";
+
+	# Rotations and transforms set up once, then run the array kernels on each chunk
+	print "// " . $dimension . "D bulk Rotate() and Transform()\n";
+	if ($dimension == 2)
+	{
+		print "template <typename TYPE> void Rotate(const " . $span . "& out, const " . $input . "& a, const ROTATION2< typename RealType<TYPE>::type >& rotation, " . BulkScheduleParameters() . ") { ParallelFor(a.count, [&](size_t begin, size_t end) { Rotate(out.Data() + begin, a.data + begin, rotation, (unsigned)(end - begin)); }, grain, pool); }\n";
+		print "template <typename TYPE> void Rotate(const " . $span . "& out, const " . $input . "& a, const typename RealType<TYPE>::type& angle, " . BulkScheduleParameters() . ") { Rotate(out, a, ROTATION2< typename RealType<TYPE>::type >(angle), grain, pool); }\n";
+		print "template <typename TYPE> void Rotate(const " . $span . "& out, const " . $input . "& a, const typename RealType<TYPE>::type* angles, " . BulkScheduleParameters() . ") { ParallelFor(a.count, [&](size_t begin, size_t end) { Rotate(out.Data() + begin, a.data + begin, angles + begin, (unsigned)(end - begin)); }, grain, pool); }\n";
+	}
+	else
+	{
+		print "template <typename TYPE> void Rotate(const " . $span . "& out, const " . $input . "& a, const QUATERNION<TYPE>& rotation, " . BulkScheduleParameters() . ") { ParallelFor(a.count, [&](size_t begin, size_t end) { Rotate(out.Data() + begin, a.data + begin, rotation, (unsigned)(end - begin)); }, grain, pool); }\n";
+		print "template <typename TYPE> void Rotate(const " . $span . "& out, const " . $input . "& a, const " . $vector . "& rotationAxis, const typename RealType<TYPE>::type& radians, " . BulkScheduleParameters() . ") { Rotate(out, a, QUATERNION<TYPE>(" . (($dimension == 3) ? "rotationAxis" : "rotationAxis.xyz") . ", radians), grain, pool); }\n";
+	}
+	print "template <typename TYPE> void Transform(const " . $span . "& out, const MATRIX" . $dimension . "<TYPE>& matrix, const " . $input . "& a, " . BulkScheduleParameters() . ") { ParallelFor(a.count, [&](size_t begin, size_t end) { Transform(out.Data() + begin, matrix, a.data + begin, (unsigned)(end - begin)); }, grain, pool); }\n";
+	print "\n";
+
+	print "// " . $dimension . "D bulk reductions: Sum(), Centroid() and Covariance() return the same bits as the serial ones, Fit() is exact\n";
+	print "template <typename TYPE> " . $vector . " Sum(const " . $input . "& a, " . BulkScheduleParameters() . ") { return ReduceBlocks<" . $vector . ">(a.count, [&](size_t begin, size_t end) { return BlockSum(a.data + begin, (unsigned)(end - begin)); }, grain, pool); }\n";
+	print "template <typename TYPE> " . $vector . " Centroid(const " . $input . "& a, " . BulkScheduleParameters() . ") { return (a.count > 0) ? Sum(a, grain, pool) / (typename ScalarType<TYPE>::type)a.count : " . $zero . "; }\n";
+	if ($dimension < 4)
+	{
+		$matrix = "MATRIX" . $dimension . "<TYPE>";
+		print "template <typename TYPE> " . $matrix . " Covariance(const " . $input . "& a, " . BulkScheduleParameters() . ")\n";
+		print "{\n";
+		print "\tif (a.count == 0) { return " . $matrix . "((TYPE)0); }\n";
+		print "\t" . $vector . " center = Centroid(a, grain, pool);\n";
+		print "\treturn ReduceBlocks<" . $matrix . ">(a.count, [&](size_t begin, size_t end) { return BlockScatter(a.data + begin, (unsigned)(end - begin), center); }, grain, pool) * ((typename ScalarType<TYPE>::type)1 / (typename ScalarType<TYPE>::type)a.count);\n";
+		print "}\n";
+		$box = "AABB" . $dimension . "<TYPE>";
+		print "template <typename TYPE> " . $box . " Fit(const " . $input . "& a, " . BulkScheduleParameters() . ")\n";
+		print "{\n";
+		print "\treturn ReduceChunks(a.count, " . $box . "::Empty(), [&](size_t begin, size_t end) { return Fit(a.data + begin, (unsigned)(end - begin)); },\n";
+		print "\t                    [](const " . $box . "& lhs, const " . $box . "& rhs) { return Union(lhs, rhs); }, grain, pool);\n";
+		print "}\n";
+	}
+	print "\n";
+}
+
+return 1;
@@ -0,0 +1,176 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# GLSL-style component-wise functions: Abs, Sign, Clamp, Saturate, Step, SmoothStep, Fract, Mod, Sqrt, InverseSqrt,
+# Exp, Exp2, Log, Log2, Pow, Sin, Cos, SinCos, Tan, Atan2
+#
+# The templates call the <math.h> function on each component, in the component's scalar type (float for HALF and
+# BFLOAT16). The SSE overloads for VECTOR3<float> and VECTOR4<float> are in simd.pl; the transcendental ones are
+# polynomial approximations, with their error bounds next to the kernels
+
+# The per-component helpers that are more than one <math.h> call, printed once with the math utilities
+sub PrintCommonScalarFunctions
+{
+	print "// Per-component helpers of the GLSL-style vector functions (Abs(), Sign(), Clamp(), Step(), SmoothStep(), Fract(),\n";
+	print "// Mod() and Log2())\n";
+	print "template <typename TYPE> inline TYPE ComponentAbs(const TYPE& x) { return (x <= (TYPE)0) ? (TYPE)0 - x : x; } // 0 - x so that -0 gives +0\n";
+	print "template <typename TYPE> inline TYPE ComponentSign(const TYPE& x) { return (x > (TYPE)0) ? (TYPE)1 : ((x < (TYPE)0) ? (TYPE)-1 : (TYPE)0); }\n";
+	print "template <typename TYPE> inline TYPE ComponentClamp(const TYPE& x, const TYPE& minimum, const TYPE& maximum) { return min(max(x, minimum), maximum); }\n";
+	print "template <typename TYPE> inline TYPE ComponentStep(const TYPE& edge, const TYPE& x) { return (x < edge) ? (TYPE)0 : (TYPE)1; }\n";
+	print "template <typename TYPE> inline TYPE ComponentSmoothStep(const TYPE& edge0, const TYPE& edge1, const TYPE& x)\n";
+	print "{\n";
+	print "\tTYPE t = ComponentClamp((x - edge0) / (edge1 - edge0), (TYPE)0, (TYPE)1);\n";
+	print "\treturn t * t * ((TYPE)3 - (TYPE)2 * t);\n";
+	print "}\n";
+	print "template <typename TYPE> inline TYPE ComponentFract(const TYPE& x) { return x - floor(x); }\n";
+	print "template <typename TYPE> inline TYPE ComponentMod(const TYPE& x, const TYPE& y) { return x - y * floor(x / y); }\n";
+	print "// log2() is not in C++98's <math.h>. The exponent comes from frexp(), so powers of two are exact\n";
+	print "template <typename TYPE> inline TYPE ComponentLog2(const TYPE& x)\n";
+	print "{\n";
+	print "\tint exponent;\n";
+	print "\tTYPE mantissa = frexp(x, &exponent); // In [0.5, 1) for finite x other than 0\n";
+	print "\treturn (TYPE)(exponent - 1) + log(mantissa * (TYPE)2) / log((TYPE)2);\n";
+	print "}\n";
+	print "\n";
+}
+
+# A component of a parameter in the component's scalar type
+sub ScalarComponentOf
+{
+	my($vector, $index) = @_;
+
+	return "(typename ScalarType<TYPE>::type)" . ComponentOf($vector, $index);
+}
+
+# Prints the swizzle overloads and the template of a component-wise function. $parameters lists [name, "vector" or
+# "scalar"] pairs and $component returns the expression for component $d. With two vector parameters either can be a
+# swizzle, as with Max(); with three (the bounds of Clamp() and the edges of SmoothStep()) the one named x can, and the
+# others convert to its PARENT
+sub PrintComponentWise
+{
+	my($dimension, $name, $parameters, $component) = @_;
+
+	my $vector = "VECTOR" . $dimension . "<TYPE>";
+	my $enableIf = "typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type";
+	my $swizzleScalar = "typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type";
+	my @vectors = grep { $$_[1] eq "vector" } @$parameters;
+
+	if (@vectors == 2)
+	{
+		my($a, $b) = map { $$_[0] } @vectors;
+		print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type " . $name . "(const SWIZZLE0& " . $a . ", const SWIZZLE1& " . $b . ") { return " . $name . "(typename SWIZZLE0::PARENT(" . $a . "), typename SWIZZLE1::PARENT(" . $b . ")); }\n";
+		print "template <typename SWIZZLE, typename TYPE> inline " . $enableIf . " " . $name . "(const SWIZZLE& " . $a . ", const " . $vector . "& " . $b . ") { return " . $name . "(typename SWIZZLE::PARENT(" . $a . "), " . $b . "); }\n";
+		print "template <typename TYPE, typename SWIZZLE> inline " . $enableIf . " " . $name . "(const " . $vector . "& " . $a . ", const SWIZZLE& " . $b . ") { return " . $name . "(" . $a . ", typename SWIZZLE::PARENT(" . $b . ")); }\n";
+	}
+	else
+	{
+		my $swizzled = (@vectors == 1) ? $vectors[0][0] : "x";
+		my(@declarations, @arguments);
+		foreach $parameter (@$parameters)
+		{
+			my($parameterName, $kind) = @$parameter;
+			if ($parameterName eq $swizzled)
+			{
+				push(@declarations, "const SWIZZLE& " . $parameterName);
+				push(@arguments, "typename SWIZZLE::PARENT(" . $parameterName . ")");
+			}
+			else
+			{
+				push(@declarations, "const " . (($kind eq "vector") ? "typename SWIZZLE::PARENT" : $swizzleScalar) . "& " . $parameterName);
+				push(@arguments, $parameterName);
+			}
+		}
+		print "template <typename SWIZZLE> inline " . $enableIf . " " . $name . "(" . join(", ", @declarations) . ") { return " . $name . "(" . join(", ", @arguments) . "); }\n";
+	}
+
+	my @declarations = map { "const " . (($$_[1] eq "vector") ? $vector : "typename ScalarType<TYPE>::type") . "& " . $$_[0] } @$parameters;
+	print "template <typename TYPE> " . $vector . " " . $name . "(" . join(", ", @declarations) . ")\n";
+	print "{\n";
+	print "\treturn " . $vector . "(" . join(", ", map { $component->($_) } (0..$dimension - 1)) . ");\n";
+	print "}\n";
+}
+
+sub CommonFunctions
+{
+	my($dimension) = @_;
+
+	print "// " . $dimension . "D Abs(), Sign()\n";
+	PrintComponentWise($dimension, "Abs", [["a", "vector"]], sub { "ComponentAbs(" . ScalarComponentOf("a", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Sign", [["a", "vector"]], sub { "ComponentSign(" . ScalarComponentOf("a", $_[0]) . ")" });
+	print "\n";
+	PrintSimdComponentWise($dimension, "Abs", [["a", "vector"]], "", "_mm_andnot_ps(_mm_set1_ps(-0.0f), a.Simd())");
+	PrintSimdComponentWise($dimension, "Sign", [["a", "vector"]], "", "_mm_sub_ps(_mm_and_ps(_mm_cmpgt_ps(a.Simd(), _mm_setzero_ps()), _mm_set1_ps(1.0f)), _mm_and_ps(_mm_cmplt_ps(a.Simd(), _mm_setzero_ps()), _mm_set1_ps(1.0f)))");
+
+	print "// " . $dimension . "D Clamp(), Saturate(): min(max(x, minimum), maximum), component-wise or by scalars\n";
+	PrintComponentWise($dimension, "Clamp", [["x", "vector"], ["minimum", "vector"], ["maximum", "vector"]], sub { "ComponentClamp(" . join(", ", map { ScalarComponentOf($_, $_[0]) } ("x", "minimum", "maximum")) . ")" });
+	PrintComponentWise($dimension, "Clamp", [["x", "vector"], ["minimum", "scalar"], ["maximum", "scalar"]], sub { "ComponentClamp(" . ScalarComponentOf("x", $_[0]) . ", minimum, maximum)" });
+	PrintComponentWise($dimension, "Saturate", [["x", "vector"]], sub { "ComponentClamp(" . ScalarComponentOf("x", $_[0]) . ", (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1)" });
+	print "\n";
+	PrintSimdComponentWise($dimension, "Clamp", [["x", "vector"], ["minimum", "vector"], ["maximum", "vector"]], "", "_mm_min_ps(maximum.Simd(), _mm_max_ps(minimum.Simd(), x.Simd()))");
+	PrintSimdComponentWise($dimension, "Clamp", [["x", "vector"], ["minimum", "scalar"], ["maximum", "scalar"]], "", "_mm_min_ps(_mm_set1_ps(maximum), _mm_max_ps(_mm_set1_ps(minimum), x.Simd()))");
+	PrintSimdComponentWise($dimension, "Saturate", [["x", "vector"]], "", "_mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_setzero_ps(), x.Simd()))");
+
+	print "// " . $dimension . "D Step(): 0 where x < edge, otherwise 1. SmoothStep(): Hermite interpolation between 0 at edge0 and 1 at edge1\n";
+	PrintComponentWise($dimension, "Step", [["edge", "vector"], ["x", "vector"]], sub { "ComponentStep(" . ScalarComponentOf("edge", $_[0]) . ", " . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Step", [["edge", "scalar"], ["x", "vector"]], sub { "ComponentStep(edge, " . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "SmoothStep", [["edge0", "vector"], ["edge1", "vector"], ["x", "vector"]], sub { "ComponentSmoothStep(" . join(", ", map { ScalarComponentOf($_, $_[0]) } ("edge0", "edge1", "x")) . ")" });
+	PrintComponentWise($dimension, "SmoothStep", [["edge0", "scalar"], ["edge1", "scalar"], ["x", "vector"]], sub { "ComponentSmoothStep(edge0, edge1, " . ScalarComponentOf("x", $_[0]) . ")" });
+	print "\n";
+	PrintSimdComponentWise($dimension, "Step", [["edge", "vector"], ["x", "vector"]], "", "_mm_andnot_ps(_mm_cmplt_ps(x.Simd(), edge.Simd()), _mm_set1_ps(1.0f))");
+	PrintSimdComponentWise($dimension, "Step", [["edge", "scalar"], ["x", "vector"]], "", "_mm_andnot_ps(_mm_cmplt_ps(x.Simd(), _mm_set1_ps(edge)), _mm_set1_ps(1.0f))");
+	PrintSimdComponentWise($dimension, "SmoothStep", [["edge0", "vector"], ["edge1", "vector"], ["x", "vector"]], "", "SimdSmoothStep(edge0.Simd(), " . SimdDivisor("float", $dimension, "edge1.Simd()") . ", x.Simd())");
+	PrintSimdComponentWise($dimension, "SmoothStep", [["edge0", "scalar"], ["edge1", "scalar"], ["x", "vector"]], "", "SimdSmoothStep(_mm_set1_ps(edge0), _mm_set1_ps(edge1), x.Simd())");
+
+	print "// " . $dimension . "D Fract(): x - Floor(x). Mod(): x - y * Floor(x / y), so the result takes the sign of y\n";
+	PrintComponentWise($dimension, "Fract", [["x", "vector"]], sub { "ComponentFract(" . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Mod", [["x", "vector"], ["y", "vector"]], sub { "ComponentMod(" . ScalarComponentOf("x", $_[0]) . ", " . ScalarComponentOf("y", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Mod", [["x", "vector"], ["y", "scalar"]], sub { "ComponentMod(" . ScalarComponentOf("x", $_[0]) . ", y)" });
+	print "\n";
+	PrintSimdComponentWise($dimension, "Fract", [["x", "vector"]], "__SSE2__", "_mm_sub_ps(x.Simd(), SimdFloor(x.Simd()))");
+	PrintSimdComponentWise($dimension, "Mod", [["x", "vector"], ["y", "vector"]], "__SSE2__", "_mm_sub_ps(x.Simd(), _mm_mul_ps(y.Simd(), SimdFloor(_mm_div_ps(x.Simd(), " . SimdDivisor("float", $dimension, "y.Simd()") . "))))");
+	PrintSimdComponentWise($dimension, "Mod", [["x", "vector"], ["y", "scalar"]], "__SSE2__", "_mm_sub_ps(x.Simd(), _mm_mul_ps(_mm_set1_ps(y), SimdFloor(_mm_div_ps(x.Simd(), _mm_set1_ps(y)))))");
+
+	print "// " . $dimension . "D Sqrt(), InverseSqrt(): the second under SVML_PRECISION\n";
+	PrintComponentWise($dimension, "Sqrt", [["x", "vector"]], sub { "sqrt(" . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "InverseSqrt", [["x", "vector"]], sub { "PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, " . ScalarComponentOf("x", $_[0]) . ")" });
+	print "\n";
+	PrintSimdComponentWise($dimension, "Sqrt", [["x", "vector"]], "", "_mm_sqrt_ps(x.Simd())");
+	PrintSimdComponentWise($dimension, "InverseSqrt", [["x", "vector"]], "", "SimdInverseSqrt(" . SimdDivisor("float", $dimension, "x.Simd()") . ")");
+
+	print "// " . $dimension . "D Exp(), Exp2(), Log(), Log2(), Pow()\n";
+	PrintComponentWise($dimension, "Exp", [["x", "vector"]], sub { "exp(" . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Exp2", [["x", "vector"]], sub { "pow((typename ScalarType<TYPE>::type)2, " . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Log", [["x", "vector"]], sub { "log(" . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Log2", [["x", "vector"]], sub { "ComponentLog2(" . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Pow", [["x", "vector"], ["y", "vector"]], sub { "pow(" . ScalarComponentOf("x", $_[0]) . ", " . ScalarComponentOf("y", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Pow", [["x", "vector"], ["y", "scalar"]], sub { "pow(" . ScalarComponentOf("x", $_[0]) . ", y)" });
+	print "\n";
+	PrintSimdComponentWise($dimension, "Exp", [["x", "vector"]], "__SSE2__", "SimdExp(x.Simd())");
+	PrintSimdComponentWise($dimension, "Exp2", [["x", "vector"]], "__SSE2__", "SimdExp2(x.Simd())");
+	PrintSimdComponentWise($dimension, "Log", [["x", "vector"]], "__SSE2__", "SimdLog(x.Simd())");
+	PrintSimdComponentWise($dimension, "Log2", [["x", "vector"]], "__SSE2__", "SimdLog2(x.Simd())");
+	PrintSimdComponentWise($dimension, "Pow", [["x", "vector"], ["y", "vector"]], "__SSE2__", "SimdPow(" . SimdDivisor("float", $dimension, "x.Simd()") . ", y.Simd())");
+	PrintSimdComponentWise($dimension, "Pow", [["x", "vector"], ["y", "scalar"]], "__SSE2__", "SimdPow(" . SimdDivisor("float", $dimension, "x.Simd()") . ", _mm_set1_ps(y))");
+
+	print "// " . $dimension . "D Sin(), Cos(), SinCos(), Tan(), Atan2(): radians. Atan2(y, x) is GLSL's atan(y, x)\n";
+	PrintComponentWise($dimension, "Sin", [["x", "vector"]], sub { "sin(" . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Cos", [["x", "vector"]], sub { "cos(" . ScalarComponentOf("x", $_[0]) . ")" });
+	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, void >::type SinCos(const SWIZZLE& x, typename SWIZZLE::PARENT& sine, typename SWIZZLE::PARENT& cosine) { SinCos(typename SWIZZLE::PARENT(x), sine, cosine); }\n";
+	print "template <typename TYPE> void SinCos(const VECTOR" . $dimension . "<TYPE>& x, VECTOR" . $dimension . "<TYPE>& sine, VECTOR" . $dimension . "<TYPE>& cosine)\n";
+	print "{\n";
+	print "\tVECTOR" . $dimension . "<TYPE> s = Sin(x); // x may be sine or cosine\n";
+	print "\tcosine = Cos(x);\n";
+	print "\tsine = s;\n";
+	print "}\n";
+	PrintComponentWise($dimension, "Tan", [["x", "vector"]], sub { "tan(" . ScalarComponentOf("x", $_[0]) . ")" });
+	PrintComponentWise($dimension, "Atan2", [["y", "vector"], ["x", "vector"]], sub { "atan2(" . ScalarComponentOf("y", $_[0]) . ", " . ScalarComponentOf("x", $_[0]) . ")" });
+	print "\n";
+	PrintSimdComponentWise($dimension, "Sin", [["x", "vector"]], "__SSE2__", "SimdSin(x.Simd())");
+	PrintSimdComponentWise($dimension, "Cos", [["x", "vector"]], "__SSE2__", "SimdCos(x.Simd())");
+	PrintSimdSinCos($dimension);
+	PrintSimdComponentWise($dimension, "Tan", [["x", "vector"]], "__SSE2__", "SimdTan(x.Simd())");
+	PrintSimdComponentWise($dimension, "Atan2", [["y", "vector"], ["x", "vector"]], "__SSE2__", "SimdAtan2(y.Simd(), " . SimdDivisor("float", $dimension, "x.Simd()") . ")");
+}
+
+return 1;
@@ -3,6 +3,9 @@
 require "util.pl";
 
 # Swizzle Equal To, Not Equal To, AlmostEqual, Less Than, Greater Than, Less Than or Equal To, Greater Than or Equal To
+#
+# The operators compare whole vectors (lexicographically for the orderings, so vectors sort); the named functions
+# compare component by component into a mask (MASK2 to MASK4) that Any(), All() and Select() take
 
 
 sub EqualTo
@@ -13,7 +16,7 @@ sub EqualTo
 	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, bool >::type >::type operator==(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) == typename SWIZZLE1::PARENT(rhs); }\n";
 	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator==(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) == rhs; }\n";
 	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator==(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs == typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> bool operator==(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR bool operator==(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
 	print "\treturn !(";
 	
@@ -23,7 +26,7 @@ sub EqualTo
 			{
 				print " || ";
 			}
-			print "lhs." . NumberToSwizzle($d) . " != rhs." . NumberToSwizzle($d);
+			print ComponentOf("lhs", $d) . " != " . ComponentOf("rhs", $d);
 		}
 	
 	print ");\n";
@@ -38,7 +41,7 @@ sub NotEqualTo
 	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, bool >::type >::type operator!=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) != typename SWIZZLE1::PARENT(rhs); }\n";
 	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator!=(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) != rhs; }\n";
 	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator!=(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs != typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> bool operator!=(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR bool operator!=(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
 	print "\treturn ";
 	
@@ -48,7 +51,7 @@ sub NotEqualTo
 			{
 				print " || ";
 			}
-			print "lhs." . NumberToSwizzle($d) . " != rhs." . NumberToSwizzle($d);
+			print ComponentOf("lhs", $d) . " != " . ComponentOf("rhs", $d);
 		}
 	
 	print ";\n";
@@ -73,7 +76,7 @@ sub AlmostEqual
 			{
 				print " && ";
 			}
-			print "fabs(lhs." . NumberToSwizzle($d) . " - rhs." . NumberToSwizzle($d) . ") < COMPARISON_EPSILON";
+			print "fabs(" . ComponentOf("lhs", $d) . " - " . ComponentOf("rhs", $d) . ") < ScalarType<TYPE>::Epsilon()";
 		}
 	
 	print ";\n";
@@ -88,9 +91,9 @@ sub LessThan
 	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) < typename SWIZZLE1::PARENT(rhs); }\n";
 	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator<(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) < rhs; }\n";
 	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator<(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs < typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> bool operator<(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR bool operator<(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
-	print "\treturn lhs.x < rhs.x || (lhs.x == rhs.x && lhs." . SwizzleRemainder($dimension) . " < rhs." . SwizzleRemainder($dimension) . ");\n";
+	print "\treturn " . LexicographicComparison($dimension, "<", "<", 0) . ";\n";
 	print "}\n\n";
 }
 
@@ -102,9 +105,9 @@ sub GreaterThan
 	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) > typename SWIZZLE1::PARENT(rhs); }\n";
 	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator>(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) > rhs; }\n";
 	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator>(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs > typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> bool operator>(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR bool operator>(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
-	print "\treturn lhs.x > rhs.x || (lhs.x == rhs.x && lhs." . SwizzleRemainder($dimension) . " > rhs." . SwizzleRemainder($dimension) . ");\n";
+	print "\treturn " . LexicographicComparison($dimension, ">", ">", 0) . ";\n";
 	print "}\n\n";
 }
 
@@ -116,9 +119,9 @@ sub LessThanOrEqual
 	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) <= typename SWIZZLE1::PARENT(rhs); }\n";
 	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator<=(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) <= rhs; }\n";
 	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator<=(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs <= typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> bool operator<=(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR bool operator<=(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
-	print "\treturn lhs.x < rhs.x || (lhs.x == rhs.x && lhs." . SwizzleRemainder($dimension) . " <= rhs." . SwizzleRemainder($dimension) . ");\n";
+	print "\treturn " . LexicographicComparison($dimension, "<", "<=", 0) . ";\n";
 	print "}\n\n";
 }
 
@@ -130,10 +133,131 @@ sub GreaterThanOrEqual
 	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) >= typename SWIZZLE1::PARENT(rhs); }\n";
 	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator>=(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) >= rhs; }\n";
 	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, bool >::type operator>=(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return lhs >= typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> bool operator>=(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR bool operator>=(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
-	print "\treturn lhs.x > rhs.x || (lhs.x == rhs.x && lhs." . SwizzleRemainder($dimension) . " >= rhs." . SwizzleRemainder($dimension) . ");\n";
+	print "\treturn " . LexicographicComparison($dimension, ">", ">=", 0) . ";\n";
 	print "}\n\n";
 }
 
+sub MakeMaskType
+{
+	my($dimension) = @_;
+
+	$mask = "MASK" . $dimension;
+	@names = ("x", "y", "z", "w")[0 .. $dimension - 1];
+	$all = (1 << $dimension) - 1;
+
+	print "// " . $dimension . "D component-wise comparison result: bit i is set where component i compared true\n";
+	print "struct " . $mask . "\n";
+	print "{\n";
+	print "\tunsigned bits;\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\tSVML_CONSTEXPR " . $mask . "() : bits(0) {}\n";
+	print "\tSVML_CONSTEXPR " . $mask . "(" . join(", ", map { "const bool& " . $_ } @names) . ") : bits(" . join(" | ", map { "(" . $names[$_] . " ? " . (1 << $_) . "u : 0u)" } (0 .. $dimension - 1)) . ") {}\n";
+	print "\tstatic SVML_CONSTEXPR " . $mask . " FromBits(const unsigned& bits) { return " . $mask . "(bits & " . $all . "u, 0); } // Only the low " . $dimension . " bits are kept\n";
+	print "\n";
+	print "\tSVML_CONSTEXPR bool operator[](const unsigned& index) const { return ((bits >> index) & 1u) != 0; }\n";
+	print "\n";
+	print "private:\n";
+	print "\tSVML_CONSTEXPR " . $mask . "(const unsigned& bits, int) : bits(bits) {}\n";
+	print "};\n";
+	print "\n";
+	print "// " . $dimension . "D mask [&], [|], [^], [!], [==], [!=], Any(), All()\n";
+	print "SVML_CONSTEXPR " . $mask . " operator&(const " . $mask . "& lhs, const " . $mask . "& rhs) { return " . $mask . "::FromBits(lhs.bits & rhs.bits); }\n";
+	print "SVML_CONSTEXPR " . $mask . " operator|(const " . $mask . "& lhs, const " . $mask . "& rhs) { return " . $mask . "::FromBits(lhs.bits | rhs.bits); }\n";
+	print "SVML_CONSTEXPR " . $mask . " operator^(const " . $mask . "& lhs, const " . $mask . "& rhs) { return " . $mask . "::FromBits(lhs.bits ^ rhs.bits); }\n";
+	print "SVML_CONSTEXPR " . $mask . " operator!(const " . $mask . "& mask) { return " . $mask . "::FromBits(~mask.bits); }\n";
+	print "SVML_CONSTEXPR bool operator==(const " . $mask . "& lhs, const " . $mask . "& rhs) { return lhs.bits == rhs.bits; }\n";
+	print "SVML_CONSTEXPR bool operator!=(const " . $mask . "& lhs, const " . $mask . "& rhs) { return lhs.bits != rhs.bits; }\n";
+	print "SVML_CONSTEXPR bool Any(const " . $mask . "& mask) { return mask.bits != 0; }\n";
+	print "SVML_CONSTEXPR bool All(const " . $mask . "& mask) { return mask.bits == " . $all . "u; }\n";
+	print "\n";
+}
+
+# Mask operator<< and ToString() (printed in svml_io.h)
+sub MaskToString
+{
+	my($dimension) = @_;
+	
+	$mask = "MASK" . $dimension;
+	
+	print "// " . $dimension . "D mask operator<< and ToString()\n";
+	print "inline ostream& operator<<(ostream& os, const " . $mask . "& printMask)\n";
+	print "{\n";
+	print "\tos << \"(\"";
+	for ($d = 0; $d < $dimension; $d++)
+	{
+		print (($d > 0) ? " << \", \" << " : " << ");
+		print "(printMask[" . $d . "] ? \"true\" : \"false\")";
+	}
+	print " << \")\";\n";
+	print "\treturn os;\n";
+	print "}\n";
+	print "inline string ToString(const " . $mask . "& printMask)\n";
+	print "{\n";
+	print "\tstd::ostringstream buffer;\n";
+	print "\tbuffer << printMask;\n";
+	print "\treturn buffer.str();\n";
+	print "}\n";
+	print "\n";
+}
+
+# The component-wise comparisons, with the test each component gets (A and B stand for the components)
+@componentComparisons = (["Equal", "A == B"], ["NotEqual", "A != B"], ["AlmostEqualMask", "fabs(A - B) < ScalarType<TYPE>::Epsilon()"], ["LessThan", "A < B"],
+                         ["GreaterThan", "A > B"], ["LessThanEqual", "A <= B"], ["GreaterThanEqual", "A >= B"]);
+
+# Component-wise comparisons into a mask, each component compared with the same operator as the scalars would be
+sub ComparisonMasks
+{
+	my($dimension) = @_;
+
+	$mask = "MASK" . $dimension;
+	my $swizzleMask = "typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, " . $mask . " >::type";
+	my $vectorMask = "typename MaskType<TYPE, " . $mask . ">::type";
+
+	print "// " . $dimension . "D component-wise comparisons: Equal(), NotEqual(), AlmostEqualMask(), LessThan(), GreaterThan(), LessThanEqual(), GreaterThanEqual()\n";
+	foreach $comparison (@componentComparisons)
+	{
+		($name, $test) = @$comparison;
+		$constexpr = ($name eq "AlmostEqualMask") ? "inline" : "SVML_CONSTEXPR";
+
+		print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, " . $swizzleMask . " >::type >::type " . $name . "(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return " . $name . "(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }\n";
+		print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, " . $vectorMask . " >::type " . $name . "(const SWIZZLE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return " . $name . "(typename SWIZZLE::PARENT(lhs), rhs); }\n";
+		print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, " . $vectorMask . " >::type " . $name . "(const VECTOR" . $dimension . "<TYPE>& lhs, const SWIZZLE& rhs) { return " . $name . "(lhs, typename SWIZZLE::PARENT(rhs)); }\n";
+		print "template <typename TYPE> " . $constexpr . " " . $mask . " " . $name . "(const VECTOR" . $dimension . "<TYPE>& lhs, const VECTOR" . $dimension . "<TYPE>& rhs) { return " . $mask . "(";
+		for ($d = 0; $d < $dimension; $d++)
+		{
+			$lane = $test;
+			$lane =~ s/A/ComponentOf("lhs", $d)/e;
+			$lane =~ s/\bB\b/ComponentOf("rhs", $d)/e;
+			print (($d > 0) ? ", " : "");
+			print $lane;
+		}
+		print "); }\n";
+	}
+	print "\n";
+
+	PrintSimdComparisonMasks($dimension);
+}
+
+# Per component a where the mask is set and b elsewhere, without branching
+sub Select
+{
+	my($dimension) = @_;
+
+	$mask = "MASK" . $dimension;
+
+	print "// " . $dimension . "D Select(): Component-wise mask ? a : b\n";
+	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Select(const typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, " . $mask . " >::type& mask, const SWIZZLE0& a, const SWIZZLE1& b) { return Select(mask, typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
+	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Select(const typename MaskType<TYPE, " . $mask . ">::type& mask, const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return Select(mask, typename SWIZZLE::PARENT(a), b); }\n";
+	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Select(const typename MaskType<TYPE, " . $mask . ">::type& mask, const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return Select(mask, a, typename SWIZZLE::PARENT(b)); }\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> Select(const " . $mask . "& mask, const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
+	print "{\n";
+	print "\treturn VECTOR" . $dimension . "<TYPE>(" . join(", ", map { "mask[" . $_ . "] ? " . ComponentOf("a", $_) . " : " . ComponentOf("b", $_) } (0 .. $dimension - 1)) . ");\n";
+	print "}\n\n";
+
+	PrintSimdSelect($dimension);
+}
+
 return 1;
\ No newline at end of file
@@ -0,0 +1,402 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Runtime instruction set dispatch for the float bulk kernels (SVML::Bulk, defines SVML_HAS_DISPATCH): Normalize(),
+# Dot(), Distance(), DistanceSquared(), Rotate() and the 3D Transform() are compiled once per instruction set, each
+# copy in its own namespace with the target attribute, and the bulk functions pick one copy per call
+#
+# A template can't be compiled for several targets, so the kernels are written out once per instruction set. Each
+# 128-bit lane of a register holds four consecutive vectors, and the shuffles stay within lanes, so the same text
+# transposes 4, 8 or 16 vectors into one register per component. The arithmetic is the per-vector functions' in the
+# same order, without contraction into FMA, so every instruction set returns the bits the inline functions do
+
+@dispatchIsas = (
+	{ "name" => "SSE2", "value" => "ISA_SSE2", "target" => "sse2", "register" => "__m128", "width" => 4, "prefix" => "_mm" },
+	{ "name" => "AVX2", "value" => "ISA_AVX2", "target" => "avx2", "register" => "__m256", "width" => 8, "prefix" => "_mm256" },
+	{ "name" => "AVX512", "value" => "ISA_AVX512", "target" => "avx512f", "register" => "__m512", "width" => 16, "prefix" => "_mm512" },
+);
+
+sub DispatchBegin
+{
+	print "#ifdef SVML_HAS_DISPATCH\n";
+}
+
+sub DispatchEnd
+{
+	print "#endif // SVML_HAS_DISPATCH\n";
+	print "\n";
+}
+
+# Lanes from (and to) every stride-th run of four floats: plain loads at SSE2, gathered 128-bit lanes above it
+sub PrintDispatchLanes
+{
+	my($isa) = @_;
+
+	$target = "SVML_TARGET(\"" . $isa->{"target"} . "\")";
+	if ($isa->{"name"} eq "SSE2")
+	{
+		print $target . " inline __m128 LoadLanes(const float* source, const size_t&) { return _mm_loadu_ps(source); }\n";
+		print $target . " inline void StoreLanes(float* destination, const size_t&, const __m128& lanes) { _mm_storeu_ps(destination, lanes); }\n";
+	}
+	elsif ($isa->{"name"} eq "AVX2")
+	{
+		print $target . " inline __m256 LoadLanes(const float* source, const size_t& stride) { return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source)), _mm_loadu_ps(source + 4 * stride), 1); }\n";
+		print $target . " inline void StoreLanes(float* destination, const size_t& stride, const __m256& lanes)\n";
+		print "{\n";
+		print "\t_mm_storeu_ps(destination, _mm256_castps256_ps128(lanes));\n";
+		print "\t_mm_storeu_ps(destination + 4 * stride, _mm256_extractf128_ps(lanes, 1));\n";
+		print "}\n";
+	}
+	else
+	{
+		print $target . " inline __m512 LoadLanes(const float* source, const size_t& stride)\n";
+		print "{\n";
+		print "\t__m512 lanes = _mm512_castps128_ps512(_mm_loadu_ps(source));\n";
+		print "\tlanes = _mm512_insertf32x4(lanes, _mm_loadu_ps(source + 4 * stride), 1);\n";
+		print "\tlanes = _mm512_insertf32x4(lanes, _mm_loadu_ps(source + 8 * stride), 2);\n";
+		print "\treturn _mm512_insertf32x4(lanes, _mm_loadu_ps(source + 12 * stride), 3);\n";
+		print "}\n";
+		print $target . " inline void StoreLanes(float* destination, const size_t& stride, const __m512& lanes)\n";
+		print "{\n";
+		print "\t_mm_storeu_ps(destination, _mm512_castps512_ps128(lanes));\n";
+		print "\t_mm_storeu_ps(destination + 4 * stride, _mm512_maskz_extractf32x4_ps(0xF, lanes, 1));\n";
+		print "\t_mm_storeu_ps(destination + 8 * stride, _mm512_maskz_extractf32x4_ps(0xF, lanes, 2));\n";
+		print "\t_mm_storeu_ps(destination + 12 * stride, _mm512_maskz_extractf32x4_ps(0xF, lanes, 3));\n";
+		print "}\n";
+	}
+}
+
+# Loading and storing WIDTH vectors as one register per component
+sub PrintDispatchTranspose
+{
+	my($isa) = @_;
+
+	$target = "SVML_TARGET(\"" . $isa->{"target"} . "\")";
+	$p = $isa->{"prefix"};
+
+	print "// (p[I], q[J], r[K], s[L]) in every lane\n";
+	print "template <int I, int J, int K, int L> " . $target . " inline REGISTER Pick(const REGISTER& p, const REGISTER& q, const REGISTER& r, const REGISTER& s)\n";
+	print "{\n";
+	print "\treturn " . $p . "_shuffle_ps(" . $p . "_shuffle_ps(p, q, _MM_SHUFFLE(J, J, I, I)), " . $p . "_shuffle_ps(r, s, _MM_SHUFFLE(L, L, K, K)), _MM_SHUFFLE(2, 0, 2, 0));\n";
+	print "}\n";
+	print "\n";
+	print "// WIDTH vectors of stride floats (2, 3, or 4 for VECTOR4 and padded VECTOR3) into one register per component\n";
+	print $target . " inline void Load(const float* source, const size_t& stride, REGISTER* components)\n";
+	print "{\n";
+	print "\tREGISTER r0 = LoadLanes(source, stride), r1 = LoadLanes(source + 4, stride);\n";
+	print "\tif (stride == 2)\n";
+	print "\t{\n";
+	print "\t\tcomponents[0] = " . $p . "_shuffle_ps(r0, r1, _MM_SHUFFLE(2, 0, 2, 0));\n";
+	print "\t\tcomponents[1] = " . $p . "_shuffle_ps(r0, r1, _MM_SHUFFLE(3, 1, 3, 1));\n";
+	print "\t\treturn;\n";
+	print "\t}\n";
+	print "\tREGISTER r2 = LoadLanes(source + 8, stride);\n";
+	print "\tif (stride == 3)\n";
+	print "\t{\n";
+	print "\t\tcomponents[0] = Pick<0, 3, 2, 1>(r0, r0, r1, r2);\n";
+	print "\t\tcomponents[1] = Pick<1, 0, 3, 2>(r0, r1, r1, r2);\n";
+	print "\t\tcomponents[2] = Pick<2, 1, 0, 3>(r0, r1, r2, r2);\n";
+	print "\t\treturn;\n";
+	print "\t}\n";
+	print "\tREGISTER r3 = LoadLanes(source + 12, stride);\n";
+	print "\tREGISTER xy01 = " . $p . "_unpacklo_ps(r0, r1), xy23 = " . $p . "_unpacklo_ps(r2, r3), zw01 = " . $p . "_unpackhi_ps(r0, r1), zw23 = " . $p . "_unpackhi_ps(r2, r3);\n";
+	print "\tcomponents[0] = " . $p . "_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));\n";
+	print "\tcomponents[1] = " . $p . "_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));\n";
+	print "\tcomponents[2] = " . $p . "_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));\n";
+	print "\tcomponents[3] = " . $p . "_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2));\n";
+	print "}\n";
+	print "\n";
+	print "// The inverse of Load()\n";
+	print $target . " inline void Store(float* destination, const size_t& stride, const REGISTER* components)\n";
+	print "{\n";
+	print "\tif (stride == 2)\n";
+	print "\t{\n";
+	print "\t\tStoreLanes(destination, stride, " . $p . "_unpacklo_ps(components[0], components[1]));\n";
+	print "\t\tStoreLanes(destination + 4, stride, " . $p . "_unpackhi_ps(components[0], components[1]));\n";
+	print "\t}\n";
+	print "\telse if (stride == 3)\n";
+	print "\t{\n";
+	print "\t\tStoreLanes(destination, stride, Pick<0, 0, 0, 1>(components[0], components[1], components[2], components[0]));\n";
+	print "\t\tStoreLanes(destination + 4, stride, Pick<1, 1, 2, 2>(components[1], components[2], components[0], components[1]));\n";
+	print "\t\tStoreLanes(destination + 8, stride, Pick<2, 3, 3, 3>(components[2], components[0], components[1], components[2]));\n";
+	print "\t}\n";
+	print "\telse\n";
+	print "\t{\n";
+	print "\t\tREGISTER xy01 = " . $p . "_unpacklo_ps(components[0], components[1]), xy23 = " . $p . "_unpackhi_ps(components[0], components[1]);\n";
+	print "\t\tREGISTER zw01 = " . $p . "_unpacklo_ps(components[2], components[3]), zw23 = " . $p . "_unpackhi_ps(components[2], components[3]);\n";
+	print "\t\tStoreLanes(destination, stride, " . $p . "_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0)));\n";
+	print "\t\tStoreLanes(destination + 4, stride, " . $p . "_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2)));\n";
+	print "\t\tStoreLanes(destination + 8, stride, " . $p . "_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0)));\n";
+	print "\t\tStoreLanes(destination + 12, stride, " . $p . "_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2)));\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+}
+
+# The sum of a[c] * b[c] over the components Dot() uses, in its order
+sub DispatchDot
+{
+	my($p, $dimension, $a, $b) = @_;
+
+	$sum = $p . "_mul_ps(" . $a . "[0], " . $b . "[0])";
+	for ($c = 1; $c < (($dimension > 2) ? 3 : 2); $c++)
+	{
+		$sum = $p . "_add_ps(" . $sum . ", " . $p . "_mul_ps(" . $a . "[" . $c . "], " . $b . "[" . $c . "]))";
+	}
+	return $sum;
+}
+
+# One kernel: the loop over whole registers, then the rest one vector at a time with the per-vector function
+sub PrintDispatchKernel
+{
+	my($isa, $dimension, $signature, $body, $remainder) = @_;
+
+	print "SVML_TARGET(\"" . $isa->{"target"} . "\") inline void " . $signature . "\n";
+	print "{\n";
+	print "\tconst size_t stride = sizeof(VECTOR" . $dimension . "<float>) / sizeof(float);\n";
+	print "\tsize_t i = 0;\n";
+	print "\tfor (; i + WIDTH <= count; i += WIDTH)\n";
+	print "\t{\n";
+	foreach $line (@$body)
+	{
+		print "\t\t" . $line . "\n";
+	}
+	print "\t}\n";
+	print "\tfor (; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\t" . $remainder . "\n";
+	print "\t}\n";
+	print "}\n";
+}
+
+sub PrintDispatchKernels
+{
+	my($isa, $dimension) = @_;
+
+	$p = $isa->{"prefix"};
+	$vector = "VECTOR" . $dimension . "<float>";
+	$used = ($dimension > 2) ? 3 : 2; # Components the geometric functions use (4D vectors keep w)
+
+	print "// " . $dimension . "D kernels\n";
+	@body = ("REGISTER v[4];", "Load((const float*)(a + i), stride, v);", "REGISTER length = " . $p . "_sqrt_ps(" . DispatchDot($p, $dimension, "v", "v") . ");");
+	for ($c = 0; $c < $used; $c++)
+	{
+		push(@body, "v[" . $c . "] = " . $p . "_div_ps(v[" . $c . "], length);");
+	}
+	push(@body, "Store((float*)(out + i), stride, v);");
+	PrintDispatchKernel($isa, $dimension, "Normalize(" . $vector . "* out, const " . $vector . "* a, const size_t& count)", \@body, "out[i] = SVML::Normalize(a[i]);");
+
+	$load = "Load((const float*)(a + i), stride, va);";
+	PrintDispatchKernel($isa, $dimension, "Dot(float* out, const " . $vector . "* a, const " . $vector . "* b, const size_t& count)",
+	                    ["REGISTER va[4], vb[4];", $load, "Load((const float*)(b + i), stride, vb);", $p . "_storeu_ps(out + i, " . DispatchDot($p, $dimension, "va", "vb") . ");"], "out[i] = SVML::Dot(a[i], b[i]);");
+
+	@difference = ("REGISTER va[4], vb[4];", $load, "Load((const float*)(b + i), stride, vb);");
+	for ($c = 0; $c < $used; $c++)
+	{
+		push(@difference, "va[" . $c . "] = " . $p . "_sub_ps(va[" . $c . "], vb[" . $c . "]);");
+	}
+	PrintDispatchKernel($isa, $dimension, "DistanceSquared(float* out, const " . $vector . "* a, const " . $vector . "* b, const size_t& count)",
+	                    [@difference, $p . "_storeu_ps(out + i, " . DispatchDot($p, $dimension, "va", "va") . ");"], "out[i] = SVML::DistanceSquared(a[i], b[i]);");
+	PrintDispatchKernel($isa, $dimension, "Distance(float* out, const " . $vector . "* a, const " . $vector . "* b, const size_t& count)",
+	                    [@difference, $p . "_storeu_ps(out + i, " . $p . "_sqrt_ps(" . DispatchDot($p, $dimension, "va", "va") . "));"], "out[i] = SVML::Distance(a[i], b[i]);");
+
+	if ($dimension == 2)
+	{
+		PrintDispatchKernel($isa, $dimension, "Rotate(" . $vector . "* out, const " . $vector . "* a, const ROTATION2<float>& rotation, const size_t& count)",
+		                    ["REGISTER v[4];", "Load((const float*)(a + i), stride, v);", "REGISTER c = " . $p . "_set1_ps(rotation.c), s = " . $p . "_set1_ps(rotation.s);",
+		                     "REGISTER x = " . $p . "_sub_ps(" . $p . "_mul_ps(v[0], c), " . $p . "_mul_ps(v[1], s));",
+		                     "v[1] = " . $p . "_add_ps(" . $p . "_mul_ps(v[0], s), " . $p . "_mul_ps(v[1], c));",
+		                     "v[0] = x;", "Store((float*)(out + i), stride, v);"], "out[i] = SVML::Rotate(a[i], rotation);");
+	}
+	else
+	{
+		# The rotation as a matrix, like the batch Rotate(), and 4D vectors keep w
+		@body = ("REGISTER v[4], rotated[4];", "Load((const float*)(a + i), stride, v);");
+		for ($row = 0; $row < 3; $row++)
+		{
+			$sum = $p . "_mul_ps(" . $p . "_set1_ps(matrix[0]." . NumberToSwizzle($row) . "), v[0])";
+			for ($column = 1; $column < 3; $column++)
+			{
+				$sum = $p . "_add_ps(" . $sum . ", " . $p . "_mul_ps(" . $p . "_set1_ps(matrix[" . $column . "]." . NumberToSwizzle($row) . "), v[" . $column . "]))";
+			}
+			push(@body, "rotated[" . $row . "] = " . $sum . ";");
+		}
+		# Load() fills v[3] only for 4 floats a vector (VECTOR4 and padded VECTOR3), and Store() reads it only then
+		push(@body, "if (stride == 4)", "{", "\trotated[3] = v[3];", "}", "Store((float*)(out + i), stride, rotated);");
+		PrintDispatchKernel($isa, $dimension, "Transform(" . $vector . "* out, const MATRIX3<float>& matrix, const " . $vector . "* a, const size_t& count)", \@body,
+		                    ($dimension == 3) ? "out[i] = matrix * a[i];" : "out[i] = " . $vector . "(matrix * VECTOR3<float>(a[i].xyz), a[i].w);");
+	}
+	print "\n";
+}
+
+# The kernels of one instruction set, in namespace SVML::Bulk::<name>
+sub PrintDispatchIsa
+{
+	my($isa) = @_;
+
+	# GCC's AVX-512 intrinsics (sqrt, unpack, extract) start from _mm512_undefined_ps(), a self-initialized variable that
+	# GCC 12 reports as maybe uninitialized (or, with -march=native, uninitialized) wherever they're inlined. StoreLanes()
+	# extracts with the zero-masked form, like ConvertComponents() converts, and the rest are quieted here
+	my $quiet = ($isa->{"name"} eq "AVX512");
+	if ($quiet)
+	{
+		print "#if defined(__GNUC__) && !defined(__clang__)\n";
+		print "#pragma GCC diagnostic push\n";
+		print "#pragma GCC diagnostic ignored \"-Wmaybe-uninitialized\"\n";
+		print "#pragma GCC diagnostic ignored \"-Wuninitialized\"\n";
+		print "#endif\n";
+	}
+	print "namespace " . $isa->{"name"} . "\n";
+	print "{\n";
+	print "\n";
+	print "typedef " . $isa->{"register"} . " REGISTER;\n";
+	print "const size_t WIDTH = " . $isa->{"width"} . "; // Vectors per loop\n";
+	print "\n";
+	print "// Lane l of a register from (and to) the four floats at 4 * stride * l\n";
+	PrintDispatchLanes($isa);
+	print "\n";
+	PrintDispatchTranspose($isa);
+	for (my $d = 2; $d <= 4; $d++)
+	{
+		PrintDispatchKernels($isa, $d);
+	}
+	print "} // " . $isa->{"name"} . " namespace\n";
+	if ($quiet)
+	{
+		print "#if defined(__GNUC__) && !defined(__clang__)\n";
+		print "#pragma GCC diagnostic pop\n";
+		print "#endif\n";
+	}
+	print "\n";
+}
+
+sub PrintDispatchUtilities
+{
+	print "// Instruction sets the float kernels are compiled for, in order\n";
+	print "enum ISA { ISA_SSE2, ISA_AVX2, ISA_AVX512 };\n";
+	print "\n";
+	print "// The best instruction set the processor and the operating system support\n";
+	print "inline ISA SupportedIsa()\n";
+	print "{\n";
+	print "#if defined(_MSC_VER) && !defined(__clang__)\n";
+	print "\tint info[4];\n";
+	print "\t__cpuidex(info, 0, 0);\n";
+	print "\tint leaves = info[0];\n";
+	print "\t__cpuidex(info, 1, 0);\n";
+	print "\tunsigned long long saved = ((info[2] & (1 << 27)) != 0) ? _xgetbv(0) : 0; // Register state the OS saves (OSXSAVE, XCR0)\n";
+	print "\tif (leaves < 7 || (info[2] & (1 << 28)) == 0 || (saved & 0x6) != 0x6)\n";
+	print "\t{\n";
+	print "\t\treturn ISA_SSE2;\n";
+	print "\t}\n";
+	print "\t__cpuidex(info, 7, 0);\n";
+	print "\tif ((info[1] & (1 << 16)) != 0 && (saved & 0xE6) == 0xE6)\n";
+	print "\t{\n";
+	print "\t\treturn ISA_AVX512;\n";
+	print "\t}\n";
+	print "\treturn ((info[1] & (1 << 5)) != 0) ? ISA_AVX2 : ISA_SSE2;\n";
+	print "#else\n";
+	print "\t__builtin_cpu_init();\n";
+	print "\tif (__builtin_cpu_supports(\"avx512f\"))\n";
+	print "\t{\n";
+	print "\t\treturn ISA_AVX512;\n";
+	print "\t}\n";
+	print "\treturn __builtin_cpu_supports(\"avx2\") ? ISA_AVX2 : ISA_SSE2;\n";
+	print "#endif\n";
+	print "}\n";
+	print "\n";
+	print "// The supported instruction set, or a lower one named by the environment variable SVML_BULK_ISA (sse2, avx2 or avx512)\n";
+	print "inline ISA DefaultIsa()\n";
+	print "{\n";
+	print "\tISA isa = SupportedIsa();\n";
+	print "\tconst char* named = getenv(\"SVML_BULK_ISA\");\n";
+	print "\tif (named != 0 && strcmp(named, \"sse2\") == 0) { return ISA_SSE2; }\n";
+	print "\tif (named != 0 && strcmp(named, \"avx2\") == 0) { return std::min(isa, ISA_AVX2); }\n";
+	print "\treturn isa;\n";
+	print "}\n";
+	print "\n";
+	print "// Chosen on first use\n";
+	print "inline std::atomic<int>& IsaSelection()\n";
+	print "{\n";
+	print "\tstatic std::atomic<int> selection(DefaultIsa());\n";
+	print "\treturn selection;\n";
+	print "}\n";
+	print "\n";
+	print "// The instruction set the bulk functions run\n";
+	print "inline ISA ActiveIsa() { return (ISA)IsaSelection().load(std::memory_order_relaxed); }\n";
+	print "\n";
+	print "// Runs isa from now on, or the supported instruction set if isa is beyond it, and returns which\n";
+	print "inline ISA SelectIsa(const ISA& isa)\n";
+	print "{\n";
+	print "\tISA chosen = std::min(isa, SupportedIsa());\n";
+	print "\tIsaSelection().store(chosen);\n";
+	print "\treturn chosen;\n";
+	print "}\n";
+	print "\n";
+	print "// The kernel of the active instruction set\n";
+	print "template <typename KERNEL> KERNEL Dispatch(const KERNEL& sse2, const KERNEL& avx2, const KERNEL& avx512)\n";
+	print "{\n";
+	print "\tISA isa = ActiveIsa();\n";
+	print "\treturn (isa == ISA_AVX512) ? avx512 : ((isa == ISA_AVX2) ? avx2 : sse2);\n";
+	print "}\n";
+	print "\n";
+
+	foreach $isa (@dispatchIsas)
+	{
+		PrintDispatchIsa($isa);
+	}
+}
+
+# The float overloads of the bulk functions, which win over the templates and run the chosen kernel on each chunk
+sub PrintDispatchCall
+{
+	my($signature, $kernelType, $kernel, $call) = @_;
+
+	print "inline void " . $signature . ", " . BulkScheduleParameters() . ")\n";
+	print "{\n";
+	print "\ttypedef void (*KERNEL)" . $kernelType . ";\n";
+	print "\tKERNEL kernel = Dispatch<KERNEL>(SSE2::" . $kernel . ", AVX2::" . $kernel . ", AVX512::" . $kernel . ");\n";
+	print "\tParallelFor(a.count, [&](size_t begin, size_t end) { kernel(" . $call . "); }, grain, pool);\n";
+	print "}\n";
+}
+
+sub DispatchFunctions
+{
+	my($dimension) = @_;
+
+	$vector = "VECTOR" . $dimension . "<float>";
+	$span = "SPAN< " . $vector . " >";
+	$input = "SPAN< const " . $vector . " >";
+	$vectorKernel = "(" . $vector . "*, const " . $vector . "*, const size_t&)";
+	$scalarKernel = "(float*, const " . $vector . "*, const " . $vector . "*, const size_t&)";
+
+	print "// " . $dimension . "D float bulk functions on the active instruction set\n";
+	PrintDispatchCall("Normalize(const " . $span . "& out, const " . $input . "& a", $vectorKernel, "Normalize", "out.Data() + begin, a.data + begin, end - begin");
+	foreach $function ("Dot", "Distance", "DistanceSquared")
+	{
+		PrintDispatchCall($function . "(const SPAN<float>& out, const " . $input . "& a, const " . $input . "& b", $scalarKernel, $function, "out.Data() + begin, a.data + begin, b.data + begin, end - begin");
+	}
+	if ($dimension == 2)
+	{
+		PrintDispatchCall("Rotate(const " . $span . "& out, const " . $input . "& a, const ROTATION2<float>& rotation", "(" . $vector . "*, const " . $vector . "*, const ROTATION2<float>&, const size_t&)", "Rotate",
+		                  "out.Data() + begin, a.data + begin, rotation, end - begin");
+	}
+	else
+	{
+		$transformKernel = "(" . $vector . "*, const MATRIX3<float>&, const " . $vector . "*, const size_t&)";
+		print "inline void Rotate(const " . $span . "& out, const " . $input . "& a, const QUATERNION<float>& rotation, " . BulkScheduleParameters() . ")\n";
+		print "{\n";
+		print "\tMATRIX3<float> matrix = ToMatrix(rotation);\n";
+		print "\ttypedef void (*KERNEL)" . $transformKernel . ";\n";
+		print "\tKERNEL kernel = Dispatch<KERNEL>(SSE2::Transform, AVX2::Transform, AVX512::Transform);\n";
+		print "\tParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, matrix, a.data + begin, end - begin); }, grain, pool);\n";
+		print "}\n";
+		if ($dimension == 3)
+		{
+			PrintDispatchCall("Transform(const " . $span . "& out, const MATRIX3<float>& matrix, const " . $input . "& a", $transformKernel, "Transform", "out.Data() + begin, matrix, a.data + begin, end - begin");
+		}
+	}
+	print "\n";
+}
+
+return 1;
@@ -0,0 +1,130 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Expression templates: swizzle arithmetic builds EXPRESSION2/3/4 nodes, evaluated one component at a time on conversion or assignment
+
+sub PrintExpressionUtilities
+{
+	print "// Expression templates (arithmetic on swizzles is recorded, then evaluated in one pass per component)\n";
+	print "template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct EXPRESSION2;\n";
+	print "template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct EXPRESSION3;\n";
+	print "template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct EXPRESSION4;\n";
+	print "\n";
+	print "// Component type of a vector\n";
+	print "template <typename TYPE> struct ComponentType {};\n";
+	print "template <typename TYPE> struct ComponentType< VECTOR2<TYPE> > { typedef TYPE type; };\n";
+	print "template <typename TYPE> struct ComponentType< VECTOR3<TYPE> > { typedef TYPE type; };\n";
+	print "template <typename TYPE> struct ComponentType< VECTOR4<TYPE> > { typedef TYPE type; };\n";
+	print "\n";
+	print "// Leaf operands\n";
+	print "template <typename TYPE> struct EXPRESSION_SCALAR // TYPE is the scalar type of the vector's components\n";
+	print "{\n";
+	print "\tTYPE value;\n";
+	print "\texplicit EXPRESSION_SCALAR(const TYPE& value) : value(value) {}\n";
+	print "\tTYPE Component(const unsigned&) const { return value; }\n";
+	print "};\n";
+	print "struct EXPRESSION_NONE {}; // Right-hand side of unary operations\n";
+	print "\n";
+	print "// Vectors and swizzles are held by reference, nested expressions and scalars by value\n";
+	print "template <typename OPERAND> struct ExpressionStorage { typedef const OPERAND& type; };\n";
+	print "template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct ExpressionStorage< EXPRESSION2<TYPE, LHS, RHS, OPERATION> > { typedef const EXPRESSION2<TYPE, LHS, RHS, OPERATION> type; };\n";
+	print "template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct ExpressionStorage< EXPRESSION3<TYPE, LHS, RHS, OPERATION> > { typedef const EXPRESSION3<TYPE, LHS, RHS, OPERATION> type; };\n";
+	print "template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct ExpressionStorage< EXPRESSION4<TYPE, LHS, RHS, OPERATION> > { typedef const EXPRESSION4<TYPE, LHS, RHS, OPERATION> type; };\n";
+	print "template <typename TYPE> struct ExpressionStorage< EXPRESSION_SCALAR<TYPE> > { typedef const EXPRESSION_SCALAR<TYPE> type; };\n";
+	print "template <> struct ExpressionStorage<EXPRESSION_NONE> { typedef const EXPRESSION_NONE type; };\n";
+	print "\n";
+	print "// Operations\n";
+	PrintExpressionOperation("EXPRESSION_ADD", "lhs.Component(index) + rhs.Component(index)");
+	PrintExpressionOperation("EXPRESSION_SUBTRACT", "lhs.Component(index) - rhs.Component(index)");
+	PrintExpressionOperation("EXPRESSION_MULTIPLY", "lhs.Component(index) * rhs.Component(index)");
+	PrintExpressionOperation("EXPRESSION_DIVIDE", "lhs.Component(index) / rhs.Component(index)");
+	PrintExpressionOperation("EXPRESSION_NEGATE", "(index == 3) ? lhs.Component(index) : -lhs.Component(index)"); # Like VECTOR4 negation, w is kept
+	print "\n";
+
+	for ($e = 2; $e <= 4; $e++)
+	{
+		MakeExpressionType($e);
+	}
+}
+
+sub PrintExpressionOperation
+{
+	my($name, $expression) = @_;
+
+	# Unary operations leave rhs unnamed, as it is always EXPRESSION_NONE
+	$rhs = ($expression =~ /rhs/) ? " rhs" : "";
+	print "struct " . $name . " { template <typename TYPE, typename LHS, typename RHS> static TYPE Apply(const unsigned& index, const LHS& lhs, const RHS&" . $rhs . ") { return " . $expression . "; } };\n";
+}
+
+sub MakeExpressionType
+{
+	my($dimension) = @_;
+
+	print "template <typename TYPE, typename LHS, typename RHS, typename OPERATION>\n";
+	print "struct EXPRESSION" . $dimension . "\n";
+	print "{\n";
+	print "\ttypedef VECTOR" . $dimension . "<TYPE> PARENT;\n";
+	print "\t\n";
+	print "\ttypename ExpressionStorage<LHS>::type lhs;\n";
+	print "\ttypename ExpressionStorage<RHS>::type rhs;\n";
+	print "\t\n";
+	print "\tEXPRESSION" . $dimension . "(const LHS& lhs, const RHS& rhs) : lhs(lhs), rhs(rhs) {}\n";
+	print "\t\n";
+	print "\tTYPE Component(const unsigned& index) const { return OPERATION::template Apply<TYPE>(index, lhs, rhs); }\n";
+	print "\toperator VECTOR" . $dimension . "<TYPE>() const { return VECTOR" . $dimension . "<TYPE>(";
+		for ($d = 0; $d < $dimension; $d++)
+		{
+			if ($d > 0)
+			{
+				print ", ";
+			}
+			print "Component(" . $d . ")";
+		}
+	print "); }\n";
+	print "};\n\n";
+}
+
+# Return type of a swizzle operator, SFINAE'd on the PARENT of every non-vector operand
+sub ExpressionReturnType
+{
+	my($dimension, $lhs, $rhs, $operation, @swizzles) = @_;
+
+	$outString = "";
+	foreach $swizzle (@swizzles)
+	{
+		$outString .= "typename EnableIf< Is" . $dimension . "D< typename " . $swizzle . "::PARENT >, ";
+	}
+	$outString .= "EXPRESSION" . $dimension . "< typename ComponentType< typename " . $swizzles[0] . "::PARENT >::type, " . $lhs . ", " . $rhs . ", " . $operation . " >";
+	foreach $swizzle (@swizzles)
+	{
+		$outString .= " >::type";
+	}
+
+	return $outString;
+}
+
+# The three swizzle forms of a component-wise operator
+sub PrintExpressionOperators
+{
+	my($dimension, $operator, $operation) = @_;
+
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+
+	print "template <typename SWIZZLE0, typename SWIZZLE1> inline " . ExpressionReturnType($dimension, "SWIZZLE0", "SWIZZLE1", $operation, "SWIZZLE0", "SWIZZLE1") . " operator" . $operator . "(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION" . $dimension . "< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, " . $operation . " >(lhs, rhs); }\n";
+	print "template <typename SWIZZLE, typename TYPE> inline " . ExpressionReturnType($dimension, "SWIZZLE", $vector, $operation, "SWIZZLE") . " operator" . $operator . "(const SWIZZLE& lhs, const " . $vector . "& rhs) { return EXPRESSION" . $dimension . "< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, " . $vector . ", " . $operation . " >(lhs, rhs); }\n";
+	print "template <typename TYPE, typename SWIZZLE> inline " . ExpressionReturnType($dimension, $vector, "SWIZZLE", $operation, "SWIZZLE") . " operator" . $operator . "(const " . $vector . "& lhs, const SWIZZLE& rhs) { return EXPRESSION" . $dimension . "< typename ComponentType< typename SWIZZLE::PARENT >::type, " . $vector . ", SWIZZLE, " . $operation . " >(lhs, rhs); }\n";
+}
+
+# The two swizzle forms of a scalar operator
+sub PrintExpressionScalarOperators
+{
+	my($dimension, $operator, $operation) = @_;
+
+	my $scalar = "EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >";
+
+	print "template <typename SWIZZLE> inline " . ExpressionReturnType($dimension, "SWIZZLE", $scalar, $operation, "SWIZZLE") . " operator" . $operator . "(const SWIZZLE& lhs, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& rhs) { return EXPRESSION" . $dimension . "< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, " . $scalar . ", " . $operation . " >(lhs, " . $scalar . "(rhs)); }\n";
+	print "template <typename SWIZZLE> inline " . ExpressionReturnType($dimension, $scalar, "SWIZZLE", $operation, "SWIZZLE") . " operator" . $operator . "(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& lhs, const SWIZZLE& rhs) { return EXPRESSION" . $dimension . "< typename ComponentType< typename SWIZZLE::PARENT >::type, " . $scalar . ", SWIZZLE, " . $operation . " >(" . $scalar . "(lhs), rhs); }\n";
+}
+
+return 1;
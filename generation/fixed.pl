@@ -0,0 +1,174 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# FIXED, a Q16.16 fixed-point component type whose arithmetic, square root, sine and cosine use integers alone
+
+sub PrintFixedType
+{
+	print "// Q16.16 fixed point. FIXED holds its value times 65536 in an int32_t (-32768 to 32767.99998 in steps of 2^-16) and\n";
+	print "// computes with integers alone, so the same inputs give the same bits on every compiler and platform, for lockstep\n";
+	print "// simulations. Results round to nearest and saturate at the ends of the range instead of wrapping; division by zero\n";
+	print "// saturates towards the sign of the numerator. sqrt() is an integer square root and sin() and cos() are CORDIC, accurate\n";
+	print "// to about one step\n";
+	print "inline int32_t FixedSaturate(const int64_t& raw) { return (raw > 0x7FFFFFFF) ? 0x7FFFFFFF : ((raw < -(int64_t)0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : (int32_t)raw); }\n";
+	print "\n";
+	print "// value / 2^shift rounded down, and rounded to nearest (halfway up), without shifting negative numbers\n";
+	print "inline int64_t FixedFloorShift(const int64_t& value, const unsigned& shift) { return (value >= 0) ? (value >> shift) : -((-value - 1) >> shift) - 1; }\n";
+	print "inline int64_t FixedRoundShift(const int64_t& value, const unsigned& shift) { return FixedFloorShift(value + ((int64_t)1 << (shift - 1)), shift); }\n";
+	print "\n";
+	print "inline int32_t FixedDivide(const int32_t& numerator, const int64_t& denominator)\n";
+	print "{\n";
+	print "\tif (denominator == 0) { return (numerator > 0) ? 0x7FFFFFFF : ((numerator < 0) ? -0x7FFFFFFF - 1 : 0); }\n";
+	print "\t// Magnitudes, rounded to nearest with halfway away from zero\n";
+	print "\tint64_t scaled = (int64_t)numerator * 65536;\n";
+	print "\tint64_t magnitude = (scaled < 0) ? -scaled : scaled;\n";
+	print "\tint64_t divisor = (denominator < 0) ? -(int64_t)denominator : (int64_t)denominator;\n";
+	print "\tint64_t quotient = (magnitude + divisor / 2) / divisor;\n";
+	print "\treturn FixedSaturate(((scaled < 0) != (denominator < 0)) ? -quotient : quotient);\n";
+	print "}\n";
+	print "\n";
+	print "// Digit by digit square root, rounded to nearest. Of raw * 65536 for FIXED, and of a sum of Q32.32 squares for lengths\n";
+	print "inline uint64_t FixedSqrt64(const uint64_t& value)\n";
+	print "{\n";
+	print "\tuint64_t remainder = value;\n";
+	print "\tuint64_t root = 0;\n";
+	print "\tuint64_t bit = (uint64_t)1 << 62;\n";
+	print "\twhile (bit > remainder) { bit >>= 2; }\n";
+	print "\twhile (bit != 0)\n";
+	print "\t{\n";
+	print "\t\tif (remainder >= root + bit)\n";
+	print "\t\t{\n";
+	print "\t\t\tremainder -= root + bit;\n";
+	print "\t\t\troot = (root >> 1) + bit;\n";
+	print "\t\t}\n";
+	print "\t\telse\n";
+	print "\t\t{\n";
+	print "\t\t\troot >>= 1;\n";
+	print "\t\t}\n";
+	print "\t\tbit >>= 2;\n";
+	print "\t}\n";
+	print "\treturn (remainder > root) ? root + 1 : root; // remainder is value - root^2, past halfway when above root\n";
+	print "}\n";
+	print "inline int32_t FixedSqrt(const int32_t& raw) { return (raw <= 0) ? 0 : (int32_t)FixedSqrt64((uint64_t)raw << 16); } // 0 for negative numbers\n";
+	print "\n";
+	print "// CORDIC in Q2.30: the angle is reduced to [-pi/2, pi/2] and rotated towards zero by atan(2^-i), i = 0 to 29, starting\n";
+	print "// from (K, 0) so the gain of the rotations is cancelled\n";
+	print "inline void FixedSinCos(const int32_t& radians, int32_t& sine, int32_t& cosine)\n";
+	print "{\n";
+	print "\tstatic const int32_t arctangents[30] = { 843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851, 8388437, 4194283, 2097149, 1048576, 524288, 262144, 131072, 65536, 32768, 16384, 8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8, 4, 2 };\n";
+	print "\tconst int64_t twoPi = ((int64_t)6 << 32) + 1216271633; // Q32 (C++98 has no 64-bit literals)\n";
+	print "\tconst int64_t halfPi = 1686629713; // Q30\n";
+	print "\tconst int64_t pi = halfPi * 2;\n";
+	print "\n";
+	print "\t// Into [-pi, pi) in Q32, then Q30\n";
+	print "\tint64_t reduced = ((int64_t)radians * 65536) % twoPi;\n";
+	print "\tif (reduced < 0) { reduced += twoPi; }\n";
+	print "\tif (reduced >= twoPi / 2) { reduced -= twoPi; }\n";
+	print "\tint64_t angle = FixedRoundShift(reduced, 2);\n";
+	print "\tint64_t cosineSign = 1;\n";
+	print "\tif (angle > halfPi) { angle = pi - angle; cosineSign = -1; }\n";
+	print "\telse if (angle < -halfPi) { angle = -pi - angle; cosineSign = -1; }\n";
+	print "\n";
+	print "\tint64_t x = 652032874; // K = 0.607252935 in Q30\n";
+	print "\tint64_t y = 0;\n";
+	print "\tfor (unsigned i = 0; i < 30; i++)\n";
+	print "\t{\n";
+	print "\t\tint64_t xStep = FixedFloorShift(x, i);\n";
+	print "\t\tint64_t yStep = FixedFloorShift(y, i);\n";
+	print "\t\tif (angle >= 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tx -= yStep;\n";
+	print "\t\t\ty += xStep;\n";
+	print "\t\t\tangle -= arctangents[i];\n";
+	print "\t\t}\n";
+	print "\t\telse\n";
+	print "\t\t{\n";
+	print "\t\t\tx += yStep;\n";
+	print "\t\t\ty -= xStep;\n";
+	print "\t\t\tangle += arctangents[i];\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\tsine = (int32_t)FixedRoundShift(y, 14);\n";
+	print "\tcosine = (int32_t)(cosineSign * FixedRoundShift(x, 14));\n";
+	print "}\n";
+	print "\n";
+	print "struct FIXED\n";
+	print "{\n";
+	print "\tint32_t raw;\n";
+	print "\n";
+	print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+	print "\tFIXED() = default;\n";
+	print "#else\n";
+	print "\tFIXED() {}\n";
+	print "#endif\n";
+	print "\tFIXED(const int& value) : raw(FixedSaturate((int64_t)value * 65536)) {}\n";
+	print "\tFIXED(const unsigned& value) : raw(FixedSaturate((int64_t)value * 65536)) {}\n";
+	print "\tFIXED(const float& value) : raw(RawFromDouble(value)) {}\n";
+	print "\tFIXED(const double& value) : raw(RawFromDouble(value)) {}\n";
+	print "\tstatic FIXED FromRaw(const int32_t& raw) { FIXED fixed; fixed.raw = raw; return fixed; }\n";
+	print "\tdouble ToDouble() const { return raw / 65536.0; }\n";
+	print "\tfloat ToFloat() const { return (float)ToDouble(); }\n";
+	print "\n";
+	print "\t// Rounded to nearest with halfway away from zero, saturated, and 0 for NaN. Multiplying by 65536 is exact\n";
+	print "\tstatic int32_t RawFromDouble(const double& value)\n";
+	print "\t{\n";
+	print "\t\tdouble scaled = value * 65536.0;\n";
+	print "\t\tif (scaled != scaled) { return 0; }\n";
+	print "\t\tif (scaled >= 2147483647.0) { return 0x7FFFFFFF; }\n";
+	print "\t\tif (scaled <= -2147483648.0) { return -0x7FFFFFFF - 1; }\n";
+	print "\t\treturn (int32_t)((scaled >= 0) ? floor(scaled + 0.5) : ceil(scaled - 0.5));\n";
+	print "\t}\n";
+	print "\n";
+	print "\tfriend FIXED operator+(const FIXED& lhs, const FIXED& rhs) { return FromRaw(FixedSaturate((int64_t)lhs.raw + rhs.raw)); }\n";
+	print "\tfriend FIXED operator-(const FIXED& lhs, const FIXED& rhs) { return FromRaw(FixedSaturate((int64_t)lhs.raw - rhs.raw)); }\n";
+	print "\tfriend FIXED operator*(const FIXED& lhs, const FIXED& rhs) { return FromRaw(FixedSaturate(FixedRoundShift((int64_t)lhs.raw * rhs.raw, 16))); }\n";
+	print "\tfriend FIXED operator/(const FIXED& lhs, const FIXED& rhs) { return FromRaw(FixedDivide(lhs.raw, rhs.raw)); }\n";
+	print "\tfriend FIXED operator-(const FIXED& value) { return FromRaw(FixedSaturate(-(int64_t)value.raw)); }\n";
+	print "\tconst FIXED& operator+=(const FIXED& rhs) { return *this = *this + rhs; }\n";
+	print "\tconst FIXED& operator-=(const FIXED& rhs) { return *this = *this - rhs; }\n";
+	print "\tconst FIXED& operator*=(const FIXED& rhs) { return *this = *this * rhs; }\n";
+	print "\tconst FIXED& operator/=(const FIXED& rhs) { return *this = *this / rhs; }\n";
+	print "\n";
+	print "\tfriend bool operator==(const FIXED& lhs, const FIXED& rhs) { return lhs.raw == rhs.raw; }\n";
+	print "\tfriend bool operator!=(const FIXED& lhs, const FIXED& rhs) { return lhs.raw != rhs.raw; }\n";
+	print "\tfriend bool operator<(const FIXED& lhs, const FIXED& rhs) { return lhs.raw < rhs.raw; }\n";
+	print "\tfriend bool operator>(const FIXED& lhs, const FIXED& rhs) { return lhs.raw > rhs.raw; }\n";
+	print "\tfriend bool operator<=(const FIXED& lhs, const FIXED& rhs) { return lhs.raw <= rhs.raw; }\n";
+	print "\tfriend bool operator>=(const FIXED& lhs, const FIXED& rhs) { return lhs.raw >= rhs.raw; }\n";
+	print "\n";
+	print "\t// The <math.h> functions the vector functions call, found through FIXED arguments only\n";
+	print "\tfriend FIXED fabs(const FIXED& value) { return (value.raw < 0) ? -value : value; }\n";
+	print "\tfriend FIXED floor(const FIXED& value) { return FromRaw((int32_t)(FixedFloorShift(value.raw, 16) * 65536)); }\n";
+	print "\tfriend FIXED ceil(const FIXED& value) { return FromRaw(FixedSaturate(-FixedFloorShift(-(int64_t)value.raw, 16) * 65536)); }\n";
+	print "\tfriend FIXED sqrt(const FIXED& value) { return FromRaw(FixedSqrt(value.raw)); }\n";
+	print "\tfriend FIXED sin(const FIXED& radians) { int32_t sine, cosine; FixedSinCos(radians.raw, sine, cosine); return FromRaw(sine); }\n";
+	print "\tfriend FIXED cos(const FIXED& radians) { int32_t sine, cosine; FixedSinCos(radians.raw, sine, cosine); return FromRaw(cosine); }\n";
+	print "};\n";
+	print "\n";
+	print "// .Length, Normalize() and Distance() of fixed-point vectors: the squares of the raw values are Q32.32, summed in 64 bits\n";
+	print "// and rooted back to Q16.16, so only lengths past the range of FIXED saturate (Dot() and DistanceSquared() past 181 do)\n";
+	print "inline uint64_t FixedSquare(const FIXED& value) { return (uint64_t)((int64_t)value.raw * value.raw); }\n";
+	print "inline FIXED PrecisionLength(const FIXED& x, const FIXED& y) { return FIXED::FromRaw(FixedSaturate((int64_t)FixedSqrt64(FixedSquare(x) + FixedSquare(y)))); }\n";
+	print "inline FIXED PrecisionLength(const FIXED& x, const FIXED& y, const FIXED& z) { return FIXED::FromRaw(FixedSaturate((int64_t)FixedSqrt64(FixedSquare(x) + FixedSquare(y) + FixedSquare(z)))); }\n";
+	print "inline FIXED PrecisionDivideByLength(const FIXED& numerator, const FIXED& x, const FIXED& y) { return FIXED::FromRaw(FixedDivide(numerator.raw, (int64_t)FixedSqrt64(FixedSquare(x) + FixedSquare(y)))); }\n";
+	print "inline FIXED PrecisionDivideByLength(const FIXED& numerator, const FIXED& x, const FIXED& y, const FIXED& z) { return FIXED::FromRaw(FixedDivide(numerator.raw, (int64_t)FixedSqrt64(FixedSquare(x) + FixedSquare(y) + FixedSquare(z)))); }\n";
+	print "\n";
+	print "// Fixed-point vectors keep fixed-point lengths, dot products and scalars; AlmostEqual() allows one step of difference\n";
+	print "template <> struct ScalarType<FIXED>\n";
+	print "{\n";
+	print "\ttypedef FIXED type;\n";
+	print "\tstatic type Epsilon() { return FIXED::FromRaw(2); }\n";
+	print "};\n";
+	print "\n";
+}
+
+# Printing fixed-point numbers (in svml_io.h)
+sub FixedToString
+{
+	print "// Fixed-point operator<<, as the double it holds\n";
+	print "inline ostream& operator<<(ostream& out, const FIXED& value) { return out << value.ToDouble(); }\n";
+	print "\n";
+}
+
+return 1;
@@ -0,0 +1,299 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Half-precision storage: the HALF and BFLOAT16 component types, and Convert() between arrays of them and of float
+# vectors (F16C, AVX-512 and SSE2 kernels with SVML_USE_SSE)
+
+%storageSimdGuard = ("HALF" => "defined(__F16C__)", "BFLOAT16" => "defined(__SSE2__)");
+%storageSimdPack = ("HALF" => "_mm_cvtps_ph(VALUE, _MM_FROUND_TO_NEAREST_INT)", "BFLOAT16" => "_mm_packs_epi32(SimdFloatToBfloat16(VALUE), _mm_setzero_si128())");
+%storageSimdUnpack = ("HALF" => "_mm_cvtph_ps(VALUE)", "BFLOAT16" => "_mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), VALUE))");
+
+sub PrintHalfTypes
+{
+	print "// Half-precision storage. HALF is an IEEE 754 binary16 (11 significant bits, up to 65504) and BFLOAT16 the upper half of\n";
+	print "// a float (8 significant bits, the range of a float). Both convert to and from float, rounding to nearest even, so\n";
+	print "// arithmetic on them happens in float and VECTOR3<HALF> is storage for 6 bytes\n";
+	print "inline unsigned FloatBits(const float& value) { unsigned bits; memcpy(&bits, &value, sizeof(bits)); return bits; }\n";
+	print "inline float BitsToFloat(const unsigned& bits) { float value; memcpy(&value, &bits, sizeof(value)); return value; }\n";
+	print "\n";
+	print "// NaNs keep their sign and top significand bits and become quiet, as F16C does\n";
+	print "inline unsigned short FloatToHalfBits(const float& value)\n";
+	print "{\n";
+	print "\tunsigned bits = FloatBits(value);\n";
+	print "\tunsigned sign = (bits >> 16) & 0x8000;\n";
+	print "\tunsigned magnitude = bits & 0x7FFFFFFF;\n";
+	print "\tif (magnitude >= 0x7F800000) { return (unsigned short)(sign | 0x7C00 | ((magnitude > 0x7F800000) ? (0x200 | ((magnitude >> 13) & 0x3FF)) : 0)); }\n";
+	print "\tif (magnitude >= 0x477FF000) { return (unsigned short)(sign | 0x7C00); } // 65520 and above round to infinity\n";
+	print "\tif (magnitude < 0x38800000)\n";
+	print "\t{\n";
+	print "\t\t// Subnormal: the significand in units of 2^-24, rounded to nearest even\n";
+	print "\t\tunsigned exponent = magnitude >> 23;\n";
+	print "\t\tif (exponent < 102) { return (unsigned short)sign; }\n";
+	print "\t\tunsigned significand = (magnitude & 0x7FFFFF) | 0x800000;\n";
+	print "\t\tunsigned shift = 126 - exponent;\n";
+	print "\t\tunsigned result = significand >> shift;\n";
+	print "\t\tunsigned remainder = significand & ((1u << shift) - 1);\n";
+	print "\t\tunsigned halfway = 1u << (shift - 1);\n";
+	print "\t\tif (remainder > halfway || (remainder == halfway && (result & 1))) { result++; }\n";
+	print "\t\treturn (unsigned short)(sign | result);\n";
+	print "\t}\n";
+	print "\t// Rebias the exponent and round the 13 dropped bits (a carry correctly moves into the exponent)\n";
+	print "\tunsigned rebiased = magnitude - 0x38000000;\n";
+	print "\treturn (unsigned short)(sign | ((rebiased + 0xFFF + ((rebiased >> 13) & 1)) >> 13));\n";
+	print "}\n";
+	print "\n";
+	print "inline float HalfBitsToFloat(const unsigned short& bits)\n";
+	print "{\n";
+	print "\tunsigned sign = (unsigned)(bits & 0x8000) << 16;\n";
+	print "\tunsigned exponent = (bits >> 10) & 0x1F;\n";
+	print "\tunsigned significand = bits & 0x3FF;\n";
+	print "\tif (exponent == 0x1F) { return BitsToFloat(sign | 0x7F800000 | (significand << 13) | (significand ? 0x400000 : 0)); }\n";
+	print "\tif (exponent != 0) { return BitsToFloat(sign | ((exponent + 112) << 23) | (significand << 13)); }\n";
+	print "\tif (significand == 0) { return BitsToFloat(sign); }\n";
+	print "\t// Subnormal: normalize the significand\n";
+	print "\texponent = 113;\n";
+	print "\twhile (!(significand & 0x400))\n";
+	print "\t{\n";
+	print "\t\tsignificand <<= 1;\n";
+	print "\t\texponent--;\n";
+	print "\t}\n";
+	print "\treturn BitsToFloat(sign | (exponent << 23) | ((significand & 0x3FF) << 13));\n";
+	print "}\n";
+	print "\n";
+	print "inline unsigned short FloatToBfloat16Bits(const float& value)\n";
+	print "{\n";
+	print "\tunsigned bits = FloatBits(value);\n";
+	print "\tif ((bits & 0x7FFFFFFF) > 0x7F800000) { return (unsigned short)((bits >> 16) | 0x40); }\n";
+	print "\treturn (unsigned short)((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);\n";
+	print "}\n";
+	print "\n";
+	print "inline float Bfloat16BitsToFloat(const unsigned short& bits) { return BitsToFloat((unsigned)bits << 16); }\n";
+	print "\n";
+	print "struct HALF\n";
+	print "{\n";
+	print "\tunsigned short bits;\n";
+	print "\n";
+	print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+	print "\tHALF() = default;\n";
+	print "#else\n";
+	print "\tHALF() {}\n";
+	print "#endif\n";
+	print "\tHALF(const float& value) : bits(FloatToHalfBits(value)) {}\n";
+	print "\toperator float() const { return HalfBitsToFloat(bits); }\n";
+	print "\tstatic HALF FromBits(const unsigned short& bits) { HALF half; half.bits = bits; return half; }\n";
+	print "\n";
+	print "\tconst HALF& operator+=(const float& rhs) { return *this = HALF((float)*this + rhs); }\n";
+	print "\tconst HALF& operator-=(const float& rhs) { return *this = HALF((float)*this - rhs); }\n";
+	print "\tconst HALF& operator*=(const float& rhs) { return *this = HALF((float)*this * rhs); }\n";
+	print "\tconst HALF& operator/=(const float& rhs) { return *this = HALF((float)*this / rhs); }\n";
+	print "};\n";
+	print "\n";
+	print "struct BFLOAT16\n";
+	print "{\n";
+	print "\tunsigned short bits;\n";
+	print "\n";
+	print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+	print "\tBFLOAT16() = default;\n";
+	print "#else\n";
+	print "\tBFLOAT16() {}\n";
+	print "#endif\n";
+	print "\tBFLOAT16(const float& value) : bits(FloatToBfloat16Bits(value)) {}\n";
+	print "\toperator float() const { return Bfloat16BitsToFloat(bits); }\n";
+	print "\tstatic BFLOAT16 FromBits(const unsigned short& bits) { BFLOAT16 bfloat; bfloat.bits = bits; return bfloat; }\n";
+	print "\n";
+	print "\tconst BFLOAT16& operator+=(const float& rhs) { return *this = BFLOAT16((float)*this + rhs); }\n";
+	print "\tconst BFLOAT16& operator-=(const float& rhs) { return *this = BFLOAT16((float)*this - rhs); }\n";
+	print "\tconst BFLOAT16& operator*=(const float& rhs) { return *this = BFLOAT16((float)*this * rhs); }\n";
+	print "\tconst BFLOAT16& operator/=(const float& rhs) { return *this = BFLOAT16((float)*this / rhs); }\n";
+	print "};\n";
+	print "\n";
+	print "// The type arithmetic on TYPE widens to: float for HALF and BFLOAT16, so their single-component swizzles and\n";
+	print "// lengths convert to float in one step, and a type nothing converts to for every other TYPE\n";
+	print "template <typename TYPE> struct WidenedType { struct NONE {}; typedef NONE type; };\n";
+	print "template <> struct WidenedType<HALF> { typedef float type; };\n";
+	print "template <> struct WidenedType<BFLOAT16> { typedef float type; };\n";
+	print "\n";
+	print "// Vectors of HALF and BFLOAT16 take and return float scalars\n";
+	print "template <> struct ScalarType<HALF> { typedef float type; static type Epsilon() { return COMPARISON_EPSILON; } };\n";
+	print "template <> struct ScalarType<BFLOAT16> { typedef float type; static type Epsilon() { return COMPARISON_EPSILON; } };\n";
+	print "\n";
+}
+
+sub PrintHalfConversionUtilities
+{
+	print "// ConvertComponents(): count floats to or from half-precision storage. With SVML_USE_SSE, F16C converts 8 halves per\n";
+	print "// instruction and AVX-512 16, and SSE2 converts bfloat16s 8 at a time\n";
+	print "#if defined(SVML_USE_SSE) && defined(__SSE2__)\n";
+	print "// Rounds four floats to bfloat16 like FloatToBfloat16Bits(), sign-extended in each lane so _mm_packs_epi32() keeps all 16 bits\n";
+	print "inline __m128i SimdFloatToBfloat16(const __m128& value)\n";
+	print "{\n";
+	print "\t__m128i bits = _mm_castps_si128(value);\n";
+	print "\t__m128i kept = _mm_srli_epi32(bits, 16);\n";
+	print "\t__m128i rounded = _mm_srli_epi32(_mm_add_epi32(bits, _mm_add_epi32(_mm_and_si128(kept, _mm_set1_epi32(1)), _mm_set1_epi32(0x7FFF))), 16);\n";
+	print "\t__m128i nan = _mm_cmpgt_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));\n";
+	print "\t__m128i result = _mm_or_si128(_mm_and_si128(nan, _mm_or_si128(kept, _mm_set1_epi32(0x40))), _mm_andnot_si128(nan, rounded));\n";
+	print "\treturn _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);\n";
+	print "}\n";
+	print "#endif\n";
+	print "\n";
+	print "inline void ConvertComponents(HALF* out, const float* in, const size_t& count)\n";
+	print "{\n";
+	print "\tsize_t i = 0;\n";
+	print "#if defined(SVML_USE_SSE) && defined(__AVX512F__)\n";
+	print "\t// The zero-masked forms, as the unmasked ones trip GCC's uninitialized warnings\n";
+	print "\tfor (; i + 16 <= count; i += 16)\n";
+	print "\t{\n";
+	print "\t\t_mm256_storeu_si256((__m256i*)(out + i), _mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));\n";
+	print "\t}\n";
+	print "#endif\n";
+	print "#if defined(SVML_USE_SSE) && defined(__F16C__)\n";
+	print "\tfor (; i + 8 <= count; i += 8)\n";
+	print "\t{\n";
+	print "\t\t_mm_storeu_si128((__m128i*)(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));\n";
+	print "\t}\n";
+	print "#endif\n";
+	print "\tfor (; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = HALF(in[i]);\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+	print "inline void ConvertComponents(float* out, const HALF* in, const size_t& count)\n";
+	print "{\n";
+	print "\tsize_t i = 0;\n";
+	print "#if defined(SVML_USE_SSE) && defined(__AVX512F__)\n";
+	print "\tfor (; i + 16 <= count; i += 16)\n";
+	print "\t{\n";
+	print "\t\t_mm512_storeu_ps(out + i, _mm512_maskz_cvtph_ps(0xFFFF, _mm256_loadu_si256((const __m256i*)(in + i))));\n";
+	print "\t}\n";
+	print "#endif\n";
+	print "#if defined(SVML_USE_SSE) && defined(__F16C__)\n";
+	print "\tfor (; i + 8 <= count; i += 8)\n";
+	print "\t{\n";
+	print "\t\t_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(in + i))));\n";
+	print "\t}\n";
+	print "#endif\n";
+	print "\tfor (; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = in[i];\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+	print "inline void ConvertComponents(BFLOAT16* out, const float* in, const size_t& count)\n";
+	print "{\n";
+	print "\tsize_t i = 0;\n";
+	print "#if defined(SVML_USE_SSE) && defined(__SSE2__)\n";
+	print "\tfor (; i + 8 <= count; i += 8)\n";
+	print "\t{\n";
+	print "\t\t_mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(SimdFloatToBfloat16(_mm_loadu_ps(in + i)), SimdFloatToBfloat16(_mm_loadu_ps(in + i + 4))));\n";
+	print "\t}\n";
+	print "#endif\n";
+	print "\tfor (; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = BFLOAT16(in[i]);\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+	print "inline void ConvertComponents(float* out, const BFLOAT16* in, const size_t& count)\n";
+	print "{\n";
+	print "\tsize_t i = 0;\n";
+	print "#if defined(SVML_USE_SSE) && defined(__SSE2__)\n";
+	print "\tfor (; i + 8 <= count; i += 8)\n";
+	print "\t{\n";
+	print "\t\t__m128i packed = _mm_loadu_si128((const __m128i*)(in + i));\n";
+	print "\t\t_mm_storeu_ps(out + i, _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), packed)));\n";
+	print "\t\t_mm_storeu_ps(out + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), packed)));\n";
+	print "\t}\n";
+	print "#endif\n";
+	print "\tfor (; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = in[i];\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+}
+
+# A pack or unpack expression of %storageSimdPack or %storageSimdUnpack applied to value
+sub StorageSimd
+{
+	my($expression, $value) = @_;
+
+	$expression =~ s/VALUE/$value/;
+	return $expression;
+}
+
+sub HalfConversions
+{
+	my($dimension) = @_;
+
+	$vector = "VECTOR" . $dimension;
+
+	print "// " . $dimension . "D Convert(): count vectors from one component type to another, such as to and from half-precision storage\n";
+	print "template <typename TYPE, typename OTHER> void Convert(" . $vector . "<TYPE>* out, const " . $vector . "<OTHER>* in, const unsigned& count)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = " . $vector . "<TYPE>(in[i]);\n";
+	print "\t}\n";
+	print "}\n";
+
+	foreach $storage ("HALF", "BFLOAT16")
+	{
+		if ($dimension != 3)
+		{
+			print "inline void Convert(" . $vector . "<" . $storage . ">* out, const " . $vector . "<float>* in, const unsigned& count) { ConvertComponents((" . $storage . "*)out, (const float*)in, (size_t)count * " . $dimension . "); }\n";
+			print "inline void Convert(" . $vector . "<float>* out, const " . $vector . "<" . $storage . ">* in, const unsigned& count) { ConvertComponents((float*)out, (const " . $storage . "*)in, (size_t)count * " . $dimension . "); }\n";
+			next;
+		}
+
+		# With SVML_USE_SSE, VECTOR3<float> has an unused fourth lane, so the components are not contiguous
+		$pack = $storageSimdPack{$storage};
+		$unpack = $storageSimdUnpack{$storage};
+		print "inline void Convert(" . $vector . "<" . $storage . ">* out, const " . $vector . "<float>* in, const unsigned& count)\n";
+		print "{\n";
+		print "#if !defined(SVML_USE_SSE)\n";
+		print "\tConvertComponents((" . $storage . "*)out, (const float*)in, (size_t)count * 3);\n";
+		print "#elif " . $storageSimdGuard{$storage} . "\n";
+		print "\t// Each store also writes the next vector's x, which the next store replaces\n";
+		print "\tfor (unsigned i = 0; i + 1 < count; i++)\n";
+		print "\t{\n";
+		print "\t\t_mm_storel_epi64((__m128i*)(out + i), " . StorageSimd($pack, "in[i].Simd()") . ");\n";
+		print "\t}\n";
+		print "\tif (count > 0)\n";
+		print "\t{\n";
+		print "\t\t" . $storage . " last[4];\n";
+		print "\t\t_mm_storel_epi64((__m128i*)last, " . StorageSimd($pack, "in[count - 1].Simd()") . ");\n";
+		print "\t\tmemcpy(out + count - 1, last, sizeof(" . $vector . "<" . $storage . ">));\n";
+		print "\t}\n";
+		print "#else\n";
+		print "\tConvert<" . $storage . ", float>(out, in, count);\n";
+		print "#endif\n";
+		print "}\n";
+		print "inline void Convert(" . $vector . "<float>* out, const " . $vector . "<" . $storage . ">* in, const unsigned& count)\n";
+		print "{\n";
+		print "#if !defined(SVML_USE_SSE)\n";
+		print "\tConvertComponents((float*)out, (const " . $storage . "*)in, (size_t)count * 3);\n";
+		print "#elif " . $storageSimdGuard{$storage} . "\n";
+		print "\t// Each load also reads the next vector's x, which the mask clears (w is 0, as the constructors leave it)\n";
+		print "\t__m128 xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));\n";
+		print "\tfor (unsigned i = 0; i + 1 < count; i++)\n";
+		print "\t{\n";
+		print "\t\tout[i] = " . $vector . "<float>(_mm_and_ps(" . StorageSimd($unpack, "_mm_loadl_epi64((const __m128i*)(in + i))") . ", xyz));\n";
+		print "\t}\n";
+		print "\tif (count > 0)\n";
+		print "\t{\n";
+		print "\t\t" . $storage . " last[4];\n";
+		print "\t\tmemcpy(last, in + count - 1, sizeof(" . $vector . "<" . $storage . ">));\n";
+		print "\t\tlast[3] = " . $storage . "::FromBits(0);\n";
+		print "\t\tout[count - 1] = " . $vector . "<float>(_mm_and_ps(" . StorageSimd($unpack, "_mm_loadl_epi64((const __m128i*)last)") . ", xyz));\n";
+		print "\t}\n";
+		print "#else\n";
+		print "\tConvert<float, " . $storage . ">(out, in, count);\n";
+		print "#endif\n";
+		print "}\n";
+	}
+	print "\n";
+}
+
+return 1;
@@ -0,0 +1,375 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# HASH_GRID2 and HASH_GRID3, uniform grids of points for radius and k-nearest queries. A point's cell is
+# Floor(point / cellSize), hashed into a power-of-two number of buckets, and the buckets are laid out by counting sort:
+# one array of bucket offsets and one of point indices, so a query reads each bucket's indices contiguously
+
+sub PrintHashGridUtilities
+{
+	print "// Hash of a grid cell (the three primes of Teschner et al., then a final mix so the low bits depend on every coordinate)\n";
+	print "inline unsigned HashGridMix(unsigned hash)\n";
+	print "{\n";
+	print "\thash ^= hash >> 16;\n";
+	print "\thash *= 0x85EBCA6Bu;\n";
+	print "\treturn hash ^ (hash >> 13);\n";
+	print "}\n";
+	print "inline unsigned HashCell(const VECTOR2<int>& cell) { return HashGridMix(((unsigned)cell.Component(0) * 73856093u) ^ ((unsigned)cell.Component(1) * 19349663u)); }\n";
+	print "inline unsigned HashCell(const VECTOR3<int>& cell) { return HashGridMix(((unsigned)cell.Component(0) * 73856093u) ^ ((unsigned)cell.Component(1) * 19349663u) ^ ((unsigned)cell.Component(2) * 83492791u)); }\n";
+	print "\n";
+	print "// Cells are clamped to +-2^28, so differences of cells, and cells plus or minus the rings QueryNearest() visits, fit in an\n";
+	print "// int. Clamping keeps cells in order, so points and queries past it share the outermost cells and the results stay exact\n";
+	print "const int HASH_GRID_CELL_LIMIT = 1 << 28;\n";
+	print "\n";
+	print "// Adds candidate (squared distance, index) to nearest, a max-heap of the k nearest so far\n";
+	print "template <typename DISTANCE> void KeepNearest(std::vector< std::pair<DISTANCE, unsigned> >& nearest, const unsigned& k, const std::pair<DISTANCE, unsigned>& candidate)\n";
+	print "{\n";
+	print "\tif (nearest.size() < k)\n";
+	print "\t{\n";
+	print "\t\tnearest.push_back(candidate);\n";
+	print "\t\tstd::push_heap(nearest.begin(), nearest.end());\n";
+	print "\t}\n";
+	print "\telse if (candidate < nearest.front())\n";
+	print "\t{\n";
+	print "\t\tstd::pop_heap(nearest.begin(), nearest.end());\n";
+	print "\t\tnearest.back() = candidate;\n";
+	print "\t\tstd::push_heap(nearest.begin(), nearest.end());\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+	print "// Buckets for count points: a power of two, at least twice count so most hold one cell\n";
+	print "inline unsigned HashGridBuckets(const unsigned& count)\n";
+	print "{\n";
+	print "\tunsigned buckets = 16;\n";
+	print "\twhile (buckets < count * 2 && buckets < 0x80000000u)\n";
+	print "\t{\n";
+	print "\t\tbuckets *= 2;\n";
+	print "\t}\n";
+	print "\treturn buckets;\n";
+	print "}\n";
+	print "\n";
+}
+
+sub MakeHashGridType
+{
+	my($dimension) = @_;
+
+	my $type = "HASH_GRID" . $dimension;
+	my $vector = "VECTOR" . $dimension . "<TYPE>";
+	my $cell = "VECTOR" . $dimension . "<int>";
+	my @components = SoaComponents($dimension);
+	my @axes = (0 .. $dimension - 1);
+
+	print "// " . $dimension . "D grid of points. Insert(), Remove() and Move() keep the layout up to date: points inserted, or moved\n";
+	print "// to another bucket, wait in a short pending list that queries scan directly, and are filed into the buckets\n";
+	print "// by Rebuild() once the list grows. Indices from Build() and Insert() stay the same until the point is removed\n";
+	print "template <typename TYPE>\n";
+	print "class " . $type . "\n";
+	print "{\n";
+	print "public:\n";
+	print "\ttypedef " . $vector . " VECTOR;\n";
+	print "\ttypedef " . $cell . " CELL;\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\texplicit " . $type . "(const TYPE& cellSize) : cellSize(cellSize), live(0) { Rebuild(); }\n";
+	print "\t" . $type . "(const TYPE& cellSize, const VECTOR* points, const unsigned& count) : cellSize(cellSize) { Build(points, count); }\n";
+	print "\n";
+	print "\t// Replaces every point with points[0] to points[count - 1], which get indices 0 to count - 1\n";
+	print "\tvoid Build(const VECTOR* points, const unsigned& count)\n";
+	print "\t{\n";
+	print "\t\tthis->points.assign(points, points + count);\n";
+	print "\t\tcells.resize(count);\n";
+	print "\t\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tcells[i] = CellOf(points[i]);\n";
+	print "\t\t}\n";
+	print "\t\tfiled.assign(count, PENDING);\n";
+	print "\t\tfreeIndices.clear();\n";
+	print "\t\tlive = count;\n";
+	print "\t\tRebuild();\n";
+	print "\t}\n";
+	print "\n";
+	print "#ifdef SVML_USE_THREADS\n";
+	print "\t// Build() on a pool: the same layout, bucket by bucket, as the serial one\n";
+	print "\tvoid Build(const Bulk::SPAN<const VECTOR>& points, const size_t& grain = Bulk::DEFAULT_GRAIN, Bulk::WORK_POOL& pool = Bulk::DefaultPool())\n";
+	print "\t{\n";
+	print "\t\tunsigned count = (unsigned)points.count;\n";
+	print "\t\tthis->points.resize(count);\n";
+	print "\t\tcells.resize(count);\n";
+	print "\t\tfiled.resize(count);\n";
+	print "\t\tfreeIndices.clear();\n";
+	print "\t\tpending.clear();\n";
+	print "\t\tlive = count;\n";
+	print "\t\tunsigned buckets = HashGridBuckets(count);\n";
+	print "\t\tbucketMask = buckets - 1;\n";
+	print "\n";
+	print "\t\t// Bucket sizes, counted concurrently\n";
+	print "\t\tstd::vector< std::atomic<unsigned> > next(buckets);\n";
+	print "\t\tBulk::ParallelFor(count, [&](size_t begin, size_t end)\n";
+	print "\t\t{\n";
+	print "\t\t\tfor (size_t i = begin; i < end; i++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tthis->points[i] = points[i];\n";
+	print "\t\t\t\tcells[i] = CellOf(points[i]);\n";
+	print "\t\t\t\tfiled[i] = Bucket(cells[i]);\n";
+	print "\t\t\t\tnext[filed[i]].fetch_add(1, std::memory_order_relaxed);\n";
+	print "\t\t\t}\n";
+	print "\t\t}, grain, pool);\n";
+	print "\t\tbounds = Bulk::ReduceChunks(count, AABB" . $dimension . "<int>::Empty(), [&](size_t begin, size_t end) { return Fit(&cells[begin], (unsigned)(end - begin)); },\n";
+	print "\t\t                            [](const AABB" . $dimension . "<int>& a, const AABB" . $dimension . "<int>& b) { return Union(a, b); }, grain, pool);\n";
+	print "\n";
+	print "\t\toffsets.resize(buckets + 1);\n";
+	print "\t\toffsets[0] = 0;\n";
+	print "\t\tfor (unsigned bucket = 0; bucket < buckets; bucket++)\n";
+	print "\t\t{\n";
+	print "\t\t\toffsets[bucket + 1] = offsets[bucket] + next[bucket].load(std::memory_order_relaxed);\n";
+	print "\t\t\tnext[bucket].store(offsets[bucket], std::memory_order_relaxed);\n";
+	print "\t\t}\n";
+	print "\n";
+	print "\t\t// Scattered in any order, then each bucket sorted by index as the serial counting sort leaves it\n";
+	print "\t\tindices.resize(count);\n";
+	print "\t\tBulk::ParallelFor(count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { indices[next[filed[i]].fetch_add(1, std::memory_order_relaxed)] = (unsigned)i; } }, grain, pool);\n";
+	print "\t\tBulk::ParallelFor(buckets, [&](size_t begin, size_t end) { for (size_t bucket = begin; bucket < end; bucket++) { std::sort(indices.begin() + offsets[bucket], indices.begin() + offsets[bucket + 1]); } }, grain, pool);\n";
+	print "\t}\n";
+	print "#endif\n";
+	print "\n";
+	print "\t// Adds a point and returns its index (one freed by Remove(), if there is any)\n";
+	print "\tunsigned Insert(const VECTOR& point)\n";
+	print "\t{\n";
+	print "\t\tunsigned index;\n";
+	print "\t\tif (freeIndices.empty())\n";
+	print "\t\t{\n";
+	print "\t\t\tindex = (unsigned)points.size();\n";
+	print "\t\t\tpoints.push_back(point);\n";
+	print "\t\t\tcells.push_back(CellOf(point));\n";
+	print "\t\t\tfiled.push_back(PENDING);\n";
+	print "\t\t}\n";
+	print "\t\telse\n";
+	print "\t\t{\n";
+	print "\t\t\tindex = freeIndices.back();\n";
+	print "\t\t\tfreeIndices.pop_back();\n";
+	print "\t\t\tpoints[index] = point;\n";
+	print "\t\t\tcells[index] = CellOf(point);\n";
+	print "\t\t\tfiled[index] = PENDING;\n";
+	print "\t\t}\n";
+	print "\t\tlive++;\n";
+	print "\t\tbounds = Union(bounds, cells[index]);\n";
+	print "\t\tAddPending(index);\n";
+	print "\t\treturn index;\n";
+	print "\t}\n";
+	print "\n";
+	print "\tvoid Remove(const unsigned& index)\n";
+	print "\t{\n";
+	print "\t\tif (filed[index] == PENDING)\n";
+	print "\t\t{\n";
+	print "\t\t\t*std::find(pending.begin(), pending.end(), index) = pending.back();\n";
+	print "\t\t\tpending.pop_back();\n";
+	print "\t\t}\n";
+	print "\t\tfiled[index] = REMOVED;\n";
+	print "\t\tfreeIndices.push_back(index);\n";
+	print "\t\tlive--;\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// A point moved within its bucket stays filed there\n";
+	print "\tvoid Move(const unsigned& index, const VECTOR& point)\n";
+	print "\t{\n";
+	print "\t\tpoints[index] = point;\n";
+	print "\t\tcells[index] = CellOf(point);\n";
+	print "\t\tbounds = Union(bounds, cells[index]);\n";
+	print "\t\tif (filed[index] != PENDING && filed[index] != Bucket(cells[index]))\n";
+	print "\t\t{\n";
+	print "\t\t\tfiled[index] = PENDING;\n";
+	print "\t\t\tAddPending(index);\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Files the pending points, with buckets for the points there are now (Insert() and Move() call it as the list grows)\n";
+	print "\tvoid Rebuild()\n";
+	print "\t{\n";
+	print "\t\tunsigned buckets = HashGridBuckets(live);\n";
+	print "\t\tbucketMask = buckets - 1;\n";
+	print "\t\toffsets.assign(buckets + 1, 0);\n";
+	print "\t\tbounds = AABB" . $dimension . "<int>::Empty();\n";
+	print "\t\tfor (unsigned i = 0; i < points.size(); i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tif (filed[i] != REMOVED)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tfiled[i] = Bucket(cells[i]);\n";
+	print "\t\t\t\toffsets[filed[i] + 1]++;\n";
+	print "\t\t\t\tbounds = Union(bounds, cells[i]);\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\tfor (unsigned bucket = 0; bucket < buckets; bucket++)\n";
+	print "\t\t{\n";
+	print "\t\t\toffsets[bucket + 1] += offsets[bucket];\n";
+	print "\t\t}\n";
+	print "\t\tstd::vector<unsigned> next(offsets.begin(), offsets.end() - 1);\n";
+	print "\t\tindices.resize(live);\n";
+	print "\t\tfor (unsigned i = 0; i < points.size(); i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tif (filed[i] != REMOVED)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tindices[next[filed[i]]++] = i;\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\tpending.clear();\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Element access\n";
+	print "\tunsigned Count() const { return live; }\n";
+	print "\tVECTOR Get(const unsigned& index) const { return points[index]; }\n";
+	print "\tTYPE CellSize() const { return cellSize; }\n";
+	print "\tCELL CellOf(const VECTOR& point) const { return CELL(Clamp(Floor(point / cellSize), (TYPE)-HASH_GRID_CELL_LIMIT, (TYPE)HASH_GRID_CELL_LIMIT)); }\n";
+	print "\n";
+	print "\t// Appends the indices of the points within radius of center (inclusive) to found, and returns how many there were\n";
+	print "\tunsigned QueryRadius(const VECTOR& center, const TYPE& radius, std::vector<unsigned>& found) const\n";
+	print "\t{\n";
+	print "\t\tsize_t before = found.size();\n";
+	print "\t\tTYPE radiusSquared = radius * radius;\n";
+	print "\t\tfor (unsigned p = 0; p < pending.size(); p++)\n";
+	print "\t\t{\n";
+	print "\t\t\tif (DistanceSquared(points[pending[p]], center) <= radiusSquared)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tfound.push_back(pending[p]);\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\tVECTOR reach(" . join(", ", map { "radius" } @axes) . ");\n";
+	print "\t\tCELL first = Max(CellOf(center - reach), bounds.minimum);\n";
+	print "\t\tCELL last = Min(CellOf(center + reach), bounds.maximum);\n";
+	my $indent = "\t\t";
+	foreach $axis (reverse @axes)
+	{
+		print $indent . "for (int " . $components[$axis] . " = first.Component(" . $axis . "); " . $components[$axis] . " <= last.Component(" . $axis . "); " . $components[$axis] . "++)\n";
+		print $indent . "{\n";
+		$indent .= "\t";
+	}
+	print $indent . "CELL cell(" . join(", ", @components) . ");\n";
+	print $indent . "unsigned bucket = Bucket(cell);\n";
+	print $indent . "for (unsigned k = offsets[bucket]; k < offsets[bucket + 1]; k++)\n";
+	print $indent . "{\n";
+	print $indent . "\tunsigned i = indices[k];\n";
+	print $indent . "\tif (Filed(i, bucket, cell) && DistanceSquared(points[i], center) <= radiusSquared)\n";
+	print $indent . "\t{\n";
+	print $indent . "\t\tfound.push_back(i);\n";
+	print $indent . "\t}\n";
+	print $indent . "}\n";
+	foreach $axis (@axes)
+	{
+		$indent = substr($indent, 1);
+		print $indent . "}\n";
+	}
+	print "\t\treturn (unsigned)(found.size() - before);\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Appends the indices of the k points nearest to center to found, nearest first (the lower index first among\n";
+	print "\t// equally near ones), and returns how many there were: k, or Count() if that is less. The search visits rings of\n";
+	print "\t// cells around center's until every point not yet seen must be farther than the k nearest found\n";
+	print "\tunsigned QueryNearest(const VECTOR& center, const unsigned& k, std::vector<unsigned>& found) const\n";
+	print "\t{\n";
+	print "\t\tif (k == 0 || live == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn 0;\n";
+	print "\t\t}\n";
+	print "\t\tstd::vector<CANDIDATE> nearest; // Max-heap of the nearest so far\n";
+	print "\t\tnearest.reserve(k + 1);\n";
+	print "\t\tfor (unsigned p = 0; p < pending.size(); p++)\n";
+	print "\t\t{\n";
+	print "\t\t\tKeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[pending[p]], center), pending[p]));\n";
+	print "\t\t}\n";
+	print "\n";
+	print "\t\t// Rings closer than the bounds are empty, and those past the farthest side of them as well\n";
+	print "\t\tCELL middle = CellOf(center);\n";
+	print "\t\tint64_t firstRing = 0, lastRing = 0;\n";
+	print "\t\tfor (unsigned axis = 0; axis < " . $dimension . "; axis++)\n";
+	print "\t\t{\n";
+	print "\t\t\tint64_t below = (int64_t)bounds.minimum.Component(axis) - middle.Component(axis);\n";
+	print "\t\t\tint64_t above = (int64_t)middle.Component(axis) - bounds.maximum.Component(axis);\n";
+	print "\t\t\tfirstRing = std::max(firstRing, std::max(below, above));\n";
+	print "\t\t\tlastRing = std::max(lastRing, std::max(-below, -above));\n";
+	print "\t\t}\n";
+	print "\t\tfor (int ring = (int)firstRing; ring <= (int)lastRing; ring++)\n";
+	print "\t\t{\n";
+	print "\t\t\t// Every point nearer than (ring - 1) cells to center has been seen\n";
+	print "\t\t\tTYPE seen = (TYPE)(ring - 1) * cellSize;\n";
+	print "\t\t\tif (ring > 0 && nearest.size() == k && nearest.front().first < seen * seen)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tbreak;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tCELL first = Max(middle - CELL(" . join(", ", map { "ring" } @axes) . "), bounds.minimum);\n";
+	print "\t\t\tCELL last = Min(middle + CELL(" . join(", ", map { "ring" } @axes) . "), bounds.maximum);\n";
+	$indent = "\t\t\t";
+	foreach $axis (reverse @axes[1 .. $dimension - 1])
+	{
+		print $indent . "for (int " . $components[$axis] . " = first.Component(" . $axis . "); " . $components[$axis] . " <= last.Component(" . $axis . "); " . $components[$axis] . "++)\n";
+		print $indent . "{\n";
+		$indent .= "\t";
+	}
+	print $indent . "// Whole rows on the faces of the ring, and the two ends of the rows inside it\n";
+	print $indent . "bool face = " . join(" || ", map { "abs(" . $components[$_] . " - middle.Component(" . $_ . ")) == ring" } @axes[1 .. $dimension - 1]) . ";\n";
+	print $indent . "int step = (face || ring == 0) ? 1 : 2 * ring;\n";
+	print $indent . "for (int x = face ? first.Component(0) : middle.Component(0) - ring; x <= last.Component(0); x += step)\n";
+	print $indent . "{\n";
+	print $indent . "\tif (x < first.Component(0))\n";
+	print $indent . "\t{\n";
+	print $indent . "\t\tcontinue;\n";
+	print $indent . "\t}\n";
+	print $indent . "\tCELL cell(" . join(", ", @components) . ");\n";
+	print $indent . "\tunsigned bucket = Bucket(cell);\n";
+	print $indent . "\tfor (unsigned n = offsets[bucket]; n < offsets[bucket + 1]; n++)\n";
+	print $indent . "\t{\n";
+	print $indent . "\t\tunsigned i = indices[n];\n";
+	print $indent . "\t\tif (Filed(i, bucket, cell))\n";
+	print $indent . "\t\t{\n";
+	print $indent . "\t\t\tKeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[i], center), i));\n";
+	print $indent . "\t\t}\n";
+	print $indent . "\t}\n";
+	print $indent . "}\n";
+	foreach $axis (@axes[1 .. $dimension - 1])
+	{
+		$indent = substr($indent, 1);
+		print $indent . "}\n";
+	}
+	print "\t\t}\n";
+	print "\t\tstd::sort_heap(nearest.begin(), nearest.end());\n";
+	print "\t\tfor (unsigned n = 0; n < nearest.size(); n++)\n";
+	print "\t\t{\n";
+	print "\t\t\tfound.push_back(nearest[n].second);\n";
+	print "\t\t}\n";
+	print "\t\treturn (unsigned)nearest.size();\n";
+	print "\t}\n";
+	print "\n";
+	print "private:\n";
+	print "\tenum { PENDING = 0xFFFFFFFFu, REMOVED = 0xFFFFFFFEu }; // filed[] of points outside the buckets\n";
+	print "\ttypedef std::pair<typename ScalarType<TYPE>::type, unsigned> CANDIDATE;\n";
+	print "\n";
+	print "\tunsigned Bucket(const CELL& cell) const { return HashCell(cell) & bucketMask; }\n";
+	print "\n";
+	print "\t// Whether the index found in bucket belongs to cell (other cells share buckets, and moved points leave stale indices)\n";
+	print "\tbool Filed(const unsigned& index, const unsigned& bucket, const CELL& cell) const { return filed[index] == bucket && cells[index] == cell; }\n";
+	print "\n";
+	print "\tvoid AddPending(const unsigned& index)\n";
+	print "\t{\n";
+	print "\t\tpending.push_back(index);\n";
+	print "\t\tif (pending.size() > 32 + live / 8)\n";
+	print "\t\t{\n";
+	print "\t\t\tRebuild();\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\tTYPE cellSize;\n";
+	print "\tunsigned live; // Points not removed\n";
+	print "\tunsigned bucketMask;\n";
+	print "\tAABB" . $dimension . "<int> bounds; // Of every point's cell, and of cells points have left since the last Rebuild()\n";
+	print "\tstd::vector<VECTOR> points; // By index\n";
+	print "\tstd::vector<CELL> cells; // By index\n";
+	print "\tstd::vector<unsigned> filed; // By index: the bucket whose indices list it, PENDING or REMOVED\n";
+	print "\tstd::vector<unsigned> offsets; // Bucket b's indices are indices[offsets[b]] to indices[offsets[b + 1] - 1]\n";
+	print "\tstd::vector<unsigned> indices;\n";
+	print "\tstd::vector<unsigned> pending; // Points no bucket lists yet\n";
+	print "\tstd::vector<unsigned> freeIndices; // Removed, for Insert() to reuse\n";
+	print "};\n";
+	print "\n";
+}
+
+return 1;
@@ -12,7 +12,7 @@ sub Max
 	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Max(const SWIZZLE0& a, const SWIZZLE1& b) { return Max(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
 	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return Max(typename SWIZZLE::PARENT(a), b); }\n";
 	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return Max(a, typename SWIZZLE::PARENT(b)); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> Max(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> Max(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -22,11 +22,13 @@ sub Max
 			{
 				print ", ";
 			}
-			print "max(a." . NumberToSwizzle($d) . ", b." . NumberToSwizzle($d) . ")";
+			print "max(" . ComponentOf("a", $d) . ", " . ComponentOf("b", $d) . ")";
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdMinMax($dimension, "Max", "_mm_max_ps");
 }
 
 sub Min
@@ -37,7 +39,7 @@ sub Min
 	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Min(const SWIZZLE0& a, const SWIZZLE1& b) { return Min(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
 	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return Min(typename SWIZZLE::PARENT(a), b); }\n";
 	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return Min(a, typename SWIZZLE::PARENT(b)); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> Min(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> Min(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -47,11 +49,13 @@ sub Min
 			{
 				print ", ";
 			}
-			print "min(a." . NumberToSwizzle($d) . ", b." . NumberToSwizzle($d) . ")";
+			print "min(" . ComponentOf("a", $d) . ", " . ComponentOf("b", $d) . ")";
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdMinMax($dimension, "Min", "_mm_min_ps");
 }
 
 sub ScalarMax
@@ -59,9 +63,9 @@ sub ScalarMax
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Max(): Scalar\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const SCALAR_TYPE& maximum) { return Max(typename SWIZZLE::PARENT(a), maximum); }\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SCALAR_TYPE& maximum, const SWIZZLE& b) { return Max(maximum, typename SWIZZLE::PARENT(b)); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> Max(const VECTOR" . $dimension . "<TYPE>& a, const SCALAR_TYPE& maximum)\n";
+	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum) { return Max(typename SWIZZLE::PARENT(a), maximum); }\n";
+	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum, const SWIZZLE& b) { return Max(maximum, typename SWIZZLE::PARENT(b)); }\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> Max(const VECTOR" . $dimension . "<TYPE>& a, const typename ScalarType<TYPE>::type& maximum)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -71,12 +75,12 @@ sub ScalarMax
 			{
 				print ", ";
 			}
-			print "max((SCALAR_TYPE)a." . NumberToSwizzle($d) . ", maximum)";
+			print "max((typename ScalarType<TYPE>::type)" . ComponentOf("a", $d) . ", maximum)";
 		}
 	
 	print ");\n";
 	print "}\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> Max(const SCALAR_TYPE& maximum, const VECTOR" . $dimension . "<TYPE>& b)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> Max(const typename ScalarType<TYPE>::type& maximum, const VECTOR" . $dimension . "<TYPE>& b)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -86,11 +90,13 @@ sub ScalarMax
 			{
 				print ", ";
 			}
-			print "max(maximum, (SCALAR_TYPE)b." . NumberToSwizzle($d) . ")";
+			print "max(maximum, (typename ScalarType<TYPE>::type)" . ComponentOf("b", $d) . ")";
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdScalarMinMax($dimension, "Max", "_mm_max_ps", "maximum");
 }
 
 sub ScalarMin
@@ -98,9 +104,9 @@ sub ScalarMin
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Min(): Scalar\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const SCALAR_TYPE& minimum) { return Min(typename SWIZZLE::PARENT(a), minimum); }\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SCALAR_TYPE& minimum, const SWIZZLE& b) { return Min(minimum, typename SWIZZLE::PARENT(b)); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> Min(const VECTOR" . $dimension . "<TYPE>& a, const SCALAR_TYPE& minimum)\n";
+	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum) { return Min(typename SWIZZLE::PARENT(a), minimum); }\n";
+	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum, const SWIZZLE& b) { return Min(minimum, typename SWIZZLE::PARENT(b)); }\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> Min(const VECTOR" . $dimension . "<TYPE>& a, const typename ScalarType<TYPE>::type& minimum)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -110,12 +116,12 @@ sub ScalarMin
 			{
 				print ", ";
 			}
-			print "min((SCALAR_TYPE)a." . NumberToSwizzle($d) . ", minimum)";
+			print "min((typename ScalarType<TYPE>::type)" . ComponentOf("a", $d) . ", minimum)";
 		}
 	
 	print ");\n";
 	print "}\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> Min(const SCALAR_TYPE& minimum, const VECTOR" . $dimension . "<TYPE>& b)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> Min(const typename ScalarType<TYPE>::type& minimum, const VECTOR" . $dimension . "<TYPE>& b)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -125,11 +131,13 @@ sub ScalarMin
 			{
 				print ", ";
 			}
-			print "min(minimum, (SCALAR_TYPE)b." . NumberToSwizzle($d) . ")";
+			print "min(minimum, (typename ScalarType<TYPE>::type)" . ComponentOf("b", $d) . ")";
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdScalarMinMax($dimension, "Min", "_mm_min_ps", "minimum");
 }
 
 sub Ceil
@@ -148,11 +156,13 @@ sub Ceil
 			{
 				print ", ";
 			}
-			print "ceil(toCeil." . NumberToSwizzle($d) . ")";
+			print "ceil(" . ComponentOf("toCeil", $d) . ")";
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdRound($dimension, "Ceil", "_mm_ceil_ps", "toCeil");
 }
 
 sub Floor
@@ -171,11 +181,13 @@ sub Floor
 			{
 				print ", ";
 			}
-			print "floor(toFloor." . NumberToSwizzle($d) . ")";
+			print "floor(" . ComponentOf("toFloor", $d) . ")";
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdRound($dimension, "Floor", "_mm_floor_ps", "toFloor");
 }
 
 return 1;
\ No newline at end of file
@@ -0,0 +1,304 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Matrix types (MATRIX2, MATRIX3, MATRIX4), stored as column vectors, and their functions
+
+sub MatrixElement
+{
+	my($matrix, $column, $row) = @_;
+
+	return $matrix . "[" . $column . "]." . NumberToSwizzle($row);
+}
+
+# Prints "TYPE a00 = m[0].x, a01 = m[0].y, ..." where aCR is column C, row R
+sub PrintMatrixElements
+{
+	my($dimension, $matrix, $prefix) = @_;
+
+	print "\tTYPE ";
+		for ($c = 0; $c < $dimension; $c++)
+		{
+			for ($r = 0; $r < $dimension; $r++)
+			{
+				if ($c > 0 || $r > 0)
+				{
+					print ", ";
+				}
+				print $prefix . $c . $r . " = " . MatrixElement($matrix, $c, $r);
+			}
+		}
+	print ";\n";
+}
+
+sub MakeMatrixType
+{
+	my($dimension) = @_;
+
+	$type = "MATRIX" . $dimension;
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+
+	print "template <typename TYPE>\n";
+	print "struct " . $type . "\n";
+	print "{\n";
+	print "private:\n";
+	print "\t" . $vector . " columns[" . $dimension . "];\n";
+	print "\n";
+	print "public:\n";
+
+	# Constructors
+	print "\t" . $type . "() {}\n";
+	print "\texplicit " . $type . "(const TYPE& diagonal) { ";
+		for ($c = 0; $c < $dimension; $c++)
+		{
+			print "columns[" . $c . "] = " . $vector . "(";
+			for ($r = 0; $r < $dimension; $r++)
+			{
+				if ($r > 0)
+				{
+					print ", ";
+				}
+				print (($r == $c) ? "diagonal" : "(TYPE)0");
+			}
+			print "); ";
+		}
+	print "}\n";
+	print "\t" . $type . "(" . join(", ", map { "const " . $vector . "& column" . $_ } (0 .. $dimension - 1)) . ") { ";
+		for ($c = 0; $c < $dimension; $c++)
+		{
+			print "columns[" . $c . "] = column" . $c . "; ";
+		}
+	print "}\n";
+	print "\n";
+	print "\tstatic " . $type . " Identity() { return " . $type . "((TYPE)1); }\n";
+	print "\n";
+
+	# Access
+	print "\t// Column access (m[column].row), and a copy of a row\n";
+	foreach $constness ("", "const ")
+	{
+		print "\t" . $constness . $vector . "& operator[](const unsigned& column)" . ($constness eq "" ? "" : " const") . "\n";
+		print "\t{\n";
+		print "\t\tif (column >= " . $dimension . ") { FatalError(\"Attempted out of bounds bracket access of " . $dimension . "x" . $dimension . " matrix.\", column); }\n";
+		print "\t\treturn columns[column];\n";
+		print "\t}\n";
+	}
+	print "\t" . $vector . " Row(const unsigned& row) const { return " . $vector . "(" . join(", ", map { "columns[" . $_ . "].Component(row)" } (0 .. $dimension - 1)) . "); }\n";
+	print "\n";
+
+	# Assignment operators
+	print "\t// Assignment operators (default for = is fine)\n";
+	foreach $operator ("+=", "-=")
+	{
+		print "\tconst " . $type . "& operator" . $operator . "(const " . $type . "& rhs) { ";
+			for ($c = 0; $c < $dimension; $c++)
+			{
+				print "columns[" . $c . "] " . $operator . " rhs.columns[" . $c . "]; ";
+			}
+		print "return *this; }\n";
+	}
+	print "\tconst " . $type . "& operator*=(const " . $type . "& rhs) { *this = *this * rhs; return *this; }\n";
+	print "\tconst " . $type . "& operator*=(const TYPE& rhs) { ";
+		for ($c = 0; $c < $dimension; $c++)
+		{
+			print "columns[" . $c . "] *= rhs; ";
+		}
+	print "return *this; }\n";
+	print "};\n\n";
+}
+
+sub MatrixToString
+{
+	my($dimension) = @_;
+
+	print "// " . $dimension . "x" . $dimension . " operator<< (one column at a time) and ToString()\n";
+	print "template <typename TYPE> ostream& operator<<(ostream& os, const MATRIX" . $dimension . "<TYPE>& printMatrix)\n";
+	print "{\n";
+	print "\tos << \"(\" << " . join(" << \", \" << ", map { "printMatrix[" . $_ . "]" } (0 .. $dimension - 1)) . " << \")\";\n";
+	print "\treturn os;\n";
+	print "}\n";
+	print "template <typename TYPE> string ToString(const MATRIX" . $dimension . "<TYPE>& printMatrix)\n";
+	print "{\n";
+	print "\tstd::ostringstream buffer;\n";
+	print "\tbuffer << printMatrix;\n";
+	print "\treturn buffer.str();\n";
+	print "}\n\n";
+}
+
+# Column-wise +, -, and scalar *
+sub MatrixArithmetic
+{
+	my($dimension) = @_;
+
+	$type = "MATRIX" . $dimension . "<TYPE>";
+
+	foreach $operator ("+", "-")
+	{
+		print "// " . $dimension . "x" . $dimension . " [" . $operator . "]\n";
+		print "template <typename TYPE> " . $type . " operator" . $operator . "(const " . $type . "& lhs, const " . $type . "& rhs) { return " . $type . "(" . join(", ", map { "lhs[" . $_ . "] " . $operator . " rhs[" . $_ . "]" } (0 .. $dimension - 1)) . "); }\n\n";
+	}
+
+	print "// " . $dimension . "x" . $dimension . " Multiplication [*]: Scalar\n";
+	print "template <typename TYPE> " . $type . " operator*(const " . $type . "& lhs, const typename ScalarType<TYPE>::type& rhs) { return " . $type . "(" . join(", ", map { "lhs[" . $_ . "] * rhs" } (0 .. $dimension - 1)) . "); }\n";
+	print "template <typename TYPE> " . $type . " operator*(const typename ScalarType<TYPE>::type& lhs, const " . $type . "& rhs) { return " . $type . "(" . join(", ", map { "lhs * rhs[" . $_ . "]" } (0 .. $dimension - 1)) . "); }\n\n";
+}
+
+# Matrix * vector (the vector may be any swizzle), and matrix * matrix one column at a time
+sub MatrixMultiplication
+{
+	my($dimension) = @_;
+
+	$type = "MATRIX" . $dimension . "<TYPE>";
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+
+	print "// " . $dimension . "x" . $dimension . " Multiplication [*]: Matrix-vector\n";
+	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const " . $type . "& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }\n";
+	print "template <typename TYPE> " . $vector . " operator*(const " . $type . "& lhs, const " . $vector . "& rhs)\n";
+	print "{\n";
+	print "\treturn " . $vector . "(";
+		for ($r = 0; $r < $dimension; $r++)
+		{
+			if ($r > 0)
+			{
+				print ",\n\t                     ";
+			}
+			print join(" + ", map { MatrixElement("lhs", $_, $r) . " * rhs." . NumberToSwizzle($_) } (0 .. $dimension - 1));
+		}
+	print ");\n";
+	print "}\n\n";
+
+	print "// " . $dimension . "x" . $dimension . " Multiplication [*]: Matrix-matrix\n";
+	print "template <typename TYPE> " . $type . " operator*(const " . $type . "& lhs, const " . $type . "& rhs) { return " . $type . "(" . join(", ", map { "lhs * rhs[" . $_ . "]" } (0 .. $dimension - 1)) . "); }\n\n";
+}
+
+sub MatrixComparisons
+{
+	my($dimension) = @_;
+
+	$type = "MATRIX" . $dimension . "<TYPE>";
+
+	print "// " . $dimension . "x" . $dimension . " Comparisons\n";
+	print "template <typename TYPE> bool operator==(const " . $type . "& lhs, const " . $type . "& rhs) { return " . join(" && ", map { "lhs[" . $_ . "] == rhs[" . $_ . "]" } (0 .. $dimension - 1)) . "; }\n";
+	print "template <typename TYPE> bool operator!=(const " . $type . "& lhs, const " . $type . "& rhs) { return !(lhs == rhs); }\n";
+	print "template <typename TYPE> bool AlmostEqual(const " . $type . "& lhs, const " . $type . "& rhs) { return " . join(" && ", map { "AlmostEqual(lhs[" . $_ . "], rhs[" . $_ . "])" } (0 .. $dimension - 1)) . "; }\n\n";
+}
+
+sub MatrixTranspose
+{
+	my($dimension) = @_;
+
+	$type = "MATRIX" . $dimension . "<TYPE>";
+
+	print "// " . $dimension . "x" . $dimension . " Transpose()\n";
+	print "template <typename TYPE> " . $type . " Transpose(const " . $type . "& m) { return " . $type . "(" . join(", ", map { "m.Row(" . $_ . ")" } (0 .. $dimension - 1)) . "); }\n\n";
+}
+
+# The 4x4 versions expand by 2x2 sub-determinants of the first two columns (s) and the last two (c)
+sub MatrixDeterminant
+{
+	my($dimension) = @_;
+
+	$type = "MATRIX" . $dimension . "<TYPE>";
+
+	print "// " . $dimension . "x" . $dimension . " Determinant()\n";
+	print "template <typename TYPE> TYPE Determinant(const " . $type . "& m)\n";
+	print "{\n";
+	PrintMatrixElements($dimension, "m", "a");
+	if ($dimension == 2)
+	{
+		print "\treturn a00 * a11 - a01 * a10;\n";
+	}
+	elsif ($dimension == 3)
+	{
+		print "\treturn a00 * (a11 * a22 - a12 * a21) - a01 * (a10 * a22 - a12 * a20) + a02 * (a10 * a21 - a11 * a20);\n";
+	}
+	else
+	{
+		PrintSubDeterminants4x4();
+		print "\treturn s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;\n";
+	}
+	print "}\n\n";
+}
+
+sub PrintSubDeterminants4x4
+{
+	print "\tTYPE s0 = a00 * a11 - a10 * a01;\n";
+	print "\tTYPE s1 = a00 * a12 - a10 * a02;\n";
+	print "\tTYPE s2 = a00 * a13 - a10 * a03;\n";
+	print "\tTYPE s3 = a01 * a12 - a11 * a02;\n";
+	print "\tTYPE s4 = a01 * a13 - a11 * a03;\n";
+	print "\tTYPE s5 = a02 * a13 - a12 * a03;\n";
+	print "\tTYPE c5 = a22 * a33 - a32 * a23;\n";
+	print "\tTYPE c4 = a21 * a33 - a31 * a23;\n";
+	print "\tTYPE c3 = a21 * a32 - a31 * a22;\n";
+	print "\tTYPE c2 = a20 * a33 - a30 * a23;\n";
+	print "\tTYPE c1 = a20 * a32 - a30 * a22;\n";
+	print "\tTYPE c0 = a20 * a31 - a30 * a21;\n";
+}
+
+# Adjugate divided by the determinant; a singular matrix gives infinite or NaN components
+sub MatrixInverse
+{
+	my($dimension) = @_;
+
+	$type = "MATRIX" . $dimension . "<TYPE>";
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+
+	print "// " . $dimension . "x" . $dimension . " Inverse()\n";
+	print "template <typename TYPE> " . $type . " Inverse(const " . $type . "& m)\n";
+	print "{\n";
+	PrintMatrixElements($dimension, "m", "a");
+	if ($dimension == 2)
+	{
+		print "\tTYPE i = 1 / (a00 * a11 - a01 * a10);\n";
+		print "\treturn " . $type . "(" . $vector . "(a11 * i, -a01 * i),\n";
+		print "\t                     " . $vector . "(-a10 * i, a00 * i));\n";
+	}
+	elsif ($dimension == 3)
+	{
+		print "\tTYPE b00 = a11 * a22 - a12 * a21;\n";
+		print "\tTYPE b10 = a12 * a20 - a10 * a22;\n";
+		print "\tTYPE b20 = a10 * a21 - a11 * a20;\n";
+		print "\tTYPE i = 1 / (a00 * b00 + a01 * b10 + a02 * b20);\n";
+		print "\treturn " . $type . "(" . $vector . "(b00 * i, (a02 * a21 - a01 * a22) * i, (a01 * a12 - a02 * a11) * i),\n";
+		print "\t                     " . $vector . "(b10 * i, (a00 * a22 - a02 * a20) * i, (a02 * a10 - a00 * a12) * i),\n";
+		print "\t                     " . $vector . "(b20 * i, (a01 * a20 - a00 * a21) * i, (a00 * a11 - a01 * a10) * i));\n";
+	}
+	else
+	{
+		PrintSubDeterminants4x4();
+		print "\tTYPE i = 1 / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);\n";
+		print "\treturn " . $type . "(" . $vector . "(( a11 * c5 - a12 * c4 + a13 * c3) * i, (-a01 * c5 + a02 * c4 - a03 * c3) * i, ( a31 * s5 - a32 * s4 + a33 * s3) * i, (-a21 * s5 + a22 * s4 - a23 * s3) * i),\n";
+		print "\t                     " . $vector . "((-a10 * c5 + a12 * c2 - a13 * c1) * i, ( a00 * c5 - a02 * c2 + a03 * c1) * i, (-a30 * s5 + a32 * s2 - a33 * s1) * i, ( a20 * s5 - a22 * s2 + a23 * s1) * i),\n";
+		print "\t                     " . $vector . "(( a10 * c4 - a11 * c2 + a13 * c0) * i, (-a00 * c4 + a01 * c2 - a03 * c0) * i, ( a30 * s4 - a31 * s2 + a33 * s0) * i, (-a20 * s4 + a21 * s2 - a23 * s0) * i),\n";
+		print "\t                     " . $vector . "((-a10 * c3 + a11 * c1 - a12 * c0) * i, ( a00 * c3 - a01 * c1 + a02 * c0) * i, (-a30 * s3 + a31 * s1 - a32 * s0) * i, ( a20 * s3 - a21 * s1 + a22 * s0) * i));\n";
+	}
+	print "}\n\n";
+}
+
+# Transforms many vectors by one matrix: an array of vectors, or a batch (whose kernel vectorizes)
+sub MatrixTransform
+{
+	my($dimension) = @_;
+
+	$type = "MATRIX" . $dimension . "<TYPE>";
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "x" . $dimension . " batch Transform(): out[i] = matrix * in[i], out may be in\n";
+	print "template <typename TYPE> void Transform(" . $vector . "* out, const " . $type . "& matrix, const " . $vector . "* in, const unsigned& count)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = matrix * in[i];\n";
+	print "\t}\n";
+	print "}\n";
+	print "template <typename OUT, typename A, typename TYPE> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A") . " Transform(const OUT& out, const " . $type . "& matrix, const A& a) { Transform(typename OUT::PARENT(out), matrix, typename A::PARENT(a)); }\n";
+	print "template <typename TYPE> void Transform(const " . $view . "& out, const " . $type . "& matrix, const " . $view . "& a)\n";
+	print "{\n";
+	PrintMatrixElements($dimension, "matrix", "m");
+	PrintSoaLoop("a.count", [SoaLoad("a", $dimension)], [map { $r = $_; ["out." . NumberToSwizzle($r), join(" + ", map { "m" . $_ . $r . " * a" . uc(NumberToSwizzle($_)) } (0 .. $dimension - 1))] } (0 .. $dimension - 1)]);
+	print "}\n\n";
+}
+
+return 1;
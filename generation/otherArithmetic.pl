@@ -9,9 +9,9 @@ sub Negate
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Negate [-]\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const SWIZZLE& toNegate)\n";
+	print "template <typename SWIZZLE> inline " . ExpressionReturnType($dimension, "SWIZZLE", "EXPRESSION_NONE", "EXPRESSION_NEGATE", "SWIZZLE") . " operator-(const SWIZZLE& toNegate)\n";
 	print "{\n";
-	print "\treturn -(typename SWIZZLE::PARENT(toNegate));\n";
+	print "\treturn EXPRESSION" . $dimension . "< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_NONE, EXPRESSION_NEGATE >(toNegate, EXPRESSION_NONE());\n";
 	print "}\n\n";
 }
 
@@ -20,9 +20,8 @@ sub ScalarMultiplication
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Multiplication [*]: Scalar\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SWIZZLE& lhs, const SCALAR_TYPE& rhs) { return typename SWIZZLE::PARENT(lhs) * rhs; }\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SCALAR_TYPE& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> operator*(const VECTOR" . $dimension . "<TYPE>& lhs, const SCALAR_TYPE& rhs)\n";
+	PrintExpressionScalarOperators($dimension, "*", "EXPRESSION_MULTIPLY");
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> operator*(const VECTOR" . $dimension . "<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -32,12 +31,12 @@ sub ScalarMultiplication
 			{
 				print ", ";
 			}
-			print "lhs." . NumberToSwizzle($d) . " * rhs";
+			print ComponentOf("lhs", $d) . " * rhs";
 		}
 	
 	print ");\n";
 	print "}\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> operator*(const SCALAR_TYPE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -47,11 +46,13 @@ sub ScalarMultiplication
 			{
 				print ", ";
 			}
-			print "lhs * rhs." . NumberToSwizzle($d);
+			print "lhs * " . ComponentOf("rhs", $d);
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdScalarOperator($dimension, "*", "_mm_mul_ps");
 }
 
 sub ScalarDivision
@@ -59,9 +60,8 @@ sub ScalarDivision
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Division [/]: Scalar\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SWIZZLE& lhs, const SCALAR_TYPE& rhs) { return typename SWIZZLE::PARENT(lhs) / rhs; }\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SCALAR_TYPE& lhs, const SWIZZLE& rhs) { return lhs / typename SWIZZLE::PARENT(rhs); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> operator/(const VECTOR" . $dimension . "<TYPE>& lhs, const SCALAR_TYPE& rhs)\n";
+	PrintExpressionScalarOperators($dimension, "/", "EXPRESSION_DIVIDE");
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> operator/(const VECTOR" . $dimension . "<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -71,12 +71,12 @@ sub ScalarDivision
 			{
 				print ", ";
 			}
-			print "lhs." . NumberToSwizzle($d) . " / rhs";
+			print ComponentOf("lhs", $d) . " / rhs";
 		}
 	
 	print ");\n";
 	print "}\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> operator/(const SCALAR_TYPE& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> operator/(const typename ScalarType<TYPE>::type& lhs, const VECTOR" . $dimension . "<TYPE>& rhs)\n";
 	print "{\n";
 	print "\treturn VECTOR" . $dimension . "<TYPE>(";
 	
@@ -86,11 +86,13 @@ sub ScalarDivision
 			{
 				print ", ";
 			}
-			print "lhs / rhs." . NumberToSwizzle($d);
+			print "lhs / " . ComponentOf("rhs", $d);
 		}
 	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdScalarOperator($dimension, "/", "_mm_div_ps");
 }
 
 return 1;
\ No newline at end of file
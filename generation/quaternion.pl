@@ -0,0 +1,186 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Quaternion type (QUATERNION), its functions, and rotation of vectors and batches by a quaternion
+
+sub MakeQuaternionType
+{
+	print "template <typename TYPE>\n";
+	print "struct QUATERNION\n";
+	print "{\n";
+	print "\tTYPE x, y, z, w; // Vector part (x, y, z) and scalar part w\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\tQUATERNION() {}\n";
+	print "\tQUATERNION(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w) : x(x), y(y), z(z), w(w) {}\n";
+	print "\tQUATERNION(const VECTOR3<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians) // The axis is assumed to be normalized\n";
+	print "\t{\n";
+	print "\t\ttypename RealType<TYPE>::type halfRadians = radians * (typename RealType<TYPE>::type)0.5;\n";
+	print "\t\ttypename RealType<TYPE>::type s = sin(halfRadians);\n";
+	print "\t\tx = rotationAxis.x * s;\n";
+	print "\t\ty = rotationAxis.y * s;\n";
+	print "\t\tz = rotationAxis.z * s;\n";
+	print "\t\tw = cos(halfRadians);\n";
+	print "\t}\n";
+	print "\n";
+	print "\tstatic QUATERNION Identity() { return QUATERNION((TYPE)0, (TYPE)0, (TYPE)0, (TYPE)1); }\n";
+	print "\n";
+	print "\t// Assignment operators (default for = is fine)\n";
+	print "\tconst QUATERNION& operator*=(const QUATERNION& rhs) { *this = *this * rhs; return *this; }\n";
+	print "};\n";
+	print "\n";
+}
+
+sub QuaternionFunctions
+{
+	print "// Quaternion arithmetic (component-wise, used to blend quaternions)\n";
+	print "template <typename TYPE> QUATERNION<TYPE> operator-(const QUATERNION<TYPE>& q) { return QUATERNION<TYPE>(-q.x, -q.y, -q.z, -q.w); }\n";
+	print "template <typename TYPE> QUATERNION<TYPE> operator+(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return QUATERNION<TYPE>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w); }\n";
+	print "template <typename TYPE> QUATERNION<TYPE> operator-(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return QUATERNION<TYPE>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w); }\n";
+	print "template <typename TYPE> QUATERNION<TYPE> operator*(const QUATERNION<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs) { return QUATERNION<TYPE>(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs, lhs.w * rhs); }\n";
+	print "template <typename TYPE> QUATERNION<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const QUATERNION<TYPE>& rhs) { return QUATERNION<TYPE>(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z, lhs * rhs.w); }\n";
+	print "\n";
+	print "// Quaternion composition [*]: rotating by (lhs * rhs) rotates by rhs, then by lhs\n";
+	print "template <typename TYPE> QUATERNION<TYPE> operator*(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs)\n";
+	print "{\n";
+	print "\treturn QUATERNION<TYPE>(lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,\n";
+	print "\t                        lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,\n";
+	print "\t                        lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w,\n";
+	print "\t                        lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z);\n";
+	print "}\n";
+	print "\n";
+	print "// Quaternion Comparisons\n";
+	print "template <typename TYPE> bool operator==(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z && lhs.w == rhs.w; }\n";
+	print "template <typename TYPE> bool operator!=(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return !(lhs == rhs); }\n";
+	print "template <typename TYPE> bool AlmostEqual(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return AlmostEqual(VECTOR4<TYPE>(lhs.x, lhs.y, lhs.z, lhs.w), VECTOR4<TYPE>(rhs.x, rhs.y, rhs.z, rhs.w)); }\n";
+	print "\n";
+	print "// Quaternion Dot(), Normalize(), Conjugate(), Inverse()\n";
+	print "template <typename TYPE> TYPE Dot(const QUATERNION<TYPE>& a, const QUATERNION<TYPE>& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }\n";
+	print "template <typename TYPE> QUATERNION<TYPE> Normalize(const QUATERNION<TYPE>& toNormalize) { return toNormalize * PrecisionDivideBySqrt((TYPE)1, Dot(toNormalize, toNormalize)); }\n";
+	print "template <typename TYPE> QUATERNION<TYPE> Conjugate(const QUATERNION<TYPE>& q) { return QUATERNION<TYPE>(-q.x, -q.y, -q.z, q.w); }\n";
+	print "template <typename TYPE> QUATERNION<TYPE> Inverse(const QUATERNION<TYPE>& q) { return Conjugate(q) * (1 / Dot(q, q)); }\n";
+	print "\n";
+	print "// Quaternion Nlerp(): normalized linear interpolation along the shorter arc, cheap but not constant speed\n";
+	print "template <typename TYPE> QUATERNION<TYPE> Nlerp(const QUATERNION<TYPE>& start, const QUATERNION<TYPE>& end, const typename ScalarType<TYPE>::type& delta)\n";
+	print "{\n";
+	print "\tQUATERNION<TYPE> shortEnd = (Dot(start, end) < 0) ? -end : end;\n";
+	print "\treturn Normalize(start + (shortEnd - start) * delta);\n";
+	print "}\n";
+	print "\n";
+	print "// Quaternion Slerp(): constant speed along the shorter arc, falling back to Nlerp() where the two are nearly equal\n";
+	print "template <typename TYPE> QUATERNION<TYPE> Slerp(const QUATERNION<TYPE>& start, const QUATERNION<TYPE>& end, const typename ScalarType<TYPE>::type& delta)\n";
+	print "{\n";
+	print "\tTYPE cosine = Dot(start, end);\n";
+	print "\tQUATERNION<TYPE> shortEnd = end;\n";
+	print "\tif (cosine < 0)\n";
+	print "\t{\n";
+	print "\t\tcosine = -cosine;\n";
+	print "\t\tshortEnd = -end;\n";
+	print "\t}\n";
+	print "\tif (cosine > (TYPE)0.9995)\n";
+	print "\t{\n";
+	print "\t\treturn Nlerp(start, shortEnd, delta);\n";
+	print "\t}\n";
+	print "\tTYPE angle = acos(cosine);\n";
+	print "\tTYPE inverseSine = 1 / sin(angle);\n";
+	print "\treturn start * (sin((1 - delta) * angle) * inverseSine) + shortEnd * (sin(delta * angle) * inverseSine);\n";
+	print "}\n";
+	print "\n";
+	print "// Quaternion ToMatrix(): the rotation as a 3x3 matrix (the quaternion is assumed to be normalized)\n";
+	print "template <typename TYPE> MATRIX3<TYPE> ToMatrix(const QUATERNION<TYPE>& q)\n";
+	print "{\n";
+	print "\tTYPE xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;\n";
+	print "\tTYPE xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;\n";
+	print "\tTYPE wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;\n";
+	print "\treturn MATRIX3<TYPE>(VECTOR3<TYPE>(1 - 2 * (yy + zz), 2 * (xy + wz), 2 * (xz - wy)),\n";
+	print "\t                     VECTOR3<TYPE>(2 * (xy - wz), 1 - 2 * (xx + zz), 2 * (yz + wx)),\n";
+	print "\t                     VECTOR3<TYPE>(2 * (xz + wy), 2 * (yz - wx), 1 - 2 * (xx + yy)));\n";
+	print "}\n";
+	print "\n";
+}
+
+# v' = v + w t + (x, y, z) x t, where t = 2 (x, y, z) x v; 4D vectors keep their w
+sub QuaternionRotation
+{
+	my($dimension) = @_;
+
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+
+	print "// " . $dimension . "D Rotate() by a quaternion\n";
+	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& toRotate, const QUATERNION<TYPE>& rotation) { return Rotate(typename SWIZZLE::PARENT(toRotate), rotation); }\n";
+	print "template <typename TYPE> " . $vector . " Rotate(const " . $vector . "& toRotate, const QUATERNION< typename RealType<TYPE>::type >& rotation)\n";
+	print "{\n";
+	if ($dimension == 3)
+	{
+		# Integer vectors are rotated in SCALAR_TYPE and truncated back, like the 2D Rotate() by a rot2
+		print "\ttypedef typename RealType<TYPE>::type REAL;\n";
+		print "\tVECTOR3<REAL> v(toRotate);\n";
+		print "\tREAL tx = 2 * (rotation.y * v.z - rotation.z * v.y);\n";
+		print "\tREAL ty = 2 * (rotation.z * v.x - rotation.x * v.z);\n";
+		print "\tREAL tz = 2 * (rotation.x * v.y - rotation.y * v.x);\n";
+		print "\treturn VECTOR3<TYPE>(VECTOR3<REAL>(v.x + rotation.w * tx + rotation.y * tz - rotation.z * ty,\n";
+		print "\t                                   v.y + rotation.w * ty + rotation.z * tx - rotation.x * tz,\n";
+		print "\t                                   v.z + rotation.w * tz + rotation.x * ty - rotation.y * tx));\n";
+	}
+	else
+	{
+		print "\treturn VECTOR4<TYPE>(Rotate(toRotate.xyz, rotation), toRotate.w);\n";
+	}
+	print "}\n\n";
+}
+
+# Many vectors by one quaternion: the rotation matrix is built once, then streamed over the array or batch
+sub QuaternionBatchRotation
+{
+	my($dimension) = @_;
+
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch Rotate() by a quaternion, out may be in\n";
+	print "template <typename TYPE> void Rotate(" . $vector . "* out, const " . $vector . "* in, const QUATERNION<TYPE>& rotation, const unsigned& count)\n";
+	print "{\n";
+	if ($dimension == 3)
+	{
+		print "\tTransform(out, ToMatrix(rotation), in, count);\n";
+	}
+	else
+	{
+		print "\tMATRIX3<TYPE> matrix = ToMatrix(rotation);\n";
+		print "\tTransform(out, MATRIX4<TYPE>(VECTOR4<TYPE>(matrix[0], (TYPE)0), VECTOR4<TYPE>(matrix[1], (TYPE)0), VECTOR4<TYPE>(matrix[2], (TYPE)0), VECTOR4<TYPE>((TYPE)0, (TYPE)0, (TYPE)0, (TYPE)1)), in, count);\n";
+	}
+	print "}\n";
+	print "template <typename OUT, typename A, typename TYPE> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A") . " Rotate(const OUT& out, const A& a, const QUATERNION<TYPE>& rotation) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), rotation); }\n";
+	print "template <typename TYPE> void Rotate(const " . $view . "& out, const " . $view . "& a, const QUATERNION<TYPE>& rotation)\n";
+	print "{\n";
+	print "\tMATRIX3<TYPE> matrix = ToMatrix(rotation);\n";
+	PrintMatrixElements(3, "matrix", "m");
+	@results = map { $r = $_; ["out." . NumberToSwizzle($r), join(" + ", map { "m" . $_ . $r . " * a" . uc(NumberToSwizzle($_)) } (0 .. 2))] } (0 .. 2);
+	if ($dimension == 4)
+	{
+		push(@results, ["out.w", "aW"]);
+	}
+	PrintSoaLoop("a.count", [SoaLoad("a", $dimension)], \@results);
+	print "}\n\n";
+}
+
+# Quaternion operator<< and ToString() (printed in svml_io.h)
+sub QuaternionToString
+{
+	print "// Quaternion operator<< and ToString()\n";
+	print "template <typename TYPE> ostream& operator<<(ostream& os, const QUATERNION<TYPE>& printQuaternion)\n";
+	print "{\n";
+	print "\tos << \"(\" << printQuaternion.x << \", \" << printQuaternion.y << \", \" << printQuaternion.z << \", \" << printQuaternion.w << \")\";\n";
+	print "\treturn os;\n";
+	print "}\n";
+	print "template <typename TYPE> string ToString(const QUATERNION<TYPE>& printQuaternion)\n";
+	print "{\n";
+	print "\tstd::ostringstream buffer;\n";
+	print "\tbuffer << printQuaternion;\n";
+	print "\treturn buffer.str();\n";
+	print "}\n";
+	print "\n";
+}
+
+return 1;
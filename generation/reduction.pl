@@ -0,0 +1,235 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Deterministic reductions over arrays of points: Sum(), Centroid() and Covariance(). Each block of REDUCTION_BLOCK
+# points is summed with four compensated (Kahan) accumulators per component, point i going to accumulator i % 4, and the
+# blocks are combined pairwise. The order of every addition depends only on the number of points, so the SSE kernels and
+# the parallel ones in SVML::Bulk return exactly the same bits
+
+sub PrintReductionUtilities
+{
+	print "// Points per block of Sum(), Centroid() and Covariance()\n";
+	print "const unsigned REDUCTION_BLOCK = 1024;\n";
+	print "\n";
+	print "// One compensated addition, and the value of four accumulators added in a fixed order\n";
+	print "template <typename TYPE> inline void ReductionAdd(TYPE& sum, TYPE& compensation, const TYPE& value)\n";
+	print "{\n";
+	print "\tTYPE corrected = value - compensation;\n";
+	print "\tTYPE total = sum + corrected;\n";
+	print "\tcompensation = (total - sum) - corrected;\n";
+	print "\tsum = total;\n";
+	print "}\n";
+	print "template <typename TYPE> inline TYPE ReductionFold(const TYPE sum[4], const TYPE compensation[4]) { return ((sum[0] - compensation[0]) + (sum[1] - compensation[1])) + ((sum[2] - compensation[2]) + (sum[3] - compensation[3])); }\n";
+	print "\n";
+}
+
+# The compensated accumulators of one block: $prefix . "X" and so on, four lanes each
+sub PrintReductionAccumulators
+{
+	my($indent, @names) = @_;
+
+	print $indent . "TYPE " . join(", ", map { $_ . "[4]" } @names) . ";\n";
+	print $indent . "TYPE " . join(", ", map { $_ . "Compensation[4]" } @names) . ";\n";
+	print $indent . "for (unsigned lane = 0; lane < 4; lane++)\n";
+	print $indent . "{\n";
+	print $indent . "\t" . join(" = ", map { ($_ . "[lane]", $_ . "Compensation[lane]") } @names) . " = (TYPE)0;\n";
+	print $indent . "}\n";
+}
+
+sub ReductionFunctions
+{
+	my($dimension) = @_;
+
+	$vector = "VECTOR" . $dimension . "<TYPE>";
+	$matrix = "MATRIX" . $dimension . "<TYPE>";
+	@components = SoaComponents($dimension);
+	my @sums = map { "sum" . uc($_) } @components;
+
+	print "// " . $dimension . "D sum of one block, point i going to accumulator i % 4\n";
+	print "template <typename TYPE> " . $vector . " BlockSum(const " . $vector . "* points, const unsigned& count)\n";
+	print "{\n";
+	PrintReductionAccumulators("\t", @sums);
+	print "\tunsigned i = 0;\n";
+	print "\tfor (; i + 4 <= count; i += 4)\n";
+	print "\t{\n";
+	print "\t\tfor (unsigned lane = 0; lane < 4; lane++)\n";
+	print "\t\t{\n";
+	foreach $c (@components)
+	{
+		print "\t\t\tReductionAdd<TYPE>(sum" . uc($c) . "[lane], sum" . uc($c) . "Compensation[lane], points[i + lane]." . $c . ");\n";
+	}
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\tfor (; i < count; i++)\n";
+	print "\t{\n";
+	foreach $c (@components)
+	{
+		print "\t\tReductionAdd<TYPE>(sum" . uc($c) . "[i % 4], sum" . uc($c) . "Compensation[i % 4], points[i]." . $c . ");\n";
+	}
+	print "\t}\n";
+	print "\treturn " . $vector . "(" . join(", ", map { "ReductionFold(" . $_ . ", " . $_ . "Compensation)" } @sums) . ");\n";
+	print "}\n";
+	print "\n";
+
+	PrintSimdReductions($dimension);
+
+	print "// " . $dimension . "D Sum() and Centroid() of an array (0 when count is 0): blocks of REDUCTION_BLOCK points combined pairwise\n";
+	print "template <typename TYPE> " . $vector . " Sum(const " . $vector . "* points, const unsigned& count)\n";
+	print "{\n";
+	print "\tunsigned blocks = count / REDUCTION_BLOCK + ((count % REDUCTION_BLOCK) ? 1 : 0);\n";
+	print "\tif (blocks <= 1) { return BlockSum(points, count); }\n";
+	print "\tunsigned half = blocks / 2 * REDUCTION_BLOCK;\n";
+	print "\treturn Sum(points, half) + Sum(points + half, count - half);\n";
+	print "}\n";
+	print "template <typename TYPE> " . $vector . " Centroid(const " . $vector . "* points, const unsigned& count) { return (count > 0) ? Sum(points, count) / (typename ScalarType<TYPE>::type)count : " . $vector . "(" . join(", ", map { "(TYPE)0" } @components) . "); }\n";
+	print "\n";
+
+	if ($dimension > 3)
+	{
+		return;
+	}
+
+	# Upper triangle of the symmetric matrix, row by row
+	my @pairs = ();
+	for ($row = 0; $row < $dimension; $row++)
+	{
+		for ($column = $row; $column < $dimension; $column++)
+		{
+			push(@pairs, [$components[$row], $components[$column]]);
+		}
+	}
+	my @products = map { "sum" . uc($_->[0]) . uc($_->[1]) } @pairs;
+
+	print "// " . $dimension . "D scatter of one block about center: the sum of outer products of (point - center)\n";
+	print "template <typename TYPE> " . $matrix . " BlockScatter(const " . $vector . "* points, const unsigned& count, const " . $vector . "& center)\n";
+	print "{\n";
+	PrintReductionAccumulators("\t", @products);
+	print "\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tunsigned lane = i % 4;\n";
+	foreach $c (@components)
+	{
+		print "\t\tTYPE " . $c . " = points[i]." . $c . " - center." . $c . ";\n";
+	}
+	foreach $pair (@pairs)
+	{
+		$name = "sum" . uc($pair->[0]) . uc($pair->[1]);
+		print "\t\tReductionAdd<TYPE>(" . $name . "[lane], " . $name . "Compensation[lane], " . $pair->[0] . " * " . $pair->[1] . ");\n";
+	}
+	print "\t}\n";
+	foreach $name (@products)
+	{
+		print "\tTYPE " . lc(substr($name, 3)) . " = ReductionFold(" . $name . ", " . $name . "Compensation);\n";
+	}
+	@columns = ();
+	for ($column = 0; $column < $dimension; $column++)
+	{
+		@entries = ();
+		for ($row = 0; $row < $dimension; $row++)
+		{
+			($first, $second) = ($row < $column) ? ($row, $column) : ($column, $row);
+			push(@entries, $components[$first] . $components[$second]);
+		}
+		push(@columns, $vector . "(" . join(", ", @entries) . ")");
+	}
+	print "\treturn " . $matrix . "(" . join(", ", @columns) . ");\n";
+	print "}\n";
+	print "\n";
+
+	print "// " . $dimension . "D Scatter() about center and Covariance() (the population covariance, for PCA: its eigenvectors are the principal axes)\n";
+	print "template <typename TYPE> " . $matrix . " Scatter(const " . $vector . "* points, const unsigned& count, const " . $vector . "& center)\n";
+	print "{\n";
+	print "\tunsigned blocks = count / REDUCTION_BLOCK + ((count % REDUCTION_BLOCK) ? 1 : 0);\n";
+	print "\tif (blocks <= 1) { return BlockScatter(points, count, center); }\n";
+	print "\tunsigned half = blocks / 2 * REDUCTION_BLOCK;\n";
+	print "\treturn Scatter(points, half, center) + Scatter(points + half, count - half, center);\n";
+	print "}\n";
+	print "template <typename TYPE> " . $matrix . " Covariance(const " . $vector . "* points, const unsigned& count) { return (count > 0) ? Scatter(points, count, Centroid(points, count)) * ((typename ScalarType<TYPE>::type)1 / (typename ScalarType<TYPE>::type)count) : " . $matrix . "((TYPE)0); }\n";
+	print "\n";
+}
+
+sub PrintSimdReductions
+{
+	my($dimension) = @_;
+
+	my $vector = SimdVector($dimension);
+
+	SimdBegin();
+	print "inline " . $vector . " BlockSum(const " . $vector . "* points, const unsigned& count)\n";
+	print "{\n";
+	if ($dimension == 2)
+	{
+		print "\t// Two points per register, so the lanes of sum01 are accumulators 0 and 1 and those of sum23 are 2 and 3\n";
+		print "\t__m128 sum01 = _mm_setzero_ps(), sum23 = sum01, compensation01 = sum01, compensation23 = sum01;\n";
+		print "\tunsigned i = 0;\n";
+		print "\tfor (; i + 4 <= count; i += 4)\n";
+		print "\t{\n";
+		print "\t\tSimdReductionAdd(sum01, compensation01, _mm_loadu_ps((const float*)(points + i)));\n";
+		print "\t\tSimdReductionAdd(sum23, compensation23, _mm_loadu_ps((const float*)(points + i + 2)));\n";
+		print "\t}\n";
+		print "\tfloat sums[8], compensations[8];\n";
+		print "\t_mm_storeu_ps(sums, sum01);\n";
+		print "\t_mm_storeu_ps(sums + 4, sum23);\n";
+		print "\t_mm_storeu_ps(compensations, compensation01);\n";
+		print "\t_mm_storeu_ps(compensations + 4, compensation23);\n";
+		print "\tfloat sumX[4], sumY[4], sumXCompensation[4], sumYCompensation[4];\n";
+		print "\tfor (unsigned lane = 0; lane < 4; lane++)\n";
+		print "\t{\n";
+		print "\t\tsumX[lane] = sums[lane * 2];\n";
+		print "\t\tsumY[lane] = sums[lane * 2 + 1];\n";
+		print "\t\tsumXCompensation[lane] = compensations[lane * 2];\n";
+		print "\t\tsumYCompensation[lane] = compensations[lane * 2 + 1];\n";
+		print "\t}\n";
+		print "\tfor (; i < count; i++)\n";
+		print "\t{\n";
+		print "\t\tReductionAdd<float>(sumX[i % 4], sumXCompensation[i % 4], points[i].x);\n";
+		print "\t\tReductionAdd<float>(sumY[i % 4], sumYCompensation[i % 4], points[i].y);\n";
+		print "\t}\n";
+		print "\treturn " . $vector . "(ReductionFold(sumX, sumXCompensation), ReductionFold(sumY, sumYCompensation));\n";
+	}
+	else
+	{
+		print "\t// One point per register, all of its components at once\n";
+		print "\t__m128 sum[4], compensation[4];\n";
+		print "\tfor (unsigned lane = 0; lane < 4; lane++)\n";
+		print "\t{\n";
+		print "\t\tsum[lane] = compensation[lane] = _mm_setzero_ps();\n";
+		print "\t}\n";
+		print "\tunsigned i = 0;\n";
+		print "\tfor (; i + 4 <= count; i += 4)\n";
+		print "\t{\n";
+		print "\t\tfor (unsigned lane = 0; lane < 4; lane++)\n";
+		print "\t\t{\n";
+		print "\t\t\tSimdReductionAdd(sum[lane], compensation[lane], points[i + lane].Simd());\n";
+		print "\t\t}\n";
+		print "\t}\n";
+		print "\tfor (; i < count; i++)\n";
+		print "\t{\n";
+		print "\t\tSimdReductionAdd(sum[i % 4], compensation[i % 4], points[i].Simd());\n";
+		print "\t}\n";
+		print "\t__m128 low = _mm_add_ps(_mm_sub_ps(sum[0], compensation[0]), _mm_sub_ps(sum[1], compensation[1]));\n";
+		print "\t__m128 high = _mm_add_ps(_mm_sub_ps(sum[2], compensation[2]), _mm_sub_ps(sum[3], compensation[3]));\n";
+		print "\treturn " . $vector . "(_mm_add_ps(low, high));\n";
+	}
+	print "}\n";
+	print "\n";
+	SimdEnd();
+}
+
+sub PrintSimdReductionUtilities
+{
+	SimdBegin();
+	print "// ReductionAdd() of four lanes\n";
+	print "inline void SimdReductionAdd(__m128& sum, __m128& compensation, const __m128& value)\n";
+	print "{\n";
+	print "\t__m128 corrected = _mm_sub_ps(value, compensation);\n";
+	print "\t__m128 total = _mm_add_ps(sum, corrected);\n";
+	print "\tcompensation = _mm_sub_ps(_mm_sub_ps(total, sum), corrected);\n";
+	print "\tsum = total;\n";
+	print "}\n";
+	print "\n";
+	SimdEnd();
+}
+
+return 1;
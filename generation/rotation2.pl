@@ -0,0 +1,194 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# 2D rotation type (ROTATION2), a unit complex number holding the cosine and sine of its angle so sin() and cos() are
+# paid once, its functions, and rotation of vectors, arrays and batches by one rotation or by an angle per vector
+
+sub MakeRotation2Type
+{
+	print "template <typename TYPE>\n";
+	print "struct ROTATION2\n";
+	print "{\n";
+	print "\tTYPE c, s; // Cosine and sine of the angle: the unit complex number c + s i\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\tROTATION2() {}\n";
+	print "\tROTATION2(const TYPE& c, const TYPE& s) : c(c), s(s) {}\n";
+	print "\texplicit ROTATION2(const TYPE& radians) : c(cos(radians)), s(sin(radians)) {}\n";
+	print "\n";
+	print "\tstatic ROTATION2 Identity() { return ROTATION2((TYPE)1, (TYPE)0); }\n";
+	print "\n";
+	print "\t// Assignment operators (default for = is fine)\n";
+	print "\tconst ROTATION2& operator*=(const ROTATION2& rhs) { *this = *this * rhs; return *this; }\n";
+	print "};\n";
+	print "\n";
+}
+
+sub Rotation2Functions
+{
+	print "// Rotation composition [*]: rotating by (lhs * rhs) rotates by both angles (in either order, as 2D rotations commute)\n";
+	print "template <typename TYPE> ROTATION2<TYPE> operator*(const ROTATION2<TYPE>& lhs, const ROTATION2<TYPE>& rhs) { return ROTATION2<TYPE>(lhs.c * rhs.c - lhs.s * rhs.s, lhs.s * rhs.c + lhs.c * rhs.s); }\n";
+	print "\n";
+	print "// Rotation Comparisons\n";
+	print "template <typename TYPE> bool operator==(const ROTATION2<TYPE>& lhs, const ROTATION2<TYPE>& rhs) { return lhs.c == rhs.c && lhs.s == rhs.s; }\n";
+	print "template <typename TYPE> bool operator!=(const ROTATION2<TYPE>& lhs, const ROTATION2<TYPE>& rhs) { return !(lhs == rhs); }\n";
+	print "template <typename TYPE> bool AlmostEqual(const ROTATION2<TYPE>& lhs, const ROTATION2<TYPE>& rhs) { return AlmostEqual(VECTOR2<TYPE>(lhs.c, lhs.s), VECTOR2<TYPE>(rhs.c, rhs.s)); }\n";
+	print "\n";
+	print "// Rotation Angle() (in (-pi, pi]), Inverse(), Normalize() (to undo the drift of many compositions)\n";
+	print "template <typename TYPE> TYPE Angle(const ROTATION2<TYPE>& rotation) { return atan2(rotation.s, rotation.c); }\n";
+	print "template <typename TYPE> ROTATION2<TYPE> Inverse(const ROTATION2<TYPE>& rotation) { return ROTATION2<TYPE>(rotation.c, -rotation.s); }\n";
+	print "template <typename TYPE> ROTATION2<TYPE> Normalize(const ROTATION2<TYPE>& toNormalize)\n";
+	print "{\n";
+	print "\tTYPE scale = PrecisionDivideBySqrt((TYPE)1, toNormalize.c * toNormalize.c + toNormalize.s * toNormalize.s);\n";
+	print "\treturn ROTATION2<TYPE>(toNormalize.c * scale, toNormalize.s * scale);\n";
+	print "}\n";
+	print "\n";
+	print "// Rotation Nlerp(): normalized linear interpolation, cheap but not constant speed (and undefined for opposite rotations)\n";
+	print "template <typename TYPE> ROTATION2<TYPE> Nlerp(const ROTATION2<TYPE>& start, const ROTATION2<TYPE>& end, const TYPE& delta)\n";
+	print "{\n";
+	print "\treturn Normalize(ROTATION2<TYPE>(start.c + (end.c - start.c) * delta, start.s + (end.s - start.s) * delta));\n";
+	print "}\n";
+	print "\n";
+	print "// Rotation Slerp(): constant speed along the shorter arc\n";
+	print "template <typename TYPE> ROTATION2<TYPE> Slerp(const ROTATION2<TYPE>& start, const ROTATION2<TYPE>& end, const TYPE& delta)\n";
+	print "{\n";
+	print "\treturn start * ROTATION2<TYPE>(Angle(end * Inverse(start)) * delta);\n";
+	print "}\n";
+	print "\n";
+	print "// Rotation ToMatrix(): the rotation as a 2x2 matrix\n";
+	print "template <typename TYPE> MATRIX2<TYPE> ToMatrix(const ROTATION2<TYPE>& rotation)\n";
+	print "{\n";
+	print "\treturn MATRIX2<TYPE>(VECTOR2<TYPE>(rotation.c, rotation.s), VECTOR2<TYPE>(-rotation.s, rotation.c));\n";
+	print "}\n";
+	print "\n";
+	print "// 2D Rotate() by a rotation\n";
+	print "template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& vector, const ROTATION2< typename RealType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >& rotation) { return Rotate(typename SWIZZLE::PARENT(vector), rotation); }\n";
+	print "template <typename TYPE> VECTOR2<TYPE> Rotate(const VECTOR2<TYPE>& vector, const ROTATION2< typename RealType<TYPE>::type >& rotation)\n";
+	print "{\n";
+	print "\treturn VECTOR2<TYPE>(vector.x * rotation.c - vector.y * rotation.s, vector.x * rotation.s + vector.y * rotation.c);\n";
+	print "}\n";
+	print "\n";
+}
+
+# Many vectors by one rotation, or each by its own angle
+sub Rotation2BatchRotation
+{
+	$view = "VECTOR2_SOA_VIEW<TYPE>";
+	$scalar = "typename RealType<TYPE>::type";
+
+	print "// 2D batch Rotate() by a rotation, or each vector by angles[i], out may be in\n";
+	print "template <typename TYPE> void Rotate(VECTOR2<TYPE>* out, const VECTOR2<TYPE>* in, const ROTATION2< " . $scalar . " >& rotation, const unsigned& count)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = Rotate(in[i], rotation);\n";
+	print "\t}\n";
+	print "}\n";
+	print "template <typename TYPE> void Rotate(VECTOR2<TYPE>* out, const VECTOR2<TYPE>* in, const " . $scalar . "* angles, const unsigned& count)\n";
+	print "{\n";
+	print "\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = Rotate(in[i], ROTATION2< " . $scalar . " >(angles[i]));\n";
+	print "\t}\n";
+	print "}\n";
+	print "template <typename OUT, typename A> inline " . SoaWrapperCondition(2, "void", "OUT", "A") . " Rotate(const OUT& out, const A& a, const ROTATION2< typename RealType< typename ComponentType< typename A::PARENT >::type >::type >& rotation) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), rotation); }\n";
+	print "template <typename TYPE> void Rotate(const " . $view . "& out, const " . $view . "& a, const ROTATION2< " . $scalar . " >& rotation)\n";
+	print "{\n";
+	print "\t" . $scalar . " ca = rotation.c, sa = rotation.s;\n";
+	PrintSoaLoop("a.count", [SoaLoad("a", 2)], [["out.x", "aX * ca - aY * sa"], ["out.y", "aX * sa + aY * ca"]]);
+	print "}\n";
+	print "template <typename OUT, typename A> inline " . SoaWrapperCondition(2, "void", "OUT", "A") . " Rotate(const OUT& out, const A& a, const typename RealType< typename ComponentType< typename A::PARENT >::type >::type* angles) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), angles); }\n";
+	print "template <typename TYPE> void Rotate(const " . $view . "& out, const " . $view . "& a, const " . $scalar . "* angles)\n";
+	print "{\n";
+	PrintSoaLoop("a.count", [SoaLoad("a", 2), $scalar . " ca = cos(angles[i]), sa = sin(angles[i]);"], [["out.x", "aX * ca - aY * sa"], ["out.y", "aX * sa + aY * ca"]]);
+	print "}\n\n";
+}
+
+# SSE versions: two float vectors per register by one rotation, and four angles per SimdSinCos() call when each
+# vector has its own
+sub PrintSimdRotation2
+{
+	SimdBegin();
+	print "// Two 2D vectors (x0, y0, x1, y1) rotated by (c, c, c, c) and (-s, s, -s, s)\n";
+	print "inline __m128 SimdRotate2(const __m128& xyxy, const __m128& c, const __m128& s)\n";
+	print "{\n";
+	print "\treturn _mm_add_ps(_mm_mul_ps(xyxy, c), _mm_mul_ps(_mm_shuffle_ps(xyxy, xyxy, _MM_SHUFFLE(2, 3, 0, 1)), s));\n";
+	print "}\n";
+	print "\n";
+	print "inline void Rotate(VECTOR2<float>* out, const VECTOR2<float>* in, const ROTATION2<float>& rotation, const unsigned& count)\n";
+	print "{\n";
+	print "\t__m128 c = _mm_set1_ps(rotation.c);\n";
+	print "\t__m128 s = _mm_setr_ps(-rotation.s, rotation.s, -rotation.s, rotation.s);\n";
+	print "\tunsigned i = 0;\n";
+	print "\tfor (; i + 2 <= count; i += 2)\n";
+	print "\t{\n";
+	print "\t\t_mm_storeu_ps((float*)(out + i), SimdRotate2(_mm_loadu_ps((const float*)(in + i)), c, s));\n";
+	print "\t}\n";
+	print "\tif (i < count)\n";
+	print "\t{\n";
+	print "\t\tout[i] = Rotate(in[i], rotation);\n";
+	print "\t}\n";
+	print "}\n";
+	SimdEnd();
+	print "#if defined(SVML_USE_SSE) && defined(__SSE2__)\n";
+	print "inline void Rotate(VECTOR2<float>* out, const VECTOR2<float>* in, const float* angles, const unsigned& count)\n";
+	print "{\n";
+	print "\t__m128 negateEven = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);\n";
+	print "\tunsigned i = 0;\n";
+	print "\tfor (; i + 4 <= count; i += 4)\n";
+	print "\t{\n";
+	print "\t\t__m128 sine, cosine;\n";
+	print "\t\tSimdSinCos(_mm_loadu_ps(angles + i), sine, cosine);\n";
+	print "\t\t__m128 first = SimdRotate2(_mm_loadu_ps((const float*)(in + i)), _mm_unpacklo_ps(cosine, cosine), _mm_xor_ps(_mm_unpacklo_ps(sine, sine), negateEven));\n";
+	print "\t\t__m128 second = SimdRotate2(_mm_loadu_ps((const float*)(in + i + 2)), _mm_unpackhi_ps(cosine, cosine), _mm_xor_ps(_mm_unpackhi_ps(sine, sine), negateEven));\n";
+	print "\t\t_mm_storeu_ps((float*)(out + i), first);\n";
+	print "\t\t_mm_storeu_ps((float*)(out + i + 2), second);\n";
+	print "\t}\n";
+	print "\tfor (; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = Rotate(in[i], ROTATION2<float>(angles[i]));\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+	print "inline void Rotate(const VECTOR2_SOA_VIEW<float>& out, const VECTOR2_SOA_VIEW<float>& a, const float* angles)\n";
+	print "{\n";
+	print "\tsize_t i = 0;\n";
+	print "\tfor (; i + 4 <= a.count; i += 4)\n";
+	print "\t{\n";
+	print "\t\t__m128 sine, cosine;\n";
+	print "\t\tSimdSinCos(_mm_loadu_ps(angles + i), sine, cosine);\n";
+	print "\t\t__m128 x = _mm_loadu_ps(a.x + i), y = _mm_loadu_ps(a.y + i);\n";
+	print "\t\t_mm_storeu_ps(out.x + i, _mm_sub_ps(_mm_mul_ps(x, cosine), _mm_mul_ps(y, sine)));\n";
+	print "\t\t_mm_storeu_ps(out.y + i, _mm_add_ps(_mm_mul_ps(x, sine), _mm_mul_ps(y, cosine)));\n";
+	print "\t}\n";
+	print "\tfor (; i < a.count; i++)\n";
+	print "\t{\n";
+	print "\t\tfloat aX = a.x[i], aY = a.y[i], sa = sin(angles[i]), ca = cos(angles[i]);\n";
+	print "\t\tout.x[i] = aX * ca - aY * sa;\n";
+	print "\t\tout.y[i] = aX * sa + aY * ca;\n";
+	print "\t}\n";
+	print "}\n";
+	print "#endif // SVML_USE_SSE && __SSE2__\n";
+	print "\n";
+}
+
+# Rotation operator<< and ToString() (printed in svml_io.h)
+sub Rotation2ToString
+{
+	print "// Rotation operator<< and ToString()\n";
+	print "template <typename TYPE> ostream& operator<<(ostream& os, const ROTATION2<TYPE>& printRotation)\n";
+	print "{\n";
+	print "\tos << \"(\" << printRotation.c << \", \" << printRotation.s << \")\";\n";
+	print "\treturn os;\n";
+	print "}\n";
+	print "template <typename TYPE> string ToString(const ROTATION2<TYPE>& printRotation)\n";
+	print "{\n";
+	print "\tstd::ostringstream buffer;\n";
+	print "\tbuffer << printRotation;\n";
+	print "\treturn buffer.str();\n";
+	print "}\n";
+	print "\n";
+}
+
+return 1;
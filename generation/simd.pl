@@ -0,0 +1,1139 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# SSE overloads for VECTOR3<float> and VECTOR4<float> (opt-in with SVML_USE_SSE)
+#
+# The generic templates stay untouched; these non-template overloads win overload resolution
+# for float vectors, and the swizzle wrappers reach them after converting to PARENT.
+#
+# The same overloads exist for two other component types where the instructions do: VECTOR3<int> and
+# VECTOR4<int> are packed into an __m128i like float vectors once SSE4.1 is available (which multiplies
+# 32-bit integers), and VECTOR4<double> is loaded into an __m256d with AVX. Its storage is left alone, as
+# an __m256d member would need 32-byte alignment, more than operator new gives before C++17.
+
+sub SimdBegin
+{
+	print "#ifdef SVML_USE_SSE\n";
+}
+
+sub SimdEnd
+{
+	print "#endif // SVML_USE_SSE\n";
+}
+
+sub SimdVector
+{
+	my($dimension) = @_;
+
+	return "VECTOR" . $dimension . "<float>";
+}
+
+# Component types with SIMD overloads in a dimension, and the instructions each needs
+%simdGuard = ("int" => "__SSE4_1__", "double" => "__AVX__");
+
+sub SimdKinds
+{
+	my($dimension) = @_;
+
+	if ($dimension < 3)
+	{
+		return ();
+	}
+	return ($dimension == 4) ? ("float", "int", "double") : ("float", "int");
+}
+
+sub SimdKindBegin
+{
+	my($kind) = @_;
+
+	if ($kind eq "float")
+	{
+		SimdBegin();
+		return;
+	}
+	print "#if defined(SVML_USE_SSE) && defined(" . $simdGuard{$kind} . ")\n";
+}
+
+sub SimdKindEnd
+{
+	my($kind) = @_;
+
+	if ($kind eq "float")
+	{
+		SimdEnd();
+		return;
+	}
+	print "#endif // SVML_USE_SSE && " . $simdGuard{$kind} . "\n";
+}
+
+# The register holding a vector's components, and the vector holding a register's lanes
+sub SimdLoad
+{
+	my($kind, $vector) = @_;
+
+	return ($kind eq "double") ? "_mm256_loadu_pd((const double*)&" . $vector . ")" : $vector . ".Simd()";
+}
+
+sub SimdMake
+{
+	my($kind, $dimension, $packed) = @_;
+
+	return ($kind eq "double") ? "SimdStore4d(" . $packed . ")" : "VECTOR" . $dimension . "<" . $kind . ">(" . $packed . ")";
+}
+
+# The counterpart of a float intrinsic for the other component types (empty when there is none, such as an integer divide)
+%simdIntegerIntrinsic = ("_mm_add_ps" => "_mm_add_epi32", "_mm_sub_ps" => "_mm_sub_epi32", "_mm_mul_ps" => "_mm_mullo_epi32",
+                         "_mm_max_ps" => "_mm_max_epi32", "_mm_min_ps" => "_mm_min_epi32", "_mm_set1_ps" => "_mm_set1_epi32");
+
+sub SimdIntrinsic
+{
+	my($kind, $intrinsic) = @_;
+
+	if ($kind eq "int")
+	{
+		return exists($simdIntegerIntrinsic{$intrinsic}) ? $simdIntegerIntrinsic{$intrinsic} : "";
+	}
+	if ($kind eq "double")
+	{
+		$intrinsic =~ s/^_mm_/_mm256_/;
+		$intrinsic =~ s/_ps$/_pd/;
+	}
+	return $intrinsic;
+}
+
+# A divisor register (or an argument that is divided by, like the x of Pow() and Atan2()), with the unused w lane of 3D
+# floats set to 1 so that lane doesn't raise FE_INVALID or FE_DIVBYZERO
+sub SimdDivisor
+{
+	my($kind, $dimension, $packed) = @_;
+
+	return ($kind eq "float" && $dimension == 3) ? "SimdReplaceW(" . $packed . ", _mm_set1_ps(1.0f))" : $packed;
+}
+
+# Scalar parameters of the float overloads stay SCALAR_TYPE
+sub SimdScalar
+{
+	my($kind) = @_;
+
+	return ($kind eq "float") ? "SCALAR_TYPE" : $kind;
+}
+
+sub PrintSimdUtilities
+{
+	print "#ifdef SVML_USE_SSE\n";
+	print "// Sum of the x, y, and z lanes (in that order, matching the scalar code)\n";
+	print "inline __m128 SimdHorizontalAdd3(const __m128& a)\n";
+	print "{\n";
+	print "\treturn _mm_add_ss(_mm_add_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(a, a));\n";
+	print "}\n";
+	print "\n";
+	print "inline SCALAR_TYPE SimdDot3(const __m128& a, const __m128& b)\n";
+	print "{\n";
+	print "\treturn _mm_cvtss_f32(SimdHorizontalAdd3(_mm_mul_ps(a, b)));\n";
+	print "}\n";
+	print "\n";
+	print "// Takes x, y, and z from xyz and w from w\n";
+	print "inline __m128 SimdReplaceW(const __m128& xyz, const __m128& w)\n";
+	print "{\n";
+	print "\treturn _mm_shuffle_ps(xyz, _mm_unpackhi_ps(xyz, w), _MM_SHUFFLE(3, 0, 1, 0));\n";
+	print "}\n";
+	print "#endif // SVML_USE_SSE\n";
+	print "\n";
+	print "#if defined(SVML_USE_SSE) && defined(__SSE2__)\n";
+	print "// All ones in lane i where bit i of a mask is set\n";
+	print "inline __m128 SimdLaneMask(const unsigned& bits)\n";
+	print "{\n";
+	print "\t__m128i lanes = _mm_setr_epi32(1, 2, 4, 8);\n";
+	print "\treturn _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)bits), lanes), lanes));\n";
+	print "}\n";
+	print "\n";
+	print "// The lanes of a where laneMask is all ones, and of b where it is zero\n";
+	print "inline __m128 SimdBlend(const __m128& laneMask, const __m128& a, const __m128& b)\n";
+	print "{\n";
+	print "#ifdef __SSE4_1__\n";
+	print "\treturn _mm_blendv_ps(b, a, laneMask);\n";
+	print "#else\n";
+	print "\treturn _mm_or_ps(_mm_and_ps(laneMask, a), _mm_andnot_ps(laneMask, b));\n";
+	print "#endif\n";
+	print "}\n";
+	print "#endif // SVML_USE_SSE && __SSE2__\n";
+	print "\n";
+	SimdKindBegin("int");
+	print "inline int SimdDot3i(const __m128i& a, const __m128i& b)\n";
+	print "{\n";
+	print "\t__m128i products = _mm_mullo_epi32(a, b);\n";
+	print "\treturn _mm_cvtsi128_si32(_mm_add_epi32(_mm_add_epi32(products, _mm_shuffle_epi32(products, _MM_SHUFFLE(1, 1, 1, 1))), _mm_shuffle_epi32(products, _MM_SHUFFLE(2, 2, 2, 2))));\n";
+	print "}\n";
+	SimdKindEnd("int");
+	print "\n";
+	SimdKindBegin("double");
+	print "// Sum of the x, y, and z products, in that order\n";
+	print "inline double SimdDot3d(const __m256d& a, const __m256d& b)\n";
+	print "{\n";
+	print "\t__m256d products = _mm256_mul_pd(a, b);\n";
+	print "\t__m128d xy = _mm256_castpd256_pd128(products);\n";
+	print "\treturn _mm_cvtsd_f64(_mm_add_sd(_mm_add_sd(xy, _mm_unpackhi_pd(xy, xy)), _mm256_extractf128_pd(products, 1)));\n";
+	print "}\n";
+	SimdKindEnd("double");
+	print "\n";
+}
+
+# Vectorized math for the common functions: Cephes single-precision polynomials (https://www.netlib.org/cephes/), with
+# the reduction and special values done with SSE2 integer instructions. SimdSinCos() also serves the 2D rotations
+sub PrintSimdMathUtilities
+{
+	print "#ifdef SVML_USE_SSE\n";
+	print "// 1 / sqrt() of every lane under SVML_PRECISION\n";
+	print "inline __m128 SimdInverseSqrt(const __m128& x)\n";
+	print "{\n";
+	print "#ifdef SVML_FAST_RSQRT\n";
+	print "\t__m128 estimate = _mm_rsqrt_ps(x); // Relative error below 1.5 * 2^-12\n";
+	print "#if SVML_PRECISION == SVML_PRECISION_REFINED\n";
+	print "\testimate = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), _mm_mul_ps(estimate, estimate))));\n";
+	print "#endif\n";
+	print "\treturn estimate;\n";
+	print "#else\n";
+	print "\treturn _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(x));\n";
+	print "#endif\n";
+	print "}\n";
+	print "\n";
+	print "// t^2 (3 - 2 t) with t = (x - edge0) / (edge1 - edge0) clamped to [0, 1]\n";
+	print "inline __m128 SimdSmoothStep(const __m128& edge0, const __m128& edge1, const __m128& x)\n";
+	print "{\n";
+	print "\t__m128 t = _mm_div_ps(_mm_sub_ps(x, edge0), _mm_sub_ps(edge1, edge0));\n";
+	print "\tt = _mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_setzero_ps(), t));\n";
+	print "\treturn _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_set1_ps(2.0f), t)));\n";
+	print "}\n";
+	print "#endif // SVML_USE_SSE\n";
+	print "\n";
+	print "#if defined(SVML_USE_SSE) && defined(__SSE2__)\n";
+	print "// floor() of every lane. Without SSE4.1: truncate, then step down the lanes that went up (from 2^23 on, every float is\n";
+	print "// whole already)\n";
+	print "inline __m128 SimdFloor(const __m128& x)\n";
+	print "{\n";
+	print "#ifdef __SSE4_1__\n";
+	print "\treturn _mm_floor_ps(x);\n";
+	print "#else\n";
+	print "\t__m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));\n";
+	print "\ttruncated = _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, x), _mm_set1_ps(1.0f)));\n";
+	print "\treturn SimdBlend(_mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), _mm_set1_ps(8388608.0f)), truncated, x);\n";
+	print "#endif\n";
+	print "}\n";
+	print "\n";
+	print "// The lanes of result, and NaN where x is NaN\n";
+	print "inline __m128 SimdKeepNaN(const __m128& x, const __m128& result)\n";
+	print "{\n";
+	print "\treturn SimdBlend(_mm_cmpunord_ps(x, x), x, result);\n";
+	print "}\n";
+	print "\n";
+	print "// x 2^n for whole n from -252 to 252, with 2^n as two factors so that results in the denormals come out\n";
+	print "inline __m128 SimdScaleByPowerOfTwo(const __m128& x, const __m128i& n)\n";
+	print "{\n";
+	print "\t__m128i half = _mm_srai_epi32(n, 1);\n";
+	print "\t__m128 first = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(half, _mm_set1_epi32(127)), 23));\n";
+	print "\t__m128 second = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(n, half), _mm_set1_epi32(127)), 23));\n";
+	print "\treturn _mm_mul_ps(_mm_mul_ps(x, first), second);\n";
+	print "}\n";
+	print "\n";
+	print "// e^x (the Cephes expf polynomial: x = n ln 2 + r with |r| <= ln 2 / 2, and e^r from a degree 7 polynomial). Relative\n";
+	print "// error below 1e-7 for normal results. Overflows to infinity above 88.72 and underflows through the denormals to 0 below -103.97\n";
+	print "inline __m128 SimdExp(const __m128& x)\n";
+	print "{\n";
+	print "\t__m128 clamped = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-104.0f)), _mm_set1_ps(89.0f));\n";
+	print "\t__m128i n = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(1.44269504088896341f))); // Rounded to nearest\n";
+	print "\t__m128 fn = _mm_cvtepi32_ps(n);\n";
+	print "\t// ln 2 in two parts, the first short enough that fn times it is exact\n";
+	print "\t__m128 r = _mm_sub_ps(_mm_sub_ps(clamped, _mm_mul_ps(fn, _mm_set1_ps(0.693359375f))), _mm_mul_ps(fn, _mm_set1_ps(-2.12194440e-4f)));\n";
+	print "\t__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(1.9875691500e-4f), r), _mm_set1_ps(1.3981999507e-3f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(8.3334519073e-3f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(4.1665795894e-2f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.6666665459e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.0000001201e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, _mm_mul_ps(r, r)), r), _mm_set1_ps(1.0f));\n";
+	print "\treturn SimdKeepNaN(x, SimdScaleByPowerOfTwo(p, n));\n";
+	print "}\n";
+	print "\n";
+	print "// 2^x (the Cephes exp2f polynomial: x = n + r with |r| <= 1 / 2, and 2^r from a degree 6 polynomial). Relative error\n";
+	print "// below 1.5e-7 for normal results. Overflows to infinity from 128 and underflows through the denormals to 0 below -150\n";
+	print "inline __m128 SimdExp2(const __m128& x)\n";
+	print "{\n";
+	print "\t__m128 clamped = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-151.0f)), _mm_set1_ps(129.0f));\n";
+	print "\t__m128i n = _mm_cvtps_epi32(clamped);\n";
+	print "\t__m128 r = _mm_sub_ps(clamped, _mm_cvtepi32_ps(n));\n";
+	print "\t__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(1.535336188319500e-4f), r), _mm_set1_ps(1.339887440266574e-3f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(9.618437357674640e-3f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.550332471162809e-2f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(2.402264791363012e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(6.931472028550421e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.0f));\n";
+	print "\treturn SimdKeepNaN(x, SimdScaleByPowerOfTwo(p, n));\n";
+	print "}\n";
+	print "\n";
+	print "// The reduction shared by SimdLog() and SimdLog2() (Cephes logf): x = (1 + m) 2^e with 1 + m in [sqrt(1/2), sqrt(2)),\n";
+	print "// and the polynomial part of log(1 + m) = m - m^2 / 2 + m^3 P(m). Denormals are scaled by 2^23 first\n";
+	print "inline __m128 SimdLogReduce(const __m128& x, __m128& m, __m128& e)\n";
+	print "{\n";
+	print "\t__m128 denormal = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));\n";
+	print "\t__m128i bits = _mm_castps_si128(SimdBlend(denormal, _mm_mul_ps(x, _mm_set1_ps(8388608.0f)), x));\n";
+	print "\t__m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000))); // In [0.5, 1)\n";
+	print "\te = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));\n";
+	print "\te = _mm_sub_ps(e, _mm_and_ps(denormal, _mm_set1_ps(23.0f)));\n";
+	print "\t// Below sqrt(1/2), twice the mantissa and one less in the exponent\n";
+	print "\t__m128 below = _mm_cmplt_ps(mantissa, _mm_set1_ps(0.707106781186547524f));\n";
+	print "\te = _mm_sub_ps(e, _mm_and_ps(below, _mm_set1_ps(1.0f)));\n";
+	print "\tm = _mm_sub_ps(_mm_add_ps(mantissa, _mm_and_ps(below, mantissa)), _mm_set1_ps(1.0f));\n";
+	print "\t__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(7.0376836292e-2f), m), _mm_set1_ps(-1.1514610310e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.1676998740e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.2420140846e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.4249322787e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.6668057665e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(2.0000714765e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-2.4999993993e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(3.3333331174e-1f));\n";
+	print "\treturn _mm_mul_ps(_mm_mul_ps(p, m), _mm_mul_ps(m, m));\n";
+	print "}\n";
+	print "\n";
+	print "// The logarithm of 0 is -infinity, of infinity infinity, and of negative numbers and NaN NaN\n";
+	print "inline __m128 SimdLogSpecialValues(const __m128& x, const __m128& result)\n";
+	print "{\n";
+	print "\t__m128 infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());\n";
+	print "\t__m128 special = SimdBlend(_mm_cmpeq_ps(x, infinity), infinity, result);\n";
+	print "\tspecial = SimdBlend(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_setzero_ps(), infinity), special);\n";
+	print "\treturn _mm_or_ps(special, _mm_cmpnge_ps(x, _mm_setzero_ps())); // All bits set is a NaN\n";
+	print "}\n";
+	print "\n";
+	print "// Natural logarithm (Cephes logf). Absolute error below 5e-8 for x in [0.5, 2] (around 1, where the result is\n";
+	print "// near 0), relative error below 1e-7 elsewhere\n";
+	print "inline __m128 SimdLog(const __m128& x)\n";
+	print "{\n";
+	print "\t__m128 m, e;\n";
+	print "\t__m128 y = SimdLogReduce(x, m, e);\n";
+	print "\ty = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));\n";
+	print "\ty = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), _mm_mul_ps(m, m)));\n";
+	print "\treturn SimdLogSpecialValues(x, _mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(0.693359375f))));\n";
+	print "}\n";
+	print "\n";
+	print "// Base 2 logarithm (Cephes log2f). Powers of two are exact; absolute error below 1e-7 for x in [0.5, 2], relative\n";
+	print "// error below 1e-7 elsewhere\n";
+	print "inline __m128 SimdLog2(const __m128& x)\n";
+	print "{\n";
+	print "\t__m128 m, e;\n";
+	print "\t__m128 y = SimdLogReduce(x, m, e);\n";
+	print "\ty = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), _mm_mul_ps(m, m)));\n";
+	print "\t// log2(e) - 1, so that the products are small corrections to y + m\n";
+	print "\t__m128 log2eMinusOne = _mm_set1_ps(0.44269504088896340736f);\n";
+	print "\t__m128 z = _mm_add_ps(_mm_mul_ps(y, log2eMinusOne), _mm_mul_ps(m, log2eMinusOne));\n";
+	print "\treturn SimdLogSpecialValues(x, _mm_add_ps(_mm_add_ps(_mm_add_ps(z, y), m), e));\n";
+	print "}\n";
+	print "\n";
+	print "// x^y as 2^(y log2(|x|)). Relative error below 1.5e-7 * (1 + |y log2(x)|), so it grows towards the ends of the float\n";
+	print "// range. Negative finite x gives a negative result for odd whole y and NaN for y that is not whole; y = 0 and x = 1\n";
+	print "// give 1 even when the other is NaN, and so does x = -1 with infinite y\n";
+	print "inline __m128 SimdPow(const __m128& x, const __m128& y)\n";
+	print "{\n";
+	print "\t__m128 signMask = _mm_set1_ps(-0.0f);\n";
+	print "\t__m128 one = _mm_set1_ps(1.0f);\n";
+	print "\t__m128 infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());\n";
+	print "\t__m128 result = SimdExp2(_mm_mul_ps(y, SimdLog2(_mm_andnot_ps(signMask, x))));\n";
+	print "\t__m128 whole = _mm_cmpeq_ps(SimdFloor(y), y);\n";
+	print "\t__m128 oddSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_cvttps_epi32(y), 31)); // From 2^31 the conversion gives 0x80000000, and those are even anyway\n";
+	print "\tresult = _mm_or_ps(result, _mm_and_ps(_mm_and_ps(x, signMask), _mm_and_ps(whole, oddSign)));\n";
+	print "\tresult = _mm_or_ps(result, _mm_andnot_ps(whole, _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_cmpneq_ps(x, _mm_sub_ps(_mm_setzero_ps(), infinity)))));\n";
+	print "\tresult = SimdBlend(_mm_and_ps(_mm_cmpeq_ps(x, _mm_set1_ps(-1.0f)), _mm_cmpeq_ps(_mm_andnot_ps(signMask, y), infinity)), one, result);\n";
+	print "\treturn SimdBlend(_mm_or_ps(_mm_cmpeq_ps(y, _mm_setzero_ps()), _mm_cmpeq_ps(x, one)), one, result);\n";
+	print "}\n";
+	print "\n";
+	print "// Sine and cosine of four angles at once (the Cephes single-precision polynomials: the angle is reduced to within\n";
+	print "// pi / 4 of a multiple of pi / 2 in three steps, then the polynomial for that octant is picked). Within 2e-7 of sin()\n";
+	print "// and cos() up to 8192 radians; lanes past that (and infinities) are done by sin() and cos()\n";
+	print "inline void SimdSinCos(const __m128& angles, __m128& sine, __m128& cosine)\n";
+	print "{\n";
+	print "\t__m128 signMask = _mm_set1_ps(-0.0f);\n";
+	print "\t__m128 x = _mm_andnot_ps(signMask, angles);\n";
+	print "\t__m128 sineSign = _mm_and_ps(angles, signMask);\n";
+	print "\n";
+	print "\t// Octant j, rounded up to even, and the angle less j pi / 4\n";
+	print "\t__m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));\n";
+	print "\tj = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));\n";
+	print "\t__m128 y = _mm_cvtepi32_ps(j);\n";
+	print "\tx = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));\n";
+	print "\tx = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));\n";
+	print "\tx = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));\n";
+	print "\tsineSign = _mm_xor_ps(sineSign, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));\n";
+	print "\t__m128 cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));\n";
+	print "\t__m128 sinePolynomial = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));\n";
+	print "\n";
+	print "\t__m128 z = _mm_mul_ps(x, x);\n";
+	print "\t__m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), z), _mm_set1_ps(-1.388731625493765e-3f));\n";
+	print "\tc = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(4.166664568298827e-2f));\n";
+	print "\tc = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(c, z), z), _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));\n";
+	print "\t__m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), z), _mm_set1_ps(8.3321608736e-3f));\n";
+	print "\ts = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(-1.6666654611e-1f));\n";
+	print "\ts = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), x), x);\n";
+	print "\n";
+	print "\tsine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(sinePolynomial, s), _mm_andnot_ps(sinePolynomial, c)), sineSign);\n";
+	print "\tcosine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(sinePolynomial, c), _mm_andnot_ps(sinePolynomial, s)), cosineSign);\n";
+	print "\n";
+	print "\tif (_mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(signMask, angles), _mm_set1_ps(8192.0f))) != 0)\n";
+	print "\t{\n";
+	print "\t\tfloat lanes[4], sines[4], cosines[4];\n";
+	print "\t\t_mm_storeu_ps(lanes, angles);\n";
+	print "\t\t_mm_storeu_ps(sines, sine);\n";
+	print "\t\t_mm_storeu_ps(cosines, cosine);\n";
+	print "\t\tfor (unsigned lane = 0; lane < 4; lane++)\n";
+	print "\t\t{\n";
+	print "\t\t\tif (fabs(lanes[lane]) > 8192.0f)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tsines[lane] = sin(lanes[lane]);\n";
+	print "\t\t\t\tcosines[lane] = cos(lanes[lane]);\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\tsine = _mm_loadu_ps(sines);\n";
+	print "\t\tcosine = _mm_loadu_ps(cosines);\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+	print "inline __m128 SimdSin(const __m128& x) { __m128 sine, cosine; SimdSinCos(x, sine, cosine); return sine; }\n";
+	print "inline __m128 SimdCos(const __m128& x) { __m128 sine, cosine; SimdSinCos(x, sine, cosine); return cosine; }\n";
+	print "// Relative error below 4e-7 up to 8192 radians, except within 1e-3 of the odd multiples of pi / 2 where tan() goes to infinity\n";
+	print "inline __m128 SimdTan(const __m128& x) { __m128 sine, cosine; SimdSinCos(x, sine, cosine); return _mm_div_ps(sine, cosine); }\n";
+	print "\n";
+	print "// atan2(y, x) (the Cephes atanf polynomial for a = min(|x|, |y|) / max(|x|, |y|), which is within [0, 1], then moved\n";
+	print "// into the octant of (x, y)). Relative error below 3e-7. Both zero give 0 or pi with the signs atan2() gives, both\n";
+	print "// infinite the odd multiples of pi / 4, and NaN in either gives NaN\n";
+	print "inline __m128 SimdAtan2(const __m128& y, const __m128& x)\n";
+	print "{\n";
+	print "\t__m128 signMask = _mm_set1_ps(-0.0f);\n";
+	print "\t__m128 one = _mm_set1_ps(1.0f);\n";
+	print "\t__m128 absY = _mm_andnot_ps(signMask, y);\n";
+	print "\t__m128 absX = _mm_andnot_ps(signMask, x);\n";
+	print "\t__m128 smaller = _mm_min_ps(absY, absX);\n";
+	print "\t__m128 larger = _mm_max_ps(absY, absX);\n";
+	print "\t__m128 a = SimdBlend(_mm_cmpeq_ps(smaller, larger), one, _mm_div_ps(smaller, larger));\n";
+	print "\ta = _mm_andnot_ps(_mm_cmpeq_ps(larger, _mm_setzero_ps()), a);\n";
+	print "\t// Above tan(pi / 8), atan(a) = pi / 4 + atan((a - 1) / (a + 1))\n";
+	print "\t__m128 above = _mm_cmpgt_ps(a, _mm_set1_ps(0.4142135623730950f));\n";
+	print "\ta = SimdBlend(above, _mm_div_ps(_mm_sub_ps(a, one), _mm_add_ps(a, one)), a);\n";
+	print "\t__m128 z = _mm_mul_ps(a, a);\n";
+	print "\t__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(8.05374449538e-2f), z), _mm_set1_ps(-1.38776856032e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(1.99777106478e-1f));\n";
+	print "\tp = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(-3.33329491539e-1f));\n";
+	print "\t__m128 angle = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), a), a), _mm_and_ps(above, _mm_set1_ps(0.785398163397448f)));\n";
+	print "\t// pi / 2 - angle where |y| > |x|, pi - angle where x is negative (-0 included), then the sign of y\n";
+	print "\tangle = SimdBlend(_mm_cmpgt_ps(absY, absX), _mm_sub_ps(_mm_set1_ps(1.570796326794897f), angle), angle);\n";
+	print "\tangle = SimdBlend(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31)), _mm_sub_ps(_mm_set1_ps(3.141592653589793f), angle), angle);\n";
+	print "\tangle = _mm_or_ps(angle, _mm_and_ps(y, signMask));\n";
+	print "\treturn _mm_or_ps(angle, _mm_cmpunord_ps(y, x));\n";
+	print "}\n";
+	print "#endif // SVML_USE_SSE && __SSE2__\n";
+	print "\n";
+}
+
+# Explicit specializations of the member functions that touch every component
+sub PrintSimdMembers
+{
+	my($dimension) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	$vector = SimdVector($dimension);
+
+	print "// " . $dimension . "D SSE member specializations\n";
+	SimdBegin();
+	if ($dimension == 3)
+	{
+		print "template <> inline " . $vector . "::VECTOR3(const float& x, const float& y, const float& z) { simd = _mm_set_ps(0.0f, z, y, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR3(const VECTOR2<float>& xy, const float& z) { simd = _mm_set_ps(0.0f, z, xy.y, xy.x); }\n";
+		print "template <> inline " . $vector . "::VECTOR3(const float& x, const VECTOR2<float>& yz) { simd = _mm_set_ps(0.0f, yz.y, yz.x, x); }\n";
+	}
+	else
+	{
+		print "template <> inline " . $vector . "::VECTOR4(const float& x, const float& y, const float& z, const float& w) { simd = _mm_set_ps(w, z, y, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const float& x, const float& y, const VECTOR2<float>& zw) { simd = _mm_set_ps(zw.y, zw.x, y, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const float& x, const VECTOR2<float>& yz, const float& w) { simd = _mm_set_ps(w, yz.y, yz.x, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const VECTOR2<float>& xy, const float& z, const float& w) { simd = _mm_set_ps(w, z, xy.y, xy.x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const VECTOR2<float>& xy, const VECTOR2<float>& zw) { simd = _mm_set_ps(zw.y, zw.x, xy.y, xy.x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const float& x, const VECTOR3<float>& yzw) { simd = _mm_set_ps(yzw.z, yzw.y, yzw.x, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const VECTOR3<float>& xyz, const float& w) { simd = SimdReplaceW(xyz.Simd(), _mm_set1_ps(w)); }\n";
+	}
+	print "template <> inline const " . $vector . "& " . $vector . "::operator+=(const " . $vector . "& rhs) { simd = _mm_add_ps(simd, rhs.simd); return *this; }\n";
+	print "template <> inline const " . $vector . "& " . $vector . "::operator-=(const " . $vector . "& rhs) { simd = _mm_sub_ps(simd, rhs.simd); return *this; }\n";
+	print "template <> inline const " . $vector . "& " . $vector . "::operator*=(const " . $vector . "& rhs) { simd = _mm_mul_ps(simd, rhs.simd); return *this; }\n";
+	print "template <> inline const " . $vector . "& " . $vector . "::operator/=(const " . $vector . "& rhs) { simd = _mm_div_ps(simd, " . SimdDivisor("float", $dimension, "rhs.simd") . "); return *this; }\n";
+	print "template <> inline const " . $vector . "& " . $vector . "::operator*=(const float& rhs) { simd = _mm_mul_ps(simd, _mm_set1_ps(rhs)); return *this; }\n";
+	print "template <> inline const " . $vector . "& " . $vector . "::operator/=(const float& rhs) { simd = _mm_div_ps(simd, _mm_set1_ps(rhs)); return *this; }\n";
+	if ($dimension == 3)
+	{
+		print "template <> inline " . $vector . " " . $vector . "::operator-() const { return " . $vector . "(_mm_xor_ps(simd, _mm_set1_ps(-0.0f))); }\n";
+	}
+	else
+	{
+		print "template <> inline " . $vector . " " . $vector . "::operator-() const { return " . $vector . "(_mm_xor_ps(simd, _mm_set_ps(0.0f, -0.0f, -0.0f, -0.0f))); }\n";
+	}
+	SimdEnd();
+	print "\n";
+
+	$vector = "VECTOR" . $dimension . "<int>";
+
+	print "// " . $dimension . "D SSE4.1 integer member specializations (division stays component by component)\n";
+	SimdKindBegin("int");
+	if ($dimension == 3)
+	{
+		print "template <> inline " . $vector . "::VECTOR3(const int& x, const int& y, const int& z) { simd = _mm_set_epi32(0, z, y, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR3(const VECTOR2<int>& xy, const int& z) { simd = _mm_set_epi32(0, z, xy.y, xy.x); }\n";
+		print "template <> inline " . $vector . "::VECTOR3(const int& x, const VECTOR2<int>& yz) { simd = _mm_set_epi32(0, yz.y, yz.x, x); }\n";
+	}
+	else
+	{
+		print "template <> inline " . $vector . "::VECTOR4(const int& x, const int& y, const int& z, const int& w) { simd = _mm_set_epi32(w, z, y, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const int& x, const int& y, const VECTOR2<int>& zw) { simd = _mm_set_epi32(zw.y, zw.x, y, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const int& x, const VECTOR2<int>& yz, const int& w) { simd = _mm_set_epi32(w, yz.y, yz.x, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const VECTOR2<int>& xy, const int& z, const int& w) { simd = _mm_set_epi32(w, z, xy.y, xy.x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const VECTOR2<int>& xy, const VECTOR2<int>& zw) { simd = _mm_set_epi32(zw.y, zw.x, xy.y, xy.x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const int& x, const VECTOR3<int>& yzw) { simd = _mm_set_epi32(yzw.z, yzw.y, yzw.x, x); }\n";
+		print "template <> inline " . $vector . "::VECTOR4(const VECTOR3<int>& xyz, const int& w) { simd = _mm_insert_epi32(xyz.Simd(), w, 3); }\n";
+	}
+	print "template <> inline const " . $vector . "& " . $vector . "::operator+=(const " . $vector . "& rhs) { simd = _mm_add_epi32(simd, rhs.simd); return *this; }\n";
+	print "template <> inline const " . $vector . "& " . $vector . "::operator-=(const " . $vector . "& rhs) { simd = _mm_sub_epi32(simd, rhs.simd); return *this; }\n";
+	print "template <> inline const " . $vector . "& " . $vector . "::operator*=(const " . $vector . "& rhs) { simd = _mm_mullo_epi32(simd, rhs.simd); return *this; }\n";
+	print "template <> inline const " . $vector . "& " . $vector . "::operator*=(const int& rhs) { simd = _mm_mullo_epi32(simd, _mm_set1_epi32(rhs)); return *this; }\n";
+	if ($dimension == 3)
+	{
+		print "template <> inline " . $vector . " " . $vector . "::operator-() const { return " . $vector . "(_mm_sub_epi32(_mm_setzero_si128(), simd)); }\n";
+	}
+	else
+	{
+		print "template <> inline " . $vector . " " . $vector . "::operator-() const { return " . $vector . "(_mm_sign_epi32(simd, _mm_set_epi32(1, -1, -1, -1))); }\n";
+	}
+	SimdKindEnd("int");
+	print "\n";
+
+	if ($dimension < 4)
+	{
+		return;
+	}
+
+	$vector = "VECTOR4<double>";
+
+	print "// 4D AVX double member specializations, through unaligned loads and stores of the components\n";
+	SimdKindBegin("double");
+	print "inline " . $vector . " SimdStore4d(const __m256d& packed) { " . $vector . " result; _mm256_storeu_pd((double*)&result, packed); return result; }\n";
+	foreach $assignment (["+=", "_mm256_add_pd", "const " . $vector . "&", SimdLoad("double", "rhs")],
+	                     ["-=", "_mm256_sub_pd", "const " . $vector . "&", SimdLoad("double", "rhs")],
+	                     ["*=", "_mm256_mul_pd", "const " . $vector . "&", SimdLoad("double", "rhs")],
+	                     ["/=", "_mm256_div_pd", "const " . $vector . "&", SimdLoad("double", "rhs")],
+	                     ["*=", "_mm256_mul_pd", "const double&", "_mm256_set1_pd(rhs)"],
+	                     ["/=", "_mm256_div_pd", "const double&", "_mm256_set1_pd(rhs)"])
+	{
+		my($operator, $intrinsic, $parameter, $rhs) = @$assignment;
+		print "template <> inline const " . $vector . "& " . $vector . "::operator" . $operator . "(" . $parameter . " rhs) { _mm256_storeu_pd((double*)this, " . $intrinsic . "(" . SimdLoad("double", "*this") . ", " . $rhs . ")); return *this; }\n";
+	}
+	print "template <> inline " . $vector . " " . $vector . "::operator-() const { return SimdStore4d(_mm256_xor_pd(" . SimdLoad("double", "*this") . ", _mm256_set_pd(0.0, -0.0, -0.0, -0.0))); }\n";
+	SimdKindEnd("double");
+	print "\n";
+}
+
+# Component-wise vector/vector operator, such as + or *
+sub PrintSimdOperator
+{
+	my($dimension, $operator, $intrinsic) = @_;
+
+	foreach $kind (SimdKinds($dimension))
+	{
+		my $packed = SimdIntrinsic($kind, $intrinsic);
+		if ($packed eq "")
+		{
+			next;
+		}
+		my $vector = "VECTOR" . $dimension . "<" . $kind . ">";
+
+		SimdKindBegin($kind);
+		my $rhs = ($operator eq "/") ? SimdDivisor($kind, $dimension, SimdLoad($kind, "rhs")) : SimdLoad($kind, "rhs");
+		print "inline " . $vector . " operator" . $operator . "(const " . $vector . "& lhs, const " . $vector . "& rhs) { return " . SimdMake($kind, $dimension, $packed . "(" . SimdLoad($kind, "lhs") . ", " . $rhs . ")") . "; }\n";
+		SimdKindEnd($kind);
+		print "\n";
+	}
+}
+
+# Vector/scalar operator in both directions
+sub PrintSimdScalarOperator
+{
+	my($dimension, $operator, $intrinsic) = @_;
+
+	foreach $kind (SimdKinds($dimension))
+	{
+		my $packed = SimdIntrinsic($kind, $intrinsic);
+		if ($packed eq "")
+		{
+			next;
+		}
+		my $vector = "VECTOR" . $dimension . "<" . $kind . ">";
+		my $set = SimdIntrinsic($kind, "_mm_set1_ps");
+
+		SimdKindBegin($kind);
+		print "inline " . $vector . " operator" . $operator . "(const " . $vector . "& lhs, const " . SimdScalar($kind) . "& rhs) { return " . SimdMake($kind, $dimension, $packed . "(" . SimdLoad($kind, "lhs") . ", " . $set . "(rhs))") . "; }\n";
+		my $rhs = ($operator eq "/") ? SimdDivisor($kind, $dimension, SimdLoad($kind, "rhs")) : SimdLoad($kind, "rhs");
+		print "inline " . $vector . " operator" . $operator . "(const " . SimdScalar($kind) . "& lhs, const " . $vector . "& rhs) { return " . SimdMake($kind, $dimension, $packed . "(" . $set . "(lhs), " . $rhs . ")") . "; }\n";
+		SimdKindEnd($kind);
+		print "\n";
+	}
+}
+
+# Max and Min with the operands swapped so that ties and NaNs resolve like std::max and std::min
+sub PrintSimdMinMax
+{
+	my($dimension, $name, $intrinsic) = @_;
+
+	foreach $kind (SimdKinds($dimension))
+	{
+		my $vector = "VECTOR" . $dimension . "<" . $kind . ">";
+
+		SimdKindBegin($kind);
+		print "inline " . $vector . " " . $name . "(const " . $vector . "& a, const " . $vector . "& b) { return " . SimdMake($kind, $dimension, SimdIntrinsic($kind, $intrinsic) . "(" . SimdLoad($kind, "b") . ", " . SimdLoad($kind, "a") . ")") . "; }\n";
+		SimdKindEnd($kind);
+		print "\n";
+	}
+}
+
+sub PrintSimdScalarMinMax
+{
+	my($dimension, $name, $intrinsic, $parameter) = @_;
+
+	foreach $kind (SimdKinds($dimension))
+	{
+		my $vector = "VECTOR" . $dimension . "<" . $kind . ">";
+		my $packed = SimdIntrinsic($kind, $intrinsic);
+		my $set = SimdIntrinsic($kind, "_mm_set1_ps") . "(" . $parameter . ")";
+
+		SimdKindBegin($kind);
+		print "inline " . $vector . " " . $name . "(const " . $vector . "& a, const " . SimdScalar($kind) . "& " . $parameter . ") { return " . SimdMake($kind, $dimension, $packed . "(" . $set . ", " . SimdLoad($kind, "a") . ")") . "; }\n";
+		print "inline " . $vector . " " . $name . "(const " . SimdScalar($kind) . "& " . $parameter . ", const " . $vector . "& b) { return " . SimdMake($kind, $dimension, $packed . "(" . SimdLoad($kind, "b") . ", " . $set . ")") . "; }\n";
+		SimdKindEnd($kind);
+		print "\n";
+	}
+}
+
+# Ceil and Floor need SSE4.1's round instructions (AVX's for double), otherwise the template is used
+sub PrintSimdRound
+{
+	my($dimension, $name, $intrinsic, $parameter) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	$vector = SimdVector($dimension);
+
+	print "#if defined(SVML_USE_SSE) && defined(__SSE4_1__)\n";
+	print "inline " . $vector . " " . $name . "(const " . $vector . "& " . $parameter . ") { return " . $vector . "(" . $intrinsic . "(" . $parameter . ".Simd())); }\n";
+	print "#endif // SVML_USE_SSE && __SSE4_1__\n";
+	print "\n";
+
+	if ($dimension == 4)
+	{
+		SimdKindBegin("double");
+		print "inline VECTOR4<double> " . $name . "(const VECTOR4<double>& " . $parameter . ") { return SimdStore4d(" . SimdIntrinsic("double", $intrinsic) . "(" . SimdLoad("double", $parameter) . ")); }\n";
+		SimdKindEnd("double");
+		print "\n";
+	}
+}
+
+sub PrintSimdNormalize
+{
+	my($dimension) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	$vector = SimdVector($dimension);
+
+	SimdBegin();
+	print "inline " . $vector . " Normalize(const " . $vector . "& toNormalize)\n";
+	print "{\n";
+	print "#ifdef SVML_FAST_RSQRT\n";
+	print "\t__m128 scale = SimdReciprocalSqrt(SimdHorizontalAdd3(_mm_mul_ps(toNormalize.Simd(), toNormalize.Simd())));\n";
+	if ($dimension == 4)
+	{
+		print "\treturn " . $vector . "(_mm_mul_ps(toNormalize.Simd(), SimdReplaceW(_mm_shuffle_ps(scale, scale, 0), _mm_set1_ps(1.0f))));\n";
+	}
+	else
+	{
+		print "\treturn " . $vector . "(_mm_mul_ps(toNormalize.Simd(), _mm_shuffle_ps(scale, scale, 0)));\n";
+	}
+	print "#else\n";
+	print "\t__m128 length = _mm_sqrt_ss(SimdHorizontalAdd3(_mm_mul_ps(toNormalize.Simd(), toNormalize.Simd())));\n";
+	if ($dimension == 4)
+	{
+		print "\treturn " . $vector . "(_mm_div_ps(toNormalize.Simd(), SimdReplaceW(_mm_shuffle_ps(length, length, 0), _mm_set1_ps(1.0f))));\n";
+	}
+	else
+	{
+		print "\treturn " . $vector . "(_mm_div_ps(toNormalize.Simd(), _mm_shuffle_ps(length, length, 0)));\n";
+	}
+	print "#endif\n";
+	print "}\n";
+	SimdEnd();
+	print "\n";
+
+	if ($dimension < 4)
+	{
+		return;
+	}
+
+	SimdKindBegin("double");
+	print "inline VECTOR4<double> Normalize(const VECTOR4<double>& toNormalize)\n";
+	print "{\n";
+	print "\t__m256d packed = " . SimdLoad("double", "toNormalize") . ";\n";
+	print "#ifdef SVML_FAST_RSQRT\n";
+	print "\tdouble scale = PrecisionDivideBySqrt(1.0, SimdDot3d(packed, packed));\n";
+	print "\treturn SimdStore4d(_mm256_mul_pd(packed, _mm256_set_pd(1.0, scale, scale, scale)));\n";
+	print "#else\n";
+	print "\tdouble length = PrecisionSqrt(SimdDot3d(packed, packed));\n";
+	print "\treturn SimdStore4d(_mm256_div_pd(packed, _mm256_set_pd(1.0, length, length, length)));\n";
+	print "#endif\n";
+	print "}\n";
+	SimdKindEnd("double");
+	print "\n";
+}
+
+sub PrintSimdDot
+{
+	my($dimension) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	$vector = SimdVector($dimension);
+
+	SimdBegin();
+	print "inline SCALAR_TYPE Dot(const " . $vector . "& a, const " . $vector . "& b) { return SimdDot3(a.Simd(), b.Simd()); }\n";
+	SimdEnd();
+	print "\n";
+
+	SimdKindBegin("int");
+	print "inline int Dot(const VECTOR" . $dimension . "<int>& a, const VECTOR" . $dimension . "<int>& b) { return SimdDot3i(a.Simd(), b.Simd()); }\n";
+	SimdKindEnd("int");
+	print "\n";
+
+	if ($dimension == 4)
+	{
+		SimdKindBegin("double");
+		print "inline double Dot(const VECTOR4<double>& a, const VECTOR4<double>& b) { return SimdDot3d(" . SimdLoad("double", "a") . ", " . SimdLoad("double", "b") . "); }\n";
+		SimdKindEnd("double");
+		print "\n";
+	}
+}
+
+sub PrintSimdCross
+{
+	my($dimension) = @_;
+
+	$vector = SimdVector($dimension);
+
+	SimdBegin();
+	print "inline " . $vector . " Cross(const " . $vector . "& a, const " . $vector . "& b)\n";
+	print "{\n";
+	print "\t__m128 aYZX = _mm_shuffle_ps(a.Simd(), a.Simd(), _MM_SHUFFLE(3, 0, 2, 1));\n";
+	print "\t__m128 bYZX = _mm_shuffle_ps(b.Simd(), b.Simd(), _MM_SHUFFLE(3, 0, 2, 1));\n";
+	print "\t__m128 c = _mm_sub_ps(_mm_mul_ps(a.Simd(), bYZX), _mm_mul_ps(aYZX, b.Simd()));\n";
+	if ($dimension == 4)
+	{
+		print "\treturn " . $vector . "(SimdReplaceW(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)), a.Simd()));\n";
+	}
+	else
+	{
+		print "\treturn " . $vector . "(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));\n";
+	}
+	print "}\n";
+	SimdEnd();
+	print "\n";
+
+	$vector = "VECTOR" . $dimension . "<int>";
+
+	SimdKindBegin("int");
+	print "inline " . $vector . " Cross(const " . $vector . "& a, const " . $vector . "& b)\n";
+	print "{\n";
+	print "\t__m128i c = _mm_sub_epi32(_mm_mullo_epi32(a.Simd(), _mm_shuffle_epi32(b.Simd(), _MM_SHUFFLE(3, 0, 2, 1))), _mm_mullo_epi32(_mm_shuffle_epi32(a.Simd(), _MM_SHUFFLE(3, 0, 2, 1)), b.Simd()));\n";
+	if ($dimension == 4)
+	{
+		print "\treturn " . $vector . "(_mm_blend_epi16(_mm_shuffle_epi32(c, _MM_SHUFFLE(3, 0, 2, 1)), a.Simd(), 0xC0));\n";
+	}
+	else
+	{
+		print "\treturn " . $vector . "(_mm_shuffle_epi32(c, _MM_SHUFFLE(3, 0, 2, 1)));\n";
+	}
+	print "}\n";
+	SimdKindEnd("int");
+	print "\n";
+}
+
+sub PrintSimdProjection
+{
+	my($dimension) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	$vector = SimdVector($dimension);
+
+	SimdBegin();
+	print "inline " . $vector . " Project(const " . $vector . "& projectThis, const " . $vector . "& ontoThis)\n";
+	print "{\n";
+	print "\t__m128 scale = _mm_set1_ps(SimdDot3(projectThis.Simd(), ontoThis.Simd()) / SimdDot3(ontoThis.Simd(), ontoThis.Simd()));\n";
+	if ($dimension == 4)
+	{
+		print "\treturn " . $vector . "(_mm_mul_ps(SimdReplaceW(scale, _mm_set1_ps(1.0f)), ontoThis.Simd()));\n";
+	}
+	else
+	{
+		print "\treturn " . $vector . "(_mm_mul_ps(scale, ontoThis.Simd()));\n";
+	}
+	print "}\n";
+	SimdEnd();
+	print "\n";
+
+	if ($dimension < 4)
+	{
+		return;
+	}
+
+	SimdKindBegin("double");
+	print "inline VECTOR4<double> Project(const VECTOR4<double>& projectThis, const VECTOR4<double>& ontoThis)\n";
+	print "{\n";
+	print "\t__m256d onto = " . SimdLoad("double", "ontoThis") . ";\n";
+	print "\tdouble scale = SimdDot3d(" . SimdLoad("double", "projectThis") . ", onto) / SimdDot3d(onto, onto);\n";
+	print "\treturn SimdStore4d(_mm256_mul_pd(_mm256_set_pd(1.0, scale, scale, scale), onto));\n";
+	print "}\n";
+	SimdKindEnd("double");
+	print "\n";
+}
+
+sub PrintSimdDistance
+{
+	my($dimension) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	$vector = SimdVector($dimension);
+
+	SimdBegin();
+	print "inline SCALAR_TYPE Distance(const " . $vector . "& a, const " . $vector . "& b) { __m128 d = _mm_sub_ps(a.Simd(), b.Simd()); return PrecisionSqrt(SimdDot3(d, d)); }\n";
+	SimdEnd();
+	print "\n";
+
+	if ($dimension == 4)
+	{
+		SimdKindBegin("double");
+		print "inline double Distance(const VECTOR4<double>& a, const VECTOR4<double>& b) { __m256d d = _mm256_sub_pd(" . SimdLoad("double", "a") . ", " . SimdLoad("double", "b") . "); return PrecisionSqrt(SimdDot3d(d, d)); }\n";
+		SimdKindEnd("double");
+		print "\n";
+	}
+}
+
+sub PrintSimdDistanceSquared
+{
+	my($dimension) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	$vector = SimdVector($dimension);
+
+	SimdBegin();
+	print "inline SCALAR_TYPE DistanceSquared(const " . $vector . "& a, const " . $vector . "& b) { __m128 d = _mm_sub_ps(a.Simd(), b.Simd()); return SimdDot3(d, d); }\n";
+	SimdEnd();
+	print "\n";
+
+	SimdKindBegin("int");
+	print "inline int DistanceSquared(const VECTOR" . $dimension . "<int>& a, const VECTOR" . $dimension . "<int>& b) { __m128i d = _mm_sub_epi32(a.Simd(), b.Simd()); return SimdDot3i(d, d); }\n";
+	SimdKindEnd("int");
+	print "\n";
+
+	if ($dimension == 4)
+	{
+		SimdKindBegin("double");
+		print "inline double DistanceSquared(const VECTOR4<double>& a, const VECTOR4<double>& b) { __m256d d = _mm256_sub_pd(" . SimdLoad("double", "a") . ", " . SimdLoad("double", "b") . "); return SimdDot3d(d, d); }\n";
+		SimdKindEnd("double");
+		print "\n";
+	}
+}
+
+sub PrintSimdLerp
+{
+	my($dimension) = @_;
+
+	foreach $kind (SimdKinds($dimension))
+	{
+		my $vector = "VECTOR" . $dimension . "<" . $kind . ">";
+		my($add, $multiply, $subtract, $set) = map { SimdIntrinsic($kind, $_) } ("_mm_add_ps", "_mm_mul_ps", "_mm_sub_ps", "_mm_set1_ps");
+		my($start, $end) = (SimdLoad($kind, "start"), SimdLoad($kind, "end"));
+
+		SimdKindBegin($kind);
+		if ($kind eq "int")
+		{
+			# The delta is a float, so the lanes are interpolated in float and truncated back like the scalar code
+			print "inline " . $vector . " Lerp(const " . $vector . "& start, const " . $vector . "& end, const SCALAR_TYPE& delta) { return " . $vector . "(_mm_cvttps_epi32(_mm_add_ps(_mm_cvtepi32_ps(" . $start . "), _mm_mul_ps(_mm_set1_ps(delta), _mm_cvtepi32_ps(_mm_sub_epi32(" . $end . ", " . $start . ")))))); }\n";
+		}
+		else
+		{
+			print "inline " . $vector . " Lerp(const " . $vector . "& start, const " . $vector . "& end, const " . SimdScalar($kind) . "& delta) { return " . SimdMake($kind, $dimension, $add . "(" . $start . ", " . $multiply . "(" . $set . "(delta), " . $subtract . "(" . $end . ", " . $start . ")))") . "; }\n";
+		}
+		SimdKindEnd($kind);
+		print "\n";
+	}
+}
+
+# Component-wise comparisons: the compare instruction's lanes are packed into the mask's bits with a movemask. Integers
+# have no less-or-equal compare, so those take the complement of the opposite one
+%simdComparison = ("Equal" => ["_mm_cmpeq_ps", "_mm_cmpeq_epi32", 0, "_CMP_EQ_OQ"], "NotEqual" => ["_mm_cmpneq_ps", "_mm_cmpeq_epi32", 1, "_CMP_NEQ_UQ"],
+                   "LessThan" => ["_mm_cmplt_ps", "_mm_cmplt_epi32", 0, "_CMP_LT_OQ"], "GreaterThan" => ["_mm_cmpgt_ps", "_mm_cmpgt_epi32", 0, "_CMP_GT_OQ"],
+                   "LessThanEqual" => ["_mm_cmple_ps", "_mm_cmpgt_epi32", 1, "_CMP_LE_OQ"], "GreaterThanEqual" => ["_mm_cmpge_ps", "_mm_cmplt_epi32", 1, "_CMP_GE_OQ"]);
+
+sub PrintSimdComparisonMasks
+{
+	my($dimension) = @_;
+
+	my $mask = "MASK" . $dimension;
+
+	foreach $kind (SimdKinds($dimension))
+	{
+		my $vector = "VECTOR" . $dimension . "<" . $kind . ">";
+		my($lhs, $rhs) = (SimdLoad($kind, "lhs"), SimdLoad($kind, "rhs"));
+
+		SimdKindBegin($kind);
+		foreach $name ("Equal", "NotEqual", "LessThan", "GreaterThan", "LessThanEqual", "GreaterThanEqual")
+		{
+			my($floatCompare, $intCompare, $complement, $predicate) = @{$simdComparison{$name}};
+			my $bits;
+			if ($kind eq "float")
+			{
+				$bits = "_mm_movemask_ps(" . $floatCompare . "(" . $lhs . ", " . $rhs . "))";
+			}
+			elsif ($kind eq "int")
+			{
+				$bits = (($complement) ? "~" : "") . "_mm_movemask_ps(_mm_castsi128_ps(" . $intCompare . "(" . $lhs . ", " . $rhs . ")))";
+			}
+			else
+			{
+				$bits = "_mm256_movemask_pd(_mm256_cmp_pd(" . $lhs . ", " . $rhs . ", " . $predicate . "))";
+			}
+			print "inline " . $mask . " " . $name . "(const " . $vector . "& lhs, const " . $vector . "& rhs) { return " . $mask . "::FromBits(" . $bits . "); }\n";
+		}
+		if ($kind ne "int")
+		{
+			my($andNot, $subtract, $set, $lessThan) = map { SimdIntrinsic($kind, $_) } ("_mm_andnot_ps", "_mm_sub_ps", "_mm_set1_ps", "_mm_cmplt_ps");
+			my $distance = $andNot . "(" . $set . "(-0.0" . (($kind eq "float") ? "f" : "") . "), " . $subtract . "(" . $lhs . ", " . $rhs . "))";
+			my $epsilon = $set . "(ScalarType<" . $kind . ">::Epsilon())";
+			my $bits = ($kind eq "float") ? "_mm_movemask_ps(" . $lessThan . "(" . $distance . ", " . $epsilon . "))" : "_mm256_movemask_pd(_mm256_cmp_pd(" . $distance . ", " . $epsilon . ", _CMP_LT_OQ))";
+			print "inline " . $mask . " AlmostEqualMask(const " . $vector . "& lhs, const " . $vector . "& rhs) { return " . $mask . "::FromBits(" . $bits . "); }\n";
+		}
+		SimdKindEnd($kind);
+		print "\n";
+	}
+}
+
+# Select() as a blend: float vectors need SSE2 to turn the mask's bits into lanes, int vectors already have SSE4.1
+sub PrintSimdSelect
+{
+	my($dimension) = @_;
+
+	my $mask = "MASK" . $dimension;
+
+	foreach $kind (SimdKinds($dimension))
+	{
+		my $vector = "VECTOR" . $dimension . "<" . $kind . ">";
+
+		if ($kind eq "float")
+		{
+			print "#if defined(SVML_USE_SSE) && defined(__SSE2__)\n";
+			print "inline " . $vector . " Select(const " . $mask . "& mask, const " . $vector . "& a, const " . $vector . "& b) { return " . SimdMake($kind, $dimension, "SimdBlend(SimdLaneMask(mask.bits), a.Simd(), b.Simd())") . "; }\n";
+			print "#endif // SVML_USE_SSE && __SSE2__\n";
+			print "\n";
+		}
+		elsif ($kind eq "int")
+		{
+			SimdKindBegin($kind);
+			print "inline " . $vector . " Select(const " . $mask . "& mask, const " . $vector . "& a, const " . $vector . "& b) { return " . SimdMake($kind, $dimension, "_mm_castps_si128(SimdBlend(SimdLaneMask(mask.bits), _mm_castsi128_ps(a.Simd()), _mm_castsi128_ps(b.Simd())))") . "; }\n";
+			SimdKindEnd($kind);
+			print "\n";
+		}
+	}
+}
+
+# Float overloads of the common functions, for 3D and 4D. $packed is the __m128 of the result, from the parameters'
+# registers; $guard is "" for those SSE has the instructions for, or "__SSE2__" for those that need its integers
+sub PrintSimdComponentWise
+{
+	my($dimension, $name, $parameters, $guard, $packed) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	my $vector = SimdVector($dimension);
+	my @declarations = map { "const " . (($$_[1] eq "vector") ? $vector : "SCALAR_TYPE") . "& " . $$_[0] } @$parameters;
+
+	print ($guard eq "" ? "#ifdef SVML_USE_SSE\n" : "#if defined(SVML_USE_SSE) && defined(" . $guard . ")\n");
+	print "inline " . $vector . " " . $name . "(" . join(", ", @declarations) . ") { return " . $vector . "(" . $packed . "); }\n";
+	print ($guard eq "" ? "#endif // SVML_USE_SSE\n" : "#endif // SVML_USE_SSE && " . $guard . "\n");
+	print "\n";
+}
+
+sub PrintSimdSinCos
+{
+	my($dimension) = @_;
+
+	if ($dimension < 3)
+	{
+		return;
+	}
+
+	my $vector = SimdVector($dimension);
+
+	print "#if defined(SVML_USE_SSE) && defined(__SSE2__)\n";
+	print "inline void SinCos(const " . $vector . "& x, " . $vector . "& sine, " . $vector . "& cosine)\n";
+	print "{\n";
+	print "\t__m128 s, c;\n";
+	print "\tSimdSinCos(x.Simd(), s, c);\n";
+	print "\tsine = " . $vector . "(s);\n";
+	print "\tcosine = " . $vector . "(c);\n";
+	print "}\n";
+	print "#endif // SVML_USE_SSE && __SSE2__\n";
+	print "\n";
+}
+
+# 2x2 block helpers and the column multiply shared by the 4x4 matrix overloads
+sub PrintSimdMatrixUtilities
+{
+	SimdBegin();
+	print "// 2x2 blocks of a 4x4 matrix, packed (m00, m01, m10, m11); used by the 4x4 Inverse()\n";
+	print "inline __m128 SimdMatrix2Multiply(const __m128& a, const __m128& b)\n";
+	print "{\n";
+	print "\treturn _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));\n";
+	print "}\n";
+	print "\n";
+	print "// Adjugate(a) * b\n";
+	print "inline __m128 SimdMatrix2AdjugateMultiply(const __m128& a, const __m128& b)\n";
+	print "{\n";
+	print "\treturn _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));\n";
+	print "}\n";
+	print "\n";
+	print "// a * Adjugate(b)\n";
+	print "inline __m128 SimdMatrix2MultiplyAdjugate(const __m128& a, const __m128& b)\n";
+	print "{\n";
+	print "\treturn _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));\n";
+	print "}\n";
+	print "\n";
+	print "// Columns scaled by the components of v, summed in order (matching the scalar code)\n";
+	print "inline __m128 SimdMatrix4Multiply(const __m128& c0, const __m128& c1, const __m128& c2, const __m128& c3, const __m128& v)\n";
+	print "{\n";
+	print "\t__m128 result = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));\n";
+	print "\tresult = _mm_add_ps(result, _mm_mul_ps(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));\n";
+	print "\treturn _mm_add_ps(result, _mm_mul_ps(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));\n";
+	print "}\n";
+	SimdEnd();
+	print "\n";
+}
+
+# MATRIX4<float> overloads: multiplication, Transpose(), Inverse(), and batch Transform()
+sub PrintSimdMatrix
+{
+	my($dimension) = @_;
+
+	if ($dimension < 4)
+	{
+		return;
+	}
+
+	print "// 4x4 SSE overloads\n";
+	SimdBegin();
+	print "inline VECTOR4<float> operator*(const MATRIX4<float>& lhs, const VECTOR4<float>& rhs)\n";
+	print "{\n";
+	print "\treturn VECTOR4<float>(SimdMatrix4Multiply(lhs[0].Simd(), lhs[1].Simd(), lhs[2].Simd(), lhs[3].Simd(), rhs.Simd()));\n";
+	print "}\n";
+	print "\n";
+	print "inline MATRIX4<float> operator*(const MATRIX4<float>& lhs, const MATRIX4<float>& rhs)\n";
+	print "{\n";
+	print "\t__m128 c0 = lhs[0].Simd(), c1 = lhs[1].Simd(), c2 = lhs[2].Simd(), c3 = lhs[3].Simd();\n";
+	print "\treturn MATRIX4<float>(VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, rhs[0].Simd())),\n";
+	print "\t                      VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, rhs[1].Simd())),\n";
+	print "\t                      VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, rhs[2].Simd())),\n";
+	print "\t                      VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, rhs[3].Simd())));\n";
+	print "}\n";
+	print "\n";
+	print "inline MATRIX4<float> Transpose(const MATRIX4<float>& m)\n";
+	print "{\n";
+	print "\t__m128 c0 = m[0].Simd(), c1 = m[1].Simd(), c2 = m[2].Simd(), c3 = m[3].Simd();\n";
+	print "\t_MM_TRANSPOSE4_PS(c0, c1, c2, c3);\n";
+	print "\treturn MATRIX4<float>(VECTOR4<float>(c0), VECTOR4<float>(c1), VECTOR4<float>(c2), VECTOR4<float>(c3));\n";
+	print "}\n";
+	print "\n";
+	print "// Block-wise inverse: with M = [A B; C D] in 2x2 blocks, each block of the result comes from 2x2 adjugates\n";
+	print "inline MATRIX4<float> Inverse(const MATRIX4<float>& m)\n";
+	print "{\n";
+	print "\t__m128 c0 = m[0].Simd(), c1 = m[1].Simd(), c2 = m[2].Simd(), c3 = m[3].Simd();\n";
+	print "\t__m128 A = _mm_movelh_ps(c0, c1), B = _mm_movehl_ps(c1, c0), C = _mm_movelh_ps(c2, c3), D = _mm_movehl_ps(c3, c2);\n";
+	print "\n";
+	print "\t// (det(A), det(B), det(C), det(D))\n";
+	print "\t__m128 detSub = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1))),\n";
+	print "\t                           _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0))));\n";
+	print "\t__m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));\n";
+	print "\t__m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));\n";
+	print "\t__m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));\n";
+	print "\t__m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));\n";
+	print "\n";
+	print "\t__m128 DC = SimdMatrix2AdjugateMultiply(D, C);\n";
+	print "\t__m128 AB = SimdMatrix2AdjugateMultiply(A, B);\n";
+	print "\t__m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), SimdMatrix2Multiply(B, DC));\n";
+	print "\t__m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), SimdMatrix2Multiply(C, AB));\n";
+	print "\t__m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), SimdMatrix2MultiplyAdjugate(D, AB));\n";
+	print "\t__m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), SimdMatrix2MultiplyAdjugate(A, DC));\n";
+	print "\n";
+	print "\t// det(M) = det(A) det(D) + det(B) det(C) - trace(Adjugate(A) B Adjugate(D) C)\n";
+	print "\t__m128 trace = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));\n";
+	print "\ttrace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));\n";
+	print "\ttrace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));\n";
+	print "\t__m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);\n";
+	print "\n";
+	print "\t__m128 scale = _mm_div_ps(_mm_set_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);\n";
+	print "\tX = _mm_mul_ps(X, scale);\n";
+	print "\tY = _mm_mul_ps(Y, scale);\n";
+	print "\tZ = _mm_mul_ps(Z, scale);\n";
+	print "\tW = _mm_mul_ps(W, scale);\n";
+	print "\n";
+	print "\treturn MATRIX4<float>(VECTOR4<float>(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3))),\n";
+	print "\t                      VECTOR4<float>(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2))),\n";
+	print "\t                      VECTOR4<float>(_mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3))),\n";
+	print "\t                      VECTOR4<float>(_mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2))));\n";
+	print "}\n";
+	print "\n";
+	print "inline void Transform(VECTOR4<float>* out, const MATRIX4<float>& matrix, const VECTOR4<float>* in, const unsigned& count)\n";
+	print "{\n";
+	print "\t__m128 c0 = matrix[0].Simd(), c1 = matrix[1].Simd(), c2 = matrix[2].Simd(), c3 = matrix[3].Simd();\n";
+	print "\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, in[i].Simd()));\n";
+	print "\t}\n";
+	print "}\n";
+	SimdEnd();
+	print "\n";
+}
+
+return 1;
@@ -0,0 +1,511 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Structure-of-arrays batch types (VECTOR2_SOA, VECTOR3_SOA, VECTOR4_SOA) and their whole-array kernels
+
+sub SoaComponents
+{
+	my($dimension) = @_;
+
+	return ("x", "y", "z", "w")[0 .. $dimension - 1];
+}
+
+sub PrintSoaUtilities
+{
+	print "// Kernels process full blocks of SOA_LANES elements, then the remainder\n";
+	print "const unsigned SOA_LANES = 16;\n";
+	print "const unsigned SOA_ALIGNMENT = 64; // Bytes, one cache line\n";
+	print "\n";
+	print "// Predefines\n";
+	print "template <typename TYPE> struct VECTOR2_SOA_VIEW;\n";
+	print "template <typename TYPE> struct VECTOR3_SOA_VIEW;\n";
+	print "template <typename TYPE> struct VECTOR4_SOA_VIEW;\n";
+	print "template <typename TYPE> union VECTOR2_SOA;\n";
+	print "template <typename TYPE> union VECTOR3_SOA;\n";
+	print "template <typename TYPE> union VECTOR4_SOA;\n";
+	print "\n";
+	print "// Default types\n";
+	print "typedef VECTOR2_SOA<float> vec2_soa;\n";
+	print "typedef VECTOR3_SOA<float> vec3_soa;\n";
+	print "typedef VECTOR4_SOA<float> vec4_soa;\n";
+	print "\n";
+	print "// Generic types\n";
+	print "template <typename TYPE> struct IsSoa2D { enum { value = false }; };\n";
+	print "template <typename TYPE> struct IsSoa3D { enum { value = false }; };\n";
+	print "template <typename TYPE> struct IsSoa4D { enum { value = false }; };\n";
+	print "\n";
+	print "// Specific type\n";
+	print "template <typename TYPE> struct IsSoa2D< VECTOR2_SOA_VIEW<TYPE> > { enum { value = true }; };\n";
+	print "template <typename TYPE> struct IsSoa3D< VECTOR3_SOA_VIEW<TYPE> > { enum { value = true }; };\n";
+	print "template <typename TYPE> struct IsSoa4D< VECTOR4_SOA_VIEW<TYPE> > { enum { value = true }; };\n";
+	print "template <typename TYPE> struct ComponentType< VECTOR2_SOA_VIEW<TYPE> > { typedef TYPE type; };\n";
+	print "template <typename TYPE> struct ComponentType< VECTOR3_SOA_VIEW<TYPE> > { typedef TYPE type; };\n";
+	print "template <typename TYPE> struct ComponentType< VECTOR4_SOA_VIEW<TYPE> > { typedef TYPE type; };\n";
+	print "\n";
+	print "// Aligned lane storage, the offset to the malloc() block is stored just before the returned pointer\n";
+	print "inline void* AlignedAllocate(const size_t& bytes)\n";
+	print "{\n";
+	print "\tchar* block = (char*)malloc(bytes + SOA_ALIGNMENT + sizeof(size_t));\n";
+	print "\tif (block == 0) { return 0; }\n";
+	print "\tsize_t offset = SOA_ALIGNMENT - ((size_t)(block + sizeof(size_t)) % SOA_ALIGNMENT) + sizeof(size_t);\n";
+	print "\t*(size_t*)(block + offset - sizeof(size_t)) = offset;\n";
+	print "\treturn block + offset;\n";
+	print "}\n";
+	print "\n";
+	print "inline void AlignedFree(void* aligned)\n";
+	print "{\n";
+	print "\tif (aligned == 0) { return; }\n";
+	print "\tfree((char*)aligned - *((size_t*)aligned - 1));\n";
+	print "}\n";
+	print "\n";
+}
+
+# Non-owning set of lane pointers, used as the PARENT of the batch type and all of its swizzles
+sub MakeSoaViewType
+{
+	my($dimension) = @_;
+
+	@components = SoaComponents($dimension);
+
+	print "template <typename TYPE>\n";
+	print "struct VECTOR" . $dimension . "_SOA_VIEW\n";
+	print "{\n";
+	print "\ttypedef VECTOR" . $dimension . "_SOA_VIEW<TYPE> PARENT;\n";
+	print "\t\n";
+	print "\tTYPE* " . join(";\n\tTYPE* ", @components) . ";\n";
+	print "\tunsigned count;\n";
+	print "\t\n";
+	print "\tVECTOR" . $dimension . "_SOA_VIEW(TYPE* " . join(", TYPE* ", @components) . ", const unsigned& count) : ";
+		for ($d = 0; $d < $dimension; $d++)
+		{
+			print $components[$d] . "(" . $components[$d] . "), ";
+		}
+	print "count(count) {}\n";
+	print "\t\n";
+	print "\tVECTOR" . $dimension . "<TYPE> Get(const unsigned& index) const { return VECTOR" . $dimension . "<TYPE>(" . join(", ", map { $_ . "[index]" } @components) . "); }\n";
+	print "\tvoid Set(const unsigned& index, const VECTOR" . $dimension . "<TYPE>& vector) const { ";
+		for ($d = 0; $d < $dimension; $d++)
+		{
+			print $components[$d] . "[index] = vector." . $components[$d] . "; ";
+		}
+	print "}\n";
+	print "};\n\n";
+}
+
+sub PrintSoaSwizzleTemplate
+{
+	print "// Batch swizzles: SOA_SWIZZLE<TYPE, SIZE, I0, I1, I2, I3> is a view of lanes I0, I1, ... of a SIZE-component batch\n";
+	print "template <typename TYPE, int SIZE> struct SoaViewOfSize {};\n";
+	print "template <typename TYPE> struct SoaViewOfSize<TYPE, 2> { typedef VECTOR2_SOA_VIEW<TYPE> type; static type From(TYPE* const* lanes, const unsigned& count) { return type(lanes[0], lanes[1], count); } };\n";
+	print "template <typename TYPE> struct SoaViewOfSize<TYPE, 3> { typedef VECTOR3_SOA_VIEW<TYPE> type; static type From(TYPE* const* lanes, const unsigned& count) { return type(lanes[0], lanes[1], lanes[2], count); } };\n";
+	print "template <typename TYPE> struct SoaViewOfSize<TYPE, 4> { typedef VECTOR4_SOA_VIEW<TYPE> type; static type From(TYPE* const* lanes, const unsigned& count) { return type(lanes[0], lanes[1], lanes[2], lanes[3], count); } };\n";
+	print "\n";
+	print "template <typename TYPE, int SIZE, int I0, int I1, int I2 = -1, int I3 = -1>\n";
+	print "struct SVML_MAY_ALIAS SOA_SWIZZLE\n";
+	print "{\n";
+	print "protected:\n";
+	print "\tTYPE* lanes[SIZE];\n";
+	print "\tunsigned count;\n";
+	print "\n";
+	print "public:\n";
+	print "\tenum { COUNT = (I2 < 0) ? 2 : ((I3 < 0) ? 3 : 4) };\n";
+	print "\ttypedef typename SoaViewOfSize<TYPE, COUNT>::type PARENT;\n";
+	print "\n";
+	print "\toperator PARENT() const\n";
+	print "\t{\n";
+	print "\t\tTYPE* const ordered[4] = { lanes[I0], lanes[I1], lanes[(I2 < 0) ? 0 : I2], lanes[(I3 < 0) ? 0 : I3] };\n";
+	print "\t\treturn SoaViewOfSize<TYPE, COUNT>::From(ordered, count);\n";
+	print "\t}\n";
+	print "};\n";
+	print "\n";
+}
+
+sub PrintSoaSwizzle
+{
+	my($swizzle, $parentDimension) = @_;
+
+	print "\tSOA_SWIZZLE<TYPE, " . $parentDimension . ", " . SwizzleIndices($swizzle) . "> " . $swizzle . ", " . GetSwizzleVariations($swizzle) . ";\n";
+}
+
+sub MakeSoaType
+{
+	my($dimension) = @_;
+
+	@components = SoaComponents($dimension);
+	$type = "VECTOR" . $dimension . "_SOA";
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+	$lanes = "TYPE *" . join(", *", @components) . "; unsigned count;";
+
+	if ($dimension == 2)
+	{
+		@swizzleSet = @swizzle2DSet;
+	}
+	elsif ($dimension == 3)
+	{
+		@swizzleSet = @swizzle3DSet;
+	}
+	else
+	{
+		@swizzleSet = @swizzle4DSet;
+	}
+
+	print "template <typename TYPE>\n";
+	print "union " . $type . "\n";
+	print "{\n";
+	print "private:\n";
+	print "\tstruct { " . $lanes . " unsigned capacity; } v;\n\n";
+
+	print "\tvoid Allocate(const unsigned& count)\n";
+	print "\t{\n";
+	print "\t\tv.count = count;\n";
+	print "\t\tv.capacity = ((count + SOA_LANES - 1) / SOA_LANES) * SOA_LANES;\n";
+	print "\t\tTYPE* block = (TYPE*)AlignedAllocate(v.capacity * " . $dimension . " * sizeof(TYPE));\n";
+	print "\t\tmemset(block, 0, v.capacity * " . $dimension . " * sizeof(TYPE));\n";
+		for ($d = 0; $d < $dimension; $d++)
+		{
+			print "\t\tv." . $components[$d] . " = block + v.capacity * " . $d . ";\n";
+		}
+	print "\t}\n\n";
+
+	print "public:\n";
+	print "\ttypedef " . $view . " PARENT;\n\n";
+
+	# Constructors
+	print "\t" . $type . "() { v.count = 0; v.capacity = 0; " . join(" = ", map { "v." . $_ } @components) . " = 0; }\n";
+	print "\texplicit " . $type . "(const unsigned& count) { Allocate(count); }\n";
+	print "\t" . $type . "(const VECTOR" . $dimension . "<TYPE>* vectors, const unsigned& count) { Allocate(count); for (unsigned i = 0; i < count; i++) { Set(i, vectors[i]); } }\n";
+	print "\t" . $type . "(const " . $type . "& other) { Allocate(other.v.count); memcpy(v.x, other.v.x, v.capacity * " . $dimension . " * sizeof(TYPE)); }\n";
+	print "\t~" . $type . "() { AlignedFree(v.x); }\n\n";
+
+	print "\tconst " . $type . "& operator=(const " . $type . "& rhs)\n";
+	print "\t{\n";
+	print "\t\tif (this != &rhs)\n";
+	print "\t\t{\n";
+	print "\t\t\tAlignedFree(v.x);\n";
+	print "\t\t\tAllocate(rhs.v.count);\n";
+	print "\t\t\tmemcpy(v.x, rhs.v.x, v.capacity * " . $dimension . " * sizeof(TYPE));\n";
+	print "\t\t}\n";
+	print "\t\treturn *this;\n";
+	print "\t}\n\n";
+
+	# Swizzle variables
+	print "\t// Swizzle variables (views onto the same lanes, nothing is copied)\n";
+	for ($u = 0; $u < @swizzleSet; $u++)
+	{
+		if (length($swizzleSet[$u]) > 1)
+		{
+			PrintSoaSwizzle($swizzleSet[$u], $dimension);
+		}
+	}
+	print "\n";
+
+	print "\t// Element access\n";
+	print "\tunsigned Count() const { return v.count; }\n";
+	print "\tVECTOR" . $dimension . "<TYPE> Get(const unsigned& index) const { return " . $view . "(*this).Get(index); }\n";
+	print "\tvoid Set(const unsigned& index, const VECTOR" . $dimension . "<TYPE>& vector) { " . $view . "(*this).Set(index, vector); }\n";
+	print "\tvoid CopyTo(VECTOR" . $dimension . "<TYPE>* vectors) const { for (unsigned i = 0; i < v.count; i++) { vectors[i] = Get(i); } }\n\n";
+
+	print "\t// Lane access\n";
+	print "\toperator " . $view . "() const { return " . $view . "(" . join(", ", map { "v." . $_ } @components) . ", v.count); }\n";
+	print "};\n\n";
+}
+
+# Each full block reads every input before writing any output, so outputs may alias (or permute) the inputs.
+# Results go through block-sized locals, leaving one store stream per loop for the vectorizer.
+sub PrintSoaLoop
+{
+	my($count, $statements, $outputs) = @_;
+
+	for ($o = 0; $o < @$outputs; $o++)
+	{
+		print "\tTYPE block" . $o . "[SOA_LANES];\n";
+	}
+	print "\tsize_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously\n";
+	print "\tfor (; n + SOA_LANES <= " . $count . "; n += SOA_LANES)\n";
+	print "\t{\n";
+	print "\t\tfor (size_t lane = 0; lane < SOA_LANES; lane++)\n";
+	print "\t\t{\n";
+	print "\t\t\tsize_t i = n + lane;\n";
+	foreach $statement (@$statements)
+	{
+		print "\t\t\t" . $statement . "\n";
+	}
+	for ($o = 0; $o < @$outputs; $o++)
+	{
+		print "\t\t\tblock" . $o . "[lane] = " . $outputs->[$o][1] . ";\n";
+	}
+	print "\t\t}\n";
+	for ($o = 0; $o < @$outputs; $o++)
+	{
+		print "\t\tfor (size_t lane = 0; lane < SOA_LANES; lane++) { " . $outputs->[$o][0] . "[n + lane] = block" . $o . "[lane]; }\n";
+	}
+	print "\t}\n";
+	print "\tfor (size_t i = n; i < " . $count . "; i++)\n";
+	print "\t{\n";
+	foreach $statement (@$statements)
+	{
+		print "\t\t" . $statement . "\n";
+	}
+	for ($o = 0; $o < @$outputs; $o++)
+	{
+		print "\t\tblock" . $o . "[0] = " . $outputs->[$o][1] . ";\n";
+	}
+	for ($o = 0; $o < @$outputs; $o++)
+	{
+		print "\t\t" . $outputs->[$o][0] . "[i] = block" . $o . "[0];\n";
+	}
+	print "\t}\n";
+}
+
+# Loads every lane of a view into locals
+sub SoaLoad
+{
+	my($name, $dimension) = @_;
+
+	return "TYPE " . join(", ", map { $name . uc($_) . " = " . $name . "." . $_ . "[i]" } SoaComponents($dimension)) . ";";
+}
+
+sub SoaWrapperCondition
+{
+	my($dimension, $returnType, @parameters) = @_;
+
+	$outString = "";
+	foreach $parameter (@parameters)
+	{
+		$outString .= "typename EnableIf< IsSoa" . $dimension . "D< typename " . $parameter . "::PARENT >, ";
+	}
+	$outString .= $returnType;
+	foreach $parameter (@parameters)
+	{
+		$outString .= " >::type";
+	}
+
+	return $outString;
+}
+
+# Component-wise vector/vector kernel
+sub SoaComponentFunction
+{
+	my($dimension, $name, $operator) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch " . $name . "(): Component-wise [" . $operator . "]\n";
+	print "template <typename OUT, typename A, typename B> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A", "B") . " " . $name . "(const OUT& out, const A& a, const B& b) { " . $name . "(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }\n";
+	print "template <typename TYPE> void " . $name . "(const " . $view . "& out, const " . $view . "& a, const " . $view . "& b)\n";
+	print "{\n";
+	PrintSoaLoop("a.count", [SoaLoad("a", $dimension), SoaLoad("b", $dimension)], [map { ["out." . $_, "a" . uc($_) . " " . $operator . " b" . uc($_)] } SoaComponents($dimension)]);
+	print "}\n\n";
+}
+
+# Vector/scalar kernel
+sub SoaScalarFunction
+{
+	my($dimension, $name, $operator) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch " . $name . "(): Scalar [" . $operator . "]\n";
+	print "template <typename OUT, typename A> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A") . " " . $name . "(const OUT& out, const A& a, const typename ScalarType< typename ComponentType< typename A::PARENT >::type >::type& scalar) { " . $name . "(typename OUT::PARENT(out), typename A::PARENT(a), scalar); }\n";
+	print "template <typename TYPE> void " . $name . "(const " . $view . "& out, const " . $view . "& a, const typename ScalarType<TYPE>::type& scalar)\n";
+	print "{\n";
+	PrintSoaLoop("a.count", [SoaLoad("a", $dimension)], [map { ["out." . $_, "a" . uc($_) . " " . $operator . " scalar"] } SoaComponents($dimension)]);
+	print "}\n\n";
+}
+
+sub SoaNegate
+{
+	my($dimension) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch Negate()\n";
+	print "template <typename OUT, typename A> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A") . " Negate(const OUT& out, const A& a) { Negate(typename OUT::PARENT(out), typename A::PARENT(a)); }\n";
+	print "template <typename TYPE> void Negate(const " . $view . "& out, const " . $view . "& a)\n";
+	print "{\n";
+	PrintSoaLoop("a.count", [SoaLoad("a", $dimension)], [map { ["out." . $_, ($_ eq "w" ? "" : "-") . "a" . uc($_)] } SoaComponents($dimension)]);
+	print "}\n\n";
+}
+
+# Scalar result per element, 4D uses only xyz
+sub SoaDot
+{
+	my($dimension) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+	$useDimension = ($dimension == 4) ? 3 : $dimension;
+
+	print "// " . $dimension . "D batch Dot()\n";
+	print "template <typename TYPE, typename A, typename B> inline " . SoaWrapperCondition($dimension, "void", "A", "B") . " Dot(TYPE* out, const A& a, const B& b) { Dot(out, typename A::PARENT(a), typename B::PARENT(b)); }\n";
+	print "template <typename TYPE> void Dot(TYPE* out, const " . $view . "& a, const " . $view . "& b)\n";
+	print "{\n";
+	PrintSoaLoop("a.count", [], [["out", join(" + ", map { "a." . $_ . "[i] * b." . $_ . "[i]" } SoaComponents($useDimension))]]);
+	print "}\n\n";
+}
+
+sub SoaNormalize
+{
+	my($dimension) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+	$useDimension = ($dimension == 4) ? 3 : $dimension;
+
+	print "// " . $dimension . "D batch Normalize()\n";
+	print "template <typename OUT, typename A> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A") . " Normalize(const OUT& out, const A& a) { Normalize(typename OUT::PARENT(out), typename A::PARENT(a)); }\n";
+	print "template <typename TYPE> void Normalize(const " . $view . "& out, const " . $view . "& a)\n";
+	print "{\n";
+	@body = (SoaLoad("a", $dimension), "TYPE length = sqrt(" . join(" + ", map { "a" . uc($_) . " * a" . uc($_) } SoaComponents($useDimension)) . ");");
+	@results = map { ["out." . $_, "a" . uc($_) . " / length"] } SoaComponents($useDimension);
+	if ($dimension == 4)
+	{
+		push(@results, ["out.w", "aW"]);
+	}
+	PrintSoaLoop("a.count", \@body, \@results);
+	print "}\n\n";
+}
+
+sub SoaCross
+{
+	my($dimension) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch Cross()\n";
+	print "template <typename OUT, typename A, typename B> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A", "B") . " Cross(const OUT& out, const A& a, const B& b) { Cross(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }\n";
+	print "template <typename TYPE> void Cross(const " . $view . "& out, const " . $view . "& a, const " . $view . "& b)\n";
+	print "{\n";
+	@body = (SoaLoad("a", $dimension), SoaLoad("b", 3));
+	@results = (["out.x", "aY * bZ - aZ * bY"],
+	            ["out.y", "aZ * bX - aX * bZ"],
+	            ["out.z", "aX * bY - aY * bX"]);
+	if ($dimension == 4)
+	{
+		push(@results, ["out.w", "aW"]);
+	}
+	PrintSoaLoop("a.count", \@body, \@results);
+	print "}\n\n";
+}
+
+sub SoaProjection
+{
+	my($dimension) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+	$useDimension = ($dimension == 4) ? 3 : $dimension;
+
+	print "// " . $dimension . "D batch Project()\n";
+	print "template <typename OUT, typename A, typename B> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A", "B") . " Project(const OUT& out, const A& projectThis, const B& ontoThis) { Project(typename OUT::PARENT(out), typename A::PARENT(projectThis), typename B::PARENT(ontoThis)); }\n";
+	print "template <typename TYPE> void Project(const " . $view . "& out, const " . $view . "& projectThis, const " . $view . "& ontoThis)\n";
+	print "{\n";
+	@body = (SoaLoad("a", $useDimension), SoaLoad("b", $dimension),
+	         "TYPE scale = (" . join(" + ", map { "a" . uc($_) . " * b" . uc($_) } SoaComponents($useDimension)) . ") / (" . join(" + ", map { "b" . uc($_) . " * b" . uc($_) } SoaComponents($useDimension)) . ");");
+	@results = map { ["out." . $_, "scale * b" . uc($_)] } SoaComponents($useDimension);
+	if ($dimension == 4)
+	{
+		push(@results, ["out.w", "bW"]);
+	}
+	# Named a and b in the loop body to share SoaLoad()
+	print "\tconst " . $view . "& a = projectThis;\n";
+	print "\tconst " . $view . "& b = ontoThis;\n";
+	PrintSoaLoop("a.count", \@body, \@results);
+	print "}\n\n";
+}
+
+# The sine and cosine are computed once for the whole batch (the 3D and 4D versions go through a quaternion)
+sub SoaRotation
+{
+	my($dimension) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch Rotate()\n";
+	if ($dimension == 2)
+	{
+		print "template <typename OUT, typename A> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A") . " Rotate(const OUT& out, const A& a, const typename RealType< typename ComponentType< typename A::PARENT >::type >::type& angle) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), angle); }\n";
+		print "template <typename TYPE> void Rotate(const " . $view . "& out, const " . $view . "& a, const typename RealType<TYPE>::type& angle)\n";
+		print "{\n";
+		print "\tRotate(out, a, ROTATION2< typename RealType<TYPE>::type >(angle));\n";
+	}
+	else
+	{
+		print "template <typename OUT, typename A, typename TYPE> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A") . " Rotate(const OUT& out, const A& a, const VECTOR" . $dimension . "<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), rotationAxis, radians); }\n";
+		print "template <typename TYPE> void Rotate(const " . $view . "& out, const " . $view . "& a, const VECTOR" . $dimension . "<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians)\n";
+		print "{\n";
+		print "\tRotate(out, a, QUATERNION<TYPE>(" . (($dimension == 3) ? "rotationAxis" : "rotationAxis.xyz") . ", radians));\n";
+	}
+	print "}\n\n";
+}
+
+sub SoaLerp
+{
+	my($dimension) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch Lerp()\n";
+	print "template <typename OUT, typename A, typename B> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A", "B") . " Lerp(const OUT& out, const A& start, const B& end, const typename RealType< typename ComponentType< typename A::PARENT >::type >::type& delta) { Lerp(typename OUT::PARENT(out), typename A::PARENT(start), typename B::PARENT(end), delta); }\n";
+	print "template <typename TYPE> void Lerp(const " . $view . "& out, const " . $view . "& start, const " . $view . "& end, const typename RealType<TYPE>::type& delta)\n";
+	print "{\n";
+	PrintSoaLoop("start.count", [SoaLoad("start", $dimension), SoaLoad("end", $dimension)], [map { ["out." . $_, "start" . uc($_) . " + delta * (end" . uc($_) . " - start" . uc($_) . ")"] } SoaComponents($dimension)]);
+	print "}\n\n";
+}
+
+# Selects written like std::max and std::min so ties and NaNs behave the same as the per-vector functions
+sub SoaMinMax
+{
+	my($dimension, $name) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch " . $name . "(): Component-wise\n";
+	print "template <typename OUT, typename A, typename B> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A", "B") . " " . $name . "(const OUT& out, const A& a, const B& b) { " . $name . "(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }\n";
+	print "template <typename TYPE> void " . $name . "(const " . $view . "& out, const " . $view . "& a, const " . $view . "& b)\n";
+	print "{\n";
+	if ($name eq "Max")
+	{
+		PrintSoaLoop("a.count", [SoaLoad("a", $dimension), SoaLoad("b", $dimension)], [map { ["out." . $_, "(a" . uc($_) . " < b" . uc($_) . ") ? b" . uc($_) . " : a" . uc($_)] } SoaComponents($dimension)]);
+	}
+	else
+	{
+		PrintSoaLoop("a.count", [SoaLoad("a", $dimension), SoaLoad("b", $dimension)], [map { ["out." . $_, "(b" . uc($_) . " < a" . uc($_) . ") ? b" . uc($_) . " : a" . uc($_)] } SoaComponents($dimension)]);
+	}
+	print "}\n\n";
+}
+
+sub SoaRound
+{
+	my($dimension, $name, $function) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+
+	print "// " . $dimension . "D batch " . $name . "()\n";
+	print "template <typename OUT, typename A> inline " . SoaWrapperCondition($dimension, "void", "OUT", "A") . " " . $name . "(const OUT& out, const A& a) { " . $name . "(typename OUT::PARENT(out), typename A::PARENT(a)); }\n";
+	print "template <typename TYPE> void " . $name . "(const " . $view . "& out, const " . $view . "& a)\n";
+	print "{\n";
+	PrintSoaLoop("a.count", [], [map { ["out." . $_, $function . "(a." . $_ . "[i])"] } SoaComponents($dimension)]);
+	print "}\n\n";
+}
+
+sub SoaDistance
+{
+	my($dimension, $name) = @_;
+
+	$view = "VECTOR" . $dimension . "_SOA_VIEW<TYPE>";
+	$useDimension = ($dimension == 4) ? 3 : $dimension;
+
+	$sum = join(" + ", map { "(a." . $_ . "[i] - b." . $_ . "[i]) * (a." . $_ . "[i] - b." . $_ . "[i])" } SoaComponents($useDimension));
+	if ($name eq "Distance")
+	{
+		$sum = "sqrt(" . $sum . ")";
+	}
+
+	print "// " . $dimension . "D batch " . $name . "()\n";
+	print "template <typename TYPE, typename A, typename B> inline " . SoaWrapperCondition($dimension, "void", "A", "B") . " " . $name . "(TYPE* out, const A& a, const B& b) { " . $name . "(out, typename A::PARENT(a), typename B::PARENT(b)); }\n";
+	print "template <typename TYPE> void " . $name . "(TYPE* out, const " . $view . "& a, const " . $view . "& b)\n";
+	print "{\n";
+	PrintSoaLoop("a.count", [], [["out", $sum]]);
+	print "}\n\n";
+}
+
+return 1;
@@ -0,0 +1,859 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# Static trees over arrays: KD_TREE2 and KD_TREE3 of points, and BVH3 of boxes (of triangles or anything else). Both
+# keep their nodes in one flat array, allocated like the batch types' lanes on a cache line, and reorder their
+# elements so each leaf's are contiguous. BVH3 nodes have four children, whose boxes are one AABB3_PACKET<TYPE, 4>,
+# so a ray is tested against all four with the packet IntersectRay() (one SSE step for float)
+
+sub PrintSpatialTreeUtilities
+{
+	print "// Most points in a kd-tree leaf, and bins per axis and most primitives in a leaf of a BVH\n";
+	print "const unsigned KD_TREE_LEAF = 8;\n";
+	print "const unsigned BVH_BINS = 16;\n";
+	print "const unsigned BVH_MAX_LEAF = 8;\n";
+	print "\n";
+	print "// A copy of count elements in aligned storage (0 when count is 0), to free with AlignedFree()\n";
+	print "template <typename TYPE> TYPE* AlignedCopy(const TYPE* elements, const unsigned& count)\n";
+	print "{\n";
+	print "\tif (count == 0) { return 0; }\n";
+	print "\tTYPE* copy = (TYPE*)AlignedAllocate(count * sizeof(TYPE));\n";
+	print "\tmemcpy(copy, elements, count * sizeof(TYPE));\n";
+	print "\treturn copy;\n";
+	print "}\n";
+	print "\n";
+	print "// Squared distance from point to the nearest point of box (0 inside)\n";
+	print "template <typename TYPE> TYPE DistanceSquared(const AABB3<TYPE>& box, const VECTOR3<TYPE>& point) { return DistanceSquared(point, Max(box.minimum, Min(point, box.maximum))); }\n";
+	print "\n";
+	print "// The ray origin + distance * direction against triangle abc, either side facing (Moller-Trumbore): true when it\n";
+	print "// hits within maxDistance, distance is where\n";
+	print "template <typename TYPE> bool IntersectTriangle(const VECTOR3<TYPE>& origin, const VECTOR3<TYPE>& direction, const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b, const VECTOR3<TYPE>& c, const TYPE& maxDistance, TYPE& distance)\n";
+	print "{\n";
+	print "\tVECTOR3<TYPE> edge1 = b - a;\n";
+	print "\tVECTOR3<TYPE> edge2 = c - a;\n";
+	print "\tVECTOR3<TYPE> p = Cross(direction, edge2);\n";
+	print "\tTYPE determinant = Dot(edge1, p);\n";
+	print "\tif (determinant == 0)\n";
+	print "\t{\n";
+	print "\t\treturn false;\n";
+	print "\t}\n";
+	print "\tTYPE inverse = (TYPE)1 / determinant;\n";
+	print "\tVECTOR3<TYPE> t = origin - a;\n";
+	print "\tTYPE u = Dot(t, p) * inverse;\n";
+	print "\tif (u < 0 || u > 1)\n";
+	print "\t{\n";
+	print "\t\treturn false;\n";
+	print "\t}\n";
+	print "\tVECTOR3<TYPE> q = Cross(t, edge1);\n";
+	print "\tTYPE v = Dot(direction, q) * inverse;\n";
+	print "\tif (v < 0 || u + v > 1)\n";
+	print "\t{\n";
+	print "\t\treturn false;\n";
+	print "\t}\n";
+	print "\tdistance = Dot(edge2, q) * inverse;\n";
+	print "\treturn distance >= 0 && distance <= maxDistance;\n";
+	print "}\n";
+	print "\n";
+	print "// BVH bin of a centroid coordinate, scale being BVH_BINS over the extent of the centroids (a scale too large to be\n";
+	print "// finite puts everything in the last bin)\n";
+	print "template <typename TYPE> unsigned BvhBin(const TYPE& centroid, const TYPE& minimum, const TYPE& scale)\n";
+	print "{\n";
+	print "\tTYPE position = (centroid - minimum) * scale;\n";
+	print "\treturn (position < (TYPE)(BVH_BINS - 1)) ? (unsigned)position : BVH_BINS - 1;\n";
+	print "}\n";
+	print "\n";
+}
+
+sub MakeKdTreeType
+{
+	my($dimension) = @_;
+
+	my $type = "KD_TREE" . $dimension;
+	my $vector = "VECTOR" . $dimension . "<TYPE>";
+
+	print "// " . $dimension . "D tree of points, split at the median of the widest axis down to KD_TREE_LEAF points per leaf. Build()\n";
+	print "// gives points[i] index i, which the queries return\n";
+	print "template <typename TYPE>\n";
+	print "class " . $type . "\n";
+	print "{\n";
+	print "public:\n";
+	print "\ttypedef " . $vector . " VECTOR;\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\t" . $type . "() : nodes(0), nodeCount(0), depth(0) {}\n";
+	print "\t" . $type . "(const VECTOR* points, const unsigned& count) : nodes(0), nodeCount(0) { Build(points, count); }\n";
+	print "\t" . $type . "(const " . $type . "& other) : points(other.points), indices(other.indices), nodes(AlignedCopy(other.nodes, other.nodeCount)), nodeCount(other.nodeCount), depth(other.depth) {}\n";
+	print "\t~" . $type . "() { AlignedFree(nodes); }\n";
+	print "\n";
+	print "\tconst " . $type . "& operator=(const " . $type . "& rhs)\n";
+	print "\t{\n";
+	print "\t\tif (this != &rhs)\n";
+	print "\t\t{\n";
+	print "\t\t\tpoints = rhs.points;\n";
+	print "\t\t\tindices = rhs.indices;\n";
+	print "\t\t\tAlignedFree(nodes);\n";
+	print "\t\t\tnodes = AlignedCopy(rhs.nodes, rhs.nodeCount);\n";
+	print "\t\t\tnodeCount = rhs.nodeCount;\n";
+	print "\t\t\tdepth = rhs.depth;\n";
+	print "\t\t}\n";
+	print "\t\treturn *this;\n";
+	print "\t}\n";
+	print "\n";
+	print "\tvoid Build(const VECTOR* points, const unsigned& count)\n";
+	print "\t{\n";
+	print "\t\tthis->points.assign(points, points + count);\n";
+	print "\t\tindices.resize(count);\n";
+	print "\t\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tindices[i] = i;\n";
+	print "\t\t}\n";
+	print "\t\tstd::vector<NODE> built;\n";
+	print "\t\tdepth = 0;\n";
+	print "\t\tif (count > 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tBuildNode(built, 0, count, 1);\n";
+	print "\t\t}\n";
+	print "\t\tAlignedFree(nodes);\n";
+	print "\t\tnodes = AlignedCopy(built.empty() ? 0 : &built[0], (unsigned)built.size());\n";
+	print "\t\tnodeCount = (unsigned)built.size();\n";
+	print "\n";
+	print "\t\t// Points in leaf order\n";
+	print "\t\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tthis->points[i] = points[indices[i]];\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Element access\n";
+	print "\tunsigned Count() const { return (unsigned)points.size(); }\n";
+	print "\n";
+	print "\t// Appends the indices of the points within radius of center (inclusive) to found, and returns how many there were\n";
+	print "\tunsigned QueryRadius(const VECTOR& center, const TYPE& radius, std::vector<unsigned>& found) const\n";
+	print "\t{\n";
+	print "\t\tsize_t before = found.size();\n";
+	print "\t\tTYPE radiusSquared = radius * radius;\n";
+	print "\t\tstd::vector<unsigned> stack;\n";
+	print "\t\tstack.reserve(depth + 1);\n";
+	print "\t\tif (nodeCount > 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tstack.push_back(0);\n";
+	print "\t\t}\n";
+	print "\t\twhile (!stack.empty())\n";
+	print "\t\t{\n";
+	print "\t\t\tunsigned index = stack.back();\n";
+	print "\t\t\tconst NODE& node = nodes[index];\n";
+	print "\t\t\tstack.pop_back();\n";
+	print "\t\t\tif (node.count > 0)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tfor (unsigned i = node.next; i < node.next + node.count; i++)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tif (DistanceSquared(points[i], center) <= radiusSquared)\n";
+	print "\t\t\t\t\t{\n";
+	print "\t\t\t\t\t\tfound.push_back(indices[i]);\n";
+	print "\t\t\t\t\t}\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tcontinue;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tTYPE offset = center.Component(node.axis) - node.split;\n";
+	print "\t\t\tif (offset <= radius)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tstack.push_back(index + 1);\n";
+	print "\t\t\t}\n";
+	print "\t\t\tif (-offset <= radius)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tstack.push_back(node.next);\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\treturn (unsigned)(found.size() - before);\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Appends the indices of the k points nearest to center to found, nearest first (the lower index first among\n";
+	print "\t// equally near ones), and returns how many there were: k, or Count() if that is less\n";
+	print "\tunsigned QueryNearest(const VECTOR& center, const unsigned& k, std::vector<unsigned>& found) const\n";
+	print "\t{\n";
+	print "\t\tif (k == 0 || nodeCount == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn 0;\n";
+	print "\t\t}\n";
+	print "\t\tstd::vector<CANDIDATE> nearest; // Max-heap of the nearest so far\n";
+	print "\t\tnearest.reserve(k + 1);\n";
+	print "\t\tstd::vector<CANDIDATE> stack; // Nodes to visit, with the squared distance to the side of the split they are on\n";
+	print "\t\tstack.reserve(depth + 1);\n";
+	print "\t\tstack.push_back(CANDIDATE(0, 0));\n";
+	print "\t\twhile (!stack.empty())\n";
+	print "\t\t{\n";
+	print "\t\t\tCANDIDATE entry = stack.back();\n";
+	print "\t\t\tstack.pop_back();\n";
+	print "\t\t\tif (nearest.size() == k && entry.first > nearest.front().first)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tcontinue;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tconst NODE& node = nodes[entry.second];\n";
+	print "\t\t\tif (node.count > 0)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tfor (unsigned i = node.next; i < node.next + node.count; i++)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tKeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[i], center), indices[i]));\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tcontinue;\n";
+	print "\t\t\t}\n";
+	print "\t\t\t// The far side first, so the near one is visited next\n";
+	print "\t\t\tTYPE offset = center.Component(node.axis) - node.split;\n";
+	print "\t\t\tstack.push_back(CANDIDATE(offset * offset, (offset < 0) ? node.next : entry.second + 1));\n";
+	print "\t\t\tstack.push_back(CANDIDATE(entry.first, (offset < 0) ? entry.second + 1 : node.next));\n";
+	print "\t\t}\n";
+	print "\t\tstd::sort_heap(nearest.begin(), nearest.end());\n";
+	print "\t\tfor (unsigned n = 0; n < nearest.size(); n++)\n";
+	print "\t\t{\n";
+	print "\t\t\tfound.push_back(nearest[n].second);\n";
+	print "\t\t}\n";
+	print "\t\treturn (unsigned)nearest.size();\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Index of the point nearest to center (the tree must not be empty)\n";
+	print "\tunsigned Nearest(const VECTOR& center) const\n";
+	print "\t{\n";
+	print "\t\tstd::vector<unsigned> found;\n";
+	print "\t\tQueryNearest(center, 1, found);\n";
+	print "\t\treturn found[0];\n";
+	print "\t}\n";
+	print "\n";
+	print "private:\n";
+	print "\ttypedef std::pair<typename ScalarType<TYPE>::type, unsigned> CANDIDATE;\n";
+	print "\n";
+	print "\t// 16 bytes for float, four to a cache line. An internal node's left child follows it, and holds the points up to\n";
+	print "\t// split on axis; a leaf has count points from points[next]\n";
+	print "\tstruct NODE\n";
+	print "\t{\n";
+	print "\t\tTYPE split;\n";
+	print "\t\tunsigned axis;\n";
+	print "\t\tunsigned next; // The right child of an internal node, the first point of a leaf\n";
+	print "\t\tunsigned count; // 0 for internal nodes\n";
+	print "\n";
+	print "\t\tNODE() : split(0), axis(0), next(0), count(0) {}\n";
+	print "\t};\n";
+	print "\n";
+	print "\t// Orders point indices along one axis (by index among equal coordinates)\n";
+	print "\tstruct AXIS_LESS\n";
+	print "\t{\n";
+	print "\t\tconst VECTOR* points;\n";
+	print "\t\tunsigned axis;\n";
+	print "\n";
+	print "\t\tAXIS_LESS(const VECTOR* points, const unsigned& axis) : points(points), axis(axis) {}\n";
+	print "\t\tbool operator()(const unsigned& a, const unsigned& b) const { return points[a].Component(axis) < points[b].Component(axis) || (points[a].Component(axis) == points[b].Component(axis) && a < b); }\n";
+	print "\t};\n";
+	print "\n";
+	print "\tvoid BuildNode(std::vector<NODE>& built, const unsigned& first, const unsigned& last, const unsigned& level)\n";
+	print "\t{\n";
+	print "\t\tunsigned index = (unsigned)built.size();\n";
+	print "\t\tbuilt.push_back(NODE());\n";
+	print "\t\tdepth = std::max(depth, level);\n";
+	print "\t\tif (last - first <= KD_TREE_LEAF)\n";
+	print "\t\t{\n";
+	print "\t\t\tbuilt[index].next = first;\n";
+	print "\t\t\tbuilt[index].count = last - first;\n";
+	print "\t\t\treturn;\n";
+	print "\t\t}\n";
+	print "\t\tAABB" . $dimension . "<TYPE> bounds = AABB" . $dimension . "<TYPE>::Empty();\n";
+	print "\t\tfor (unsigned i = first; i < last; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tbounds = Union(bounds, points[indices[i]]);\n";
+	print "\t\t}\n";
+	print "\t\tVECTOR size = Size(bounds);\n";
+	print "\t\tunsigned axis = 0;\n";
+	print "\t\tfor (unsigned a = 1; a < " . $dimension . "; a++)\n";
+	print "\t\t{\n";
+	print "\t\t\tif (size.Component(a) > size.Component(axis))\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\taxis = a;\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\tunsigned middle = first + (last - first) / 2;\n";
+	print "\t\tstd::nth_element(indices.begin() + first, indices.begin() + middle, indices.begin() + last, AXIS_LESS(&points[0], axis));\n";
+	print "\t\tbuilt[index].split = points[indices[middle]].Component(axis);\n";
+	print "\t\tbuilt[index].axis = axis;\n";
+	print "\t\tBuildNode(built, first, middle, level + 1);\n";
+	print "\t\tbuilt[index].next = (unsigned)built.size();\n";
+	print "\t\tBuildNode(built, middle, last, level + 1);\n";
+	print "\t}\n";
+	print "\n";
+	print "\tstd::vector<VECTOR> points; // In leaf order\n";
+	print "\tstd::vector<unsigned> indices; // Of points[i], given to Build()\n";
+	print "\tNODE* nodes;\n";
+	print "\tunsigned nodeCount;\n";
+	print "\tunsigned depth; // Levels of nodes\n";
+	print "};\n";
+	print "\n";
+}
+
+sub MakeBvhType
+{
+	print "// Node of a BVH3: four children, each an internal node or a leaf. Unused slots have empty boxes (which nothing\n";
+	print "// hits or overlaps), and child and count 0. 128 bytes for float, two cache lines\n";
+	print "template <typename TYPE>\n";
+	print "struct BVH3_NODE\n";
+	print "{\n";
+	print "\tAABB3_PACKET<TYPE, 4> bounds;\n";
+	print "\tunsigned child[4]; // The node index of an internal child, the first primitive slot of a leaf\n";
+	print "\tunsigned count[4]; // Primitives in a leaf, 0 for an internal child\n";
+	print "\n";
+	print "\tBVH3_NODE() { for (unsigned i = 0; i < 4; i++) { child[i] = count[i] = 0; } }\n";
+	print "};\n";
+	print "\n";
+	print "// Bounding volume hierarchy of boxes, built by binned surface area heuristic (BVH_BINS bins per axis, leaves of up\n";
+	print "// to BVH_MAX_LEAF primitives). Build() gives boxes[i] index i, which the queries return. The nodes are a flat array\n";
+	print "// with the root first, and a leaf's primitives are Primitive(child) to Primitive(child + count - 1)\n";
+	print "template <typename TYPE>\n";
+	print "class BVH3\n";
+	print "{\n";
+	print "public:\n";
+	print "\ttypedef VECTOR3<TYPE> VECTOR;\n";
+	print "\ttypedef AABB3<TYPE> BOX;\n";
+	print "\ttypedef BVH3_NODE<TYPE> NODE;\n";
+	print "\n";
+	print "\t// Constructors\n";
+	print "\tBVH3() : nodes(0), nodeCount(0), depth(0) { NoPool(); }\n";
+	print "\tBVH3(const BOX* boxes, const unsigned& count) : nodes(0), nodeCount(0) { NoPool(); Build(boxes, count); }\n";
+	print "\tBVH3(const BVH3& other) : boxes(other.boxes), order(other.order), nodes(AlignedCopy(other.nodes, other.nodeCount)), nodeCount(other.nodeCount), depth(other.depth) { NoPool(); }\n";
+	print "\t~BVH3() { AlignedFree(nodes); }\n";
+	print "\n";
+	print "\tconst BVH3& operator=(const BVH3& rhs)\n";
+	print "\t{\n";
+	print "\t\tif (this != &rhs)\n";
+	print "\t\t{\n";
+	print "\t\t\tboxes = rhs.boxes;\n";
+	print "\t\t\torder = rhs.order;\n";
+	print "\t\t\tAlignedFree(nodes);\n";
+	print "\t\t\tnodes = AlignedCopy(rhs.nodes, rhs.nodeCount);\n";
+	print "\t\t\tnodeCount = rhs.nodeCount;\n";
+	print "\t\t\tdepth = rhs.depth;\n";
+	print "\t\t}\n";
+	print "\t\treturn *this;\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Replaces every primitive with boxes[0] to boxes[count - 1] (Fit(vertices, 3) is the box of a triangle)\n";
+	print "\tvoid Build(const BOX* boxes, const unsigned& count)\n";
+	print "\t{\n";
+	print "\t\tprimitives.resize(count);\n";
+	print "\t\tfor (unsigned i = 0; i < count; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\tprimitives[i] = PRIMITIVE(boxes[i], i);\n";
+	print "\t\t}\n";
+	print "\t\tBuildNodes();\n";
+	print "\t}\n";
+	print "\n";
+	print "#ifdef SVML_USE_THREADS\n";
+	print "\t// Build() on a pool: the ranges of more than grain primitives are measured and binned in parallel, which gives\n";
+	print "\t// exactly the tree the serial one does\n";
+	print "\tvoid Build(const Bulk::SPAN<const BOX>& boxes, const size_t& grain = Bulk::DEFAULT_GRAIN, Bulk::WORK_POOL& pool = Bulk::DefaultPool())\n";
+	print "\t{\n";
+	print "\t\tunsigned count = (unsigned)boxes.count;\n";
+	print "\t\tprimitives.resize(count);\n";
+	print "\t\tBulk::ParallelFor(count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { primitives[i] = PRIMITIVE(boxes[i], (unsigned)i); } }, grain, pool);\n";
+	print "\t\tthis->grain = grain;\n";
+	print "\t\tthis->pool = &pool;\n";
+	print "\t\tBuildNodes();\n";
+	print "\t\tNoPool();\n";
+	print "\t}\n";
+	print "#endif\n";
+	print "\n";
+	print "\t// Element access\n";
+	print "\tunsigned Count() const { return (unsigned)boxes.size(); }\n";
+	print "\tunsigned NodeCount() const { return nodeCount; }\n";
+	print "\tconst NODE* Nodes() const { return nodes; }\n";
+	print "\tunsigned Primitive(const unsigned& slot) const { return order[slot]; } // The index of the box in a leaf slot\n";
+	print "\tBOX Bounds() const\n";
+	print "\t{\n";
+	print "\t\tBOX bounds = BOX::Empty();\n";
+	print "\t\tfor (unsigned c = 0; c < 4 && nodeCount > 0; c++)\n";
+	print "\t\t{\n";
+	print "\t\t\tbounds = Union(bounds, nodes[0].bounds.Get(c));\n";
+	print "\t\t}\n";
+	print "\t\treturn bounds;\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// The nearest hit along the ray origin + distance * direction up to maxDistance: intersect(index, maxDistance) is\n";
+	print "\t// called for the primitives whose boxes the ray hits, nearest box first, and when the primitive is hit nearer than\n";
+	print "\t// maxDistance lowers maxDistance to the hit and returns true. On a hit, maxDistance is its distance and index its\n";
+	print "\t// primitive\n";
+	print "\ttemplate <typename INTERSECT> bool IntersectRay(const VECTOR& origin, const VECTOR& direction, INTERSECT& intersect, TYPE& maxDistance, unsigned& index) const\n";
+	print "\t{\n";
+	print "\t\tVECTOR inverseDirection = (TYPE)1 / direction;\n";
+	print "\t\tbool hit = false;\n";
+	print "\t\tstd::vector< std::pair<TYPE, unsigned> > stack; // Nodes to visit, with the distance the ray enters them at\n";
+	print "\t\tstack.reserve(3 * depth + 1);\n";
+	print "\t\tif (nodeCount > 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tstack.push_back(std::pair<TYPE, unsigned>(0, 0));\n";
+	print "\t\t}\n";
+	print "\t\twhile (!stack.empty())\n";
+	print "\t\t{\n";
+	print "\t\t\tstd::pair<TYPE, unsigned> entry = stack.back();\n";
+	print "\t\t\tstack.pop_back();\n";
+	print "\t\t\tif (entry.first > maxDistance)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tcontinue;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tconst NODE& node = nodes[entry.second];\n";
+	print "\t\t\tTYPE distances[4];\n";
+	print "\t\t\tunsigned slots[4];\n";
+	print "\t\t\tunsigned hits = SortHits(SVML::IntersectRay(node.bounds, origin, inverseDirection, maxDistance, distances), distances, slots);\n";
+	print "\n";
+	print "\t\t\t// Leaves nearest first, then the internal children pushed so the nearest is visited next\n";
+	print "\t\t\tfor (unsigned h = 0; h < hits; h++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tunsigned c = slots[h];\n";
+	print "\t\t\t\tfor (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c] && distances[c] <= maxDistance; slot++)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tif (intersect(order[slot], maxDistance))\n";
+	print "\t\t\t\t\t{\n";
+	print "\t\t\t\t\t\thit = true;\n";
+	print "\t\t\t\t\t\tindex = order[slot];\n";
+	print "\t\t\t\t\t}\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t\tfor (unsigned h = hits; h-- > 0;)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tif (node.count[slots[h]] == 0)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tstack.push_back(std::pair<TYPE, unsigned>(distances[slots[h]], node.child[slots[h]]));\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\treturn hit;\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Appends the indices of the boxes that overlap box (touching counts) to found, and returns how many there were\n";
+	print "\tunsigned QueryBox(const BOX& box, std::vector<unsigned>& found) const\n";
+	print "\t{\n";
+	print "\t\tsize_t before = found.size();\n";
+	print "\t\tstd::vector<unsigned> stack;\n";
+	print "\t\tstack.reserve(3 * depth + 1);\n";
+	print "\t\tif (nodeCount > 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tstack.push_back(0);\n";
+	print "\t\t}\n";
+	print "\t\twhile (!stack.empty())\n";
+	print "\t\t{\n";
+	print "\t\t\tconst NODE& node = nodes[stack.back()];\n";
+	print "\t\t\tstack.pop_back();\n";
+	print "\t\t\tfor (unsigned c = 0; c < 4; c++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tif (!Overlaps(node.bounds.Get(c), box))\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tcontinue;\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tif (node.count[c] == 0)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tstack.push_back(node.child[c]);\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tfor (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c]; slot++)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tif (Overlaps(boxes[slot], box))\n";
+	print "\t\t\t\t\t{\n";
+	print "\t\t\t\t\t\tfound.push_back(order[slot]);\n";
+	print "\t\t\t\t\t}\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\treturn (unsigned)(found.size() - before);\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Appends the indices of the boxes within radius of center (inclusive, measured to the nearest point of the box) to\n";
+	print "\t// found, and returns how many there were\n";
+	print "\tunsigned QueryRadius(const VECTOR& center, const TYPE& radius, std::vector<unsigned>& found) const\n";
+	print "\t{\n";
+	print "\t\tsize_t before = found.size();\n";
+	print "\t\tTYPE radiusSquared = radius * radius;\n";
+	print "\t\tstd::vector<unsigned> stack;\n";
+	print "\t\tstack.reserve(3 * depth + 1);\n";
+	print "\t\tif (nodeCount > 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tstack.push_back(0);\n";
+	print "\t\t}\n";
+	print "\t\twhile (!stack.empty())\n";
+	print "\t\t{\n";
+	print "\t\t\tconst NODE& node = nodes[stack.back()];\n";
+	print "\t\t\tstack.pop_back();\n";
+	print "\t\t\tfor (unsigned c = 0; c < 4; c++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tif ((node.child[c] == 0 && node.count[c] == 0) || DistanceSquared(node.bounds.Get(c), center) > radiusSquared)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tcontinue;\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tif (node.count[c] == 0)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tstack.push_back(node.child[c]);\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tfor (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c]; slot++)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tif (DistanceSquared(boxes[slot], center) <= radiusSquared)\n";
+	print "\t\t\t\t\t{\n";
+	print "\t\t\t\t\t\tfound.push_back(order[slot]);\n";
+	print "\t\t\t\t\t}\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\treturn (unsigned)(found.size() - before);\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Appends the indices of the k boxes nearest to center (0 for those containing it) to found, nearest first (the\n";
+	print "\t// lower index first among equally near ones), and returns how many there were: k, or Count() if that is less\n";
+	print "\tunsigned QueryNearest(const VECTOR& center, const unsigned& k, std::vector<unsigned>& found) const\n";
+	print "\t{\n";
+	print "\t\tif (k == 0 || nodeCount == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn 0;\n";
+	print "\t\t}\n";
+	print "\t\tstd::vector<CANDIDATE> nearest; // Max-heap of the nearest so far\n";
+	print "\t\tnearest.reserve(k + 1);\n";
+	print "\t\tstd::vector<CANDIDATE> stack; // Nodes to visit, with the squared distance to their boxes\n";
+	print "\t\tstack.reserve(3 * depth + 1);\n";
+	print "\t\tstack.push_back(CANDIDATE(0, 0));\n";
+	print "\t\twhile (!stack.empty())\n";
+	print "\t\t{\n";
+	print "\t\t\tCANDIDATE entry = stack.back();\n";
+	print "\t\t\tstack.pop_back();\n";
+	print "\t\t\tif (nearest.size() == k && entry.first > nearest.front().first)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tcontinue;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tconst NODE& node = nodes[entry.second];\n";
+	print "\t\t\tTYPE distances[4];\n";
+	print "\t\t\tunsigned slots[4];\n";
+	print "\t\t\tunsigned used = 0;\n";
+	print "\t\t\tfor (unsigned c = 0; c < 4; c++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tif (node.child[c] != 0 || node.count[c] != 0)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tdistances[c] = DistanceSquared(node.bounds.Get(c), center);\n";
+	print "\t\t\t\t\tused |= 1u << c;\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t\tunsigned children = SortHits(used, distances, slots);\n";
+	print "\t\t\tfor (unsigned h = 0; h < children; h++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tunsigned c = slots[h];\n";
+	print "\t\t\t\tfor (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c]; slot++)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tKeepNearest(nearest, k, CANDIDATE(DistanceSquared(boxes[slot], center), order[slot]));\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t\tfor (unsigned h = children; h-- > 0;)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tif (node.count[slots[h]] == 0)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tstack.push_back(CANDIDATE(distances[slots[h]], node.child[slots[h]]));\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\tstd::sort_heap(nearest.begin(), nearest.end());\n";
+	print "\t\tfor (unsigned n = 0; n < nearest.size(); n++)\n";
+	print "\t\t{\n";
+	print "\t\t\tfound.push_back(nearest[n].second);\n";
+	print "\t\t}\n";
+	print "\t\treturn (unsigned)nearest.size();\n";
+	print "\t}\n";
+	print "\n";
+	print "private:\n";
+	print "\ttypedef std::pair<typename ScalarType<TYPE>::type, unsigned> CANDIDATE;\n";
+	print "\n";
+	print "\t// Primitives first to last - 1, their bounds and the bounds of their centroids, and whether they\n";
+	print "\t// become a leaf or else where they split: bins 0 to bin on axis go left (axis 3 splits them in half)\n";
+	print "\tstruct RANGE\n";
+	print "\t{\n";
+	print "\t\tunsigned first, last;\n";
+	print "\t\tBOX bounds, centroids;\n";
+	print "\t\tbool leaf;\n";
+	print "\t\tunsigned axis, bin;\n";
+	print "\t};\n";
+	print "\n";
+	print "\t// Primitives and bounds per bin, on each axis (the bounds of empty bins are left unset)\n";
+	print "\tstruct BINS\n";
+	print "\t{\n";
+	print "\t\tBOX bounds[3][BVH_BINS];\n";
+	print "\t\tunsigned counts[3][BVH_BINS];\n";
+	print "\n";
+	print "\t\tBINS() { memset(counts, 0, sizeof(counts)); }\n";
+	print "\t\tvoid Add(const unsigned& axis, const unsigned& bin, const BOX& box, const unsigned& count)\n";
+	print "\t\t{\n";
+	print "\t\t\tbounds[axis][bin] = (counts[axis][bin] > 0) ? Union(bounds[axis][bin], box) : box;\n";
+	print "\t\t\tcounts[axis][bin] += count;\n";
+	print "\t\t}\n";
+	print "\t\tvoid Add(const BINS& other) { for (unsigned axis = 0; axis < 3; axis++) { for (unsigned bin = 0; bin < BVH_BINS; bin++) { if (other.counts[axis][bin] > 0) { Add(axis, bin, other.bounds[axis][bin], other.counts[axis][bin]); } } } }\n";
+	print "\t};\n";
+	print "\n";
+	print "\t// A box being built into the tree, with its centroid and index\n";
+	print "\tstruct PRIMITIVE\n";
+	print "\t{\n";
+	print "\t\tBOX box;\n";
+	print "\t\tVECTOR centroid;\n";
+	print "\t\tunsigned index;\n";
+	print "\n";
+	print "\t\tPRIMITIVE() {}\n";
+	print "\t\tPRIMITIVE(const BOX& box, const unsigned& index) : box(box), centroid(Center(box)), index(index) {}\n";
+	print "\t};\n";
+	print "\n";
+	print "\t// Whether a primitive goes to the left of a range's split\n";
+	print "\tstruct LEFT_OF_SPLIT\n";
+	print "\t{\n";
+	print "\t\tunsigned axis, bin;\n";
+	print "\t\tTYPE minimum, scale;\n";
+	print "\n";
+	print "\t\tLEFT_OF_SPLIT(const RANGE& range) : axis(range.axis), bin(range.bin), minimum(range.centroids.minimum.Component(range.axis)), scale((TYPE)BVH_BINS / Size(range.centroids).Component(range.axis)) {}\n";
+	print "\t\tbool operator()(const PRIMITIVE& primitive) const { return BvhBin(primitive.centroid.Component(axis), minimum, scale) <= bin; }\n";
+	print "\t};\n";
+	print "\n";
+	print "\tvoid NoPool()\n";
+	print "\t{\n";
+	print "#ifdef SVML_USE_THREADS\n";
+	print "\t\tpool = 0;\n";
+	print "#endif\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// The set bits of hits, as slots in order of distance (then slot), and how many there are\n";
+	print "\tstatic unsigned SortHits(const unsigned& hits, const TYPE distances[4], unsigned slots[4])\n";
+	print "\t{\n";
+	print "\t\tunsigned count = 0;\n";
+	print "\t\tfor (unsigned c = 0; c < 4; c++)\n";
+	print "\t\t{\n";
+	print "\t\t\tif ((hits >> c) & 1)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tunsigned h = count++;\n";
+	print "\t\t\t\tfor (; h > 0 && distances[slots[h - 1]] > distances[c]; h--)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tslots[h] = slots[h - 1];\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tslots[h] = c;\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t\treturn count;\n";
+	print "\t}\n";
+	print "\n";
+	print "\tvoid BuildNodes()\n";
+	print "\t{\n";
+	print "\t\tstd::vector<NODE> built;\n";
+	print "\t\tdepth = 0;\n";
+	print "\t\tif (!primitives.empty())\n";
+	print "\t\t{\n";
+	print "\t\t\tRANGE root;\n";
+	print "\t\t\troot.first = 0;\n";
+	print "\t\t\troot.last = (unsigned)primitives.size();\n";
+	print "\t\t\tEvaluate(root);\n";
+	print "\t\t\tBuildNode(built, root, 1);\n";
+	print "\t\t}\n";
+	print "\t\tAlignedFree(nodes);\n";
+	print "\t\tnodes = AlignedCopy(built.empty() ? 0 : &built[0], (unsigned)built.size());\n";
+	print "\t\tnodeCount = (unsigned)built.size();\n";
+	print "\n";
+	print "\t\tboxes.resize(primitives.size());\n";
+	print "\t\torder.resize(primitives.size());\n";
+	print "\t\tfor (unsigned slot = 0; slot < primitives.size(); slot++)\n";
+	print "\t\t{\n";
+	print "\t\t\tboxes[slot] = primitives[slot].box;\n";
+	print "\t\t\torder[slot] = primitives[slot].index;\n";
+	print "\t\t}\n";
+	print "\t\tstd::vector<PRIMITIVE>().swap(primitives);\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Splits the largest of the child ranges that are not leaves until there are four children\n";
+	print "\tunsigned BuildNode(std::vector<NODE>& built, const RANGE& range, const unsigned& level)\n";
+	print "\t{\n";
+	print "\t\tunsigned index = (unsigned)built.size();\n";
+	print "\t\tbuilt.push_back(NODE());\n";
+	print "\t\tdepth = std::max(depth, level);\n";
+	print "\t\tRANGE children[4];\n";
+	print "\t\tchildren[0] = range;\n";
+	print "\t\tunsigned used = 1;\n";
+	print "\t\twhile (used < 4)\n";
+	print "\t\t{\n";
+	print "\t\t\tint largest = -1;\n";
+	print "\t\t\tfor (unsigned c = 0; c < used; c++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tif (!children[c].leaf && (largest < 0 || SurfaceArea(children[c].bounds) > SurfaceArea(children[largest].bounds)))\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tlargest = (int)c;\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t\tif (largest < 0)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tbreak;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tSplit(children[largest], children[used]);\n";
+	print "\t\t\tused++;\n";
+	print "\t\t}\n";
+	print "\t\tNODE node;\n";
+	print "\t\tfor (unsigned c = 0; c < used; c++)\n";
+	print "\t\t{\n";
+	print "\t\t\tnode.bounds.Set(c, children[c].bounds);\n";
+	print "\t\t\tnode.child[c] = children[c].leaf ? children[c].first : BuildNode(built, children[c], level + 1);\n";
+	print "\t\t\tnode.count[c] = children[c].leaf ? children[c].last - children[c].first : 0;\n";
+	print "\t\t}\n";
+	print "\t\tbuilt[index] = node;\n";
+	print "\t\treturn index;\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Moves the primitives right of range's split to right, and evaluates both halves\n";
+	print "\tvoid Split(RANGE& range, RANGE& right)\n";
+	print "\t{\n";
+	print "\t\tunsigned middle = range.first + (range.last - range.first) / 2;\n";
+	print "\t\tif (range.axis < 3)\n";
+	print "\t\t{\n";
+	print "\t\t\tmiddle = (unsigned)(std::partition(primitives.begin() + range.first, primitives.begin() + range.last, LEFT_OF_SPLIT(range)) - primitives.begin());\n";
+	print "\t\t}\n";
+	print "\t\tright.first = middle;\n";
+	print "\t\tright.last = range.last;\n";
+	print "\t\trange.last = middle;\n";
+	print "\t\tEvaluate(range);\n";
+	print "\t\tEvaluate(right);\n";
+	print "\t}\n";
+	print "\n";
+	print "\t// Measures a range and decides its split: the binned split of the least surface area heuristic cost (each side's\n";
+	print "\t// surface area times its primitives), or a leaf when it is small and that costs less\n";
+	print "\tvoid Evaluate(RANGE& range)\n";
+	print "\t{\n";
+	print "\t\tunsigned count = range.last - range.first;\n";
+	print "\t\tMeasure(range);\n";
+	print "\t\trange.leaf = count <= 1;\n";
+	print "\t\trange.axis = 3;\n";
+	print "\t\trange.bin = 0;\n";
+	print "\t\tif (range.leaf)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn;\n";
+	print "\t\t}\n";
+	print "\t\tBINS bins = Bin(range);\n";
+	print "\t\tVECTOR extent = Size(range.centroids);\n";
+	print "\t\tTYPE best = 0;\n";
+	print "\t\tfor (unsigned axis = 0; axis < 3; axis++)\n";
+	print "\t\t{\n";
+	print "\t\t\tif (!(extent.Component(axis) > 0))\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tcontinue;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tTYPE rightCosts[BVH_BINS];\n";
+	print "\t\t\tBOX side = BOX::Empty();\n";
+	print "\t\t\tunsigned sideCount = 0;\n";
+	print "\t\t\tTYPE sideCost = 0;\n";
+	print "\t\t\tfor (unsigned bin = BVH_BINS - 1; bin > 0; bin--)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tif (bins.counts[axis][bin] > 0)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tside = Union(side, bins.bounds[axis][bin]);\n";
+	print "\t\t\t\t\tsideCount += bins.counts[axis][bin];\n";
+	print "\t\t\t\t\tsideCost = SurfaceArea(side) * (TYPE)sideCount;\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\trightCosts[bin] = sideCost;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tside = BOX::Empty();\n";
+	print "\t\t\tsideCount = 0;\n";
+	print "\t\t\tfor (unsigned bin = 0; bin + 1 < BVH_BINS; bin++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tif (bins.counts[axis][bin] == 0)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tcontinue; // The same split as the last bin's\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tside = Union(side, bins.bounds[axis][bin]);\n";
+	print "\t\t\t\tsideCount += bins.counts[axis][bin];\n";
+	print "\t\t\t\tif (sideCount == count)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tcontinue;\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\tTYPE cost = SurfaceArea(side) * (TYPE)sideCount + rightCosts[bin + 1];\n";
+	print "\t\t\t\tif (range.axis == 3 || cost < best)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tbest = cost;\n";
+	print "\t\t\t\t\trange.axis = axis;\n";
+	print "\t\t\t\t\trange.bin = bin;\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\n";
+	print "\t\t// Relative to the cost of intersecting a primitive, visiting a node costs one as well\n";
+	print "\t\tTYPE area = SurfaceArea(range.bounds);\n";
+	print "\t\tif (count <= BVH_MAX_LEAF)\n";
+	print "\t\t{\n";
+	print "\t\t\trange.leaf = range.axis == 3 || area * (TYPE)count <= area + best;\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\tvoid Measure(RANGE& range) const\n";
+	print "\t{\n";
+	print "#ifdef SVML_USE_THREADS\n";
+	print "\t\tif (pool != 0 && range.last - range.first > grain)\n";
+	print "\t\t{\n";
+	print "\t\t\ttypedef std::pair<BOX, BOX> BOUNDS;\n";
+	print "\t\t\tBOUNDS measured = Bulk::ReduceChunks(range.last - range.first, BOUNDS(BOX::Empty(), BOX::Empty()), [&](size_t begin, size_t end)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tBOUNDS chunk(BOX::Empty(), BOX::Empty());\n";
+	print "\t\t\t\tfor (size_t i = range.first + begin; i < range.first + end; i++)\n";
+	print "\t\t\t\t{\n";
+	print "\t\t\t\t\tchunk.first = Union(chunk.first, primitives[i].box);\n";
+	print "\t\t\t\t\tchunk.second = Union(chunk.second, primitives[i].centroid);\n";
+	print "\t\t\t\t}\n";
+	print "\t\t\t\treturn chunk;\n";
+	print "\t\t\t}, [](const BOUNDS& a, const BOUNDS& b) { return BOUNDS(Union(a.first, b.first), Union(a.second, b.second)); }, grain, *pool);\n";
+	print "\t\t\trange.bounds = measured.first;\n";
+	print "\t\t\trange.centroids = measured.second;\n";
+	print "\t\t\treturn;\n";
+	print "\t\t}\n";
+	print "#endif\n";
+	print "\t\trange.bounds = range.centroids = BOX::Empty();\n";
+	print "\t\tfor (unsigned i = range.first; i < range.last; i++)\n";
+	print "\t\t{\n";
+	print "\t\t\trange.bounds = Union(range.bounds, primitives[i].box);\n";
+	print "\t\t\trange.centroids = Union(range.centroids, primitives[i].centroid);\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\tvoid BinRange(BINS& bins, const RANGE& range, const unsigned& first, const unsigned& last) const\n";
+	print "\t{\n";
+	print "\t\tVECTOR extent = Size(range.centroids);\n";
+	print "\t\tfor (unsigned axis = 0; axis < 3; axis++)\n";
+	print "\t\t{\n";
+	print "\t\t\tif (!(extent.Component(axis) > 0))\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tcontinue;\n";
+	print "\t\t\t}\n";
+	print "\t\t\tTYPE minimum = range.centroids.minimum.Component(axis);\n";
+	print "\t\t\tTYPE scale = (TYPE)BVH_BINS / extent.Component(axis);\n";
+	print "\t\t\tfor (unsigned i = first; i < last; i++)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tbins.Add(axis, BvhBin(primitives[i].centroid.Component(axis), minimum, scale), primitives[i].box, 1);\n";
+	print "\t\t\t}\n";
+	print "\t\t}\n";
+	print "\t}\n";
+	print "\n";
+	print "\tBINS Bin(const RANGE& range) const\n";
+	print "\t{\n";
+	print "#ifdef SVML_USE_THREADS\n";
+	print "\t\tif (pool != 0 && range.last - range.first > grain)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn Bulk::ReduceChunks(range.last - range.first, BINS(), [&](size_t begin, size_t end)\n";
+	print "\t\t\t{\n";
+	print "\t\t\t\tBINS chunk;\n";
+	print "\t\t\t\tBinRange(chunk, range, range.first + (unsigned)begin, range.first + (unsigned)end);\n";
+	print "\t\t\t\treturn chunk;\n";
+	print "\t\t\t}, [](BINS a, const BINS& b) { a.Add(b); return a; }, grain, *pool);\n";
+	print "\t\t}\n";
+	print "#endif\n";
+	print "\t\tBINS bins;\n";
+	print "\t\tBinRange(bins, range, range.first, range.last);\n";
+	print "\t\treturn bins;\n";
+	print "\t}\n";
+	print "\n";
+	print "\tstd::vector<BOX> boxes; // In leaf order\n";
+	print "\tstd::vector<unsigned> order; // Of boxes[slot], given to Build()\n";
+	print "\tstd::vector<PRIMITIVE> primitives; // While building\n";
+	print "\tNODE* nodes;\n";
+	print "\tunsigned nodeCount;\n";
+	print "\tunsigned depth; // Levels of nodes\n";
+	print "#ifdef SVML_USE_THREADS\n";
+	print "\tBulk::WORK_POOL* pool; // While building, when the pool builds it\n";
+	print "\tsize_t grain;\n";
+	print "#endif\n";
+	print "};\n";
+	print "\n";
+}
+
+return 1;
@@ -2,18 +2,16 @@
 
 require "util.pl";
 
-# ToString, Normalize, Dot, Project, Distance, DistanceSquared, Lerp
+# operator<< and ToString (printed in svml_io.h), Normalize, Dot, Project, Distance, DistanceSquared, Lerp
 
 sub ToString
 {
 	my($dimension) = @_;
 	
-	print "// " . $dimension . "D ToString()\n";
-	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, string >::type ToString(const SWIZZLE& printSwizzle) { return ToString(typename SWIZZLE::PARENT(printSwizzle)); }\n";
-	print "template <typename TYPE> string ToString(const VECTOR" . $dimension . "<TYPE>& printVector)\n";
+	print "// " . $dimension . "D operator<< and ToString()\n";
+	print "template <typename TYPE> ostream& operator<<(ostream& os, const VECTOR" . $dimension . "<TYPE>& printVector)\n";
 	print "{\n";
-	print "\tstd::ostringstream buffer;\n";
-	print "\tbuffer << \"(\" << ";
+	print "\tos << \"(\" << ";
 	
 		for ($d = 0; $d < $dimension; $d++)
 		{
@@ -21,12 +19,21 @@ sub ToString
 			{
 				print " << \", \" << ";
 			}
-			print "printVector." . NumberToSwizzle($d);
+			print "printVector.Component(" . $d . ")";
 		}
 	
 	print " << \")\";\n";
+	print "\treturn os;\n";
+	print "}\n";
+	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, ostream >::type& operator<<(ostream& os, const SWIZZLE& printVector) { return os << typename SWIZZLE::PARENT(printVector); }\n";
+	print "template <typename TYPE> string ToString(const VECTOR" . $dimension . "<TYPE>& printVector)\n";
+	print "{\n";
+	print "\tstd::ostringstream buffer;\n";
+	print "\tbuffer << printVector;\n";
 	print "\treturn buffer.str();\n";
-	print "}\n\n";
+	print "}\n";
+	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, string >::type ToString(const SWIZZLE& printSwizzle) { return ToString(typename SWIZZLE::PARENT(printSwizzle)); }\n";
+	print "\n";
 }
 
 sub Normalize
@@ -43,9 +50,31 @@ sub Normalize
 	}
 	else
 	{
+		print "#ifdef SVML_FAST_RSQRT\n";
+		print "\treturn toNormalize * PrecisionDivideByLength((TYPE)1, " . join(", ", map { ComponentOf("toNormalize", $_) } (0 .. $dimension - 1)) . ");\n";
+		print "#else\n";
 		print "\treturn toNormalize / toNormalize.Length;\n";
+		print "#endif\n";
 	}
 	print "}\n\n";
+
+	# .Length saturates past 32767 and the reciprocal of a long length keeps few bits, so FIXED divides each component
+	# by the 64-bit length instead, with or without SVML_FAST_RSQRT
+	print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+	print "// " . $dimension . "D fixed-point Normalize(), each component divided by the length summed in 64 bits\n";
+	if ($dimension != 4)
+	{
+		print "inline VECTOR" . $dimension . "<FIXED> Normalize(const VECTOR" . $dimension . "<FIXED>& toNormalize)\n";
+		print "{\n";
+		$components = join(", ", map { ComponentOf("toNormalize", $_) } (0 .. $dimension - 1));
+		print "\treturn VECTOR" . $dimension . "<FIXED>(" . join(", ", map { "PrecisionDivideByLength(" . ComponentOf("toNormalize", $_) . ", " . $components . ")" } (0 .. $dimension - 1)) . ");\n";
+		print "}\n";
+	}
+	print "template <> inline void VECTOR" . $dimension . "<FIXED>::Normalize() { *this = SVML::Normalize(*this); }\n";
+	print "#endif // SVML_HAS_CLASS_COMPONENTS\n";
+	print "\n";
+
+	PrintSimdNormalize($dimension);
 }
 
 sub Dot
@@ -53,32 +82,29 @@ sub Dot
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Dot()\n";
-	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type Dot(const SWIZZLE0& a, const SWIZZLE1& b) { return Dot(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
-	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Dot(const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return Dot(typename SWIZZLE::PARENT(a), b); }\n";
-	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Dot(const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return Dot(a, typename SWIZZLE::PARENT(b)); }\n";
-	print "template <typename TYPE> SCALAR_TYPE Dot(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
+	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type Dot(const SWIZZLE0& a, const SWIZZLE1& b) { return Dot(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
+	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Dot(const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return Dot(typename SWIZZLE::PARENT(a), b); }\n";
+	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Dot(const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return Dot(a, typename SWIZZLE::PARENT(b)); }\n";
+	print "template <typename TYPE> SVML_CONSTEXPR typename ScalarType<TYPE>::type Dot(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
 	print "{\n";
 	print "\treturn ";
 	
-	if ($dimension == 4)
-	{
-		print "Dot(a.xyz, b.xyz)"
-	}
-	else
-	{
+	# 4D vectors are homogeneous, so only x, y and z take part
+	$useDimension = ($dimension == 4) ? 3 : $dimension;
 	
-		for ($d = 0; $d < $dimension; $d++)
+		for ($d = 0; $d < $useDimension; $d++)
 		{
 			if ($d > 0)
 			{
 				print " + ";
 			}
-			print "a." . NumberToSwizzle($d) . " * b." . NumberToSwizzle($d);
+			print ComponentOf("a", $d) . " * " . ComponentOf("b", $d);
 		}
 	
-	}
 	print ";\n";
 	print "}\n\n";
+	
+	PrintSimdDot($dimension);
 }
 
 sub Projection
@@ -100,6 +126,8 @@ sub Projection
 		print "\treturn (Dot(projectThis, ontoThis) / Dot(ontoThis, ontoThis)) * ontoThis;\n";
 	}
 	print "}\n\n";
+	
+	PrintSimdProjection($dimension);
 }
 
 sub Distance
@@ -107,20 +135,22 @@ sub Distance
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Distance()\n";
-	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type Distance(const SWIZZLE0& a, const SWIZZLE1& b) { return Distance(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
-	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Distance(const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return Distance(typename SWIZZLE::PARENT(a), b); }\n";
-	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Distance(const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return Distance(a, typename SWIZZLE::PARENT(b)); }\n";
-	print "template <typename TYPE> SCALAR_TYPE Distance(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
+	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type Distance(const SWIZZLE0& a, const SWIZZLE1& b) { return Distance(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
+	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Distance(const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return Distance(typename SWIZZLE::PARENT(a), b); }\n";
+	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Distance(const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return Distance(a, typename SWIZZLE::PARENT(b)); }\n";
+	print "template <typename TYPE> typename ScalarType<TYPE>::type Distance(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
 	print "{\n";
 	if ($dimension == 4)
 	{
-		print "\treturn sqrt(DistanceSquared(a.xyz, b.xyz));\n";
+		print "\treturn Distance(a.xyz, b.xyz);\n";
 	}
 	else
 	{
-		print "\treturn sqrt(DistanceSquared(a, b));\n";
+		print "\treturn PrecisionLength(" . join(", ", map { "(typename ScalarType<TYPE>::type)(a." . $_ . " - b." . $_ . ")" } SoaComponents($dimension)) . ");\n";
 	}
 	print "}\n\n";
+	
+	PrintSimdDistance($dimension);
 }
 
 sub DistanceSquared
@@ -128,10 +158,10 @@ sub DistanceSquared
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D DistanceSquared()\n";
-	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type DistanceSquared(const SWIZZLE0& a, const SWIZZLE1& b) { return DistanceSquared(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
-	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type DistanceSquared(const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return DistanceSquared(typename SWIZZLE::PARENT(a), b); }\n";
-	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type DistanceSquared(const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return DistanceSquared(a, typename SWIZZLE::PARENT(b)); }\n";
-	print "template <typename TYPE> SCALAR_TYPE DistanceSquared(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
+	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type DistanceSquared(const SWIZZLE0& a, const SWIZZLE1& b) { return DistanceSquared(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }\n";
+	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type DistanceSquared(const SWIZZLE& a, const VECTOR" . $dimension . "<TYPE>& b) { return DistanceSquared(typename SWIZZLE::PARENT(a), b); }\n";
+	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type DistanceSquared(const VECTOR" . $dimension . "<TYPE>& a, const SWIZZLE& b) { return DistanceSquared(a, typename SWIZZLE::PARENT(b)); }\n";
+	print "template <typename TYPE> typename ScalarType<TYPE>::type DistanceSquared(const VECTOR" . $dimension . "<TYPE>& a, const VECTOR" . $dimension . "<TYPE>& b)\n";
 	print "{\n";
 	print "\treturn ";
 	
@@ -154,6 +184,8 @@ sub DistanceSquared
 	}
 	print ";\n";
 	print "}\n\n";
+	
+	PrintSimdDistanceSquared($dimension);
 }
 
 sub Lerp
@@ -161,23 +193,26 @@ sub Lerp
 	my($dimension) = @_;
 	
 	print "// " . $dimension . "D Lerp()\n";
-	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Lerp(const SWIZZLE0& start, const SWIZZLE1& end, const SCALAR_TYPE& delta) { return Lerp(typename SWIZZLE0::PARENT(start), typename SWIZZLE1::PARENT(end), delta); }\n";
-	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const SWIZZLE& start, const VECTOR" . $dimension . "<TYPE>& end, const SCALAR_TYPE& delta) { return Lerp(typename SWIZZLE::PARENT(start), end, delta); }\n";
-	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const VECTOR" . $dimension . "<TYPE>& start, const SWIZZLE& end, const SCALAR_TYPE& delta) { return Lerp(start, typename SWIZZLE::PARENT(end), delta); }\n";
-	print "template <typename TYPE> VECTOR" . $dimension . "<TYPE> Lerp(const VECTOR" . $dimension . "<TYPE>& start, const VECTOR" . $dimension . "<TYPE>& end, const SCALAR_TYPE& delta)\n";
+	print "template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE0::PARENT >, typename EnableIf< Is" . $dimension . "D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Lerp(const SWIZZLE0& start, const SWIZZLE1& end, const typename RealType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type& delta) { return Lerp(typename SWIZZLE0::PARENT(start), typename SWIZZLE1::PARENT(end), delta); }\n";
+	print "template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const SWIZZLE& start, const VECTOR" . $dimension . "<TYPE>& end, const typename RealType<TYPE>::type& delta) { return Lerp(typename SWIZZLE::PARENT(start), end, delta); }\n";
+	print "template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const VECTOR" . $dimension . "<TYPE>& start, const SWIZZLE& end, const typename RealType<TYPE>::type& delta) { return Lerp(start, typename SWIZZLE::PARENT(end), delta); }\n";
+	print "template <typename TYPE> SVML_CONSTEXPR VECTOR" . $dimension . "<TYPE> Lerp(const VECTOR" . $dimension . "<TYPE>& start, const VECTOR" . $dimension . "<TYPE>& end, const typename RealType<TYPE>::type& delta)\n";
 	print "{\n";
-	print "\treturn VECTOR" . $dimension . "<TYPE>(start.x + delta * (end.x - start.x),\n";
-	print "\t                     start.y + delta * (end.y - start.y)";
-	if ($dimension > 2)
-	{
-		print ",\n\t                     start.z + delta * (end.z - start.z)";
-	}
-	if ($dimension > 3)
-	{
-		print ",\n\t                     start.w + delta * (end.w - start.w)";
-	}
+	print "\treturn VECTOR" . $dimension . "<TYPE>(";
+	
+		for ($d = 0; $d < $dimension; $d++)
+		{
+			if ($d > 0)
+			{
+				print ",\n\t                     ";
+			}
+			print ComponentOf("start", $d) . " + delta * (" . ComponentOf("end", $d) . " - " . ComponentOf("start", $d) . ")";
+		}
+	
 	print ");\n";
 	print "}\n\n";
+	
+	PrintSimdLerp($dimension);
 }
 
 return 1;
\ No newline at end of file
@@ -1,10 +1,8 @@
 #!/usr/bin/perl -w
 
-sub TopData
+# Every header starts with the same comment
+sub License
 {
-	print "#ifndef SVML_H\n";
-	print "#define SVML_H\n";
-	print "\n";
 	print "/*\n";
 	print "\n";
 	print "SVML - Simple Vector Math Library\n";
@@ -19,9 +17,113 @@ sub TopData
 	print "\n";
 	print "*/\n";
 	print "\n";
-	print "#include <iostream> // cout, endl\n";
-	print "#include <sstream> // ostream, ostringstream, string\n";
+}
+
+# svml_core.h: the configuration, scalar math, component types and the machinery the vector headers share, without
+# <iostream> or <sstream> (printing is in svml_io.h)
+sub TopData
+{
+	print "#ifndef SVML_CORE_H\n";
+	print "#define SVML_CORE_H\n";
+	print "\n";
+	License();
+	print "#include <stdio.h> // printf, sprintf, FILE, fopen, fwrite, fread, fseek\n";
 	print "#include <math.h> // sqrt, fabs, min, max, ceil, floor, sin, cos\n";
+	print "#include <stdlib.h> // malloc, free\n";
+	print "#include <string.h> // memcpy, memset\n";
+	print "#include <limits> // numeric_limits\n";
+	print "#include <stdint.h> // int32_t, int64_t\n";
+	print "#include <vector> // vector\n";
+	print "#include <algorithm> // max, min, sort, find, nth_element, partition, push_heap, pop_heap, sort_heap\n";
+	print "\n";
+	print "// Constant expressions (C++14 and later; constexpr functions in C++11 are too limited)\n";
+	print "#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)\n";
+	print "#define SVML_HAS_CONSTEXPR\n";
+	print "#define SVML_CONSTEXPR constexpr\n";
+	print "#else\n";
+	print "#define SVML_CONSTEXPR inline\n";
+	print "#endif\n";
+	print "\n";
+	print "// Shortest round-trip number text for ToChars() and FromChars(): std::to_chars() and std::from_chars() where the\n";
+	print "// library has them for floating point (C++17), sprintf() and strtod() otherwise\n";
+	print "#if (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)) && defined(__has_include)\n";
+	print "#if __has_include(<charconv>)\n";
+	print "#include <charconv> // to_chars, from_chars\n";
+	print "#endif\n";
+	print "#endif\n";
+	print "#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L\n";
+	print "#define SVML_HAS_TO_CHARS\n";
+	print "#endif\n";
+	print "\n";
+	print "// Vectors of class components (VECTOR3<HALF>, VECTOR2<FIXED> and the like, C++11 and later): a defaulted constructor\n";
+	print "// keeps the component trivial, as a member of the vector's union must be\n";
+	print "#if __cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L)\n";
+	print "#define SVML_HAS_CLASS_COMPONENTS\n";
+	print "#endif\n";
+	print "\n";
+	print "// Precision of the square roots in Normalize(), .Normalize(), .Length and Distance()\n";
+	print "// (define SVML_PRECISION as one of these before including svml.h)\n";
+	print "#define SVML_PRECISION_EXACT 0 // sqrt() and division (default)\n";
+	print "#define SVML_PRECISION_REFINED 1 // float: SSE reciprocal square root estimate plus one Newton-Raphson step\n";
+	print "#define SVML_PRECISION_ESTIMATE 2 // float: SSE reciprocal square root estimate alone\n";
+	print "#ifndef SVML_PRECISION\n";
+	print "#define SVML_PRECISION SVML_PRECISION_EXACT\n";
+	print "#endif\n";
+	print "#if SVML_PRECISION != SVML_PRECISION_EXACT && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))\n";
+	print "#define SVML_FAST_RSQRT // Without SSE the fast modes fall back to sqrt()\n";
+	print "#endif\n";
+	print "\n";
+	print "#if defined(SVML_USE_SSE) || defined(SVML_FAST_RSQRT)\n";
+	print "#include <xmmintrin.h> // __m128, SSE intrinsics\n";
+	print "#endif\n";
+	print "#ifdef SVML_USE_SSE\n";
+	print "#ifdef __SSE4_1__\n";
+	print "#include <smmintrin.h> // _mm_ceil_ps, _mm_floor_ps, _mm_mullo_epi32\n";
+	print "#endif\n";
+	print "#ifdef __SSE2__\n";
+	print "#include <emmintrin.h> // __m128i, bfloat16 conversion, SimdSinCos()\n";
+	print "#endif\n";
+	print "#if defined(__AVX__) || defined(__F16C__) || defined(__AVX512F__)\n";
+	print "#include <immintrin.h> // __m256d, _mm_cvtps_ph, _mm_cvtph_ps, _mm512_cvtps_ph\n";
+	print "#endif\n";
+	print "#endif\n";
+	print "\n";
+	print "// Parallel bulk operations on spans (define SVML_USE_THREADS, C++11 and later)\n";
+	print "#ifdef SVML_USE_THREADS\n";
+	print "#if __cplusplus < 201103L && !(defined(_MSVC_LANG) && _MSVC_LANG >= 201103L)\n";
+	print "#error \"SVML_USE_THREADS needs C++11 (std::thread)\"\n";
+	print "#endif\n";
+	print "#include <atomic> // atomic\n";
+	print "#include <condition_variable> // condition_variable\n";
+	print "#include <mutex> // mutex, lock_guard, unique_lock\n";
+	print "#include <thread> // thread\n";
+	print "#endif\n";
+	print "\n";
+	print "// Float bulk kernels for SSE2, AVX2 and AVX-512, picked at run time (SVML_USE_THREADS on x86-64 with GCC, Clang or\n";
+	print "// MSVC, and the exact SVML_PRECISION; define SVML_NO_DISPATCH to keep the plain loops)\n";
+	print "#if defined(SVML_USE_THREADS) && !defined(SVML_NO_DISPATCH) && SVML_PRECISION == SVML_PRECISION_EXACT && (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))\n";
+	print "#define SVML_HAS_DISPATCH\n";
+	print "#include <immintrin.h> // __m256, __m512, AVX2 and AVX-512 intrinsics\n";
+	print "#if defined(_MSC_VER) && !defined(__clang__)\n";
+	print "#include <intrin.h> // __cpuidex, _xgetbv\n";
+	print "#define SVML_TARGET(isa)\n";
+	print "#elif defined(__clang__)\n";
+	print "#define SVML_TARGET(isa) __attribute__((target(isa)))\n";
+	print "#else\n";
+	print "#define SVML_TARGET(isa) __attribute__((target(isa), optimize(\"fp-contract=off\"))) // AVX-512 brings FMA, which would change the bits\n";
+	print "#endif\n";
+	print "#endif\n";
+	print "\n";
+	print "// Binary files of vectors, memory-mapped where there's mmap() (define SVML_USE_FILES)\n";
+	print "#ifdef SVML_USE_FILES\n";
+	print "#if defined(__unix__) || defined(__APPLE__)\n";
+	print "#define SVML_HAS_MMAP\n";
+	print "#include <fcntl.h> // open\n";
+	print "#include <sys/mman.h> // mmap, munmap\n";
+	print "#include <sys/stat.h> // fstat\n";
+	print "#include <unistd.h> // close\n";
+	print "#endif\n";
+	print "#endif\n";
 	print "\n";
 	print "namespace SVML\n";
 	print "{\n";
@@ -32,11 +134,6 @@ sub TopData
 	print "// \n";
 	print "//----------------------------------------------------------------------\n";
 	print "\n";
-	print "using std::cout;\n";
-	print "using std::endl;\n";
-	print "using std::string;\n";
-	print "using std::ostream;\n";
-	print "using std::ostringstream;\n";
 	print "using std::max;\n";
 	print "using std::min;\n";
 	print "\n";
@@ -46,17 +143,115 @@ sub TopData
 	print "// Global constants\n";
 	print "const SCALAR_TYPE COMPARISON_EPSILON = (SCALAR_TYPE)0.000001; // Used by AlmostEqual()\n";
 	print "\n";
+	print "// Scalar type of vectors of TYPE: what their lengths, dot products and distances return, and what scalar factors\n";
+	print "// they take. TYPE itself, so double vectors keep double precision and int vectors stay integer; the storage types\n";
+	print "// HALF and BFLOAT16 compute in float\n";
+	print "template <typename TYPE> struct ScalarType\n";
+	print "{\n";
+	print "\ttypedef TYPE type;\n";
+	print "\tstatic type Epsilon() { return ((type)COMPARISON_EPSILON > 0) ? (type)COMPARISON_EPSILON : (type)1; } // Used by AlmostEqual(); integers must match exactly\n";
+	print "};\n";
+	print "\n";
+	print "// Type of the angles and Lerp() deltas vectors of TYPE take: their ScalarType, except that integer vectors rotate\n";
+	print "// and interpolate by SCALAR_TYPE, as an integer delta or angle could only be a whole turn or a whole step\n";
+	print "template <typename TYPE, bool INTEGER = std::numeric_limits<TYPE>::is_integer> struct RealType { typedef typename ScalarType<TYPE>::type type; };\n";
+	print "template <typename TYPE> struct RealType<TYPE, true> { typedef SCALAR_TYPE type; };\n";
+	print "\n";
+	print "// Mask of the component-wise comparisons of vectors of TYPE, given the MASK2 to MASK4 of their dimension. That mask\n";
+	print "// itself, except for WIDE components, which compare lane by lane into a mask per lane\n";
+	print "template <typename TYPE, typename MASK> struct MaskType { typedef MASK type; };\n";
+	print "\n";
 	print "// Predefines\n";
 	print "template <typename TYPE> union VECTOR2;\n";
 	print "template <typename TYPE> union VECTOR3;\n";
 	print "template <typename TYPE> union VECTOR4;\n";
+	print "template <typename TYPE> struct MATRIX2;\n";
+	print "template <typename TYPE> struct MATRIX3;\n";
+	print "template <typename TYPE> struct MATRIX4;\n";
+	print "template <typename TYPE> struct QUATERNION;\n";
+	print "template <typename TYPE> struct ROTATION2;\n";
+	print "template <typename TYPE> struct AABB2;\n";
+	print "template <typename TYPE> struct AABB3;\n";
+	print "template <typename TYPE> class HASH_GRID2;\n";
+	print "template <typename TYPE> class HASH_GRID3;\n";
+	print "template <typename TYPE> class KD_TREE2;\n";
+	print "template <typename TYPE> class KD_TREE3;\n";
+	print "template <typename TYPE> class BVH3;\n";
+	print "struct MASK2;\n";
+	print "struct MASK3;\n";
+	print "struct MASK4;\n";
+	print "struct HALF;\n";
+	print "struct BFLOAT16;\n";
+	print "struct FIXED;\n";
+	print "template <typename TYPE, int N> struct WIDE;\n";
 	print "\n";
 	print "// Default types (BUILT-IN TYPE CUSTOMIZATION HERE!)\n";
 	print "typedef VECTOR2<float> vec2;\n";
 	print "typedef VECTOR3<float> vec3;\n";
 	print "typedef VECTOR4<float> vec4;\n";
+	print "typedef MASK2 bvec2;\n";
+	print "typedef MASK3 bvec3;\n";
+	print "typedef MASK4 bvec4;\n";
+	print "typedef MATRIX2<float> mat2;\n";
+	print "typedef MATRIX3<float> mat3;\n";
+	print "typedef MATRIX4<float> mat4;\n";
+	print "typedef QUATERNION<float> quat;\n";
+	print "typedef ROTATION2<float> rot2;\n";
+	print "typedef AABB2<float> aabb2;\n";
+	print "typedef AABB3<float> aabb3;\n";
+	print "typedef HASH_GRID2<float> hashgrid2;\n";
+	print "typedef HASH_GRID3<float> hashgrid3;\n";
+	print "typedef KD_TREE2<float> kdtree2;\n";
+	print "typedef KD_TREE3<float> kdtree3;\n";
+	print "typedef BVH3<float> bvh3;\n";
+	print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+	print "typedef VECTOR2<HALF> f16vec2;\n";
+	print "typedef VECTOR3<HALF> f16vec3;\n";
+	print "typedef VECTOR4<HALF> f16vec4;\n";
+	print "typedef VECTOR2<BFLOAT16> bf16vec2;\n";
+	print "typedef VECTOR3<BFLOAT16> bf16vec3;\n";
+	print "typedef VECTOR4<BFLOAT16> bf16vec4;\n";
+	print "typedef VECTOR2<FIXED> fxvec2;\n";
+	print "typedef VECTOR3<FIXED> fxvec3;\n";
+	print "typedef VECTOR4<FIXED> fxvec4;\n";
+	print "typedef VECTOR2< WIDE<float, 8> > wvec2;\n";
+	print "typedef VECTOR3< WIDE<float, 8> > wvec3;\n";
+	print "typedef VECTOR4< WIDE<float, 8> > wvec4;\n";
+	print "#endif\n";
 	print "// etc.\n";
 	print "\n";
+	print "// Swizzles write a vector's components through one struct type and read them through another, so the\n";
+	print "// compiler must not assume accesses through different swizzle types are independent\n";
+	print "#if defined(__GNUC__)\n";
+	print "#define SVML_MAY_ALIAS __attribute__((__may_alias__))\n";
+	print "#else\n";
+	print "#define SVML_MAY_ALIAS\n";
+	print "#endif\n";
+	print "\n";
+	print "// Out of bounds access and other misuse print an error and exit, with printf() so that only svml_io.h needs iostreams\n";
+	print "#if defined(__GNUC__)\n";
+	print "#define SVML_NORETURN __attribute__((__noreturn__))\n";
+	print "#elif defined(_MSC_VER)\n";
+	print "#define SVML_NORETURN __declspec(noreturn)\n";
+	print "#else\n";
+	print "#define SVML_NORETURN\n";
+	print "#endif\n";
+	print "SVML_NORETURN inline void FatalError(const char* message) { printf(\"Fatal Error: %s\\n\", message); exit(-1); }\n";
+	print "SVML_NORETURN inline void FatalError(const char* message, const unsigned& index) { printf(\"Fatal Error: %s\\n - Index:  %u\\n\", message, index); exit(-1); }\n";
+	print "\n";
+	print "// SIMD storage (define SVML_USE_SSE to back VECTOR3<float> and VECTOR4<float> with an __m128, and with SSE4.1\n";
+	print "// VECTOR3<int> and VECTOR4<int> with an __m128i)\n";
+	print "struct NO_SIMD {};\n";
+	print "template <typename TYPE, int DIMENSION> struct SimdStorage { typedef NO_SIMD type; };\n";
+	print "#ifdef SVML_USE_SSE\n";
+	print "template <> struct SimdStorage<float, 3> { typedef __m128 type; };\n";
+	print "template <> struct SimdStorage<float, 4> { typedef __m128 type; };\n";
+	print "#ifdef __SSE4_1__\n";
+	print "template <> struct SimdStorage<int, 3> { typedef __m128i type; };\n";
+	print "template <> struct SimdStorage<int, 4> { typedef __m128i type; };\n";
+	print "#endif\n";
+	print "#endif\n";
+	print "\n";
 	print "\n";
 	print "\n";
 	print "//----------------------------------------------------------------------\n";
@@ -65,12 +260,12 @@ sub TopData
 	print "// \n";
 	print "//----------------------------------------------------------------------\n";
 	print "\n";
-	print "inline SCALAR_TYPE DegToRad(const SCALAR_TYPE& degrees)\n";
+	print "SVML_CONSTEXPR SCALAR_TYPE DegToRad(const SCALAR_TYPE& degrees)\n";
 	print "{\n";
 	print "	return degrees * (SCALAR_TYPE)0.017453292519943; // (pi / 180)\n";
 	print "}\n";
 	print "\n";
-	print "inline SCALAR_TYPE RadToDeg(const SCALAR_TYPE& radians)\n";
+	print "SVML_CONSTEXPR SCALAR_TYPE RadToDeg(const SCALAR_TYPE& radians)\n";
 	print "{\n";
 	print "	return radians * (SCALAR_TYPE)57.295779513082325; // (180 / pi)\n";
 	print "}\n";
@@ -80,6 +275,36 @@ sub TopData
 	print "	return start + delta * (end - start);\n";
 	print "}\n";
 	print "\n";
+	print "// Square roots under SVML_PRECISION (only float has the fast versions, other types always use sqrt())\n";
+	print "template <typename TYPE> inline TYPE PrecisionDivideBySqrt(const TYPE& numerator, const TYPE& x) { return numerator / sqrt(x); }\n";
+	print "template <typename TYPE> inline TYPE PrecisionSqrt(const TYPE& x) { return sqrt(x); }\n";
+	print "#ifdef SVML_FAST_RSQRT\n";
+	print "// 1 / sqrt() of the low lane\n";
+	print "inline __m128 SimdReciprocalSqrt(const __m128& x)\n";
+	print "{\n";
+	print "	__m128 estimate = _mm_rsqrt_ss(x); // Relative error below 1.5 * 2^-12\n";
+	print "#if SVML_PRECISION == SVML_PRECISION_REFINED\n";
+	print "	// Newton-Raphson: estimate * (1.5 - 0.5 * x * estimate^2), which roughly squares the relative error\n";
+	print "	estimate = _mm_mul_ss(estimate, _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), x), _mm_mul_ss(estimate, estimate))));\n";
+	print "#endif\n";
+	print "	return estimate;\n";
+	print "}\n";
+	print "\n";
+	print "inline float PrecisionDivideBySqrt(const float& numerator, const float& x) { return numerator * _mm_cvtss_f32(SimdReciprocalSqrt(_mm_set_ss(x))); }\n";
+	print "inline float PrecisionSqrt(const float& x) { return (x > 0) ? PrecisionDivideBySqrt(x, x) : 0; } // x * (1 / sqrt(x)), which is infinite at 0\n";
+	print "#endif // SVML_FAST_RSQRT\n";
+	print "\n";
+	print "// The square root of the sum of the squares of two or three components, and a numerator divided by it, for .Length,\n";
+	print "// Normalize() and Distance(). FIXED has its own, as its squares leave its range long before its lengths do\n";
+	print "template <typename TYPE> inline TYPE PrecisionLength(const TYPE& x, const TYPE& y) { TYPE squared = x * x + y * y; return PrecisionSqrt(squared); }\n";
+	print "template <typename TYPE> inline TYPE PrecisionLength(const TYPE& x, const TYPE& y, const TYPE& z) { TYPE squared = x * x + y * y + z * z; return PrecisionSqrt(squared); }\n";
+	print "template <typename TYPE> inline TYPE PrecisionDivideByLength(const TYPE& numerator, const TYPE& x, const TYPE& y) { TYPE squared = x * x + y * y; return PrecisionDivideBySqrt(numerator, squared); }\n";
+	print "template <typename TYPE> inline TYPE PrecisionDivideByLength(const TYPE& numerator, const TYPE& x, const TYPE& y, const TYPE& z) { TYPE squared = x * x + y * y + z * z; return PrecisionDivideBySqrt(numerator, squared); }\n";
+	print "\n";
+	PrintCommonScalarFunctions();
+	PrintHalfTypes();
+	PrintFixedType();
+	PrintWideType();
 	print "\n";
 	print "\n";
 	print "//----------------------------------------------------------------------\n";
@@ -102,59 +327,104 @@ sub TopData
 	print "template <typename TYPE> struct Is3D< VECTOR3<TYPE> > { enum { value = true }; };\n";
 	print "template <typename TYPE> struct Is4D< VECTOR4<TYPE> > { enum { value = true }; };\n";
 	print "\n";
+	print "// Same type\n";
+	print "template <typename A, typename B> struct IsSame { enum { value = false }; };\n";
+	print "template <typename TYPE> struct IsSame<TYPE, TYPE> { enum { value = true }; };\n";
 	print "\n";
+	PrintSimdUtilities();
+	PrintSimdMathUtilities();
+	print "\n";
+	PrintExpressionUtilities();
+	print "\n";
+	PrintSwizzleTemplates();
 	print "\n";
 }
 
-sub VectorSectionContent
+sub BottomData
 {
-	my($dimension, $offset) = @_;
-	
-	print "//----------------------------------------------------------------------\n";
-	print "// \n";
-	print "// Sec. 0" . ($dimension + $offset) . " - " . $dimension . "D vector type and associated functions\n";
-	print "// \n";
-	print "//----------------------------------------------------------------------\n";
+	print "} // SVML namespace\n";
 	print "\n";
+	print "#endif // SVML_CORE_H\n";
 }
 
-sub BottomData
+# The other headers: a guard, the comment, their includes and the namespace
+sub HeaderTopData
 {
-	print "//----------------------------------------------------------------------\n";
-	print "// \n";
-	print "// Sec. 07 - Swizzle operator<< overloads for cout printing\n";
-	print "// \n";
-	print "//----------------------------------------------------------------------\n";
+	my($guard, @includes) = @_;
+	
+	print "#ifndef " . $guard . "\n";
+	print "#define " . $guard . "\n";
 	print "\n";
-	print "template <typename SWIZZLE> inline\n";
-	print "typename EnableIf< Is2D< typename SWIZZLE::PARENT >, ostream >::type&\n";
-	print "operator<<(ostream& os, const SWIZZLE& printVector)\n";
-	print "{\n";
-	print "\tos << (typename SWIZZLE::PARENT(printVector));\n";
-	print "\treturn os;\n";
-	print "}\n";
+	License();
+	foreach $include (@includes)
+	{
+		print "#include " . $include . "\n";
+	}
 	print "\n";
-	print "template <typename SWIZZLE> inline\n";
-	print "typename EnableIf< Is3D< typename SWIZZLE::PARENT >, ostream >::type&\n";
-	print "operator<<(ostream& os, const SWIZZLE& printVector)\n";
+	print "namespace SVML\n";
 	print "{\n";
-	print "\tos << (typename SWIZZLE::PARENT(printVector));\n";
-	print "\treturn os;\n";
-	print "}\n";
 	print "\n";
-	print "template <typename SWIZZLE> inline\n";
-	print "typename EnableIf< Is4D< typename SWIZZLE::PARENT >, ostream >::type&\n";
-	print "operator<<(ostream& os, const SWIZZLE& printVector)\n";
-	print "{\n";
-	print "\tos << (typename SWIZZLE::PARENT(printVector));\n";
-	print "\treturn os;\n";
-	print "}\n";
+}
+
+sub HeaderBottomData
+{
+	my($guard) = @_;
+	
 	print "\n";
+	print "} // SVML namespace\n";
 	print "\n";
+	print "#endif // " . $guard . "\n";
+}
+
+# The end of svml.h, which brings in the printing unless SVML_NO_IOSTREAM is defined
+sub LibraryBottomData
+{
 	print "\n";
 	print "} // SVML namespace\n";
 	print "\n";
+	print "// Printing (define SVML_NO_IOSTREAM to leave out svml_io.h, and with it <ostream> and <sstream>)\n";
+	print "#ifndef SVML_NO_IOSTREAM\n";
+	print "#include \"svml_io.h\"\n";
+	print "#endif\n";
+	print "\n";
 	print "#endif // SVML_H\n";
 }
 
-return 1;
\ No newline at end of file
+# svml_io.h: operator<< and ToString() for every type, the only header with iostreams
+sub IoTopData
+{
+	HeaderTopData("SVML_IO_H", "<ostream> // ostream", "<sstream> // ostringstream, string", "\"svml.h\"");
+	
+	SectionHeader("operator<< and ToString() for printing");
+	
+	print "using std::string;\n";
+	print "using std::ostream;\n";
+	print "using std::ostringstream;\n";
+	print "\n";
+}
+
+# Sections 01 through 03 are printed by TopData
+$sectionNumber = 3;
+
+sub SectionHeader
+{
+	my($title) = @_;
+	
+	$sectionNumber++;
+	
+	print "//----------------------------------------------------------------------\n";
+	print "// \n";
+	print "// Sec. " . sprintf("%02d", $sectionNumber) . " - " . $title . "\n";
+	print "// \n";
+	print "//----------------------------------------------------------------------\n";
+	print "\n";
+}
+
+sub VectorSectionContent
+{
+	my($dimension, $offset) = @_;
+	
+	SectionHeader($dimension . "D vector type and associated functions");
+}
+
+return 1;
@@ -2,171 +2,127 @@
 
 require "util.pl";
 
-# Swizzle sub-structs
-sub CreateSwizzleSingularAssignmentOperator_1D
-{
-	my($swizzle, $operator) = @_;
-	
-	$outString = "const " . uc($swizzle) . "& operator" . $operator . "(const TYPE& rhs) { s1::" . $swizzle . " " . $operator . " rhs; return *this; }";
-	
-	return $outString;
-}
+# Swizzles are all instances of one template, indexed by component, rather than one struct per name
 
-sub CreateSwizzleSingularAssignmentOperator
+sub PrintSwizzleTemplates
 {
-	my($swizzle, $parentDimension, $operator) = @_;
-	
-	$swizzleLength = length($swizzle);
-	
-	$outString = "const " . uc($swizzle) . "& operator" . $operator . "(const TYPE& rhs) { ";
-	
-	for ($d = 0; $d < $swizzleLength; $d++)
-	{
-		$outString .= "s" . $swizzleLength . "::" . substr($swizzle, $d, 1) . " " . $operator . " rhs; ";
-	}
-	
-	$outString .= "return *this; }";
-	
-	return $outString;
-}
+	print "// Swizzles: SWIZZLE<VECTOR, I0, I1, I2, I3> is the vector made of components I0, I1, ... of VECTOR, and every\n";
+	print "// swizzle member of a vector is one of these (VECTOR4<TYPE>::zyx is SWIZZLE<VECTOR4<TYPE>, 2, 1, 0>, unused indices are -1)\n";
+	print "\n";
+	print "// Number of components of a vector, and the vector of TYPE with SIZE components (Make() ignores the components it has no room for)\n";
+	print "template <typename VECTOR> struct VectorSize {};\n";
+	print "template <typename TYPE> struct VectorSize< VECTOR2<TYPE> > { enum { value = 2 }; };\n";
+	print "template <typename TYPE> struct VectorSize< VECTOR3<TYPE> > { enum { value = 3 }; };\n";
+	print "template <typename TYPE> struct VectorSize< VECTOR4<TYPE> > { enum { value = 4 }; };\n";
+	print "template <typename TYPE, int SIZE> struct VectorOfSize {};\n";
+	print "template <typename TYPE> struct VectorOfSize<TYPE, 2> { typedef VECTOR2<TYPE> type; static type Make(const TYPE& x, const TYPE& y, const TYPE&, const TYPE&) { return type(x, y); } };\n";
+	print "template <typename TYPE> struct VectorOfSize<TYPE, 3> { typedef VECTOR3<TYPE> type; static type Make(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE&) { return type(x, y, z); } };\n";
+	print "template <typename TYPE> struct VectorOfSize<TYPE, 4> { typedef VECTOR4<TYPE> type; static type Make(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w) { return type(x, y, z, w); } };\n";
+	print "\n";
+	print "// Swizzle writes\n";
+	print "struct SWIZZLE_ASSIGN { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs = rhs; } };\n";
+	print "struct SWIZZLE_ADD { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs += rhs; } };\n";
+	print "struct SWIZZLE_SUBTRACT { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs -= rhs; } };\n";
+	print "struct SWIZZLE_MULTIPLY { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs *= rhs; } };\n";
+	print "struct SWIZZLE_DIVIDE { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs /= rhs; } };\n";
+	print "\n";
+	print "// Scalar right-hand side of a swizzle write (a component, where EXPRESSION_SCALAR holds a ScalarType)\n";
+	print "template <typename TYPE> struct SWIZZLE_SCALAR { const TYPE& value; explicit SWIZZLE_SCALAR(const TYPE& value) : value(value) {} TYPE Component(const unsigned&) const { return value; } };\n";
+	print "\n";
+	print "// The components of VECTOR, shared by all of its swizzles through the union\n";
+	print "template <typename VECTOR>\n";
+	print "struct SVML_MAY_ALIAS SWIZZLE_STORAGE\n";
+	print "{\n";
+	print "protected:\n";
+	print "\ttypename ComponentType<VECTOR>::type c[VectorSize<VECTOR>::value];\n";
+	print "};\n";
+	print "\n";
+	print "// Swizzles with a repeated component (xxy) are read-only, and most swizzles are, so they get only the reads\n";
+	print "template <typename VECTOR, int I0, int I1 = -1, int I2 = -1, int I3 = -1, bool WRITABLE = (I0 != I1 && I0 != I2 && I0 != I3 && (I2 < 0 || I1 != I2) && (I3 < 0 || (I1 != I3 && I2 != I3)))>\n";
+	print "struct SWIZZLE;\n";
+	print "\n";
+	print "template <typename VECTOR, int I0, int I1, int I2, int I3>\n";
+	print "struct SVML_MAY_ALIAS SWIZZLE<VECTOR, I0, I1, I2, I3, false> : SWIZZLE_STORAGE<VECTOR>\n";
+	print "{\n";
+	print "\ttypedef typename ComponentType<VECTOR>::type TYPE;\n";
+	print "\tenum { COUNT = (I2 < 0) ? 2 : ((I3 < 0) ? 3 : 4) };\n";
+	print "\ttypedef typename VectorOfSize<TYPE, COUNT>::type PARENT;\n";
+	print "\n";
+	print "\toperator PARENT() const { return VectorOfSize<TYPE, COUNT>::Make(this->c[I0], this->c[I1], this->c[(I2 < 0) ? 0 : I2], this->c[(I3 < 0) ? 0 : I3]); }\n";
+	print "\tTYPE Component(const unsigned& index) const { return this->c[Index(index)]; }\n";
+	print "\n";
+	print "protected:\n";
+	print "\tstatic int Index(const unsigned& index) { return (index == 0) ? I0 : ((index == 1) ? I1 : ((index == 2) ? I2 : I3)); }\n";
+	print "};\n";
+	print "\n";
+	print "template <typename VECTOR, int I0, int I1, int I2, int I3>\n";
+	print "struct SVML_MAY_ALIAS SWIZZLE<VECTOR, I0, I1, I2, I3, true> : SWIZZLE<VECTOR, I0, I1, I2, I3, false>\n";
+	print "{\n";
+	print "\ttypedef typename ComponentType<VECTOR>::type TYPE;\n";
+	print "\ttypedef typename SWIZZLE<VECTOR, I0, I1, I2, I3, false>::PARENT PARENT;\n";
+	print "\n";
+	print "\t// From a vector, swizzle or expression of the same size\n";
+	print "\tconst SWIZZLE& operator=(const PARENT& rhs) { return Write<SWIZZLE_ASSIGN>(rhs); }\n";
+	print "\tconst SWIZZLE& operator+=(const PARENT& rhs) { return Write<SWIZZLE_ADD>(rhs); }\n";
+	print "\tconst SWIZZLE& operator-=(const PARENT& rhs) { return Write<SWIZZLE_SUBTRACT>(rhs); }\n";
+	print "\tconst SWIZZLE& operator*=(const PARENT& rhs) { return Write<SWIZZLE_MULTIPLY>(rhs); }\n";
+	print "\tconst SWIZZLE& operator/=(const PARENT& rhs) { return Write<SWIZZLE_DIVIDE>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator=(const SOURCE& rhs) { return Write<SWIZZLE_ASSIGN>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator+=(const SOURCE& rhs) { return Write<SWIZZLE_ADD>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator-=(const SOURCE& rhs) { return Write<SWIZZLE_SUBTRACT>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator*=(const SOURCE& rhs) { return Write<SWIZZLE_MULTIPLY>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator/=(const SOURCE& rhs) { return Write<SWIZZLE_DIVIDE>(rhs); }\n";
+	print "\t// From the owning vector, its first components (v4.zyx = v4b is v4.zyx = v4b.xyz)\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator=(const SOURCE& rhs) { return Write<SWIZZLE_ASSIGN>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator+=(const SOURCE& rhs) { return Write<SWIZZLE_ADD>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator-=(const SOURCE& rhs) { return Write<SWIZZLE_SUBTRACT>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator*=(const SOURCE& rhs) { return Write<SWIZZLE_MULTIPLY>(rhs); }\n";
+	print "\ttemplate <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator/=(const SOURCE& rhs) { return Write<SWIZZLE_DIVIDE>(rhs); }\n";
+	print "\tconst SWIZZLE& operator*=(const TYPE& rhs) { return Write<SWIZZLE_MULTIPLY>(SWIZZLE_SCALAR<TYPE>(rhs)); }\n";
+	print "\tconst SWIZZLE& operator/=(const TYPE& rhs) { return Write<SWIZZLE_DIVIDE>(SWIZZLE_SCALAR<TYPE>(rhs)); }\n";
+	print "\n";
+	print "private:\n";
+	print "\t// Every component is read before any is written, so the right-hand side may read this vector\n";
+	print "\ttemplate <typename OPERATION, typename SOURCE> const SWIZZLE& Write(const SOURCE& rhs)\n";
+	print "\t{\n";
+	print "\t\tTYPE values[SWIZZLE::COUNT];\n";
+	print "\t\tfor (unsigned i = 0; i < SWIZZLE::COUNT; i++) { values[i] = rhs.Component(i); }\n";
+	print "\t\tfor (unsigned i = 0; i < SWIZZLE::COUNT; i++) { OPERATION::Apply(this->c[SWIZZLE::Index(i)], values[i]); }\n";
+	print "\t\treturn *this;\n";
+	print "\t}\n";
+	print "};\n";
+	print "\n";
+	print "// Single components act as the component itself\n";
+	print "template <typename VECTOR, int I0>\n";
+	print "struct SVML_MAY_ALIAS SWIZZLE<VECTOR, I0, -1, -1, -1, true> : SWIZZLE_STORAGE<VECTOR>\n";
+	print "{\n";
+	print "\ttypedef typename ComponentType<VECTOR>::type TYPE;\n";
+	print "\n";
+	print "\toperator TYPE() const { return this->c[I0]; }\n";
+	print "\toperator typename WidenedType<TYPE>::type() const { return this->c[I0]; } // HALF components read straight as float\n";
+	print "\tconst SWIZZLE& operator=(const TYPE& rhs) { this->c[I0] = rhs; return *this; }\n";
+	print "\tconst SWIZZLE& operator+=(const TYPE& rhs) { this->c[I0] += rhs; return *this; }\n";
+	print "\tconst SWIZZLE& operator-=(const TYPE& rhs) { this->c[I0] -= rhs; return *this; }\n";
+	print "\tconst SWIZZLE& operator*=(const TYPE& rhs) { this->c[I0] *= rhs; return *this; }\n";
+	print "\tconst SWIZZLE& operator/=(const TYPE& rhs) { this->c[I0] /= rhs; return *this; }\n";
+	print "};\n";
 
-sub CreateSwizzleComponentAssignmentOperator
-{
-	my($swizzle, $parentDimension, $operator) = @_;
-	
-	$swizzleLength = length($swizzle);
-	
-	$outString = "const " . uc($swizzle) . "& operator" . $operator . "(const VECTOR" . $parentDimension . "<TYPE>& rhs) {";
-	
-	@right = ();
-	
-	$unorderedCount = 0;
-	for ($s = 0; $s < $swizzleLength; $s++)
-	{
-		if (NumberToSwizzle($s) ne substr($swizzle, $s, 1))
-		{
-			if ($unorderedCount == 0)
-			{
-				$rightSide = "rhs.v." . NumberToSwizzle($s);
-				push(@right, $rightSide);
-			}
-			else
-			{
-				$outString .= " TYPE t" . ($unorderedCount - 1) . " = rhs.v." . NumberToSwizzle($s) . ";";
-				
-				$rightSide = "t" . ($unorderedCount - 1);
-				push(@right, $rightSide);
-			}
-			
-			$unorderedCount++;
-		}
-		else
-		{
-			$rightSide = "rhs.v." . NumberToSwizzle($s);
-			push(@right, $rightSide);
-		}
-	}
-	
-	for ($d = 0; $d < $swizzleLength; $d++)
-	{
-		$outString .= " s" . $swizzleLength . "::" . substr($swizzle, $d, 1) . " " . $operator . " " . $right[$d] . ";";
-	}
-	
-	$outString .= " return *this; }";
-	
-	return $outString;
 }
 
-sub HasNoDuplicates
+# Template arguments of a swizzle ("zyx" is "2, 1, 0")
+sub SwizzleIndices
 {
 	my($swizzle) = @_;
 	
-	if (length($swizzle) == 1)
-	{
-		return 1;
-	}
-	
-	@swizzleArray = split(//, $swizzle);
-	
-	@sortedArray = sort(@swizzleArray);
-	
-	$prev = $sortedArray[0];
-	
-	for ($s = 1; $s < @sortedArray; $s++)
-	{
-		if ($prev eq $sortedArray[$s])
-		{
-			return 0;
-		}
-		
-		$prev = $sortedArray[$s];
-	}
-	
-	return 1;
+	return join(", ", map { index("xyzw", $_) } split(//, $swizzle));
 }
 
+# Member declaration of one swizzle with its color and texture spellings
 sub PrintSwizzle
 {
 	my($swizzle, $parentDimension) = @_;
 	
-	$dimension = length($swizzle);
-	
-	# One dimensional swizzle
-	if ($dimension == 1)
-	{
-		print "\tstruct " . uc($swizzle) . " : s" . $dimension . "\n";
-		print "\t{\n";
-		
-		print "\t\toperator TYPE() const { return s1::" . $swizzle . "; }\n";
-		print "\t\t" . CreateSwizzleSingularAssignmentOperator_1D($swizzle, "=") . "\n";
-		print "\t\t" . CreateSwizzleSingularAssignmentOperator_1D($swizzle, "+=") . "\n";
-		print "\t\t" . CreateSwizzleSingularAssignmentOperator_1D($swizzle, "-=") . "\n";
-		print "\t\t" . CreateSwizzleSingularAssignmentOperator_1D($swizzle, "*=") . "\n";
-		print "\t\t" . CreateSwizzleSingularAssignmentOperator_1D($swizzle, "/=") . "\n";
-		
-		print "\t};\n";
-	}
-	elsif (HasNoDuplicates($swizzle))
-	{
-		print "\tstruct " . uc($swizzle) . " : s" . $dimension . "\n";
-		print "\t{\n";
-		
-		print "\t\toperator VECTOR" . $dimension . "<TYPE>() const { return VECTOR" . $dimension . "<TYPE>(";
-			for ($s = 0; $s < $dimension; $s++)
-			{
-				if ($s > 0)
-				{
-					print ", ";
-				}
-				
-				print "s" . $dimension . "::" . substr($swizzle, $s, 1);
-			}
-		print "); }\n";
-		
-		print "\t\t" . CreateSwizzleComponentAssignmentOperator($swizzle, $parentDimension, "=") . "\n";
-		print "\t\t" . CreateSwizzleComponentAssignmentOperator($swizzle, $parentDimension, "+=") . "\n";
-		print "\t\t" . CreateSwizzleComponentAssignmentOperator($swizzle, $parentDimension, "-=") . "\n";
-		print "\t\t" . CreateSwizzleComponentAssignmentOperator($swizzle, $parentDimension, "*=") . "\n";
-		print "\t\t" . CreateSwizzleComponentAssignmentOperator($swizzle, $parentDimension, "/=") . "\n";
-		print "\t\t" . CreateSwizzleSingularAssignmentOperator($swizzle, $parentDimension, "*=") . "\n";
-		print "\t\t" . CreateSwizzleSingularAssignmentOperator($swizzle, $parentDimension, "/=") . "\n";
-		
-		print "\t};\n";
-	}
-	else
-	{
-		print "\tstruct " . uc($swizzle) . " : s" . $dimension . " { operator VECTOR" . $dimension . "<TYPE>() const { return VECTOR" . $dimension . "<TYPE>(";
-			for ($s = 0; $s < $dimension; $s++)
-			{
-				if ($s > 0)
-				{
-					print ", ";
-				}
-				
-				print "s" . $dimension . "::" . substr($swizzle, $s, 1);
-			}
-		print "); } };\n";
-	}
+	print "\tSWIZZLE<VECTOR" . $parentDimension . "<TYPE>, " . SwizzleIndices($swizzle) . "> " . $swizzle . ", " . GetSwizzleVariations($swizzle) . ";\n";
 }
 
-return 1;
\ No newline at end of file
+return 1;
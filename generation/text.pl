@@ -0,0 +1,336 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# ToChars() and FromChars(): vectors to and from "(x, y, z)" text in caller buffers, with no stream or heap allocation,
+# and FormatLines() and ParseLines() for whole arrays as CSV or OBJ-style lines. Components are written as the shortest
+# text that reads back to the same value
+
+sub PrintTextUtilities
+{
+	print "// Every text function takes first as 0 to mean an earlier step failed, and passes it on, so calls chain without checks\n";
+	print "\n";
+	print "// Copies text, length characters, to first: one past the last character, or 0 if it doesn't fit in [first, last)\n";
+	print "inline char* CharsCopy(char* first, char* last, const char* text, const size_t& length)\n";
+	print "{\n";
+	print "\tif (first == 0 || (size_t)(last - first) < length)\n";
+	print "\t{\n";
+	print "\t\treturn 0;\n";
+	print "\t}\n";
+	print "\tmemcpy(first, text, length);\n";
+	print "\treturn first + length;\n";
+	print "}\n";
+	print "\n";
+	print "// Shortest text that reads back as value (std::to_chars() where the library has it; otherwise the fewest sprintf()\n";
+	print "// digits, from all a float or double always keeps, that strtod() reads back): one past the last character, or 0 if\n";
+	print "// it doesn't fit in [first, last)\n";
+	foreach my $scalar (["float", 6, 9], ["double", 15, 17])
+	{
+		my($type, $fewest, $digits) = @$scalar;
+		my $cast = ($type eq "float") ? "(float)" : "";
+		print "inline char* ComponentToChars(char* first, char* last, const " . $type . "& value)\n";
+		print "{\n";
+		print "\tif (first == 0)\n";
+		print "\t{\n";
+		print "\t\treturn 0;\n";
+		print "\t}\n";
+		print "#ifdef SVML_HAS_TO_CHARS\n";
+		print "\tstd::to_chars_result result = std::to_chars(first, last, value);\n";
+		print "\treturn (result.ec == std::errc()) ? result.ptr : 0;\n";
+		print "#else\n";
+		print "\tchar buffer[32];\n";
+		print "\tint length = 0;\n";
+		print "\tfor (int precision = " . $fewest . "; precision <= " . $digits . "; precision++)\n";
+		print "\t{\n";
+		print "\t\tlength = sprintf(buffer, \"%.*g\", precision, (double)value);\n";
+		print "\t\tif (" . $cast . "strtod(buffer, 0) == value || value != value)\n";
+		print "\t\t{\n";
+		print "\t\t\tbreak;\n";
+		print "\t\t}\n";
+		print "\t}\n";
+		print "\treturn CharsCopy(first, last, buffer, (size_t)length);\n";
+		print "#endif\n";
+		print "}\n";
+	}
+	print "inline char* ComponentToChars(char* first, char* last, const int& value)\n";
+	print "{\n";
+	print "\tif (first == 0)\n";
+	print "\t{\n";
+	print "\t\treturn 0;\n";
+	print "\t}\n";
+	print "\tchar buffer[12];\n";
+	print "\tchar* digit = buffer + 12;\n";
+	print "\tunsigned magnitude = (value < 0) ? 0u - (unsigned)value : (unsigned)value;\n";
+	print "\tdo\n";
+	print "\t{\n";
+	print "\t\t*--digit = (char)('0' + magnitude % 10);\n";
+	print "\t\tmagnitude /= 10;\n";
+	print "\t} while (magnitude != 0);\n";
+	print "\tif (value < 0)\n";
+	print "\t{\n";
+	print "\t\t*--digit = '-';\n";
+	print "\t}\n";
+	print "\treturn CharsCopy(first, last, digit, (size_t)(buffer + 12 - digit));\n";
+	print "}\n";
+	print "inline char* ComponentToChars(char* first, char* last, const HALF& value) { return ComponentToChars(first, last, (float)value); }\n";
+	print "inline char* ComponentToChars(char* first, char* last, const BFLOAT16& value) { return ComponentToChars(first, last, (float)value); }\n";
+	print "inline char* ComponentToChars(char* first, char* last, const FIXED& value) { return ComponentToChars(first, last, value.ToDouble()); }\n";
+	print "\n";
+	print "// Skips spaces and tabs\n";
+	print "inline const char* CharsSkipBlanks(const char* first, const char* last)\n";
+	print "{\n";
+	print "\twhile (first != 0 && first != last && (*first == ' ' || *first == '\\t'))\n";
+	print "\t{\n";
+	print "\t\tfirst++;\n";
+	print "\t}\n";
+	print "\treturn first;\n";
+	print "}\n";
+	print "\n";
+	print "// Skips spaces and tabs, then character: one past it, or 0 if it isn't next\n";
+	print "inline const char* CharsExpect(const char* first, const char* last, const char& character)\n";
+	print "{\n";
+	print "\tfirst = CharsSkipBlanks(first, last);\n";
+	print "\treturn (first != 0 && first != last && *first == character) ? first + 1 : 0;\n";
+	print "}\n";
+	print "\n";
+	print "// Skips a separator between components: at least one space or tab if separator is either, or else separator with any\n";
+	print "// spaces and tabs around it\n";
+	print "inline const char* CharsSeparator(const char* first, const char* last, const char& separator)\n";
+	print "{\n";
+	print "\tif (separator != ' ' && separator != '\\t')\n";
+	print "\t{\n";
+	print "\t\treturn CharsExpect(first, last, separator);\n";
+	print "\t}\n";
+	print "\tconst char* end = CharsSkipBlanks(first, last);\n";
+	print "\treturn (end != first) ? end : 0;\n";
+	print "}\n";
+	print "\n";
+	print "// Whether character can be part of a number for strtod() (digits, signs, points, exponents, inf and nan)\n";
+	print "inline bool IsNumberChar(const char& character)\n";
+	print "{\n";
+	print "\treturn (character >= '0' && character <= '9') || (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || character == '.' || character == '+' || character == '-';\n";
+	print "}\n";
+	print "\n";
+	print "// Reads a component, after any spaces and tabs: one past its last character, or 0 if there isn't one (value unchanged)\n";
+	foreach my $type ("float", "double")
+	{
+		my $cast = ($type eq "float") ? "(float)" : "";
+		print "inline const char* ComponentFromChars(const char* first, const char* last, " . $type . "& value)\n";
+		print "{\n";
+		print "\tfirst = CharsSkipBlanks(first, last);\n";
+		print "\tif (first == 0)\n";
+		print "\t{\n";
+		print "\t\treturn 0;\n";
+		print "\t}\n";
+		print "#ifdef SVML_HAS_TO_CHARS\n";
+		print "\tif (first != last && *first == '+') // from_chars() takes no '+'\n";
+		print "\t{\n";
+		print "\t\tfirst++;\n";
+		print "\t\tif (first != last && *first == '-')\n";
+		print "\t\t{\n";
+		print "\t\t\treturn 0;\n";
+		print "\t\t}\n";
+		print "\t}\n";
+		print "\tstd::from_chars_result result = std::from_chars(first, last, value);\n";
+		print "\treturn (result.ec == std::errc()) ? result.ptr : 0;\n";
+		print "#else\n";
+		print "\tchar buffer[64];\n";
+		print "\tsize_t length = 0;\n";
+		print "\twhile (first + length != last && length < 63 && IsNumberChar(first[length]))\n";
+		print "\t{\n";
+		print "\t\tbuffer[length] = first[length];\n";
+		print "\t\tlength++;\n";
+		print "\t}\n";
+		print "\tbuffer[length] = 0;\n";
+		print "\tchar* end;\n";
+		print "\tdouble parsed = strtod(buffer, &end);\n";
+		print "\tif (end == buffer)\n";
+		print "\t{\n";
+		print "\t\treturn 0;\n";
+		print "\t}\n";
+		print "\tvalue = " . $cast . "parsed;\n";
+		print "\treturn first + (end - buffer);\n";
+		print "#endif\n";
+		print "}\n";
+	}
+	print "inline const char* ComponentFromChars(const char* first, const char* last, int& value)\n";
+	print "{\n";
+	print "\tfirst = CharsSkipBlanks(first, last);\n";
+	print "\tif (first == 0 || first == last)\n";
+	print "\t{\n";
+	print "\t\treturn 0;\n";
+	print "\t}\n";
+	print "\tbool negative = *first == '-';\n";
+	print "\tconst char* digit = (negative || *first == '+') ? first + 1 : first;\n";
+	print "\tconst char* digits = digit;\n";
+	print "\tint64_t magnitude = 0;\n";
+	print "\twhile (digit != last && *digit >= '0' && *digit <= '9' && magnitude <= ((int64_t)1 << 31))\n";
+	print "\t{\n";
+	print "\t\tmagnitude = magnitude * 10 + (*digit - '0');\n";
+	print "\t\tdigit++;\n";
+	print "\t}\n";
+	print "\tif (digit == digits || magnitude > ((int64_t)1 << 31) - (negative ? 0 : 1))\n";
+	print "\t{\n";
+	print "\t\treturn 0;\n";
+	print "\t}\n";
+	print "\tvalue = (int)(negative ? -magnitude : magnitude);\n";
+	print "\treturn digit;\n";
+	print "}\n";
+	print "inline const char* ComponentFromChars(const char* first, const char* last, HALF& value)\n";
+	print "{\n";
+	print "\tfloat single;\n";
+	print "\tfirst = ComponentFromChars(first, last, single);\n";
+	print "\tif (first != 0)\n";
+	print "\t{\n";
+	print "\t\tvalue = HALF(single);\n";
+	print "\t}\n";
+	print "\treturn first;\n";
+	print "}\n";
+	print "inline const char* ComponentFromChars(const char* first, const char* last, BFLOAT16& value)\n";
+	print "{\n";
+	print "\tfloat single;\n";
+	print "\tfirst = ComponentFromChars(first, last, single);\n";
+	print "\tif (first != 0)\n";
+	print "\t{\n";
+	print "\t\tvalue = BFLOAT16(single);\n";
+	print "\t}\n";
+	print "\treturn first;\n";
+	print "}\n";
+	print "inline const char* ComponentFromChars(const char* first, const char* last, FIXED& value)\n";
+	print "{\n";
+	print "\tdouble wide;\n";
+	print "\tfirst = ComponentFromChars(first, last, wide);\n";
+	print "\tif (first != 0)\n";
+	print "\t{\n";
+	print "\t\tvalue = FIXED(wide);\n";
+	print "\t}\n";
+	print "\treturn first;\n";
+	print "}\n";
+	print "\n";
+	print "// Skips spaces, tabs and a carriage return: last if nothing else is left before it, 0 otherwise\n";
+	print "inline const char* CharsLineEnd(const char* first, const char* last)\n";
+	print "{\n";
+	print "\tfirst = CharsSkipBlanks(first, last);\n";
+	print "\tif (first != 0 && first != last && *first == '\\r')\n";
+	print "\t{\n";
+	print "\t\tfirst++;\n";
+	print "\t}\n";
+	print "\treturn (first == last) ? first : 0;\n";
+	print "}\n";
+	print "\n";
+}
+
+sub TextFunctions
+{
+	my($dimension) = @_;
+
+	my $vector = "VECTOR" . $dimension . "<TYPE>";
+	my @axes = (0 .. $dimension - 1);
+	my @components = SoaComponents($dimension);
+	my $declarations = "TYPE " . join(", ", map { $_ . " = TYPE()" } @components) . ";";
+	my $constructed = $vector . "(" . join(", ", @components) . ")";
+
+	print "// " . $dimension . "D ToChars(): the vector as ToString() writes it, with each component's shortest round-trip text, into\n";
+	print "// [first, last). One past the last character (there is no terminating 0), or 0 if it doesn't fit\n";
+	print "template <typename SWIZZLE> inline typename EnableIf< Is" . $dimension . "D< typename SWIZZLE::PARENT >, char* >::type ToChars(char* first, char* last, const SWIZZLE& vector) { return ToChars(first, last, typename SWIZZLE::PARENT(vector)); }\n";
+	print "template <typename TYPE> char* ToChars(char* first, char* last, const " . $vector . "& vector)\n";
+	print "{\n";
+	print "\tfirst = CharsCopy(first, last, \"(\", 1);\n";
+	foreach my $axis (@axes)
+	{
+		if ($axis > 0)
+		{
+			print "\tfirst = CharsCopy(first, last, \", \", 2);\n";
+		}
+		print "\tfirst = ComponentToChars(first, last, vector.Component(" . $axis . "));\n";
+	}
+	print "\treturn CharsCopy(first, last, \")\", 1);\n";
+	print "}\n";
+	print "\n";
+
+	print "// " . $dimension . "D FromChars(): reads a vector as ToChars() writes it (spaces optional) from [first, last). One past\n";
+	print "// the ')', or 0 if there isn't such a vector (vector unchanged)\n";
+	print "template <typename TYPE> const char* FromChars(const char* first, const char* last, " . $vector . "& vector)\n";
+	print "{\n";
+	print "\t" . $declarations . "\n";
+	print "\tfirst = CharsExpect(first, last, '(');\n";
+	foreach my $axis (@axes)
+	{
+		if ($axis > 0)
+		{
+			print "\tfirst = CharsExpect(first, last, ',');\n";
+		}
+		print "\tfirst = ComponentFromChars(first, last, " . $components[$axis] . ");\n";
+	}
+	print "\tfirst = CharsExpect(first, last, ')');\n";
+	print "\tif (first != 0)\n";
+	print "\t{\n";
+	print "\t\tvector = " . $constructed . ";\n";
+	print "\t}\n";
+	print "\treturn first;\n";
+	print "}\n";
+	print "\n";
+
+	print "// " . $dimension . "D FormatLines(): vectors[0] to vectors[count - 1] one per line, as prefix, the components between\n";
+	print "// separators, and '\\n' (\"v \" and ' ' for OBJ vertices, \"\" and ',' for CSV). One past the last character, or 0\n";
+	print "// if they don't fit in [first, last)\n";
+	print "template <typename TYPE> char* FormatLines(char* first, char* last, const " . $vector . "* vectors, const size_t& count, const char& separator = ',', const char* prefix = \"\")\n";
+	print "{\n";
+	print "\tsize_t prefixLength = strlen(prefix);\n";
+	print "\tfor (size_t i = 0; i < count && first != 0; i++)\n";
+	print "\t{\n";
+	print "\t\tfirst = CharsCopy(first, last, prefix, prefixLength);\n";
+	foreach my $axis (@axes)
+	{
+		if ($axis > 0)
+		{
+			print "\t\tfirst = CharsCopy(first, last, &separator, 1);\n";
+		}
+		print "\t\tfirst = ComponentToChars(first, last, vectors[i].Component(" . $axis . "));\n";
+	}
+	print "\t\tfirst = CharsCopy(first, last, \"\\n\", 1);\n";
+	print "\t}\n";
+	print "\treturn first;\n";
+	print "}\n";
+	print "\n";
+
+	print "// " . $dimension . "D ParseLines(): reads vectors from lines as FormatLines() writes them (\\r\\n too) into vectors, up to\n";
+	print "// capacity of them, skipping blank lines and lines that don't start with prefix (such as an OBJ file's \"vn\" and \"f\"\n";
+	print "// lines). Stops at the first line it can't read, or at last: returns where it stopped, and sets parsed\n";
+	print "template <typename TYPE> const char* ParseLines(const char* first, const char* last, " . $vector . "* vectors, const size_t& capacity, size_t& parsed, const char& separator = ',', const char* prefix = \"\")\n";
+	print "{\n";
+	print "\tsize_t prefixLength = strlen(prefix);\n";
+	print "\tparsed = 0;\n";
+	print "\twhile (first != last && parsed < capacity)\n";
+	print "\t{\n";
+	print "\t\tconst char* end = (const char*)memchr(first, '\\n', (size_t)(last - first));\n";
+	print "\t\tend = (end != 0) ? end : last;\n";
+	print "\t\tconst char* next = (end != last) ? end + 1 : last;\n";
+	print "\t\tif (CharsLineEnd(first, end) != 0 || (size_t)(end - first) < prefixLength || memcmp(first, prefix, prefixLength) != 0)\n";
+	print "\t\t{\n";
+	print "\t\t\tfirst = next;\n";
+	print "\t\t\tcontinue;\n";
+	print "\t\t}\n";
+	print "\t\t" . $declarations . "\n";
+	print "\t\tconst char* read = first + prefixLength;\n";
+	foreach my $axis (@axes)
+	{
+		if ($axis > 0)
+		{
+			print "\t\tread = CharsSeparator(read, end, separator);\n";
+		}
+		print "\t\tread = ComponentFromChars(read, end, " . $components[$axis] . ");\n";
+	}
+	print "\t\tif (CharsLineEnd(read, end) == 0)\n";
+	print "\t\t{\n";
+	print "\t\t\treturn first;\n";
+	print "\t\t}\n";
+	print "\t\tvectors[parsed++] = " . $constructed . ";\n";
+	print "\t\tfirst = next;\n";
+	print "\t}\n";
+	print "\treturn first;\n";
+	print "}\n";
+	print "\n";
+}
+
+return 1;
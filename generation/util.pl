@@ -80,6 +80,27 @@ sub GetSwizzleVariations
 	return $outString;
 }
 
+# Reads one component through Component(), which unlike the swizzle members can be used in constant expressions
+sub ComponentOf
+{
+	my($vector, $index) = @_;
+	
+	return $vector . ".Component(" . $index . ")";
+}
+
+# Lexicographic comparison of two vectors, component by component, ending with $lastOperator
+sub LexicographicComparison
+{
+	my($dimension, $operator, $lastOperator, $index) = @_;
+	
+	if ($index == $dimension - 1)
+	{
+		return ComponentOf("lhs", $index) . " " . $lastOperator . " " . ComponentOf("rhs", $index);
+	}
+	
+	return ComponentOf("lhs", $index) . " " . $operator . " " . ComponentOf("rhs", $index) . " || (" . ComponentOf("lhs", $index) . " == " . ComponentOf("rhs", $index) . " && " . ($index + 1 == $dimension - 1 ? "" : "(") . LexicographicComparison($dimension, $operator, $lastOperator, $index + 1) . ($index + 1 == $dimension - 1 ? "" : ")") . ")";
+}
+
 sub CreateInternalData
 {
 	my($dimension) = @_;
@@ -2,8 +2,6 @@
 
 require "util.pl";
 
-@componentSets = ( "x, y", "x, y, z", "x, y, z, w" );
-
 # Vector types
 
 sub MakeComponentAssignment
@@ -48,33 +46,56 @@ sub MakeScalarAssignment
 	return $outString;
 }
 
+# Constructors: parameter list and the expression for each component
+@constructors2D = (
+	["const TYPE& x, const TYPE& y", "x", "y"]
+);
+@constructors3D = (
+	["const TYPE& x, const TYPE& y, const TYPE& z", "x", "y", "z"],
+	["const VECTOR2<TYPE>& xy, const TYPE& z", "xy.Component(0)", "xy.Component(1)", "z"],
+	["const TYPE& x, const VECTOR2<TYPE>& yz", "x", "yz.Component(0)", "yz.Component(1)"]
+);
+@constructors4D = (
+	["const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w", "x", "y", "z", "w"],
+	["const TYPE& x, const TYPE& y, const VECTOR2<TYPE>& zw", "x", "y", "zw.Component(0)", "zw.Component(1)"],
+	["const TYPE& x, const VECTOR2<TYPE>& yz, const TYPE& w", "x", "yz.Component(0)", "yz.Component(1)", "w"],
+	["const VECTOR2<TYPE>& xy, const TYPE& z, const TYPE& w", "xy.Component(0)", "xy.Component(1)", "z", "w"],
+	["const VECTOR2<TYPE>& xy, const VECTOR2<TYPE>& zw", "xy.Component(0)", "xy.Component(1)", "zw.Component(0)", "zw.Component(1)"],
+	["const TYPE& x, const VECTOR3<TYPE>& yzw", "x", "yzw.Component(0)", "yzw.Component(1)", "yzw.Component(2)"],
+	["const VECTOR3<TYPE>& xyz, const TYPE& w", "xyz.Component(0)", "xyz.Component(1)", "xyz.Component(2)", "w"]
+);
+
 sub PrintConstructors
 {
 	my($dimension) = @_;
 	
-	if ($dimension == 2)
-	{
-		print "\tVECTOR2() {}\n";
-		print "\tVECTOR2(const TYPE& x, const TYPE& y) { v.x = x; v.y = y; }\n";
-	}
-	elsif ($dimension == 3)
+	@constructors = ($dimension == 2) ? @constructors2D : (($dimension == 3) ? @constructors3D : @constructors4D);
+	
+	print "\tVECTOR" . $dimension . "() {}\n";
+	
+	# A constant expression may only read the union member its constructor initialized, so v is initialized directly
+	print "#ifdef SVML_HAS_CONSTEXPR\n";
+	for ($c = 0; $c < @constructors; $c++)
 	{
-		print "\tVECTOR3() {}\n";
-		print "\tVECTOR3(const TYPE& x, const TYPE& y, const TYPE& z) { v.x = x; v.y = y; v.z = z; }\n";
-		print "\tVECTOR3(const VECTOR2<TYPE>& xy, const TYPE& z) { v.x = xy.x; v.y = xy.y; v.z = z; }\n";
-		print "\tVECTOR3(const TYPE& x, const VECTOR2<TYPE>& yz) { v.x = x; v.y = yz.x; v.z = yz.y; }\n";
+		@components = @{$constructors[$c]};
+		print "\tconstexpr VECTOR" . $dimension . "(" . $components[0] . ") : v{" . join(", ", @components[1 .. $dimension]) . "} {}\n";
 	}
-	else
+	print "#else\n";
+	for ($c = 0; $c < @constructors; $c++)
 	{
-		print "\tVECTOR4() {}\n";
-		print "\tVECTOR4(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w) { v.x = x; v.y = y; v.z = z; v.w = w; }\n";
-		print "\tVECTOR4(const TYPE& x, const TYPE& y, const VECTOR2<TYPE>& zw) { v.x = x; v.y = y; v.z = zw.x; v.w = zw.y; }\n";
-		print "\tVECTOR4(const TYPE& x, const VECTOR2<TYPE>& yz, const TYPE& w) { v.x = x; v.y = yz.x; v.z = yz.y; v.w = w; }\n";
-		print "\tVECTOR4(const VECTOR2<TYPE>& xy, const TYPE& z, const TYPE& w) { v.x = xy.x; v.y = xy.y; v.z = z; v.w = w; }\n";
-		print "\tVECTOR4(const VECTOR2<TYPE>& xy, const VECTOR2<TYPE>& zw) { v.x = xy.x; v.y = xy.y; v.z = zw.x; v.w = zw.y; }\n";
-		print "\tVECTOR4(const TYPE& x, const VECTOR3<TYPE>& yzw) { v.x = x; v.y = yzw.x; v.z = yzw.y; v.w = yzw.z; }\n";
-		print "\tVECTOR4(const VECTOR3<TYPE>& xyz, const TYPE& w) { v.x = xyz.x; v.y = xyz.y; v.z = xyz.z; v.w = w; }\n";
+		@components = @{$constructors[$c]};
+		print "\tVECTOR" . $dimension . "(" . $components[0] . ") {";
+		for ($d = 0; $d < $dimension; $d++)
+		{
+			print " v." . NumberToSwizzle($d) . " = " . $components[$d + 1] . ";";
+		}
+		print " }\n";
 	}
+	print "#endif\n";
+	
+	# Through a constructor, so SSE storage gets its zero w
+	print "\t// From another component type (VECTOR" . $dimension . "<float> from VECTOR" . $dimension . "<HALF>, say), a cast per component\n";
+	print "\ttemplate <typename OTHER> explicit VECTOR" . $dimension . "(const VECTOR" . $dimension . "<OTHER>& other) { *this = VECTOR" . $dimension . "(" . join(", ", map { "(TYPE)other.Component(" . $_ . ")" } (0 .. $dimension - 1)) . "); }\n";
 }
 
 sub MakeVectorType
@@ -85,30 +106,10 @@ sub MakeVectorType
 	print "union VECTOR" . $dimension . "\n";
 	print "{\n";
 	print "private:\n";
-	print "\t" . CreateInternalData($dimension) . "\n\n";
-	
-	print "\tstruct s1 { protected: TYPE " . $componentSets[$dimension - 2] . "; };\n";
-	print "\tstruct s2 { protected: TYPE " . $componentSets[$dimension - 2] . "; public: typedef VECTOR2<TYPE> PARENT; };\n";
-	print "\tstruct s3 { protected: TYPE " . $componentSets[$dimension - 2] . "; public: typedef VECTOR3<TYPE> PARENT; };\n";
-	print "\tstruct s4 { protected: TYPE " . $componentSets[$dimension - 2] . "; public: typedef VECTOR4<TYPE> PARENT; };\n\n";
-	
-	# Swizzles
-	if ($dimension == 2)
-	{
-		@swizzleSet = @swizzle2DSet;
-	}
-	elsif ($dimension == 3)
-	{
-		@swizzleSet = @swizzle3DSet;
-	}
-	else
-	{
-		@swizzleSet = @swizzle4DSet;
-	}
-	
-	for ($u = 0; $u < @swizzleSet; $u++)
+	print "\t" . CreateInternalData($dimension) . "\n";
+	if ($dimension > 2)
 	{
-		PrintSwizzle($swizzleSet[$u], $dimension);
+		print "\ttypename SimdStorage<TYPE, " . $dimension . ">::type simd;\n";
 	}
 	print "\n";
 	
@@ -127,9 +128,10 @@ sub MakeVectorType
 			print NumberToSwizzle($d);
 		}
 	print ";\n";
-	print "\t\tTYPE ApplyLength(const TYPE& curMag, const TYPE& newMag)\n";
+	$components = join(", ", map { NumberToSwizzle($_) } (0 .. (($dimension == 4) ? 2 : $dimension - 1)));
+	print "\t\tTYPE ApplyLength(const TYPE& newMag)\n";
 	print "\t\t{\n";
-	print "\t\t\tTYPE inverseScaledMagnitude = newMag / curMag;\n";
+	print "\t\t\tTYPE inverseScaledMagnitude = PrecisionDivideByLength(newMag, " . $components . ");\n";
 	print "\t\t\tx *= inverseScaledMagnitude;\n";
 	print "\t\t\ty *= inverseScaledMagnitude;\n";
 	if ($dimension > 2)
@@ -138,33 +140,16 @@ sub MakeVectorType
 	}
 	print "\t\t\treturn newMag;\n";
 	print "\t\t}\n";
+	print "\t\tTYPE Magnitude() const { return PrecisionLength(" . $components . "); }\n";
 	
 	print "\tpublic:\n";
-	print "\t\toperator TYPE() const { return sqrt(";
-	
-	$useDimension = $dimension;
-	if ($dimension == 4)
-	{
-		$useDimension = 3;
-	}
-	
-		for ($d = 0; $d < $useDimension; $d++)
-		{
-			if ($d > 0)
-			{
-				print " + ";
-			}
-			
-			print NumberToSwizzle($d) . " * " . NumberToSwizzle($d);
-		}
-	
-	print "); }\n";
-	
-	print"\t\tTYPE operator=(const TYPE& rhs) { return ApplyLength((TYPE)(*this), rhs); }\n";
-	print"\t\tTYPE operator+=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag + rhs); }\n";
-	print"\t\tTYPE operator-=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag - rhs); }\n";
-	print"\t\tTYPE operator*=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag * rhs); }\n";
-	print"\t\tTYPE operator/=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag / rhs); }\n";
+	print "\t\toperator TYPE() const { return Magnitude(); }\n";
+	print "\t\toperator typename WidenedType<TYPE>::type() const { return Magnitude(); }\n";
+	print"\t\tTYPE operator=(const TYPE& rhs) { return ApplyLength(rhs); }\n";
+	print"\t\tTYPE operator+=(const TYPE& rhs) { return ApplyLength(Magnitude() + rhs); }\n";
+	print"\t\tTYPE operator-=(const TYPE& rhs) { return ApplyLength(Magnitude() - rhs); }\n";
+	print"\t\tTYPE operator*=(const TYPE& rhs) { return ApplyLength(Magnitude() * rhs); }\n";
+	print"\t\tTYPE operator/=(const TYPE& rhs) { return ApplyLength(Magnitude() / rhs); }\n";
 	
 	print "\t};\n\n";
 	
@@ -174,11 +159,34 @@ sub MakeVectorType
 	PrintConstructors($dimension);
 	print "\n";
 	
+	# SIMD storage access
+	if ($dimension > 2)
+	{
+		print "\t// Packed storage (NO_SIMD unless SVML_USE_SSE is defined and TYPE is float, or int with SSE4.1)\n";
+		print "\ttypedef typename SimdStorage<TYPE, " . $dimension . ">::type SIMD;\n";
+		print "\texplicit VECTOR" . $dimension . "(const SIMD& packed) : simd(packed) {}\n";
+		print "\tconst SIMD& Simd() const { return simd; }\n";
+		print "\n";
+	}
+	
 	# Swizzle variables
+	if ($dimension == 2)
+	{
+		@swizzleSet = @swizzle2DSet;
+	}
+	elsif ($dimension == 3)
+	{
+		@swizzleSet = @swizzle3DSet;
+	}
+	else
+	{
+		@swizzleSet = @swizzle4DSet;
+	}
+	
 	print "\t// Swizzle variables\n";
 	for ($u = 0; $u < @swizzleSet; $u++)
 	{
-		print "\t" . uc($swizzleSet[$u]) . " " . $swizzleSet[$u] . ", " . GetSwizzleVariations($swizzleSet[$u]) . ";\n";
+		PrintSwizzle($swizzleSet[$u], $dimension);
 	}
 	print "\n";
 	
@@ -195,6 +203,20 @@ sub MakeVectorType
 	print "\t" . MakeScalarAssignment($dimension, "*=") . "\n";
 	print "\t" . MakeScalarAssignment($dimension, "/=") . "\n\n";
 	
+	# Expression template access
+	print "\t// Component access for expression templates and constant expressions\n";
+	print "\tSVML_CONSTEXPR TYPE Component(const unsigned& index) const { return ";
+		for ($d = 0; $d < $dimension - 1; $d++)
+		{
+			print "(index == " . $d . ") ? v." . NumberToSwizzle($d) . " : (";
+		}
+	print "v." . NumberToSwizzle($dimension - 1);
+		for ($d = 0; $d < $dimension - 1; $d++)
+		{
+			print ")";
+		}
+	print "; }\n\n";
+	
 	# Array access
 	print "\t// Array notation access\n";
 	print "\tconst TYPE& operator[](const unsigned& index)\n";
@@ -209,34 +231,12 @@ sub MakeVectorType
 	{
 		print "\t\telse if (index == 3) { return v.w; }\n";
 	}
-	print "\t\telse { cout << \"Fatal Error: Attempted out of bounds bracket access of " . $dimension . "D vector.\" << endl << \" - Vector: \" << *this << endl << \" - Index:  \" << index << endl; exit(-1); }\n";
-	print "\t}\n\n";
-	
-	# Cout
-	print "\t// Overload for cout\n";
-	print "\tfriend ostream& operator<<(ostream& os, const VECTOR" . $dimension;
-	print "<TYPE>& printVector)\n";
-	print "\t{\n";
-	print "\t\tos << ";
-	print "\"(\" << ";
-	
-		for ($i = 0; $i < $dimension; $i++)
-		{
-			if ($i > 0)
-			{
-				print " << \", \" << ";
-			}
-			
-			print "printVector.v." . NumberToSwizzle($i);
-		}
-		
-	print " << \")\";\n";
-	print "\t\treturn os;\n";
+	print "\t\telse { FatalError(\"Attempted out of bounds bracket access of " . $dimension . "D vector.\", index); }\n";
 	print "\t}\n\n";
 	
 	# Negation/Normalization
 	print "\t// Negation\n";
-	print "\tVECTOR" . $dimension . " operator-() const { return VECTOR" . $dimension . "(-v.x, -v.y";
+	print "\tSVML_CONSTEXPR VECTOR" . $dimension . " operator-() const { return VECTOR" . $dimension . "(-v.x, -v.y";
 	if ($dimension > 2)
 	{
 		print ", -v.z";
@@ -247,6 +247,16 @@ sub MakeVectorType
 	}
 	print "); }\n\n";
 	
+	print "#ifdef SVML_FAST_RSQRT\n";
+	if ($dimension == 4)
+	{
+		print "\tvoid Normalize() { (*this).xyz *= PrecisionDivideByLength((TYPE)1, v.x, v.y, v.z); }\n";
+	}
+	else
+	{
+		print "\tvoid Normalize() { *this *= PrecisionDivideByLength((TYPE)1, " . join(", ", map { "v." . $_ } SoaComponents($dimension)) . "); }\n";
+	}
+	print "#else\n";
 	if ($dimension == 4)
 	{
 		print "\tvoid Normalize() { (*this).xyz /= this->Length; }\n";
@@ -255,8 +265,11 @@ sub MakeVectorType
 	{
 		print "\tvoid Normalize() { *this /= this->Length; }\n";
 	}
+	print "#endif\n";
 	
 	print "};\n\n";
+	
+	PrintSimdMembers($dimension);
 }
 
 return 1;
\ No newline at end of file
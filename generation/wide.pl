@@ -0,0 +1,259 @@
+#!/usr/bin/perl -w
+
+require "util.pl";
+
+# WIDE, a lane-packed component type: WIDE<float, 8> holds eight floats and does every operation on all eight, so
+# VECTOR3< WIDE<float, 8> > is eight 3D vectors that the ordinary vector functions process together (SPMD style)
+
+# The lane by lane operations of WIDE: name, operand count, AVX and SSE expressions, the scalar expression, and the
+# macro the SSE expression needs (A and B stand for the operands)
+@wideKernels = (
+	["Add", 2, "_mm256_add_ps(A, B)", "_mm_add_ps(A, B)", "A + B", ""],
+	["Subtract", 2, "_mm256_sub_ps(A, B)", "_mm_sub_ps(A, B)", "A - B", ""],
+	["Multiply", 2, "_mm256_mul_ps(A, B)", "_mm_mul_ps(A, B)", "A * B", ""],
+	["Divide", 2, "_mm256_div_ps(A, B)", "_mm_div_ps(A, B)", "A / B", ""],
+	["Negate", 1, "_mm256_xor_ps(A, _mm256_set1_ps(-0.0f))", "_mm_xor_ps(A, _mm_set1_ps(-0.0f))", "-A", ""],
+	["Fabs", 1, "_mm256_andnot_ps(_mm256_set1_ps(-0.0f), A)", "_mm_andnot_ps(_mm_set1_ps(-0.0f), A)", "fabs(A)", ""],
+	["Max", 2, "_mm256_max_ps(B, A)", "_mm_max_ps(B, A)", "(A < B) ? B : A", ""], # B where A < B, as std::max()
+	["Min", 2, "_mm256_min_ps(B, A)", "_mm_min_ps(B, A)", "(B < A) ? B : A", ""],
+	["Sqrt", 1, "_mm256_sqrt_ps(A)", "_mm_sqrt_ps(A)", "sqrt(A)", ""], # sqrt() sets errno, which keeps compilers from vectorizing it
+	["Floor", 1, "_mm256_floor_ps(A)", "_mm_floor_ps(A)", "floor(A)", "__SSE4_1__"],
+	["Ceil", 1, "_mm256_ceil_ps(A)", "_mm_ceil_ps(A)", "ceil(A)", "__SSE4_1__"],
+);
+
+sub WideKernelParameters
+{
+	my($type, $operands) = @_;
+
+	return $type . "* out, const " . $type . "* a" . (($operands == 2) ? ", const " . $type . "* b" : "");
+}
+
+# $expression with A and B replaced by the lanes of a and b: indexed for the scalar loops, loaded for the SIMD ones
+sub WideKernelLanes
+{
+	my($expression, $index, $load) = @_;
+
+	foreach $operand ("A", "B")
+	{
+		my $lanes = lc($operand);
+		my $replacement = (defined($load) ? $load . "(" . $lanes . " + i)" : $lanes . $index);
+		$expression =~ s/\b$operand\b/$replacement/g;
+	}
+	return $expression;
+}
+
+sub PrintWideType
+{
+	print "#ifdef SVML_HAS_CLASS_COMPONENTS\n";
+	print "// Lane-packed components. WIDE<TYPE, N> is N values of TYPE side by side, and arithmetic and the <math.h> functions\n";
+	print "// work lane by lane, so a vector of WIDE<float, 8> is eight vectors processed with the instructions of one (with\n";
+	print "// SVML_USE_SSE, float lanes go through SSE, and AVX where it's enabled). Comparisons are true when they hold in every\n";
+	print "// lane, so == and AlmostEqual() on vectors of WIDE compare all N vectors; choices made lane by lane go through the\n";
+	print "// component-wise comparisons, which give a mask per lane, Select(), and Max(), Min(), Abs(), Sign(), Step(), Clamp()\n";
+	print "// and the like, which don't branch\n";
+	print "template <typename TYPE, int N> struct WideKernels\n";
+	print "{\n";
+	foreach $kernel (@wideKernels)
+	{
+		my($name, $operands, $avx, $sse, $scalar) = @$kernel;
+		print "\tstatic void " . $name . "(" . WideKernelParameters("TYPE", $operands) . ") { for (int i = 0; i < N; i++) { out[i] = " . WideKernelLanes($scalar, "[i]") . "; } }\n";
+	}
+	print "};\n";
+	print "#ifdef SVML_USE_SSE\n";
+	print "// Eight lanes per instruction with AVX and four with SSE, then any left over one at a time. Every operation loads and\n";
+	print "// stores whole registers: compilers left to vectorize the loops above split the copies of WIDE into halves, and\n";
+	print "// loading a register that two smaller stores just wrote stalls\n";
+	print "template <int N> struct WideKernels<float, N>\n";
+	print "{\n";
+	foreach $kernel (@wideKernels)
+	{
+		my($name, $operands, $avx, $sse, $scalar, $requires) = @$kernel;
+		print "\tstatic void " . $name . "(" . WideKernelParameters("float", $operands) . ")\n";
+		print "\t{\n";
+		print "\t\tint i = 0;\n";
+		print "#ifdef __AVX__\n";
+		print "\t\tfor (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, " . WideKernelLanes($avx, "", "_mm256_loadu_ps") . "); }\n";
+		print "#endif\n";
+		if ($requires ne "")
+		{
+			print "#ifdef " . $requires . "\n";
+		}
+		print "\t\tfor (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, " . WideKernelLanes($sse, "", "_mm_loadu_ps") . "); }\n";
+		if ($requires ne "")
+		{
+			print "#endif\n";
+		}
+		print "\t\tfor (; i < N; i++) { out[i] = " . WideKernelLanes($scalar, "[i]") . "; }\n";
+		print "\t}\n";
+	}
+	print "};\n";
+	print "#endif\n";
+	print "\n";
+	print "template <typename TYPE, int N> struct WIDE\n";
+	print "{\n";
+	print "\tTYPE lane[N];\n";
+	print "\n";
+	print "\tWIDE() = default;\n";
+	print "\tWIDE(const int& value) { Fill((TYPE)value); }\n";
+	print "\tWIDE(const unsigned& value) { Fill((TYPE)value); }\n";
+	print "\tWIDE(const float& value) { Fill((TYPE)value); }\n";
+	print "\tWIDE(const double& value) { Fill((TYPE)value); }\n";
+	print "\tstatic WIDE Load(const TYPE* values) { WIDE wide; for (int i = 0; i < N; i++) { wide.lane[i] = values[i]; } return wide; }\n";
+	print "\tvoid Store(TYPE* values) const { for (int i = 0; i < N; i++) { values[i] = lane[i]; } }\n";
+	print "\tvoid Fill(const TYPE& value) { for (int i = 0; i < N; i++) { lane[i] = value; } }\n";
+	print "\n";
+	print "\tTYPE& operator[](const int& index) { return lane[index]; }\n";
+	print "\tconst TYPE& operator[](const int& index) const { return lane[index]; }\n";
+	print "\n";
+	print "\tfriend WIDE operator+(const WIDE& lhs, const WIDE& rhs) { WIDE result; WideKernels<TYPE, N>::Add(result.lane, lhs.lane, rhs.lane); return result; }\n";
+	print "\tfriend WIDE operator-(const WIDE& lhs, const WIDE& rhs) { WIDE result; WideKernels<TYPE, N>::Subtract(result.lane, lhs.lane, rhs.lane); return result; }\n";
+	print "\tfriend WIDE operator*(const WIDE& lhs, const WIDE& rhs) { WIDE result; WideKernels<TYPE, N>::Multiply(result.lane, lhs.lane, rhs.lane); return result; }\n";
+	print "\tfriend WIDE operator/(const WIDE& lhs, const WIDE& rhs) { WIDE result; WideKernels<TYPE, N>::Divide(result.lane, lhs.lane, rhs.lane); return result; }\n";
+	print "\tfriend WIDE operator-(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Negate(result.lane, value.lane); return result; }\n";
+	print "\tconst WIDE& operator+=(const WIDE& rhs) { return *this = *this + rhs; }\n";
+	print "\tconst WIDE& operator-=(const WIDE& rhs) { return *this = *this - rhs; }\n";
+	print "\tconst WIDE& operator*=(const WIDE& rhs) { return *this = *this * rhs; }\n";
+	print "\tconst WIDE& operator/=(const WIDE& rhs) { return *this = *this / rhs; }\n";
+	print "\n";
+	print "\t// True when true in every lane (except !=, which is true when any lane differs)\n";
+	print "\tfriend bool operator==(const WIDE& lhs, const WIDE& rhs) { bool all = true; for (int i = 0; i < N; i++) { all = all && lhs.lane[i] == rhs.lane[i]; } return all; }\n";
+	print "\tfriend bool operator!=(const WIDE& lhs, const WIDE& rhs) { return !(lhs == rhs); }\n";
+	print "\tfriend bool operator<(const WIDE& lhs, const WIDE& rhs) { bool all = true; for (int i = 0; i < N; i++) { all = all && lhs.lane[i] < rhs.lane[i]; } return all; }\n";
+	print "\tfriend bool operator>(const WIDE& lhs, const WIDE& rhs) { return rhs < lhs; }\n";
+	print "\tfriend bool operator<=(const WIDE& lhs, const WIDE& rhs) { bool all = true; for (int i = 0; i < N; i++) { all = all && lhs.lane[i] <= rhs.lane[i]; } return all; }\n";
+	print "\tfriend bool operator>=(const WIDE& lhs, const WIDE& rhs) { return rhs <= lhs; }\n";
+	print "\n";
+	print "\t// The <math.h> functions and std::max() and std::min() the vector functions call, lane by lane and found through WIDE\n";
+	print "\t// arguments only\n";
+	print "\tfriend WIDE fabs(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Fabs(result.lane, value.lane); return result; }\n";
+	print "\tfriend WIDE floor(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Floor(result.lane, value.lane); return result; }\n";
+	print "\tfriend WIDE ceil(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Ceil(result.lane, value.lane); return result; }\n";
+	print "\tfriend WIDE sqrt(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Sqrt(result.lane, value.lane); return result; }\n";
+	print "\tfriend WIDE sin(const WIDE& radians) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = sin(radians.lane[i]); } return result; }\n";
+	print "\tfriend WIDE cos(const WIDE& radians) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = cos(radians.lane[i]); } return result; }\n";
+	print "\tfriend WIDE tan(const WIDE& radians) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = tan(radians.lane[i]); } return result; }\n";
+	print "\tfriend WIDE atan2(const WIDE& y, const WIDE& x) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = atan2(y.lane[i], x.lane[i]); } return result; }\n";
+	print "\tfriend WIDE exp(const WIDE& value) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = exp(value.lane[i]); } return result; }\n";
+	print "\tfriend WIDE log(const WIDE& value) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = log(value.lane[i]); } return result; }\n";
+	print "\tfriend WIDE pow(const WIDE& base, const WIDE& exponent) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = pow(base.lane[i], exponent.lane[i]); } return result; }\n";
+	print "\tfriend WIDE max(const WIDE& a, const WIDE& b) { WIDE result; WideKernels<TYPE, N>::Max(result.lane, a.lane, b.lane); return result; }\n";
+	print "\tfriend WIDE min(const WIDE& a, const WIDE& b) { WIDE result; WideKernels<TYPE, N>::Min(result.lane, a.lane, b.lane); return result; }\n";
+	print "};\n";
+	print "\n";
+	print "// The per-component helpers that branch, lane by lane instead\n";
+	print "template <typename TYPE, int N> inline WIDE<TYPE, N> ComponentAbs(const WIDE<TYPE, N>& x) { WIDE<TYPE, N> result; for (int i = 0; i < N; i++) { result.lane[i] = ComponentAbs(x.lane[i]); } return result; }\n";
+	print "template <typename TYPE, int N> inline WIDE<TYPE, N> ComponentSign(const WIDE<TYPE, N>& x) { WIDE<TYPE, N> result; for (int i = 0; i < N; i++) { result.lane[i] = ComponentSign(x.lane[i]); } return result; }\n";
+	print "template <typename TYPE, int N> inline WIDE<TYPE, N> ComponentStep(const WIDE<TYPE, N>& edge, const WIDE<TYPE, N>& x) { WIDE<TYPE, N> result; for (int i = 0; i < N; i++) { result.lane[i] = ComponentStep(edge.lane[i], x.lane[i]); } return result; }\n";
+	print "template <typename TYPE, int N> inline WIDE<TYPE, N> ComponentLog2(const WIDE<TYPE, N>& x) { WIDE<TYPE, N> result; for (int i = 0; i < N; i++) { result.lane[i] = ComponentLog2(x.lane[i]); } return result; }\n";
+	print "\n";
+	print "// Vectors of WIDE take WIDE scalars (a plain number fills every lane); AlmostEqual() uses TYPE's epsilon in every lane\n";
+	print "template <typename TYPE, int N> struct ScalarType< WIDE<TYPE, N> >\n";
+	print "{\n";
+	print "\ttypedef WIDE<TYPE, N> type;\n";
+	print "\tstatic type Epsilon() { WIDE<TYPE, N> epsilon; epsilon.Fill(ScalarType<TYPE>::Epsilon()); return epsilon; }\n";
+	print "};\n";
+	print "template <typename TYPE, int N, typename MASK> struct MaskType< WIDE<TYPE, N>, MASK > { typedef WIDE<MASK, N> type; }; // Lane i is vector i's mask\n";
+	print "#endif // SVML_HAS_CLASS_COMPONENTS\n";
+	print "\n";
+}
+
+# Pack() and Unpack(): N vectors of TYPE to and from one vector of WIDE<TYPE, N>
+sub WideConversions
+{
+	my($dimension) = @_;
+
+	$vector = "VECTOR" . $dimension;
+
+	print "// " . $dimension . "D Pack(), Unpack(): N vectors to and from one vector of WIDE<TYPE, N>, vector i in lane i\n";
+	print "template <typename TYPE, int N> " . $vector . "< WIDE<TYPE, N> > Pack(const " . $vector . "<TYPE>* in)\n";
+	print "{\n";
+	print "\tWIDE<TYPE, N> components[" . $dimension . "];\n";
+	print "\tfor (int i = 0; i < N; i++)\n";
+	print "\t{\n";
+	for ($d = 0; $d < $dimension; $d++)
+	{
+		print "\t\tcomponents[" . $d . "].lane[i] = " . ComponentOf("in[i]", $d) . ";\n";
+	}
+	print "\t}\n";
+	print "\treturn " . $vector . "< WIDE<TYPE, N> >(" . join(", ", map { "components[" . $_ . "]" } (0 .. $dimension - 1)) . ");\n";
+	print "}\n";
+	print "\n";
+	print "template <typename TYPE, int N> void Unpack(" . $vector . "<TYPE>* out, const " . $vector . "< WIDE<TYPE, N> >& in)\n";
+	print "{\n";
+	for ($d = 0; $d < $dimension; $d++)
+	{
+		print "\tWIDE<TYPE, N> component" . $d . " = " . ComponentOf("in", $d) . ";\n";
+	}
+	print "\tfor (int i = 0; i < N; i++)\n";
+	print "\t{\n";
+	print "\t\tout[i] = " . $vector . "<TYPE>(" . join(", ", map { "component" . $_ . ".lane[i]" } (0 .. $dimension - 1)) . ");\n";
+	print "\t}\n";
+	print "}\n";
+	print "\n";
+}
+
+# Component-wise comparisons and Select() of vectors of WIDE, lane by lane: WIDE<MASK3, N> is N masks, the one in lane i
+# from the vectors in lane i. These are more specialized than the templates for any component type, so they win over them
+sub WideMasks
+{
+	my($dimension) = @_;
+
+	my $mask = "MASK" . $dimension;
+	my $vector = "VECTOR" . $dimension . "< WIDE<TYPE, N> >";
+	my $wideMask = "WIDE<" . $mask . ", N>";
+	my @components = (0 .. $dimension - 1);
+
+	print "// " . $dimension . "D component-wise comparisons of vectors of WIDE, into a mask per lane\n";
+	foreach $comparison (@componentComparisons)
+	{
+		my($name, $test) = @$comparison;
+		my @lanes = map { my $lane = $test; $lane =~ s/\bA\b/lhs$_.lane[i]/; $lane =~ s/\bB\b/rhs$_.lane[i]/; $lane } @components;
+
+		print "template <typename TYPE, int N> " . $wideMask . " " . $name . "(const " . $vector . "& lhs, const " . $vector . "& rhs)\n";
+		print "{\n";
+		print "\tWIDE<TYPE, N> " . join(", ", map { "lhs" . $_ . " = " . ComponentOf("lhs", $_) . ", rhs" . $_ . " = " . ComponentOf("rhs", $_) } @components) . ";\n";
+		print "\t" . $wideMask . " result;\n";
+		print "\tfor (int i = 0; i < N; i++) { result.lane[i] = " . $mask . "(" . join(", ", @lanes) . "); }\n";
+		print "\treturn result;\n";
+		print "}\n";
+	}
+	print "\n";
+	print "// " . $dimension . "D masks per lane [&], [|], [^], [!], Any(), All(), lane by lane\n";
+	foreach $operator ("&", "|", "^")
+	{
+		print "template <int N> " . $wideMask . " operator" . $operator . "(const " . $wideMask . "& lhs, const " . $wideMask . "& rhs) { " . $wideMask . " result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] " . $operator . " rhs.lane[i]; } return result; }\n";
+	}
+	print "template <int N> " . $wideMask . " operator!(const " . $wideMask . "& mask) { " . $wideMask . " result; for (int i = 0; i < N; i++) { result.lane[i] = !mask.lane[i]; } return result; }\n";
+	print "template <int N> WIDE<bool, N> Any(const " . $wideMask . "& mask) { WIDE<bool, N> result; for (int i = 0; i < N; i++) { result.lane[i] = Any(mask.lane[i]); } return result; }\n";
+	print "template <int N> WIDE<bool, N> All(const " . $wideMask . "& mask) { WIDE<bool, N> result; for (int i = 0; i < N; i++) { result.lane[i] = All(mask.lane[i]); } return result; }\n";
+	print "\n";
+	print "// " . $dimension . "D Select() by a mask per lane: per component and lane, a where the lane's mask is set and b elsewhere\n";
+	print "template <typename TYPE, int N> " . $vector . " Select(const " . $wideMask . "& mask, const " . $vector . "& a, const " . $vector . "& b)\n";
+	print "{\n";
+	print "\tWIDE<TYPE, N> " . join(", ", map { "a" . $_ . " = " . ComponentOf("a", $_) . ", b" . $_ . " = " . ComponentOf("b", $_) } @components) . ";\n";
+	print "\tfor (int i = 0; i < N; i++)\n";
+	print "\t{\n";
+	foreach $d (@components)
+	{
+		print "\t\tif (mask.lane[i][" . $d . "]) { b" . $d . ".lane[i] = a" . $d . ".lane[i]; }\n";
+	}
+	print "\t}\n";
+	print "\treturn " . $vector . "(" . join(", ", map { "b" . $_ } @components) . ");\n";
+	print "}\n";
+	print "\n";
+}
+
+# Printing lane-packed scalars (in svml_io.h)
+sub WideToString
+{
+	print "// Lane-packed operator<<, every lane in brackets\n";
+	print "template <typename TYPE, int N> ostream& operator<<(ostream& out, const WIDE<TYPE, N>& value)\n";
+	print "{\n";
+	print "\tout << \"[\";\n";
+	print "\tfor (int i = 0; i < N; i++) { out << ((i > 0) ? \", \" : \"\") << value.lane[i]; }\n";
+	print "\treturn out << \"]\";\n";
+	print "}\n";
+	print "\n";
+}
+
+return 1;
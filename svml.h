@@ -15,2964 +15,8870 @@ Copyright (c) 2010-2015 Dwight House
 
 */
 
-#include <iostream> // cout, endl
-#include <sstream> // ostream, ostringstream, string
-#include <math.h> // sqrt, fabs, min, max, ceil, floor, sin, cos
+#include "svml_core.h"
+#include "svml_vector2.h"
+#include "svml_vector3.h"
+#include "svml_vector4.h"
 
 namespace SVML
 {
 
 //----------------------------------------------------------------------
 // 
-// Sec. 01 - Startup, globals, predefinitions, types
+// Sec. 07 - Structure-of-arrays batch types and associated functions
 // 
 //----------------------------------------------------------------------
 
-using std::cout;
-using std::endl;
-using std::string;
-using std::ostream;
-using std::ostringstream;
-using std::max;
-using std::min;
-
-// Typedefs
-typedef float SCALAR_TYPE;
-
-// Global constants
-const SCALAR_TYPE COMPARISON_EPSILON = (SCALAR_TYPE)0.000001; // Used by AlmostEqual()
+// Kernels process full blocks of SOA_LANES elements, then the remainder
+const unsigned SOA_LANES = 16;
+const unsigned SOA_ALIGNMENT = 64; // Bytes, one cache line
 
 // Predefines
-template <typename TYPE> union VECTOR2;
-template <typename TYPE> union VECTOR3;
-template <typename TYPE> union VECTOR4;
-
-// Default types (BUILT-IN TYPE CUSTOMIZATION HERE!)
-typedef VECTOR2<float> vec2;
-typedef VECTOR3<float> vec3;
-typedef VECTOR4<float> vec4;
-// etc.
-
+template <typename TYPE> struct VECTOR2_SOA_VIEW;
+template <typename TYPE> struct VECTOR3_SOA_VIEW;
+template <typename TYPE> struct VECTOR4_SOA_VIEW;
+template <typename TYPE> union VECTOR2_SOA;
+template <typename TYPE> union VECTOR3_SOA;
+template <typename TYPE> union VECTOR4_SOA;
+
+// Default types
+typedef VECTOR2_SOA<float> vec2_soa;
+typedef VECTOR3_SOA<float> vec3_soa;
+typedef VECTOR4_SOA<float> vec4_soa;
 
+// Generic types
+template <typename TYPE> struct IsSoa2D { enum { value = false }; };
+template <typename TYPE> struct IsSoa3D { enum { value = false }; };
+template <typename TYPE> struct IsSoa4D { enum { value = false }; };
 
-//----------------------------------------------------------------------
-// 
-// Sec. 02 - Math utilities not specific to vectors
-// 
-//----------------------------------------------------------------------
-
-inline SCALAR_TYPE DegToRad(const SCALAR_TYPE& degrees)
+// Specific type
+template <typename TYPE> struct IsSoa2D< VECTOR2_SOA_VIEW<TYPE> > { enum { value = true }; };
+template <typename TYPE> struct IsSoa3D< VECTOR3_SOA_VIEW<TYPE> > { enum { value = true }; };
+template <typename TYPE> struct IsSoa4D< VECTOR4_SOA_VIEW<TYPE> > { enum { value = true }; };
+template <typename TYPE> struct ComponentType< VECTOR2_SOA_VIEW<TYPE> > { typedef TYPE type; };
+template <typename TYPE> struct ComponentType< VECTOR3_SOA_VIEW<TYPE> > { typedef TYPE type; };
+template <typename TYPE> struct ComponentType< VECTOR4_SOA_VIEW<TYPE> > { typedef TYPE type; };
+
+// Aligned lane storage, the offset to the malloc() block is stored just before the returned pointer
+inline void* AlignedAllocate(const size_t& bytes)
 {
-	return degrees * (SCALAR_TYPE)0.017453292519943; // (pi / 180)
+	char* block = (char*)malloc(bytes + SOA_ALIGNMENT + sizeof(size_t));
+	if (block == 0) { return 0; }
+	size_t offset = SOA_ALIGNMENT - ((size_t)(block + sizeof(size_t)) % SOA_ALIGNMENT) + sizeof(size_t);
+	*(size_t*)(block + offset - sizeof(size_t)) = offset;
+	return block + offset;
 }
 
-inline SCALAR_TYPE RadToDeg(const SCALAR_TYPE& radians)
+inline void AlignedFree(void* aligned)
 {
-	return radians * (SCALAR_TYPE)57.295779513082325; // (180 / pi)
+	if (aligned == 0) { return; }
+	free((char*)aligned - *((size_t*)aligned - 1));
 }
 
-inline SCALAR_TYPE Lerp(const SCALAR_TYPE& start, const SCALAR_TYPE& end, const SCALAR_TYPE& delta)
+template <typename TYPE>
+struct VECTOR2_SOA_VIEW
 {
-	return start + delta * (end - start);
-}
-
-
-
-//----------------------------------------------------------------------
-// 
-// Sec. 03 - SFINAE utilities
-// 
-//----------------------------------------------------------------------
+	typedef VECTOR2_SOA_VIEW<TYPE> PARENT;
+	
+	TYPE* x;
+	TYPE* y;
+	unsigned count;
+	
+	VECTOR2_SOA_VIEW(TYPE* x, TYPE* y, const unsigned& count) : x(x), y(y), count(count) {}
+	
+	VECTOR2<TYPE> Get(const unsigned& index) const { return VECTOR2<TYPE>(x[index], y[index]); }
+	void Set(const unsigned& index, const VECTOR2<TYPE>& vector) const { x[index] = vector.x; y[index] = vector.y; }
+};
 
-// EnableIf
-template <typename TYPE, typename R, bool b = TYPE::value> struct EnableIf {};
-template <typename TYPE, typename R> struct EnableIf<TYPE, R, true> { typedef R type; };
+template <typename TYPE>
+struct VECTOR3_SOA_VIEW
+{
+	typedef VECTOR3_SOA_VIEW<TYPE> PARENT;
+	
+	TYPE* x;
+	TYPE* y;
+	TYPE* z;
+	unsigned count;
+	
+	VECTOR3_SOA_VIEW(TYPE* x, TYPE* y, TYPE* z, const unsigned& count) : x(x), y(y), z(z), count(count) {}
+	
+	VECTOR3<TYPE> Get(const unsigned& index) const { return VECTOR3<TYPE>(x[index], y[index], z[index]); }
+	void Set(const unsigned& index, const VECTOR3<TYPE>& vector) const { x[index] = vector.x; y[index] = vector.y; z[index] = vector.z; }
+};
 
-// Generic types
-template <typename TYPE> struct Is2D { enum { value = false }; };
-template <typename TYPE> struct Is3D { enum { value = false }; };
-template <typename TYPE> struct Is4D { enum { value = false }; };
+template <typename TYPE>
+struct VECTOR4_SOA_VIEW
+{
+	typedef VECTOR4_SOA_VIEW<TYPE> PARENT;
+	
+	TYPE* x;
+	TYPE* y;
+	TYPE* z;
+	TYPE* w;
+	unsigned count;
+	
+	VECTOR4_SOA_VIEW(TYPE* x, TYPE* y, TYPE* z, TYPE* w, const unsigned& count) : x(x), y(y), z(z), w(w), count(count) {}
+	
+	VECTOR4<TYPE> Get(const unsigned& index) const { return VECTOR4<TYPE>(x[index], y[index], z[index], w[index]); }
+	void Set(const unsigned& index, const VECTOR4<TYPE>& vector) const { x[index] = vector.x; y[index] = vector.y; z[index] = vector.z; w[index] = vector.w; }
+};
 
-// Specific type
-template <typename TYPE> struct Is2D< VECTOR2<TYPE> > { enum { value = true }; };
-template <typename TYPE> struct Is3D< VECTOR3<TYPE> > { enum { value = true }; };
-template <typename TYPE> struct Is4D< VECTOR4<TYPE> > { enum { value = true }; };
+// Batch swizzles: SOA_SWIZZLE<TYPE, SIZE, I0, I1, I2, I3> is a view of lanes I0, I1, ... of a SIZE-component batch
+template <typename TYPE, int SIZE> struct SoaViewOfSize {};
+template <typename TYPE> struct SoaViewOfSize<TYPE, 2> { typedef VECTOR2_SOA_VIEW<TYPE> type; static type From(TYPE* const* lanes, const unsigned& count) { return type(lanes[0], lanes[1], count); } };
+template <typename TYPE> struct SoaViewOfSize<TYPE, 3> { typedef VECTOR3_SOA_VIEW<TYPE> type; static type From(TYPE* const* lanes, const unsigned& count) { return type(lanes[0], lanes[1], lanes[2], count); } };
+template <typename TYPE> struct SoaViewOfSize<TYPE, 4> { typedef VECTOR4_SOA_VIEW<TYPE> type; static type From(TYPE* const* lanes, const unsigned& count) { return type(lanes[0], lanes[1], lanes[2], lanes[3], count); } };
 
+template <typename TYPE, int SIZE, int I0, int I1, int I2 = -1, int I3 = -1>
+struct SVML_MAY_ALIAS SOA_SWIZZLE
+{
+protected:
+	TYPE* lanes[SIZE];
+	unsigned count;
 
+public:
+	enum { COUNT = (I2 < 0) ? 2 : ((I3 < 0) ? 3 : 4) };
+	typedef typename SoaViewOfSize<TYPE, COUNT>::type PARENT;
 
-//----------------------------------------------------------------------
-// 
-// Sec. 04 - 2D vector type and associated functions
-// 
-//----------------------------------------------------------------------
+	operator PARENT() const
+	{
+		TYPE* const ordered[4] = { lanes[I0], lanes[I1], lanes[(I2 < 0) ? 0 : I2], lanes[(I3 < 0) ? 0 : I3] };
+		return SoaViewOfSize<TYPE, COUNT>::From(ordered, count);
+	}
+};
 
 template <typename TYPE>
-union VECTOR2
+union VECTOR2_SOA
 {
 private:
-	struct { TYPE x, y; } v;
+	struct { TYPE *x, *y; unsigned count; unsigned capacity; } v;
 
-	struct s1 { protected: TYPE x, y; };
-	struct s2 { protected: TYPE x, y; public: typedef VECTOR2<TYPE> PARENT; };
-	struct s3 { protected: TYPE x, y; public: typedef VECTOR3<TYPE> PARENT; };
-	struct s4 { protected: TYPE x, y; public: typedef VECTOR4<TYPE> PARENT; };
-
-	struct X : s1
+	void Allocate(const unsigned& count)
 	{
-		operator TYPE() const { return s1::x; }
-		const X& operator=(const TYPE& rhs) { s1::x = rhs; return *this; }
-		const X& operator+=(const TYPE& rhs) { s1::x += rhs; return *this; }
-		const X& operator-=(const TYPE& rhs) { s1::x -= rhs; return *this; }
-		const X& operator*=(const TYPE& rhs) { s1::x *= rhs; return *this; }
-		const X& operator/=(const TYPE& rhs) { s1::x /= rhs; return *this; }
-	};
-	struct Y : s1
-	{
-		operator TYPE() const { return s1::y; }
-		const Y& operator=(const TYPE& rhs) { s1::y = rhs; return *this; }
-		const Y& operator+=(const TYPE& rhs) { s1::y += rhs; return *this; }
-		const Y& operator-=(const TYPE& rhs) { s1::y -= rhs; return *this; }
-		const Y& operator*=(const TYPE& rhs) { s1::y *= rhs; return *this; }
-		const Y& operator/=(const TYPE& rhs) { s1::y /= rhs; return *this; }
-	};
-	struct XX : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::x); } };
-	struct XY : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::y); }
-		const XY& operator=(const VECTOR2<TYPE>& rhs) { s2::x = rhs.v.x; s2::y = rhs.v.y; return *this; }
-		const XY& operator+=(const VECTOR2<TYPE>& rhs) { s2::x += rhs.v.x; s2::y += rhs.v.y; return *this; }
-		const XY& operator-=(const VECTOR2<TYPE>& rhs) { s2::x -= rhs.v.x; s2::y -= rhs.v.y; return *this; }
-		const XY& operator*=(const VECTOR2<TYPE>& rhs) { s2::x *= rhs.v.x; s2::y *= rhs.v.y; return *this; }
-		const XY& operator/=(const VECTOR2<TYPE>& rhs) { s2::x /= rhs.v.x; s2::y /= rhs.v.y; return *this; }
-		const XY& operator*=(const TYPE& rhs) { s2::x *= rhs; s2::y *= rhs; return *this; }
-		const XY& operator/=(const TYPE& rhs) { s2::x /= rhs; s2::y /= rhs; return *this; }
-	};
-	struct YX : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::x); }
-		const YX& operator=(const VECTOR2<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y = rhs.v.x; s2::x = t0; return *this; }
-		const YX& operator+=(const VECTOR2<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y += rhs.v.x; s2::x += t0; return *this; }
-		const YX& operator-=(const VECTOR2<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y -= rhs.v.x; s2::x -= t0; return *this; }
-		const YX& operator*=(const VECTOR2<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y *= rhs.v.x; s2::x *= t0; return *this; }
-		const YX& operator/=(const VECTOR2<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y /= rhs.v.x; s2::x /= t0; return *this; }
-		const YX& operator*=(const TYPE& rhs) { s2::y *= rhs; s2::x *= rhs; return *this; }
-		const YX& operator/=(const TYPE& rhs) { s2::y /= rhs; s2::x /= rhs; return *this; }
-	};
-	struct YY : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::y); } };
-	struct XXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::x); } };
-	struct XXY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::y); } };
-	struct XYX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::x); } };
-	struct XYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::y); } };
-	struct YXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::x); } };
-	struct YXY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::y); } };
-	struct YYX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::x); } };
-	struct YYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::y); } };
-	struct XXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::x); } };
-	struct XXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::y); } };
-	struct XXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::x); } };
-	struct XXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::y); } };
-	struct XYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::x); } };
-	struct XYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::y); } };
-	struct XYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::x); } };
-	struct XYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::y); } };
-	struct YXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::x); } };
-	struct YXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::y); } };
-	struct YXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::x); } };
-	struct YXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::y); } };
-	struct YYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::x); } };
-	struct YYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::y); } };
-	struct YYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::x); } };
-	struct YYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::y); } };
-
-	// Length property
-	struct LENGTH
-	{
-	private:
-		TYPE x, y;
-		TYPE ApplyLength(const TYPE& curMag, const TYPE& newMag)
-		{
-			TYPE inverseScaledMagnitude = newMag / curMag;
-			x *= inverseScaledMagnitude;
-			y *= inverseScaledMagnitude;
-			return newMag;
-		}
-	public:
-		operator TYPE() const { return sqrt(x * x + y * y); }
-		TYPE operator=(const TYPE& rhs) { return ApplyLength((TYPE)(*this), rhs); }
-		TYPE operator+=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag + rhs); }
-		TYPE operator-=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag - rhs); }
-		TYPE operator*=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag * rhs); }
-		TYPE operator/=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag / rhs); }
-	};
+		v.count = count;
+		v.capacity = ((count + SOA_LANES - 1) / SOA_LANES) * SOA_LANES;
+		TYPE* block = (TYPE*)AlignedAllocate(v.capacity * 2 * sizeof(TYPE));
+		memset(block, 0, v.capacity * 2 * sizeof(TYPE));
+		v.x = block + v.capacity * 0;
+		v.y = block + v.capacity * 1;
+	}
 
 public:
-	VECTOR2() {}
-	VECTOR2(const TYPE& x, const TYPE& y) { v.x = x; v.y = y; }
-
-	// Swizzle variables
-	X x, r, s;
-	Y y, g, t;
-	XX xx, rr, ss;
-	XY xy, rg, st;
-	YX yx, gr, ts;
-	YY yy, gg, tt;
-	XXX xxx, rrr, sss;
-	XXY xxy, rrg, sst;
-	XYX xyx, rgr, sts;
-	XYY xyy, rgg, stt;
-	YXX yxx, grr, tss;
-	YXY yxy, grg, tst;
-	YYX yyx, ggr, tts;
-	YYY yyy, ggg, ttt;
-	XXXX xxxx, rrrr, ssss;
-	XXXY xxxy, rrrg, ssst;
-	XXYX xxyx, rrgr, ssts;
-	XXYY xxyy, rrgg, sstt;
-	XYXX xyxx, rgrr, stss;
-	XYXY xyxy, rgrg, stst;
-	XYYX xyyx, rggr, stts;
-	XYYY xyyy, rggg, sttt;
-	YXXX yxxx, grrr, tsss;
-	YXXY yxxy, grrg, tsst;
-	YXYX yxyx, grgr, tsts;
-	YXYY yxyy, grgg, tstt;
-	YYXX yyxx, ggrr, ttss;
-	YYXY yyxy, ggrg, ttst;
-	YYYX yyyx, gggr, ttts;
-	YYYY yyyy, gggg, tttt;
-
-	// Length property
-	LENGTH Length;
-
-	// Assignment operators (default for = is fine)
-	const VECTOR2& operator+=(const VECTOR2& rhs) { v.x += rhs.v.x; v.y += rhs.v.y; return *this; }
-	const VECTOR2& operator-=(const VECTOR2& rhs) { v.x -= rhs.v.x; v.y -= rhs.v.y; return *this; }
-	const VECTOR2& operator*=(const VECTOR2& rhs) { v.x *= rhs.v.x; v.y *= rhs.v.y; return *this; }
-	const VECTOR2& operator/=(const VECTOR2& rhs) { v.x /= rhs.v.x; v.y /= rhs.v.y; return *this; }
-	const VECTOR2& operator*=(const TYPE& rhs) { v.x *= rhs; v.y *= rhs; return *this; }
-	const VECTOR2& operator/=(const TYPE& rhs) { v.x /= rhs; v.y /= rhs; return *this; }
+	typedef VECTOR2_SOA_VIEW<TYPE> PARENT;
 
-	// Array notation access
-	const TYPE& operator[](const unsigned& index)
-	{
-		if (index == 0) { return v.x; }
-		else if (index == 1) { return v.y; }
-		else { cout << "Fatal Error: Attempted out of bounds bracket access of 2D vector." << endl << " - Vector: " << *this << endl << " - Index:  " << index << endl; exit(-1); }
-	}
+	VECTOR2_SOA() { v.count = 0; v.capacity = 0; v.x = v.y = 0; }
+	explicit VECTOR2_SOA(const unsigned& count) { Allocate(count); }
+	VECTOR2_SOA(const VECTOR2<TYPE>* vectors, const unsigned& count) { Allocate(count); for (unsigned i = 0; i < count; i++) { Set(i, vectors[i]); } }
+	VECTOR2_SOA(const VECTOR2_SOA& other) { Allocate(other.v.count); memcpy(v.x, other.v.x, v.capacity * 2 * sizeof(TYPE)); }
+	~VECTOR2_SOA() { AlignedFree(v.x); }
 
-	// Overload for cout
-	friend ostream& operator<<(ostream& os, const VECTOR2<TYPE>& printVector)
+	const VECTOR2_SOA& operator=(const VECTOR2_SOA& rhs)
 	{
-		os << "(" << printVector.v.x << ", " << printVector.v.y << ")";
-		return os;
+		if (this != &rhs)
+		{
+			AlignedFree(v.x);
+			Allocate(rhs.v.count);
+			memcpy(v.x, rhs.v.x, v.capacity * 2 * sizeof(TYPE));
+		}
+		return *this;
 	}
 
-	// Negation
-	VECTOR2 operator-() const { return VECTOR2(-v.x, -v.y); }
-
-	void Normalize() { *this /= this->Length; }
+	// Swizzle variables (views onto the same lanes, nothing is copied)
+	SOA_SWIZZLE<TYPE, 2, 0, 0> xx, rr, ss;
+	SOA_SWIZZLE<TYPE, 2, 0, 1> xy, rg, st;
+	SOA_SWIZZLE<TYPE, 2, 1, 0> yx, gr, ts;
+	SOA_SWIZZLE<TYPE, 2, 1, 1> yy, gg, tt;
+	SOA_SWIZZLE<TYPE, 2, 0, 0, 0> xxx, rrr, sss;
+	SOA_SWIZZLE<TYPE, 2, 0, 0, 1> xxy, rrg, sst;
+	SOA_SWIZZLE<TYPE, 2, 0, 1, 0> xyx, rgr, sts;
+	SOA_SWIZZLE<TYPE, 2, 0, 1, 1> xyy, rgg, stt;
+	SOA_SWIZZLE<TYPE, 2, 1, 0, 0> yxx, grr, tss;
+	SOA_SWIZZLE<TYPE, 2, 1, 0, 1> yxy, grg, tst;
+	SOA_SWIZZLE<TYPE, 2, 1, 1, 0> yyx, ggr, tts;
+	SOA_SWIZZLE<TYPE, 2, 1, 1, 1> yyy, ggg, ttt;
+	SOA_SWIZZLE<TYPE, 2, 0, 0, 0, 0> xxxx, rrrr, ssss;
+	SOA_SWIZZLE<TYPE, 2, 0, 0, 0, 1> xxxy, rrrg, ssst;
+	SOA_SWIZZLE<TYPE, 2, 0, 0, 1, 0> xxyx, rrgr, ssts;
+	SOA_SWIZZLE<TYPE, 2, 0, 0, 1, 1> xxyy, rrgg, sstt;
+	SOA_SWIZZLE<TYPE, 2, 0, 1, 0, 0> xyxx, rgrr, stss;
+	SOA_SWIZZLE<TYPE, 2, 0, 1, 0, 1> xyxy, rgrg, stst;
+	SOA_SWIZZLE<TYPE, 2, 0, 1, 1, 0> xyyx, rggr, stts;
+	SOA_SWIZZLE<TYPE, 2, 0, 1, 1, 1> xyyy, rggg, sttt;
+	SOA_SWIZZLE<TYPE, 2, 1, 0, 0, 0> yxxx, grrr, tsss;
+	SOA_SWIZZLE<TYPE, 2, 1, 0, 0, 1> yxxy, grrg, tsst;
+	SOA_SWIZZLE<TYPE, 2, 1, 0, 1, 0> yxyx, grgr, tsts;
+	SOA_SWIZZLE<TYPE, 2, 1, 0, 1, 1> yxyy, grgg, tstt;
+	SOA_SWIZZLE<TYPE, 2, 1, 1, 0, 0> yyxx, ggrr, ttss;
+	SOA_SWIZZLE<TYPE, 2, 1, 1, 0, 1> yyxy, ggrg, ttst;
+	SOA_SWIZZLE<TYPE, 2, 1, 1, 1, 0> yyyx, gggr, ttts;
+	SOA_SWIZZLE<TYPE, 2, 1, 1, 1, 1> yyyy, gggg, tttt;
+
+	// Element access
+	unsigned Count() const { return v.count; }
+	VECTOR2<TYPE> Get(const unsigned& index) const { return VECTOR2_SOA_VIEW<TYPE>(*this).Get(index); }
+	void Set(const unsigned& index, const VECTOR2<TYPE>& vector) { VECTOR2_SOA_VIEW<TYPE>(*this).Set(index, vector); }
+	void CopyTo(VECTOR2<TYPE>* vectors) const { for (unsigned i = 0; i < v.count; i++) { vectors[i] = Get(i); } }
+
+	// Lane access
+	operator VECTOR2_SOA_VIEW<TYPE>() const { return VECTOR2_SOA_VIEW<TYPE>(v.x, v.y, v.count); }
 };
 
-// 2D ToString()
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, string >::type ToString(const SWIZZLE& printSwizzle) { return ToString(typename SWIZZLE::PARENT(printSwizzle)); }
-template <typename TYPE> string ToString(const VECTOR2<TYPE>& printVector)
+// 2D batch Negate()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Negate(const OUT& out, const A& a) { Negate(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Negate(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a)
 {
-	std::ostringstream buffer;
-	buffer << "(" << printVector.x << ", " << printVector.y << ")";
-	return buffer.str();
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			block0[lane] = -aX;
+			block1[lane] = -aY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		block0[0] = -aX;
+		block1[0] = -aY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Negate [-]
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const SWIZZLE& toNegate)
+// 2D batch Add(): Component-wise [+]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type >::type Add(const OUT& out, const A& a, const B& b) { Add(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Add(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return -(typename SWIZZLE::PARENT(toNegate));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			TYPE bX = b.x[i], bY = b.y[i];
+			block0[lane] = aX + bX;
+			block1[lane] = aY + bY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		TYPE bX = b.x[i], bY = b.y[i];
+		block0[0] = aX + bX;
+		block1[0] = aY + bY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Addition [+]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator+(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) + typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator+(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) + rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator+(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs + typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR2<TYPE> operator+(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Subtract(): Component-wise [-]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type >::type Subtract(const OUT& out, const A& a, const B& b) { Subtract(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Subtract(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR2<TYPE>(lhs.x + rhs.x, lhs.y + rhs.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			TYPE bX = b.x[i], bY = b.y[i];
+			block0[lane] = aX - bX;
+			block1[lane] = aY - bY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		TYPE bX = b.x[i], bY = b.y[i];
+		block0[0] = aX - bX;
+		block1[0] = aY - bY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Subtraction [-]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator-(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) - typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) - rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs - typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR2<TYPE> operator-(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Multiply(): Component-wise [*]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type >::type Multiply(const OUT& out, const A& a, const B& b) { Multiply(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Multiply(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR2<TYPE>(lhs.x - rhs.x, lhs.y - rhs.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			TYPE bX = b.x[i], bY = b.y[i];
+			block0[lane] = aX * bX;
+			block1[lane] = aY * bY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		TYPE bX = b.x[i], bY = b.y[i];
+		block0[0] = aX * bX;
+		block1[0] = aY * bY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Multiplication [*]: Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator*(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) * typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) * rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR2<TYPE> operator*(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Divide(): Component-wise [/]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type >::type Divide(const OUT& out, const A& a, const B& b) { Divide(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Divide(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR2<TYPE>(lhs.x * rhs.x, lhs.y * rhs.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			TYPE bX = b.x[i], bY = b.y[i];
+			block0[lane] = aX / bX;
+			block1[lane] = aY / bY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		TYPE bX = b.x[i], bY = b.y[i];
+		block0[0] = aX / bX;
+		block1[0] = aY / bY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Division [/]: Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator/(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) / typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) / rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs / typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR2<TYPE> operator/(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Multiply(): Scalar [*]
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Multiply(const OUT& out, const A& a, const typename ScalarType< typename ComponentType< typename A::PARENT >::type >::type& scalar) { Multiply(typename OUT::PARENT(out), typename A::PARENT(a), scalar); }
+template <typename TYPE> void Multiply(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const typename ScalarType<TYPE>::type& scalar)
 {
-	return VECTOR2<TYPE>(lhs.x / rhs.x, lhs.y / rhs.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			block0[lane] = aX * scalar;
+			block1[lane] = aY * scalar;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		block0[0] = aX * scalar;
+		block1[0] = aY * scalar;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Multiplication [*]: Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SWIZZLE& lhs, const SCALAR_TYPE& rhs) { return typename SWIZZLE::PARENT(lhs) * rhs; }
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SCALAR_TYPE& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR2<TYPE> operator*(const VECTOR2<TYPE>& lhs, const SCALAR_TYPE& rhs)
+// 2D batch Divide(): Scalar [/]
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Divide(const OUT& out, const A& a, const typename ScalarType< typename ComponentType< typename A::PARENT >::type >::type& scalar) { Divide(typename OUT::PARENT(out), typename A::PARENT(a), scalar); }
+template <typename TYPE> void Divide(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const typename ScalarType<TYPE>::type& scalar)
 {
-	return VECTOR2<TYPE>(lhs.x * rhs, lhs.y * rhs);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			block0[lane] = aX / scalar;
+			block1[lane] = aY / scalar;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		block0[0] = aX / scalar;
+		block1[0] = aY / scalar;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
-template <typename TYPE> VECTOR2<TYPE> operator*(const SCALAR_TYPE& lhs, const VECTOR2<TYPE>& rhs)
+
+// 2D batch Normalize()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Normalize(const OUT& out, const A& a) { Normalize(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Normalize(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a)
 {
-	return VECTOR2<TYPE>(lhs * rhs.x, lhs * rhs.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			TYPE length = sqrt(aX * aX + aY * aY);
+			block0[lane] = aX / length;
+			block1[lane] = aY / length;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		TYPE length = sqrt(aX * aX + aY * aY);
+		block0[0] = aX / length;
+		block1[0] = aY / length;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Division [/]: Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SWIZZLE& lhs, const SCALAR_TYPE& rhs) { return typename SWIZZLE::PARENT(lhs) / rhs; }
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SCALAR_TYPE& lhs, const SWIZZLE& rhs) { return lhs / typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR2<TYPE> operator/(const VECTOR2<TYPE>& lhs, const SCALAR_TYPE& rhs)
+// 2D batch Dot()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type Dot(TYPE* out, const A& a, const B& b) { Dot(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Dot(TYPE* out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR2<TYPE>(lhs.x / rhs, lhs.y / rhs);
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = a.x[i] * b.x[i] + a.y[i] * b.y[i];
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = a.x[i] * b.x[i] + a.y[i] * b.y[i];
+		out[i] = block0[0];
+	}
 }
-template <typename TYPE> VECTOR2<TYPE> operator/(const SCALAR_TYPE& lhs, const VECTOR2<TYPE>& rhs)
+
+// 2D batch Project()
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type >::type Project(const OUT& out, const A& projectThis, const B& ontoThis) { Project(typename OUT::PARENT(out), typename A::PARENT(projectThis), typename B::PARENT(ontoThis)); }
+template <typename TYPE> void Project(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& projectThis, const VECTOR2_SOA_VIEW<TYPE>& ontoThis)
 {
-	return VECTOR2<TYPE>(lhs / rhs.x, lhs / rhs.y);
+	const VECTOR2_SOA_VIEW<TYPE>& a = projectThis;
+	const VECTOR2_SOA_VIEW<TYPE>& b = ontoThis;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			TYPE bX = b.x[i], bY = b.y[i];
+			TYPE scale = (aX * bX + aY * bY) / (bX * bX + bY * bY);
+			block0[lane] = scale * bX;
+			block1[lane] = scale * bY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		TYPE bX = b.x[i], bY = b.y[i];
+		TYPE scale = (aX * bX + aY * bY) / (bX * bX + bY * bY);
+		block0[0] = scale * bX;
+		block1[0] = scale * bY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Equal To [==]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator==(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) == typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator==(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) == rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator==(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs == typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator==(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Rotate()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Rotate(const OUT& out, const A& a, const typename RealType< typename ComponentType< typename A::PARENT >::type >::type& angle) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), angle); }
+template <typename TYPE> void Rotate(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const typename RealType<TYPE>::type& angle)
 {
-	return !(lhs.x != rhs.x || lhs.y != rhs.y);
+	Rotate(out, a, ROTATION2< typename RealType<TYPE>::type >(angle));
 }
 
-// 2D Not Equal To [!=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator!=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) != typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator!=(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) != rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator!=(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs != typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator!=(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Lerp()
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type >::type Lerp(const OUT& out, const A& start, const B& end, const typename RealType< typename ComponentType< typename A::PARENT >::type >::type& delta) { Lerp(typename OUT::PARENT(out), typename A::PARENT(start), typename B::PARENT(end), delta); }
+template <typename TYPE> void Lerp(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& start, const VECTOR2_SOA_VIEW<TYPE>& end, const typename RealType<TYPE>::type& delta)
 {
-	return lhs.x != rhs.x || lhs.y != rhs.y;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= start.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE startX = start.x[i], startY = start.y[i];
+			TYPE endX = end.x[i], endY = end.y[i];
+			block0[lane] = startX + delta * (endX - startX);
+			block1[lane] = startY + delta * (endY - startY);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < start.count; i++)
+	{
+		TYPE startX = start.x[i], startY = start.y[i];
+		TYPE endX = end.x[i], endY = end.y[i];
+		block0[0] = startX + delta * (endX - startX);
+		block1[0] = startY + delta * (endY - startY);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D AlmostEqual()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type AlmostEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqual((typename SWIZZLE0::PARENT(lhs)), (typename SWIZZLE1::PARENT(rhs))); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return AlmostEqual((typename SWIZZLE::PARENT(lhs)), rhs); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqual(lhs, (typename SWIZZLE::PARENT(rhs))); }
-template <typename TYPE> bool AlmostEqual(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Max(): Component-wise
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type >::type Max(const OUT& out, const A& a, const B& b) { Max(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Max(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return fabs(lhs.x - rhs.x) < COMPARISON_EPSILON && fabs(lhs.y - rhs.y) < COMPARISON_EPSILON;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			TYPE bX = b.x[i], bY = b.y[i];
+			block0[lane] = (aX < bX) ? bX : aX;
+			block1[lane] = (aY < bY) ? bY : aY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		TYPE bX = b.x[i], bY = b.y[i];
+		block0[0] = (aX < bX) ? bX : aX;
+		block1[0] = (aY < bY) ? bY : aY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Less Than [<]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) < typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator<(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) < rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator<(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs < typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator<(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Min(): Component-wise
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type >::type Min(const OUT& out, const A& a, const B& b) { Min(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Min(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.y < rhs.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			TYPE bX = b.x[i], bY = b.y[i];
+			block0[lane] = (bX < aX) ? bX : aX;
+			block1[lane] = (bY < aY) ? bY : aY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		TYPE bX = b.x[i], bY = b.y[i];
+		block0[0] = (bX < aX) ? bX : aX;
+		block1[0] = (bY < aY) ? bY : aY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Greater Than [>]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) > typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator>(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) > rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator>(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs > typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator>(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Ceil()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Ceil(const OUT& out, const A& a) { Ceil(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Ceil(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a)
 {
-	return lhs.x > rhs.x || (lhs.x == rhs.x && lhs.y > rhs.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = ceil(a.x[i]);
+			block1[lane] = ceil(a.y[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = ceil(a.x[i]);
+		block1[0] = ceil(a.y[i]);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Less Than Or Equal To [<=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) <= typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator<=(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) <= rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator<=(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs <= typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator<=(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Floor()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Floor(const OUT& out, const A& a) { Floor(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Floor(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a)
 {
-	return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.y <= rhs.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = floor(a.x[i]);
+			block1[lane] = floor(a.y[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = floor(a.x[i]);
+		block1[0] = floor(a.y[i]);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 2D Greater Than Or Equal To [<=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) >= typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator>=(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) >= rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator>=(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs >= typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator>=(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+// 2D batch Distance()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type Distance(TYPE* out, const A& a, const B& b) { Distance(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Distance(TYPE* out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return lhs.x > rhs.x || (lhs.x == rhs.x && lhs.y >= rhs.y);
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = sqrt((a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]));
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = sqrt((a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]));
+		out[i] = block0[0];
+	}
 }
 
-// 2D Normalize()
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Normalize(const SWIZZLE& toNormalize) { return Normalize(typename SWIZZLE::PARENT(toNormalize)); }
-template <typename TYPE> VECTOR2<TYPE> Normalize(const VECTOR2<TYPE>& toNormalize)
+// 2D batch DistanceSquared()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa2D< typename A::PARENT >, typename EnableIf< IsSoa2D< typename B::PARENT >, void >::type >::type DistanceSquared(TYPE* out, const A& a, const B& b) { DistanceSquared(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void DistanceSquared(TYPE* out, const VECTOR2_SOA_VIEW<TYPE>& a, const VECTOR2_SOA_VIEW<TYPE>& b)
 {
-	return toNormalize / toNormalize.Length;
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = (a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = (a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]);
+		out[i] = block0[0];
+	}
 }
 
-// 2D Dot()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type Dot(const SWIZZLE0& a, const SWIZZLE1& b) { return Dot(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Dot(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Dot(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Dot(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Dot(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE Dot(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+
+
+template <typename TYPE>
+union VECTOR3_SOA
 {
-	return a.x * b.x + a.y * b.y;
-}
+private:
+	struct { TYPE *x, *y, *z; unsigned count; unsigned capacity; } v;
+
+	void Allocate(const unsigned& count)
+	{
+		v.count = count;
+		v.capacity = ((count + SOA_LANES - 1) / SOA_LANES) * SOA_LANES;
+		TYPE* block = (TYPE*)AlignedAllocate(v.capacity * 3 * sizeof(TYPE));
+		memset(block, 0, v.capacity * 3 * sizeof(TYPE));
+		v.x = block + v.capacity * 0;
+		v.y = block + v.capacity * 1;
+		v.z = block + v.capacity * 2;
+	}
+
+public:
+	typedef VECTOR3_SOA_VIEW<TYPE> PARENT;
+
+	VECTOR3_SOA() { v.count = 0; v.capacity = 0; v.x = v.y = v.z = 0; }
+	explicit VECTOR3_SOA(const unsigned& count) { Allocate(count); }
+	VECTOR3_SOA(const VECTOR3<TYPE>* vectors, const unsigned& count) { Allocate(count); for (unsigned i = 0; i < count; i++) { Set(i, vectors[i]); } }
+	VECTOR3_SOA(const VECTOR3_SOA& other) { Allocate(other.v.count); memcpy(v.x, other.v.x, v.capacity * 3 * sizeof(TYPE)); }
+	~VECTOR3_SOA() { AlignedFree(v.x); }
+
+	const VECTOR3_SOA& operator=(const VECTOR3_SOA& rhs)
+	{
+		if (this != &rhs)
+		{
+			AlignedFree(v.x);
+			Allocate(rhs.v.count);
+			memcpy(v.x, rhs.v.x, v.capacity * 3 * sizeof(TYPE));
+		}
+		return *this;
+	}
 
-// 2D Perpendicular()
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Perpendicular(const SWIZZLE& toPerpendicular) { return Perpendicular(typename SWIZZLE::PARENT(toPerpendicular)); }
-template <typename TYPE> VECTOR2<TYPE> Perpendicular(const VECTOR2<TYPE>& toPerpendicular)
+	// Swizzle variables (views onto the same lanes, nothing is copied)
+	SOA_SWIZZLE<TYPE, 3, 0, 0> xx, rr, ss;
+	SOA_SWIZZLE<TYPE, 3, 0, 1> xy, rg, st;
+	SOA_SWIZZLE<TYPE, 3, 0, 2> xz, rb, sp;
+	SOA_SWIZZLE<TYPE, 3, 1, 0> yx, gr, ts;
+	SOA_SWIZZLE<TYPE, 3, 1, 1> yy, gg, tt;
+	SOA_SWIZZLE<TYPE, 3, 1, 2> yz, gb, tp;
+	SOA_SWIZZLE<TYPE, 3, 2, 0> zx, br, ps;
+	SOA_SWIZZLE<TYPE, 3, 2, 1> zy, bg, pt;
+	SOA_SWIZZLE<TYPE, 3, 2, 2> zz, bb, pp;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 0> xxx, rrr, sss;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 1> xxy, rrg, sst;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 2> xxz, rrb, ssp;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 0> xyx, rgr, sts;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 1> xyy, rgg, stt;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 2> xyz, rgb, stp;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 0> xzx, rbr, sps;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 1> xzy, rbg, spt;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 2> xzz, rbb, spp;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 0> yxx, grr, tss;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 1> yxy, grg, tst;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 2> yxz, grb, tsp;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 0> yyx, ggr, tts;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 1> yyy, ggg, ttt;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 2> yyz, ggb, ttp;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 0> yzx, gbr, tps;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 1> yzy, gbg, tpt;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 2> yzz, gbb, tpp;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 0> zxx, brr, pss;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 1> zxy, brg, pst;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 2> zxz, brb, psp;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 0> zyx, bgr, pts;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 1> zyy, bgg, ptt;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 2> zyz, bgb, ptp;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 0> zzx, bbr, pps;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 1> zzy, bbg, ppt;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 2> zzz, bbb, ppp;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 0, 0> xxxx, rrrr, ssss;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 0, 1> xxxy, rrrg, ssst;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 0, 2> xxxz, rrrb, sssp;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 1, 0> xxyx, rrgr, ssts;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 1, 1> xxyy, rrgg, sstt;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 1, 2> xxyz, rrgb, sstp;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 2, 0> xxzx, rrbr, ssps;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 2, 1> xxzy, rrbg, sspt;
+	SOA_SWIZZLE<TYPE, 3, 0, 0, 2, 2> xxzz, rrbb, sspp;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 0, 0> xyxx, rgrr, stss;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 0, 1> xyxy, rgrg, stst;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 0, 2> xyxz, rgrb, stsp;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 1, 0> xyyx, rggr, stts;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 1, 1> xyyy, rggg, sttt;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 1, 2> xyyz, rggb, sttp;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 2, 0> xyzx, rgbr, stps;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 2, 1> xyzy, rgbg, stpt;
+	SOA_SWIZZLE<TYPE, 3, 0, 1, 2, 2> xyzz, rgbb, stpp;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 0, 0> xzxx, rbrr, spss;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 0, 1> xzxy, rbrg, spst;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 0, 2> xzxz, rbrb, spsp;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 1, 0> xzyx, rbgr, spts;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 1, 1> xzyy, rbgg, sptt;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 1, 2> xzyz, rbgb, sptp;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 2, 0> xzzx, rbbr, spps;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 2, 1> xzzy, rbbg, sppt;
+	SOA_SWIZZLE<TYPE, 3, 0, 2, 2, 2> xzzz, rbbb, sppp;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 0, 0> yxxx, grrr, tsss;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 0, 1> yxxy, grrg, tsst;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 0, 2> yxxz, grrb, tssp;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 1, 0> yxyx, grgr, tsts;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 1, 1> yxyy, grgg, tstt;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 1, 2> yxyz, grgb, tstp;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 2, 0> yxzx, grbr, tsps;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 2, 1> yxzy, grbg, tspt;
+	SOA_SWIZZLE<TYPE, 3, 1, 0, 2, 2> yxzz, grbb, tspp;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 0, 0> yyxx, ggrr, ttss;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 0, 1> yyxy, ggrg, ttst;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 0, 2> yyxz, ggrb, ttsp;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 1, 0> yyyx, gggr, ttts;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 1, 1> yyyy, gggg, tttt;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 1, 2> yyyz, gggb, tttp;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 2, 0> yyzx, ggbr, ttps;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 2, 1> yyzy, ggbg, ttpt;
+	SOA_SWIZZLE<TYPE, 3, 1, 1, 2, 2> yyzz, ggbb, ttpp;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 0, 0> yzxx, gbrr, tpss;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 0, 1> yzxy, gbrg, tpst;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 0, 2> yzxz, gbrb, tpsp;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 1, 0> yzyx, gbgr, tpts;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 1, 1> yzyy, gbgg, tptt;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 1, 2> yzyz, gbgb, tptp;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 2, 0> yzzx, gbbr, tpps;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 2, 1> yzzy, gbbg, tppt;
+	SOA_SWIZZLE<TYPE, 3, 1, 2, 2, 2> yzzz, gbbb, tppp;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 0, 0> zxxx, brrr, psss;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 0, 1> zxxy, brrg, psst;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 0, 2> zxxz, brrb, pssp;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 1, 0> zxyx, brgr, psts;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 1, 1> zxyy, brgg, pstt;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 1, 2> zxyz, brgb, pstp;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 2, 0> zxzx, brbr, psps;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 2, 1> zxzy, brbg, pspt;
+	SOA_SWIZZLE<TYPE, 3, 2, 0, 2, 2> zxzz, brbb, pspp;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 0, 0> zyxx, bgrr, ptss;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 0, 1> zyxy, bgrg, ptst;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 0, 2> zyxz, bgrb, ptsp;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 1, 0> zyyx, bggr, ptts;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 1, 1> zyyy, bggg, pttt;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 1, 2> zyyz, bggb, pttp;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 2, 0> zyzx, bgbr, ptps;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 2, 1> zyzy, bgbg, ptpt;
+	SOA_SWIZZLE<TYPE, 3, 2, 1, 2, 2> zyzz, bgbb, ptpp;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 0, 0> zzxx, bbrr, ppss;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 0, 1> zzxy, bbrg, ppst;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 0, 2> zzxz, bbrb, ppsp;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 1, 0> zzyx, bbgr, ppts;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 1, 1> zzyy, bbgg, pptt;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 1, 2> zzyz, bbgb, pptp;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 2, 0> zzzx, bbbr, ppps;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 2, 1> zzzy, bbbg, pppt;
+	SOA_SWIZZLE<TYPE, 3, 2, 2, 2, 2> zzzz, bbbb, pppp;
+
+	// Element access
+	unsigned Count() const { return v.count; }
+	VECTOR3<TYPE> Get(const unsigned& index) const { return VECTOR3_SOA_VIEW<TYPE>(*this).Get(index); }
+	void Set(const unsigned& index, const VECTOR3<TYPE>& vector) { VECTOR3_SOA_VIEW<TYPE>(*this).Set(index, vector); }
+	void CopyTo(VECTOR3<TYPE>* vectors) const { for (unsigned i = 0; i < v.count; i++) { vectors[i] = Get(i); } }
+
+	// Lane access
+	operator VECTOR3_SOA_VIEW<TYPE>() const { return VECTOR3_SOA_VIEW<TYPE>(v.x, v.y, v.z, v.count); }
+};
+
+// 3D batch Negate()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Negate(const OUT& out, const A& a) { Negate(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Negate(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a)
 {
-	return vec2(-toPerpendicular.y, toPerpendicular.x);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			block0[lane] = -aX;
+			block1[lane] = -aY;
+			block2[lane] = -aZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		block0[0] = -aX;
+		block1[0] = -aY;
+		block2[0] = -aZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Project()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Project(const SWIZZLE0& projectThis, const SWIZZLE1& ontoThis) { return Project(typename SWIZZLE0::PARENT(projectThis), typename SWIZZLE1::PARENT(ontoThis)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const SWIZZLE& projectThis, const VECTOR2<TYPE>& ontoThis) { return Project(typename SWIZZLE::PARENT(projectThis), ontoThis); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const VECTOR2<TYPE>& projectThis, const SWIZZLE& ontoThis) { return Project(projectThis, typename SWIZZLE::PARENT(ontoThis)); }
-template <typename TYPE> VECTOR2<TYPE> Project(const VECTOR2<TYPE>& projectThis, const VECTOR2<TYPE>& ontoThis)
+// 3D batch Add(): Component-wise [+]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Add(const OUT& out, const A& a, const B& b) { Add(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Add(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
 {
-	return (Dot(projectThis, ontoThis) / Dot(ontoThis, ontoThis)) * ontoThis;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			block0[lane] = aX + bX;
+			block1[lane] = aY + bY;
+			block2[lane] = aZ + bZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		block0[0] = aX + bX;
+		block1[0] = aY + bY;
+		block2[0] = aZ + bZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Rotate()
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& vector, const SCALAR_TYPE& angle) { return Rotate(typename SWIZZLE::PARENT(vector), angle); }
-template <typename TYPE> VECTOR2<TYPE> Rotate(const VECTOR2<TYPE>& vector, const SCALAR_TYPE& angle)
+// 3D batch Subtract(): Component-wise [-]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Subtract(const OUT& out, const A& a, const B& b) { Subtract(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Subtract(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
 {
-	SCALAR_TYPE sa = sin(angle);
-	SCALAR_TYPE ca = cos(angle);
-	return VECTOR2<TYPE>(vector.x * ca - vector.y * sa, vector.x * sa + vector.y * ca);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			block0[lane] = aX - bX;
+			block1[lane] = aY - bY;
+			block2[lane] = aZ - bZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		block0[0] = aX - bX;
+		block1[0] = aY - bY;
+		block2[0] = aZ - bZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Lerp()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Lerp(const SWIZZLE0& start, const SWIZZLE1& end, const SCALAR_TYPE& delta) { return Lerp(typename SWIZZLE0::PARENT(start), typename SWIZZLE1::PARENT(end), delta); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const SWIZZLE& start, const VECTOR2<TYPE>& end, const SCALAR_TYPE& delta) { return Lerp(typename SWIZZLE::PARENT(start), end, delta); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const VECTOR2<TYPE>& start, const SWIZZLE& end, const SCALAR_TYPE& delta) { return Lerp(start, typename SWIZZLE::PARENT(end), delta); }
-template <typename TYPE> VECTOR2<TYPE> Lerp(const VECTOR2<TYPE>& start, const VECTOR2<TYPE>& end, const SCALAR_TYPE& delta)
+// 3D batch Multiply(): Component-wise [*]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Multiply(const OUT& out, const A& a, const B& b) { Multiply(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Multiply(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR2<TYPE>(start.x + delta * (end.x - start.x),
-	                     start.y + delta * (end.y - start.y));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			block0[lane] = aX * bX;
+			block1[lane] = aY * bY;
+			block2[lane] = aZ * bZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		block0[0] = aX * bX;
+		block1[0] = aY * bY;
+		block2[0] = aZ * bZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Max(): Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Max(const SWIZZLE0& a, const SWIZZLE1& b) { return Max(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Max(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Max(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR2<TYPE> Max(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+// 3D batch Divide(): Component-wise [/]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Divide(const OUT& out, const A& a, const B& b) { Divide(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Divide(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR2<TYPE>(max(a.x, b.x), max(a.y, b.y));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			block0[lane] = aX / bX;
+			block1[lane] = aY / bY;
+			block2[lane] = aZ / bZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		block0[0] = aX / bX;
+		block1[0] = aY / bY;
+		block2[0] = aZ / bZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Min(): Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Min(const SWIZZLE0& a, const SWIZZLE1& b) { return Min(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Min(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Min(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR2<TYPE> Min(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+// 3D batch Multiply(): Scalar [*]
+template <typename OUT, typename A> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Multiply(const OUT& out, const A& a, const typename ScalarType< typename ComponentType< typename A::PARENT >::type >::type& scalar) { Multiply(typename OUT::PARENT(out), typename A::PARENT(a), scalar); }
+template <typename TYPE> void Multiply(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const typename ScalarType<TYPE>::type& scalar)
 {
-	return VECTOR2<TYPE>(min(a.x, b.x), min(a.y, b.y));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			block0[lane] = aX * scalar;
+			block1[lane] = aY * scalar;
+			block2[lane] = aZ * scalar;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		block0[0] = aX * scalar;
+		block1[0] = aY * scalar;
+		block2[0] = aZ * scalar;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Max(): Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const SCALAR_TYPE& maximum) { return Max(typename SWIZZLE::PARENT(a), maximum); }
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SCALAR_TYPE& maximum, const SWIZZLE& b) { return Max(maximum, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR2<TYPE> Max(const VECTOR2<TYPE>& a, const SCALAR_TYPE& maximum)
+// 3D batch Divide(): Scalar [/]
+template <typename OUT, typename A> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Divide(const OUT& out, const A& a, const typename ScalarType< typename ComponentType< typename A::PARENT >::type >::type& scalar) { Divide(typename OUT::PARENT(out), typename A::PARENT(a), scalar); }
+template <typename TYPE> void Divide(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const typename ScalarType<TYPE>::type& scalar)
 {
-	return VECTOR2<TYPE>(max((SCALAR_TYPE)a.x, maximum), max((SCALAR_TYPE)a.y, maximum));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			block0[lane] = aX / scalar;
+			block1[lane] = aY / scalar;
+			block2[lane] = aZ / scalar;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		block0[0] = aX / scalar;
+		block1[0] = aY / scalar;
+		block2[0] = aZ / scalar;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
-template <typename TYPE> VECTOR2<TYPE> Max(const SCALAR_TYPE& maximum, const VECTOR2<TYPE>& b)
+
+// 3D batch Normalize()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Normalize(const OUT& out, const A& a) { Normalize(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Normalize(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a)
 {
-	return VECTOR2<TYPE>(max(maximum, (SCALAR_TYPE)b.x), max(maximum, (SCALAR_TYPE)b.y));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE length = sqrt(aX * aX + aY * aY + aZ * aZ);
+			block0[lane] = aX / length;
+			block1[lane] = aY / length;
+			block2[lane] = aZ / length;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE length = sqrt(aX * aX + aY * aY + aZ * aZ);
+		block0[0] = aX / length;
+		block1[0] = aY / length;
+		block2[0] = aZ / length;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Min(): Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const SCALAR_TYPE& minimum) { return Min(typename SWIZZLE::PARENT(a), minimum); }
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SCALAR_TYPE& minimum, const SWIZZLE& b) { return Min(minimum, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR2<TYPE> Min(const VECTOR2<TYPE>& a, const SCALAR_TYPE& minimum)
+// 3D batch Dot()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type Dot(TYPE* out, const A& a, const B& b) { Dot(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Dot(TYPE* out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR2<TYPE>(min((SCALAR_TYPE)a.x, minimum), min((SCALAR_TYPE)a.y, minimum));
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+		out[i] = block0[0];
+	}
 }
-template <typename TYPE> VECTOR2<TYPE> Min(const SCALAR_TYPE& minimum, const VECTOR2<TYPE>& b)
+
+// 3D batch Cross()
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Cross(const OUT& out, const A& a, const B& b) { Cross(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Cross(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR2<TYPE>(min(minimum, (SCALAR_TYPE)b.x), min(minimum, (SCALAR_TYPE)b.y));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			block0[lane] = aY * bZ - aZ * bY;
+			block1[lane] = aZ * bX - aX * bZ;
+			block2[lane] = aX * bY - aY * bX;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		block0[0] = aY * bZ - aZ * bY;
+		block1[0] = aZ * bX - aX * bZ;
+		block2[0] = aX * bY - aY * bX;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Ceil()
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Ceil(const SWIZZLE& toCeil) { return Ceil(typename SWIZZLE::PARENT(toCeil)); }
-template <typename TYPE> VECTOR2<TYPE> Ceil(const VECTOR2<TYPE>& toCeil)
+// 3D batch Project()
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Project(const OUT& out, const A& projectThis, const B& ontoThis) { Project(typename OUT::PARENT(out), typename A::PARENT(projectThis), typename B::PARENT(ontoThis)); }
+template <typename TYPE> void Project(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& projectThis, const VECTOR3_SOA_VIEW<TYPE>& ontoThis)
 {
-	return VECTOR2<TYPE>(ceil(toCeil.x), ceil(toCeil.y));
+	const VECTOR3_SOA_VIEW<TYPE>& a = projectThis;
+	const VECTOR3_SOA_VIEW<TYPE>& b = ontoThis;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			TYPE scale = (aX * bX + aY * bY + aZ * bZ) / (bX * bX + bY * bY + bZ * bZ);
+			block0[lane] = scale * bX;
+			block1[lane] = scale * bY;
+			block2[lane] = scale * bZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		TYPE scale = (aX * bX + aY * bY + aZ * bZ) / (bX * bX + bY * bY + bZ * bZ);
+		block0[0] = scale * bX;
+		block1[0] = scale * bY;
+		block2[0] = scale * bZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D Floor()
-template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Floor(const SWIZZLE& toFloor) { return Floor(typename SWIZZLE::PARENT(toFloor)); }
-template <typename TYPE> VECTOR2<TYPE> Floor(const VECTOR2<TYPE>& toFloor)
+// 3D batch Rotate()
+template <typename OUT, typename A, typename TYPE> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Rotate(const OUT& out, const A& a, const VECTOR3<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), rotationAxis, radians); }
+template <typename TYPE> void Rotate(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians)
 {
-	return VECTOR2<TYPE>(floor(toFloor.x), floor(toFloor.y));
+	Rotate(out, a, QUATERNION<TYPE>(rotationAxis, radians));
 }
 
-// 2D Distance()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type Distance(const SWIZZLE0& a, const SWIZZLE1& b) { return Distance(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Distance(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Distance(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Distance(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Distance(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE Distance(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+// 3D batch Lerp()
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Lerp(const OUT& out, const A& start, const B& end, const typename RealType< typename ComponentType< typename A::PARENT >::type >::type& delta) { Lerp(typename OUT::PARENT(out), typename A::PARENT(start), typename B::PARENT(end), delta); }
+template <typename TYPE> void Lerp(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& start, const VECTOR3_SOA_VIEW<TYPE>& end, const typename RealType<TYPE>::type& delta)
 {
-	return sqrt(DistanceSquared(a, b));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= start.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE startX = start.x[i], startY = start.y[i], startZ = start.z[i];
+			TYPE endX = end.x[i], endY = end.y[i], endZ = end.z[i];
+			block0[lane] = startX + delta * (endX - startX);
+			block1[lane] = startY + delta * (endY - startY);
+			block2[lane] = startZ + delta * (endZ - startZ);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < start.count; i++)
+	{
+		TYPE startX = start.x[i], startY = start.y[i], startZ = start.z[i];
+		TYPE endX = end.x[i], endY = end.y[i], endZ = end.z[i];
+		block0[0] = startX + delta * (endX - startX);
+		block1[0] = startY + delta * (endY - startY);
+		block2[0] = startZ + delta * (endZ - startZ);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 2D DistanceSquared()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type DistanceSquared(const SWIZZLE0& a, const SWIZZLE1& b) { return DistanceSquared(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type DistanceSquared(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return DistanceSquared(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type DistanceSquared(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return DistanceSquared(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE DistanceSquared(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+// 3D batch Max(): Component-wise
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Max(const OUT& out, const A& a, const B& b) { Max(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Max(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
 {
-	return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			block0[lane] = (aX < bX) ? bX : aX;
+			block1[lane] = (aY < bY) ? bY : aY;
+			block2[lane] = (aZ < bZ) ? bZ : aZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		block0[0] = (aX < bX) ? bX : aX;
+		block1[0] = (aY < bY) ? bY : aY;
+		block2[0] = (aZ < bZ) ? bZ : aZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
+// 3D batch Min(): Component-wise
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type >::type Min(const OUT& out, const A& a, const B& b) { Min(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Min(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
+{
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			block0[lane] = (bX < aX) ? bX : aX;
+			block1[lane] = (bY < aY) ? bY : aY;
+			block2[lane] = (bZ < aZ) ? bZ : aZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		block0[0] = (bX < aX) ? bX : aX;
+		block1[0] = (bY < aY) ? bY : aY;
+		block2[0] = (bZ < aZ) ? bZ : aZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
+}
 
-
-//----------------------------------------------------------------------
-// 
-// Sec. 05 - 3D vector type and associated functions
-// 
-//----------------------------------------------------------------------
-
-template <typename TYPE>
-union VECTOR3
+// 3D batch Ceil()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Ceil(const OUT& out, const A& a) { Ceil(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Ceil(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a)
 {
-private:
-	struct { TYPE x, y, z; } v;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = ceil(a.x[i]);
+			block1[lane] = ceil(a.y[i]);
+			block2[lane] = ceil(a.z[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = ceil(a.x[i]);
+		block1[0] = ceil(a.y[i]);
+		block2[0] = ceil(a.z[i]);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
+}
 
-	struct s1 { protected: TYPE x, y, z; };
-	struct s2 { protected: TYPE x, y, z; public: typedef VECTOR2<TYPE> PARENT; };
-	struct s3 { protected: TYPE x, y, z; public: typedef VECTOR3<TYPE> PARENT; };
-	struct s4 { protected: TYPE x, y, z; public: typedef VECTOR4<TYPE> PARENT; };
+// 3D batch Floor()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Floor(const OUT& out, const A& a) { Floor(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Floor(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a)
+{
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = floor(a.x[i]);
+			block1[lane] = floor(a.y[i]);
+			block2[lane] = floor(a.z[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = floor(a.x[i]);
+		block1[0] = floor(a.y[i]);
+		block2[0] = floor(a.z[i]);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
+}
 
-	struct X : s1
+// 3D batch Distance()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type Distance(TYPE* out, const A& a, const B& b) { Distance(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Distance(TYPE* out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
+{
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
 	{
-		operator TYPE() const { return s1::x; }
-		const X& operator=(const TYPE& rhs) { s1::x = rhs; return *this; }
-		const X& operator+=(const TYPE& rhs) { s1::x += rhs; return *this; }
-		const X& operator-=(const TYPE& rhs) { s1::x -= rhs; return *this; }
-		const X& operator*=(const TYPE& rhs) { s1::x *= rhs; return *this; }
-		const X& operator/=(const TYPE& rhs) { s1::x /= rhs; return *this; }
-	};
-	struct Y : s1
-	{
-		operator TYPE() const { return s1::y; }
-		const Y& operator=(const TYPE& rhs) { s1::y = rhs; return *this; }
-		const Y& operator+=(const TYPE& rhs) { s1::y += rhs; return *this; }
-		const Y& operator-=(const TYPE& rhs) { s1::y -= rhs; return *this; }
-		const Y& operator*=(const TYPE& rhs) { s1::y *= rhs; return *this; }
-		const Y& operator/=(const TYPE& rhs) { s1::y /= rhs; return *this; }
-	};
-	struct Z : s1
-	{
-		operator TYPE() const { return s1::z; }
-		const Z& operator=(const TYPE& rhs) { s1::z = rhs; return *this; }
-		const Z& operator+=(const TYPE& rhs) { s1::z += rhs; return *this; }
-		const Z& operator-=(const TYPE& rhs) { s1::z -= rhs; return *this; }
-		const Z& operator*=(const TYPE& rhs) { s1::z *= rhs; return *this; }
-		const Z& operator/=(const TYPE& rhs) { s1::z /= rhs; return *this; }
-	};
-	struct XX : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::x); } };
-	struct XY : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::y); }
-		const XY& operator=(const VECTOR3<TYPE>& rhs) { s2::x = rhs.v.x; s2::y = rhs.v.y; return *this; }
-		const XY& operator+=(const VECTOR3<TYPE>& rhs) { s2::x += rhs.v.x; s2::y += rhs.v.y; return *this; }
-		const XY& operator-=(const VECTOR3<TYPE>& rhs) { s2::x -= rhs.v.x; s2::y -= rhs.v.y; return *this; }
-		const XY& operator*=(const VECTOR3<TYPE>& rhs) { s2::x *= rhs.v.x; s2::y *= rhs.v.y; return *this; }
-		const XY& operator/=(const VECTOR3<TYPE>& rhs) { s2::x /= rhs.v.x; s2::y /= rhs.v.y; return *this; }
-		const XY& operator*=(const TYPE& rhs) { s2::x *= rhs; s2::y *= rhs; return *this; }
-		const XY& operator/=(const TYPE& rhs) { s2::x /= rhs; s2::y /= rhs; return *this; }
-	};
-	struct XZ : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::z); }
-		const XZ& operator=(const VECTOR3<TYPE>& rhs) { s2::x = rhs.v.x; s2::z = rhs.v.y; return *this; }
-		const XZ& operator+=(const VECTOR3<TYPE>& rhs) { s2::x += rhs.v.x; s2::z += rhs.v.y; return *this; }
-		const XZ& operator-=(const VECTOR3<TYPE>& rhs) { s2::x -= rhs.v.x; s2::z -= rhs.v.y; return *this; }
-		const XZ& operator*=(const VECTOR3<TYPE>& rhs) { s2::x *= rhs.v.x; s2::z *= rhs.v.y; return *this; }
-		const XZ& operator/=(const VECTOR3<TYPE>& rhs) { s2::x /= rhs.v.x; s2::z /= rhs.v.y; return *this; }
-		const XZ& operator*=(const TYPE& rhs) { s2::x *= rhs; s2::z *= rhs; return *this; }
-		const XZ& operator/=(const TYPE& rhs) { s2::x /= rhs; s2::z /= rhs; return *this; }
-	};
-	struct YX : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::x); }
-		const YX& operator=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y = rhs.v.x; s2::x = t0; return *this; }
-		const YX& operator+=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y += rhs.v.x; s2::x += t0; return *this; }
-		const YX& operator-=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y -= rhs.v.x; s2::x -= t0; return *this; }
-		const YX& operator*=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y *= rhs.v.x; s2::x *= t0; return *this; }
-		const YX& operator/=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y /= rhs.v.x; s2::x /= t0; return *this; }
-		const YX& operator*=(const TYPE& rhs) { s2::y *= rhs; s2::x *= rhs; return *this; }
-		const YX& operator/=(const TYPE& rhs) { s2::y /= rhs; s2::x /= rhs; return *this; }
-	};
-	struct YY : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::y); } };
-	struct YZ : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::z); }
-		const YZ& operator=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y = rhs.v.x; s2::z = t0; return *this; }
-		const YZ& operator+=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y += rhs.v.x; s2::z += t0; return *this; }
-		const YZ& operator-=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y -= rhs.v.x; s2::z -= t0; return *this; }
-		const YZ& operator*=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y *= rhs.v.x; s2::z *= t0; return *this; }
-		const YZ& operator/=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y /= rhs.v.x; s2::z /= t0; return *this; }
-		const YZ& operator*=(const TYPE& rhs) { s2::y *= rhs; s2::z *= rhs; return *this; }
-		const YZ& operator/=(const TYPE& rhs) { s2::y /= rhs; s2::z /= rhs; return *this; }
-	};
-	struct ZX : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::z, s2::x); }
-		const ZX& operator=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z = rhs.v.x; s2::x = t0; return *this; }
-		const ZX& operator+=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z += rhs.v.x; s2::x += t0; return *this; }
-		const ZX& operator-=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z -= rhs.v.x; s2::x -= t0; return *this; }
-		const ZX& operator*=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z *= rhs.v.x; s2::x *= t0; return *this; }
-		const ZX& operator/=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z /= rhs.v.x; s2::x /= t0; return *this; }
-		const ZX& operator*=(const TYPE& rhs) { s2::z *= rhs; s2::x *= rhs; return *this; }
-		const ZX& operator/=(const TYPE& rhs) { s2::z /= rhs; s2::x /= rhs; return *this; }
-	};
-	struct ZY : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::z, s2::y); }
-		const ZY& operator=(const VECTOR3<TYPE>& rhs) { s2::z = rhs.v.x; s2::y = rhs.v.y; return *this; }
-		const ZY& operator+=(const VECTOR3<TYPE>& rhs) { s2::z += rhs.v.x; s2::y += rhs.v.y; return *this; }
-		const ZY& operator-=(const VECTOR3<TYPE>& rhs) { s2::z -= rhs.v.x; s2::y -= rhs.v.y; return *this; }
-		const ZY& operator*=(const VECTOR3<TYPE>& rhs) { s2::z *= rhs.v.x; s2::y *= rhs.v.y; return *this; }
-		const ZY& operator/=(const VECTOR3<TYPE>& rhs) { s2::z /= rhs.v.x; s2::y /= rhs.v.y; return *this; }
-		const ZY& operator*=(const TYPE& rhs) { s2::z *= rhs; s2::y *= rhs; return *this; }
-		const ZY& operator/=(const TYPE& rhs) { s2::z /= rhs; s2::y /= rhs; return *this; }
-	};
-	struct ZZ : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::z, s2::z); } };
-	struct XXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::x); } };
-	struct XXY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::y); } };
-	struct XXZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::z); } };
-	struct XYX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::x); } };
-	struct XYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::y); } };
-	struct XYZ : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::z); }
-		const XYZ& operator=(const VECTOR3<TYPE>& rhs) { s3::x = rhs.v.x; s3::y = rhs.v.y; s3::z = rhs.v.z; return *this; }
-		const XYZ& operator+=(const VECTOR3<TYPE>& rhs) { s3::x += rhs.v.x; s3::y += rhs.v.y; s3::z += rhs.v.z; return *this; }
-		const XYZ& operator-=(const VECTOR3<TYPE>& rhs) { s3::x -= rhs.v.x; s3::y -= rhs.v.y; s3::z -= rhs.v.z; return *this; }
-		const XYZ& operator*=(const VECTOR3<TYPE>& rhs) { s3::x *= rhs.v.x; s3::y *= rhs.v.y; s3::z *= rhs.v.z; return *this; }
-		const XYZ& operator/=(const VECTOR3<TYPE>& rhs) { s3::x /= rhs.v.x; s3::y /= rhs.v.y; s3::z /= rhs.v.z; return *this; }
-		const XYZ& operator*=(const TYPE& rhs) { s3::x *= rhs; s3::y *= rhs; s3::z *= rhs; return *this; }
-		const XYZ& operator/=(const TYPE& rhs) { s3::x /= rhs; s3::y /= rhs; s3::z /= rhs; return *this; }
-	};
-	struct XZX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::z, s3::x); } };
-	struct XZY : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::z, s3::y); }
-		const XZY& operator=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x = rhs.v.x; s3::z = rhs.v.y; s3::y = t0; return *this; }
-		const XZY& operator+=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x += rhs.v.x; s3::z += rhs.v.y; s3::y += t0; return *this; }
-		const XZY& operator-=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x -= rhs.v.x; s3::z -= rhs.v.y; s3::y -= t0; return *this; }
-		const XZY& operator*=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x *= rhs.v.x; s3::z *= rhs.v.y; s3::y *= t0; return *this; }
-		const XZY& operator/=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x /= rhs.v.x; s3::z /= rhs.v.y; s3::y /= t0; return *this; }
-		const XZY& operator*=(const TYPE& rhs) { s3::x *= rhs; s3::z *= rhs; s3::y *= rhs; return *this; }
-		const XZY& operator/=(const TYPE& rhs) { s3::x /= rhs; s3::z /= rhs; s3::y /= rhs; return *this; }
-	};
-	struct XZZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::z, s3::z); } };
-	struct YXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::x); } };
-	struct YXY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::y); } };
-	struct YXZ : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::z); }
-		const YXZ& operator=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y = rhs.v.x; s3::x = t0; s3::z = rhs.v.z; return *this; }
-		const YXZ& operator+=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y += rhs.v.x; s3::x += t0; s3::z += rhs.v.z; return *this; }
-		const YXZ& operator-=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y -= rhs.v.x; s3::x -= t0; s3::z -= rhs.v.z; return *this; }
-		const YXZ& operator*=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y *= rhs.v.x; s3::x *= t0; s3::z *= rhs.v.z; return *this; }
-		const YXZ& operator/=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y /= rhs.v.x; s3::x /= t0; s3::z /= rhs.v.z; return *this; }
-		const YXZ& operator*=(const TYPE& rhs) { s3::y *= rhs; s3::x *= rhs; s3::z *= rhs; return *this; }
-		const YXZ& operator/=(const TYPE& rhs) { s3::y /= rhs; s3::x /= rhs; s3::z /= rhs; return *this; }
-	};
-	struct YYX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::x); } };
-	struct YYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::y); } };
-	struct YYZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::z); } };
-	struct YZX : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::z, s3::x); }
-		const YZX& operator=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y = rhs.v.x; s3::z = t0; s3::x = t1; return *this; }
-		const YZX& operator+=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y += rhs.v.x; s3::z += t0; s3::x += t1; return *this; }
-		const YZX& operator-=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y -= rhs.v.x; s3::z -= t0; s3::x -= t1; return *this; }
-		const YZX& operator*=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y *= rhs.v.x; s3::z *= t0; s3::x *= t1; return *this; }
-		const YZX& operator/=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y /= rhs.v.x; s3::z /= t0; s3::x /= t1; return *this; }
-		const YZX& operator*=(const TYPE& rhs) { s3::y *= rhs; s3::z *= rhs; s3::x *= rhs; return *this; }
-		const YZX& operator/=(const TYPE& rhs) { s3::y /= rhs; s3::z /= rhs; s3::x /= rhs; return *this; }
-	};
-	struct YZY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::z, s3::y); } };
-	struct YZZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::z, s3::z); } };
-	struct ZXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::x, s3::x); } };
-	struct ZXY : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::x, s3::y); }
-		const ZXY& operator=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z = rhs.v.x; s3::x = t0; s3::y = t1; return *this; }
-		const ZXY& operator+=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z += rhs.v.x; s3::x += t0; s3::y += t1; return *this; }
-		const ZXY& operator-=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z -= rhs.v.x; s3::x -= t0; s3::y -= t1; return *this; }
-		const ZXY& operator*=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z *= rhs.v.x; s3::x *= t0; s3::y *= t1; return *this; }
-		const ZXY& operator/=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z /= rhs.v.x; s3::x /= t0; s3::y /= t1; return *this; }
-		const ZXY& operator*=(const TYPE& rhs) { s3::z *= rhs; s3::x *= rhs; s3::y *= rhs; return *this; }
-		const ZXY& operator/=(const TYPE& rhs) { s3::z /= rhs; s3::x /= rhs; s3::y /= rhs; return *this; }
-	};
-	struct ZXZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::x, s3::z); } };
-	struct ZYX : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::y, s3::x); }
-		const ZYX& operator=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z = rhs.v.x; s3::y = rhs.v.y; s3::x = t0; return *this; }
-		const ZYX& operator+=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z += rhs.v.x; s3::y += rhs.v.y; s3::x += t0; return *this; }
-		const ZYX& operator-=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z -= rhs.v.x; s3::y -= rhs.v.y; s3::x -= t0; return *this; }
-		const ZYX& operator*=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z *= rhs.v.x; s3::y *= rhs.v.y; s3::x *= t0; return *this; }
-		const ZYX& operator/=(const VECTOR3<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z /= rhs.v.x; s3::y /= rhs.v.y; s3::x /= t0; return *this; }
-		const ZYX& operator*=(const TYPE& rhs) { s3::z *= rhs; s3::y *= rhs; s3::x *= rhs; return *this; }
-		const ZYX& operator/=(const TYPE& rhs) { s3::z /= rhs; s3::y /= rhs; s3::x /= rhs; return *this; }
-	};
-	struct ZYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::y, s3::y); } };
-	struct ZYZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::y, s3::z); } };
-	struct ZZX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::z, s3::x); } };
-	struct ZZY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::z, s3::y); } };
-	struct ZZZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::z, s3::z); } };
-	struct XXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::x); } };
-	struct XXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::y); } };
-	struct XXXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::z); } };
-	struct XXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::x); } };
-	struct XXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::y); } };
-	struct XXYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::z); } };
-	struct XXZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::z, s4::x); } };
-	struct XXZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::z, s4::y); } };
-	struct XXZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::z, s4::z); } };
-	struct XYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::x); } };
-	struct XYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::y); } };
-	struct XYXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::z); } };
-	struct XYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::x); } };
-	struct XYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::y); } };
-	struct XYYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::z); } };
-	struct XYZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::z, s4::x); } };
-	struct XYZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::z, s4::y); } };
-	struct XYZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::z, s4::z); } };
-	struct XZXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::x, s4::x); } };
-	struct XZXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::x, s4::y); } };
-	struct XZXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::x, s4::z); } };
-	struct XZYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::y, s4::x); } };
-	struct XZYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::y, s4::y); } };
-	struct XZYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::y, s4::z); } };
-	struct XZZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::z, s4::x); } };
-	struct XZZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::z, s4::y); } };
-	struct XZZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::z, s4::z); } };
-	struct YXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::x); } };
-	struct YXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::y); } };
-	struct YXXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::z); } };
-	struct YXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::x); } };
-	struct YXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::y); } };
-	struct YXYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::z); } };
-	struct YXZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::z, s4::x); } };
-	struct YXZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::z, s4::y); } };
-	struct YXZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::z, s4::z); } };
-	struct YYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::x); } };
-	struct YYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::y); } };
-	struct YYXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::z); } };
-	struct YYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::x); } };
-	struct YYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::y); } };
-	struct YYYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::z); } };
-	struct YYZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::z, s4::x); } };
-	struct YYZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::z, s4::y); } };
-	struct YYZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::z, s4::z); } };
-	struct YZXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::x, s4::x); } };
-	struct YZXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::x, s4::y); } };
-	struct YZXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::x, s4::z); } };
-	struct YZYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::y, s4::x); } };
-	struct YZYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::y, s4::y); } };
-	struct YZYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::y, s4::z); } };
-	struct YZZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::z, s4::x); } };
-	struct YZZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::z, s4::y); } };
-	struct YZZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::z, s4::z); } };
-	struct ZXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::x, s4::x); } };
-	struct ZXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::x, s4::y); } };
-	struct ZXXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::x, s4::z); } };
-	struct ZXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::y, s4::x); } };
-	struct ZXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::y, s4::y); } };
-	struct ZXYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::y, s4::z); } };
-	struct ZXZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::z, s4::x); } };
-	struct ZXZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::z, s4::y); } };
-	struct ZXZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::z, s4::z); } };
-	struct ZYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::x, s4::x); } };
-	struct ZYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::x, s4::y); } };
-	struct ZYXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::x, s4::z); } };
-	struct ZYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::y, s4::x); } };
-	struct ZYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::y, s4::y); } };
-	struct ZYYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::y, s4::z); } };
-	struct ZYZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::z, s4::x); } };
-	struct ZYZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::z, s4::y); } };
-	struct ZYZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::z, s4::z); } };
-	struct ZZXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::x, s4::x); } };
-	struct ZZXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::x, s4::y); } };
-	struct ZZXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::x, s4::z); } };
-	struct ZZYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::y, s4::x); } };
-	struct ZZYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::y, s4::y); } };
-	struct ZZYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::y, s4::z); } };
-	struct ZZZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::z, s4::x); } };
-	struct ZZZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::z, s4::y); } };
-	struct ZZZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::z, s4::z); } };
-
-	// Length property
-	struct LENGTH
-	{
-	private:
-		TYPE x, y, z;
-		TYPE ApplyLength(const TYPE& curMag, const TYPE& newMag)
-		{
-			TYPE inverseScaledMagnitude = newMag / curMag;
-			x *= inverseScaledMagnitude;
-			y *= inverseScaledMagnitude;
-			z *= inverseScaledMagnitude;
-			return newMag;
-		}
-	public:
-		operator TYPE() const { return sqrt(x * x + y * y + z * z); }
-		TYPE operator=(const TYPE& rhs) { return ApplyLength((TYPE)(*this), rhs); }
-		TYPE operator+=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag + rhs); }
-		TYPE operator-=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag - rhs); }
-		TYPE operator*=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag * rhs); }
-		TYPE operator/=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag / rhs); }
-	};
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = sqrt((a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]) + (a.z[i] - b.z[i]) * (a.z[i] - b.z[i]));
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = sqrt((a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]) + (a.z[i] - b.z[i]) * (a.z[i] - b.z[i]));
+		out[i] = block0[0];
+	}
+}
 
-public:
-	VECTOR3() {}
-	VECTOR3(const TYPE& x, const TYPE& y, const TYPE& z) { v.x = x; v.y = y; v.z = z; }
-	VECTOR3(const VECTOR2<TYPE>& xy, const TYPE& z) { v.x = xy.x; v.y = xy.y; v.z = z; }
-	VECTOR3(const TYPE& x, const VECTOR2<TYPE>& yz) { v.x = x; v.y = yz.x; v.z = yz.y; }
-
-	// Swizzle variables
-	X x, r, s;
-	Y y, g, t;
-	Z z, b, p;
-	XX xx, rr, ss;
-	XY xy, rg, st;
-	XZ xz, rb, sp;
-	YX yx, gr, ts;
-	YY yy, gg, tt;
-	YZ yz, gb, tp;
-	ZX zx, br, ps;
-	ZY zy, bg, pt;
-	ZZ zz, bb, pp;
-	XXX xxx, rrr, sss;
-	XXY xxy, rrg, sst;
-	XXZ xxz, rrb, ssp;
-	XYX xyx, rgr, sts;
-	XYY xyy, rgg, stt;
-	XYZ xyz, rgb, stp;
-	XZX xzx, rbr, sps;
-	XZY xzy, rbg, spt;
-	XZZ xzz, rbb, spp;
-	YXX yxx, grr, tss;
-	YXY yxy, grg, tst;
-	YXZ yxz, grb, tsp;
-	YYX yyx, ggr, tts;
-	YYY yyy, ggg, ttt;
-	YYZ yyz, ggb, ttp;
-	YZX yzx, gbr, tps;
-	YZY yzy, gbg, tpt;
-	YZZ yzz, gbb, tpp;
-	ZXX zxx, brr, pss;
-	ZXY zxy, brg, pst;
-	ZXZ zxz, brb, psp;
-	ZYX zyx, bgr, pts;
-	ZYY zyy, bgg, ptt;
-	ZYZ zyz, bgb, ptp;
-	ZZX zzx, bbr, pps;
-	ZZY zzy, bbg, ppt;
-	ZZZ zzz, bbb, ppp;
-	XXXX xxxx, rrrr, ssss;
-	XXXY xxxy, rrrg, ssst;
-	XXXZ xxxz, rrrb, sssp;
-	XXYX xxyx, rrgr, ssts;
-	XXYY xxyy, rrgg, sstt;
-	XXYZ xxyz, rrgb, sstp;
-	XXZX xxzx, rrbr, ssps;
-	XXZY xxzy, rrbg, sspt;
-	XXZZ xxzz, rrbb, sspp;
-	XYXX xyxx, rgrr, stss;
-	XYXY xyxy, rgrg, stst;
-	XYXZ xyxz, rgrb, stsp;
-	XYYX xyyx, rggr, stts;
-	XYYY xyyy, rggg, sttt;
-	XYYZ xyyz, rggb, sttp;
-	XYZX xyzx, rgbr, stps;
-	XYZY xyzy, rgbg, stpt;
-	XYZZ xyzz, rgbb, stpp;
-	XZXX xzxx, rbrr, spss;
-	XZXY xzxy, rbrg, spst;
-	XZXZ xzxz, rbrb, spsp;
-	XZYX xzyx, rbgr, spts;
-	XZYY xzyy, rbgg, sptt;
-	XZYZ xzyz, rbgb, sptp;
-	XZZX xzzx, rbbr, spps;
-	XZZY xzzy, rbbg, sppt;
-	XZZZ xzzz, rbbb, sppp;
-	YXXX yxxx, grrr, tsss;
-	YXXY yxxy, grrg, tsst;
-	YXXZ yxxz, grrb, tssp;
-	YXYX yxyx, grgr, tsts;
-	YXYY yxyy, grgg, tstt;
-	YXYZ yxyz, grgb, tstp;
-	YXZX yxzx, grbr, tsps;
-	YXZY yxzy, grbg, tspt;
-	YXZZ yxzz, grbb, tspp;
-	YYXX yyxx, ggrr, ttss;
-	YYXY yyxy, ggrg, ttst;
-	YYXZ yyxz, ggrb, ttsp;
-	YYYX yyyx, gggr, ttts;
-	YYYY yyyy, gggg, tttt;
-	YYYZ yyyz, gggb, tttp;
-	YYZX yyzx, ggbr, ttps;
-	YYZY yyzy, ggbg, ttpt;
-	YYZZ yyzz, ggbb, ttpp;
-	YZXX yzxx, gbrr, tpss;
-	YZXY yzxy, gbrg, tpst;
-	YZXZ yzxz, gbrb, tpsp;
-	YZYX yzyx, gbgr, tpts;
-	YZYY yzyy, gbgg, tptt;
-	YZYZ yzyz, gbgb, tptp;
-	YZZX yzzx, gbbr, tpps;
-	YZZY yzzy, gbbg, tppt;
-	YZZZ yzzz, gbbb, tppp;
-	ZXXX zxxx, brrr, psss;
-	ZXXY zxxy, brrg, psst;
-	ZXXZ zxxz, brrb, pssp;
-	ZXYX zxyx, brgr, psts;
-	ZXYY zxyy, brgg, pstt;
-	ZXYZ zxyz, brgb, pstp;
-	ZXZX zxzx, brbr, psps;
-	ZXZY zxzy, brbg, pspt;
-	ZXZZ zxzz, brbb, pspp;
-	ZYXX zyxx, bgrr, ptss;
-	ZYXY zyxy, bgrg, ptst;
-	ZYXZ zyxz, bgrb, ptsp;
-	ZYYX zyyx, bggr, ptts;
-	ZYYY zyyy, bggg, pttt;
-	ZYYZ zyyz, bggb, pttp;
-	ZYZX zyzx, bgbr, ptps;
-	ZYZY zyzy, bgbg, ptpt;
-	ZYZZ zyzz, bgbb, ptpp;
-	ZZXX zzxx, bbrr, ppss;
-	ZZXY zzxy, bbrg, ppst;
-	ZZXZ zzxz, bbrb, ppsp;
-	ZZYX zzyx, bbgr, ppts;
-	ZZYY zzyy, bbgg, pptt;
-	ZZYZ zzyz, bbgb, pptp;
-	ZZZX zzzx, bbbr, ppps;
-	ZZZY zzzy, bbbg, pppt;
-	ZZZZ zzzz, bbbb, pppp;
-
-	// Length property
-	LENGTH Length;
+// 3D batch DistanceSquared()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa3D< typename A::PARENT >, typename EnableIf< IsSoa3D< typename B::PARENT >, void >::type >::type DistanceSquared(TYPE* out, const A& a, const B& b) { DistanceSquared(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void DistanceSquared(TYPE* out, const VECTOR3_SOA_VIEW<TYPE>& a, const VECTOR3_SOA_VIEW<TYPE>& b)
+{
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = (a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]) + (a.z[i] - b.z[i]) * (a.z[i] - b.z[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = (a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]) + (a.z[i] - b.z[i]) * (a.z[i] - b.z[i]);
+		out[i] = block0[0];
+	}
+}
 
-	// Assignment operators (default for = is fine)
-	const VECTOR3& operator+=(const VECTOR3& rhs) { v.x += rhs.v.x; v.y += rhs.v.y; v.z += rhs.v.z; return *this; }
-	const VECTOR3& operator-=(const VECTOR3& rhs) { v.x -= rhs.v.x; v.y -= rhs.v.y; v.z -= rhs.v.z; return *this; }
-	const VECTOR3& operator*=(const VECTOR3& rhs) { v.x *= rhs.v.x; v.y *= rhs.v.y; v.z *= rhs.v.z; return *this; }
-	const VECTOR3& operator/=(const VECTOR3& rhs) { v.x /= rhs.v.x; v.y /= rhs.v.y; v.z /= rhs.v.z; return *this; }
-	const VECTOR3& operator*=(const TYPE& rhs) { v.x *= rhs; v.y *= rhs; v.z *= rhs; return *this; }
-	const VECTOR3& operator/=(const TYPE& rhs) { v.x /= rhs; v.y /= rhs; v.z /= rhs; return *this; }
 
-	// Array notation access
-	const TYPE& operator[](const unsigned& index)
+
+template <typename TYPE>
+union VECTOR4_SOA
+{
+private:
+	struct { TYPE *x, *y, *z, *w; unsigned count; unsigned capacity; } v;
+
+	void Allocate(const unsigned& count)
 	{
-		if (index == 0) { return v.x; }
-		else if (index == 1) { return v.y; }
-		else if (index == 2) { return v.z; }
-		else { cout << "Fatal Error: Attempted out of bounds bracket access of 3D vector." << endl << " - Vector: " << *this << endl << " - Index:  " << index << endl; exit(-1); }
+		v.count = count;
+		v.capacity = ((count + SOA_LANES - 1) / SOA_LANES) * SOA_LANES;
+		TYPE* block = (TYPE*)AlignedAllocate(v.capacity * 4 * sizeof(TYPE));
+		memset(block, 0, v.capacity * 4 * sizeof(TYPE));
+		v.x = block + v.capacity * 0;
+		v.y = block + v.capacity * 1;
+		v.z = block + v.capacity * 2;
+		v.w = block + v.capacity * 3;
 	}
 
-	// Overload for cout
-	friend ostream& operator<<(ostream& os, const VECTOR3<TYPE>& printVector)
+public:
+	typedef VECTOR4_SOA_VIEW<TYPE> PARENT;
+
+	VECTOR4_SOA() { v.count = 0; v.capacity = 0; v.x = v.y = v.z = v.w = 0; }
+	explicit VECTOR4_SOA(const unsigned& count) { Allocate(count); }
+	VECTOR4_SOA(const VECTOR4<TYPE>* vectors, const unsigned& count) { Allocate(count); for (unsigned i = 0; i < count; i++) { Set(i, vectors[i]); } }
+	VECTOR4_SOA(const VECTOR4_SOA& other) { Allocate(other.v.count); memcpy(v.x, other.v.x, v.capacity * 4 * sizeof(TYPE)); }
+	~VECTOR4_SOA() { AlignedFree(v.x); }
+
+	const VECTOR4_SOA& operator=(const VECTOR4_SOA& rhs)
 	{
-		os << "(" << printVector.v.x << ", " << printVector.v.y << ", " << printVector.v.z << ")";
-		return os;
+		if (this != &rhs)
+		{
+			AlignedFree(v.x);
+			Allocate(rhs.v.count);
+			memcpy(v.x, rhs.v.x, v.capacity * 4 * sizeof(TYPE));
+		}
+		return *this;
 	}
 
-	// Negation
-	VECTOR3 operator-() const { return VECTOR3(-v.x, -v.y, -v.z); }
-
-	void Normalize() { *this /= this->Length; }
+	// Swizzle variables (views onto the same lanes, nothing is copied)
+	SOA_SWIZZLE<TYPE, 4, 0, 0> xx, rr, ss;
+	SOA_SWIZZLE<TYPE, 4, 0, 1> xy, rg, st;
+	SOA_SWIZZLE<TYPE, 4, 0, 2> xz, rb, sp;
+	SOA_SWIZZLE<TYPE, 4, 0, 3> xw, ra, sq;
+	SOA_SWIZZLE<TYPE, 4, 1, 0> yx, gr, ts;
+	SOA_SWIZZLE<TYPE, 4, 1, 1> yy, gg, tt;
+	SOA_SWIZZLE<TYPE, 4, 1, 2> yz, gb, tp;
+	SOA_SWIZZLE<TYPE, 4, 1, 3> yw, ga, tq;
+	SOA_SWIZZLE<TYPE, 4, 2, 0> zx, br, ps;
+	SOA_SWIZZLE<TYPE, 4, 2, 1> zy, bg, pt;
+	SOA_SWIZZLE<TYPE, 4, 2, 2> zz, bb, pp;
+	SOA_SWIZZLE<TYPE, 4, 2, 3> zw, ba, pq;
+	SOA_SWIZZLE<TYPE, 4, 3, 0> wx, ar, qs;
+	SOA_SWIZZLE<TYPE, 4, 3, 1> wy, ag, qt;
+	SOA_SWIZZLE<TYPE, 4, 3, 2> wz, ab, qp;
+	SOA_SWIZZLE<TYPE, 4, 3, 3> ww, aa, qq;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 0> xxx, rrr, sss;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 1> xxy, rrg, sst;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 2> xxz, rrb, ssp;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 3> xxw, rra, ssq;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 0> xyx, rgr, sts;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 1> xyy, rgg, stt;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 2> xyz, rgb, stp;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 3> xyw, rga, stq;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 0> xzx, rbr, sps;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 1> xzy, rbg, spt;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 2> xzz, rbb, spp;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 3> xzw, rba, spq;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 0> xwx, rar, sqs;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 1> xwy, rag, sqt;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 2> xwz, rab, sqp;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 3> xww, raa, sqq;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 0> yxx, grr, tss;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 1> yxy, grg, tst;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 2> yxz, grb, tsp;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 3> yxw, gra, tsq;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 0> yyx, ggr, tts;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 1> yyy, ggg, ttt;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 2> yyz, ggb, ttp;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 3> yyw, gga, ttq;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 0> yzx, gbr, tps;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 1> yzy, gbg, tpt;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 2> yzz, gbb, tpp;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 3> yzw, gba, tpq;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 0> ywx, gar, tqs;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 1> ywy, gag, tqt;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 2> ywz, gab, tqp;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 3> yww, gaa, tqq;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 0> zxx, brr, pss;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 1> zxy, brg, pst;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 2> zxz, brb, psp;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 3> zxw, bra, psq;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 0> zyx, bgr, pts;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 1> zyy, bgg, ptt;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 2> zyz, bgb, ptp;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 3> zyw, bga, ptq;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 0> zzx, bbr, pps;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 1> zzy, bbg, ppt;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 2> zzz, bbb, ppp;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 3> zzw, bba, ppq;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 0> zwx, bar, pqs;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 1> zwy, bag, pqt;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 2> zwz, bab, pqp;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 3> zww, baa, pqq;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 0> wxx, arr, qss;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 1> wxy, arg, qst;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 2> wxz, arb, qsp;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 3> wxw, ara, qsq;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 0> wyx, agr, qts;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 1> wyy, agg, qtt;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 2> wyz, agb, qtp;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 3> wyw, aga, qtq;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 0> wzx, abr, qps;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 1> wzy, abg, qpt;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 2> wzz, abb, qpp;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 3> wzw, aba, qpq;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 0> wwx, aar, qqs;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 1> wwy, aag, qqt;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 2> wwz, aab, qqp;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 3> www, aaa, qqq;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 0, 0> xxxx, rrrr, ssss;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 0, 1> xxxy, rrrg, ssst;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 0, 2> xxxz, rrrb, sssp;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 0, 3> xxxw, rrra, sssq;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 1, 0> xxyx, rrgr, ssts;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 1, 1> xxyy, rrgg, sstt;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 1, 2> xxyz, rrgb, sstp;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 1, 3> xxyw, rrga, sstq;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 2, 0> xxzx, rrbr, ssps;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 2, 1> xxzy, rrbg, sspt;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 2, 2> xxzz, rrbb, sspp;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 2, 3> xxzw, rrba, sspq;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 3, 0> xxwx, rrar, ssqs;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 3, 1> xxwy, rrag, ssqt;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 3, 2> xxwz, rrab, ssqp;
+	SOA_SWIZZLE<TYPE, 4, 0, 0, 3, 3> xxww, rraa, ssqq;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 0, 0> xyxx, rgrr, stss;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 0, 1> xyxy, rgrg, stst;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 0, 2> xyxz, rgrb, stsp;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 0, 3> xyxw, rgra, stsq;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 1, 0> xyyx, rggr, stts;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 1, 1> xyyy, rggg, sttt;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 1, 2> xyyz, rggb, sttp;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 1, 3> xyyw, rgga, sttq;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 2, 0> xyzx, rgbr, stps;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 2, 1> xyzy, rgbg, stpt;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 2, 2> xyzz, rgbb, stpp;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 2, 3> xyzw, rgba, stpq;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 3, 0> xywx, rgar, stqs;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 3, 1> xywy, rgag, stqt;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 3, 2> xywz, rgab, stqp;
+	SOA_SWIZZLE<TYPE, 4, 0, 1, 3, 3> xyww, rgaa, stqq;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 0, 0> xzxx, rbrr, spss;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 0, 1> xzxy, rbrg, spst;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 0, 2> xzxz, rbrb, spsp;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 0, 3> xzxw, rbra, spsq;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 1, 0> xzyx, rbgr, spts;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 1, 1> xzyy, rbgg, sptt;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 1, 2> xzyz, rbgb, sptp;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 1, 3> xzyw, rbga, sptq;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 2, 0> xzzx, rbbr, spps;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 2, 1> xzzy, rbbg, sppt;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 2, 2> xzzz, rbbb, sppp;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 2, 3> xzzw, rbba, sppq;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 3, 0> xzwx, rbar, spqs;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 3, 1> xzwy, rbag, spqt;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 3, 2> xzwz, rbab, spqp;
+	SOA_SWIZZLE<TYPE, 4, 0, 2, 3, 3> xzww, rbaa, spqq;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 0, 0> xwxx, rarr, sqss;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 0, 1> xwxy, rarg, sqst;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 0, 2> xwxz, rarb, sqsp;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 0, 3> xwxw, rara, sqsq;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 1, 0> xwyx, ragr, sqts;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 1, 1> xwyy, ragg, sqtt;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 1, 2> xwyz, ragb, sqtp;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 1, 3> xwyw, raga, sqtq;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 2, 0> xwzx, rabr, sqps;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 2, 1> xwzy, rabg, sqpt;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 2, 2> xwzz, rabb, sqpp;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 2, 3> xwzw, raba, sqpq;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 3, 0> xwwx, raar, sqqs;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 3, 1> xwwy, raag, sqqt;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 3, 2> xwwz, raab, sqqp;
+	SOA_SWIZZLE<TYPE, 4, 0, 3, 3, 3> xwww, raaa, sqqq;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 0, 0> yxxx, grrr, tsss;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 0, 1> yxxy, grrg, tsst;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 0, 2> yxxz, grrb, tssp;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 0, 3> yxxw, grra, tssq;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 1, 0> yxyx, grgr, tsts;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 1, 1> yxyy, grgg, tstt;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 1, 2> yxyz, grgb, tstp;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 1, 3> yxyw, grga, tstq;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 2, 0> yxzx, grbr, tsps;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 2, 1> yxzy, grbg, tspt;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 2, 2> yxzz, grbb, tspp;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 2, 3> yxzw, grba, tspq;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 3, 0> yxwx, grar, tsqs;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 3, 1> yxwy, grag, tsqt;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 3, 2> yxwz, grab, tsqp;
+	SOA_SWIZZLE<TYPE, 4, 1, 0, 3, 3> yxww, graa, tsqq;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 0, 0> yyxx, ggrr, ttss;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 0, 1> yyxy, ggrg, ttst;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 0, 2> yyxz, ggrb, ttsp;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 0, 3> yyxw, ggra, ttsq;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 1, 0> yyyx, gggr, ttts;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 1, 1> yyyy, gggg, tttt;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 1, 2> yyyz, gggb, tttp;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 1, 3> yyyw, ggga, tttq;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 2, 0> yyzx, ggbr, ttps;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 2, 1> yyzy, ggbg, ttpt;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 2, 2> yyzz, ggbb, ttpp;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 2, 3> yyzw, ggba, ttpq;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 3, 0> yywx, ggar, ttqs;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 3, 1> yywy, ggag, ttqt;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 3, 2> yywz, ggab, ttqp;
+	SOA_SWIZZLE<TYPE, 4, 1, 1, 3, 3> yyww, ggaa, ttqq;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 0, 0> yzxx, gbrr, tpss;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 0, 1> yzxy, gbrg, tpst;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 0, 2> yzxz, gbrb, tpsp;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 0, 3> yzxw, gbra, tpsq;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 1, 0> yzyx, gbgr, tpts;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 1, 1> yzyy, gbgg, tptt;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 1, 2> yzyz, gbgb, tptp;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 1, 3> yzyw, gbga, tptq;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 2, 0> yzzx, gbbr, tpps;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 2, 1> yzzy, gbbg, tppt;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 2, 2> yzzz, gbbb, tppp;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 2, 3> yzzw, gbba, tppq;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 3, 0> yzwx, gbar, tpqs;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 3, 1> yzwy, gbag, tpqt;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 3, 2> yzwz, gbab, tpqp;
+	SOA_SWIZZLE<TYPE, 4, 1, 2, 3, 3> yzww, gbaa, tpqq;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 0, 0> ywxx, garr, tqss;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 0, 1> ywxy, garg, tqst;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 0, 2> ywxz, garb, tqsp;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 0, 3> ywxw, gara, tqsq;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 1, 0> ywyx, gagr, tqts;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 1, 1> ywyy, gagg, tqtt;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 1, 2> ywyz, gagb, tqtp;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 1, 3> ywyw, gaga, tqtq;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 2, 0> ywzx, gabr, tqps;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 2, 1> ywzy, gabg, tqpt;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 2, 2> ywzz, gabb, tqpp;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 2, 3> ywzw, gaba, tqpq;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 3, 0> ywwx, gaar, tqqs;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 3, 1> ywwy, gaag, tqqt;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 3, 2> ywwz, gaab, tqqp;
+	SOA_SWIZZLE<TYPE, 4, 1, 3, 3, 3> ywww, gaaa, tqqq;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 0, 0> zxxx, brrr, psss;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 0, 1> zxxy, brrg, psst;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 0, 2> zxxz, brrb, pssp;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 0, 3> zxxw, brra, pssq;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 1, 0> zxyx, brgr, psts;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 1, 1> zxyy, brgg, pstt;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 1, 2> zxyz, brgb, pstp;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 1, 3> zxyw, brga, pstq;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 2, 0> zxzx, brbr, psps;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 2, 1> zxzy, brbg, pspt;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 2, 2> zxzz, brbb, pspp;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 2, 3> zxzw, brba, pspq;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 3, 0> zxwx, brar, psqs;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 3, 1> zxwy, brag, psqt;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 3, 2> zxwz, brab, psqp;
+	SOA_SWIZZLE<TYPE, 4, 2, 0, 3, 3> zxww, braa, psqq;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 0, 0> zyxx, bgrr, ptss;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 0, 1> zyxy, bgrg, ptst;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 0, 2> zyxz, bgrb, ptsp;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 0, 3> zyxw, bgra, ptsq;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 1, 0> zyyx, bggr, ptts;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 1, 1> zyyy, bggg, pttt;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 1, 2> zyyz, bggb, pttp;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 1, 3> zyyw, bgga, pttq;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 2, 0> zyzx, bgbr, ptps;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 2, 1> zyzy, bgbg, ptpt;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 2, 2> zyzz, bgbb, ptpp;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 2, 3> zyzw, bgba, ptpq;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 3, 0> zywx, bgar, ptqs;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 3, 1> zywy, bgag, ptqt;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 3, 2> zywz, bgab, ptqp;
+	SOA_SWIZZLE<TYPE, 4, 2, 1, 3, 3> zyww, bgaa, ptqq;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 0, 0> zzxx, bbrr, ppss;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 0, 1> zzxy, bbrg, ppst;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 0, 2> zzxz, bbrb, ppsp;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 0, 3> zzxw, bbra, ppsq;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 1, 0> zzyx, bbgr, ppts;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 1, 1> zzyy, bbgg, pptt;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 1, 2> zzyz, bbgb, pptp;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 1, 3> zzyw, bbga, pptq;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 2, 0> zzzx, bbbr, ppps;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 2, 1> zzzy, bbbg, pppt;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 2, 2> zzzz, bbbb, pppp;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 2, 3> zzzw, bbba, pppq;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 3, 0> zzwx, bbar, ppqs;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 3, 1> zzwy, bbag, ppqt;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 3, 2> zzwz, bbab, ppqp;
+	SOA_SWIZZLE<TYPE, 4, 2, 2, 3, 3> zzww, bbaa, ppqq;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 0, 0> zwxx, barr, pqss;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 0, 1> zwxy, barg, pqst;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 0, 2> zwxz, barb, pqsp;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 0, 3> zwxw, bara, pqsq;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 1, 0> zwyx, bagr, pqts;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 1, 1> zwyy, bagg, pqtt;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 1, 2> zwyz, bagb, pqtp;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 1, 3> zwyw, baga, pqtq;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 2, 0> zwzx, babr, pqps;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 2, 1> zwzy, babg, pqpt;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 2, 2> zwzz, babb, pqpp;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 2, 3> zwzw, baba, pqpq;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 3, 0> zwwx, baar, pqqs;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 3, 1> zwwy, baag, pqqt;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 3, 2> zwwz, baab, pqqp;
+	SOA_SWIZZLE<TYPE, 4, 2, 3, 3, 3> zwww, baaa, pqqq;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 0, 0> wxxx, arrr, qsss;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 0, 1> wxxy, arrg, qsst;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 0, 2> wxxz, arrb, qssp;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 0, 3> wxxw, arra, qssq;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 1, 0> wxyx, argr, qsts;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 1, 1> wxyy, argg, qstt;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 1, 2> wxyz, argb, qstp;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 1, 3> wxyw, arga, qstq;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 2, 0> wxzx, arbr, qsps;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 2, 1> wxzy, arbg, qspt;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 2, 2> wxzz, arbb, qspp;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 2, 3> wxzw, arba, qspq;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 3, 0> wxwx, arar, qsqs;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 3, 1> wxwy, arag, qsqt;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 3, 2> wxwz, arab, qsqp;
+	SOA_SWIZZLE<TYPE, 4, 3, 0, 3, 3> wxww, araa, qsqq;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 0, 0> wyxx, agrr, qtss;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 0, 1> wyxy, agrg, qtst;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 0, 2> wyxz, agrb, qtsp;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 0, 3> wyxw, agra, qtsq;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 1, 0> wyyx, aggr, qtts;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 1, 1> wyyy, aggg, qttt;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 1, 2> wyyz, aggb, qttp;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 1, 3> wyyw, agga, qttq;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 2, 0> wyzx, agbr, qtps;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 2, 1> wyzy, agbg, qtpt;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 2, 2> wyzz, agbb, qtpp;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 2, 3> wyzw, agba, qtpq;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 3, 0> wywx, agar, qtqs;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 3, 1> wywy, agag, qtqt;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 3, 2> wywz, agab, qtqp;
+	SOA_SWIZZLE<TYPE, 4, 3, 1, 3, 3> wyww, agaa, qtqq;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 0, 0> wzxx, abrr, qpss;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 0, 1> wzxy, abrg, qpst;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 0, 2> wzxz, abrb, qpsp;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 0, 3> wzxw, abra, qpsq;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 1, 0> wzyx, abgr, qpts;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 1, 1> wzyy, abgg, qptt;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 1, 2> wzyz, abgb, qptp;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 1, 3> wzyw, abga, qptq;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 2, 0> wzzx, abbr, qpps;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 2, 1> wzzy, abbg, qppt;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 2, 2> wzzz, abbb, qppp;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 2, 3> wzzw, abba, qppq;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 3, 0> wzwx, abar, qpqs;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 3, 1> wzwy, abag, qpqt;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 3, 2> wzwz, abab, qpqp;
+	SOA_SWIZZLE<TYPE, 4, 3, 2, 3, 3> wzww, abaa, qpqq;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 0, 0> wwxx, aarr, qqss;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 0, 1> wwxy, aarg, qqst;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 0, 2> wwxz, aarb, qqsp;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 0, 3> wwxw, aara, qqsq;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 1, 0> wwyx, aagr, qqts;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 1, 1> wwyy, aagg, qqtt;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 1, 2> wwyz, aagb, qqtp;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 1, 3> wwyw, aaga, qqtq;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 2, 0> wwzx, aabr, qqps;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 2, 1> wwzy, aabg, qqpt;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 2, 2> wwzz, aabb, qqpp;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 2, 3> wwzw, aaba, qqpq;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 3, 0> wwwx, aaar, qqqs;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 3, 1> wwwy, aaag, qqqt;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 3, 2> wwwz, aaab, qqqp;
+	SOA_SWIZZLE<TYPE, 4, 3, 3, 3, 3> wwww, aaaa, qqqq;
+
+	// Element access
+	unsigned Count() const { return v.count; }
+	VECTOR4<TYPE> Get(const unsigned& index) const { return VECTOR4_SOA_VIEW<TYPE>(*this).Get(index); }
+	void Set(const unsigned& index, const VECTOR4<TYPE>& vector) { VECTOR4_SOA_VIEW<TYPE>(*this).Set(index, vector); }
+	void CopyTo(VECTOR4<TYPE>* vectors) const { for (unsigned i = 0; i < v.count; i++) { vectors[i] = Get(i); } }
+
+	// Lane access
+	operator VECTOR4_SOA_VIEW<TYPE>() const { return VECTOR4_SOA_VIEW<TYPE>(v.x, v.y, v.z, v.w, v.count); }
 };
 
-// 3D ToString()
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, string >::type ToString(const SWIZZLE& printSwizzle) { return ToString(typename SWIZZLE::PARENT(printSwizzle)); }
-template <typename TYPE> string ToString(const VECTOR3<TYPE>& printVector)
+// 4D batch Negate()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Negate(const OUT& out, const A& a) { Negate(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Negate(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a)
 {
-	std::ostringstream buffer;
-	buffer << "(" << printVector.x << ", " << printVector.y << ", " << printVector.z << ")";
-	return buffer.str();
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			block0[lane] = -aX;
+			block1[lane] = -aY;
+			block2[lane] = -aZ;
+			block3[lane] = aW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		block0[0] = -aX;
+		block1[0] = -aY;
+		block2[0] = -aZ;
+		block3[0] = aW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Negate [-]
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const SWIZZLE& toNegate)
+// 4D batch Add(): Component-wise [+]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Add(const OUT& out, const A& a, const B& b) { Add(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Add(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return -(typename SWIZZLE::PARENT(toNegate));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+			block0[lane] = aX + bX;
+			block1[lane] = aY + bY;
+			block2[lane] = aZ + bZ;
+			block3[lane] = aW + bW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+		block0[0] = aX + bX;
+		block1[0] = aY + bY;
+		block2[0] = aZ + bZ;
+		block3[0] = aW + bW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Addition [+]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator+(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) + typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator+(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) + rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator+(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs + typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR3<TYPE> operator+(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Subtract(): Component-wise [-]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Subtract(const OUT& out, const A& a, const B& b) { Subtract(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Subtract(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR3<TYPE>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+			block0[lane] = aX - bX;
+			block1[lane] = aY - bY;
+			block2[lane] = aZ - bZ;
+			block3[lane] = aW - bW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+		block0[0] = aX - bX;
+		block1[0] = aY - bY;
+		block2[0] = aZ - bZ;
+		block3[0] = aW - bW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Subtraction [-]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator-(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) - typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) - rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs - typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR3<TYPE> operator-(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Multiply(): Component-wise [*]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Multiply(const OUT& out, const A& a, const B& b) { Multiply(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Multiply(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR3<TYPE>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+			block0[lane] = aX * bX;
+			block1[lane] = aY * bY;
+			block2[lane] = aZ * bZ;
+			block3[lane] = aW * bW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+		block0[0] = aX * bX;
+		block1[0] = aY * bY;
+		block2[0] = aZ * bZ;
+		block3[0] = aW * bW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Multiplication [*]: Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator*(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) * typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) * rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR3<TYPE> operator*(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Divide(): Component-wise [/]
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Divide(const OUT& out, const A& a, const B& b) { Divide(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Divide(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR3<TYPE>(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+			block0[lane] = aX / bX;
+			block1[lane] = aY / bY;
+			block2[lane] = aZ / bZ;
+			block3[lane] = aW / bW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+		block0[0] = aX / bX;
+		block1[0] = aY / bY;
+		block2[0] = aZ / bZ;
+		block3[0] = aW / bW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Division [/]: Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator/(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) / typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) / rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs / typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR3<TYPE> operator/(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Multiply(): Scalar [*]
+template <typename OUT, typename A> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Multiply(const OUT& out, const A& a, const typename ScalarType< typename ComponentType< typename A::PARENT >::type >::type& scalar) { Multiply(typename OUT::PARENT(out), typename A::PARENT(a), scalar); }
+template <typename TYPE> void Multiply(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const typename ScalarType<TYPE>::type& scalar)
 {
-	return VECTOR3<TYPE>(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			block0[lane] = aX * scalar;
+			block1[lane] = aY * scalar;
+			block2[lane] = aZ * scalar;
+			block3[lane] = aW * scalar;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		block0[0] = aX * scalar;
+		block1[0] = aY * scalar;
+		block2[0] = aZ * scalar;
+		block3[0] = aW * scalar;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Multiplication [*]: Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SWIZZLE& lhs, const SCALAR_TYPE& rhs) { return typename SWIZZLE::PARENT(lhs) * rhs; }
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SCALAR_TYPE& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR3<TYPE> operator*(const VECTOR3<TYPE>& lhs, const SCALAR_TYPE& rhs)
+// 4D batch Divide(): Scalar [/]
+template <typename OUT, typename A> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Divide(const OUT& out, const A& a, const typename ScalarType< typename ComponentType< typename A::PARENT >::type >::type& scalar) { Divide(typename OUT::PARENT(out), typename A::PARENT(a), scalar); }
+template <typename TYPE> void Divide(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const typename ScalarType<TYPE>::type& scalar)
 {
-	return VECTOR3<TYPE>(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			block0[lane] = aX / scalar;
+			block1[lane] = aY / scalar;
+			block2[lane] = aZ / scalar;
+			block3[lane] = aW / scalar;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		block0[0] = aX / scalar;
+		block1[0] = aY / scalar;
+		block2[0] = aZ / scalar;
+		block3[0] = aW / scalar;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
-template <typename TYPE> VECTOR3<TYPE> operator*(const SCALAR_TYPE& lhs, const VECTOR3<TYPE>& rhs)
+
+// 4D batch Normalize()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Normalize(const OUT& out, const A& a) { Normalize(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Normalize(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a)
 {
-	return VECTOR3<TYPE>(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			TYPE length = sqrt(aX * aX + aY * aY + aZ * aZ);
+			block0[lane] = aX / length;
+			block1[lane] = aY / length;
+			block2[lane] = aZ / length;
+			block3[lane] = aW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		TYPE length = sqrt(aX * aX + aY * aY + aZ * aZ);
+		block0[0] = aX / length;
+		block1[0] = aY / length;
+		block2[0] = aZ / length;
+		block3[0] = aW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Division [/]: Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SWIZZLE& lhs, const SCALAR_TYPE& rhs) { return typename SWIZZLE::PARENT(lhs) / rhs; }
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SCALAR_TYPE& lhs, const SWIZZLE& rhs) { return lhs / typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR3<TYPE> operator/(const VECTOR3<TYPE>& lhs, const SCALAR_TYPE& rhs)
+// 4D batch Dot()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type Dot(TYPE* out, const A& a, const B& b) { Dot(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Dot(TYPE* out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR3<TYPE>(lhs.x / rhs, lhs.y / rhs, lhs.z / rhs);
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+		out[i] = block0[0];
+	}
 }
-template <typename TYPE> VECTOR3<TYPE> operator/(const SCALAR_TYPE& lhs, const VECTOR3<TYPE>& rhs)
+
+// 4D batch Cross()
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Cross(const OUT& out, const A& a, const B& b) { Cross(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Cross(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return VECTOR3<TYPE>(lhs / rhs.x, lhs / rhs.y, lhs / rhs.z);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+			block0[lane] = aY * bZ - aZ * bY;
+			block1[lane] = aZ * bX - aX * bZ;
+			block2[lane] = aX * bY - aY * bX;
+			block3[lane] = aW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i];
+		block0[0] = aY * bZ - aZ * bY;
+		block1[0] = aZ * bX - aX * bZ;
+		block2[0] = aX * bY - aY * bX;
+		block3[0] = aW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Equal To [==]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator==(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) == typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator==(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) == rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator==(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs == typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator==(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Project()
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Project(const OUT& out, const A& projectThis, const B& ontoThis) { Project(typename OUT::PARENT(out), typename A::PARENT(projectThis), typename B::PARENT(ontoThis)); }
+template <typename TYPE> void Project(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& projectThis, const VECTOR4_SOA_VIEW<TYPE>& ontoThis)
 {
-	return !(lhs.x != rhs.x || lhs.y != rhs.y || lhs.z != rhs.z);
+	const VECTOR4_SOA_VIEW<TYPE>& a = projectThis;
+	const VECTOR4_SOA_VIEW<TYPE>& b = ontoThis;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+			TYPE scale = (aX * bX + aY * bY + aZ * bZ) / (bX * bX + bY * bY + bZ * bZ);
+			block0[lane] = scale * bX;
+			block1[lane] = scale * bY;
+			block2[lane] = scale * bZ;
+			block3[lane] = bW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+		TYPE scale = (aX * bX + aY * bY + aZ * bZ) / (bX * bX + bY * bY + bZ * bZ);
+		block0[0] = scale * bX;
+		block1[0] = scale * bY;
+		block2[0] = scale * bZ;
+		block3[0] = bW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Not Equal To [!=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator!=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) != typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator!=(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) != rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator!=(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs != typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator!=(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Rotate()
+template <typename OUT, typename A, typename TYPE> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Rotate(const OUT& out, const A& a, const VECTOR4<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), rotationAxis, radians); }
+template <typename TYPE> void Rotate(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians)
 {
-	return lhs.x != rhs.x || lhs.y != rhs.y || lhs.z != rhs.z;
+	Rotate(out, a, QUATERNION<TYPE>(rotationAxis.xyz, radians));
 }
 
-// 3D AlmostEqual()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type AlmostEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqual((typename SWIZZLE0::PARENT(lhs)), (typename SWIZZLE1::PARENT(rhs))); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return AlmostEqual((typename SWIZZLE::PARENT(lhs)), rhs); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqual(lhs, (typename SWIZZLE::PARENT(rhs))); }
-template <typename TYPE> bool AlmostEqual(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Lerp()
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Lerp(const OUT& out, const A& start, const B& end, const typename RealType< typename ComponentType< typename A::PARENT >::type >::type& delta) { Lerp(typename OUT::PARENT(out), typename A::PARENT(start), typename B::PARENT(end), delta); }
+template <typename TYPE> void Lerp(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& start, const VECTOR4_SOA_VIEW<TYPE>& end, const typename RealType<TYPE>::type& delta)
 {
-	return fabs(lhs.x - rhs.x) < COMPARISON_EPSILON && fabs(lhs.y - rhs.y) < COMPARISON_EPSILON && fabs(lhs.z - rhs.z) < COMPARISON_EPSILON;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= start.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE startX = start.x[i], startY = start.y[i], startZ = start.z[i], startW = start.w[i];
+			TYPE endX = end.x[i], endY = end.y[i], endZ = end.z[i], endW = end.w[i];
+			block0[lane] = startX + delta * (endX - startX);
+			block1[lane] = startY + delta * (endY - startY);
+			block2[lane] = startZ + delta * (endZ - startZ);
+			block3[lane] = startW + delta * (endW - startW);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < start.count; i++)
+	{
+		TYPE startX = start.x[i], startY = start.y[i], startZ = start.z[i], startW = start.w[i];
+		TYPE endX = end.x[i], endY = end.y[i], endZ = end.z[i], endW = end.w[i];
+		block0[0] = startX + delta * (endX - startX);
+		block1[0] = startY + delta * (endY - startY);
+		block2[0] = startZ + delta * (endZ - startZ);
+		block3[0] = startW + delta * (endW - startW);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Less Than [<]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) < typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator<(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) < rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator<(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs < typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator<(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Max(): Component-wise
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Max(const OUT& out, const A& a, const B& b) { Max(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Max(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.yz < rhs.yz);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+			block0[lane] = (aX < bX) ? bX : aX;
+			block1[lane] = (aY < bY) ? bY : aY;
+			block2[lane] = (aZ < bZ) ? bZ : aZ;
+			block3[lane] = (aW < bW) ? bW : aW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+		block0[0] = (aX < bX) ? bX : aX;
+		block1[0] = (aY < bY) ? bY : aY;
+		block2[0] = (aZ < bZ) ? bZ : aZ;
+		block3[0] = (aW < bW) ? bW : aW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Greater Than [>]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) > typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator>(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) > rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator>(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs > typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator>(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Min(): Component-wise
+template <typename OUT, typename A, typename B> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type >::type Min(const OUT& out, const A& a, const B& b) { Min(typename OUT::PARENT(out), typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Min(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return lhs.x > rhs.x || (lhs.x == rhs.x && lhs.yz > rhs.yz);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+			block0[lane] = (bX < aX) ? bX : aX;
+			block1[lane] = (bY < aY) ? bY : aY;
+			block2[lane] = (bZ < aZ) ? bZ : aZ;
+			block3[lane] = (bW < aW) ? bW : aW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		TYPE bX = b.x[i], bY = b.y[i], bZ = b.z[i], bW = b.w[i];
+		block0[0] = (bX < aX) ? bX : aX;
+		block1[0] = (bY < aY) ? bY : aY;
+		block2[0] = (bZ < aZ) ? bZ : aZ;
+		block3[0] = (bW < aW) ? bW : aW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Less Than Or Equal To [<=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) <= typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator<=(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) <= rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator<=(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs <= typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator<=(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Ceil()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Ceil(const OUT& out, const A& a) { Ceil(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Ceil(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a)
 {
-	return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.yz <= rhs.yz);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = ceil(a.x[i]);
+			block1[lane] = ceil(a.y[i]);
+			block2[lane] = ceil(a.z[i]);
+			block3[lane] = ceil(a.w[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = ceil(a.x[i]);
+		block1[0] = ceil(a.y[i]);
+		block2[0] = ceil(a.z[i]);
+		block3[0] = ceil(a.w[i]);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Greater Than Or Equal To [<=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) >= typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator>=(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) >= rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator>=(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs >= typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator>=(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+// 4D batch Floor()
+template <typename OUT, typename A> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Floor(const OUT& out, const A& a) { Floor(typename OUT::PARENT(out), typename A::PARENT(a)); }
+template <typename TYPE> void Floor(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a)
 {
-	return lhs.x > rhs.x || (lhs.x == rhs.x && lhs.yz >= rhs.yz);
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = floor(a.x[i]);
+			block1[lane] = floor(a.y[i]);
+			block2[lane] = floor(a.z[i]);
+			block3[lane] = floor(a.w[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = floor(a.x[i]);
+		block1[0] = floor(a.y[i]);
+		block2[0] = floor(a.z[i]);
+		block3[0] = floor(a.w[i]);
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 3D Normalize()
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Normalize(const SWIZZLE& toNormalize) { return Normalize(typename SWIZZLE::PARENT(toNormalize)); }
-template <typename TYPE> VECTOR3<TYPE> Normalize(const VECTOR3<TYPE>& toNormalize)
+// 4D batch Distance()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type Distance(TYPE* out, const A& a, const B& b) { Distance(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void Distance(TYPE* out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return toNormalize / toNormalize.Length;
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = sqrt((a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]) + (a.z[i] - b.z[i]) * (a.z[i] - b.z[i]));
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = sqrt((a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]) + (a.z[i] - b.z[i]) * (a.z[i] - b.z[i]));
+		out[i] = block0[0];
+	}
 }
 
-// 3D Dot()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type Dot(const SWIZZLE0& a, const SWIZZLE1& b) { return Dot(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Dot(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Dot(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Dot(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Dot(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE Dot(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+// 4D batch DistanceSquared()
+template <typename TYPE, typename A, typename B> inline typename EnableIf< IsSoa4D< typename A::PARENT >, typename EnableIf< IsSoa4D< typename B::PARENT >, void >::type >::type DistanceSquared(TYPE* out, const A& a, const B& b) { DistanceSquared(out, typename A::PARENT(a), typename B::PARENT(b)); }
+template <typename TYPE> void DistanceSquared(TYPE* out, const VECTOR4_SOA_VIEW<TYPE>& a, const VECTOR4_SOA_VIEW<TYPE>& b)
 {
-	return a.x * b.x + a.y * b.y + a.z * b.z;
+	TYPE block0[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			block0[lane] = (a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]) + (a.z[i] - b.z[i]) * (a.z[i] - b.z[i]);
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out[n + lane] = block0[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		block0[0] = (a.x[i] - b.x[i]) * (a.x[i] - b.x[i]) + (a.y[i] - b.y[i]) * (a.y[i] - b.y[i]) + (a.z[i] - b.z[i]) * (a.z[i] - b.z[i]);
+		out[i] = block0[0];
+	}
 }
 
-// 3D Cross()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Cross(const SWIZZLE0& a, const SWIZZLE1& b) { return Cross(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cross(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Cross(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cross(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Cross(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR3<TYPE> Cross(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+
+
+//----------------------------------------------------------------------
+// 
+// Sec. 08 - Matrix types and associated functions
+// 
+//----------------------------------------------------------------------
+
+#ifdef SVML_USE_SSE
+// 2x2 blocks of a 4x4 matrix, packed (m00, m01, m10, m11); used by the 4x4 Inverse()
+inline __m128 SimdMatrix2Multiply(const __m128& a, const __m128& b)
 {
-	return VECTOR3<TYPE>(a.y * b.z - a.z * b.y,
-	                     a.z * b.x - a.x * b.z,
-	                     a.x * b.y - a.y * b.x);
+	return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
 }
 
-// 3D Project()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Project(const SWIZZLE0& projectThis, const SWIZZLE1& ontoThis) { return Project(typename SWIZZLE0::PARENT(projectThis), typename SWIZZLE1::PARENT(ontoThis)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const SWIZZLE& projectThis, const VECTOR3<TYPE>& ontoThis) { return Project(typename SWIZZLE::PARENT(projectThis), ontoThis); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const VECTOR3<TYPE>& projectThis, const SWIZZLE& ontoThis) { return Project(projectThis, typename SWIZZLE::PARENT(ontoThis)); }
-template <typename TYPE> VECTOR3<TYPE> Project(const VECTOR3<TYPE>& projectThis, const VECTOR3<TYPE>& ontoThis)
+// Adjugate(a) * b
+inline __m128 SimdMatrix2AdjugateMultiply(const __m128& a, const __m128& b)
 {
-	return (Dot(projectThis, ontoThis) / Dot(ontoThis, ontoThis)) * ontoThis;
+	return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
 }
 
-// 3D Rotate()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Rotate(const SWIZZLE0& toRotate, const SWIZZLE1& rotationAxis, const SCALAR_TYPE& radians) { return Rotate(typename SWIZZLE0::PARENT(toRotate), typename SWIZZLE1::PARENT(rotationAxis), radians); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& toRotate, const VECTOR3<TYPE>& rotationAxis, const SCALAR_TYPE& radians) { return Rotate(typename SWIZZLE::PARENT(toRotate), rotationAxis, radians); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const VECTOR3<TYPE>& toRotate, const SWIZZLE& rotationAxis, const SCALAR_TYPE& radians) { return Rotate(toRotate, typename SWIZZLE::PARENT(rotationAxis), radians); }
-template <typename TYPE> VECTOR3<TYPE> Rotate(const VECTOR3<TYPE>& toRotate, const VECTOR3<TYPE>& rotationAxis, const SCALAR_TYPE& radians)
+// a * Adjugate(b)
+inline __m128 SimdMatrix2MultiplyAdjugate(const __m128& a, const __m128& b)
 {
-	SCALAR_TYPE cr = cos(radians);
-	return (toRotate * cr) + (rotationAxis * Dot(toRotate, rotationAxis) * (1 - cr)) + (Cross(rotationAxis, toRotate) * sin(radians));
+	return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
 }
 
-// 3D Lerp()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Lerp(const SWIZZLE0& start, const SWIZZLE1& end, const SCALAR_TYPE& delta) { return Lerp(typename SWIZZLE0::PARENT(start), typename SWIZZLE1::PARENT(end), delta); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const SWIZZLE& start, const VECTOR3<TYPE>& end, const SCALAR_TYPE& delta) { return Lerp(typename SWIZZLE::PARENT(start), end, delta); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const VECTOR3<TYPE>& start, const SWIZZLE& end, const SCALAR_TYPE& delta) { return Lerp(start, typename SWIZZLE::PARENT(end), delta); }
-template <typename TYPE> VECTOR3<TYPE> Lerp(const VECTOR3<TYPE>& start, const VECTOR3<TYPE>& end, const SCALAR_TYPE& delta)
+// Columns scaled by the components of v, summed in order (matching the scalar code)
+inline __m128 SimdMatrix4Multiply(const __m128& c0, const __m128& c1, const __m128& c2, const __m128& c3, const __m128& v)
 {
-	return VECTOR3<TYPE>(start.x + delta * (end.x - start.x),
-	                     start.y + delta * (end.y - start.y),
-	                     start.z + delta * (end.z - start.z));
+	__m128 result = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+	result = _mm_add_ps(result, _mm_mul_ps(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+	return _mm_add_ps(result, _mm_mul_ps(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
 }
+#endif // SVML_USE_SSE
 
-// 3D Max(): Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Max(const SWIZZLE0& a, const SWIZZLE1& b) { return Max(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Max(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Max(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR3<TYPE> Max(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+template <typename TYPE>
+struct MATRIX2
 {
-	return VECTOR3<TYPE>(max(a.x, b.x), max(a.y, b.y), max(a.z, b.z));
-}
+private:
+	VECTOR2<TYPE> columns[2];
+
+public:
+	MATRIX2() {}
+	explicit MATRIX2(const TYPE& diagonal) { columns[0] = VECTOR2<TYPE>(diagonal, (TYPE)0); columns[1] = VECTOR2<TYPE>((TYPE)0, diagonal); }
+	MATRIX2(const VECTOR2<TYPE>& column0, const VECTOR2<TYPE>& column1) { columns[0] = column0; columns[1] = column1; }
+
+	static MATRIX2 Identity() { return MATRIX2((TYPE)1); }
+
+	// Column access (m[column].row), and a copy of a row
+	VECTOR2<TYPE>& operator[](const unsigned& column)
+	{
+		if (column >= 2) { FatalError("Attempted out of bounds bracket access of 2x2 matrix.", column); }
+		return columns[column];
+	}
+	const VECTOR2<TYPE>& operator[](const unsigned& column) const
+	{
+		if (column >= 2) { FatalError("Attempted out of bounds bracket access of 2x2 matrix.", column); }
+		return columns[column];
+	}
+	VECTOR2<TYPE> Row(const unsigned& row) const { return VECTOR2<TYPE>(columns[0].Component(row), columns[1].Component(row)); }
+
+	// Assignment operators (default for = is fine)
+	const MATRIX2& operator+=(const MATRIX2& rhs) { columns[0] += rhs.columns[0]; columns[1] += rhs.columns[1]; return *this; }
+	const MATRIX2& operator-=(const MATRIX2& rhs) { columns[0] -= rhs.columns[0]; columns[1] -= rhs.columns[1]; return *this; }
+	const MATRIX2& operator*=(const MATRIX2& rhs) { *this = *this * rhs; return *this; }
+	const MATRIX2& operator*=(const TYPE& rhs) { columns[0] *= rhs; columns[1] *= rhs; return *this; }
+};
 
-// 3D Min(): Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Min(const SWIZZLE0& a, const SWIZZLE1& b) { return Min(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Min(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Min(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR3<TYPE> Min(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+// 2x2 [+]
+template <typename TYPE> MATRIX2<TYPE> operator+(const MATRIX2<TYPE>& lhs, const MATRIX2<TYPE>& rhs) { return MATRIX2<TYPE>(lhs[0] + rhs[0], lhs[1] + rhs[1]); }
+
+// 2x2 [-]
+template <typename TYPE> MATRIX2<TYPE> operator-(const MATRIX2<TYPE>& lhs, const MATRIX2<TYPE>& rhs) { return MATRIX2<TYPE>(lhs[0] - rhs[0], lhs[1] - rhs[1]); }
+
+// 2x2 Multiplication [*]: Scalar
+template <typename TYPE> MATRIX2<TYPE> operator*(const MATRIX2<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs) { return MATRIX2<TYPE>(lhs[0] * rhs, lhs[1] * rhs); }
+template <typename TYPE> MATRIX2<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const MATRIX2<TYPE>& rhs) { return MATRIX2<TYPE>(lhs * rhs[0], lhs * rhs[1]); }
+
+// 2x2 Multiplication [*]: Matrix-vector
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const MATRIX2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> VECTOR2<TYPE> operator*(const MATRIX2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
 {
-	return VECTOR3<TYPE>(min(a.x, b.x), min(a.y, b.y), min(a.z, b.z));
+	return VECTOR2<TYPE>(lhs[0].x * rhs.x + lhs[1].x * rhs.y,
+	                     lhs[0].y * rhs.x + lhs[1].y * rhs.y);
 }
 
-// 3D Max(): Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const SCALAR_TYPE& maximum) { return Max(typename SWIZZLE::PARENT(a), maximum); }
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SCALAR_TYPE& maximum, const SWIZZLE& b) { return Max(maximum, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR3<TYPE> Max(const VECTOR3<TYPE>& a, const SCALAR_TYPE& maximum)
+// 2x2 Multiplication [*]: Matrix-matrix
+template <typename TYPE> MATRIX2<TYPE> operator*(const MATRIX2<TYPE>& lhs, const MATRIX2<TYPE>& rhs) { return MATRIX2<TYPE>(lhs * rhs[0], lhs * rhs[1]); }
+
+// 2x2 Comparisons
+template <typename TYPE> bool operator==(const MATRIX2<TYPE>& lhs, const MATRIX2<TYPE>& rhs) { return lhs[0] == rhs[0] && lhs[1] == rhs[1]; }
+template <typename TYPE> bool operator!=(const MATRIX2<TYPE>& lhs, const MATRIX2<TYPE>& rhs) { return !(lhs == rhs); }
+template <typename TYPE> bool AlmostEqual(const MATRIX2<TYPE>& lhs, const MATRIX2<TYPE>& rhs) { return AlmostEqual(lhs[0], rhs[0]) && AlmostEqual(lhs[1], rhs[1]); }
+
+// 2x2 Transpose()
+template <typename TYPE> MATRIX2<TYPE> Transpose(const MATRIX2<TYPE>& m) { return MATRIX2<TYPE>(m.Row(0), m.Row(1)); }
+
+// 2x2 Determinant()
+template <typename TYPE> TYPE Determinant(const MATRIX2<TYPE>& m)
 {
-	return VECTOR3<TYPE>(max((SCALAR_TYPE)a.x, maximum), max((SCALAR_TYPE)a.y, maximum), max((SCALAR_TYPE)a.z, maximum));
+	TYPE a00 = m[0].x, a01 = m[0].y, a10 = m[1].x, a11 = m[1].y;
+	return a00 * a11 - a01 * a10;
 }
-template <typename TYPE> VECTOR3<TYPE> Max(const SCALAR_TYPE& maximum, const VECTOR3<TYPE>& b)
+
+// 2x2 Inverse()
+template <typename TYPE> MATRIX2<TYPE> Inverse(const MATRIX2<TYPE>& m)
 {
-	return VECTOR3<TYPE>(max(maximum, (SCALAR_TYPE)b.x), max(maximum, (SCALAR_TYPE)b.y), max(maximum, (SCALAR_TYPE)b.z));
+	TYPE a00 = m[0].x, a01 = m[0].y, a10 = m[1].x, a11 = m[1].y;
+	TYPE i = 1 / (a00 * a11 - a01 * a10);
+	return MATRIX2<TYPE>(VECTOR2<TYPE>(a11 * i, -a01 * i),
+	                     VECTOR2<TYPE>(-a10 * i, a00 * i));
 }
 
-// 3D Min(): Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const SCALAR_TYPE& minimum) { return Min(typename SWIZZLE::PARENT(a), minimum); }
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SCALAR_TYPE& minimum, const SWIZZLE& b) { return Min(minimum, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR3<TYPE> Min(const VECTOR3<TYPE>& a, const SCALAR_TYPE& minimum)
+// 2x2 batch Transform(): out[i] = matrix * in[i], out may be in
+template <typename TYPE> void Transform(VECTOR2<TYPE>* out, const MATRIX2<TYPE>& matrix, const VECTOR2<TYPE>* in, const unsigned& count)
 {
-	return VECTOR3<TYPE>(min((SCALAR_TYPE)a.x, minimum), min((SCALAR_TYPE)a.y, minimum), min((SCALAR_TYPE)a.z, minimum));
+	for (unsigned i = 0; i < count; i++)
+	{
+		out[i] = matrix * in[i];
+	}
 }
-template <typename TYPE> VECTOR3<TYPE> Min(const SCALAR_TYPE& minimum, const VECTOR3<TYPE>& b)
+template <typename OUT, typename A, typename TYPE> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Transform(const OUT& out, const MATRIX2<TYPE>& matrix, const A& a) { Transform(typename OUT::PARENT(out), matrix, typename A::PARENT(a)); }
+template <typename TYPE> void Transform(const VECTOR2_SOA_VIEW<TYPE>& out, const MATRIX2<TYPE>& matrix, const VECTOR2_SOA_VIEW<TYPE>& a)
 {
-	return VECTOR3<TYPE>(min(minimum, (SCALAR_TYPE)b.x), min(minimum, (SCALAR_TYPE)b.y), min(minimum, (SCALAR_TYPE)b.z));
+	TYPE m00 = matrix[0].x, m01 = matrix[0].y, m10 = matrix[1].x, m11 = matrix[1].y;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			block0[lane] = m00 * aX + m10 * aY;
+			block1[lane] = m01 * aX + m11 * aY;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		block0[0] = m00 * aX + m10 * aY;
+		block1[0] = m01 * aX + m11 * aY;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 3D Ceil()
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Ceil(const SWIZZLE& toCeil) { return Ceil(typename SWIZZLE::PARENT(toCeil)); }
-template <typename TYPE> VECTOR3<TYPE> Ceil(const VECTOR3<TYPE>& toCeil)
-{
-	return VECTOR3<TYPE>(ceil(toCeil.x), ceil(toCeil.y), ceil(toCeil.z));
-}
 
-// 3D Floor()
-template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Floor(const SWIZZLE& toFloor) { return Floor(typename SWIZZLE::PARENT(toFloor)); }
-template <typename TYPE> VECTOR3<TYPE> Floor(const VECTOR3<TYPE>& toFloor)
-{
-	return VECTOR3<TYPE>(floor(toFloor.x), floor(toFloor.y), floor(toFloor.z));
-}
 
-// 3D Distance()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type Distance(const SWIZZLE0& a, const SWIZZLE1& b) { return Distance(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Distance(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Distance(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Distance(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Distance(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE Distance(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+template <typename TYPE>
+struct MATRIX3
 {
-	return sqrt(DistanceSquared(a, b));
-}
+private:
+	VECTOR3<TYPE> columns[3];
+
+public:
+	MATRIX3() {}
+	explicit MATRIX3(const TYPE& diagonal) { columns[0] = VECTOR3<TYPE>(diagonal, (TYPE)0, (TYPE)0); columns[1] = VECTOR3<TYPE>((TYPE)0, diagonal, (TYPE)0); columns[2] = VECTOR3<TYPE>((TYPE)0, (TYPE)0, diagonal); }
+	MATRIX3(const VECTOR3<TYPE>& column0, const VECTOR3<TYPE>& column1, const VECTOR3<TYPE>& column2) { columns[0] = column0; columns[1] = column1; columns[2] = column2; }
+
+	static MATRIX3 Identity() { return MATRIX3((TYPE)1); }
+
+	// Column access (m[column].row), and a copy of a row
+	VECTOR3<TYPE>& operator[](const unsigned& column)
+	{
+		if (column >= 3) { FatalError("Attempted out of bounds bracket access of 3x3 matrix.", column); }
+		return columns[column];
+	}
+	const VECTOR3<TYPE>& operator[](const unsigned& column) const
+	{
+		if (column >= 3) { FatalError("Attempted out of bounds bracket access of 3x3 matrix.", column); }
+		return columns[column];
+	}
+	VECTOR3<TYPE> Row(const unsigned& row) const { return VECTOR3<TYPE>(columns[0].Component(row), columns[1].Component(row), columns[2].Component(row)); }
+
+	// Assignment operators (default for = is fine)
+	const MATRIX3& operator+=(const MATRIX3& rhs) { columns[0] += rhs.columns[0]; columns[1] += rhs.columns[1]; columns[2] += rhs.columns[2]; return *this; }
+	const MATRIX3& operator-=(const MATRIX3& rhs) { columns[0] -= rhs.columns[0]; columns[1] -= rhs.columns[1]; columns[2] -= rhs.columns[2]; return *this; }
+	const MATRIX3& operator*=(const MATRIX3& rhs) { *this = *this * rhs; return *this; }
+	const MATRIX3& operator*=(const TYPE& rhs) { columns[0] *= rhs; columns[1] *= rhs; columns[2] *= rhs; return *this; }
+};
+
+// 3x3 [+]
+template <typename TYPE> MATRIX3<TYPE> operator+(const MATRIX3<TYPE>& lhs, const MATRIX3<TYPE>& rhs) { return MATRIX3<TYPE>(lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2]); }
+
+// 3x3 [-]
+template <typename TYPE> MATRIX3<TYPE> operator-(const MATRIX3<TYPE>& lhs, const MATRIX3<TYPE>& rhs) { return MATRIX3<TYPE>(lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2]); }
+
+// 3x3 Multiplication [*]: Scalar
+template <typename TYPE> MATRIX3<TYPE> operator*(const MATRIX3<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs) { return MATRIX3<TYPE>(lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs); }
+template <typename TYPE> MATRIX3<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const MATRIX3<TYPE>& rhs) { return MATRIX3<TYPE>(lhs * rhs[0], lhs * rhs[1], lhs * rhs[2]); }
 
-// 3D DistanceSquared()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type DistanceSquared(const SWIZZLE0& a, const SWIZZLE1& b) { return DistanceSquared(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type DistanceSquared(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return DistanceSquared(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type DistanceSquared(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return DistanceSquared(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE DistanceSquared(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+// 3x3 Multiplication [*]: Matrix-vector
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const MATRIX3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> VECTOR3<TYPE> operator*(const MATRIX3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
 {
-	return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z);
+	return VECTOR3<TYPE>(lhs[0].x * rhs.x + lhs[1].x * rhs.y + lhs[2].x * rhs.z,
+	                     lhs[0].y * rhs.x + lhs[1].y * rhs.y + lhs[2].y * rhs.z,
+	                     lhs[0].z * rhs.x + lhs[1].z * rhs.y + lhs[2].z * rhs.z);
 }
 
+// 3x3 Multiplication [*]: Matrix-matrix
+template <typename TYPE> MATRIX3<TYPE> operator*(const MATRIX3<TYPE>& lhs, const MATRIX3<TYPE>& rhs) { return MATRIX3<TYPE>(lhs * rhs[0], lhs * rhs[1], lhs * rhs[2]); }
 
+// 3x3 Comparisons
+template <typename TYPE> bool operator==(const MATRIX3<TYPE>& lhs, const MATRIX3<TYPE>& rhs) { return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2]; }
+template <typename TYPE> bool operator!=(const MATRIX3<TYPE>& lhs, const MATRIX3<TYPE>& rhs) { return !(lhs == rhs); }
+template <typename TYPE> bool AlmostEqual(const MATRIX3<TYPE>& lhs, const MATRIX3<TYPE>& rhs) { return AlmostEqual(lhs[0], rhs[0]) && AlmostEqual(lhs[1], rhs[1]) && AlmostEqual(lhs[2], rhs[2]); }
 
-//----------------------------------------------------------------------
-// 
-// Sec. 06 - 4D vector type and associated functions
-// 
-//----------------------------------------------------------------------
+// 3x3 Transpose()
+template <typename TYPE> MATRIX3<TYPE> Transpose(const MATRIX3<TYPE>& m) { return MATRIX3<TYPE>(m.Row(0), m.Row(1), m.Row(2)); }
 
-template <typename TYPE>
-union VECTOR4
+// 3x3 Determinant()
+template <typename TYPE> TYPE Determinant(const MATRIX3<TYPE>& m)
 {
-private:
-	struct { TYPE x, y, z, w; } v;
+	TYPE a00 = m[0].x, a01 = m[0].y, a02 = m[0].z, a10 = m[1].x, a11 = m[1].y, a12 = m[1].z, a20 = m[2].x, a21 = m[2].y, a22 = m[2].z;
+	return a00 * (a11 * a22 - a12 * a21) - a01 * (a10 * a22 - a12 * a20) + a02 * (a10 * a21 - a11 * a20);
+}
 
-	struct s1 { protected: TYPE x, y, z, w; };
-	struct s2 { protected: TYPE x, y, z, w; public: typedef VECTOR2<TYPE> PARENT; };
-	struct s3 { protected: TYPE x, y, z, w; public: typedef VECTOR3<TYPE> PARENT; };
-	struct s4 { protected: TYPE x, y, z, w; public: typedef VECTOR4<TYPE> PARENT; };
+// 3x3 Inverse()
+template <typename TYPE> MATRIX3<TYPE> Inverse(const MATRIX3<TYPE>& m)
+{
+	TYPE a00 = m[0].x, a01 = m[0].y, a02 = m[0].z, a10 = m[1].x, a11 = m[1].y, a12 = m[1].z, a20 = m[2].x, a21 = m[2].y, a22 = m[2].z;
+	TYPE b00 = a11 * a22 - a12 * a21;
+	TYPE b10 = a12 * a20 - a10 * a22;
+	TYPE b20 = a10 * a21 - a11 * a20;
+	TYPE i = 1 / (a00 * b00 + a01 * b10 + a02 * b20);
+	return MATRIX3<TYPE>(VECTOR3<TYPE>(b00 * i, (a02 * a21 - a01 * a22) * i, (a01 * a12 - a02 * a11) * i),
+	                     VECTOR3<TYPE>(b10 * i, (a00 * a22 - a02 * a20) * i, (a02 * a10 - a00 * a12) * i),
+	                     VECTOR3<TYPE>(b20 * i, (a01 * a20 - a00 * a21) * i, (a00 * a11 - a01 * a10) * i));
+}
 
-	struct X : s1
+// 3x3 batch Transform(): out[i] = matrix * in[i], out may be in
+template <typename TYPE> void Transform(VECTOR3<TYPE>* out, const MATRIX3<TYPE>& matrix, const VECTOR3<TYPE>* in, const unsigned& count)
+{
+	for (unsigned i = 0; i < count; i++)
 	{
-		operator TYPE() const { return s1::x; }
-		const X& operator=(const TYPE& rhs) { s1::x = rhs; return *this; }
-		const X& operator+=(const TYPE& rhs) { s1::x += rhs; return *this; }
-		const X& operator-=(const TYPE& rhs) { s1::x -= rhs; return *this; }
-		const X& operator*=(const TYPE& rhs) { s1::x *= rhs; return *this; }
-		const X& operator/=(const TYPE& rhs) { s1::x /= rhs; return *this; }
-	};
-	struct Y : s1
-	{
-		operator TYPE() const { return s1::y; }
-		const Y& operator=(const TYPE& rhs) { s1::y = rhs; return *this; }
-		const Y& operator+=(const TYPE& rhs) { s1::y += rhs; return *this; }
-		const Y& operator-=(const TYPE& rhs) { s1::y -= rhs; return *this; }
-		const Y& operator*=(const TYPE& rhs) { s1::y *= rhs; return *this; }
-		const Y& operator/=(const TYPE& rhs) { s1::y /= rhs; return *this; }
-	};
-	struct Z : s1
-	{
-		operator TYPE() const { return s1::z; }
-		const Z& operator=(const TYPE& rhs) { s1::z = rhs; return *this; }
-		const Z& operator+=(const TYPE& rhs) { s1::z += rhs; return *this; }
-		const Z& operator-=(const TYPE& rhs) { s1::z -= rhs; return *this; }
-		const Z& operator*=(const TYPE& rhs) { s1::z *= rhs; return *this; }
-		const Z& operator/=(const TYPE& rhs) { s1::z /= rhs; return *this; }
-	};
-	struct W : s1
-	{
-		operator TYPE() const { return s1::w; }
-		const W& operator=(const TYPE& rhs) { s1::w = rhs; return *this; }
-		const W& operator+=(const TYPE& rhs) { s1::w += rhs; return *this; }
-		const W& operator-=(const TYPE& rhs) { s1::w -= rhs; return *this; }
-		const W& operator*=(const TYPE& rhs) { s1::w *= rhs; return *this; }
-		const W& operator/=(const TYPE& rhs) { s1::w /= rhs; return *this; }
-	};
-	struct XX : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::x); } };
-	struct XY : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::y); }
-		const XY& operator=(const VECTOR4<TYPE>& rhs) { s2::x = rhs.v.x; s2::y = rhs.v.y; return *this; }
-		const XY& operator+=(const VECTOR4<TYPE>& rhs) { s2::x += rhs.v.x; s2::y += rhs.v.y; return *this; }
-		const XY& operator-=(const VECTOR4<TYPE>& rhs) { s2::x -= rhs.v.x; s2::y -= rhs.v.y; return *this; }
-		const XY& operator*=(const VECTOR4<TYPE>& rhs) { s2::x *= rhs.v.x; s2::y *= rhs.v.y; return *this; }
-		const XY& operator/=(const VECTOR4<TYPE>& rhs) { s2::x /= rhs.v.x; s2::y /= rhs.v.y; return *this; }
-		const XY& operator*=(const TYPE& rhs) { s2::x *= rhs; s2::y *= rhs; return *this; }
-		const XY& operator/=(const TYPE& rhs) { s2::x /= rhs; s2::y /= rhs; return *this; }
-	};
-	struct XZ : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::z); }
-		const XZ& operator=(const VECTOR4<TYPE>& rhs) { s2::x = rhs.v.x; s2::z = rhs.v.y; return *this; }
-		const XZ& operator+=(const VECTOR4<TYPE>& rhs) { s2::x += rhs.v.x; s2::z += rhs.v.y; return *this; }
-		const XZ& operator-=(const VECTOR4<TYPE>& rhs) { s2::x -= rhs.v.x; s2::z -= rhs.v.y; return *this; }
-		const XZ& operator*=(const VECTOR4<TYPE>& rhs) { s2::x *= rhs.v.x; s2::z *= rhs.v.y; return *this; }
-		const XZ& operator/=(const VECTOR4<TYPE>& rhs) { s2::x /= rhs.v.x; s2::z /= rhs.v.y; return *this; }
-		const XZ& operator*=(const TYPE& rhs) { s2::x *= rhs; s2::z *= rhs; return *this; }
-		const XZ& operator/=(const TYPE& rhs) { s2::x /= rhs; s2::z /= rhs; return *this; }
-	};
-	struct XW : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::x, s2::w); }
-		const XW& operator=(const VECTOR4<TYPE>& rhs) { s2::x = rhs.v.x; s2::w = rhs.v.y; return *this; }
-		const XW& operator+=(const VECTOR4<TYPE>& rhs) { s2::x += rhs.v.x; s2::w += rhs.v.y; return *this; }
-		const XW& operator-=(const VECTOR4<TYPE>& rhs) { s2::x -= rhs.v.x; s2::w -= rhs.v.y; return *this; }
-		const XW& operator*=(const VECTOR4<TYPE>& rhs) { s2::x *= rhs.v.x; s2::w *= rhs.v.y; return *this; }
-		const XW& operator/=(const VECTOR4<TYPE>& rhs) { s2::x /= rhs.v.x; s2::w /= rhs.v.y; return *this; }
-		const XW& operator*=(const TYPE& rhs) { s2::x *= rhs; s2::w *= rhs; return *this; }
-		const XW& operator/=(const TYPE& rhs) { s2::x /= rhs; s2::w /= rhs; return *this; }
-	};
-	struct YX : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::x); }
-		const YX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y = rhs.v.x; s2::x = t0; return *this; }
-		const YX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y += rhs.v.x; s2::x += t0; return *this; }
-		const YX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y -= rhs.v.x; s2::x -= t0; return *this; }
-		const YX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y *= rhs.v.x; s2::x *= t0; return *this; }
-		const YX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y /= rhs.v.x; s2::x /= t0; return *this; }
-		const YX& operator*=(const TYPE& rhs) { s2::y *= rhs; s2::x *= rhs; return *this; }
-		const YX& operator/=(const TYPE& rhs) { s2::y /= rhs; s2::x /= rhs; return *this; }
-	};
-	struct YY : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::y); } };
-	struct YZ : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::z); }
-		const YZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y = rhs.v.x; s2::z = t0; return *this; }
-		const YZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y += rhs.v.x; s2::z += t0; return *this; }
-		const YZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y -= rhs.v.x; s2::z -= t0; return *this; }
-		const YZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y *= rhs.v.x; s2::z *= t0; return *this; }
-		const YZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y /= rhs.v.x; s2::z /= t0; return *this; }
-		const YZ& operator*=(const TYPE& rhs) { s2::y *= rhs; s2::z *= rhs; return *this; }
-		const YZ& operator/=(const TYPE& rhs) { s2::y /= rhs; s2::z /= rhs; return *this; }
-	};
-	struct YW : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::y, s2::w); }
-		const YW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y = rhs.v.x; s2::w = t0; return *this; }
-		const YW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y += rhs.v.x; s2::w += t0; return *this; }
-		const YW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y -= rhs.v.x; s2::w -= t0; return *this; }
-		const YW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y *= rhs.v.x; s2::w *= t0; return *this; }
-		const YW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::y /= rhs.v.x; s2::w /= t0; return *this; }
-		const YW& operator*=(const TYPE& rhs) { s2::y *= rhs; s2::w *= rhs; return *this; }
-		const YW& operator/=(const TYPE& rhs) { s2::y /= rhs; s2::w /= rhs; return *this; }
-	};
-	struct ZX : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::z, s2::x); }
-		const ZX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z = rhs.v.x; s2::x = t0; return *this; }
-		const ZX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z += rhs.v.x; s2::x += t0; return *this; }
-		const ZX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z -= rhs.v.x; s2::x -= t0; return *this; }
-		const ZX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z *= rhs.v.x; s2::x *= t0; return *this; }
-		const ZX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z /= rhs.v.x; s2::x /= t0; return *this; }
-		const ZX& operator*=(const TYPE& rhs) { s2::z *= rhs; s2::x *= rhs; return *this; }
-		const ZX& operator/=(const TYPE& rhs) { s2::z /= rhs; s2::x /= rhs; return *this; }
-	};
-	struct ZY : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::z, s2::y); }
-		const ZY& operator=(const VECTOR4<TYPE>& rhs) { s2::z = rhs.v.x; s2::y = rhs.v.y; return *this; }
-		const ZY& operator+=(const VECTOR4<TYPE>& rhs) { s2::z += rhs.v.x; s2::y += rhs.v.y; return *this; }
-		const ZY& operator-=(const VECTOR4<TYPE>& rhs) { s2::z -= rhs.v.x; s2::y -= rhs.v.y; return *this; }
-		const ZY& operator*=(const VECTOR4<TYPE>& rhs) { s2::z *= rhs.v.x; s2::y *= rhs.v.y; return *this; }
-		const ZY& operator/=(const VECTOR4<TYPE>& rhs) { s2::z /= rhs.v.x; s2::y /= rhs.v.y; return *this; }
-		const ZY& operator*=(const TYPE& rhs) { s2::z *= rhs; s2::y *= rhs; return *this; }
-		const ZY& operator/=(const TYPE& rhs) { s2::z /= rhs; s2::y /= rhs; return *this; }
-	};
-	struct ZZ : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::z, s2::z); } };
-	struct ZW : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::z, s2::w); }
-		const ZW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z = rhs.v.x; s2::w = t0; return *this; }
-		const ZW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z += rhs.v.x; s2::w += t0; return *this; }
-		const ZW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z -= rhs.v.x; s2::w -= t0; return *this; }
-		const ZW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z *= rhs.v.x; s2::w *= t0; return *this; }
-		const ZW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::z /= rhs.v.x; s2::w /= t0; return *this; }
-		const ZW& operator*=(const TYPE& rhs) { s2::z *= rhs; s2::w *= rhs; return *this; }
-		const ZW& operator/=(const TYPE& rhs) { s2::z /= rhs; s2::w /= rhs; return *this; }
-	};
-	struct WX : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::w, s2::x); }
-		const WX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w = rhs.v.x; s2::x = t0; return *this; }
-		const WX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w += rhs.v.x; s2::x += t0; return *this; }
-		const WX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w -= rhs.v.x; s2::x -= t0; return *this; }
-		const WX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w *= rhs.v.x; s2::x *= t0; return *this; }
-		const WX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w /= rhs.v.x; s2::x /= t0; return *this; }
-		const WX& operator*=(const TYPE& rhs) { s2::w *= rhs; s2::x *= rhs; return *this; }
-		const WX& operator/=(const TYPE& rhs) { s2::w /= rhs; s2::x /= rhs; return *this; }
-	};
-	struct WY : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::w, s2::y); }
-		const WY& operator=(const VECTOR4<TYPE>& rhs) { s2::w = rhs.v.x; s2::y = rhs.v.y; return *this; }
-		const WY& operator+=(const VECTOR4<TYPE>& rhs) { s2::w += rhs.v.x; s2::y += rhs.v.y; return *this; }
-		const WY& operator-=(const VECTOR4<TYPE>& rhs) { s2::w -= rhs.v.x; s2::y -= rhs.v.y; return *this; }
-		const WY& operator*=(const VECTOR4<TYPE>& rhs) { s2::w *= rhs.v.x; s2::y *= rhs.v.y; return *this; }
-		const WY& operator/=(const VECTOR4<TYPE>& rhs) { s2::w /= rhs.v.x; s2::y /= rhs.v.y; return *this; }
-		const WY& operator*=(const TYPE& rhs) { s2::w *= rhs; s2::y *= rhs; return *this; }
-		const WY& operator/=(const TYPE& rhs) { s2::w /= rhs; s2::y /= rhs; return *this; }
-	};
-	struct WZ : s2
-	{
-		operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::w, s2::z); }
-		const WZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w = rhs.v.x; s2::z = t0; return *this; }
-		const WZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w += rhs.v.x; s2::z += t0; return *this; }
-		const WZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w -= rhs.v.x; s2::z -= t0; return *this; }
-		const WZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w *= rhs.v.x; s2::z *= t0; return *this; }
-		const WZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s2::w /= rhs.v.x; s2::z /= t0; return *this; }
-		const WZ& operator*=(const TYPE& rhs) { s2::w *= rhs; s2::z *= rhs; return *this; }
-		const WZ& operator/=(const TYPE& rhs) { s2::w /= rhs; s2::z /= rhs; return *this; }
-	};
-	struct WW : s2 { operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(s2::w, s2::w); } };
-	struct XXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::x); } };
-	struct XXY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::y); } };
-	struct XXZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::z); } };
-	struct XXW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::x, s3::w); } };
-	struct XYX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::x); } };
-	struct XYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::y); } };
-	struct XYZ : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::z); }
-		const XYZ& operator=(const VECTOR4<TYPE>& rhs) { s3::x = rhs.v.x; s3::y = rhs.v.y; s3::z = rhs.v.z; return *this; }
-		const XYZ& operator+=(const VECTOR4<TYPE>& rhs) { s3::x += rhs.v.x; s3::y += rhs.v.y; s3::z += rhs.v.z; return *this; }
-		const XYZ& operator-=(const VECTOR4<TYPE>& rhs) { s3::x -= rhs.v.x; s3::y -= rhs.v.y; s3::z -= rhs.v.z; return *this; }
-		const XYZ& operator*=(const VECTOR4<TYPE>& rhs) { s3::x *= rhs.v.x; s3::y *= rhs.v.y; s3::z *= rhs.v.z; return *this; }
-		const XYZ& operator/=(const VECTOR4<TYPE>& rhs) { s3::x /= rhs.v.x; s3::y /= rhs.v.y; s3::z /= rhs.v.z; return *this; }
-		const XYZ& operator*=(const TYPE& rhs) { s3::x *= rhs; s3::y *= rhs; s3::z *= rhs; return *this; }
-		const XYZ& operator/=(const TYPE& rhs) { s3::x /= rhs; s3::y /= rhs; s3::z /= rhs; return *this; }
-	};
-	struct XYW : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::y, s3::w); }
-		const XYW& operator=(const VECTOR4<TYPE>& rhs) { s3::x = rhs.v.x; s3::y = rhs.v.y; s3::w = rhs.v.z; return *this; }
-		const XYW& operator+=(const VECTOR4<TYPE>& rhs) { s3::x += rhs.v.x; s3::y += rhs.v.y; s3::w += rhs.v.z; return *this; }
-		const XYW& operator-=(const VECTOR4<TYPE>& rhs) { s3::x -= rhs.v.x; s3::y -= rhs.v.y; s3::w -= rhs.v.z; return *this; }
-		const XYW& operator*=(const VECTOR4<TYPE>& rhs) { s3::x *= rhs.v.x; s3::y *= rhs.v.y; s3::w *= rhs.v.z; return *this; }
-		const XYW& operator/=(const VECTOR4<TYPE>& rhs) { s3::x /= rhs.v.x; s3::y /= rhs.v.y; s3::w /= rhs.v.z; return *this; }
-		const XYW& operator*=(const TYPE& rhs) { s3::x *= rhs; s3::y *= rhs; s3::w *= rhs; return *this; }
-		const XYW& operator/=(const TYPE& rhs) { s3::x /= rhs; s3::y /= rhs; s3::w /= rhs; return *this; }
-	};
-	struct XZX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::z, s3::x); } };
-	struct XZY : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::z, s3::y); }
-		const XZY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x = rhs.v.x; s3::z = rhs.v.y; s3::y = t0; return *this; }
-		const XZY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x += rhs.v.x; s3::z += rhs.v.y; s3::y += t0; return *this; }
-		const XZY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x -= rhs.v.x; s3::z -= rhs.v.y; s3::y -= t0; return *this; }
-		const XZY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x *= rhs.v.x; s3::z *= rhs.v.y; s3::y *= t0; return *this; }
-		const XZY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x /= rhs.v.x; s3::z /= rhs.v.y; s3::y /= t0; return *this; }
-		const XZY& operator*=(const TYPE& rhs) { s3::x *= rhs; s3::z *= rhs; s3::y *= rhs; return *this; }
-		const XZY& operator/=(const TYPE& rhs) { s3::x /= rhs; s3::z /= rhs; s3::y /= rhs; return *this; }
-	};
-	struct XZZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::z, s3::z); } };
-	struct XZW : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::z, s3::w); }
-		const XZW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x = rhs.v.x; s3::z = rhs.v.y; s3::w = t0; return *this; }
-		const XZW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x += rhs.v.x; s3::z += rhs.v.y; s3::w += t0; return *this; }
-		const XZW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x -= rhs.v.x; s3::z -= rhs.v.y; s3::w -= t0; return *this; }
-		const XZW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x *= rhs.v.x; s3::z *= rhs.v.y; s3::w *= t0; return *this; }
-		const XZW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x /= rhs.v.x; s3::z /= rhs.v.y; s3::w /= t0; return *this; }
-		const XZW& operator*=(const TYPE& rhs) { s3::x *= rhs; s3::z *= rhs; s3::w *= rhs; return *this; }
-		const XZW& operator/=(const TYPE& rhs) { s3::x /= rhs; s3::z /= rhs; s3::w /= rhs; return *this; }
-	};
-	struct XWX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::w, s3::x); } };
-	struct XWY : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::w, s3::y); }
-		const XWY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x = rhs.v.x; s3::w = rhs.v.y; s3::y = t0; return *this; }
-		const XWY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x += rhs.v.x; s3::w += rhs.v.y; s3::y += t0; return *this; }
-		const XWY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x -= rhs.v.x; s3::w -= rhs.v.y; s3::y -= t0; return *this; }
-		const XWY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x *= rhs.v.x; s3::w *= rhs.v.y; s3::y *= t0; return *this; }
-		const XWY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::x /= rhs.v.x; s3::w /= rhs.v.y; s3::y /= t0; return *this; }
-		const XWY& operator*=(const TYPE& rhs) { s3::x *= rhs; s3::w *= rhs; s3::y *= rhs; return *this; }
-		const XWY& operator/=(const TYPE& rhs) { s3::x /= rhs; s3::w /= rhs; s3::y /= rhs; return *this; }
-	};
-	struct XWZ : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::w, s3::z); }
-		const XWZ& operator=(const VECTOR4<TYPE>& rhs) { s3::x = rhs.v.x; s3::w = rhs.v.y; s3::z = rhs.v.z; return *this; }
-		const XWZ& operator+=(const VECTOR4<TYPE>& rhs) { s3::x += rhs.v.x; s3::w += rhs.v.y; s3::z += rhs.v.z; return *this; }
-		const XWZ& operator-=(const VECTOR4<TYPE>& rhs) { s3::x -= rhs.v.x; s3::w -= rhs.v.y; s3::z -= rhs.v.z; return *this; }
-		const XWZ& operator*=(const VECTOR4<TYPE>& rhs) { s3::x *= rhs.v.x; s3::w *= rhs.v.y; s3::z *= rhs.v.z; return *this; }
-		const XWZ& operator/=(const VECTOR4<TYPE>& rhs) { s3::x /= rhs.v.x; s3::w /= rhs.v.y; s3::z /= rhs.v.z; return *this; }
-		const XWZ& operator*=(const TYPE& rhs) { s3::x *= rhs; s3::w *= rhs; s3::z *= rhs; return *this; }
-		const XWZ& operator/=(const TYPE& rhs) { s3::x /= rhs; s3::w /= rhs; s3::z /= rhs; return *this; }
-	};
-	struct XWW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::x, s3::w, s3::w); } };
-	struct YXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::x); } };
-	struct YXY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::y); } };
-	struct YXZ : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::z); }
-		const YXZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y = rhs.v.x; s3::x = t0; s3::z = rhs.v.z; return *this; }
-		const YXZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y += rhs.v.x; s3::x += t0; s3::z += rhs.v.z; return *this; }
-		const YXZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y -= rhs.v.x; s3::x -= t0; s3::z -= rhs.v.z; return *this; }
-		const YXZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y *= rhs.v.x; s3::x *= t0; s3::z *= rhs.v.z; return *this; }
-		const YXZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y /= rhs.v.x; s3::x /= t0; s3::z /= rhs.v.z; return *this; }
-		const YXZ& operator*=(const TYPE& rhs) { s3::y *= rhs; s3::x *= rhs; s3::z *= rhs; return *this; }
-		const YXZ& operator/=(const TYPE& rhs) { s3::y /= rhs; s3::x /= rhs; s3::z /= rhs; return *this; }
-	};
-	struct YXW : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::x, s3::w); }
-		const YXW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y = rhs.v.x; s3::x = t0; s3::w = t1; return *this; }
-		const YXW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y += rhs.v.x; s3::x += t0; s3::w += t1; return *this; }
-		const YXW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y -= rhs.v.x; s3::x -= t0; s3::w -= t1; return *this; }
-		const YXW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y *= rhs.v.x; s3::x *= t0; s3::w *= t1; return *this; }
-		const YXW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y /= rhs.v.x; s3::x /= t0; s3::w /= t1; return *this; }
-		const YXW& operator*=(const TYPE& rhs) { s3::y *= rhs; s3::x *= rhs; s3::w *= rhs; return *this; }
-		const YXW& operator/=(const TYPE& rhs) { s3::y /= rhs; s3::x /= rhs; s3::w /= rhs; return *this; }
-	};
-	struct YYX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::x); } };
-	struct YYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::y); } };
-	struct YYZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::z); } };
-	struct YYW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::y, s3::w); } };
-	struct YZX : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::z, s3::x); }
-		const YZX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y = rhs.v.x; s3::z = t0; s3::x = t1; return *this; }
-		const YZX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y += rhs.v.x; s3::z += t0; s3::x += t1; return *this; }
-		const YZX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y -= rhs.v.x; s3::z -= t0; s3::x -= t1; return *this; }
-		const YZX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y *= rhs.v.x; s3::z *= t0; s3::x *= t1; return *this; }
-		const YZX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y /= rhs.v.x; s3::z /= t0; s3::x /= t1; return *this; }
-		const YZX& operator*=(const TYPE& rhs) { s3::y *= rhs; s3::z *= rhs; s3::x *= rhs; return *this; }
-		const YZX& operator/=(const TYPE& rhs) { s3::y /= rhs; s3::z /= rhs; s3::x /= rhs; return *this; }
-	};
-	struct YZY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::z, s3::y); } };
-	struct YZZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::z, s3::z); } };
-	struct YZW : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::z, s3::w); }
-		const YZW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y = rhs.v.x; s3::z = t0; s3::w = t1; return *this; }
-		const YZW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y += rhs.v.x; s3::z += t0; s3::w += t1; return *this; }
-		const YZW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y -= rhs.v.x; s3::z -= t0; s3::w -= t1; return *this; }
-		const YZW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y *= rhs.v.x; s3::z *= t0; s3::w *= t1; return *this; }
-		const YZW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y /= rhs.v.x; s3::z /= t0; s3::w /= t1; return *this; }
-		const YZW& operator*=(const TYPE& rhs) { s3::y *= rhs; s3::z *= rhs; s3::w *= rhs; return *this; }
-		const YZW& operator/=(const TYPE& rhs) { s3::y /= rhs; s3::z /= rhs; s3::w /= rhs; return *this; }
-	};
-	struct YWX : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::w, s3::x); }
-		const YWX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y = rhs.v.x; s3::w = t0; s3::x = t1; return *this; }
-		const YWX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y += rhs.v.x; s3::w += t0; s3::x += t1; return *this; }
-		const YWX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y -= rhs.v.x; s3::w -= t0; s3::x -= t1; return *this; }
-		const YWX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y *= rhs.v.x; s3::w *= t0; s3::x *= t1; return *this; }
-		const YWX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::y /= rhs.v.x; s3::w /= t0; s3::x /= t1; return *this; }
-		const YWX& operator*=(const TYPE& rhs) { s3::y *= rhs; s3::w *= rhs; s3::x *= rhs; return *this; }
-		const YWX& operator/=(const TYPE& rhs) { s3::y /= rhs; s3::w /= rhs; s3::x /= rhs; return *this; }
-	};
-	struct YWY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::w, s3::y); } };
-	struct YWZ : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::w, s3::z); }
-		const YWZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y = rhs.v.x; s3::w = t0; s3::z = rhs.v.z; return *this; }
-		const YWZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y += rhs.v.x; s3::w += t0; s3::z += rhs.v.z; return *this; }
-		const YWZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y -= rhs.v.x; s3::w -= t0; s3::z -= rhs.v.z; return *this; }
-		const YWZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y *= rhs.v.x; s3::w *= t0; s3::z *= rhs.v.z; return *this; }
-		const YWZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::y /= rhs.v.x; s3::w /= t0; s3::z /= rhs.v.z; return *this; }
-		const YWZ& operator*=(const TYPE& rhs) { s3::y *= rhs; s3::w *= rhs; s3::z *= rhs; return *this; }
-		const YWZ& operator/=(const TYPE& rhs) { s3::y /= rhs; s3::w /= rhs; s3::z /= rhs; return *this; }
-	};
-	struct YWW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::y, s3::w, s3::w); } };
-	struct ZXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::x, s3::x); } };
-	struct ZXY : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::x, s3::y); }
-		const ZXY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z = rhs.v.x; s3::x = t0; s3::y = t1; return *this; }
-		const ZXY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z += rhs.v.x; s3::x += t0; s3::y += t1; return *this; }
-		const ZXY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z -= rhs.v.x; s3::x -= t0; s3::y -= t1; return *this; }
-		const ZXY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z *= rhs.v.x; s3::x *= t0; s3::y *= t1; return *this; }
-		const ZXY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z /= rhs.v.x; s3::x /= t0; s3::y /= t1; return *this; }
-		const ZXY& operator*=(const TYPE& rhs) { s3::z *= rhs; s3::x *= rhs; s3::y *= rhs; return *this; }
-		const ZXY& operator/=(const TYPE& rhs) { s3::z /= rhs; s3::x /= rhs; s3::y /= rhs; return *this; }
-	};
-	struct ZXZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::x, s3::z); } };
-	struct ZXW : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::x, s3::w); }
-		const ZXW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z = rhs.v.x; s3::x = t0; s3::w = t1; return *this; }
-		const ZXW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z += rhs.v.x; s3::x += t0; s3::w += t1; return *this; }
-		const ZXW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z -= rhs.v.x; s3::x -= t0; s3::w -= t1; return *this; }
-		const ZXW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z *= rhs.v.x; s3::x *= t0; s3::w *= t1; return *this; }
-		const ZXW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z /= rhs.v.x; s3::x /= t0; s3::w /= t1; return *this; }
-		const ZXW& operator*=(const TYPE& rhs) { s3::z *= rhs; s3::x *= rhs; s3::w *= rhs; return *this; }
-		const ZXW& operator/=(const TYPE& rhs) { s3::z /= rhs; s3::x /= rhs; s3::w /= rhs; return *this; }
-	};
-	struct ZYX : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::y, s3::x); }
-		const ZYX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z = rhs.v.x; s3::y = rhs.v.y; s3::x = t0; return *this; }
-		const ZYX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z += rhs.v.x; s3::y += rhs.v.y; s3::x += t0; return *this; }
-		const ZYX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z -= rhs.v.x; s3::y -= rhs.v.y; s3::x -= t0; return *this; }
-		const ZYX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z *= rhs.v.x; s3::y *= rhs.v.y; s3::x *= t0; return *this; }
-		const ZYX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z /= rhs.v.x; s3::y /= rhs.v.y; s3::x /= t0; return *this; }
-		const ZYX& operator*=(const TYPE& rhs) { s3::z *= rhs; s3::y *= rhs; s3::x *= rhs; return *this; }
-		const ZYX& operator/=(const TYPE& rhs) { s3::z /= rhs; s3::y /= rhs; s3::x /= rhs; return *this; }
-	};
-	struct ZYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::y, s3::y); } };
-	struct ZYZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::y, s3::z); } };
-	struct ZYW : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::y, s3::w); }
-		const ZYW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z = rhs.v.x; s3::y = rhs.v.y; s3::w = t0; return *this; }
-		const ZYW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z += rhs.v.x; s3::y += rhs.v.y; s3::w += t0; return *this; }
-		const ZYW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z -= rhs.v.x; s3::y -= rhs.v.y; s3::w -= t0; return *this; }
-		const ZYW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z *= rhs.v.x; s3::y *= rhs.v.y; s3::w *= t0; return *this; }
-		const ZYW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::z /= rhs.v.x; s3::y /= rhs.v.y; s3::w /= t0; return *this; }
-		const ZYW& operator*=(const TYPE& rhs) { s3::z *= rhs; s3::y *= rhs; s3::w *= rhs; return *this; }
-		const ZYW& operator/=(const TYPE& rhs) { s3::z /= rhs; s3::y /= rhs; s3::w /= rhs; return *this; }
-	};
-	struct ZZX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::z, s3::x); } };
-	struct ZZY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::z, s3::y); } };
-	struct ZZZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::z, s3::z); } };
-	struct ZZW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::z, s3::w); } };
-	struct ZWX : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::w, s3::x); }
-		const ZWX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z = rhs.v.x; s3::w = t0; s3::x = t1; return *this; }
-		const ZWX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z += rhs.v.x; s3::w += t0; s3::x += t1; return *this; }
-		const ZWX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z -= rhs.v.x; s3::w -= t0; s3::x -= t1; return *this; }
-		const ZWX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z *= rhs.v.x; s3::w *= t0; s3::x *= t1; return *this; }
-		const ZWX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z /= rhs.v.x; s3::w /= t0; s3::x /= t1; return *this; }
-		const ZWX& operator*=(const TYPE& rhs) { s3::z *= rhs; s3::w *= rhs; s3::x *= rhs; return *this; }
-		const ZWX& operator/=(const TYPE& rhs) { s3::z /= rhs; s3::w /= rhs; s3::x /= rhs; return *this; }
-	};
-	struct ZWY : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::w, s3::y); }
-		const ZWY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z = rhs.v.x; s3::w = t0; s3::y = t1; return *this; }
-		const ZWY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z += rhs.v.x; s3::w += t0; s3::y += t1; return *this; }
-		const ZWY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z -= rhs.v.x; s3::w -= t0; s3::y -= t1; return *this; }
-		const ZWY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z *= rhs.v.x; s3::w *= t0; s3::y *= t1; return *this; }
-		const ZWY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::z /= rhs.v.x; s3::w /= t0; s3::y /= t1; return *this; }
-		const ZWY& operator*=(const TYPE& rhs) { s3::z *= rhs; s3::w *= rhs; s3::y *= rhs; return *this; }
-		const ZWY& operator/=(const TYPE& rhs) { s3::z /= rhs; s3::w /= rhs; s3::y /= rhs; return *this; }
-	};
-	struct ZWZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::w, s3::z); } };
-	struct ZWW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::z, s3::w, s3::w); } };
-	struct WXX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::x, s3::x); } };
-	struct WXY : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::x, s3::y); }
-		const WXY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w = rhs.v.x; s3::x = t0; s3::y = t1; return *this; }
-		const WXY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w += rhs.v.x; s3::x += t0; s3::y += t1; return *this; }
-		const WXY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w -= rhs.v.x; s3::x -= t0; s3::y -= t1; return *this; }
-		const WXY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w *= rhs.v.x; s3::x *= t0; s3::y *= t1; return *this; }
-		const WXY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w /= rhs.v.x; s3::x /= t0; s3::y /= t1; return *this; }
-		const WXY& operator*=(const TYPE& rhs) { s3::w *= rhs; s3::x *= rhs; s3::y *= rhs; return *this; }
-		const WXY& operator/=(const TYPE& rhs) { s3::w /= rhs; s3::x /= rhs; s3::y /= rhs; return *this; }
-	};
-	struct WXZ : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::x, s3::z); }
-		const WXZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::w = rhs.v.x; s3::x = t0; s3::z = rhs.v.z; return *this; }
-		const WXZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::w += rhs.v.x; s3::x += t0; s3::z += rhs.v.z; return *this; }
-		const WXZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::w -= rhs.v.x; s3::x -= t0; s3::z -= rhs.v.z; return *this; }
-		const WXZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::w *= rhs.v.x; s3::x *= t0; s3::z *= rhs.v.z; return *this; }
-		const WXZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s3::w /= rhs.v.x; s3::x /= t0; s3::z /= rhs.v.z; return *this; }
-		const WXZ& operator*=(const TYPE& rhs) { s3::w *= rhs; s3::x *= rhs; s3::z *= rhs; return *this; }
-		const WXZ& operator/=(const TYPE& rhs) { s3::w /= rhs; s3::x /= rhs; s3::z /= rhs; return *this; }
-	};
-	struct WXW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::x, s3::w); } };
-	struct WYX : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::y, s3::x); }
-		const WYX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::w = rhs.v.x; s3::y = rhs.v.y; s3::x = t0; return *this; }
-		const WYX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::w += rhs.v.x; s3::y += rhs.v.y; s3::x += t0; return *this; }
-		const WYX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::w -= rhs.v.x; s3::y -= rhs.v.y; s3::x -= t0; return *this; }
-		const WYX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::w *= rhs.v.x; s3::y *= rhs.v.y; s3::x *= t0; return *this; }
-		const WYX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s3::w /= rhs.v.x; s3::y /= rhs.v.y; s3::x /= t0; return *this; }
-		const WYX& operator*=(const TYPE& rhs) { s3::w *= rhs; s3::y *= rhs; s3::x *= rhs; return *this; }
-		const WYX& operator/=(const TYPE& rhs) { s3::w /= rhs; s3::y /= rhs; s3::x /= rhs; return *this; }
-	};
-	struct WYY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::y, s3::y); } };
-	struct WYZ : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::y, s3::z); }
-		const WYZ& operator=(const VECTOR4<TYPE>& rhs) { s3::w = rhs.v.x; s3::y = rhs.v.y; s3::z = rhs.v.z; return *this; }
-		const WYZ& operator+=(const VECTOR4<TYPE>& rhs) { s3::w += rhs.v.x; s3::y += rhs.v.y; s3::z += rhs.v.z; return *this; }
-		const WYZ& operator-=(const VECTOR4<TYPE>& rhs) { s3::w -= rhs.v.x; s3::y -= rhs.v.y; s3::z -= rhs.v.z; return *this; }
-		const WYZ& operator*=(const VECTOR4<TYPE>& rhs) { s3::w *= rhs.v.x; s3::y *= rhs.v.y; s3::z *= rhs.v.z; return *this; }
-		const WYZ& operator/=(const VECTOR4<TYPE>& rhs) { s3::w /= rhs.v.x; s3::y /= rhs.v.y; s3::z /= rhs.v.z; return *this; }
-		const WYZ& operator*=(const TYPE& rhs) { s3::w *= rhs; s3::y *= rhs; s3::z *= rhs; return *this; }
-		const WYZ& operator/=(const TYPE& rhs) { s3::w /= rhs; s3::y /= rhs; s3::z /= rhs; return *this; }
-	};
-	struct WYW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::y, s3::w); } };
-	struct WZX : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::z, s3::x); }
-		const WZX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w = rhs.v.x; s3::z = t0; s3::x = t1; return *this; }
-		const WZX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w += rhs.v.x; s3::z += t0; s3::x += t1; return *this; }
-		const WZX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w -= rhs.v.x; s3::z -= t0; s3::x -= t1; return *this; }
-		const WZX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w *= rhs.v.x; s3::z *= t0; s3::x *= t1; return *this; }
-		const WZX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w /= rhs.v.x; s3::z /= t0; s3::x /= t1; return *this; }
-		const WZX& operator*=(const TYPE& rhs) { s3::w *= rhs; s3::z *= rhs; s3::x *= rhs; return *this; }
-		const WZX& operator/=(const TYPE& rhs) { s3::w /= rhs; s3::z /= rhs; s3::x /= rhs; return *this; }
-	};
-	struct WZY : s3
-	{
-		operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::z, s3::y); }
-		const WZY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w = rhs.v.x; s3::z = t0; s3::y = t1; return *this; }
-		const WZY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w += rhs.v.x; s3::z += t0; s3::y += t1; return *this; }
-		const WZY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w -= rhs.v.x; s3::z -= t0; s3::y -= t1; return *this; }
-		const WZY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w *= rhs.v.x; s3::z *= t0; s3::y *= t1; return *this; }
-		const WZY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s3::w /= rhs.v.x; s3::z /= t0; s3::y /= t1; return *this; }
-		const WZY& operator*=(const TYPE& rhs) { s3::w *= rhs; s3::z *= rhs; s3::y *= rhs; return *this; }
-		const WZY& operator/=(const TYPE& rhs) { s3::w /= rhs; s3::z /= rhs; s3::y /= rhs; return *this; }
-	};
-	struct WZZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::z, s3::z); } };
-	struct WZW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::z, s3::w); } };
-	struct WWX : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::w, s3::x); } };
-	struct WWY : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::w, s3::y); } };
-	struct WWZ : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::w, s3::z); } };
-	struct WWW : s3 { operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(s3::w, s3::w, s3::w); } };
-	struct XXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::x); } };
-	struct XXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::y); } };
-	struct XXXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::z); } };
-	struct XXXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::x, s4::w); } };
-	struct XXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::x); } };
-	struct XXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::y); } };
-	struct XXYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::z); } };
-	struct XXYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::y, s4::w); } };
-	struct XXZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::z, s4::x); } };
-	struct XXZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::z, s4::y); } };
-	struct XXZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::z, s4::z); } };
-	struct XXZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::z, s4::w); } };
-	struct XXWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::w, s4::x); } };
-	struct XXWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::w, s4::y); } };
-	struct XXWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::w, s4::z); } };
-	struct XXWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::x, s4::w, s4::w); } };
-	struct XYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::x); } };
-	struct XYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::y); } };
-	struct XYXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::z); } };
-	struct XYXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::x, s4::w); } };
-	struct XYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::x); } };
-	struct XYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::y); } };
-	struct XYYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::z); } };
-	struct XYYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::y, s4::w); } };
-	struct XYZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::z, s4::x); } };
-	struct XYZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::z, s4::y); } };
-	struct XYZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::z, s4::z); } };
-	struct XYZW : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::z, s4::w); }
-		const XYZW& operator=(const VECTOR4<TYPE>& rhs) { s4::x = rhs.v.x; s4::y = rhs.v.y; s4::z = rhs.v.z; s4::w = rhs.v.w; return *this; }
-		const XYZW& operator+=(const VECTOR4<TYPE>& rhs) { s4::x += rhs.v.x; s4::y += rhs.v.y; s4::z += rhs.v.z; s4::w += rhs.v.w; return *this; }
-		const XYZW& operator-=(const VECTOR4<TYPE>& rhs) { s4::x -= rhs.v.x; s4::y -= rhs.v.y; s4::z -= rhs.v.z; s4::w -= rhs.v.w; return *this; }
-		const XYZW& operator*=(const VECTOR4<TYPE>& rhs) { s4::x *= rhs.v.x; s4::y *= rhs.v.y; s4::z *= rhs.v.z; s4::w *= rhs.v.w; return *this; }
-		const XYZW& operator/=(const VECTOR4<TYPE>& rhs) { s4::x /= rhs.v.x; s4::y /= rhs.v.y; s4::z /= rhs.v.z; s4::w /= rhs.v.w; return *this; }
-		const XYZW& operator*=(const TYPE& rhs) { s4::x *= rhs; s4::y *= rhs; s4::z *= rhs; s4::w *= rhs; return *this; }
-		const XYZW& operator/=(const TYPE& rhs) { s4::x /= rhs; s4::y /= rhs; s4::z /= rhs; s4::w /= rhs; return *this; }
-	};
-	struct XYWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::w, s4::x); } };
-	struct XYWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::w, s4::y); } };
-	struct XYWZ : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::w, s4::z); }
-		const XYWZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x = rhs.v.x; s4::y = rhs.v.y; s4::w = rhs.v.z; s4::z = t0; return *this; }
-		const XYWZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x += rhs.v.x; s4::y += rhs.v.y; s4::w += rhs.v.z; s4::z += t0; return *this; }
-		const XYWZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x -= rhs.v.x; s4::y -= rhs.v.y; s4::w -= rhs.v.z; s4::z -= t0; return *this; }
-		const XYWZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x *= rhs.v.x; s4::y *= rhs.v.y; s4::w *= rhs.v.z; s4::z *= t0; return *this; }
-		const XYWZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x /= rhs.v.x; s4::y /= rhs.v.y; s4::w /= rhs.v.z; s4::z /= t0; return *this; }
-		const XYWZ& operator*=(const TYPE& rhs) { s4::x *= rhs; s4::y *= rhs; s4::w *= rhs; s4::z *= rhs; return *this; }
-		const XYWZ& operator/=(const TYPE& rhs) { s4::x /= rhs; s4::y /= rhs; s4::w /= rhs; s4::z /= rhs; return *this; }
-	};
-	struct XYWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::y, s4::w, s4::w); } };
-	struct XZXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::x, s4::x); } };
-	struct XZXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::x, s4::y); } };
-	struct XZXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::x, s4::z); } };
-	struct XZXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::x, s4::w); } };
-	struct XZYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::y, s4::x); } };
-	struct XZYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::y, s4::y); } };
-	struct XZYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::y, s4::z); } };
-	struct XZYW : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::y, s4::w); }
-		const XZYW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::x = rhs.v.x; s4::z = rhs.v.y; s4::y = t0; s4::w = rhs.v.w; return *this; }
-		const XZYW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::x += rhs.v.x; s4::z += rhs.v.y; s4::y += t0; s4::w += rhs.v.w; return *this; }
-		const XZYW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::x -= rhs.v.x; s4::z -= rhs.v.y; s4::y -= t0; s4::w -= rhs.v.w; return *this; }
-		const XZYW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::x *= rhs.v.x; s4::z *= rhs.v.y; s4::y *= t0; s4::w *= rhs.v.w; return *this; }
-		const XZYW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::x /= rhs.v.x; s4::z /= rhs.v.y; s4::y /= t0; s4::w /= rhs.v.w; return *this; }
-		const XZYW& operator*=(const TYPE& rhs) { s4::x *= rhs; s4::z *= rhs; s4::y *= rhs; s4::w *= rhs; return *this; }
-		const XZYW& operator/=(const TYPE& rhs) { s4::x /= rhs; s4::z /= rhs; s4::y /= rhs; s4::w /= rhs; return *this; }
-	};
-	struct XZZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::z, s4::x); } };
-	struct XZZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::z, s4::y); } };
-	struct XZZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::z, s4::z); } };
-	struct XZZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::z, s4::w); } };
-	struct XZWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::w, s4::x); } };
-	struct XZWY : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::w, s4::y); }
-		const XZWY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x = rhs.v.x; s4::z = rhs.v.y; s4::w = t0; s4::y = t1; return *this; }
-		const XZWY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x += rhs.v.x; s4::z += rhs.v.y; s4::w += t0; s4::y += t1; return *this; }
-		const XZWY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x -= rhs.v.x; s4::z -= rhs.v.y; s4::w -= t0; s4::y -= t1; return *this; }
-		const XZWY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x *= rhs.v.x; s4::z *= rhs.v.y; s4::w *= t0; s4::y *= t1; return *this; }
-		const XZWY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x /= rhs.v.x; s4::z /= rhs.v.y; s4::w /= t0; s4::y /= t1; return *this; }
-		const XZWY& operator*=(const TYPE& rhs) { s4::x *= rhs; s4::z *= rhs; s4::w *= rhs; s4::y *= rhs; return *this; }
-		const XZWY& operator/=(const TYPE& rhs) { s4::x /= rhs; s4::z /= rhs; s4::w /= rhs; s4::y /= rhs; return *this; }
-	};
-	struct XZWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::w, s4::z); } };
-	struct XZWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::z, s4::w, s4::w); } };
-	struct XWXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::x, s4::x); } };
-	struct XWXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::x, s4::y); } };
-	struct XWXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::x, s4::z); } };
-	struct XWXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::x, s4::w); } };
-	struct XWYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::y, s4::x); } };
-	struct XWYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::y, s4::y); } };
-	struct XWYZ : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::y, s4::z); }
-		const XWYZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x = rhs.v.x; s4::w = rhs.v.y; s4::y = t0; s4::z = t1; return *this; }
-		const XWYZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x += rhs.v.x; s4::w += rhs.v.y; s4::y += t0; s4::z += t1; return *this; }
-		const XWYZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x -= rhs.v.x; s4::w -= rhs.v.y; s4::y -= t0; s4::z -= t1; return *this; }
-		const XWYZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x *= rhs.v.x; s4::w *= rhs.v.y; s4::y *= t0; s4::z *= t1; return *this; }
-		const XWYZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::x /= rhs.v.x; s4::w /= rhs.v.y; s4::y /= t0; s4::z /= t1; return *this; }
-		const XWYZ& operator*=(const TYPE& rhs) { s4::x *= rhs; s4::w *= rhs; s4::y *= rhs; s4::z *= rhs; return *this; }
-		const XWYZ& operator/=(const TYPE& rhs) { s4::x /= rhs; s4::w /= rhs; s4::y /= rhs; s4::z /= rhs; return *this; }
-	};
-	struct XWYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::y, s4::w); } };
-	struct XWZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::z, s4::x); } };
-	struct XWZY : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::z, s4::y); }
-		const XWZY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x = rhs.v.x; s4::w = rhs.v.y; s4::z = rhs.v.z; s4::y = t0; return *this; }
-		const XWZY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x += rhs.v.x; s4::w += rhs.v.y; s4::z += rhs.v.z; s4::y += t0; return *this; }
-		const XWZY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x -= rhs.v.x; s4::w -= rhs.v.y; s4::z -= rhs.v.z; s4::y -= t0; return *this; }
-		const XWZY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x *= rhs.v.x; s4::w *= rhs.v.y; s4::z *= rhs.v.z; s4::y *= t0; return *this; }
-		const XWZY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::x /= rhs.v.x; s4::w /= rhs.v.y; s4::z /= rhs.v.z; s4::y /= t0; return *this; }
-		const XWZY& operator*=(const TYPE& rhs) { s4::x *= rhs; s4::w *= rhs; s4::z *= rhs; s4::y *= rhs; return *this; }
-		const XWZY& operator/=(const TYPE& rhs) { s4::x /= rhs; s4::w /= rhs; s4::z /= rhs; s4::y /= rhs; return *this; }
-	};
-	struct XWZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::z, s4::z); } };
-	struct XWZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::z, s4::w); } };
-	struct XWWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::w, s4::x); } };
-	struct XWWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::w, s4::y); } };
-	struct XWWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::w, s4::z); } };
-	struct XWWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::x, s4::w, s4::w, s4::w); } };
-	struct YXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::x); } };
-	struct YXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::y); } };
-	struct YXXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::z); } };
-	struct YXXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::x, s4::w); } };
-	struct YXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::x); } };
-	struct YXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::y); } };
-	struct YXYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::z); } };
-	struct YXYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::y, s4::w); } };
-	struct YXZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::z, s4::x); } };
-	struct YXZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::z, s4::y); } };
-	struct YXZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::z, s4::z); } };
-	struct YXZW : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::z, s4::w); }
-		const YXZW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s4::y = rhs.v.x; s4::x = t0; s4::z = rhs.v.z; s4::w = rhs.v.w; return *this; }
-		const YXZW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s4::y += rhs.v.x; s4::x += t0; s4::z += rhs.v.z; s4::w += rhs.v.w; return *this; }
-		const YXZW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s4::y -= rhs.v.x; s4::x -= t0; s4::z -= rhs.v.z; s4::w -= rhs.v.w; return *this; }
-		const YXZW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s4::y *= rhs.v.x; s4::x *= t0; s4::z *= rhs.v.z; s4::w *= rhs.v.w; return *this; }
-		const YXZW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; s4::y /= rhs.v.x; s4::x /= t0; s4::z /= rhs.v.z; s4::w /= rhs.v.w; return *this; }
-		const YXZW& operator*=(const TYPE& rhs) { s4::y *= rhs; s4::x *= rhs; s4::z *= rhs; s4::w *= rhs; return *this; }
-		const YXZW& operator/=(const TYPE& rhs) { s4::y /= rhs; s4::x /= rhs; s4::z /= rhs; s4::w /= rhs; return *this; }
-	};
-	struct YXWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::w, s4::x); } };
-	struct YXWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::w, s4::y); } };
-	struct YXWZ : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::w, s4::z); }
-		const YXWZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y = rhs.v.x; s4::x = t0; s4::w = t1; s4::z = t2; return *this; }
-		const YXWZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y += rhs.v.x; s4::x += t0; s4::w += t1; s4::z += t2; return *this; }
-		const YXWZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y -= rhs.v.x; s4::x -= t0; s4::w -= t1; s4::z -= t2; return *this; }
-		const YXWZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y *= rhs.v.x; s4::x *= t0; s4::w *= t1; s4::z *= t2; return *this; }
-		const YXWZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y /= rhs.v.x; s4::x /= t0; s4::w /= t1; s4::z /= t2; return *this; }
-		const YXWZ& operator*=(const TYPE& rhs) { s4::y *= rhs; s4::x *= rhs; s4::w *= rhs; s4::z *= rhs; return *this; }
-		const YXWZ& operator/=(const TYPE& rhs) { s4::y /= rhs; s4::x /= rhs; s4::w /= rhs; s4::z /= rhs; return *this; }
-	};
-	struct YXWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::x, s4::w, s4::w); } };
-	struct YYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::x); } };
-	struct YYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::y); } };
-	struct YYXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::z); } };
-	struct YYXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::x, s4::w); } };
-	struct YYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::x); } };
-	struct YYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::y); } };
-	struct YYYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::z); } };
-	struct YYYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::y, s4::w); } };
-	struct YYZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::z, s4::x); } };
-	struct YYZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::z, s4::y); } };
-	struct YYZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::z, s4::z); } };
-	struct YYZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::z, s4::w); } };
-	struct YYWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::w, s4::x); } };
-	struct YYWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::w, s4::y); } };
-	struct YYWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::w, s4::z); } };
-	struct YYWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::y, s4::w, s4::w); } };
-	struct YZXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::x, s4::x); } };
-	struct YZXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::x, s4::y); } };
-	struct YZXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::x, s4::z); } };
-	struct YZXW : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::x, s4::w); }
-		const YZXW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::y = rhs.v.x; s4::z = t0; s4::x = t1; s4::w = rhs.v.w; return *this; }
-		const YZXW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::y += rhs.v.x; s4::z += t0; s4::x += t1; s4::w += rhs.v.w; return *this; }
-		const YZXW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::y -= rhs.v.x; s4::z -= t0; s4::x -= t1; s4::w -= rhs.v.w; return *this; }
-		const YZXW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::y *= rhs.v.x; s4::z *= t0; s4::x *= t1; s4::w *= rhs.v.w; return *this; }
-		const YZXW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::y /= rhs.v.x; s4::z /= t0; s4::x /= t1; s4::w /= rhs.v.w; return *this; }
-		const YZXW& operator*=(const TYPE& rhs) { s4::y *= rhs; s4::z *= rhs; s4::x *= rhs; s4::w *= rhs; return *this; }
-		const YZXW& operator/=(const TYPE& rhs) { s4::y /= rhs; s4::z /= rhs; s4::x /= rhs; s4::w /= rhs; return *this; }
-	};
-	struct YZYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::y, s4::x); } };
-	struct YZYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::y, s4::y); } };
-	struct YZYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::y, s4::z); } };
-	struct YZYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::y, s4::w); } };
-	struct YZZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::z, s4::x); } };
-	struct YZZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::z, s4::y); } };
-	struct YZZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::z, s4::z); } };
-	struct YZZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::z, s4::w); } };
-	struct YZWX : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::w, s4::x); }
-		const YZWX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y = rhs.v.x; s4::z = t0; s4::w = t1; s4::x = t2; return *this; }
-		const YZWX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y += rhs.v.x; s4::z += t0; s4::w += t1; s4::x += t2; return *this; }
-		const YZWX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y -= rhs.v.x; s4::z -= t0; s4::w -= t1; s4::x -= t2; return *this; }
-		const YZWX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y *= rhs.v.x; s4::z *= t0; s4::w *= t1; s4::x *= t2; return *this; }
-		const YZWX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y /= rhs.v.x; s4::z /= t0; s4::w /= t1; s4::x /= t2; return *this; }
-		const YZWX& operator*=(const TYPE& rhs) { s4::y *= rhs; s4::z *= rhs; s4::w *= rhs; s4::x *= rhs; return *this; }
-		const YZWX& operator/=(const TYPE& rhs) { s4::y /= rhs; s4::z /= rhs; s4::w /= rhs; s4::x /= rhs; return *this; }
-	};
-	struct YZWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::w, s4::y); } };
-	struct YZWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::w, s4::z); } };
-	struct YZWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::z, s4::w, s4::w); } };
-	struct YWXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::x, s4::x); } };
-	struct YWXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::x, s4::y); } };
-	struct YWXZ : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::x, s4::z); }
-		const YWXZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y = rhs.v.x; s4::w = t0; s4::x = t1; s4::z = t2; return *this; }
-		const YWXZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y += rhs.v.x; s4::w += t0; s4::x += t1; s4::z += t2; return *this; }
-		const YWXZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y -= rhs.v.x; s4::w -= t0; s4::x -= t1; s4::z -= t2; return *this; }
-		const YWXZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y *= rhs.v.x; s4::w *= t0; s4::x *= t1; s4::z *= t2; return *this; }
-		const YWXZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::y /= rhs.v.x; s4::w /= t0; s4::x /= t1; s4::z /= t2; return *this; }
-		const YWXZ& operator*=(const TYPE& rhs) { s4::y *= rhs; s4::w *= rhs; s4::x *= rhs; s4::z *= rhs; return *this; }
-		const YWXZ& operator/=(const TYPE& rhs) { s4::y /= rhs; s4::w /= rhs; s4::x /= rhs; s4::z /= rhs; return *this; }
-	};
-	struct YWXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::x, s4::w); } };
-	struct YWYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::y, s4::x); } };
-	struct YWYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::y, s4::y); } };
-	struct YWYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::y, s4::z); } };
-	struct YWYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::y, s4::w); } };
-	struct YWZX : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::z, s4::x); }
-		const YWZX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::y = rhs.v.x; s4::w = t0; s4::z = rhs.v.z; s4::x = t1; return *this; }
-		const YWZX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::y += rhs.v.x; s4::w += t0; s4::z += rhs.v.z; s4::x += t1; return *this; }
-		const YWZX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::y -= rhs.v.x; s4::w -= t0; s4::z -= rhs.v.z; s4::x -= t1; return *this; }
-		const YWZX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::y *= rhs.v.x; s4::w *= t0; s4::z *= rhs.v.z; s4::x *= t1; return *this; }
-		const YWZX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::y /= rhs.v.x; s4::w /= t0; s4::z /= rhs.v.z; s4::x /= t1; return *this; }
-		const YWZX& operator*=(const TYPE& rhs) { s4::y *= rhs; s4::w *= rhs; s4::z *= rhs; s4::x *= rhs; return *this; }
-		const YWZX& operator/=(const TYPE& rhs) { s4::y /= rhs; s4::w /= rhs; s4::z /= rhs; s4::x /= rhs; return *this; }
-	};
-	struct YWZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::z, s4::y); } };
-	struct YWZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::z, s4::z); } };
-	struct YWZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::z, s4::w); } };
-	struct YWWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::w, s4::x); } };
-	struct YWWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::w, s4::y); } };
-	struct YWWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::w, s4::z); } };
-	struct YWWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::y, s4::w, s4::w, s4::w); } };
-	struct ZXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::x, s4::x); } };
-	struct ZXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::x, s4::y); } };
-	struct ZXXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::x, s4::z); } };
-	struct ZXXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::x, s4::w); } };
-	struct ZXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::y, s4::x); } };
-	struct ZXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::y, s4::y); } };
-	struct ZXYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::y, s4::z); } };
-	struct ZXYW : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::y, s4::w); }
-		const ZXYW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::z = rhs.v.x; s4::x = t0; s4::y = t1; s4::w = rhs.v.w; return *this; }
-		const ZXYW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::z += rhs.v.x; s4::x += t0; s4::y += t1; s4::w += rhs.v.w; return *this; }
-		const ZXYW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::z -= rhs.v.x; s4::x -= t0; s4::y -= t1; s4::w -= rhs.v.w; return *this; }
-		const ZXYW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::z *= rhs.v.x; s4::x *= t0; s4::y *= t1; s4::w *= rhs.v.w; return *this; }
-		const ZXYW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; s4::z /= rhs.v.x; s4::x /= t0; s4::y /= t1; s4::w /= rhs.v.w; return *this; }
-		const ZXYW& operator*=(const TYPE& rhs) { s4::z *= rhs; s4::x *= rhs; s4::y *= rhs; s4::w *= rhs; return *this; }
-		const ZXYW& operator/=(const TYPE& rhs) { s4::z /= rhs; s4::x /= rhs; s4::y /= rhs; s4::w /= rhs; return *this; }
-	};
-	struct ZXZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::z, s4::x); } };
-	struct ZXZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::z, s4::y); } };
-	struct ZXZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::z, s4::z); } };
-	struct ZXZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::z, s4::w); } };
-	struct ZXWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::w, s4::x); } };
-	struct ZXWY : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::w, s4::y); }
-		const ZXWY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z = rhs.v.x; s4::x = t0; s4::w = t1; s4::y = t2; return *this; }
-		const ZXWY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z += rhs.v.x; s4::x += t0; s4::w += t1; s4::y += t2; return *this; }
-		const ZXWY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z -= rhs.v.x; s4::x -= t0; s4::w -= t1; s4::y -= t2; return *this; }
-		const ZXWY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z *= rhs.v.x; s4::x *= t0; s4::w *= t1; s4::y *= t2; return *this; }
-		const ZXWY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z /= rhs.v.x; s4::x /= t0; s4::w /= t1; s4::y /= t2; return *this; }
-		const ZXWY& operator*=(const TYPE& rhs) { s4::z *= rhs; s4::x *= rhs; s4::w *= rhs; s4::y *= rhs; return *this; }
-		const ZXWY& operator/=(const TYPE& rhs) { s4::z /= rhs; s4::x /= rhs; s4::w /= rhs; s4::y /= rhs; return *this; }
-	};
-	struct ZXWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::w, s4::z); } };
-	struct ZXWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::x, s4::w, s4::w); } };
-	struct ZYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::x, s4::x); } };
-	struct ZYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::x, s4::y); } };
-	struct ZYXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::x, s4::z); } };
-	struct ZYXW : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::x, s4::w); }
-		const ZYXW& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::z = rhs.v.x; s4::y = rhs.v.y; s4::x = t0; s4::w = rhs.v.w; return *this; }
-		const ZYXW& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::z += rhs.v.x; s4::y += rhs.v.y; s4::x += t0; s4::w += rhs.v.w; return *this; }
-		const ZYXW& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::z -= rhs.v.x; s4::y -= rhs.v.y; s4::x -= t0; s4::w -= rhs.v.w; return *this; }
-		const ZYXW& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::z *= rhs.v.x; s4::y *= rhs.v.y; s4::x *= t0; s4::w *= rhs.v.w; return *this; }
-		const ZYXW& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; s4::z /= rhs.v.x; s4::y /= rhs.v.y; s4::x /= t0; s4::w /= rhs.v.w; return *this; }
-		const ZYXW& operator*=(const TYPE& rhs) { s4::z *= rhs; s4::y *= rhs; s4::x *= rhs; s4::w *= rhs; return *this; }
-		const ZYXW& operator/=(const TYPE& rhs) { s4::z /= rhs; s4::y /= rhs; s4::x /= rhs; s4::w /= rhs; return *this; }
-	};
-	struct ZYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::y, s4::x); } };
-	struct ZYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::y, s4::y); } };
-	struct ZYYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::y, s4::z); } };
-	struct ZYYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::y, s4::w); } };
-	struct ZYZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::z, s4::x); } };
-	struct ZYZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::z, s4::y); } };
-	struct ZYZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::z, s4::z); } };
-	struct ZYZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::z, s4::w); } };
-	struct ZYWX : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::w, s4::x); }
-		const ZYWX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::z = rhs.v.x; s4::y = rhs.v.y; s4::w = t0; s4::x = t1; return *this; }
-		const ZYWX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::z += rhs.v.x; s4::y += rhs.v.y; s4::w += t0; s4::x += t1; return *this; }
-		const ZYWX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::z -= rhs.v.x; s4::y -= rhs.v.y; s4::w -= t0; s4::x -= t1; return *this; }
-		const ZYWX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::z *= rhs.v.x; s4::y *= rhs.v.y; s4::w *= t0; s4::x *= t1; return *this; }
-		const ZYWX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::z /= rhs.v.x; s4::y /= rhs.v.y; s4::w /= t0; s4::x /= t1; return *this; }
-		const ZYWX& operator*=(const TYPE& rhs) { s4::z *= rhs; s4::y *= rhs; s4::w *= rhs; s4::x *= rhs; return *this; }
-		const ZYWX& operator/=(const TYPE& rhs) { s4::z /= rhs; s4::y /= rhs; s4::w /= rhs; s4::x /= rhs; return *this; }
-	};
-	struct ZYWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::w, s4::y); } };
-	struct ZYWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::w, s4::z); } };
-	struct ZYWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::y, s4::w, s4::w); } };
-	struct ZZXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::x, s4::x); } };
-	struct ZZXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::x, s4::y); } };
-	struct ZZXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::x, s4::z); } };
-	struct ZZXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::x, s4::w); } };
-	struct ZZYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::y, s4::x); } };
-	struct ZZYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::y, s4::y); } };
-	struct ZZYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::y, s4::z); } };
-	struct ZZYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::y, s4::w); } };
-	struct ZZZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::z, s4::x); } };
-	struct ZZZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::z, s4::y); } };
-	struct ZZZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::z, s4::z); } };
-	struct ZZZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::z, s4::w); } };
-	struct ZZWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::w, s4::x); } };
-	struct ZZWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::w, s4::y); } };
-	struct ZZWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::w, s4::z); } };
-	struct ZZWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::z, s4::w, s4::w); } };
-	struct ZWXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::x, s4::x); } };
-	struct ZWXY : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::x, s4::y); }
-		const ZWXY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z = rhs.v.x; s4::w = t0; s4::x = t1; s4::y = t2; return *this; }
-		const ZWXY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z += rhs.v.x; s4::w += t0; s4::x += t1; s4::y += t2; return *this; }
-		const ZWXY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z -= rhs.v.x; s4::w -= t0; s4::x -= t1; s4::y -= t2; return *this; }
-		const ZWXY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z *= rhs.v.x; s4::w *= t0; s4::x *= t1; s4::y *= t2; return *this; }
-		const ZWXY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z /= rhs.v.x; s4::w /= t0; s4::x /= t1; s4::y /= t2; return *this; }
-		const ZWXY& operator*=(const TYPE& rhs) { s4::z *= rhs; s4::w *= rhs; s4::x *= rhs; s4::y *= rhs; return *this; }
-		const ZWXY& operator/=(const TYPE& rhs) { s4::z /= rhs; s4::w /= rhs; s4::x /= rhs; s4::y /= rhs; return *this; }
-	};
-	struct ZWXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::x, s4::z); } };
-	struct ZWXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::x, s4::w); } };
-	struct ZWYX : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::y, s4::x); }
-		const ZWYX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z = rhs.v.x; s4::w = t0; s4::y = t1; s4::x = t2; return *this; }
-		const ZWYX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z += rhs.v.x; s4::w += t0; s4::y += t1; s4::x += t2; return *this; }
-		const ZWYX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z -= rhs.v.x; s4::w -= t0; s4::y -= t1; s4::x -= t2; return *this; }
-		const ZWYX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z *= rhs.v.x; s4::w *= t0; s4::y *= t1; s4::x *= t2; return *this; }
-		const ZWYX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::z /= rhs.v.x; s4::w /= t0; s4::y /= t1; s4::x /= t2; return *this; }
-		const ZWYX& operator*=(const TYPE& rhs) { s4::z *= rhs; s4::w *= rhs; s4::y *= rhs; s4::x *= rhs; return *this; }
-		const ZWYX& operator/=(const TYPE& rhs) { s4::z /= rhs; s4::w /= rhs; s4::y /= rhs; s4::x /= rhs; return *this; }
-	};
-	struct ZWYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::y, s4::y); } };
-	struct ZWYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::y, s4::z); } };
-	struct ZWYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::y, s4::w); } };
-	struct ZWZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::z, s4::x); } };
-	struct ZWZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::z, s4::y); } };
-	struct ZWZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::z, s4::z); } };
-	struct ZWZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::z, s4::w); } };
-	struct ZWWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::w, s4::x); } };
-	struct ZWWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::w, s4::y); } };
-	struct ZWWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::w, s4::z); } };
-	struct ZWWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::z, s4::w, s4::w, s4::w); } };
-	struct WXXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::x, s4::x); } };
-	struct WXXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::x, s4::y); } };
-	struct WXXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::x, s4::z); } };
-	struct WXXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::x, s4::w); } };
-	struct WXYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::y, s4::x); } };
-	struct WXYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::y, s4::y); } };
-	struct WXYZ : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::y, s4::z); }
-		const WXYZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w = rhs.v.x; s4::x = t0; s4::y = t1; s4::z = t2; return *this; }
-		const WXYZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w += rhs.v.x; s4::x += t0; s4::y += t1; s4::z += t2; return *this; }
-		const WXYZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w -= rhs.v.x; s4::x -= t0; s4::y -= t1; s4::z -= t2; return *this; }
-		const WXYZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w *= rhs.v.x; s4::x *= t0; s4::y *= t1; s4::z *= t2; return *this; }
-		const WXYZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w /= rhs.v.x; s4::x /= t0; s4::y /= t1; s4::z /= t2; return *this; }
-		const WXYZ& operator*=(const TYPE& rhs) { s4::w *= rhs; s4::x *= rhs; s4::y *= rhs; s4::z *= rhs; return *this; }
-		const WXYZ& operator/=(const TYPE& rhs) { s4::w /= rhs; s4::x /= rhs; s4::y /= rhs; s4::z /= rhs; return *this; }
-	};
-	struct WXYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::y, s4::w); } };
-	struct WXZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::z, s4::x); } };
-	struct WXZY : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::z, s4::y); }
-		const WXZY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::w = rhs.v.x; s4::x = t0; s4::z = rhs.v.z; s4::y = t1; return *this; }
-		const WXZY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::w += rhs.v.x; s4::x += t0; s4::z += rhs.v.z; s4::y += t1; return *this; }
-		const WXZY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::w -= rhs.v.x; s4::x -= t0; s4::z -= rhs.v.z; s4::y -= t1; return *this; }
-		const WXZY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::w *= rhs.v.x; s4::x *= t0; s4::z *= rhs.v.z; s4::y *= t1; return *this; }
-		const WXZY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.w; s4::w /= rhs.v.x; s4::x /= t0; s4::z /= rhs.v.z; s4::y /= t1; return *this; }
-		const WXZY& operator*=(const TYPE& rhs) { s4::w *= rhs; s4::x *= rhs; s4::z *= rhs; s4::y *= rhs; return *this; }
-		const WXZY& operator/=(const TYPE& rhs) { s4::w /= rhs; s4::x /= rhs; s4::z /= rhs; s4::y /= rhs; return *this; }
-	};
-	struct WXZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::z, s4::z); } };
-	struct WXZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::z, s4::w); } };
-	struct WXWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::w, s4::x); } };
-	struct WXWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::w, s4::y); } };
-	struct WXWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::w, s4::z); } };
-	struct WXWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::x, s4::w, s4::w); } };
-	struct WYXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::x, s4::x); } };
-	struct WYXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::x, s4::y); } };
-	struct WYXZ : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::x, s4::z); }
-		const WYXZ& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::w = rhs.v.x; s4::y = rhs.v.y; s4::x = t0; s4::z = t1; return *this; }
-		const WYXZ& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::w += rhs.v.x; s4::y += rhs.v.y; s4::x += t0; s4::z += t1; return *this; }
-		const WYXZ& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::w -= rhs.v.x; s4::y -= rhs.v.y; s4::x -= t0; s4::z -= t1; return *this; }
-		const WYXZ& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::w *= rhs.v.x; s4::y *= rhs.v.y; s4::x *= t0; s4::z *= t1; return *this; }
-		const WYXZ& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.z; TYPE t1 = rhs.v.w; s4::w /= rhs.v.x; s4::y /= rhs.v.y; s4::x /= t0; s4::z /= t1; return *this; }
-		const WYXZ& operator*=(const TYPE& rhs) { s4::w *= rhs; s4::y *= rhs; s4::x *= rhs; s4::z *= rhs; return *this; }
-		const WYXZ& operator/=(const TYPE& rhs) { s4::w /= rhs; s4::y /= rhs; s4::x /= rhs; s4::z /= rhs; return *this; }
-	};
-	struct WYXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::x, s4::w); } };
-	struct WYYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::y, s4::x); } };
-	struct WYYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::y, s4::y); } };
-	struct WYYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::y, s4::z); } };
-	struct WYYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::y, s4::w); } };
-	struct WYZX : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::z, s4::x); }
-		const WYZX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::w = rhs.v.x; s4::y = rhs.v.y; s4::z = rhs.v.z; s4::x = t0; return *this; }
-		const WYZX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::w += rhs.v.x; s4::y += rhs.v.y; s4::z += rhs.v.z; s4::x += t0; return *this; }
-		const WYZX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::w -= rhs.v.x; s4::y -= rhs.v.y; s4::z -= rhs.v.z; s4::x -= t0; return *this; }
-		const WYZX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::w *= rhs.v.x; s4::y *= rhs.v.y; s4::z *= rhs.v.z; s4::x *= t0; return *this; }
-		const WYZX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.w; s4::w /= rhs.v.x; s4::y /= rhs.v.y; s4::z /= rhs.v.z; s4::x /= t0; return *this; }
-		const WYZX& operator*=(const TYPE& rhs) { s4::w *= rhs; s4::y *= rhs; s4::z *= rhs; s4::x *= rhs; return *this; }
-		const WYZX& operator/=(const TYPE& rhs) { s4::w /= rhs; s4::y /= rhs; s4::z /= rhs; s4::x /= rhs; return *this; }
-	};
-	struct WYZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::z, s4::y); } };
-	struct WYZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::z, s4::z); } };
-	struct WYZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::z, s4::w); } };
-	struct WYWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::w, s4::x); } };
-	struct WYWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::w, s4::y); } };
-	struct WYWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::w, s4::z); } };
-	struct WYWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::y, s4::w, s4::w); } };
-	struct WZXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::x, s4::x); } };
-	struct WZXY : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::x, s4::y); }
-		const WZXY& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w = rhs.v.x; s4::z = t0; s4::x = t1; s4::y = t2; return *this; }
-		const WZXY& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w += rhs.v.x; s4::z += t0; s4::x += t1; s4::y += t2; return *this; }
-		const WZXY& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w -= rhs.v.x; s4::z -= t0; s4::x -= t1; s4::y -= t2; return *this; }
-		const WZXY& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w *= rhs.v.x; s4::z *= t0; s4::x *= t1; s4::y *= t2; return *this; }
-		const WZXY& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w /= rhs.v.x; s4::z /= t0; s4::x /= t1; s4::y /= t2; return *this; }
-		const WZXY& operator*=(const TYPE& rhs) { s4::w *= rhs; s4::z *= rhs; s4::x *= rhs; s4::y *= rhs; return *this; }
-		const WZXY& operator/=(const TYPE& rhs) { s4::w /= rhs; s4::z /= rhs; s4::x /= rhs; s4::y /= rhs; return *this; }
-	};
-	struct WZXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::x, s4::z); } };
-	struct WZXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::x, s4::w); } };
-	struct WZYX : s4
-	{
-		operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::y, s4::x); }
-		const WZYX& operator=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w = rhs.v.x; s4::z = t0; s4::y = t1; s4::x = t2; return *this; }
-		const WZYX& operator+=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w += rhs.v.x; s4::z += t0; s4::y += t1; s4::x += t2; return *this; }
-		const WZYX& operator-=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w -= rhs.v.x; s4::z -= t0; s4::y -= t1; s4::x -= t2; return *this; }
-		const WZYX& operator*=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w *= rhs.v.x; s4::z *= t0; s4::y *= t1; s4::x *= t2; return *this; }
-		const WZYX& operator/=(const VECTOR4<TYPE>& rhs) { TYPE t0 = rhs.v.y; TYPE t1 = rhs.v.z; TYPE t2 = rhs.v.w; s4::w /= rhs.v.x; s4::z /= t0; s4::y /= t1; s4::x /= t2; return *this; }
-		const WZYX& operator*=(const TYPE& rhs) { s4::w *= rhs; s4::z *= rhs; s4::y *= rhs; s4::x *= rhs; return *this; }
-		const WZYX& operator/=(const TYPE& rhs) { s4::w /= rhs; s4::z /= rhs; s4::y /= rhs; s4::x /= rhs; return *this; }
-	};
-	struct WZYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::y, s4::y); } };
-	struct WZYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::y, s4::z); } };
-	struct WZYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::y, s4::w); } };
-	struct WZZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::z, s4::x); } };
-	struct WZZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::z, s4::y); } };
-	struct WZZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::z, s4::z); } };
-	struct WZZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::z, s4::w); } };
-	struct WZWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::w, s4::x); } };
-	struct WZWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::w, s4::y); } };
-	struct WZWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::w, s4::z); } };
-	struct WZWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::z, s4::w, s4::w); } };
-	struct WWXX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::x, s4::x); } };
-	struct WWXY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::x, s4::y); } };
-	struct WWXZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::x, s4::z); } };
-	struct WWXW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::x, s4::w); } };
-	struct WWYX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::y, s4::x); } };
-	struct WWYY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::y, s4::y); } };
-	struct WWYZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::y, s4::z); } };
-	struct WWYW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::y, s4::w); } };
-	struct WWZX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::z, s4::x); } };
-	struct WWZY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::z, s4::y); } };
-	struct WWZZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::z, s4::z); } };
-	struct WWZW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::z, s4::w); } };
-	struct WWWX : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::w, s4::x); } };
-	struct WWWY : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::w, s4::y); } };
-	struct WWWZ : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::w, s4::z); } };
-	struct WWWW : s4 { operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(s4::w, s4::w, s4::w, s4::w); } };
-
-	// Length property
-	struct LENGTH
-	{
-	private:
-		TYPE x, y, z, w;
-		TYPE ApplyLength(const TYPE& curMag, const TYPE& newMag)
-		{
-			TYPE inverseScaledMagnitude = newMag / curMag;
-			x *= inverseScaledMagnitude;
-			y *= inverseScaledMagnitude;
-			z *= inverseScaledMagnitude;
-			return newMag;
-		}
-	public:
-		operator TYPE() const { return sqrt(x * x + y * y + z * z); }
-		TYPE operator=(const TYPE& rhs) { return ApplyLength((TYPE)(*this), rhs); }
-		TYPE operator+=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag + rhs); }
-		TYPE operator-=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag - rhs); }
-		TYPE operator*=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag * rhs); }
-		TYPE operator/=(const TYPE& rhs) { TYPE curMag = (TYPE)(*this); return ApplyLength(curMag, curMag / rhs); }
-	};
+		out[i] = matrix * in[i];
+	}
+}
+template <typename OUT, typename A, typename TYPE> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Transform(const OUT& out, const MATRIX3<TYPE>& matrix, const A& a) { Transform(typename OUT::PARENT(out), matrix, typename A::PARENT(a)); }
+template <typename TYPE> void Transform(const VECTOR3_SOA_VIEW<TYPE>& out, const MATRIX3<TYPE>& matrix, const VECTOR3_SOA_VIEW<TYPE>& a)
+{
+	TYPE m00 = matrix[0].x, m01 = matrix[0].y, m02 = matrix[0].z, m10 = matrix[1].x, m11 = matrix[1].y, m12 = matrix[1].z, m20 = matrix[2].x, m21 = matrix[2].y, m22 = matrix[2].z;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			block0[lane] = m00 * aX + m10 * aY + m20 * aZ;
+			block1[lane] = m01 * aX + m11 * aY + m21 * aZ;
+			block2[lane] = m02 * aX + m12 * aY + m22 * aZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		block0[0] = m00 * aX + m10 * aY + m20 * aZ;
+		block1[0] = m01 * aX + m11 * aY + m21 * aZ;
+		block2[0] = m02 * aX + m12 * aY + m22 * aZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
+}
+
+
+
+template <typename TYPE>
+struct MATRIX4
+{
+private:
+	VECTOR4<TYPE> columns[4];
 
 public:
-	VECTOR4() {}
-	VECTOR4(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w) { v.x = x; v.y = y; v.z = z; v.w = w; }
-	VECTOR4(const TYPE& x, const TYPE& y, const VECTOR2<TYPE>& zw) { v.x = x; v.y = y; v.z = zw.x; v.w = zw.y; }
-	VECTOR4(const TYPE& x, const VECTOR2<TYPE>& yz, const TYPE& w) { v.x = x; v.y = yz.x; v.z = yz.y; v.w = w; }
-	VECTOR4(const VECTOR2<TYPE>& xy, const TYPE& z, const TYPE& w) { v.x = xy.x; v.y = xy.y; v.z = z; v.w = w; }
-	VECTOR4(const VECTOR2<TYPE>& xy, const VECTOR2<TYPE>& zw) { v.x = xy.x; v.y = xy.y; v.z = zw.x; v.w = zw.y; }
-	VECTOR4(const TYPE& x, const VECTOR3<TYPE>& yzw) { v.x = x; v.y = yzw.x; v.z = yzw.y; v.w = yzw.z; }
-	VECTOR4(const VECTOR3<TYPE>& xyz, const TYPE& w) { v.x = xyz.x; v.y = xyz.y; v.z = xyz.z; v.w = w; }
-
-	// Swizzle variables
-	X x, r, s;
-	Y y, g, t;
-	Z z, b, p;
-	W w, a, q;
-	XX xx, rr, ss;
-	XY xy, rg, st;
-	XZ xz, rb, sp;
-	XW xw, ra, sq;
-	YX yx, gr, ts;
-	YY yy, gg, tt;
-	YZ yz, gb, tp;
-	YW yw, ga, tq;
-	ZX zx, br, ps;
-	ZY zy, bg, pt;
-	ZZ zz, bb, pp;
-	ZW zw, ba, pq;
-	WX wx, ar, qs;
-	WY wy, ag, qt;
-	WZ wz, ab, qp;
-	WW ww, aa, qq;
-	XXX xxx, rrr, sss;
-	XXY xxy, rrg, sst;
-	XXZ xxz, rrb, ssp;
-	XXW xxw, rra, ssq;
-	XYX xyx, rgr, sts;
-	XYY xyy, rgg, stt;
-	XYZ xyz, rgb, stp;
-	XYW xyw, rga, stq;
-	XZX xzx, rbr, sps;
-	XZY xzy, rbg, spt;
-	XZZ xzz, rbb, spp;
-	XZW xzw, rba, spq;
-	XWX xwx, rar, sqs;
-	XWY xwy, rag, sqt;
-	XWZ xwz, rab, sqp;
-	XWW xww, raa, sqq;
-	YXX yxx, grr, tss;
-	YXY yxy, grg, tst;
-	YXZ yxz, grb, tsp;
-	YXW yxw, gra, tsq;
-	YYX yyx, ggr, tts;
-	YYY yyy, ggg, ttt;
-	YYZ yyz, ggb, ttp;
-	YYW yyw, gga, ttq;
-	YZX yzx, gbr, tps;
-	YZY yzy, gbg, tpt;
-	YZZ yzz, gbb, tpp;
-	YZW yzw, gba, tpq;
-	YWX ywx, gar, tqs;
-	YWY ywy, gag, tqt;
-	YWZ ywz, gab, tqp;
-	YWW yww, gaa, tqq;
-	ZXX zxx, brr, pss;
-	ZXY zxy, brg, pst;
-	ZXZ zxz, brb, psp;
-	ZXW zxw, bra, psq;
-	ZYX zyx, bgr, pts;
-	ZYY zyy, bgg, ptt;
-	ZYZ zyz, bgb, ptp;
-	ZYW zyw, bga, ptq;
-	ZZX zzx, bbr, pps;
-	ZZY zzy, bbg, ppt;
-	ZZZ zzz, bbb, ppp;
-	ZZW zzw, bba, ppq;
-	ZWX zwx, bar, pqs;
-	ZWY zwy, bag, pqt;
-	ZWZ zwz, bab, pqp;
-	ZWW zww, baa, pqq;
-	WXX wxx, arr, qss;
-	WXY wxy, arg, qst;
-	WXZ wxz, arb, qsp;
-	WXW wxw, ara, qsq;
-	WYX wyx, agr, qts;
-	WYY wyy, agg, qtt;
-	WYZ wyz, agb, qtp;
-	WYW wyw, aga, qtq;
-	WZX wzx, abr, qps;
-	WZY wzy, abg, qpt;
-	WZZ wzz, abb, qpp;
-	WZW wzw, aba, qpq;
-	WWX wwx, aar, qqs;
-	WWY wwy, aag, qqt;
-	WWZ wwz, aab, qqp;
-	WWW www, aaa, qqq;
-	XXXX xxxx, rrrr, ssss;
-	XXXY xxxy, rrrg, ssst;
-	XXXZ xxxz, rrrb, sssp;
-	XXXW xxxw, rrra, sssq;
-	XXYX xxyx, rrgr, ssts;
-	XXYY xxyy, rrgg, sstt;
-	XXYZ xxyz, rrgb, sstp;
-	XXYW xxyw, rrga, sstq;
-	XXZX xxzx, rrbr, ssps;
-	XXZY xxzy, rrbg, sspt;
-	XXZZ xxzz, rrbb, sspp;
-	XXZW xxzw, rrba, sspq;
-	XXWX xxwx, rrar, ssqs;
-	XXWY xxwy, rrag, ssqt;
-	XXWZ xxwz, rrab, ssqp;
-	XXWW xxww, rraa, ssqq;
-	XYXX xyxx, rgrr, stss;
-	XYXY xyxy, rgrg, stst;
-	XYXZ xyxz, rgrb, stsp;
-	XYXW xyxw, rgra, stsq;
-	XYYX xyyx, rggr, stts;
-	XYYY xyyy, rggg, sttt;
-	XYYZ xyyz, rggb, sttp;
-	XYYW xyyw, rgga, sttq;
-	XYZX xyzx, rgbr, stps;
-	XYZY xyzy, rgbg, stpt;
-	XYZZ xyzz, rgbb, stpp;
-	XYZW xyzw, rgba, stpq;
-	XYWX xywx, rgar, stqs;
-	XYWY xywy, rgag, stqt;
-	XYWZ xywz, rgab, stqp;
-	XYWW xyww, rgaa, stqq;
-	XZXX xzxx, rbrr, spss;
-	XZXY xzxy, rbrg, spst;
-	XZXZ xzxz, rbrb, spsp;
-	XZXW xzxw, rbra, spsq;
-	XZYX xzyx, rbgr, spts;
-	XZYY xzyy, rbgg, sptt;
-	XZYZ xzyz, rbgb, sptp;
-	XZYW xzyw, rbga, sptq;
-	XZZX xzzx, rbbr, spps;
-	XZZY xzzy, rbbg, sppt;
-	XZZZ xzzz, rbbb, sppp;
-	XZZW xzzw, rbba, sppq;
-	XZWX xzwx, rbar, spqs;
-	XZWY xzwy, rbag, spqt;
-	XZWZ xzwz, rbab, spqp;
-	XZWW xzww, rbaa, spqq;
-	XWXX xwxx, rarr, sqss;
-	XWXY xwxy, rarg, sqst;
-	XWXZ xwxz, rarb, sqsp;
-	XWXW xwxw, rara, sqsq;
-	XWYX xwyx, ragr, sqts;
-	XWYY xwyy, ragg, sqtt;
-	XWYZ xwyz, ragb, sqtp;
-	XWYW xwyw, raga, sqtq;
-	XWZX xwzx, rabr, sqps;
-	XWZY xwzy, rabg, sqpt;
-	XWZZ xwzz, rabb, sqpp;
-	XWZW xwzw, raba, sqpq;
-	XWWX xwwx, raar, sqqs;
-	XWWY xwwy, raag, sqqt;
-	XWWZ xwwz, raab, sqqp;
-	XWWW xwww, raaa, sqqq;
-	YXXX yxxx, grrr, tsss;
-	YXXY yxxy, grrg, tsst;
-	YXXZ yxxz, grrb, tssp;
-	YXXW yxxw, grra, tssq;
-	YXYX yxyx, grgr, tsts;
-	YXYY yxyy, grgg, tstt;
-	YXYZ yxyz, grgb, tstp;
-	YXYW yxyw, grga, tstq;
-	YXZX yxzx, grbr, tsps;
-	YXZY yxzy, grbg, tspt;
-	YXZZ yxzz, grbb, tspp;
-	YXZW yxzw, grba, tspq;
-	YXWX yxwx, grar, tsqs;
-	YXWY yxwy, grag, tsqt;
-	YXWZ yxwz, grab, tsqp;
-	YXWW yxww, graa, tsqq;
-	YYXX yyxx, ggrr, ttss;
-	YYXY yyxy, ggrg, ttst;
-	YYXZ yyxz, ggrb, ttsp;
-	YYXW yyxw, ggra, ttsq;
-	YYYX yyyx, gggr, ttts;
-	YYYY yyyy, gggg, tttt;
-	YYYZ yyyz, gggb, tttp;
-	YYYW yyyw, ggga, tttq;
-	YYZX yyzx, ggbr, ttps;
-	YYZY yyzy, ggbg, ttpt;
-	YYZZ yyzz, ggbb, ttpp;
-	YYZW yyzw, ggba, ttpq;
-	YYWX yywx, ggar, ttqs;
-	YYWY yywy, ggag, ttqt;
-	YYWZ yywz, ggab, ttqp;
-	YYWW yyww, ggaa, ttqq;
-	YZXX yzxx, gbrr, tpss;
-	YZXY yzxy, gbrg, tpst;
-	YZXZ yzxz, gbrb, tpsp;
-	YZXW yzxw, gbra, tpsq;
-	YZYX yzyx, gbgr, tpts;
-	YZYY yzyy, gbgg, tptt;
-	YZYZ yzyz, gbgb, tptp;
-	YZYW yzyw, gbga, tptq;
-	YZZX yzzx, gbbr, tpps;
-	YZZY yzzy, gbbg, tppt;
-	YZZZ yzzz, gbbb, tppp;
-	YZZW yzzw, gbba, tppq;
-	YZWX yzwx, gbar, tpqs;
-	YZWY yzwy, gbag, tpqt;
-	YZWZ yzwz, gbab, tpqp;
-	YZWW yzww, gbaa, tpqq;
-	YWXX ywxx, garr, tqss;
-	YWXY ywxy, garg, tqst;
-	YWXZ ywxz, garb, tqsp;
-	YWXW ywxw, gara, tqsq;
-	YWYX ywyx, gagr, tqts;
-	YWYY ywyy, gagg, tqtt;
-	YWYZ ywyz, gagb, tqtp;
-	YWYW ywyw, gaga, tqtq;
-	YWZX ywzx, gabr, tqps;
-	YWZY ywzy, gabg, tqpt;
-	YWZZ ywzz, gabb, tqpp;
-	YWZW ywzw, gaba, tqpq;
-	YWWX ywwx, gaar, tqqs;
-	YWWY ywwy, gaag, tqqt;
-	YWWZ ywwz, gaab, tqqp;
-	YWWW ywww, gaaa, tqqq;
-	ZXXX zxxx, brrr, psss;
-	ZXXY zxxy, brrg, psst;
-	ZXXZ zxxz, brrb, pssp;
-	ZXXW zxxw, brra, pssq;
-	ZXYX zxyx, brgr, psts;
-	ZXYY zxyy, brgg, pstt;
-	ZXYZ zxyz, brgb, pstp;
-	ZXYW zxyw, brga, pstq;
-	ZXZX zxzx, brbr, psps;
-	ZXZY zxzy, brbg, pspt;
-	ZXZZ zxzz, brbb, pspp;
-	ZXZW zxzw, brba, pspq;
-	ZXWX zxwx, brar, psqs;
-	ZXWY zxwy, brag, psqt;
-	ZXWZ zxwz, brab, psqp;
-	ZXWW zxww, braa, psqq;
-	ZYXX zyxx, bgrr, ptss;
-	ZYXY zyxy, bgrg, ptst;
-	ZYXZ zyxz, bgrb, ptsp;
-	ZYXW zyxw, bgra, ptsq;
-	ZYYX zyyx, bggr, ptts;
-	ZYYY zyyy, bggg, pttt;
-	ZYYZ zyyz, bggb, pttp;
-	ZYYW zyyw, bgga, pttq;
-	ZYZX zyzx, bgbr, ptps;
-	ZYZY zyzy, bgbg, ptpt;
-	ZYZZ zyzz, bgbb, ptpp;
-	ZYZW zyzw, bgba, ptpq;
-	ZYWX zywx, bgar, ptqs;
-	ZYWY zywy, bgag, ptqt;
-	ZYWZ zywz, bgab, ptqp;
-	ZYWW zyww, bgaa, ptqq;
-	ZZXX zzxx, bbrr, ppss;
-	ZZXY zzxy, bbrg, ppst;
-	ZZXZ zzxz, bbrb, ppsp;
-	ZZXW zzxw, bbra, ppsq;
-	ZZYX zzyx, bbgr, ppts;
-	ZZYY zzyy, bbgg, pptt;
-	ZZYZ zzyz, bbgb, pptp;
-	ZZYW zzyw, bbga, pptq;
-	ZZZX zzzx, bbbr, ppps;
-	ZZZY zzzy, bbbg, pppt;
-	ZZZZ zzzz, bbbb, pppp;
-	ZZZW zzzw, bbba, pppq;
-	ZZWX zzwx, bbar, ppqs;
-	ZZWY zzwy, bbag, ppqt;
-	ZZWZ zzwz, bbab, ppqp;
-	ZZWW zzww, bbaa, ppqq;
-	ZWXX zwxx, barr, pqss;
-	ZWXY zwxy, barg, pqst;
-	ZWXZ zwxz, barb, pqsp;
-	ZWXW zwxw, bara, pqsq;
-	ZWYX zwyx, bagr, pqts;
-	ZWYY zwyy, bagg, pqtt;
-	ZWYZ zwyz, bagb, pqtp;
-	ZWYW zwyw, baga, pqtq;
-	ZWZX zwzx, babr, pqps;
-	ZWZY zwzy, babg, pqpt;
-	ZWZZ zwzz, babb, pqpp;
-	ZWZW zwzw, baba, pqpq;
-	ZWWX zwwx, baar, pqqs;
-	ZWWY zwwy, baag, pqqt;
-	ZWWZ zwwz, baab, pqqp;
-	ZWWW zwww, baaa, pqqq;
-	WXXX wxxx, arrr, qsss;
-	WXXY wxxy, arrg, qsst;
-	WXXZ wxxz, arrb, qssp;
-	WXXW wxxw, arra, qssq;
-	WXYX wxyx, argr, qsts;
-	WXYY wxyy, argg, qstt;
-	WXYZ wxyz, argb, qstp;
-	WXYW wxyw, arga, qstq;
-	WXZX wxzx, arbr, qsps;
-	WXZY wxzy, arbg, qspt;
-	WXZZ wxzz, arbb, qspp;
-	WXZW wxzw, arba, qspq;
-	WXWX wxwx, arar, qsqs;
-	WXWY wxwy, arag, qsqt;
-	WXWZ wxwz, arab, qsqp;
-	WXWW wxww, araa, qsqq;
-	WYXX wyxx, agrr, qtss;
-	WYXY wyxy, agrg, qtst;
-	WYXZ wyxz, agrb, qtsp;
-	WYXW wyxw, agra, qtsq;
-	WYYX wyyx, aggr, qtts;
-	WYYY wyyy, aggg, qttt;
-	WYYZ wyyz, aggb, qttp;
-	WYYW wyyw, agga, qttq;
-	WYZX wyzx, agbr, qtps;
-	WYZY wyzy, agbg, qtpt;
-	WYZZ wyzz, agbb, qtpp;
-	WYZW wyzw, agba, qtpq;
-	WYWX wywx, agar, qtqs;
-	WYWY wywy, agag, qtqt;
-	WYWZ wywz, agab, qtqp;
-	WYWW wyww, agaa, qtqq;
-	WZXX wzxx, abrr, qpss;
-	WZXY wzxy, abrg, qpst;
-	WZXZ wzxz, abrb, qpsp;
-	WZXW wzxw, abra, qpsq;
-	WZYX wzyx, abgr, qpts;
-	WZYY wzyy, abgg, qptt;
-	WZYZ wzyz, abgb, qptp;
-	WZYW wzyw, abga, qptq;
-	WZZX wzzx, abbr, qpps;
-	WZZY wzzy, abbg, qppt;
-	WZZZ wzzz, abbb, qppp;
-	WZZW wzzw, abba, qppq;
-	WZWX wzwx, abar, qpqs;
-	WZWY wzwy, abag, qpqt;
-	WZWZ wzwz, abab, qpqp;
-	WZWW wzww, abaa, qpqq;
-	WWXX wwxx, aarr, qqss;
-	WWXY wwxy, aarg, qqst;
-	WWXZ wwxz, aarb, qqsp;
-	WWXW wwxw, aara, qqsq;
-	WWYX wwyx, aagr, qqts;
-	WWYY wwyy, aagg, qqtt;
-	WWYZ wwyz, aagb, qqtp;
-	WWYW wwyw, aaga, qqtq;
-	WWZX wwzx, aabr, qqps;
-	WWZY wwzy, aabg, qqpt;
-	WWZZ wwzz, aabb, qqpp;
-	WWZW wwzw, aaba, qqpq;
-	WWWX wwwx, aaar, qqqs;
-	WWWY wwwy, aaag, qqqt;
-	WWWZ wwwz, aaab, qqqp;
-	WWWW wwww, aaaa, qqqq;
-
-	// Length property
-	LENGTH Length;
+	MATRIX4() {}
+	explicit MATRIX4(const TYPE& diagonal) { columns[0] = VECTOR4<TYPE>(diagonal, (TYPE)0, (TYPE)0, (TYPE)0); columns[1] = VECTOR4<TYPE>((TYPE)0, diagonal, (TYPE)0, (TYPE)0); columns[2] = VECTOR4<TYPE>((TYPE)0, (TYPE)0, diagonal, (TYPE)0); columns[3] = VECTOR4<TYPE>((TYPE)0, (TYPE)0, (TYPE)0, diagonal); }
+	MATRIX4(const VECTOR4<TYPE>& column0, const VECTOR4<TYPE>& column1, const VECTOR4<TYPE>& column2, const VECTOR4<TYPE>& column3) { columns[0] = column0; columns[1] = column1; columns[2] = column2; columns[3] = column3; }
 
-	// Assignment operators (default for = is fine)
-	const VECTOR4& operator+=(const VECTOR4& rhs) { v.x += rhs.v.x; v.y += rhs.v.y; v.z += rhs.v.z; v.w += rhs.v.w; return *this; }
-	const VECTOR4& operator-=(const VECTOR4& rhs) { v.x -= rhs.v.x; v.y -= rhs.v.y; v.z -= rhs.v.z; v.w -= rhs.v.w; return *this; }
-	const VECTOR4& operator*=(const VECTOR4& rhs) { v.x *= rhs.v.x; v.y *= rhs.v.y; v.z *= rhs.v.z; v.w *= rhs.v.w; return *this; }
-	const VECTOR4& operator/=(const VECTOR4& rhs) { v.x /= rhs.v.x; v.y /= rhs.v.y; v.z /= rhs.v.z; v.w /= rhs.v.w; return *this; }
-	const VECTOR4& operator*=(const TYPE& rhs) { v.x *= rhs; v.y *= rhs; v.z *= rhs; v.w *= rhs; return *this; }
-	const VECTOR4& operator/=(const TYPE& rhs) { v.x /= rhs; v.y /= rhs; v.z /= rhs; v.w /= rhs; return *this; }
+	static MATRIX4 Identity() { return MATRIX4((TYPE)1); }
 
-	// Array notation access
-	const TYPE& operator[](const unsigned& index)
+	// Column access (m[column].row), and a copy of a row
+	VECTOR4<TYPE>& operator[](const unsigned& column)
 	{
-		if (index == 0) { return v.x; }
-		else if (index == 1) { return v.y; }
-		else if (index == 2) { return v.z; }
-		else if (index == 3) { return v.w; }
-		else { cout << "Fatal Error: Attempted out of bounds bracket access of 4D vector." << endl << " - Vector: " << *this << endl << " - Index:  " << index << endl; exit(-1); }
+		if (column >= 4) { FatalError("Attempted out of bounds bracket access of 4x4 matrix.", column); }
+		return columns[column];
 	}
-
-	// Overload for cout
-	friend ostream& operator<<(ostream& os, const VECTOR4<TYPE>& printVector)
+	const VECTOR4<TYPE>& operator[](const unsigned& column) const
 	{
-		os << "(" << printVector.v.x << ", " << printVector.v.y << ", " << printVector.v.z << ", " << printVector.v.w << ")";
-		return os;
+		if (column >= 4) { FatalError("Attempted out of bounds bracket access of 4x4 matrix.", column); }
+		return columns[column];
 	}
+	VECTOR4<TYPE> Row(const unsigned& row) const { return VECTOR4<TYPE>(columns[0].Component(row), columns[1].Component(row), columns[2].Component(row), columns[3].Component(row)); }
 
-	// Negation
-	VECTOR4 operator-() const { return VECTOR4(-v.x, -v.y, -v.z, v.w); }
-
-	void Normalize() { (*this).xyz /= this->Length; }
+	// Assignment operators (default for = is fine)
+	const MATRIX4& operator+=(const MATRIX4& rhs) { columns[0] += rhs.columns[0]; columns[1] += rhs.columns[1]; columns[2] += rhs.columns[2]; columns[3] += rhs.columns[3]; return *this; }
+	const MATRIX4& operator-=(const MATRIX4& rhs) { columns[0] -= rhs.columns[0]; columns[1] -= rhs.columns[1]; columns[2] -= rhs.columns[2]; columns[3] -= rhs.columns[3]; return *this; }
+	const MATRIX4& operator*=(const MATRIX4& rhs) { *this = *this * rhs; return *this; }
+	const MATRIX4& operator*=(const TYPE& rhs) { columns[0] *= rhs; columns[1] *= rhs; columns[2] *= rhs; columns[3] *= rhs; return *this; }
 };
 
-// 4D ToString()
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, string >::type ToString(const SWIZZLE& printSwizzle) { return ToString(typename SWIZZLE::PARENT(printSwizzle)); }
-template <typename TYPE> string ToString(const VECTOR4<TYPE>& printVector)
+// 4x4 [+]
+template <typename TYPE> MATRIX4<TYPE> operator+(const MATRIX4<TYPE>& lhs, const MATRIX4<TYPE>& rhs) { return MATRIX4<TYPE>(lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3]); }
+
+// 4x4 [-]
+template <typename TYPE> MATRIX4<TYPE> operator-(const MATRIX4<TYPE>& lhs, const MATRIX4<TYPE>& rhs) { return MATRIX4<TYPE>(lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3]); }
+
+// 4x4 Multiplication [*]: Scalar
+template <typename TYPE> MATRIX4<TYPE> operator*(const MATRIX4<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs) { return MATRIX4<TYPE>(lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs, lhs[3] * rhs); }
+template <typename TYPE> MATRIX4<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const MATRIX4<TYPE>& rhs) { return MATRIX4<TYPE>(lhs * rhs[0], lhs * rhs[1], lhs * rhs[2], lhs * rhs[3]); }
+
+// 4x4 Multiplication [*]: Matrix-vector
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const MATRIX4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> VECTOR4<TYPE> operator*(const MATRIX4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
 {
-	std::ostringstream buffer;
-	buffer << "(" << printVector.x << ", " << printVector.y << ", " << printVector.z << ", " << printVector.w << ")";
-	return buffer.str();
+	return VECTOR4<TYPE>(lhs[0].x * rhs.x + lhs[1].x * rhs.y + lhs[2].x * rhs.z + lhs[3].x * rhs.w,
+	                     lhs[0].y * rhs.x + lhs[1].y * rhs.y + lhs[2].y * rhs.z + lhs[3].y * rhs.w,
+	                     lhs[0].z * rhs.x + lhs[1].z * rhs.y + lhs[2].z * rhs.z + lhs[3].z * rhs.w,
+	                     lhs[0].w * rhs.x + lhs[1].w * rhs.y + lhs[2].w * rhs.z + lhs[3].w * rhs.w);
 }
 
-// 4D Negate [-]
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const SWIZZLE& toNegate)
+// 4x4 Multiplication [*]: Matrix-matrix
+template <typename TYPE> MATRIX4<TYPE> operator*(const MATRIX4<TYPE>& lhs, const MATRIX4<TYPE>& rhs) { return MATRIX4<TYPE>(lhs * rhs[0], lhs * rhs[1], lhs * rhs[2], lhs * rhs[3]); }
+
+// 4x4 Comparisons
+template <typename TYPE> bool operator==(const MATRIX4<TYPE>& lhs, const MATRIX4<TYPE>& rhs) { return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3]; }
+template <typename TYPE> bool operator!=(const MATRIX4<TYPE>& lhs, const MATRIX4<TYPE>& rhs) { return !(lhs == rhs); }
+template <typename TYPE> bool AlmostEqual(const MATRIX4<TYPE>& lhs, const MATRIX4<TYPE>& rhs) { return AlmostEqual(lhs[0], rhs[0]) && AlmostEqual(lhs[1], rhs[1]) && AlmostEqual(lhs[2], rhs[2]) && AlmostEqual(lhs[3], rhs[3]); }
+
+// 4x4 Transpose()
+template <typename TYPE> MATRIX4<TYPE> Transpose(const MATRIX4<TYPE>& m) { return MATRIX4<TYPE>(m.Row(0), m.Row(1), m.Row(2), m.Row(3)); }
+
+// 4x4 Determinant()
+template <typename TYPE> TYPE Determinant(const MATRIX4<TYPE>& m)
 {
-	return -(typename SWIZZLE::PARENT(toNegate));
+	TYPE a00 = m[0].x, a01 = m[0].y, a02 = m[0].z, a03 = m[0].w, a10 = m[1].x, a11 = m[1].y, a12 = m[1].z, a13 = m[1].w, a20 = m[2].x, a21 = m[2].y, a22 = m[2].z, a23 = m[2].w, a30 = m[3].x, a31 = m[3].y, a32 = m[3].z, a33 = m[3].w;
+	TYPE s0 = a00 * a11 - a10 * a01;
+	TYPE s1 = a00 * a12 - a10 * a02;
+	TYPE s2 = a00 * a13 - a10 * a03;
+	TYPE s3 = a01 * a12 - a11 * a02;
+	TYPE s4 = a01 * a13 - a11 * a03;
+	TYPE s5 = a02 * a13 - a12 * a03;
+	TYPE c5 = a22 * a33 - a32 * a23;
+	TYPE c4 = a21 * a33 - a31 * a23;
+	TYPE c3 = a21 * a32 - a31 * a22;
+	TYPE c2 = a20 * a33 - a30 * a23;
+	TYPE c1 = a20 * a32 - a30 * a22;
+	TYPE c0 = a20 * a31 - a30 * a21;
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 }
 
-// 4D Addition [+]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator+(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) + typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator+(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) + rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator+(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs + typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR4<TYPE> operator+(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// 4x4 Inverse()
+template <typename TYPE> MATRIX4<TYPE> Inverse(const MATRIX4<TYPE>& m)
 {
-	return VECTOR4<TYPE>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w);
+	TYPE a00 = m[0].x, a01 = m[0].y, a02 = m[0].z, a03 = m[0].w, a10 = m[1].x, a11 = m[1].y, a12 = m[1].z, a13 = m[1].w, a20 = m[2].x, a21 = m[2].y, a22 = m[2].z, a23 = m[2].w, a30 = m[3].x, a31 = m[3].y, a32 = m[3].z, a33 = m[3].w;
+	TYPE s0 = a00 * a11 - a10 * a01;
+	TYPE s1 = a00 * a12 - a10 * a02;
+	TYPE s2 = a00 * a13 - a10 * a03;
+	TYPE s3 = a01 * a12 - a11 * a02;
+	TYPE s4 = a01 * a13 - a11 * a03;
+	TYPE s5 = a02 * a13 - a12 * a03;
+	TYPE c5 = a22 * a33 - a32 * a23;
+	TYPE c4 = a21 * a33 - a31 * a23;
+	TYPE c3 = a21 * a32 - a31 * a22;
+	TYPE c2 = a20 * a33 - a30 * a23;
+	TYPE c1 = a20 * a32 - a30 * a22;
+	TYPE c0 = a20 * a31 - a30 * a21;
+	TYPE i = 1 / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+	return MATRIX4<TYPE>(VECTOR4<TYPE>(( a11 * c5 - a12 * c4 + a13 * c3) * i, (-a01 * c5 + a02 * c4 - a03 * c3) * i, ( a31 * s5 - a32 * s4 + a33 * s3) * i, (-a21 * s5 + a22 * s4 - a23 * s3) * i),
+	                     VECTOR4<TYPE>((-a10 * c5 + a12 * c2 - a13 * c1) * i, ( a00 * c5 - a02 * c2 + a03 * c1) * i, (-a30 * s5 + a32 * s2 - a33 * s1) * i, ( a20 * s5 - a22 * s2 + a23 * s1) * i),
+	                     VECTOR4<TYPE>(( a10 * c4 - a11 * c2 + a13 * c0) * i, (-a00 * c4 + a01 * c2 - a03 * c0) * i, ( a30 * s4 - a31 * s2 + a33 * s0) * i, (-a20 * s4 + a21 * s2 - a23 * s0) * i),
+	                     VECTOR4<TYPE>((-a10 * c3 + a11 * c1 - a12 * c0) * i, ( a00 * c3 - a01 * c1 + a02 * c0) * i, (-a30 * s3 + a31 * s1 - a32 * s0) * i, ( a20 * s3 - a21 * s1 + a22 * s0) * i));
 }
 
-// 4D Subtraction [-]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator-(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) - typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) - rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator-(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs - typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR4<TYPE> operator-(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// 4x4 batch Transform(): out[i] = matrix * in[i], out may be in
+template <typename TYPE> void Transform(VECTOR4<TYPE>* out, const MATRIX4<TYPE>& matrix, const VECTOR4<TYPE>* in, const unsigned& count)
 {
-	return VECTOR4<TYPE>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w);
+	for (unsigned i = 0; i < count; i++)
+	{
+		out[i] = matrix * in[i];
+	}
 }
-
-// 4D Multiplication [*]: Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator*(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) * typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) * rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR4<TYPE> operator*(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+template <typename OUT, typename A, typename TYPE> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Transform(const OUT& out, const MATRIX4<TYPE>& matrix, const A& a) { Transform(typename OUT::PARENT(out), matrix, typename A::PARENT(a)); }
+template <typename TYPE> void Transform(const VECTOR4_SOA_VIEW<TYPE>& out, const MATRIX4<TYPE>& matrix, const VECTOR4_SOA_VIEW<TYPE>& a)
 {
-	return VECTOR4<TYPE>(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w);
+	TYPE m00 = matrix[0].x, m01 = matrix[0].y, m02 = matrix[0].z, m03 = matrix[0].w, m10 = matrix[1].x, m11 = matrix[1].y, m12 = matrix[1].z, m13 = matrix[1].w, m20 = matrix[2].x, m21 = matrix[2].y, m22 = matrix[2].z, m23 = matrix[2].w, m30 = matrix[3].x, m31 = matrix[3].y, m32 = matrix[3].z, m33 = matrix[3].w;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			block0[lane] = m00 * aX + m10 * aY + m20 * aZ + m30 * aW;
+			block1[lane] = m01 * aX + m11 * aY + m21 * aZ + m31 * aW;
+			block2[lane] = m02 * aX + m12 * aY + m22 * aZ + m32 * aW;
+			block3[lane] = m03 * aX + m13 * aY + m23 * aZ + m33 * aW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		block0[0] = m00 * aX + m10 * aY + m20 * aZ + m30 * aW;
+		block1[0] = m01 * aX + m11 * aY + m21 * aZ + m31 * aW;
+		block2[0] = m02 * aX + m12 * aY + m22 * aZ + m32 * aW;
+		block3[0] = m03 * aX + m13 * aY + m23 * aZ + m33 * aW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
 }
 
-// 4D Division [/]: Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type operator/(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) / typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) / rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs / typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR4<TYPE> operator/(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// 4x4 SSE overloads
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> operator*(const MATRIX4<float>& lhs, const VECTOR4<float>& rhs)
 {
-	return VECTOR4<TYPE>(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w);
+	return VECTOR4<float>(SimdMatrix4Multiply(lhs[0].Simd(), lhs[1].Simd(), lhs[2].Simd(), lhs[3].Simd(), rhs.Simd()));
 }
 
-// 4D Multiplication [*]: Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SWIZZLE& lhs, const SCALAR_TYPE& rhs) { return typename SWIZZLE::PARENT(lhs) * rhs; }
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator*(const SCALAR_TYPE& lhs, const SWIZZLE& rhs) { return lhs * typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR4<TYPE> operator*(const VECTOR4<TYPE>& lhs, const SCALAR_TYPE& rhs)
+inline MATRIX4<float> operator*(const MATRIX4<float>& lhs, const MATRIX4<float>& rhs)
 {
-	return VECTOR4<TYPE>(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs, lhs.w * rhs);
+	__m128 c0 = lhs[0].Simd(), c1 = lhs[1].Simd(), c2 = lhs[2].Simd(), c3 = lhs[3].Simd();
+	return MATRIX4<float>(VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, rhs[0].Simd())),
+	                      VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, rhs[1].Simd())),
+	                      VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, rhs[2].Simd())),
+	                      VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, rhs[3].Simd())));
 }
-template <typename TYPE> VECTOR4<TYPE> operator*(const SCALAR_TYPE& lhs, const VECTOR4<TYPE>& rhs)
+
+inline MATRIX4<float> Transpose(const MATRIX4<float>& m)
 {
-	return VECTOR4<TYPE>(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z, lhs * rhs.w);
+	__m128 c0 = m[0].Simd(), c1 = m[1].Simd(), c2 = m[2].Simd(), c3 = m[3].Simd();
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+	return MATRIX4<float>(VECTOR4<float>(c0), VECTOR4<float>(c1), VECTOR4<float>(c2), VECTOR4<float>(c3));
 }
 
-// 4D Division [/]: Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SWIZZLE& lhs, const SCALAR_TYPE& rhs) { return typename SWIZZLE::PARENT(lhs) / rhs; }
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type operator/(const SCALAR_TYPE& lhs, const SWIZZLE& rhs) { return lhs / typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> VECTOR4<TYPE> operator/(const VECTOR4<TYPE>& lhs, const SCALAR_TYPE& rhs)
+// Block-wise inverse: with M = [A B; C D] in 2x2 blocks, each block of the result comes from 2x2 adjugates
+inline MATRIX4<float> Inverse(const MATRIX4<float>& m)
 {
-	return VECTOR4<TYPE>(lhs.x / rhs, lhs.y / rhs, lhs.z / rhs, lhs.w / rhs);
+	__m128 c0 = m[0].Simd(), c1 = m[1].Simd(), c2 = m[2].Simd(), c3 = m[3].Simd();
+	__m128 A = _mm_movelh_ps(c0, c1), B = _mm_movehl_ps(c1, c0), C = _mm_movelh_ps(c2, c3), D = _mm_movehl_ps(c3, c2);
+
+	// (det(A), det(B), det(C), det(D))
+	__m128 detSub = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1))),
+	                           _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0))));
+	__m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));
+	__m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));
+	__m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));
+	__m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m128 DC = SimdMatrix2AdjugateMultiply(D, C);
+	__m128 AB = SimdMatrix2AdjugateMultiply(A, B);
+	__m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), SimdMatrix2Multiply(B, DC));
+	__m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), SimdMatrix2Multiply(C, AB));
+	__m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), SimdMatrix2MultiplyAdjugate(D, AB));
+	__m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), SimdMatrix2MultiplyAdjugate(A, DC));
+
+	// det(M) = det(A) det(D) + det(B) det(C) - trace(Adjugate(A) B Adjugate(D) C)
+	__m128 trace = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));
+	trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+	trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+	__m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+	__m128 scale = _mm_div_ps(_mm_set_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+	X = _mm_mul_ps(X, scale);
+	Y = _mm_mul_ps(Y, scale);
+	Z = _mm_mul_ps(Z, scale);
+	W = _mm_mul_ps(W, scale);
+
+	return MATRIX4<float>(VECTOR4<float>(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3))),
+	                      VECTOR4<float>(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2))),
+	                      VECTOR4<float>(_mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3))),
+	                      VECTOR4<float>(_mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2))));
 }
-template <typename TYPE> VECTOR4<TYPE> operator/(const SCALAR_TYPE& lhs, const VECTOR4<TYPE>& rhs)
+
+inline void Transform(VECTOR4<float>* out, const MATRIX4<float>& matrix, const VECTOR4<float>* in, const unsigned& count)
 {
-	return VECTOR4<TYPE>(lhs / rhs.x, lhs / rhs.y, lhs / rhs.z, lhs / rhs.w);
+	__m128 c0 = matrix[0].Simd(), c1 = matrix[1].Simd(), c2 = matrix[2].Simd(), c3 = matrix[3].Simd();
+	for (unsigned i = 0; i < count; i++)
+	{
+		out[i] = VECTOR4<float>(SimdMatrix4Multiply(c0, c1, c2, c3, in[i].Simd()));
+	}
 }
+#endif // SVML_USE_SSE
+
+
+
+//----------------------------------------------------------------------
+// 
+// Sec. 09 - Quaternion type and associated functions
+// 
+//----------------------------------------------------------------------
 
-// 4D Equal To [==]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator==(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) == typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator==(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) == rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator==(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs == typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator==(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+template <typename TYPE>
+struct QUATERNION
 {
-	return !(lhs.x != rhs.x || lhs.y != rhs.y || lhs.z != rhs.z || lhs.w != rhs.w);
-}
+	TYPE x, y, z, w; // Vector part (x, y, z) and scalar part w
+
+	// Constructors
+	QUATERNION() {}
+	QUATERNION(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w) : x(x), y(y), z(z), w(w) {}
+	QUATERNION(const VECTOR3<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians) // The axis is assumed to be normalized
+	{
+		typename RealType<TYPE>::type halfRadians = radians * (typename RealType<TYPE>::type)0.5;
+		typename RealType<TYPE>::type s = sin(halfRadians);
+		x = rotationAxis.x * s;
+		y = rotationAxis.y * s;
+		z = rotationAxis.z * s;
+		w = cos(halfRadians);
+	}
+
+	static QUATERNION Identity() { return QUATERNION((TYPE)0, (TYPE)0, (TYPE)0, (TYPE)1); }
+
+	// Assignment operators (default for = is fine)
+	const QUATERNION& operator*=(const QUATERNION& rhs) { *this = *this * rhs; return *this; }
+};
 
-// 4D Not Equal To [!=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator!=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) != typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator!=(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) != rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator!=(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs != typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator!=(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// Quaternion arithmetic (component-wise, used to blend quaternions)
+template <typename TYPE> QUATERNION<TYPE> operator-(const QUATERNION<TYPE>& q) { return QUATERNION<TYPE>(-q.x, -q.y, -q.z, -q.w); }
+template <typename TYPE> QUATERNION<TYPE> operator+(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return QUATERNION<TYPE>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w); }
+template <typename TYPE> QUATERNION<TYPE> operator-(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return QUATERNION<TYPE>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w); }
+template <typename TYPE> QUATERNION<TYPE> operator*(const QUATERNION<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs) { return QUATERNION<TYPE>(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs, lhs.w * rhs); }
+template <typename TYPE> QUATERNION<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const QUATERNION<TYPE>& rhs) { return QUATERNION<TYPE>(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z, lhs * rhs.w); }
+
+// Quaternion composition [*]: rotating by (lhs * rhs) rotates by rhs, then by lhs
+template <typename TYPE> QUATERNION<TYPE> operator*(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs)
 {
-	return lhs.x != rhs.x || lhs.y != rhs.y || lhs.z != rhs.z || lhs.w != rhs.w;
+	return QUATERNION<TYPE>(lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+	                        lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
+	                        lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w,
+	                        lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z);
 }
 
-// 4D AlmostEqual()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type AlmostEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqual((typename SWIZZLE0::PARENT(lhs)), (typename SWIZZLE1::PARENT(rhs))); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return AlmostEqual((typename SWIZZLE::PARENT(lhs)), rhs); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqual(lhs, (typename SWIZZLE::PARENT(rhs))); }
-template <typename TYPE> bool AlmostEqual(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// Quaternion Comparisons
+template <typename TYPE> bool operator==(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z && lhs.w == rhs.w; }
+template <typename TYPE> bool operator!=(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return !(lhs == rhs); }
+template <typename TYPE> bool AlmostEqual(const QUATERNION<TYPE>& lhs, const QUATERNION<TYPE>& rhs) { return AlmostEqual(VECTOR4<TYPE>(lhs.x, lhs.y, lhs.z, lhs.w), VECTOR4<TYPE>(rhs.x, rhs.y, rhs.z, rhs.w)); }
+
+// Quaternion Dot(), Normalize(), Conjugate(), Inverse()
+template <typename TYPE> TYPE Dot(const QUATERNION<TYPE>& a, const QUATERNION<TYPE>& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+template <typename TYPE> QUATERNION<TYPE> Normalize(const QUATERNION<TYPE>& toNormalize) { return toNormalize * PrecisionDivideBySqrt((TYPE)1, Dot(toNormalize, toNormalize)); }
+template <typename TYPE> QUATERNION<TYPE> Conjugate(const QUATERNION<TYPE>& q) { return QUATERNION<TYPE>(-q.x, -q.y, -q.z, q.w); }
+template <typename TYPE> QUATERNION<TYPE> Inverse(const QUATERNION<TYPE>& q) { return Conjugate(q) * (1 / Dot(q, q)); }
+
+// Quaternion Nlerp(): normalized linear interpolation along the shorter arc, cheap but not constant speed
+template <typename TYPE> QUATERNION<TYPE> Nlerp(const QUATERNION<TYPE>& start, const QUATERNION<TYPE>& end, const typename ScalarType<TYPE>::type& delta)
 {
-	return fabs(lhs.x - rhs.x) < COMPARISON_EPSILON && fabs(lhs.y - rhs.y) < COMPARISON_EPSILON && fabs(lhs.z - rhs.z) < COMPARISON_EPSILON && fabs(lhs.w - rhs.w) < COMPARISON_EPSILON;
+	QUATERNION<TYPE> shortEnd = (Dot(start, end) < 0) ? -end : end;
+	return Normalize(start + (shortEnd - start) * delta);
 }
 
-// 4D Less Than [<]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) < typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator<(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) < rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator<(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs < typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator<(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// Quaternion Slerp(): constant speed along the shorter arc, falling back to Nlerp() where the two are nearly equal
+template <typename TYPE> QUATERNION<TYPE> Slerp(const QUATERNION<TYPE>& start, const QUATERNION<TYPE>& end, const typename ScalarType<TYPE>::type& delta)
 {
-	return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.yzw < rhs.yzw);
+	TYPE cosine = Dot(start, end);
+	QUATERNION<TYPE> shortEnd = end;
+	if (cosine < 0)
+	{
+		cosine = -cosine;
+		shortEnd = -end;
+	}
+	if (cosine > (TYPE)0.9995)
+	{
+		return Nlerp(start, shortEnd, delta);
+	}
+	TYPE angle = acos(cosine);
+	TYPE inverseSine = 1 / sin(angle);
+	return start * (sin((1 - delta) * angle) * inverseSine) + shortEnd * (sin(delta * angle) * inverseSine);
 }
 
-// 4D Greater Than [>]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) > typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator>(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) > rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator>(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs > typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator>(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// Quaternion ToMatrix(): the rotation as a 3x3 matrix (the quaternion is assumed to be normalized)
+template <typename TYPE> MATRIX3<TYPE> ToMatrix(const QUATERNION<TYPE>& q)
 {
-	return lhs.x > rhs.x || (lhs.x == rhs.x && lhs.yzw > rhs.yzw);
+	TYPE xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+	TYPE xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+	TYPE wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+	return MATRIX3<TYPE>(VECTOR3<TYPE>(1 - 2 * (yy + zz), 2 * (xy + wz), 2 * (xz - wy)),
+	                     VECTOR3<TYPE>(2 * (xy - wz), 1 - 2 * (xx + zz), 2 * (yz + wx)),
+	                     VECTOR3<TYPE>(2 * (xz + wy), 2 * (yz - wx), 1 - 2 * (xx + yy)));
 }
 
-// 4D Less Than Or Equal To [<=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) <= typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator<=(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) <= rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator<=(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs <= typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator<=(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// 3D Rotate() by a quaternion
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& toRotate, const QUATERNION<TYPE>& rotation) { return Rotate(typename SWIZZLE::PARENT(toRotate), rotation); }
+template <typename TYPE> VECTOR3<TYPE> Rotate(const VECTOR3<TYPE>& toRotate, const QUATERNION< typename RealType<TYPE>::type >& rotation)
 {
-	return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.yzw <= rhs.yzw);
+	typedef typename RealType<TYPE>::type REAL;
+	VECTOR3<REAL> v(toRotate);
+	REAL tx = 2 * (rotation.y * v.z - rotation.z * v.y);
+	REAL ty = 2 * (rotation.z * v.x - rotation.x * v.z);
+	REAL tz = 2 * (rotation.x * v.y - rotation.y * v.x);
+	return VECTOR3<TYPE>(VECTOR3<REAL>(v.x + rotation.w * tx + rotation.y * tz - rotation.z * ty,
+	                                   v.y + rotation.w * ty + rotation.z * tx - rotation.x * tz,
+	                                   v.z + rotation.w * tz + rotation.x * ty - rotation.y * tx));
 }
 
-// 4D Greater Than Or Equal To [<=]
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) >= typename SWIZZLE1::PARENT(rhs); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator>=(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) >= rhs; }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator>=(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs >= typename SWIZZLE::PARENT(rhs); }
-template <typename TYPE> bool operator>=(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+// 3D batch Rotate() by a quaternion, out may be in
+template <typename TYPE> void Rotate(VECTOR3<TYPE>* out, const VECTOR3<TYPE>* in, const QUATERNION<TYPE>& rotation, const unsigned& count)
 {
-	return lhs.x > rhs.x || (lhs.x == rhs.x && lhs.yzw >= rhs.yzw);
+	Transform(out, ToMatrix(rotation), in, count);
 }
-
-// 4D Normalize()
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Normalize(const SWIZZLE& toNormalize) { return Normalize(typename SWIZZLE::PARENT(toNormalize)); }
-template <typename TYPE> VECTOR4<TYPE> Normalize(const VECTOR4<TYPE>& toNormalize)
+template <typename OUT, typename A, typename TYPE> inline typename EnableIf< IsSoa3D< typename OUT::PARENT >, typename EnableIf< IsSoa3D< typename A::PARENT >, void >::type >::type Rotate(const OUT& out, const A& a, const QUATERNION<TYPE>& rotation) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), rotation); }
+template <typename TYPE> void Rotate(const VECTOR3_SOA_VIEW<TYPE>& out, const VECTOR3_SOA_VIEW<TYPE>& a, const QUATERNION<TYPE>& rotation)
 {
-	return VECTOR4<TYPE>(Normalize(toNormalize.xyz), toNormalize.w);
+	MATRIX3<TYPE> matrix = ToMatrix(rotation);
+	TYPE m00 = matrix[0].x, m01 = matrix[0].y, m02 = matrix[0].z, m10 = matrix[1].x, m11 = matrix[1].y, m12 = matrix[1].z, m20 = matrix[2].x, m21 = matrix[2].y, m22 = matrix[2].z;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+			block0[lane] = m00 * aX + m10 * aY + m20 * aZ;
+			block1[lane] = m01 * aX + m11 * aY + m21 * aZ;
+			block2[lane] = m02 * aX + m12 * aY + m22 * aZ;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i];
+		block0[0] = m00 * aX + m10 * aY + m20 * aZ;
+		block1[0] = m01 * aX + m11 * aY + m21 * aZ;
+		block2[0] = m02 * aX + m12 * aY + m22 * aZ;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+	}
 }
 
-// 4D Dot()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type Dot(const SWIZZLE0& a, const SWIZZLE1& b) { return Dot(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Dot(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Dot(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Dot(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Dot(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE Dot(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+// 4D Rotate() by a quaternion
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& toRotate, const QUATERNION<TYPE>& rotation) { return Rotate(typename SWIZZLE::PARENT(toRotate), rotation); }
+template <typename TYPE> VECTOR4<TYPE> Rotate(const VECTOR4<TYPE>& toRotate, const QUATERNION< typename RealType<TYPE>::type >& rotation)
 {
-	return Dot(a.xyz, b.xyz);
+	return VECTOR4<TYPE>(Rotate(toRotate.xyz, rotation), toRotate.w);
 }
 
-// 4D Cross()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Cross(const SWIZZLE0& a, const SWIZZLE1& b) { return Cross(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cross(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Cross(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cross(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Cross(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR4<TYPE> Cross(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+// 4D batch Rotate() by a quaternion, out may be in
+template <typename TYPE> void Rotate(VECTOR4<TYPE>* out, const VECTOR4<TYPE>* in, const QUATERNION<TYPE>& rotation, const unsigned& count)
 {
-	return VECTOR4<TYPE>(Cross(a.xyz, b.xyz), a.w);
+	MATRIX3<TYPE> matrix = ToMatrix(rotation);
+	Transform(out, MATRIX4<TYPE>(VECTOR4<TYPE>(matrix[0], (TYPE)0), VECTOR4<TYPE>(matrix[1], (TYPE)0), VECTOR4<TYPE>(matrix[2], (TYPE)0), VECTOR4<TYPE>((TYPE)0, (TYPE)0, (TYPE)0, (TYPE)1)), in, count);
 }
+template <typename OUT, typename A, typename TYPE> inline typename EnableIf< IsSoa4D< typename OUT::PARENT >, typename EnableIf< IsSoa4D< typename A::PARENT >, void >::type >::type Rotate(const OUT& out, const A& a, const QUATERNION<TYPE>& rotation) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), rotation); }
+template <typename TYPE> void Rotate(const VECTOR4_SOA_VIEW<TYPE>& out, const VECTOR4_SOA_VIEW<TYPE>& a, const QUATERNION<TYPE>& rotation)
+{
+	MATRIX3<TYPE> matrix = ToMatrix(rotation);
+	TYPE m00 = matrix[0].x, m01 = matrix[0].y, m02 = matrix[0].z, m10 = matrix[1].x, m11 = matrix[1].y, m12 = matrix[1].z, m20 = matrix[2].x, m21 = matrix[2].y, m22 = matrix[2].z;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	TYPE block2[SOA_LANES];
+	TYPE block3[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+			block0[lane] = m00 * aX + m10 * aY + m20 * aZ;
+			block1[lane] = m01 * aX + m11 * aY + m21 * aZ;
+			block2[lane] = m02 * aX + m12 * aY + m22 * aZ;
+			block3[lane] = aW;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.z[n + lane] = block2[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.w[n + lane] = block3[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i], aZ = a.z[i], aW = a.w[i];
+		block0[0] = m00 * aX + m10 * aY + m20 * aZ;
+		block1[0] = m01 * aX + m11 * aY + m21 * aZ;
+		block2[0] = m02 * aX + m12 * aY + m22 * aZ;
+		block3[0] = aW;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+		out.z[i] = block2[0];
+		out.w[i] = block3[0];
+	}
+}
+
+//----------------------------------------------------------------------
+// 
+// Sec. 10 - 2D rotation type and associated functions
+// 
+//----------------------------------------------------------------------
+
+template <typename TYPE>
+struct ROTATION2
+{
+	TYPE c, s; // Cosine and sine of the angle: the unit complex number c + s i
 
-// 4D Project()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Project(const SWIZZLE0& projectThis, const SWIZZLE1& ontoThis) { return Project(typename SWIZZLE0::PARENT(projectThis), typename SWIZZLE1::PARENT(ontoThis)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const SWIZZLE& projectThis, const VECTOR4<TYPE>& ontoThis) { return Project(typename SWIZZLE::PARENT(projectThis), ontoThis); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const VECTOR4<TYPE>& projectThis, const SWIZZLE& ontoThis) { return Project(projectThis, typename SWIZZLE::PARENT(ontoThis)); }
-template <typename TYPE> VECTOR4<TYPE> Project(const VECTOR4<TYPE>& projectThis, const VECTOR4<TYPE>& ontoThis)
+	// Constructors
+	ROTATION2() {}
+	ROTATION2(const TYPE& c, const TYPE& s) : c(c), s(s) {}
+	explicit ROTATION2(const TYPE& radians) : c(cos(radians)), s(sin(radians)) {}
+
+	static ROTATION2 Identity() { return ROTATION2((TYPE)1, (TYPE)0); }
+
+	// Assignment operators (default for = is fine)
+	const ROTATION2& operator*=(const ROTATION2& rhs) { *this = *this * rhs; return *this; }
+};
+
+// Rotation composition [*]: rotating by (lhs * rhs) rotates by both angles (in either order, as 2D rotations commute)
+template <typename TYPE> ROTATION2<TYPE> operator*(const ROTATION2<TYPE>& lhs, const ROTATION2<TYPE>& rhs) { return ROTATION2<TYPE>(lhs.c * rhs.c - lhs.s * rhs.s, lhs.s * rhs.c + lhs.c * rhs.s); }
+
+// Rotation Comparisons
+template <typename TYPE> bool operator==(const ROTATION2<TYPE>& lhs, const ROTATION2<TYPE>& rhs) { return lhs.c == rhs.c && lhs.s == rhs.s; }
+template <typename TYPE> bool operator!=(const ROTATION2<TYPE>& lhs, const ROTATION2<TYPE>& rhs) { return !(lhs == rhs); }
+template <typename TYPE> bool AlmostEqual(const ROTATION2<TYPE>& lhs, const ROTATION2<TYPE>& rhs) { return AlmostEqual(VECTOR2<TYPE>(lhs.c, lhs.s), VECTOR2<TYPE>(rhs.c, rhs.s)); }
+
+// Rotation Angle() (in (-pi, pi]), Inverse(), Normalize() (to undo the drift of many compositions)
+template <typename TYPE> TYPE Angle(const ROTATION2<TYPE>& rotation) { return atan2(rotation.s, rotation.c); }
+template <typename TYPE> ROTATION2<TYPE> Inverse(const ROTATION2<TYPE>& rotation) { return ROTATION2<TYPE>(rotation.c, -rotation.s); }
+template <typename TYPE> ROTATION2<TYPE> Normalize(const ROTATION2<TYPE>& toNormalize)
 {
-	return VECTOR4<TYPE>(Project(projectThis.xyz, ontoThis.xyz), ontoThis.w);
+	TYPE scale = PrecisionDivideBySqrt((TYPE)1, toNormalize.c * toNormalize.c + toNormalize.s * toNormalize.s);
+	return ROTATION2<TYPE>(toNormalize.c * scale, toNormalize.s * scale);
 }
 
-// 4D Rotate()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Rotate(const SWIZZLE0& toRotate, const SWIZZLE1& rotationAxis, const SCALAR_TYPE& radians) { return Rotate(typename SWIZZLE0::PARENT(toRotate), typename SWIZZLE1::PARENT(rotationAxis), radians); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& toRotate, const VECTOR4<TYPE>& rotationAxis, const SCALAR_TYPE& radians) { return Rotate(typename SWIZZLE::PARENT(toRotate), rotationAxis, radians); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const VECTOR4<TYPE>& toRotate, const SWIZZLE& rotationAxis, const SCALAR_TYPE& radians) { return Rotate(toRotate, typename SWIZZLE::PARENT(rotationAxis), radians); }
-template <typename TYPE> VECTOR4<TYPE> Rotate(const VECTOR4<TYPE>& toRotate, const VECTOR4<TYPE>& rotationAxis, const SCALAR_TYPE& radians)
+// Rotation Nlerp(): normalized linear interpolation, cheap but not constant speed (and undefined for opposite rotations)
+template <typename TYPE> ROTATION2<TYPE> Nlerp(const ROTATION2<TYPE>& start, const ROTATION2<TYPE>& end, const TYPE& delta)
 {
-	return VECTOR4<TYPE>(Rotate(toRotate.xyz, rotationAxis.xyz, radians), toRotate.w);
+	return Normalize(ROTATION2<TYPE>(start.c + (end.c - start.c) * delta, start.s + (end.s - start.s) * delta));
 }
 
-// 4D Lerp()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Lerp(const SWIZZLE0& start, const SWIZZLE1& end, const SCALAR_TYPE& delta) { return Lerp(typename SWIZZLE0::PARENT(start), typename SWIZZLE1::PARENT(end), delta); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const SWIZZLE& start, const VECTOR4<TYPE>& end, const SCALAR_TYPE& delta) { return Lerp(typename SWIZZLE::PARENT(start), end, delta); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const VECTOR4<TYPE>& start, const SWIZZLE& end, const SCALAR_TYPE& delta) { return Lerp(start, typename SWIZZLE::PARENT(end), delta); }
-template <typename TYPE> VECTOR4<TYPE> Lerp(const VECTOR4<TYPE>& start, const VECTOR4<TYPE>& end, const SCALAR_TYPE& delta)
+// Rotation Slerp(): constant speed along the shorter arc
+template <typename TYPE> ROTATION2<TYPE> Slerp(const ROTATION2<TYPE>& start, const ROTATION2<TYPE>& end, const TYPE& delta)
 {
-	return VECTOR4<TYPE>(start.x + delta * (end.x - start.x),
-	                     start.y + delta * (end.y - start.y),
-	                     start.z + delta * (end.z - start.z),
-	                     start.w + delta * (end.w - start.w));
+	return start * ROTATION2<TYPE>(Angle(end * Inverse(start)) * delta);
 }
 
-// 4D Max(): Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Max(const SWIZZLE0& a, const SWIZZLE1& b) { return Max(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Max(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Max(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR4<TYPE> Max(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+// Rotation ToMatrix(): the rotation as a 2x2 matrix
+template <typename TYPE> MATRIX2<TYPE> ToMatrix(const ROTATION2<TYPE>& rotation)
 {
-	return VECTOR4<TYPE>(max(a.x, b.x), max(a.y, b.y), max(a.z, b.z), max(a.w, b.w));
+	return MATRIX2<TYPE>(VECTOR2<TYPE>(rotation.c, rotation.s), VECTOR2<TYPE>(-rotation.s, rotation.c));
 }
 
-// 4D Min(): Component-wise
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Min(const SWIZZLE0& a, const SWIZZLE1& b) { return Min(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Min(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Min(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR4<TYPE> Min(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+// 2D Rotate() by a rotation
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& vector, const ROTATION2< typename RealType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >& rotation) { return Rotate(typename SWIZZLE::PARENT(vector), rotation); }
+template <typename TYPE> VECTOR2<TYPE> Rotate(const VECTOR2<TYPE>& vector, const ROTATION2< typename RealType<TYPE>::type >& rotation)
 {
-	return VECTOR4<TYPE>(min(a.x, b.x), min(a.y, b.y), min(a.z, b.z), min(a.w, b.w));
+	return VECTOR2<TYPE>(vector.x * rotation.c - vector.y * rotation.s, vector.x * rotation.s + vector.y * rotation.c);
 }
 
-// 4D Max(): Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const SCALAR_TYPE& maximum) { return Max(typename SWIZZLE::PARENT(a), maximum); }
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SCALAR_TYPE& maximum, const SWIZZLE& b) { return Max(maximum, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR4<TYPE> Max(const VECTOR4<TYPE>& a, const SCALAR_TYPE& maximum)
+// 2D batch Rotate() by a rotation, or each vector by angles[i], out may be in
+template <typename TYPE> void Rotate(VECTOR2<TYPE>* out, const VECTOR2<TYPE>* in, const ROTATION2< typename RealType<TYPE>::type >& rotation, const unsigned& count)
 {
-	return VECTOR4<TYPE>(max((SCALAR_TYPE)a.x, maximum), max((SCALAR_TYPE)a.y, maximum), max((SCALAR_TYPE)a.z, maximum), max((SCALAR_TYPE)a.w, maximum));
+	for (unsigned i = 0; i < count; i++)
+	{
+		out[i] = Rotate(in[i], rotation);
+	}
 }
-template <typename TYPE> VECTOR4<TYPE> Max(const SCALAR_TYPE& maximum, const VECTOR4<TYPE>& b)
+template <typename TYPE> void Rotate(VECTOR2<TYPE>* out, const VECTOR2<TYPE>* in, const typename RealType<TYPE>::type* angles, const unsigned& count)
 {
-	return VECTOR4<TYPE>(max(maximum, (SCALAR_TYPE)b.x), max(maximum, (SCALAR_TYPE)b.y), max(maximum, (SCALAR_TYPE)b.z), max(maximum, (SCALAR_TYPE)b.w));
+	for (unsigned i = 0; i < count; i++)
+	{
+		out[i] = Rotate(in[i], ROTATION2< typename RealType<TYPE>::type >(angles[i]));
+	}
 }
-
-// 4D Min(): Scalar
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const SCALAR_TYPE& minimum) { return Min(typename SWIZZLE::PARENT(a), minimum); }
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SCALAR_TYPE& minimum, const SWIZZLE& b) { return Min(minimum, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> VECTOR4<TYPE> Min(const VECTOR4<TYPE>& a, const SCALAR_TYPE& minimum)
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Rotate(const OUT& out, const A& a, const ROTATION2< typename RealType< typename ComponentType< typename A::PARENT >::type >::type >& rotation) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), rotation); }
+template <typename TYPE> void Rotate(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const ROTATION2< typename RealType<TYPE>::type >& rotation)
 {
-	return VECTOR4<TYPE>(min((SCALAR_TYPE)a.x, minimum), min((SCALAR_TYPE)a.y, minimum), min((SCALAR_TYPE)a.z, minimum), min((SCALAR_TYPE)a.w, minimum));
+	typename RealType<TYPE>::type ca = rotation.c, sa = rotation.s;
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			block0[lane] = aX * ca - aY * sa;
+			block1[lane] = aX * sa + aY * ca;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		block0[0] = aX * ca - aY * sa;
+		block1[0] = aX * sa + aY * ca;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
-template <typename TYPE> VECTOR4<TYPE> Min(const SCALAR_TYPE& minimum, const VECTOR4<TYPE>& b)
+template <typename OUT, typename A> inline typename EnableIf< IsSoa2D< typename OUT::PARENT >, typename EnableIf< IsSoa2D< typename A::PARENT >, void >::type >::type Rotate(const OUT& out, const A& a, const typename RealType< typename ComponentType< typename A::PARENT >::type >::type* angles) { Rotate(typename OUT::PARENT(out), typename A::PARENT(a), angles); }
+template <typename TYPE> void Rotate(const VECTOR2_SOA_VIEW<TYPE>& out, const VECTOR2_SOA_VIEW<TYPE>& a, const typename RealType<TYPE>::type* angles)
 {
-	return VECTOR4<TYPE>(min(minimum, (SCALAR_TYPE)b.x), min(minimum, (SCALAR_TYPE)b.y), min(minimum, (SCALAR_TYPE)b.z), min(minimum, (SCALAR_TYPE)b.w));
+	TYPE block0[SOA_LANES];
+	TYPE block1[SOA_LANES];
+	size_t n = 0; // Pointer-sized, so the block index does not wrap and the lanes load contiguously
+	for (; n + SOA_LANES <= a.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			size_t i = n + lane;
+			TYPE aX = a.x[i], aY = a.y[i];
+			typename RealType<TYPE>::type ca = cos(angles[i]), sa = sin(angles[i]);
+			block0[lane] = aX * ca - aY * sa;
+			block1[lane] = aX * sa + aY * ca;
+		}
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.x[n + lane] = block0[lane]; }
+		for (size_t lane = 0; lane < SOA_LANES; lane++) { out.y[n + lane] = block1[lane]; }
+	}
+	for (size_t i = n; i < a.count; i++)
+	{
+		TYPE aX = a.x[i], aY = a.y[i];
+		typename RealType<TYPE>::type ca = cos(angles[i]), sa = sin(angles[i]);
+		block0[0] = aX * ca - aY * sa;
+		block1[0] = aX * sa + aY * ca;
+		out.x[i] = block0[0];
+		out.y[i] = block1[0];
+	}
 }
 
-// 4D Ceil()
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Ceil(const SWIZZLE& toCeil) { return Ceil(typename SWIZZLE::PARENT(toCeil)); }
-template <typename TYPE> VECTOR4<TYPE> Ceil(const VECTOR4<TYPE>& toCeil)
+#ifdef SVML_USE_SSE
+// Two 2D vectors (x0, y0, x1, y1) rotated by (c, c, c, c) and (-s, s, -s, s)
+inline __m128 SimdRotate2(const __m128& xyxy, const __m128& c, const __m128& s)
 {
-	return VECTOR4<TYPE>(ceil(toCeil.x), ceil(toCeil.y), ceil(toCeil.z), ceil(toCeil.w));
+	return _mm_add_ps(_mm_mul_ps(xyxy, c), _mm_mul_ps(_mm_shuffle_ps(xyxy, xyxy, _MM_SHUFFLE(2, 3, 0, 1)), s));
 }
 
-// 4D Floor()
-template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Floor(const SWIZZLE& toFloor) { return Floor(typename SWIZZLE::PARENT(toFloor)); }
-template <typename TYPE> VECTOR4<TYPE> Floor(const VECTOR4<TYPE>& toFloor)
+inline void Rotate(VECTOR2<float>* out, const VECTOR2<float>* in, const ROTATION2<float>& rotation, const unsigned& count)
 {
-	return VECTOR4<TYPE>(floor(toFloor.x), floor(toFloor.y), floor(toFloor.z), floor(toFloor.w));
+	__m128 c = _mm_set1_ps(rotation.c);
+	__m128 s = _mm_setr_ps(-rotation.s, rotation.s, -rotation.s, rotation.s);
+	unsigned i = 0;
+	for (; i + 2 <= count; i += 2)
+	{
+		_mm_storeu_ps((float*)(out + i), SimdRotate2(_mm_loadu_ps((const float*)(in + i)), c, s));
+	}
+	if (i < count)
+	{
+		out[i] = Rotate(in[i], rotation);
+	}
 }
-
-// 4D Distance()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type Distance(const SWIZZLE0& a, const SWIZZLE1& b) { return Distance(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Distance(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Distance(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type Distance(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Distance(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE Distance(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+#endif // SVML_USE_SSE
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline void Rotate(VECTOR2<float>* out, const VECTOR2<float>* in, const float* angles, const unsigned& count)
 {
-	return sqrt(DistanceSquared(a.xyz, b.xyz));
+	__m128 negateEven = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+	unsigned i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 sine, cosine;
+		SimdSinCos(_mm_loadu_ps(angles + i), sine, cosine);
+		__m128 first = SimdRotate2(_mm_loadu_ps((const float*)(in + i)), _mm_unpacklo_ps(cosine, cosine), _mm_xor_ps(_mm_unpacklo_ps(sine, sine), negateEven));
+		__m128 second = SimdRotate2(_mm_loadu_ps((const float*)(in + i + 2)), _mm_unpackhi_ps(cosine, cosine), _mm_xor_ps(_mm_unpackhi_ps(sine, sine), negateEven));
+		_mm_storeu_ps((float*)(out + i), first);
+		_mm_storeu_ps((float*)(out + i + 2), second);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = Rotate(in[i], ROTATION2<float>(angles[i]));
+	}
 }
 
-// 4D DistanceSquared()
-template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, SCALAR_TYPE >::type >::type DistanceSquared(const SWIZZLE0& a, const SWIZZLE1& b) { return DistanceSquared(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
-template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type DistanceSquared(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return DistanceSquared(typename SWIZZLE::PARENT(a), b); }
-template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, SCALAR_TYPE >::type DistanceSquared(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return DistanceSquared(a, typename SWIZZLE::PARENT(b)); }
-template <typename TYPE> SCALAR_TYPE DistanceSquared(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+inline void Rotate(const VECTOR2_SOA_VIEW<float>& out, const VECTOR2_SOA_VIEW<float>& a, const float* angles)
 {
-	return DistanceSquared(a.xyz, b.xyz);
+	size_t i = 0;
+	for (; i + 4 <= a.count; i += 4)
+	{
+		__m128 sine, cosine;
+		SimdSinCos(_mm_loadu_ps(angles + i), sine, cosine);
+		__m128 x = _mm_loadu_ps(a.x + i), y = _mm_loadu_ps(a.y + i);
+		_mm_storeu_ps(out.x + i, _mm_sub_ps(_mm_mul_ps(x, cosine), _mm_mul_ps(y, sine)));
+		_mm_storeu_ps(out.y + i, _mm_add_ps(_mm_mul_ps(x, sine), _mm_mul_ps(y, cosine)));
+	}
+	for (; i < a.count; i++)
+	{
+		float aX = a.x[i], aY = a.y[i], sa = sin(angles[i]), ca = cos(angles[i]);
+		out.x[i] = aX * ca - aY * sa;
+		out.y[i] = aX * sa + aY * ca;
+	}
 }
-
-
+#endif // SVML_USE_SSE && __SSE2__
 
 //----------------------------------------------------------------------
 // 
-// Sec. 07 - Swizzle operator<< overloads for cout printing
+// Sec. 11 - Bounding box types and associated functions
 // 
 //----------------------------------------------------------------------
 
-template <typename SWIZZLE> inline
-typename EnableIf< Is2D< typename SWIZZLE::PARENT >, ostream >::type&
-operator<<(ostream& os, const SWIZZLE& printVector)
+// Corners of the empty box
+template <typename TYPE> TYPE AabbHighest() { return std::numeric_limits<TYPE>::max(); }
+template <typename TYPE> TYPE AabbLowest() { return std::numeric_limits<TYPE>::is_integer ? std::numeric_limits<TYPE>::min() : -std::numeric_limits<TYPE>::max(); }
+
+// Min and max that return b when either side is NaN, like _mm_min_ps() and _mm_max_ps(), so the scalar and SSE
+// code agree (the slab tests pass the running distance as b, which drops the NaN of 0 * infinity)
+template <typename TYPE> inline TYPE AabbMin(const TYPE& a, const TYPE& b) { return (a < b) ? a : b; }
+template <typename TYPE> inline TYPE AabbMax(const TYPE& a, const TYPE& b) { return (a > b) ? a : b; }
+
+template <typename TYPE>
+struct AABB2
+{
+	VECTOR2<TYPE> minimum, maximum; // Corners, a box with maximum < minimum on any axis is empty
+
+	// Constructors
+	AABB2() {}
+	AABB2(const VECTOR2<TYPE>& minimum, const VECTOR2<TYPE>& maximum) : minimum(minimum), maximum(maximum) {}
+	explicit AABB2(const VECTOR2<TYPE>& point) : minimum(point), maximum(point) {}
+
+	// Contains nothing and no ray hits it, Union() with it returns the other operand
+	static AABB2 Empty() { return AABB2(VECTOR2<TYPE>(AabbHighest<TYPE>(), AabbHighest<TYPE>()), VECTOR2<TYPE>(AabbLowest<TYPE>(), AabbLowest<TYPE>())); }
+};
+
+template <typename TYPE, unsigned SIZE>
+struct AABB2_PACKET
+{
+	TYPE minimum[2][SIZE], maximum[2][SIZE]; // [axis][box]
+
+	// Constructors (every box starts empty, so unused slots are never hit)
+	AABB2_PACKET() { for (unsigned i = 0; i < SIZE; i++) { Set(i, AABB2<TYPE>::Empty()); } }
+
+	// Box access
+	AABB2<TYPE> Get(const unsigned& index) const { return AABB2<TYPE>(VECTOR2<TYPE>(minimum[0][index], minimum[1][index]), VECTOR2<TYPE>(maximum[0][index], maximum[1][index])); }
+	void Set(const unsigned& index, const AABB2<TYPE>& box) { minimum[0][index] = box.minimum.x; maximum[0][index] = box.maximum.x; minimum[1][index] = box.minimum.y; maximum[1][index] = box.maximum.y; }
+};
+
+// 2D box comparisons
+template <typename TYPE> bool operator==(const AABB2<TYPE>& lhs, const AABB2<TYPE>& rhs) { return lhs.minimum == rhs.minimum && lhs.maximum == rhs.maximum; }
+template <typename TYPE> bool operator!=(const AABB2<TYPE>& lhs, const AABB2<TYPE>& rhs) { return !(lhs == rhs); }
+
+// 2D box IsEmpty(), Center(), Size()
+template <typename TYPE> bool IsEmpty(const AABB2<TYPE>& box) { return box.maximum.x < box.minimum.x || box.maximum.y < box.minimum.y; }
+template <typename TYPE> VECTOR2<TYPE> Center(const AABB2<TYPE>& box) { return (box.minimum + box.maximum) / (TYPE)2; }
+template <typename TYPE> VECTOR2<TYPE> Size(const AABB2<TYPE>& box) { return box.maximum - box.minimum; }
+template <typename TYPE> TYPE Area(const AABB2<TYPE>& box) { VECTOR2<TYPE> size = Size(box); return size.x * size.y; }
+
+// 2D box Union() and Intersection() (empty when the boxes do not overlap)
+template <typename TYPE> AABB2<TYPE> Union(const AABB2<TYPE>& a, const AABB2<TYPE>& b)
+{
+	return AABB2<TYPE>(VECTOR2<TYPE>(AabbMin<TYPE>(a.minimum.x, b.minimum.x), AabbMin<TYPE>(a.minimum.y, b.minimum.y)),
+	                   VECTOR2<TYPE>(AabbMax<TYPE>(a.maximum.x, b.maximum.x), AabbMax<TYPE>(a.maximum.y, b.maximum.y)));
+}
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, AABB2<TYPE> >::type Union(const AABB2<TYPE>& box, const SWIZZLE& point) { return Union(box, AABB2<TYPE>(typename SWIZZLE::PARENT(point))); }
+template <typename TYPE> AABB2<TYPE> Union(const AABB2<TYPE>& box, const VECTOR2<TYPE>& point) { return Union(box, AABB2<TYPE>(point)); }
+template <typename TYPE> AABB2<TYPE> Intersection(const AABB2<TYPE>& a, const AABB2<TYPE>& b)
 {
-	os << (typename SWIZZLE::PARENT(printVector));
-	return os;
+	return AABB2<TYPE>(VECTOR2<TYPE>(AabbMax<TYPE>(a.minimum.x, b.minimum.x), AabbMax<TYPE>(a.minimum.y, b.minimum.y)),
+	                   VECTOR2<TYPE>(AabbMin<TYPE>(a.maximum.x, b.maximum.x), AabbMin<TYPE>(a.maximum.y, b.maximum.y)));
 }
 
-template <typename SWIZZLE> inline
-typename EnableIf< Is3D< typename SWIZZLE::PARENT >, ostream >::type&
-operator<<(ostream& os, const SWIZZLE& printVector)
+// 2D box Overlaps() and Contains() (touching faces count)
+template <typename TYPE> bool Overlaps(const AABB2<TYPE>& a, const AABB2<TYPE>& b) { return a.minimum.x <= b.maximum.x && b.minimum.x <= a.maximum.x && a.minimum.y <= b.maximum.y && b.minimum.y <= a.maximum.y; }
+template <typename TYPE> bool Contains(const AABB2<TYPE>& box, const AABB2<TYPE>& inner) { return box.minimum.x <= inner.minimum.x && inner.maximum.x <= box.maximum.x && box.minimum.y <= inner.minimum.y && inner.maximum.y <= box.maximum.y; }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type Contains(const AABB2<TYPE>& box, const SWIZZLE& point) { return Contains(box, typename SWIZZLE::PARENT(point)); }
+template <typename TYPE> bool Contains(const AABB2<TYPE>& box, const VECTOR2<TYPE>& point) { return box.minimum.x <= point.x && point.x <= box.maximum.x && box.minimum.y <= point.y && point.y <= box.maximum.y; }
+
+// 2D Fit(): the smallest box containing every point (empty when count is 0)
+template <typename TYPE> AABB2<TYPE> Fit(const VECTOR2<TYPE>* points, const unsigned& count)
 {
-	os << (typename SWIZZLE::PARENT(printVector));
-	return os;
+	TYPE lowX = AabbHighest<TYPE>(), lowY = AabbHighest<TYPE>();
+	TYPE highX = AabbLowest<TYPE>(), highY = AabbLowest<TYPE>();
+	for (unsigned i = 0; i < count; i++)
+	{
+		TYPE x = points[i].x;
+		TYPE y = points[i].y;
+		lowX = AabbMin(x, lowX);
+		highX = AabbMax(x, highX);
+		lowY = AabbMin(y, lowY);
+		highY = AabbMax(y, highY);
+	}
+	return AABB2<TYPE>(VECTOR2<TYPE>(lowX, lowY), VECTOR2<TYPE>(highX, highY));
 }
 
-template <typename SWIZZLE> inline
-typename EnableIf< Is4D< typename SWIZZLE::PARENT >, ostream >::type&
-operator<<(ostream& os, const SWIZZLE& printVector)
+// 2D batch Fit()
+template <typename A> inline typename EnableIf< IsSoa2D< typename A::PARENT >, AABB2< typename ComponentType< typename A::PARENT >::type > >::type Fit(const A& points) { return Fit(typename A::PARENT(points)); }
+template <typename TYPE> AABB2<TYPE> Fit(const VECTOR2_SOA_VIEW<TYPE>& points)
 {
-	os << (typename SWIZZLE::PARENT(printVector));
-	return os;
+	TYPE lowX[SOA_LANES], lowY[SOA_LANES];
+	TYPE highX[SOA_LANES], highY[SOA_LANES];
+	for (size_t lane = 0; lane < SOA_LANES; lane++)
+	{
+		lowX[lane] = lowY[lane] = AabbHighest<TYPE>();
+		highX[lane] = highY[lane] = AabbLowest<TYPE>();
+	}
+	size_t n = 0;
+	for (; n + SOA_LANES <= points.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			lowX[lane] = AabbMin(points.x[n + lane], lowX[lane]);
+			highX[lane] = AabbMax(points.x[n + lane], highX[lane]);
+			lowY[lane] = AabbMin(points.y[n + lane], lowY[lane]);
+			highY[lane] = AabbMax(points.y[n + lane], highY[lane]);
+		}
+	}
+	for (size_t i = n; i < points.count; i++)
+	{
+		lowX[0] = AabbMin(points.x[i], lowX[0]);
+		highX[0] = AabbMax(points.x[i], highX[0]);
+		lowY[0] = AabbMin(points.y[i], lowY[0]);
+		highY[0] = AabbMax(points.y[i], highY[0]);
+	}
+	for (size_t lane = 1; lane < SOA_LANES; lane++)
+	{
+		lowX[0] = AabbMin(lowX[lane], lowX[0]);
+		highX[0] = AabbMax(highX[lane], highX[0]);
+		lowY[0] = AabbMin(lowY[lane], lowY[0]);
+		highY[0] = AabbMax(highY[lane], highY[0]);
+	}
+	return AABB2<TYPE>(VECTOR2<TYPE>(lowX[0], lowY[0]), VECTOR2<TYPE>(highX[0], highY[0]));
 }
 
+// 2D IntersectRay(): inverseDirection is 1 / direction per component (infinite components are
+// fine), true when the ray hits the box within maxDistance, distance is where it enters
+template <typename TYPE> bool IntersectRay(const AABB2<TYPE>& box, const VECTOR2<TYPE>& origin, const VECTOR2<TYPE>& inverseDirection, const TYPE& maxDistance, TYPE& distance)
+{
+	TYPE nearest = 0;
+	TYPE farthest = maxDistance;
+	bool flipX = inverseDirection.x < 0;
+	nearest = AabbMax(((flipX ? box.maximum.x : box.minimum.x) - origin.x) * inverseDirection.x, nearest);
+	farthest = AabbMin(((flipX ? box.minimum.x : box.maximum.x) - origin.x) * inverseDirection.x, farthest);
+	bool flipY = inverseDirection.y < 0;
+	nearest = AabbMax(((flipY ? box.maximum.y : box.minimum.y) - origin.y) * inverseDirection.y, nearest);
+	farthest = AabbMin(((flipY ? box.minimum.y : box.maximum.y) - origin.y) * inverseDirection.y, farthest);
+	distance = nearest;
+	return nearest <= farthest;
+}
 
+// 2D packet IntersectRay(): bit i of the result is set when box i is hit, entered at distances[i]
+template <typename TYPE, unsigned SIZE> unsigned IntersectRay(const AABB2_PACKET<TYPE, SIZE>& boxes, const VECTOR2<TYPE>& origin, const VECTOR2<TYPE>& inverseDirection, const TYPE& maxDistance, TYPE* distances)
+{
+	TYPE originX = origin.x, originY = origin.y;
+	TYPE inverseX = inverseDirection.x, inverseY = inverseDirection.y;
+	const TYPE* entriesX = (inverseX < 0) ? boxes.maximum[0] : boxes.minimum[0];
+	const TYPE* exitsX = (inverseX < 0) ? boxes.minimum[0] : boxes.maximum[0];
+	const TYPE* entriesY = (inverseY < 0) ? boxes.maximum[1] : boxes.minimum[1];
+	const TYPE* exitsY = (inverseY < 0) ? boxes.minimum[1] : boxes.maximum[1];
+	unsigned hits = 0;
+	for (unsigned i = 0; i < SIZE; i++)
+	{
+		TYPE nearest = 0;
+		TYPE farthest = maxDistance;
+		nearest = AabbMax((entriesX[i] - originX) * inverseX, nearest);
+		farthest = AabbMin((exitsX[i] - originX) * inverseX, farthest);
+		nearest = AabbMax((entriesY[i] - originY) * inverseY, nearest);
+		farthest = AabbMin((exitsY[i] - originY) * inverseY, farthest);
+		distances[i] = nearest;
+		hits |= (unsigned)(nearest <= farthest) << i;
+	}
+	return hits;
+}
 
-} // SVML namespace
+#ifdef SVML_USE_SSE
+inline AABB2<float> Fit(const VECTOR2<float>* points, const unsigned& count)
+{
+	__m128 low = _mm_set1_ps(AabbHighest<float>());
+	__m128 high = _mm_set1_ps(AabbLowest<float>());
+	unsigned i = 0;
+	for (; i + 2 <= count; i += 2)
+	{
+		__m128 xyxy = _mm_loadu_ps((const float*)(points + i));
+		low = _mm_min_ps(xyxy, low);
+		high = _mm_max_ps(xyxy, high);
+	}
+	if (i < count)
+	{
+		__m128 xy = _mm_setr_ps(points[i].x, points[i].y, points[i].x, points[i].y);
+		low = _mm_min_ps(xy, low);
+		high = _mm_max_ps(xy, high);
+	}
+	low = _mm_min_ps(low, _mm_movehl_ps(low, low));
+	high = _mm_max_ps(high, _mm_movehl_ps(high, high));
+	float lanes[8];
+	_mm_storeu_ps(lanes, low);
+	_mm_storeu_ps(lanes + 4, high);
+	return AABB2<float>(VECTOR2<float>(lanes[0], lanes[1]), VECTOR2<float>(lanes[4], lanes[5]));
+}
+
+template <unsigned SIZE> unsigned IntersectRay(const AABB2_PACKET<float, SIZE>& boxes, const VECTOR2<float>& origin, const VECTOR2<float>& inverseDirection, const float& maxDistance, float* distances)
+{
+	__m128 originX = _mm_set1_ps(origin.x), originY = _mm_set1_ps(origin.y);
+	__m128 inverseX = _mm_set1_ps(inverseDirection.x), inverseY = _mm_set1_ps(inverseDirection.y);
+	const float* entriesX = (inverseDirection.x < 0) ? boxes.maximum[0] : boxes.minimum[0];
+	const float* exitsX = (inverseDirection.x < 0) ? boxes.minimum[0] : boxes.maximum[0];
+	const float* entriesY = (inverseDirection.y < 0) ? boxes.maximum[1] : boxes.minimum[1];
+	const float* exitsY = (inverseDirection.y < 0) ? boxes.minimum[1] : boxes.maximum[1];
+	unsigned hits = 0;
+	unsigned i = 0;
+	for (; i + 4 <= SIZE; i += 4)
+	{
+		__m128 nearest = _mm_setzero_ps();
+		__m128 farthest = _mm_set1_ps(maxDistance);
+		nearest = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(entriesX + i), originX), inverseX), nearest);
+		farthest = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(exitsX + i), originX), inverseX), farthest);
+		nearest = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(entriesY + i), originY), inverseY), nearest);
+		farthest = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(exitsY + i), originY), inverseY), farthest);
+		_mm_storeu_ps(distances + i, nearest);
+		hits |= (unsigned)_mm_movemask_ps(_mm_cmple_ps(nearest, farthest)) << i;
+	}
+	for (; i < SIZE; i++)
+	{
+		float distance;
+		hits |= (unsigned)IntersectRay(boxes.Get(i), origin, inverseDirection, maxDistance, distance) << i;
+		distances[i] = distance;
+	}
+	return hits;
+}
+#endif // SVML_USE_SSE
+
+
+
+template <typename TYPE>
+struct AABB3
+{
+	VECTOR3<TYPE> minimum, maximum; // Corners, a box with maximum < minimum on any axis is empty
+
+	// Constructors
+	AABB3() {}
+	AABB3(const VECTOR3<TYPE>& minimum, const VECTOR3<TYPE>& maximum) : minimum(minimum), maximum(maximum) {}
+	explicit AABB3(const VECTOR3<TYPE>& point) : minimum(point), maximum(point) {}
+
+	// Contains nothing and no ray hits it, Union() with it returns the other operand
+	static AABB3 Empty() { return AABB3(VECTOR3<TYPE>(AabbHighest<TYPE>(), AabbHighest<TYPE>(), AabbHighest<TYPE>()), VECTOR3<TYPE>(AabbLowest<TYPE>(), AabbLowest<TYPE>(), AabbLowest<TYPE>())); }
+};
+
+template <typename TYPE, unsigned SIZE>
+struct AABB3_PACKET
+{
+	TYPE minimum[3][SIZE], maximum[3][SIZE]; // [axis][box]
+
+	// Constructors (every box starts empty, so unused slots are never hit)
+	AABB3_PACKET() { for (unsigned i = 0; i < SIZE; i++) { Set(i, AABB3<TYPE>::Empty()); } }
+
+	// Box access
+	AABB3<TYPE> Get(const unsigned& index) const { return AABB3<TYPE>(VECTOR3<TYPE>(minimum[0][index], minimum[1][index], minimum[2][index]), VECTOR3<TYPE>(maximum[0][index], maximum[1][index], maximum[2][index])); }
+	void Set(const unsigned& index, const AABB3<TYPE>& box) { minimum[0][index] = box.minimum.x; maximum[0][index] = box.maximum.x; minimum[1][index] = box.minimum.y; maximum[1][index] = box.maximum.y; minimum[2][index] = box.minimum.z; maximum[2][index] = box.maximum.z; }
+};
+
+// 3D box comparisons
+template <typename TYPE> bool operator==(const AABB3<TYPE>& lhs, const AABB3<TYPE>& rhs) { return lhs.minimum == rhs.minimum && lhs.maximum == rhs.maximum; }
+template <typename TYPE> bool operator!=(const AABB3<TYPE>& lhs, const AABB3<TYPE>& rhs) { return !(lhs == rhs); }
+
+// 3D box IsEmpty(), Center(), Size()
+template <typename TYPE> bool IsEmpty(const AABB3<TYPE>& box) { return box.maximum.x < box.minimum.x || box.maximum.y < box.minimum.y || box.maximum.z < box.minimum.z; }
+template <typename TYPE> VECTOR3<TYPE> Center(const AABB3<TYPE>& box) { return (box.minimum + box.maximum) / (TYPE)2; }
+template <typename TYPE> VECTOR3<TYPE> Size(const AABB3<TYPE>& box) { return box.maximum - box.minimum; }
+template <typename TYPE> TYPE SurfaceArea(const AABB3<TYPE>& box) { VECTOR3<TYPE> size = Size(box); return 2 * (size.x * size.y + size.y * size.z + size.z * size.x); }
+template <typename TYPE> TYPE Volume(const AABB3<TYPE>& box) { VECTOR3<TYPE> size = Size(box); return size.x * size.y * size.z; }
+
+// 3D box Union() and Intersection() (empty when the boxes do not overlap)
+template <typename TYPE> AABB3<TYPE> Union(const AABB3<TYPE>& a, const AABB3<TYPE>& b)
+{
+	return AABB3<TYPE>(VECTOR3<TYPE>(AabbMin<TYPE>(a.minimum.x, b.minimum.x), AabbMin<TYPE>(a.minimum.y, b.minimum.y), AabbMin<TYPE>(a.minimum.z, b.minimum.z)),
+	                   VECTOR3<TYPE>(AabbMax<TYPE>(a.maximum.x, b.maximum.x), AabbMax<TYPE>(a.maximum.y, b.maximum.y), AabbMax<TYPE>(a.maximum.z, b.maximum.z)));
+}
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, AABB3<TYPE> >::type Union(const AABB3<TYPE>& box, const SWIZZLE& point) { return Union(box, AABB3<TYPE>(typename SWIZZLE::PARENT(point))); }
+template <typename TYPE> AABB3<TYPE> Union(const AABB3<TYPE>& box, const VECTOR3<TYPE>& point) { return Union(box, AABB3<TYPE>(point)); }
+template <typename TYPE> AABB3<TYPE> Intersection(const AABB3<TYPE>& a, const AABB3<TYPE>& b)
+{
+	return AABB3<TYPE>(VECTOR3<TYPE>(AabbMax<TYPE>(a.minimum.x, b.minimum.x), AabbMax<TYPE>(a.minimum.y, b.minimum.y), AabbMax<TYPE>(a.minimum.z, b.minimum.z)),
+	                   VECTOR3<TYPE>(AabbMin<TYPE>(a.maximum.x, b.maximum.x), AabbMin<TYPE>(a.maximum.y, b.maximum.y), AabbMin<TYPE>(a.maximum.z, b.maximum.z)));
+}
+
+// 3D box Overlaps() and Contains() (touching faces count)
+template <typename TYPE> bool Overlaps(const AABB3<TYPE>& a, const AABB3<TYPE>& b) { return a.minimum.x <= b.maximum.x && b.minimum.x <= a.maximum.x && a.minimum.y <= b.maximum.y && b.minimum.y <= a.maximum.y && a.minimum.z <= b.maximum.z && b.minimum.z <= a.maximum.z; }
+template <typename TYPE> bool Contains(const AABB3<TYPE>& box, const AABB3<TYPE>& inner) { return box.minimum.x <= inner.minimum.x && inner.maximum.x <= box.maximum.x && box.minimum.y <= inner.minimum.y && inner.maximum.y <= box.maximum.y && box.minimum.z <= inner.minimum.z && inner.maximum.z <= box.maximum.z; }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type Contains(const AABB3<TYPE>& box, const SWIZZLE& point) { return Contains(box, typename SWIZZLE::PARENT(point)); }
+template <typename TYPE> bool Contains(const AABB3<TYPE>& box, const VECTOR3<TYPE>& point) { return box.minimum.x <= point.x && point.x <= box.maximum.x && box.minimum.y <= point.y && point.y <= box.maximum.y && box.minimum.z <= point.z && point.z <= box.maximum.z; }
+
+// 3D Fit(): the smallest box containing every point (empty when count is 0)
+template <typename TYPE> AABB3<TYPE> Fit(const VECTOR3<TYPE>* points, const unsigned& count)
+{
+	TYPE lowX = AabbHighest<TYPE>(), lowY = AabbHighest<TYPE>(), lowZ = AabbHighest<TYPE>();
+	TYPE highX = AabbLowest<TYPE>(), highY = AabbLowest<TYPE>(), highZ = AabbLowest<TYPE>();
+	for (unsigned i = 0; i < count; i++)
+	{
+		TYPE x = points[i].x;
+		TYPE y = points[i].y;
+		TYPE z = points[i].z;
+		lowX = AabbMin(x, lowX);
+		highX = AabbMax(x, highX);
+		lowY = AabbMin(y, lowY);
+		highY = AabbMax(y, highY);
+		lowZ = AabbMin(z, lowZ);
+		highZ = AabbMax(z, highZ);
+	}
+	return AABB3<TYPE>(VECTOR3<TYPE>(lowX, lowY, lowZ), VECTOR3<TYPE>(highX, highY, highZ));
+}
+
+// 3D batch Fit()
+template <typename A> inline typename EnableIf< IsSoa3D< typename A::PARENT >, AABB3< typename ComponentType< typename A::PARENT >::type > >::type Fit(const A& points) { return Fit(typename A::PARENT(points)); }
+template <typename TYPE> AABB3<TYPE> Fit(const VECTOR3_SOA_VIEW<TYPE>& points)
+{
+	TYPE lowX[SOA_LANES], lowY[SOA_LANES], lowZ[SOA_LANES];
+	TYPE highX[SOA_LANES], highY[SOA_LANES], highZ[SOA_LANES];
+	for (size_t lane = 0; lane < SOA_LANES; lane++)
+	{
+		lowX[lane] = lowY[lane] = lowZ[lane] = AabbHighest<TYPE>();
+		highX[lane] = highY[lane] = highZ[lane] = AabbLowest<TYPE>();
+	}
+	size_t n = 0;
+	for (; n + SOA_LANES <= points.count; n += SOA_LANES)
+	{
+		for (size_t lane = 0; lane < SOA_LANES; lane++)
+		{
+			lowX[lane] = AabbMin(points.x[n + lane], lowX[lane]);
+			highX[lane] = AabbMax(points.x[n + lane], highX[lane]);
+			lowY[lane] = AabbMin(points.y[n + lane], lowY[lane]);
+			highY[lane] = AabbMax(points.y[n + lane], highY[lane]);
+			lowZ[lane] = AabbMin(points.z[n + lane], lowZ[lane]);
+			highZ[lane] = AabbMax(points.z[n + lane], highZ[lane]);
+		}
+	}
+	for (size_t i = n; i < points.count; i++)
+	{
+		lowX[0] = AabbMin(points.x[i], lowX[0]);
+		highX[0] = AabbMax(points.x[i], highX[0]);
+		lowY[0] = AabbMin(points.y[i], lowY[0]);
+		highY[0] = AabbMax(points.y[i], highY[0]);
+		lowZ[0] = AabbMin(points.z[i], lowZ[0]);
+		highZ[0] = AabbMax(points.z[i], highZ[0]);
+	}
+	for (size_t lane = 1; lane < SOA_LANES; lane++)
+	{
+		lowX[0] = AabbMin(lowX[lane], lowX[0]);
+		highX[0] = AabbMax(highX[lane], highX[0]);
+		lowY[0] = AabbMin(lowY[lane], lowY[0]);
+		highY[0] = AabbMax(highY[lane], highY[0]);
+		lowZ[0] = AabbMin(lowZ[lane], lowZ[0]);
+		highZ[0] = AabbMax(highZ[lane], highZ[0]);
+	}
+	return AABB3<TYPE>(VECTOR3<TYPE>(lowX[0], lowY[0], lowZ[0]), VECTOR3<TYPE>(highX[0], highY[0], highZ[0]));
+}
+
+// 3D IntersectRay(): inverseDirection is 1 / direction per component (infinite components are
+// fine), true when the ray hits the box within maxDistance, distance is where it enters
+template <typename TYPE> bool IntersectRay(const AABB3<TYPE>& box, const VECTOR3<TYPE>& origin, const VECTOR3<TYPE>& inverseDirection, const TYPE& maxDistance, TYPE& distance)
+{
+	TYPE nearest = 0;
+	TYPE farthest = maxDistance;
+	bool flipX = inverseDirection.x < 0;
+	nearest = AabbMax(((flipX ? box.maximum.x : box.minimum.x) - origin.x) * inverseDirection.x, nearest);
+	farthest = AabbMin(((flipX ? box.minimum.x : box.maximum.x) - origin.x) * inverseDirection.x, farthest);
+	bool flipY = inverseDirection.y < 0;
+	nearest = AabbMax(((flipY ? box.maximum.y : box.minimum.y) - origin.y) * inverseDirection.y, nearest);
+	farthest = AabbMin(((flipY ? box.minimum.y : box.maximum.y) - origin.y) * inverseDirection.y, farthest);
+	bool flipZ = inverseDirection.z < 0;
+	nearest = AabbMax(((flipZ ? box.maximum.z : box.minimum.z) - origin.z) * inverseDirection.z, nearest);
+	farthest = AabbMin(((flipZ ? box.minimum.z : box.maximum.z) - origin.z) * inverseDirection.z, farthest);
+	distance = nearest;
+	return nearest <= farthest;
+}
+
+// 3D packet IntersectRay(): bit i of the result is set when box i is hit, entered at distances[i]
+template <typename TYPE, unsigned SIZE> unsigned IntersectRay(const AABB3_PACKET<TYPE, SIZE>& boxes, const VECTOR3<TYPE>& origin, const VECTOR3<TYPE>& inverseDirection, const TYPE& maxDistance, TYPE* distances)
+{
+	TYPE originX = origin.x, originY = origin.y, originZ = origin.z;
+	TYPE inverseX = inverseDirection.x, inverseY = inverseDirection.y, inverseZ = inverseDirection.z;
+	const TYPE* entriesX = (inverseX < 0) ? boxes.maximum[0] : boxes.minimum[0];
+	const TYPE* exitsX = (inverseX < 0) ? boxes.minimum[0] : boxes.maximum[0];
+	const TYPE* entriesY = (inverseY < 0) ? boxes.maximum[1] : boxes.minimum[1];
+	const TYPE* exitsY = (inverseY < 0) ? boxes.minimum[1] : boxes.maximum[1];
+	const TYPE* entriesZ = (inverseZ < 0) ? boxes.maximum[2] : boxes.minimum[2];
+	const TYPE* exitsZ = (inverseZ < 0) ? boxes.minimum[2] : boxes.maximum[2];
+	unsigned hits = 0;
+	for (unsigned i = 0; i < SIZE; i++)
+	{
+		TYPE nearest = 0;
+		TYPE farthest = maxDistance;
+		nearest = AabbMax((entriesX[i] - originX) * inverseX, nearest);
+		farthest = AabbMin((exitsX[i] - originX) * inverseX, farthest);
+		nearest = AabbMax((entriesY[i] - originY) * inverseY, nearest);
+		farthest = AabbMin((exitsY[i] - originY) * inverseY, farthest);
+		nearest = AabbMax((entriesZ[i] - originZ) * inverseZ, nearest);
+		farthest = AabbMin((exitsZ[i] - originZ) * inverseZ, farthest);
+		distances[i] = nearest;
+		hits |= (unsigned)(nearest <= farthest) << i;
+	}
+	return hits;
+}
+
+#ifdef SVML_USE_SSE
+inline AABB3<float> Fit(const VECTOR3<float>* points, const unsigned& count)
+{
+	// Two sets of corners, so consecutive points do not wait on each other
+	__m128 low0 = _mm_set1_ps(AabbHighest<float>()), low1 = low0;
+	__m128 high0 = _mm_set1_ps(AabbLowest<float>()), high1 = high0;
+	unsigned i = 0;
+	for (; i + 2 <= count; i += 2)
+	{
+		low0 = _mm_min_ps(points[i].Simd(), low0);
+		high0 = _mm_max_ps(points[i].Simd(), high0);
+		low1 = _mm_min_ps(points[i + 1].Simd(), low1);
+		high1 = _mm_max_ps(points[i + 1].Simd(), high1);
+	}
+	if (i < count)
+	{
+		low0 = _mm_min_ps(points[i].Simd(), low0);
+		high0 = _mm_max_ps(points[i].Simd(), high0);
+	}
+	return AABB3<float>(VECTOR3<float>(_mm_min_ps(low0, low1)), VECTOR3<float>(_mm_max_ps(high0, high1)));
+}
+
+inline bool IntersectRay(const AABB3<float>& box, const VECTOR3<float>& origin, const VECTOR3<float>& inverseDirection, const float& maxDistance, float& distance)
+{
+	// Entered through the planes facing the ray: the maximum corner where the direction is negative
+	__m128 flip = _mm_cmplt_ps(inverseDirection.Simd(), _mm_setzero_ps());
+	__m128 entryCorner = _mm_or_ps(_mm_and_ps(flip, box.maximum.Simd()), _mm_andnot_ps(flip, box.minimum.Simd()));
+	__m128 exitCorner = _mm_or_ps(_mm_and_ps(flip, box.minimum.Simd()), _mm_andnot_ps(flip, box.maximum.Simd()));
+	__m128 entries = _mm_mul_ps(_mm_sub_ps(entryCorner, origin.Simd()), inverseDirection.Simd());
+	__m128 exits = _mm_mul_ps(_mm_sub_ps(exitCorner, origin.Simd()), inverseDirection.Simd());
+	// Folds x, y, and z in the scalar order (w is not an axis)
+	__m128 nearest = _mm_max_ss(entries, _mm_setzero_ps());
+	__m128 farthest = _mm_min_ss(exits, _mm_set_ss(maxDistance));
+	nearest = _mm_max_ss(_mm_shuffle_ps(entries, entries, _MM_SHUFFLE(1, 1, 1, 1)), nearest);
+	farthest = _mm_min_ss(_mm_shuffle_ps(exits, exits, _MM_SHUFFLE(1, 1, 1, 1)), farthest);
+	nearest = _mm_max_ss(_mm_movehl_ps(entries, entries), nearest);
+	farthest = _mm_min_ss(_mm_movehl_ps(exits, exits), farthest);
+	distance = _mm_cvtss_f32(nearest);
+	return distance <= _mm_cvtss_f32(farthest);
+}
+
+template <unsigned SIZE> unsigned IntersectRay(const AABB3_PACKET<float, SIZE>& boxes, const VECTOR3<float>& origin, const VECTOR3<float>& inverseDirection, const float& maxDistance, float* distances)
+{
+	__m128 originX = _mm_set1_ps(origin.x), originY = _mm_set1_ps(origin.y), originZ = _mm_set1_ps(origin.z);
+	__m128 inverseX = _mm_set1_ps(inverseDirection.x), inverseY = _mm_set1_ps(inverseDirection.y), inverseZ = _mm_set1_ps(inverseDirection.z);
+	const float* entriesX = (inverseDirection.x < 0) ? boxes.maximum[0] : boxes.minimum[0];
+	const float* exitsX = (inverseDirection.x < 0) ? boxes.minimum[0] : boxes.maximum[0];
+	const float* entriesY = (inverseDirection.y < 0) ? boxes.maximum[1] : boxes.minimum[1];
+	const float* exitsY = (inverseDirection.y < 0) ? boxes.minimum[1] : boxes.maximum[1];
+	const float* entriesZ = (inverseDirection.z < 0) ? boxes.maximum[2] : boxes.minimum[2];
+	const float* exitsZ = (inverseDirection.z < 0) ? boxes.minimum[2] : boxes.maximum[2];
+	unsigned hits = 0;
+	unsigned i = 0;
+	for (; i + 4 <= SIZE; i += 4)
+	{
+		__m128 nearest = _mm_setzero_ps();
+		__m128 farthest = _mm_set1_ps(maxDistance);
+		nearest = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(entriesX + i), originX), inverseX), nearest);
+		farthest = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(exitsX + i), originX), inverseX), farthest);
+		nearest = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(entriesY + i), originY), inverseY), nearest);
+		farthest = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(exitsY + i), originY), inverseY), farthest);
+		nearest = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(entriesZ + i), originZ), inverseZ), nearest);
+		farthest = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(exitsZ + i), originZ), inverseZ), farthest);
+		_mm_storeu_ps(distances + i, nearest);
+		hits |= (unsigned)_mm_movemask_ps(_mm_cmple_ps(nearest, farthest)) << i;
+	}
+	for (; i < SIZE; i++)
+	{
+		float distance;
+		hits |= (unsigned)IntersectRay(boxes.Get(i), origin, inverseDirection, maxDistance, distance) << i;
+		distances[i] = distance;
+	}
+	return hits;
+}
+#endif // SVML_USE_SSE
+
+
+
+//----------------------------------------------------------------------
+// 
+// Sec. 12 - Deterministic reductions over arrays of points
+// 
+//----------------------------------------------------------------------
+
+// Points per block of Sum(), Centroid() and Covariance()
+const unsigned REDUCTION_BLOCK = 1024;
+
+// One compensated addition, and the value of four accumulators added in a fixed order
+template <typename TYPE> inline void ReductionAdd(TYPE& sum, TYPE& compensation, const TYPE& value)
+{
+	TYPE corrected = value - compensation;
+	TYPE total = sum + corrected;
+	compensation = (total - sum) - corrected;
+	sum = total;
+}
+template <typename TYPE> inline TYPE ReductionFold(const TYPE sum[4], const TYPE compensation[4]) { return ((sum[0] - compensation[0]) + (sum[1] - compensation[1])) + ((sum[2] - compensation[2]) + (sum[3] - compensation[3])); }
+
+#ifdef SVML_USE_SSE
+// ReductionAdd() of four lanes
+inline void SimdReductionAdd(__m128& sum, __m128& compensation, const __m128& value)
+{
+	__m128 corrected = _mm_sub_ps(value, compensation);
+	__m128 total = _mm_add_ps(sum, corrected);
+	compensation = _mm_sub_ps(_mm_sub_ps(total, sum), corrected);
+	sum = total;
+}
+
+#endif // SVML_USE_SSE
+// 2D sum of one block, point i going to accumulator i % 4
+template <typename TYPE> VECTOR2<TYPE> BlockSum(const VECTOR2<TYPE>* points, const unsigned& count)
+{
+	TYPE sumX[4], sumY[4];
+	TYPE sumXCompensation[4], sumYCompensation[4];
+	for (unsigned lane = 0; lane < 4; lane++)
+	{
+		sumX[lane] = sumXCompensation[lane] = sumY[lane] = sumYCompensation[lane] = (TYPE)0;
+	}
+	unsigned i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		for (unsigned lane = 0; lane < 4; lane++)
+		{
+			ReductionAdd<TYPE>(sumX[lane], sumXCompensation[lane], points[i + lane].x);
+			ReductionAdd<TYPE>(sumY[lane], sumYCompensation[lane], points[i + lane].y);
+		}
+	}
+	for (; i < count; i++)
+	{
+		ReductionAdd<TYPE>(sumX[i % 4], sumXCompensation[i % 4], points[i].x);
+		ReductionAdd<TYPE>(sumY[i % 4], sumYCompensation[i % 4], points[i].y);
+	}
+	return VECTOR2<TYPE>(ReductionFold(sumX, sumXCompensation), ReductionFold(sumY, sumYCompensation));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR2<float> BlockSum(const VECTOR2<float>* points, const unsigned& count)
+{
+	// Two points per register, so the lanes of sum01 are accumulators 0 and 1 and those of sum23 are 2 and 3
+	__m128 sum01 = _mm_setzero_ps(), sum23 = sum01, compensation01 = sum01, compensation23 = sum01;
+	unsigned i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		SimdReductionAdd(sum01, compensation01, _mm_loadu_ps((const float*)(points + i)));
+		SimdReductionAdd(sum23, compensation23, _mm_loadu_ps((const float*)(points + i + 2)));
+	}
+	float sums[8], compensations[8];
+	_mm_storeu_ps(sums, sum01);
+	_mm_storeu_ps(sums + 4, sum23);
+	_mm_storeu_ps(compensations, compensation01);
+	_mm_storeu_ps(compensations + 4, compensation23);
+	float sumX[4], sumY[4], sumXCompensation[4], sumYCompensation[4];
+	for (unsigned lane = 0; lane < 4; lane++)
+	{
+		sumX[lane] = sums[lane * 2];
+		sumY[lane] = sums[lane * 2 + 1];
+		sumXCompensation[lane] = compensations[lane * 2];
+		sumYCompensation[lane] = compensations[lane * 2 + 1];
+	}
+	for (; i < count; i++)
+	{
+		ReductionAdd<float>(sumX[i % 4], sumXCompensation[i % 4], points[i].x);
+		ReductionAdd<float>(sumY[i % 4], sumYCompensation[i % 4], points[i].y);
+	}
+	return VECTOR2<float>(ReductionFold(sumX, sumXCompensation), ReductionFold(sumY, sumYCompensation));
+}
+
+#endif // SVML_USE_SSE
+// 2D Sum() and Centroid() of an array (0 when count is 0): blocks of REDUCTION_BLOCK points combined pairwise
+template <typename TYPE> VECTOR2<TYPE> Sum(const VECTOR2<TYPE>* points, const unsigned& count)
+{
+	unsigned blocks = count / REDUCTION_BLOCK + ((count % REDUCTION_BLOCK) ? 1 : 0);
+	if (blocks <= 1) { return BlockSum(points, count); }
+	unsigned half = blocks / 2 * REDUCTION_BLOCK;
+	return Sum(points, half) + Sum(points + half, count - half);
+}
+template <typename TYPE> VECTOR2<TYPE> Centroid(const VECTOR2<TYPE>* points, const unsigned& count) { return (count > 0) ? Sum(points, count) / (typename ScalarType<TYPE>::type)count : VECTOR2<TYPE>((TYPE)0, (TYPE)0); }
+
+// 2D scatter of one block about center: the sum of outer products of (point - center)
+template <typename TYPE> MATRIX2<TYPE> BlockScatter(const VECTOR2<TYPE>* points, const unsigned& count, const VECTOR2<TYPE>& center)
+{
+	TYPE sumXX[4], sumXY[4], sumYY[4];
+	TYPE sumXXCompensation[4], sumXYCompensation[4], sumYYCompensation[4];
+	for (unsigned lane = 0; lane < 4; lane++)
+	{
+		sumXX[lane] = sumXXCompensation[lane] = sumXY[lane] = sumXYCompensation[lane] = sumYY[lane] = sumYYCompensation[lane] = (TYPE)0;
+	}
+	for (unsigned i = 0; i < count; i++)
+	{
+		unsigned lane = i % 4;
+		TYPE x = points[i].x - center.x;
+		TYPE y = points[i].y - center.y;
+		ReductionAdd<TYPE>(sumXX[lane], sumXXCompensation[lane], x * x);
+		ReductionAdd<TYPE>(sumXY[lane], sumXYCompensation[lane], x * y);
+		ReductionAdd<TYPE>(sumYY[lane], sumYYCompensation[lane], y * y);
+	}
+	TYPE xx = ReductionFold(sumXX, sumXXCompensation);
+	TYPE xy = ReductionFold(sumXY, sumXYCompensation);
+	TYPE yy = ReductionFold(sumYY, sumYYCompensation);
+	return MATRIX2<TYPE>(VECTOR2<TYPE>(xx, xy), VECTOR2<TYPE>(xy, yy));
+}
+
+// 2D Scatter() about center and Covariance() (the population covariance, for PCA: its eigenvectors are the principal axes)
+template <typename TYPE> MATRIX2<TYPE> Scatter(const VECTOR2<TYPE>* points, const unsigned& count, const VECTOR2<TYPE>& center)
+{
+	unsigned blocks = count / REDUCTION_BLOCK + ((count % REDUCTION_BLOCK) ? 1 : 0);
+	if (blocks <= 1) { return BlockScatter(points, count, center); }
+	unsigned half = blocks / 2 * REDUCTION_BLOCK;
+	return Scatter(points, half, center) + Scatter(points + half, count - half, center);
+}
+template <typename TYPE> MATRIX2<TYPE> Covariance(const VECTOR2<TYPE>* points, const unsigned& count) { return (count > 0) ? Scatter(points, count, Centroid(points, count)) * ((typename ScalarType<TYPE>::type)1 / (typename ScalarType<TYPE>::type)count) : MATRIX2<TYPE>((TYPE)0); }
+
+
+// 3D sum of one block, point i going to accumulator i % 4
+template <typename TYPE> VECTOR3<TYPE> BlockSum(const VECTOR3<TYPE>* points, const unsigned& count)
+{
+	TYPE sumX[4], sumY[4], sumZ[4];
+	TYPE sumXCompensation[4], sumYCompensation[4], sumZCompensation[4];
+	for (unsigned lane = 0; lane < 4; lane++)
+	{
+		sumX[lane] = sumXCompensation[lane] = sumY[lane] = sumYCompensation[lane] = sumZ[lane] = sumZCompensation[lane] = (TYPE)0;
+	}
+	unsigned i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		for (unsigned lane = 0; lane < 4; lane++)
+		{
+			ReductionAdd<TYPE>(sumX[lane], sumXCompensation[lane], points[i + lane].x);
+			ReductionAdd<TYPE>(sumY[lane], sumYCompensation[lane], points[i + lane].y);
+			ReductionAdd<TYPE>(sumZ[lane], sumZCompensation[lane], points[i + lane].z);
+		}
+	}
+	for (; i < count; i++)
+	{
+		ReductionAdd<TYPE>(sumX[i % 4], sumXCompensation[i % 4], points[i].x);
+		ReductionAdd<TYPE>(sumY[i % 4], sumYCompensation[i % 4], points[i].y);
+		ReductionAdd<TYPE>(sumZ[i % 4], sumZCompensation[i % 4], points[i].z);
+	}
+	return VECTOR3<TYPE>(ReductionFold(sumX, sumXCompensation), ReductionFold(sumY, sumYCompensation), ReductionFold(sumZ, sumZCompensation));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> BlockSum(const VECTOR3<float>* points, const unsigned& count)
+{
+	// One point per register, all of its components at once
+	__m128 sum[4], compensation[4];
+	for (unsigned lane = 0; lane < 4; lane++)
+	{
+		sum[lane] = compensation[lane] = _mm_setzero_ps();
+	}
+	unsigned i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		for (unsigned lane = 0; lane < 4; lane++)
+		{
+			SimdReductionAdd(sum[lane], compensation[lane], points[i + lane].Simd());
+		}
+	}
+	for (; i < count; i++)
+	{
+		SimdReductionAdd(sum[i % 4], compensation[i % 4], points[i].Simd());
+	}
+	__m128 low = _mm_add_ps(_mm_sub_ps(sum[0], compensation[0]), _mm_sub_ps(sum[1], compensation[1]));
+	__m128 high = _mm_add_ps(_mm_sub_ps(sum[2], compensation[2]), _mm_sub_ps(sum[3], compensation[3]));
+	return VECTOR3<float>(_mm_add_ps(low, high));
+}
+
+#endif // SVML_USE_SSE
+// 3D Sum() and Centroid() of an array (0 when count is 0): blocks of REDUCTION_BLOCK points combined pairwise
+template <typename TYPE> VECTOR3<TYPE> Sum(const VECTOR3<TYPE>* points, const unsigned& count)
+{
+	unsigned blocks = count / REDUCTION_BLOCK + ((count % REDUCTION_BLOCK) ? 1 : 0);
+	if (blocks <= 1) { return BlockSum(points, count); }
+	unsigned half = blocks / 2 * REDUCTION_BLOCK;
+	return Sum(points, half) + Sum(points + half, count - half);
+}
+template <typename TYPE> VECTOR3<TYPE> Centroid(const VECTOR3<TYPE>* points, const unsigned& count) { return (count > 0) ? Sum(points, count) / (typename ScalarType<TYPE>::type)count : VECTOR3<TYPE>((TYPE)0, (TYPE)0, (TYPE)0); }
+
+// 3D scatter of one block about center: the sum of outer products of (point - center)
+template <typename TYPE> MATRIX3<TYPE> BlockScatter(const VECTOR3<TYPE>* points, const unsigned& count, const VECTOR3<TYPE>& center)
+{
+	TYPE sumXX[4], sumXY[4], sumXZ[4], sumYY[4], sumYZ[4], sumZZ[4];
+	TYPE sumXXCompensation[4], sumXYCompensation[4], sumXZCompensation[4], sumYYCompensation[4], sumYZCompensation[4], sumZZCompensation[4];
+	for (unsigned lane = 0; lane < 4; lane++)
+	{
+		sumXX[lane] = sumXXCompensation[lane] = sumXY[lane] = sumXYCompensation[lane] = sumXZ[lane] = sumXZCompensation[lane] = sumYY[lane] = sumYYCompensation[lane] = sumYZ[lane] = sumYZCompensation[lane] = sumZZ[lane] = sumZZCompensation[lane] = (TYPE)0;
+	}
+	for (unsigned i = 0; i < count; i++)
+	{
+		unsigned lane = i % 4;
+		TYPE x = points[i].x - center.x;
+		TYPE y = points[i].y - center.y;
+		TYPE z = points[i].z - center.z;
+		ReductionAdd<TYPE>(sumXX[lane], sumXXCompensation[lane], x * x);
+		ReductionAdd<TYPE>(sumXY[lane], sumXYCompensation[lane], x * y);
+		ReductionAdd<TYPE>(sumXZ[lane], sumXZCompensation[lane], x * z);
+		ReductionAdd<TYPE>(sumYY[lane], sumYYCompensation[lane], y * y);
+		ReductionAdd<TYPE>(sumYZ[lane], sumYZCompensation[lane], y * z);
+		ReductionAdd<TYPE>(sumZZ[lane], sumZZCompensation[lane], z * z);
+	}
+	TYPE xx = ReductionFold(sumXX, sumXXCompensation);
+	TYPE xy = ReductionFold(sumXY, sumXYCompensation);
+	TYPE xz = ReductionFold(sumXZ, sumXZCompensation);
+	TYPE yy = ReductionFold(sumYY, sumYYCompensation);
+	TYPE yz = ReductionFold(sumYZ, sumYZCompensation);
+	TYPE zz = ReductionFold(sumZZ, sumZZCompensation);
+	return MATRIX3<TYPE>(VECTOR3<TYPE>(xx, xy, xz), VECTOR3<TYPE>(xy, yy, yz), VECTOR3<TYPE>(xz, yz, zz));
+}
+
+// 3D Scatter() about center and Covariance() (the population covariance, for PCA: its eigenvectors are the principal axes)
+template <typename TYPE> MATRIX3<TYPE> Scatter(const VECTOR3<TYPE>* points, const unsigned& count, const VECTOR3<TYPE>& center)
+{
+	unsigned blocks = count / REDUCTION_BLOCK + ((count % REDUCTION_BLOCK) ? 1 : 0);
+	if (blocks <= 1) { return BlockScatter(points, count, center); }
+	unsigned half = blocks / 2 * REDUCTION_BLOCK;
+	return Scatter(points, half, center) + Scatter(points + half, count - half, center);
+}
+template <typename TYPE> MATRIX3<TYPE> Covariance(const VECTOR3<TYPE>* points, const unsigned& count) { return (count > 0) ? Scatter(points, count, Centroid(points, count)) * ((typename ScalarType<TYPE>::type)1 / (typename ScalarType<TYPE>::type)count) : MATRIX3<TYPE>((TYPE)0); }
+
+
+// 4D sum of one block, point i going to accumulator i % 4
+template <typename TYPE> VECTOR4<TYPE> BlockSum(const VECTOR4<TYPE>* points, const unsigned& count)
+{
+	TYPE sumX[4], sumY[4], sumZ[4], sumW[4];
+	TYPE sumXCompensation[4], sumYCompensation[4], sumZCompensation[4], sumWCompensation[4];
+	for (unsigned lane = 0; lane < 4; lane++)
+	{
+		sumX[lane] = sumXCompensation[lane] = sumY[lane] = sumYCompensation[lane] = sumZ[lane] = sumZCompensation[lane] = sumW[lane] = sumWCompensation[lane] = (TYPE)0;
+	}
+	unsigned i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		for (unsigned lane = 0; lane < 4; lane++)
+		{
+			ReductionAdd<TYPE>(sumX[lane], sumXCompensation[lane], points[i + lane].x);
+			ReductionAdd<TYPE>(sumY[lane], sumYCompensation[lane], points[i + lane].y);
+			ReductionAdd<TYPE>(sumZ[lane], sumZCompensation[lane], points[i + lane].z);
+			ReductionAdd<TYPE>(sumW[lane], sumWCompensation[lane], points[i + lane].w);
+		}
+	}
+	for (; i < count; i++)
+	{
+		ReductionAdd<TYPE>(sumX[i % 4], sumXCompensation[i % 4], points[i].x);
+		ReductionAdd<TYPE>(sumY[i % 4], sumYCompensation[i % 4], points[i].y);
+		ReductionAdd<TYPE>(sumZ[i % 4], sumZCompensation[i % 4], points[i].z);
+		ReductionAdd<TYPE>(sumW[i % 4], sumWCompensation[i % 4], points[i].w);
+	}
+	return VECTOR4<TYPE>(ReductionFold(sumX, sumXCompensation), ReductionFold(sumY, sumYCompensation), ReductionFold(sumZ, sumZCompensation), ReductionFold(sumW, sumWCompensation));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> BlockSum(const VECTOR4<float>* points, const unsigned& count)
+{
+	// One point per register, all of its components at once
+	__m128 sum[4], compensation[4];
+	for (unsigned lane = 0; lane < 4; lane++)
+	{
+		sum[lane] = compensation[lane] = _mm_setzero_ps();
+	}
+	unsigned i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		for (unsigned lane = 0; lane < 4; lane++)
+		{
+			SimdReductionAdd(sum[lane], compensation[lane], points[i + lane].Simd());
+		}
+	}
+	for (; i < count; i++)
+	{
+		SimdReductionAdd(sum[i % 4], compensation[i % 4], points[i].Simd());
+	}
+	__m128 low = _mm_add_ps(_mm_sub_ps(sum[0], compensation[0]), _mm_sub_ps(sum[1], compensation[1]));
+	__m128 high = _mm_add_ps(_mm_sub_ps(sum[2], compensation[2]), _mm_sub_ps(sum[3], compensation[3]));
+	return VECTOR4<float>(_mm_add_ps(low, high));
+}
+
+#endif // SVML_USE_SSE
+// 4D Sum() and Centroid() of an array (0 when count is 0): blocks of REDUCTION_BLOCK points combined pairwise
+template <typename TYPE> VECTOR4<TYPE> Sum(const VECTOR4<TYPE>* points, const unsigned& count)
+{
+	unsigned blocks = count / REDUCTION_BLOCK + ((count % REDUCTION_BLOCK) ? 1 : 0);
+	if (blocks <= 1) { return BlockSum(points, count); }
+	unsigned half = blocks / 2 * REDUCTION_BLOCK;
+	return Sum(points, half) + Sum(points + half, count - half);
+}
+template <typename TYPE> VECTOR4<TYPE> Centroid(const VECTOR4<TYPE>* points, const unsigned& count) { return (count > 0) ? Sum(points, count) / (typename ScalarType<TYPE>::type)count : VECTOR4<TYPE>((TYPE)0, (TYPE)0, (TYPE)0, (TYPE)0); }
+
+
+//----------------------------------------------------------------------
+// 
+// Sec. 13 - Conversions to and from half-precision storage
+// 
+//----------------------------------------------------------------------
+
+// ConvertComponents(): count floats to or from half-precision storage. With SVML_USE_SSE, F16C converts 8 halves per
+// instruction and AVX-512 16, and SSE2 converts bfloat16s 8 at a time
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+// Rounds four floats to bfloat16 like FloatToBfloat16Bits(), sign-extended in each lane so _mm_packs_epi32() keeps all 16 bits
+inline __m128i SimdFloatToBfloat16(const __m128& value)
+{
+	__m128i bits = _mm_castps_si128(value);
+	__m128i kept = _mm_srli_epi32(bits, 16);
+	__m128i rounded = _mm_srli_epi32(_mm_add_epi32(bits, _mm_add_epi32(_mm_and_si128(kept, _mm_set1_epi32(1)), _mm_set1_epi32(0x7FFF))), 16);
+	__m128i nan = _mm_cmpgt_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+	__m128i result = _mm_or_si128(_mm_and_si128(nan, _mm_or_si128(kept, _mm_set1_epi32(0x40))), _mm_andnot_si128(nan, rounded));
+	return _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+}
+#endif
+
+inline void ConvertComponents(HALF* out, const float* in, const size_t& count)
+{
+	size_t i = 0;
+#if defined(SVML_USE_SSE) && defined(__AVX512F__)
+	// The zero-masked forms, as the unmasked ones trip GCC's uninitialized warnings
+	for (; i + 16 <= count; i += 16)
+	{
+		_mm256_storeu_si256((__m256i*)(out + i), _mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+	}
+#endif
+#if defined(SVML_USE_SSE) && defined(__F16C__)
+	for (; i + 8 <= count; i += 8)
+	{
+		_mm_storeu_si128((__m128i*)(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		out[i] = HALF(in[i]);
+	}
+}
+
+inline void ConvertComponents(float* out, const HALF* in, const size_t& count)
+{
+	size_t i = 0;
+#if defined(SVML_USE_SSE) && defined(__AVX512F__)
+	for (; i + 16 <= count; i += 16)
+	{
+		_mm512_storeu_ps(out + i, _mm512_maskz_cvtph_ps(0xFFFF, _mm256_loadu_si256((const __m256i*)(in + i))));
+	}
+#endif
+#if defined(SVML_USE_SSE) && defined(__F16C__)
+	for (; i + 8 <= count; i += 8)
+	{
+		_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(in + i))));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		out[i] = in[i];
+	}
+}
+
+inline void ConvertComponents(BFLOAT16* out, const float* in, const size_t& count)
+{
+	size_t i = 0;
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+	for (; i + 8 <= count; i += 8)
+	{
+		_mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(SimdFloatToBfloat16(_mm_loadu_ps(in + i)), SimdFloatToBfloat16(_mm_loadu_ps(in + i + 4))));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		out[i] = BFLOAT16(in[i]);
+	}
+}
+
+inline void ConvertComponents(float* out, const BFLOAT16* in, const size_t& count)
+{
+	size_t i = 0;
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+	for (; i + 8 <= count; i += 8)
+	{
+		__m128i packed = _mm_loadu_si128((const __m128i*)(in + i));
+		_mm_storeu_ps(out + i, _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), packed)));
+		_mm_storeu_ps(out + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), packed)));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		out[i] = in[i];
+	}
+}
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// 2D Convert(): count vectors from one component type to another, such as to and from half-precision storage
+template <typename TYPE, typename OTHER> void Convert(VECTOR2<TYPE>* out, const VECTOR2<OTHER>* in, const unsigned& count)
+{
+	for (unsigned i = 0; i < count; i++)
+	{
+		out[i] = VECTOR2<TYPE>(in[i]);
+	}
+}
+inline void Convert(VECTOR2<HALF>* out, const VECTOR2<float>* in, const unsigned& count) { ConvertComponents((HALF*)out, (const float*)in, (size_t)count * 2); }
+inline void Convert(VECTOR2<float>* out, const VECTOR2<HALF>* in, const unsigned& count) { ConvertComponents((float*)out, (const HALF*)in, (size_t)count * 2); }
+inline void Convert(VECTOR2<BFLOAT16>* out, const VECTOR2<float>* in, const unsigned& count) { ConvertComponents((BFLOAT16*)out, (const float*)in, (size_t)count * 2); }
+inline void Convert(VECTOR2<float>* out, const VECTOR2<BFLOAT16>* in, const unsigned& count) { ConvertComponents((float*)out, (const BFLOAT16*)in, (size_t)count * 2); }
+
+// 3D Convert(): count vectors from one component type to another, such as to and from half-precision storage
+template <typename TYPE, typename OTHER> void Convert(VECTOR3<TYPE>* out, const VECTOR3<OTHER>* in, const unsigned& count)
+{
+	for (unsigned i = 0; i < count; i++)
+	{
+		out[i] = VECTOR3<TYPE>(in[i]);
+	}
+}
+inline void Convert(VECTOR3<HALF>* out, const VECTOR3<float>* in, const unsigned& count)
+{
+#if !defined(SVML_USE_SSE)
+	ConvertComponents((HALF*)out, (const float*)in, (size_t)count * 3);
+#elif defined(__F16C__)
+	// Each store also writes the next vector's x, which the next store replaces
+	for (unsigned i = 0; i + 1 < count; i++)
+	{
+		_mm_storel_epi64((__m128i*)(out + i), _mm_cvtps_ph(in[i].Simd(), _MM_FROUND_TO_NEAREST_INT));
+	}
+	if (count > 0)
+	{
+		HALF last[4];
+		_mm_storel_epi64((__m128i*)last, _mm_cvtps_ph(in[count - 1].Simd(), _MM_FROUND_TO_NEAREST_INT));
+		memcpy(out + count - 1, last, sizeof(VECTOR3<HALF>));
+	}
+#else
+	Convert<HALF, float>(out, in, count);
+#endif
+}
+inline void Convert(VECTOR3<float>* out, const VECTOR3<HALF>* in, const unsigned& count)
+{
+#if !defined(SVML_USE_SSE)
+	ConvertComponents((float*)out, (const HALF*)in, (size_t)count * 3);
+#elif defined(__F16C__)
+	// Each load also reads the next vector's x, which the mask clears (w is 0, as the constructors leave it)
+	__m128 xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+	for (unsigned i = 0; i + 1 < count; i++)
+	{
+		out[i] = VECTOR3<float>(_mm_and_ps(_mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)(in + i))), xyz));
+	}
+	if (count > 0)
+	{
+		HALF last[4];
+		memcpy(last, in + count - 1, sizeof(VECTOR3<HALF>));
+		last[3] = HALF::FromBits(0);
+		out[count - 1] = VECTOR3<float>(_mm_and_ps(_mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)last)), xyz));
+	}
+#else
+	Convert<float, HALF>(out, in, count);
+#endif
+}
+inline void Convert(VECTOR3<BFLOAT16>* out, const VECTOR3<float>* in, const unsigned& count)
+{
+#if !defined(SVML_USE_SSE)
+	ConvertComponents((BFLOAT16*)out, (const float*)in, (size_t)count * 3);
+#elif defined(__SSE2__)
+	// Each store also writes the next vector's x, which the next store replaces
+	for (unsigned i = 0; i + 1 < count; i++)
+	{
+		_mm_storel_epi64((__m128i*)(out + i), _mm_packs_epi32(SimdFloatToBfloat16(in[i].Simd()), _mm_setzero_si128()));
+	}
+	if (count > 0)
+	{
+		BFLOAT16 last[4];
+		_mm_storel_epi64((__m128i*)last, _mm_packs_epi32(SimdFloatToBfloat16(in[count - 1].Simd()), _mm_setzero_si128()));
+		memcpy(out + count - 1, last, sizeof(VECTOR3<BFLOAT16>));
+	}
+#else
+	Convert<BFLOAT16, float>(out, in, count);
+#endif
+}
+inline void Convert(VECTOR3<float>* out, const VECTOR3<BFLOAT16>* in, const unsigned& count)
+{
+#if !defined(SVML_USE_SSE)
+	ConvertComponents((float*)out, (const BFLOAT16*)in, (size_t)count * 3);
+#elif defined(__SSE2__)
+	// Each load also reads the next vector's x, which the mask clears (w is 0, as the constructors leave it)
+	__m128 xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+	for (unsigned i = 0; i + 1 < count; i++)
+	{
+		out[i] = VECTOR3<float>(_mm_and_ps(_mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i*)(in + i)))), xyz));
+	}
+	if (count > 0)
+	{
+		BFLOAT16 last[4];
+		memcpy(last, in + count - 1, sizeof(VECTOR3<BFLOAT16>));
+		last[3] = BFLOAT16::FromBits(0);
+		out[count - 1] = VECTOR3<float>(_mm_and_ps(_mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i*)last))), xyz));
+	}
+#else
+	Convert<float, BFLOAT16>(out, in, count);
+#endif
+}
+
+// 4D Convert(): count vectors from one component type to another, such as to and from half-precision storage
+template <typename TYPE, typename OTHER> void Convert(VECTOR4<TYPE>* out, const VECTOR4<OTHER>* in, const unsigned& count)
+{
+	for (unsigned i = 0; i < count; i++)
+	{
+		out[i] = VECTOR4<TYPE>(in[i]);
+	}
+}
+inline void Convert(VECTOR4<HALF>* out, const VECTOR4<float>* in, const unsigned& count) { ConvertComponents((HALF*)out, (const float*)in, (size_t)count * 4); }
+inline void Convert(VECTOR4<float>* out, const VECTOR4<HALF>* in, const unsigned& count) { ConvertComponents((float*)out, (const HALF*)in, (size_t)count * 4); }
+inline void Convert(VECTOR4<BFLOAT16>* out, const VECTOR4<float>* in, const unsigned& count) { ConvertComponents((BFLOAT16*)out, (const float*)in, (size_t)count * 4); }
+inline void Convert(VECTOR4<float>* out, const VECTOR4<BFLOAT16>* in, const unsigned& count) { ConvertComponents((float*)out, (const BFLOAT16*)in, (size_t)count * 4); }
+
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+//----------------------------------------------------------------------
+// 
+// Sec. 14 - Lane-packed vectors
+// 
+//----------------------------------------------------------------------
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// 2D Pack(), Unpack(): N vectors to and from one vector of WIDE<TYPE, N>, vector i in lane i
+template <typename TYPE, int N> VECTOR2< WIDE<TYPE, N> > Pack(const VECTOR2<TYPE>* in)
+{
+	WIDE<TYPE, N> components[2];
+	for (int i = 0; i < N; i++)
+	{
+		components[0].lane[i] = in[i].Component(0);
+		components[1].lane[i] = in[i].Component(1);
+	}
+	return VECTOR2< WIDE<TYPE, N> >(components[0], components[1]);
+}
+
+template <typename TYPE, int N> void Unpack(VECTOR2<TYPE>* out, const VECTOR2< WIDE<TYPE, N> >& in)
+{
+	WIDE<TYPE, N> component0 = in.Component(0);
+	WIDE<TYPE, N> component1 = in.Component(1);
+	for (int i = 0; i < N; i++)
+	{
+		out[i] = VECTOR2<TYPE>(component0.lane[i], component1.lane[i]);
+	}
+}
+
+// 3D Pack(), Unpack(): N vectors to and from one vector of WIDE<TYPE, N>, vector i in lane i
+template <typename TYPE, int N> VECTOR3< WIDE<TYPE, N> > Pack(const VECTOR3<TYPE>* in)
+{
+	WIDE<TYPE, N> components[3];
+	for (int i = 0; i < N; i++)
+	{
+		components[0].lane[i] = in[i].Component(0);
+		components[1].lane[i] = in[i].Component(1);
+		components[2].lane[i] = in[i].Component(2);
+	}
+	return VECTOR3< WIDE<TYPE, N> >(components[0], components[1], components[2]);
+}
+
+template <typename TYPE, int N> void Unpack(VECTOR3<TYPE>* out, const VECTOR3< WIDE<TYPE, N> >& in)
+{
+	WIDE<TYPE, N> component0 = in.Component(0);
+	WIDE<TYPE, N> component1 = in.Component(1);
+	WIDE<TYPE, N> component2 = in.Component(2);
+	for (int i = 0; i < N; i++)
+	{
+		out[i] = VECTOR3<TYPE>(component0.lane[i], component1.lane[i], component2.lane[i]);
+	}
+}
+
+// 4D Pack(), Unpack(): N vectors to and from one vector of WIDE<TYPE, N>, vector i in lane i
+template <typename TYPE, int N> VECTOR4< WIDE<TYPE, N> > Pack(const VECTOR4<TYPE>* in)
+{
+	WIDE<TYPE, N> components[4];
+	for (int i = 0; i < N; i++)
+	{
+		components[0].lane[i] = in[i].Component(0);
+		components[1].lane[i] = in[i].Component(1);
+		components[2].lane[i] = in[i].Component(2);
+		components[3].lane[i] = in[i].Component(3);
+	}
+	return VECTOR4< WIDE<TYPE, N> >(components[0], components[1], components[2], components[3]);
+}
+
+template <typename TYPE, int N> void Unpack(VECTOR4<TYPE>* out, const VECTOR4< WIDE<TYPE, N> >& in)
+{
+	WIDE<TYPE, N> component0 = in.Component(0);
+	WIDE<TYPE, N> component1 = in.Component(1);
+	WIDE<TYPE, N> component2 = in.Component(2);
+	WIDE<TYPE, N> component3 = in.Component(3);
+	for (int i = 0; i < N; i++)
+	{
+		out[i] = VECTOR4<TYPE>(component0.lane[i], component1.lane[i], component2.lane[i], component3.lane[i]);
+	}
+}
+
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+//----------------------------------------------------------------------
+// 
+// Sec. 15 - Parallel bulk operations on spans of vectors
+// 
+//----------------------------------------------------------------------
+
+#ifdef SVML_USE_THREADS
+namespace Bulk
+{
+
+// Contiguous elements (like C++20 std::span). SPAN<TYPE> converts to SPAN<const TYPE>, its base, so functions that
+// only read take either
+template <typename TYPE> struct SPAN;
+
+template <typename TYPE>
+struct SPAN<const TYPE>
+{
+	const TYPE* data;
+	size_t count;
+
+	// Constructors
+	SPAN() : data(0), count(0) {}
+	SPAN(const TYPE* data, const size_t& count) : data(data), count(count) {}
+	template <size_t SIZE> SPAN(const TYPE (&array)[SIZE]) : data(array), count(SIZE) {}
+
+	const TYPE& operator[](const size_t& index) const { return data[index]; }
+};
+
+template <typename TYPE>
+struct SPAN : SPAN<const TYPE>
+{
+	// Constructors
+	SPAN() {}
+	SPAN(TYPE* data, const size_t& count) : SPAN<const TYPE>(data, count) {}
+	template <size_t SIZE> SPAN(TYPE (&array)[SIZE]) : SPAN<const TYPE>(array, SIZE) {}
+
+	TYPE* Data() const { return const_cast<TYPE*>(this->data); }
+	TYPE& operator[](const size_t& index) const { return Data()[index]; }
+};
+
+// Elements per chunk unless told otherwise: enough work to hide the scheduling, and small enough to balance
+const size_t DEFAULT_GRAIN = 4096;
+
+// Elements per chunk actually used (chunk indices are 32 bits, so huge counts get bigger chunks)
+inline size_t ChunkSize(const size_t& count, const size_t& grain) { return std::max(std::max(grain, (size_t)1), count / 0xFFFFFFFFu + 1); }
+
+// Work-stealing thread pool. A job is split into chunks of at most grain elements, and every worker (the calling
+// thread is one of them) starts with its own contiguous run of chunks, taking them from the front. A worker that
+// runs out steals from the back of the others' runs. Contiguous runs keep each thread on its own part of the
+// arrays, and on the memory it touched first, which on NUMA systems is the memory of its own node
+class WORK_POOL
+{
+public:
+	// Constructors (0 threads is one per hardware thread)
+	explicit WORK_POOL(const unsigned& threadCount = 0) : workerCount((threadCount > 0) ? threadCount : std::max(1u, std::thread::hardware_concurrency())), runs(new RUN[workerCount]), generation(0), busy(0), stopping(false), invoke(0), body(0), count(0), grain(1)
+	{
+		for (unsigned i = 1; i < workerCount; i++)
+		{
+			threads.push_back(std::thread(&WORK_POOL::Work, this, i));
+		}
+	}
+
+	~WORK_POOL()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (size_t i = 0; i < threads.size(); i++)
+		{
+			threads[i].join();
+		}
+		delete[] runs;
+	}
+
+	unsigned Threads() const { return workerCount; }
+
+	// Calls body(begin, end) for the chunks [0, grain), [grain, 2 * grain), ... of [0, count) and returns when all
+	// are done. The chunks are the same for any number of threads. A job started while another is running (from
+	// another thread, or from inside a body) runs on the calling thread alone. Bodies must not throw
+	template <typename BODY> void Run(const size_t& count, const size_t& grain, const BODY& body)
+	{
+		size_t chunk = ChunkSize(count, grain);
+		size_t chunks = (count + chunk - 1) / chunk;
+		std::unique_lock<std::mutex> running(runMutex, std::try_to_lock);
+		if (chunks <= 1 || workerCount == 1 || !running.owns_lock())
+		{
+			for (size_t begin = 0; begin < count; begin += chunk)
+			{
+				body(begin, std::min(begin + chunk, count));
+			}
+			return;
+		}
+
+		for (unsigned i = 0; i < workerCount; i++)
+		{
+			runs[i].chunks.store(Pack(chunks * i / workerCount, chunks * (i + 1) / workerCount));
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			this->invoke = &Invoke<BODY>;
+			this->body = &body;
+			this->count = count;
+			this->grain = chunk;
+			busy = workerCount - 1;
+			generation++;
+		}
+		wake.notify_all();
+		Process(0);
+		std::unique_lock<std::mutex> lock(mutex);
+		done.wait(lock, [this] { return busy == 0; });
+	}
+
+private:
+	WORK_POOL(const WORK_POOL&);
+	const WORK_POOL& operator=(const WORK_POOL&);
+
+	// The chunks [begin, end) a worker has left, packed in one word so taking and stealing are single exchanges
+	struct RUN
+	{
+		std::atomic<unsigned long long> chunks;
+		char padding[64 - sizeof(std::atomic<unsigned long long>)]; // One cache line each
+		RUN() : chunks(0) {}
+	};
+
+	static unsigned long long Pack(const size_t& begin, const size_t& end) { return ((unsigned long long)begin << 32) | end; }
+
+	template <typename BODY> static void Invoke(const void* body, const size_t& begin, const size_t& end) { (*(const BODY*)body)(begin, end); }
+
+	// Takes the first chunk of a run (fromBack false) or the last one
+	bool Take(RUN& run, const bool& fromBack, size_t& chunk)
+	{
+		unsigned long long packed = run.chunks.load();
+		for (;;)
+		{
+			size_t begin = (size_t)(packed >> 32);
+			size_t end = (size_t)(packed & 0xFFFFFFFFu);
+			if (begin >= end)
+			{
+				return false;
+			}
+			chunk = fromBack ? end - 1 : begin;
+			if (run.chunks.compare_exchange_weak(packed, fromBack ? Pack(begin, end - 1) : Pack(begin + 1, end)))
+			{
+				return true;
+			}
+		}
+	}
+
+	void Process(const unsigned& worker)
+	{
+		size_t chunk;
+		for (unsigned i = 0; i < workerCount; i++)
+		{
+			RUN& run = runs[(worker + i) % workerCount];
+			while (Take(run, i > 0, chunk))
+			{
+				size_t begin = chunk * grain;
+				invoke(body, begin, std::min(begin + grain, count));
+			}
+		}
+	}
+
+	void Work(const unsigned worker)
+	{
+		unsigned long long seen = 0;
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+				if (stopping)
+				{
+					return;
+				}
+				seen = generation;
+			}
+			Process(worker);
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--busy == 0)
+			{
+				done.notify_one();
+			}
+		}
+	}
+
+	unsigned workerCount;
+	RUN* runs;
+	std::vector<std::thread> threads;
+	std::mutex runMutex; // Held while a job runs
+	std::mutex mutex; // Guards everything below
+	std::condition_variable wake;
+	std::condition_variable done;
+	unsigned long long generation; // Counts jobs, so workers see each one once
+	unsigned busy; // Workers still on the current job
+	bool stopping;
+	void (*invoke)(const void* body, const size_t& begin, const size_t& end);
+	const void* body;
+	size_t count;
+	size_t grain; // Chunk size of the current job
+};
+
+// Shared by every call that does not name a pool, started on first use with one thread per hardware thread
+inline WORK_POOL& DefaultPool()
+{
+	static WORK_POOL pool;
+	return pool;
+}
+
+// The loop every bulk function runs on: body(begin, end) for each chunk of [0, count)
+template <typename BODY> void ParallelFor(const size_t& count, const BODY& body, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	pool.Run(count, grain, body);
+}
+
+// ForEach(): function(element) for every element, which it may modify
+template <typename TYPE, typename FUNCTION> void ForEach(const SPAN<TYPE>& elements, const FUNCTION& function, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	ParallelFor(elements.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { function(elements[i]); } }, grain, pool);
+}
+
+// Transform(): out[i] = function(in[i]), out may be in
+template <typename OUT, typename IN, typename FUNCTION> void Transform(const SPAN<OUT>& out, const SPAN<const IN>& in, const FUNCTION& function, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	ParallelFor(in.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = function(in[i]); } }, grain, pool);
+}
+
+// ReduceChunks(): reduceChunk(begin, end) for every chunk, with the chunk results combined in order by
+// combine(result, result). The chunks depend only on count and grain, so the result is the same for any number of threads
+template <typename RESULT, typename REDUCE_CHUNK, typename COMBINE> RESULT ReduceChunks(const size_t& count, const RESULT& identity, const REDUCE_CHUNK& reduceChunk, const COMBINE& combine, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	size_t chunk = ChunkSize(count, grain);
+	std::vector<RESULT> partials((count + chunk - 1) / chunk, identity);
+	ParallelFor(count, [&](size_t begin, size_t end) { partials[begin / chunk] = reduceChunk(begin, end); }, grain, pool);
+	RESULT result = identity;
+	for (size_t i = 0; i < partials.size(); i++)
+	{
+		result = combine(result, partials[i]);
+	}
+	return result;
+}
+
+// Reduce(): each chunk folds its elements in order, from identity, with fold(result, element)
+template <typename RESULT, typename IN, typename FOLD, typename COMBINE> RESULT Reduce(const SPAN<const IN>& in, const RESULT& identity, const FOLD& fold, const COMBINE& combine, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	return ReduceChunks(in.count, identity, [&](size_t begin, size_t end)
+	{
+		RESULT result = identity;
+		for (size_t i = begin; i < end; i++)
+		{
+			result = fold(result, in[i]);
+		}
+		return result;
+	}, combine, grain, pool);
+}
+
+// ReduceBlocks(): reduceBlock(begin, end) for blocks of REDUCTION_BLOCK elements, combined pairwise with + in the order
+// of the serial Sum() and Scatter(), so the result depends only on count (neither on grain nor on the number of threads)
+template <typename RESULT> RESULT CombinePairwise(const std::vector<RESULT>& partials, const size_t& first, const size_t& last)
+{
+	if (last - first == 1) { return partials[first]; }
+	size_t middle = first + (last - first) / 2;
+	return CombinePairwise(partials, first, middle) + CombinePairwise(partials, middle, last);
+}
+template <typename RESULT, typename REDUCE_BLOCK> RESULT ReduceBlocks(const size_t& count, const REDUCE_BLOCK& reduceBlock, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	size_t blocks = (count + REDUCTION_BLOCK - 1) / REDUCTION_BLOCK;
+	if (blocks <= 1) { return reduceBlock(0, count); }
+	std::vector<RESULT> partials(blocks);
+	ParallelFor(blocks, [&](size_t first, size_t last) { for (size_t block = first; block < last; block++) { partials[block] = reduceBlock(block * REDUCTION_BLOCK, std::min(count, (block + 1) * REDUCTION_BLOCK)); } },
+	            std::max<size_t>(grain / REDUCTION_BLOCK, 1), pool);
+	return CombinePairwise(partials, 0, blocks);
+}
+
+// 2D bulk component-wise functions
+template <typename TYPE> void Negate(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = -a[i]; } }, grain, pool); }
+template <typename TYPE> void Add(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] + b[i]; } }, grain, pool); }
+template <typename TYPE> void Subtract(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] - b[i]; } }, grain, pool); }
+template <typename TYPE> void Multiply(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] * b[i]; } }, grain, pool); }
+template <typename TYPE> void Divide(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] / b[i]; } }, grain, pool); }
+template <typename TYPE> void Multiply(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const typename ScalarType<TYPE>::type& scalar, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] * scalar; } }, grain, pool); }
+template <typename TYPE> void Divide(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const typename ScalarType<TYPE>::type& scalar, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] / scalar; } }, grain, pool); }
+template <typename TYPE> void Max(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Max(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Min(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Min(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Ceil(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Ceil(a[i]); } }, grain, pool); }
+template <typename TYPE> void Floor(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Floor(a[i]); } }, grain, pool); }
+template <typename TYPE> void Lerp(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const typename RealType<TYPE>::type& delta, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Lerp(a[i], b[i], delta); } }, grain, pool); }
+
+// 2D bulk geometric functions
+template <typename TYPE> void Normalize(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Normalize(a[i]); } }, grain, pool); }
+template <typename TYPE> void Dot(const SPAN<TYPE>& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Dot(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Project(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Project(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Distance(const SPAN<TYPE>& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Distance(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void DistanceSquared(const SPAN<TYPE>& out, const SPAN< const VECTOR2<TYPE> >& a, const SPAN< const VECTOR2<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = DistanceSquared(a[i], b[i]); } }, grain, pool); }
+
+// 2D bulk Rotate() and Transform()
+template <typename TYPE> void Rotate(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const ROTATION2< typename RealType<TYPE>::type >& rotation, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { Rotate(out.Data() + begin, a.data + begin, rotation, (unsigned)(end - begin)); }, grain, pool); }
+template <typename TYPE> void Rotate(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const typename RealType<TYPE>::type& angle, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { Rotate(out, a, ROTATION2< typename RealType<TYPE>::type >(angle), grain, pool); }
+template <typename TYPE> void Rotate(const SPAN< VECTOR2<TYPE> >& out, const SPAN< const VECTOR2<TYPE> >& a, const typename RealType<TYPE>::type* angles, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { Rotate(out.Data() + begin, a.data + begin, angles + begin, (unsigned)(end - begin)); }, grain, pool); }
+template <typename TYPE> void Transform(const SPAN< VECTOR2<TYPE> >& out, const MATRIX2<TYPE>& matrix, const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { Transform(out.Data() + begin, matrix, a.data + begin, (unsigned)(end - begin)); }, grain, pool); }
+
+// 2D bulk reductions: Sum(), Centroid() and Covariance() return the same bits as the serial ones, Fit() is exact
+template <typename TYPE> VECTOR2<TYPE> Sum(const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { return ReduceBlocks<VECTOR2<TYPE>>(a.count, [&](size_t begin, size_t end) { return BlockSum(a.data + begin, (unsigned)(end - begin)); }, grain, pool); }
+template <typename TYPE> VECTOR2<TYPE> Centroid(const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { return (a.count > 0) ? Sum(a, grain, pool) / (typename ScalarType<TYPE>::type)a.count : VECTOR2<TYPE>((TYPE)0, (TYPE)0); }
+template <typename TYPE> MATRIX2<TYPE> Covariance(const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	if (a.count == 0) { return MATRIX2<TYPE>((TYPE)0); }
+	VECTOR2<TYPE> center = Centroid(a, grain, pool);
+	return ReduceBlocks<MATRIX2<TYPE>>(a.count, [&](size_t begin, size_t end) { return BlockScatter(a.data + begin, (unsigned)(end - begin), center); }, grain, pool) * ((typename ScalarType<TYPE>::type)1 / (typename ScalarType<TYPE>::type)a.count);
+}
+template <typename TYPE> AABB2<TYPE> Fit(const SPAN< const VECTOR2<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	return ReduceChunks(a.count, AABB2<TYPE>::Empty(), [&](size_t begin, size_t end) { return Fit(a.data + begin, (unsigned)(end - begin)); },
+	                    [](const AABB2<TYPE>& lhs, const AABB2<TYPE>& rhs) { return Union(lhs, rhs); }, grain, pool);
+}
+
+// 3D bulk component-wise functions
+template <typename TYPE> void Negate(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = -a[i]; } }, grain, pool); }
+template <typename TYPE> void Add(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] + b[i]; } }, grain, pool); }
+template <typename TYPE> void Subtract(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] - b[i]; } }, grain, pool); }
+template <typename TYPE> void Multiply(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] * b[i]; } }, grain, pool); }
+template <typename TYPE> void Divide(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] / b[i]; } }, grain, pool); }
+template <typename TYPE> void Multiply(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const typename ScalarType<TYPE>::type& scalar, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] * scalar; } }, grain, pool); }
+template <typename TYPE> void Divide(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const typename ScalarType<TYPE>::type& scalar, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] / scalar; } }, grain, pool); }
+template <typename TYPE> void Max(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Max(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Min(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Min(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Ceil(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Ceil(a[i]); } }, grain, pool); }
+template <typename TYPE> void Floor(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Floor(a[i]); } }, grain, pool); }
+template <typename TYPE> void Lerp(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const typename RealType<TYPE>::type& delta, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Lerp(a[i], b[i], delta); } }, grain, pool); }
+
+// 3D bulk geometric functions
+template <typename TYPE> void Normalize(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Normalize(a[i]); } }, grain, pool); }
+template <typename TYPE> void Dot(const SPAN<TYPE>& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Dot(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Cross(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Cross(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Project(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Project(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Distance(const SPAN<TYPE>& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Distance(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void DistanceSquared(const SPAN<TYPE>& out, const SPAN< const VECTOR3<TYPE> >& a, const SPAN< const VECTOR3<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = DistanceSquared(a[i], b[i]); } }, grain, pool); }
+
+// 3D bulk Rotate() and Transform()
+template <typename TYPE> void Rotate(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const QUATERNION<TYPE>& rotation, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { Rotate(out.Data() + begin, a.data + begin, rotation, (unsigned)(end - begin)); }, grain, pool); }
+template <typename TYPE> void Rotate(const SPAN< VECTOR3<TYPE> >& out, const SPAN< const VECTOR3<TYPE> >& a, const VECTOR3<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { Rotate(out, a, QUATERNION<TYPE>(rotationAxis, radians), grain, pool); }
+template <typename TYPE> void Transform(const SPAN< VECTOR3<TYPE> >& out, const MATRIX3<TYPE>& matrix, const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { Transform(out.Data() + begin, matrix, a.data + begin, (unsigned)(end - begin)); }, grain, pool); }
+
+// 3D bulk reductions: Sum(), Centroid() and Covariance() return the same bits as the serial ones, Fit() is exact
+template <typename TYPE> VECTOR3<TYPE> Sum(const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { return ReduceBlocks<VECTOR3<TYPE>>(a.count, [&](size_t begin, size_t end) { return BlockSum(a.data + begin, (unsigned)(end - begin)); }, grain, pool); }
+template <typename TYPE> VECTOR3<TYPE> Centroid(const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { return (a.count > 0) ? Sum(a, grain, pool) / (typename ScalarType<TYPE>::type)a.count : VECTOR3<TYPE>((TYPE)0, (TYPE)0, (TYPE)0); }
+template <typename TYPE> MATRIX3<TYPE> Covariance(const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	if (a.count == 0) { return MATRIX3<TYPE>((TYPE)0); }
+	VECTOR3<TYPE> center = Centroid(a, grain, pool);
+	return ReduceBlocks<MATRIX3<TYPE>>(a.count, [&](size_t begin, size_t end) { return BlockScatter(a.data + begin, (unsigned)(end - begin), center); }, grain, pool) * ((typename ScalarType<TYPE>::type)1 / (typename ScalarType<TYPE>::type)a.count);
+}
+template <typename TYPE> AABB3<TYPE> Fit(const SPAN< const VECTOR3<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	return ReduceChunks(a.count, AABB3<TYPE>::Empty(), [&](size_t begin, size_t end) { return Fit(a.data + begin, (unsigned)(end - begin)); },
+	                    [](const AABB3<TYPE>& lhs, const AABB3<TYPE>& rhs) { return Union(lhs, rhs); }, grain, pool);
+}
+
+// 4D bulk component-wise functions
+template <typename TYPE> void Negate(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = -a[i]; } }, grain, pool); }
+template <typename TYPE> void Add(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] + b[i]; } }, grain, pool); }
+template <typename TYPE> void Subtract(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] - b[i]; } }, grain, pool); }
+template <typename TYPE> void Multiply(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] * b[i]; } }, grain, pool); }
+template <typename TYPE> void Divide(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] / b[i]; } }, grain, pool); }
+template <typename TYPE> void Multiply(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const typename ScalarType<TYPE>::type& scalar, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] * scalar; } }, grain, pool); }
+template <typename TYPE> void Divide(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const typename ScalarType<TYPE>::type& scalar, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = a[i] / scalar; } }, grain, pool); }
+template <typename TYPE> void Max(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Max(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Min(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Min(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Ceil(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Ceil(a[i]); } }, grain, pool); }
+template <typename TYPE> void Floor(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Floor(a[i]); } }, grain, pool); }
+template <typename TYPE> void Lerp(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const typename RealType<TYPE>::type& delta, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Lerp(a[i], b[i], delta); } }, grain, pool); }
+
+// 4D bulk geometric functions
+template <typename TYPE> void Normalize(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Normalize(a[i]); } }, grain, pool); }
+template <typename TYPE> void Dot(const SPAN<TYPE>& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Dot(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Cross(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Cross(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Project(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Project(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void Distance(const SPAN<TYPE>& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = Distance(a[i], b[i]); } }, grain, pool); }
+template <typename TYPE> void DistanceSquared(const SPAN<TYPE>& out, const SPAN< const VECTOR4<TYPE> >& a, const SPAN< const VECTOR4<TYPE> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { out[i] = DistanceSquared(a[i], b[i]); } }, grain, pool); }
+
+// 4D bulk Rotate() and Transform()
+template <typename TYPE> void Rotate(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const QUATERNION<TYPE>& rotation, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { Rotate(out.Data() + begin, a.data + begin, rotation, (unsigned)(end - begin)); }, grain, pool); }
+template <typename TYPE> void Rotate(const SPAN< VECTOR4<TYPE> >& out, const SPAN< const VECTOR4<TYPE> >& a, const VECTOR4<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { Rotate(out, a, QUATERNION<TYPE>(rotationAxis.xyz, radians), grain, pool); }
+template <typename TYPE> void Transform(const SPAN< VECTOR4<TYPE> >& out, const MATRIX4<TYPE>& matrix, const SPAN< const VECTOR4<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { ParallelFor(a.count, [&](size_t begin, size_t end) { Transform(out.Data() + begin, matrix, a.data + begin, (unsigned)(end - begin)); }, grain, pool); }
+
+// 4D bulk reductions: Sum(), Centroid() and Covariance() return the same bits as the serial ones, Fit() is exact
+template <typename TYPE> VECTOR4<TYPE> Sum(const SPAN< const VECTOR4<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { return ReduceBlocks<VECTOR4<TYPE>>(a.count, [&](size_t begin, size_t end) { return BlockSum(a.data + begin, (unsigned)(end - begin)); }, grain, pool); }
+template <typename TYPE> VECTOR4<TYPE> Centroid(const SPAN< const VECTOR4<TYPE> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool()) { return (a.count > 0) ? Sum(a, grain, pool) / (typename ScalarType<TYPE>::type)a.count : VECTOR4<TYPE>((TYPE)0, (TYPE)0, (TYPE)0, (TYPE)0); }
+
+#ifdef SVML_HAS_DISPATCH
+// Instruction sets the float kernels are compiled for, in order
+enum ISA { ISA_SSE2, ISA_AVX2, ISA_AVX512 };
+
+// The best instruction set the processor and the operating system support
+inline ISA SupportedIsa()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	int info[4];
+	__cpuidex(info, 0, 0);
+	int leaves = info[0];
+	__cpuidex(info, 1, 0);
+	unsigned long long saved = ((info[2] & (1 << 27)) != 0) ? _xgetbv(0) : 0; // Register state the OS saves (OSXSAVE, XCR0)
+	if (leaves < 7 || (info[2] & (1 << 28)) == 0 || (saved & 0x6) != 0x6)
+	{
+		return ISA_SSE2;
+	}
+	__cpuidex(info, 7, 0);
+	if ((info[1] & (1 << 16)) != 0 && (saved & 0xE6) == 0xE6)
+	{
+		return ISA_AVX512;
+	}
+	return ((info[1] & (1 << 5)) != 0) ? ISA_AVX2 : ISA_SSE2;
+#else
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+	{
+		return ISA_AVX512;
+	}
+	return __builtin_cpu_supports("avx2") ? ISA_AVX2 : ISA_SSE2;
+#endif
+}
+
+// The supported instruction set, or a lower one named by the environment variable SVML_BULK_ISA (sse2, avx2 or avx512)
+inline ISA DefaultIsa()
+{
+	ISA isa = SupportedIsa();
+	const char* named = getenv("SVML_BULK_ISA");
+	if (named != 0 && strcmp(named, "sse2") == 0) { return ISA_SSE2; }
+	if (named != 0 && strcmp(named, "avx2") == 0) { return std::min(isa, ISA_AVX2); }
+	return isa;
+}
+
+// Chosen on first use
+inline std::atomic<int>& IsaSelection()
+{
+	static std::atomic<int> selection(DefaultIsa());
+	return selection;
+}
+
+// The instruction set the bulk functions run
+inline ISA ActiveIsa() { return (ISA)IsaSelection().load(std::memory_order_relaxed); }
+
+// Runs isa from now on, or the supported instruction set if isa is beyond it, and returns which
+inline ISA SelectIsa(const ISA& isa)
+{
+	ISA chosen = std::min(isa, SupportedIsa());
+	IsaSelection().store(chosen);
+	return chosen;
+}
+
+// The kernel of the active instruction set
+template <typename KERNEL> KERNEL Dispatch(const KERNEL& sse2, const KERNEL& avx2, const KERNEL& avx512)
+{
+	ISA isa = ActiveIsa();
+	return (isa == ISA_AVX512) ? avx512 : ((isa == ISA_AVX2) ? avx2 : sse2);
+}
+
+namespace SSE2
+{
+
+typedef __m128 REGISTER;
+const size_t WIDTH = 4; // Vectors per loop
+
+// Lane l of a register from (and to) the four floats at 4 * stride * l
+SVML_TARGET("sse2") inline __m128 LoadLanes(const float* source, const size_t&) { return _mm_loadu_ps(source); }
+SVML_TARGET("sse2") inline void StoreLanes(float* destination, const size_t&, const __m128& lanes) { _mm_storeu_ps(destination, lanes); }
+
+// (p[I], q[J], r[K], s[L]) in every lane
+template <int I, int J, int K, int L> SVML_TARGET("sse2") inline REGISTER Pick(const REGISTER& p, const REGISTER& q, const REGISTER& r, const REGISTER& s)
+{
+	return _mm_shuffle_ps(_mm_shuffle_ps(p, q, _MM_SHUFFLE(J, J, I, I)), _mm_shuffle_ps(r, s, _MM_SHUFFLE(L, L, K, K)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// WIDTH vectors of stride floats (2, 3, or 4 for VECTOR4 and padded VECTOR3) into one register per component
+SVML_TARGET("sse2") inline void Load(const float* source, const size_t& stride, REGISTER* components)
+{
+	REGISTER r0 = LoadLanes(source, stride), r1 = LoadLanes(source + 4, stride);
+	if (stride == 2)
+	{
+		components[0] = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(2, 0, 2, 0));
+		components[1] = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(3, 1, 3, 1));
+		return;
+	}
+	REGISTER r2 = LoadLanes(source + 8, stride);
+	if (stride == 3)
+	{
+		components[0] = Pick<0, 3, 2, 1>(r0, r0, r1, r2);
+		components[1] = Pick<1, 0, 3, 2>(r0, r1, r1, r2);
+		components[2] = Pick<2, 1, 0, 3>(r0, r1, r2, r2);
+		return;
+	}
+	REGISTER r3 = LoadLanes(source + 12, stride);
+	REGISTER xy01 = _mm_unpacklo_ps(r0, r1), xy23 = _mm_unpacklo_ps(r2, r3), zw01 = _mm_unpackhi_ps(r0, r1), zw23 = _mm_unpackhi_ps(r2, r3);
+	components[0] = _mm_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+	components[1] = _mm_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+	components[2] = _mm_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+	components[3] = _mm_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// The inverse of Load()
+SVML_TARGET("sse2") inline void Store(float* destination, const size_t& stride, const REGISTER* components)
+{
+	if (stride == 2)
+	{
+		StoreLanes(destination, stride, _mm_unpacklo_ps(components[0], components[1]));
+		StoreLanes(destination + 4, stride, _mm_unpackhi_ps(components[0], components[1]));
+	}
+	else if (stride == 3)
+	{
+		StoreLanes(destination, stride, Pick<0, 0, 0, 1>(components[0], components[1], components[2], components[0]));
+		StoreLanes(destination + 4, stride, Pick<1, 1, 2, 2>(components[1], components[2], components[0], components[1]));
+		StoreLanes(destination + 8, stride, Pick<2, 3, 3, 3>(components[2], components[0], components[1], components[2]));
+	}
+	else
+	{
+		REGISTER xy01 = _mm_unpacklo_ps(components[0], components[1]), xy23 = _mm_unpackhi_ps(components[0], components[1]);
+		REGISTER zw01 = _mm_unpacklo_ps(components[2], components[3]), zw23 = _mm_unpackhi_ps(components[2], components[3]);
+		StoreLanes(destination, stride, _mm_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0)));
+		StoreLanes(destination + 4, stride, _mm_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2)));
+		StoreLanes(destination + 8, stride, _mm_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0)));
+		StoreLanes(destination + 12, stride, _mm_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2)));
+	}
+}
+
+// 2D kernels
+SVML_TARGET("sse2") inline void Normalize(VECTOR2<float>* out, const VECTOR2<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(v[0], v[0]), _mm_mul_ps(v[1], v[1])));
+		v[0] = _mm_div_ps(v[0], length);
+		v[1] = _mm_div_ps(v[1], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Dot(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(va[0], vb[0]), _mm_mul_ps(va[1], vb[1])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void DistanceSquared(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm_sub_ps(va[0], vb[0]);
+		va[1] = _mm_sub_ps(va[1], vb[1]);
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(va[0], va[0]), _mm_mul_ps(va[1], va[1])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Distance(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm_sub_ps(va[0], vb[0]);
+		va[1] = _mm_sub_ps(va[1], vb[1]);
+		_mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(va[0], va[0]), _mm_mul_ps(va[1], va[1]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Rotate(VECTOR2<float>* out, const VECTOR2<float>* a, const ROTATION2<float>& rotation, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER c = _mm_set1_ps(rotation.c), s = _mm_set1_ps(rotation.s);
+		REGISTER x = _mm_sub_ps(_mm_mul_ps(v[0], c), _mm_mul_ps(v[1], s));
+		v[1] = _mm_add_ps(_mm_mul_ps(v[0], s), _mm_mul_ps(v[1], c));
+		v[0] = x;
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Rotate(a[i], rotation);
+	}
+}
+
+// 3D kernels
+SVML_TARGET("sse2") inline void Normalize(VECTOR3<float>* out, const VECTOR3<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(v[0], v[0]), _mm_mul_ps(v[1], v[1])), _mm_mul_ps(v[2], v[2])));
+		v[0] = _mm_div_ps(v[0], length);
+		v[1] = _mm_div_ps(v[1], length);
+		v[2] = _mm_div_ps(v[2], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Dot(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(va[0], vb[0]), _mm_mul_ps(va[1], vb[1])), _mm_mul_ps(va[2], vb[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void DistanceSquared(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm_sub_ps(va[0], vb[0]);
+		va[1] = _mm_sub_ps(va[1], vb[1]);
+		va[2] = _mm_sub_ps(va[2], vb[2]);
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(va[0], va[0]), _mm_mul_ps(va[1], va[1])), _mm_mul_ps(va[2], va[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Distance(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm_sub_ps(va[0], vb[0]);
+		va[1] = _mm_sub_ps(va[1], vb[1]);
+		va[2] = _mm_sub_ps(va[2], vb[2]);
+		_mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(va[0], va[0]), _mm_mul_ps(va[1], va[1])), _mm_mul_ps(va[2], va[2]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Transform(VECTOR3<float>* out, const MATRIX3<float>& matrix, const VECTOR3<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4], rotated[4];
+		Load((const float*)(a + i), stride, v);
+		rotated[0] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(matrix[0].x), v[0]), _mm_mul_ps(_mm_set1_ps(matrix[1].x), v[1])), _mm_mul_ps(_mm_set1_ps(matrix[2].x), v[2]));
+		rotated[1] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(matrix[0].y), v[0]), _mm_mul_ps(_mm_set1_ps(matrix[1].y), v[1])), _mm_mul_ps(_mm_set1_ps(matrix[2].y), v[2]));
+		rotated[2] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(matrix[0].z), v[0]), _mm_mul_ps(_mm_set1_ps(matrix[1].z), v[1])), _mm_mul_ps(_mm_set1_ps(matrix[2].z), v[2]));
+		if (stride == 4)
+		{
+			rotated[3] = v[3];
+		}
+		Store((float*)(out + i), stride, rotated);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = matrix * a[i];
+	}
+}
+
+// 4D kernels
+SVML_TARGET("sse2") inline void Normalize(VECTOR4<float>* out, const VECTOR4<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(v[0], v[0]), _mm_mul_ps(v[1], v[1])), _mm_mul_ps(v[2], v[2])));
+		v[0] = _mm_div_ps(v[0], length);
+		v[1] = _mm_div_ps(v[1], length);
+		v[2] = _mm_div_ps(v[2], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Dot(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(va[0], vb[0]), _mm_mul_ps(va[1], vb[1])), _mm_mul_ps(va[2], vb[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void DistanceSquared(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm_sub_ps(va[0], vb[0]);
+		va[1] = _mm_sub_ps(va[1], vb[1]);
+		va[2] = _mm_sub_ps(va[2], vb[2]);
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(va[0], va[0]), _mm_mul_ps(va[1], va[1])), _mm_mul_ps(va[2], va[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Distance(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm_sub_ps(va[0], vb[0]);
+		va[1] = _mm_sub_ps(va[1], vb[1]);
+		va[2] = _mm_sub_ps(va[2], vb[2]);
+		_mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(va[0], va[0]), _mm_mul_ps(va[1], va[1])), _mm_mul_ps(va[2], va[2]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("sse2") inline void Transform(VECTOR4<float>* out, const MATRIX3<float>& matrix, const VECTOR4<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4], rotated[4];
+		Load((const float*)(a + i), stride, v);
+		rotated[0] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(matrix[0].x), v[0]), _mm_mul_ps(_mm_set1_ps(matrix[1].x), v[1])), _mm_mul_ps(_mm_set1_ps(matrix[2].x), v[2]));
+		rotated[1] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(matrix[0].y), v[0]), _mm_mul_ps(_mm_set1_ps(matrix[1].y), v[1])), _mm_mul_ps(_mm_set1_ps(matrix[2].y), v[2]));
+		rotated[2] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(matrix[0].z), v[0]), _mm_mul_ps(_mm_set1_ps(matrix[1].z), v[1])), _mm_mul_ps(_mm_set1_ps(matrix[2].z), v[2]));
+		if (stride == 4)
+		{
+			rotated[3] = v[3];
+		}
+		Store((float*)(out + i), stride, rotated);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = VECTOR4<float>(matrix * VECTOR3<float>(a[i].xyz), a[i].w);
+	}
+}
+
+} // SSE2 namespace
+
+namespace AVX2
+{
+
+typedef __m256 REGISTER;
+const size_t WIDTH = 8; // Vectors per loop
+
+// Lane l of a register from (and to) the four floats at 4 * stride * l
+SVML_TARGET("avx2") inline __m256 LoadLanes(const float* source, const size_t& stride) { return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source)), _mm_loadu_ps(source + 4 * stride), 1); }
+SVML_TARGET("avx2") inline void StoreLanes(float* destination, const size_t& stride, const __m256& lanes)
+{
+	_mm_storeu_ps(destination, _mm256_castps256_ps128(lanes));
+	_mm_storeu_ps(destination + 4 * stride, _mm256_extractf128_ps(lanes, 1));
+}
+
+// (p[I], q[J], r[K], s[L]) in every lane
+template <int I, int J, int K, int L> SVML_TARGET("avx2") inline REGISTER Pick(const REGISTER& p, const REGISTER& q, const REGISTER& r, const REGISTER& s)
+{
+	return _mm256_shuffle_ps(_mm256_shuffle_ps(p, q, _MM_SHUFFLE(J, J, I, I)), _mm256_shuffle_ps(r, s, _MM_SHUFFLE(L, L, K, K)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// WIDTH vectors of stride floats (2, 3, or 4 for VECTOR4 and padded VECTOR3) into one register per component
+SVML_TARGET("avx2") inline void Load(const float* source, const size_t& stride, REGISTER* components)
+{
+	REGISTER r0 = LoadLanes(source, stride), r1 = LoadLanes(source + 4, stride);
+	if (stride == 2)
+	{
+		components[0] = _mm256_shuffle_ps(r0, r1, _MM_SHUFFLE(2, 0, 2, 0));
+		components[1] = _mm256_shuffle_ps(r0, r1, _MM_SHUFFLE(3, 1, 3, 1));
+		return;
+	}
+	REGISTER r2 = LoadLanes(source + 8, stride);
+	if (stride == 3)
+	{
+		components[0] = Pick<0, 3, 2, 1>(r0, r0, r1, r2);
+		components[1] = Pick<1, 0, 3, 2>(r0, r1, r1, r2);
+		components[2] = Pick<2, 1, 0, 3>(r0, r1, r2, r2);
+		return;
+	}
+	REGISTER r3 = LoadLanes(source + 12, stride);
+	REGISTER xy01 = _mm256_unpacklo_ps(r0, r1), xy23 = _mm256_unpacklo_ps(r2, r3), zw01 = _mm256_unpackhi_ps(r0, r1), zw23 = _mm256_unpackhi_ps(r2, r3);
+	components[0] = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+	components[1] = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+	components[2] = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+	components[3] = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// The inverse of Load()
+SVML_TARGET("avx2") inline void Store(float* destination, const size_t& stride, const REGISTER* components)
+{
+	if (stride == 2)
+	{
+		StoreLanes(destination, stride, _mm256_unpacklo_ps(components[0], components[1]));
+		StoreLanes(destination + 4, stride, _mm256_unpackhi_ps(components[0], components[1]));
+	}
+	else if (stride == 3)
+	{
+		StoreLanes(destination, stride, Pick<0, 0, 0, 1>(components[0], components[1], components[2], components[0]));
+		StoreLanes(destination + 4, stride, Pick<1, 1, 2, 2>(components[1], components[2], components[0], components[1]));
+		StoreLanes(destination + 8, stride, Pick<2, 3, 3, 3>(components[2], components[0], components[1], components[2]));
+	}
+	else
+	{
+		REGISTER xy01 = _mm256_unpacklo_ps(components[0], components[1]), xy23 = _mm256_unpackhi_ps(components[0], components[1]);
+		REGISTER zw01 = _mm256_unpacklo_ps(components[2], components[3]), zw23 = _mm256_unpackhi_ps(components[2], components[3]);
+		StoreLanes(destination, stride, _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0)));
+		StoreLanes(destination + 4, stride, _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2)));
+		StoreLanes(destination + 8, stride, _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0)));
+		StoreLanes(destination + 12, stride, _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2)));
+	}
+}
+
+// 2D kernels
+SVML_TARGET("avx2") inline void Normalize(VECTOR2<float>* out, const VECTOR2<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(v[0], v[0]), _mm256_mul_ps(v[1], v[1])));
+		v[0] = _mm256_div_ps(v[0], length);
+		v[1] = _mm256_div_ps(v[1], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Dot(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(va[0], vb[0]), _mm256_mul_ps(va[1], vb[1])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void DistanceSquared(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm256_sub_ps(va[0], vb[0]);
+		va[1] = _mm256_sub_ps(va[1], vb[1]);
+		_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(va[0], va[0]), _mm256_mul_ps(va[1], va[1])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Distance(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm256_sub_ps(va[0], vb[0]);
+		va[1] = _mm256_sub_ps(va[1], vb[1]);
+		_mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(va[0], va[0]), _mm256_mul_ps(va[1], va[1]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Rotate(VECTOR2<float>* out, const VECTOR2<float>* a, const ROTATION2<float>& rotation, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER c = _mm256_set1_ps(rotation.c), s = _mm256_set1_ps(rotation.s);
+		REGISTER x = _mm256_sub_ps(_mm256_mul_ps(v[0], c), _mm256_mul_ps(v[1], s));
+		v[1] = _mm256_add_ps(_mm256_mul_ps(v[0], s), _mm256_mul_ps(v[1], c));
+		v[0] = x;
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Rotate(a[i], rotation);
+	}
+}
+
+// 3D kernels
+SVML_TARGET("avx2") inline void Normalize(VECTOR3<float>* out, const VECTOR3<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(v[0], v[0]), _mm256_mul_ps(v[1], v[1])), _mm256_mul_ps(v[2], v[2])));
+		v[0] = _mm256_div_ps(v[0], length);
+		v[1] = _mm256_div_ps(v[1], length);
+		v[2] = _mm256_div_ps(v[2], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Dot(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(va[0], vb[0]), _mm256_mul_ps(va[1], vb[1])), _mm256_mul_ps(va[2], vb[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void DistanceSquared(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm256_sub_ps(va[0], vb[0]);
+		va[1] = _mm256_sub_ps(va[1], vb[1]);
+		va[2] = _mm256_sub_ps(va[2], vb[2]);
+		_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(va[0], va[0]), _mm256_mul_ps(va[1], va[1])), _mm256_mul_ps(va[2], va[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Distance(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm256_sub_ps(va[0], vb[0]);
+		va[1] = _mm256_sub_ps(va[1], vb[1]);
+		va[2] = _mm256_sub_ps(va[2], vb[2]);
+		_mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(va[0], va[0]), _mm256_mul_ps(va[1], va[1])), _mm256_mul_ps(va[2], va[2]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Transform(VECTOR3<float>* out, const MATRIX3<float>& matrix, const VECTOR3<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4], rotated[4];
+		Load((const float*)(a + i), stride, v);
+		rotated[0] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(matrix[0].x), v[0]), _mm256_mul_ps(_mm256_set1_ps(matrix[1].x), v[1])), _mm256_mul_ps(_mm256_set1_ps(matrix[2].x), v[2]));
+		rotated[1] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(matrix[0].y), v[0]), _mm256_mul_ps(_mm256_set1_ps(matrix[1].y), v[1])), _mm256_mul_ps(_mm256_set1_ps(matrix[2].y), v[2]));
+		rotated[2] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(matrix[0].z), v[0]), _mm256_mul_ps(_mm256_set1_ps(matrix[1].z), v[1])), _mm256_mul_ps(_mm256_set1_ps(matrix[2].z), v[2]));
+		if (stride == 4)
+		{
+			rotated[3] = v[3];
+		}
+		Store((float*)(out + i), stride, rotated);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = matrix * a[i];
+	}
+}
+
+// 4D kernels
+SVML_TARGET("avx2") inline void Normalize(VECTOR4<float>* out, const VECTOR4<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(v[0], v[0]), _mm256_mul_ps(v[1], v[1])), _mm256_mul_ps(v[2], v[2])));
+		v[0] = _mm256_div_ps(v[0], length);
+		v[1] = _mm256_div_ps(v[1], length);
+		v[2] = _mm256_div_ps(v[2], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Dot(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(va[0], vb[0]), _mm256_mul_ps(va[1], vb[1])), _mm256_mul_ps(va[2], vb[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void DistanceSquared(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm256_sub_ps(va[0], vb[0]);
+		va[1] = _mm256_sub_ps(va[1], vb[1]);
+		va[2] = _mm256_sub_ps(va[2], vb[2]);
+		_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(va[0], va[0]), _mm256_mul_ps(va[1], va[1])), _mm256_mul_ps(va[2], va[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Distance(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm256_sub_ps(va[0], vb[0]);
+		va[1] = _mm256_sub_ps(va[1], vb[1]);
+		va[2] = _mm256_sub_ps(va[2], vb[2]);
+		_mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(va[0], va[0]), _mm256_mul_ps(va[1], va[1])), _mm256_mul_ps(va[2], va[2]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx2") inline void Transform(VECTOR4<float>* out, const MATRIX3<float>& matrix, const VECTOR4<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4], rotated[4];
+		Load((const float*)(a + i), stride, v);
+		rotated[0] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(matrix[0].x), v[0]), _mm256_mul_ps(_mm256_set1_ps(matrix[1].x), v[1])), _mm256_mul_ps(_mm256_set1_ps(matrix[2].x), v[2]));
+		rotated[1] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(matrix[0].y), v[0]), _mm256_mul_ps(_mm256_set1_ps(matrix[1].y), v[1])), _mm256_mul_ps(_mm256_set1_ps(matrix[2].y), v[2]));
+		rotated[2] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(matrix[0].z), v[0]), _mm256_mul_ps(_mm256_set1_ps(matrix[1].z), v[1])), _mm256_mul_ps(_mm256_set1_ps(matrix[2].z), v[2]));
+		if (stride == 4)
+		{
+			rotated[3] = v[3];
+		}
+		Store((float*)(out + i), stride, rotated);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = VECTOR4<float>(matrix * VECTOR3<float>(a[i].xyz), a[i].w);
+	}
+}
+
+} // AVX2 namespace
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+namespace AVX512
+{
+
+typedef __m512 REGISTER;
+const size_t WIDTH = 16; // Vectors per loop
+
+// Lane l of a register from (and to) the four floats at 4 * stride * l
+SVML_TARGET("avx512f") inline __m512 LoadLanes(const float* source, const size_t& stride)
+{
+	__m512 lanes = _mm512_castps128_ps512(_mm_loadu_ps(source));
+	lanes = _mm512_insertf32x4(lanes, _mm_loadu_ps(source + 4 * stride), 1);
+	lanes = _mm512_insertf32x4(lanes, _mm_loadu_ps(source + 8 * stride), 2);
+	return _mm512_insertf32x4(lanes, _mm_loadu_ps(source + 12 * stride), 3);
+}
+SVML_TARGET("avx512f") inline void StoreLanes(float* destination, const size_t& stride, const __m512& lanes)
+{
+	_mm_storeu_ps(destination, _mm512_castps512_ps128(lanes));
+	_mm_storeu_ps(destination + 4 * stride, _mm512_maskz_extractf32x4_ps(0xF, lanes, 1));
+	_mm_storeu_ps(destination + 8 * stride, _mm512_maskz_extractf32x4_ps(0xF, lanes, 2));
+	_mm_storeu_ps(destination + 12 * stride, _mm512_maskz_extractf32x4_ps(0xF, lanes, 3));
+}
+
+// (p[I], q[J], r[K], s[L]) in every lane
+template <int I, int J, int K, int L> SVML_TARGET("avx512f") inline REGISTER Pick(const REGISTER& p, const REGISTER& q, const REGISTER& r, const REGISTER& s)
+{
+	return _mm512_shuffle_ps(_mm512_shuffle_ps(p, q, _MM_SHUFFLE(J, J, I, I)), _mm512_shuffle_ps(r, s, _MM_SHUFFLE(L, L, K, K)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// WIDTH vectors of stride floats (2, 3, or 4 for VECTOR4 and padded VECTOR3) into one register per component
+SVML_TARGET("avx512f") inline void Load(const float* source, const size_t& stride, REGISTER* components)
+{
+	REGISTER r0 = LoadLanes(source, stride), r1 = LoadLanes(source + 4, stride);
+	if (stride == 2)
+	{
+		components[0] = _mm512_shuffle_ps(r0, r1, _MM_SHUFFLE(2, 0, 2, 0));
+		components[1] = _mm512_shuffle_ps(r0, r1, _MM_SHUFFLE(3, 1, 3, 1));
+		return;
+	}
+	REGISTER r2 = LoadLanes(source + 8, stride);
+	if (stride == 3)
+	{
+		components[0] = Pick<0, 3, 2, 1>(r0, r0, r1, r2);
+		components[1] = Pick<1, 0, 3, 2>(r0, r1, r1, r2);
+		components[2] = Pick<2, 1, 0, 3>(r0, r1, r2, r2);
+		return;
+	}
+	REGISTER r3 = LoadLanes(source + 12, stride);
+	REGISTER xy01 = _mm512_unpacklo_ps(r0, r1), xy23 = _mm512_unpacklo_ps(r2, r3), zw01 = _mm512_unpackhi_ps(r0, r1), zw23 = _mm512_unpackhi_ps(r2, r3);
+	components[0] = _mm512_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+	components[1] = _mm512_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+	components[2] = _mm512_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+	components[3] = _mm512_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// The inverse of Load()
+SVML_TARGET("avx512f") inline void Store(float* destination, const size_t& stride, const REGISTER* components)
+{
+	if (stride == 2)
+	{
+		StoreLanes(destination, stride, _mm512_unpacklo_ps(components[0], components[1]));
+		StoreLanes(destination + 4, stride, _mm512_unpackhi_ps(components[0], components[1]));
+	}
+	else if (stride == 3)
+	{
+		StoreLanes(destination, stride, Pick<0, 0, 0, 1>(components[0], components[1], components[2], components[0]));
+		StoreLanes(destination + 4, stride, Pick<1, 1, 2, 2>(components[1], components[2], components[0], components[1]));
+		StoreLanes(destination + 8, stride, Pick<2, 3, 3, 3>(components[2], components[0], components[1], components[2]));
+	}
+	else
+	{
+		REGISTER xy01 = _mm512_unpacklo_ps(components[0], components[1]), xy23 = _mm512_unpackhi_ps(components[0], components[1]);
+		REGISTER zw01 = _mm512_unpacklo_ps(components[2], components[3]), zw23 = _mm512_unpackhi_ps(components[2], components[3]);
+		StoreLanes(destination, stride, _mm512_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0)));
+		StoreLanes(destination + 4, stride, _mm512_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2)));
+		StoreLanes(destination + 8, stride, _mm512_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0)));
+		StoreLanes(destination + 12, stride, _mm512_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2)));
+	}
+}
+
+// 2D kernels
+SVML_TARGET("avx512f") inline void Normalize(VECTOR2<float>* out, const VECTOR2<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm512_sqrt_ps(_mm512_add_ps(_mm512_mul_ps(v[0], v[0]), _mm512_mul_ps(v[1], v[1])));
+		v[0] = _mm512_div_ps(v[0], length);
+		v[1] = _mm512_div_ps(v[1], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Dot(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_mul_ps(va[0], vb[0]), _mm512_mul_ps(va[1], vb[1])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void DistanceSquared(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm512_sub_ps(va[0], vb[0]);
+		va[1] = _mm512_sub_ps(va[1], vb[1]);
+		_mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_mul_ps(va[0], va[0]), _mm512_mul_ps(va[1], va[1])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Distance(float* out, const VECTOR2<float>* a, const VECTOR2<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm512_sub_ps(va[0], vb[0]);
+		va[1] = _mm512_sub_ps(va[1], vb[1]);
+		_mm512_storeu_ps(out + i, _mm512_sqrt_ps(_mm512_add_ps(_mm512_mul_ps(va[0], va[0]), _mm512_mul_ps(va[1], va[1]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Rotate(VECTOR2<float>* out, const VECTOR2<float>* a, const ROTATION2<float>& rotation, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR2<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER c = _mm512_set1_ps(rotation.c), s = _mm512_set1_ps(rotation.s);
+		REGISTER x = _mm512_sub_ps(_mm512_mul_ps(v[0], c), _mm512_mul_ps(v[1], s));
+		v[1] = _mm512_add_ps(_mm512_mul_ps(v[0], s), _mm512_mul_ps(v[1], c));
+		v[0] = x;
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Rotate(a[i], rotation);
+	}
+}
+
+// 3D kernels
+SVML_TARGET("avx512f") inline void Normalize(VECTOR3<float>* out, const VECTOR3<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm512_sqrt_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(v[0], v[0]), _mm512_mul_ps(v[1], v[1])), _mm512_mul_ps(v[2], v[2])));
+		v[0] = _mm512_div_ps(v[0], length);
+		v[1] = _mm512_div_ps(v[1], length);
+		v[2] = _mm512_div_ps(v[2], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Dot(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(va[0], vb[0]), _mm512_mul_ps(va[1], vb[1])), _mm512_mul_ps(va[2], vb[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void DistanceSquared(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm512_sub_ps(va[0], vb[0]);
+		va[1] = _mm512_sub_ps(va[1], vb[1]);
+		va[2] = _mm512_sub_ps(va[2], vb[2]);
+		_mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(va[0], va[0]), _mm512_mul_ps(va[1], va[1])), _mm512_mul_ps(va[2], va[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Distance(float* out, const VECTOR3<float>* a, const VECTOR3<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm512_sub_ps(va[0], vb[0]);
+		va[1] = _mm512_sub_ps(va[1], vb[1]);
+		va[2] = _mm512_sub_ps(va[2], vb[2]);
+		_mm512_storeu_ps(out + i, _mm512_sqrt_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(va[0], va[0]), _mm512_mul_ps(va[1], va[1])), _mm512_mul_ps(va[2], va[2]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Transform(VECTOR3<float>* out, const MATRIX3<float>& matrix, const VECTOR3<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR3<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4], rotated[4];
+		Load((const float*)(a + i), stride, v);
+		rotated[0] = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(matrix[0].x), v[0]), _mm512_mul_ps(_mm512_set1_ps(matrix[1].x), v[1])), _mm512_mul_ps(_mm512_set1_ps(matrix[2].x), v[2]));
+		rotated[1] = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(matrix[0].y), v[0]), _mm512_mul_ps(_mm512_set1_ps(matrix[1].y), v[1])), _mm512_mul_ps(_mm512_set1_ps(matrix[2].y), v[2]));
+		rotated[2] = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(matrix[0].z), v[0]), _mm512_mul_ps(_mm512_set1_ps(matrix[1].z), v[1])), _mm512_mul_ps(_mm512_set1_ps(matrix[2].z), v[2]));
+		if (stride == 4)
+		{
+			rotated[3] = v[3];
+		}
+		Store((float*)(out + i), stride, rotated);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = matrix * a[i];
+	}
+}
+
+// 4D kernels
+SVML_TARGET("avx512f") inline void Normalize(VECTOR4<float>* out, const VECTOR4<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4];
+		Load((const float*)(a + i), stride, v);
+		REGISTER length = _mm512_sqrt_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(v[0], v[0]), _mm512_mul_ps(v[1], v[1])), _mm512_mul_ps(v[2], v[2])));
+		v[0] = _mm512_div_ps(v[0], length);
+		v[1] = _mm512_div_ps(v[1], length);
+		v[2] = _mm512_div_ps(v[2], length);
+		Store((float*)(out + i), stride, v);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Normalize(a[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Dot(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		_mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(va[0], vb[0]), _mm512_mul_ps(va[1], vb[1])), _mm512_mul_ps(va[2], vb[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Dot(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void DistanceSquared(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm512_sub_ps(va[0], vb[0]);
+		va[1] = _mm512_sub_ps(va[1], vb[1]);
+		va[2] = _mm512_sub_ps(va[2], vb[2]);
+		_mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(va[0], va[0]), _mm512_mul_ps(va[1], va[1])), _mm512_mul_ps(va[2], va[2])));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::DistanceSquared(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Distance(float* out, const VECTOR4<float>* a, const VECTOR4<float>* b, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER va[4], vb[4];
+		Load((const float*)(a + i), stride, va);
+		Load((const float*)(b + i), stride, vb);
+		va[0] = _mm512_sub_ps(va[0], vb[0]);
+		va[1] = _mm512_sub_ps(va[1], vb[1]);
+		va[2] = _mm512_sub_ps(va[2], vb[2]);
+		_mm512_storeu_ps(out + i, _mm512_sqrt_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(va[0], va[0]), _mm512_mul_ps(va[1], va[1])), _mm512_mul_ps(va[2], va[2]))));
+	}
+	for (; i < count; i++)
+	{
+		out[i] = SVML::Distance(a[i], b[i]);
+	}
+}
+SVML_TARGET("avx512f") inline void Transform(VECTOR4<float>* out, const MATRIX3<float>& matrix, const VECTOR4<float>* a, const size_t& count)
+{
+	const size_t stride = sizeof(VECTOR4<float>) / sizeof(float);
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH)
+	{
+		REGISTER v[4], rotated[4];
+		Load((const float*)(a + i), stride, v);
+		rotated[0] = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(matrix[0].x), v[0]), _mm512_mul_ps(_mm512_set1_ps(matrix[1].x), v[1])), _mm512_mul_ps(_mm512_set1_ps(matrix[2].x), v[2]));
+		rotated[1] = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(matrix[0].y), v[0]), _mm512_mul_ps(_mm512_set1_ps(matrix[1].y), v[1])), _mm512_mul_ps(_mm512_set1_ps(matrix[2].y), v[2]));
+		rotated[2] = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(matrix[0].z), v[0]), _mm512_mul_ps(_mm512_set1_ps(matrix[1].z), v[1])), _mm512_mul_ps(_mm512_set1_ps(matrix[2].z), v[2]));
+		if (stride == 4)
+		{
+			rotated[3] = v[3];
+		}
+		Store((float*)(out + i), stride, rotated);
+	}
+	for (; i < count; i++)
+	{
+		out[i] = VECTOR4<float>(matrix * VECTOR3<float>(a[i].xyz), a[i].w);
+	}
+}
+
+} // AVX512 namespace
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// 2D float bulk functions on the active instruction set
+inline void Normalize(const SPAN< VECTOR2<float> >& out, const SPAN< const VECTOR2<float> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(VECTOR2<float>*, const VECTOR2<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Normalize, AVX2::Normalize, AVX512::Normalize);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, end - begin); }, grain, pool);
+}
+inline void Dot(const SPAN<float>& out, const SPAN< const VECTOR2<float> >& a, const SPAN< const VECTOR2<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR2<float>*, const VECTOR2<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Dot, AVX2::Dot, AVX512::Dot);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void Distance(const SPAN<float>& out, const SPAN< const VECTOR2<float> >& a, const SPAN< const VECTOR2<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR2<float>*, const VECTOR2<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Distance, AVX2::Distance, AVX512::Distance);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void DistanceSquared(const SPAN<float>& out, const SPAN< const VECTOR2<float> >& a, const SPAN< const VECTOR2<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR2<float>*, const VECTOR2<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::DistanceSquared, AVX2::DistanceSquared, AVX512::DistanceSquared);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void Rotate(const SPAN< VECTOR2<float> >& out, const SPAN< const VECTOR2<float> >& a, const ROTATION2<float>& rotation, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(VECTOR2<float>*, const VECTOR2<float>*, const ROTATION2<float>&, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Rotate, AVX2::Rotate, AVX512::Rotate);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, rotation, end - begin); }, grain, pool);
+}
+
+// 3D float bulk functions on the active instruction set
+inline void Normalize(const SPAN< VECTOR3<float> >& out, const SPAN< const VECTOR3<float> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(VECTOR3<float>*, const VECTOR3<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Normalize, AVX2::Normalize, AVX512::Normalize);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, end - begin); }, grain, pool);
+}
+inline void Dot(const SPAN<float>& out, const SPAN< const VECTOR3<float> >& a, const SPAN< const VECTOR3<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR3<float>*, const VECTOR3<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Dot, AVX2::Dot, AVX512::Dot);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void Distance(const SPAN<float>& out, const SPAN< const VECTOR3<float> >& a, const SPAN< const VECTOR3<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR3<float>*, const VECTOR3<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Distance, AVX2::Distance, AVX512::Distance);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void DistanceSquared(const SPAN<float>& out, const SPAN< const VECTOR3<float> >& a, const SPAN< const VECTOR3<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR3<float>*, const VECTOR3<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::DistanceSquared, AVX2::DistanceSquared, AVX512::DistanceSquared);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void Rotate(const SPAN< VECTOR3<float> >& out, const SPAN< const VECTOR3<float> >& a, const QUATERNION<float>& rotation, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	MATRIX3<float> matrix = ToMatrix(rotation);
+	typedef void (*KERNEL)(VECTOR3<float>*, const MATRIX3<float>&, const VECTOR3<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Transform, AVX2::Transform, AVX512::Transform);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, matrix, a.data + begin, end - begin); }, grain, pool);
+}
+inline void Transform(const SPAN< VECTOR3<float> >& out, const MATRIX3<float>& matrix, const SPAN< const VECTOR3<float> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(VECTOR3<float>*, const MATRIX3<float>&, const VECTOR3<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Transform, AVX2::Transform, AVX512::Transform);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, matrix, a.data + begin, end - begin); }, grain, pool);
+}
+
+// 4D float bulk functions on the active instruction set
+inline void Normalize(const SPAN< VECTOR4<float> >& out, const SPAN< const VECTOR4<float> >& a, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(VECTOR4<float>*, const VECTOR4<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Normalize, AVX2::Normalize, AVX512::Normalize);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, end - begin); }, grain, pool);
+}
+inline void Dot(const SPAN<float>& out, const SPAN< const VECTOR4<float> >& a, const SPAN< const VECTOR4<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR4<float>*, const VECTOR4<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Dot, AVX2::Dot, AVX512::Dot);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void Distance(const SPAN<float>& out, const SPAN< const VECTOR4<float> >& a, const SPAN< const VECTOR4<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR4<float>*, const VECTOR4<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Distance, AVX2::Distance, AVX512::Distance);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void DistanceSquared(const SPAN<float>& out, const SPAN< const VECTOR4<float> >& a, const SPAN< const VECTOR4<float> >& b, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	typedef void (*KERNEL)(float*, const VECTOR4<float>*, const VECTOR4<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::DistanceSquared, AVX2::DistanceSquared, AVX512::DistanceSquared);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, a.data + begin, b.data + begin, end - begin); }, grain, pool);
+}
+inline void Rotate(const SPAN< VECTOR4<float> >& out, const SPAN< const VECTOR4<float> >& a, const QUATERNION<float>& rotation, const size_t& grain = DEFAULT_GRAIN, WORK_POOL& pool = DefaultPool())
+{
+	MATRIX3<float> matrix = ToMatrix(rotation);
+	typedef void (*KERNEL)(VECTOR4<float>*, const MATRIX3<float>&, const VECTOR4<float>*, const size_t&);
+	KERNEL kernel = Dispatch<KERNEL>(SSE2::Transform, AVX2::Transform, AVX512::Transform);
+	ParallelFor(a.count, [&](size_t begin, size_t end) { kernel(out.Data() + begin, matrix, a.data + begin, end - begin); }, grain, pool);
+}
+
+#endif // SVML_HAS_DISPATCH
+
+} // Bulk namespace
+#endif // SVML_USE_THREADS
+
+//----------------------------------------------------------------------
+// 
+// Sec. 16 - Spatial hash grids
+// 
+//----------------------------------------------------------------------
+
+// Hash of a grid cell (the three primes of Teschner et al., then a final mix so the low bits depend on every coordinate)
+inline unsigned HashGridMix(unsigned hash)
+{
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6Bu;
+	return hash ^ (hash >> 13);
+}
+inline unsigned HashCell(const VECTOR2<int>& cell) { return HashGridMix(((unsigned)cell.Component(0) * 73856093u) ^ ((unsigned)cell.Component(1) * 19349663u)); }
+inline unsigned HashCell(const VECTOR3<int>& cell) { return HashGridMix(((unsigned)cell.Component(0) * 73856093u) ^ ((unsigned)cell.Component(1) * 19349663u) ^ ((unsigned)cell.Component(2) * 83492791u)); }
+
+// Cells are clamped to +-2^28, so differences of cells, and cells plus or minus the rings QueryNearest() visits, fit in an
+// int. Clamping keeps cells in order, so points and queries past it share the outermost cells and the results stay exact
+const int HASH_GRID_CELL_LIMIT = 1 << 28;
+
+// Adds candidate (squared distance, index) to nearest, a max-heap of the k nearest so far
+template <typename DISTANCE> void KeepNearest(std::vector< std::pair<DISTANCE, unsigned> >& nearest, const unsigned& k, const std::pair<DISTANCE, unsigned>& candidate)
+{
+	if (nearest.size() < k)
+	{
+		nearest.push_back(candidate);
+		std::push_heap(nearest.begin(), nearest.end());
+	}
+	else if (candidate < nearest.front())
+	{
+		std::pop_heap(nearest.begin(), nearest.end());
+		nearest.back() = candidate;
+		std::push_heap(nearest.begin(), nearest.end());
+	}
+}
+
+// Buckets for count points: a power of two, at least twice count so most hold one cell
+inline unsigned HashGridBuckets(const unsigned& count)
+{
+	unsigned buckets = 16;
+	while (buckets < count * 2 && buckets < 0x80000000u)
+	{
+		buckets *= 2;
+	}
+	return buckets;
+}
+
+// 2D grid of points. Insert(), Remove() and Move() keep the layout up to date: points inserted, or moved
+// to another bucket, wait in a short pending list that queries scan directly, and are filed into the buckets
+// by Rebuild() once the list grows. Indices from Build() and Insert() stay the same until the point is removed
+template <typename TYPE>
+class HASH_GRID2
+{
+public:
+	typedef VECTOR2<TYPE> VECTOR;
+	typedef VECTOR2<int> CELL;
+
+	// Constructors
+	explicit HASH_GRID2(const TYPE& cellSize) : cellSize(cellSize), live(0) { Rebuild(); }
+	HASH_GRID2(const TYPE& cellSize, const VECTOR* points, const unsigned& count) : cellSize(cellSize) { Build(points, count); }
+
+	// Replaces every point with points[0] to points[count - 1], which get indices 0 to count - 1
+	void Build(const VECTOR* points, const unsigned& count)
+	{
+		this->points.assign(points, points + count);
+		cells.resize(count);
+		for (unsigned i = 0; i < count; i++)
+		{
+			cells[i] = CellOf(points[i]);
+		}
+		filed.assign(count, PENDING);
+		freeIndices.clear();
+		live = count;
+		Rebuild();
+	}
+
+#ifdef SVML_USE_THREADS
+	// Build() on a pool: the same layout, bucket by bucket, as the serial one
+	void Build(const Bulk::SPAN<const VECTOR>& points, const size_t& grain = Bulk::DEFAULT_GRAIN, Bulk::WORK_POOL& pool = Bulk::DefaultPool())
+	{
+		unsigned count = (unsigned)points.count;
+		this->points.resize(count);
+		cells.resize(count);
+		filed.resize(count);
+		freeIndices.clear();
+		pending.clear();
+		live = count;
+		unsigned buckets = HashGridBuckets(count);
+		bucketMask = buckets - 1;
+
+		// Bucket sizes, counted concurrently
+		std::vector< std::atomic<unsigned> > next(buckets);
+		Bulk::ParallelFor(count, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; i++)
+			{
+				this->points[i] = points[i];
+				cells[i] = CellOf(points[i]);
+				filed[i] = Bucket(cells[i]);
+				next[filed[i]].fetch_add(1, std::memory_order_relaxed);
+			}
+		}, grain, pool);
+		bounds = Bulk::ReduceChunks(count, AABB2<int>::Empty(), [&](size_t begin, size_t end) { return Fit(&cells[begin], (unsigned)(end - begin)); },
+		                            [](const AABB2<int>& a, const AABB2<int>& b) { return Union(a, b); }, grain, pool);
+
+		offsets.resize(buckets + 1);
+		offsets[0] = 0;
+		for (unsigned bucket = 0; bucket < buckets; bucket++)
+		{
+			offsets[bucket + 1] = offsets[bucket] + next[bucket].load(std::memory_order_relaxed);
+			next[bucket].store(offsets[bucket], std::memory_order_relaxed);
+		}
+
+		// Scattered in any order, then each bucket sorted by index as the serial counting sort leaves it
+		indices.resize(count);
+		Bulk::ParallelFor(count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { indices[next[filed[i]].fetch_add(1, std::memory_order_relaxed)] = (unsigned)i; } }, grain, pool);
+		Bulk::ParallelFor(buckets, [&](size_t begin, size_t end) { for (size_t bucket = begin; bucket < end; bucket++) { std::sort(indices.begin() + offsets[bucket], indices.begin() + offsets[bucket + 1]); } }, grain, pool);
+	}
+#endif
+
+	// Adds a point and returns its index (one freed by Remove(), if there is any)
+	unsigned Insert(const VECTOR& point)
+	{
+		unsigned index;
+		if (freeIndices.empty())
+		{
+			index = (unsigned)points.size();
+			points.push_back(point);
+			cells.push_back(CellOf(point));
+			filed.push_back(PENDING);
+		}
+		else
+		{
+			index = freeIndices.back();
+			freeIndices.pop_back();
+			points[index] = point;
+			cells[index] = CellOf(point);
+			filed[index] = PENDING;
+		}
+		live++;
+		bounds = Union(bounds, cells[index]);
+		AddPending(index);
+		return index;
+	}
+
+	void Remove(const unsigned& index)
+	{
+		if (filed[index] == PENDING)
+		{
+			*std::find(pending.begin(), pending.end(), index) = pending.back();
+			pending.pop_back();
+		}
+		filed[index] = REMOVED;
+		freeIndices.push_back(index);
+		live--;
+	}
+
+	// A point moved within its bucket stays filed there
+	void Move(const unsigned& index, const VECTOR& point)
+	{
+		points[index] = point;
+		cells[index] = CellOf(point);
+		bounds = Union(bounds, cells[index]);
+		if (filed[index] != PENDING && filed[index] != Bucket(cells[index]))
+		{
+			filed[index] = PENDING;
+			AddPending(index);
+		}
+	}
+
+	// Files the pending points, with buckets for the points there are now (Insert() and Move() call it as the list grows)
+	void Rebuild()
+	{
+		unsigned buckets = HashGridBuckets(live);
+		bucketMask = buckets - 1;
+		offsets.assign(buckets + 1, 0);
+		bounds = AABB2<int>::Empty();
+		for (unsigned i = 0; i < points.size(); i++)
+		{
+			if (filed[i] != REMOVED)
+			{
+				filed[i] = Bucket(cells[i]);
+				offsets[filed[i] + 1]++;
+				bounds = Union(bounds, cells[i]);
+			}
+		}
+		for (unsigned bucket = 0; bucket < buckets; bucket++)
+		{
+			offsets[bucket + 1] += offsets[bucket];
+		}
+		std::vector<unsigned> next(offsets.begin(), offsets.end() - 1);
+		indices.resize(live);
+		for (unsigned i = 0; i < points.size(); i++)
+		{
+			if (filed[i] != REMOVED)
+			{
+				indices[next[filed[i]]++] = i;
+			}
+		}
+		pending.clear();
+	}
+
+	// Element access
+	unsigned Count() const { return live; }
+	VECTOR Get(const unsigned& index) const { return points[index]; }
+	TYPE CellSize() const { return cellSize; }
+	CELL CellOf(const VECTOR& point) const { return CELL(Clamp(Floor(point / cellSize), (TYPE)-HASH_GRID_CELL_LIMIT, (TYPE)HASH_GRID_CELL_LIMIT)); }
+
+	// Appends the indices of the points within radius of center (inclusive) to found, and returns how many there were
+	unsigned QueryRadius(const VECTOR& center, const TYPE& radius, std::vector<unsigned>& found) const
+	{
+		size_t before = found.size();
+		TYPE radiusSquared = radius * radius;
+		for (unsigned p = 0; p < pending.size(); p++)
+		{
+			if (DistanceSquared(points[pending[p]], center) <= radiusSquared)
+			{
+				found.push_back(pending[p]);
+			}
+		}
+		VECTOR reach(radius, radius);
+		CELL first = Max(CellOf(center - reach), bounds.minimum);
+		CELL last = Min(CellOf(center + reach), bounds.maximum);
+		for (int y = first.Component(1); y <= last.Component(1); y++)
+		{
+			for (int x = first.Component(0); x <= last.Component(0); x++)
+			{
+				CELL cell(x, y);
+				unsigned bucket = Bucket(cell);
+				for (unsigned k = offsets[bucket]; k < offsets[bucket + 1]; k++)
+				{
+					unsigned i = indices[k];
+					if (Filed(i, bucket, cell) && DistanceSquared(points[i], center) <= radiusSquared)
+					{
+						found.push_back(i);
+					}
+				}
+			}
+		}
+		return (unsigned)(found.size() - before);
+	}
+
+	// Appends the indices of the k points nearest to center to found, nearest first (the lower index first among
+	// equally near ones), and returns how many there were: k, or Count() if that is less. The search visits rings of
+	// cells around center's until every point not yet seen must be farther than the k nearest found
+	unsigned QueryNearest(const VECTOR& center, const unsigned& k, std::vector<unsigned>& found) const
+	{
+		if (k == 0 || live == 0)
+		{
+			return 0;
+		}
+		std::vector<CANDIDATE> nearest; // Max-heap of the nearest so far
+		nearest.reserve(k + 1);
+		for (unsigned p = 0; p < pending.size(); p++)
+		{
+			KeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[pending[p]], center), pending[p]));
+		}
+
+		// Rings closer than the bounds are empty, and those past the farthest side of them as well
+		CELL middle = CellOf(center);
+		int64_t firstRing = 0, lastRing = 0;
+		for (unsigned axis = 0; axis < 2; axis++)
+		{
+			int64_t below = (int64_t)bounds.minimum.Component(axis) - middle.Component(axis);
+			int64_t above = (int64_t)middle.Component(axis) - bounds.maximum.Component(axis);
+			firstRing = std::max(firstRing, std::max(below, above));
+			lastRing = std::max(lastRing, std::max(-below, -above));
+		}
+		for (int ring = (int)firstRing; ring <= (int)lastRing; ring++)
+		{
+			// Every point nearer than (ring - 1) cells to center has been seen
+			TYPE seen = (TYPE)(ring - 1) * cellSize;
+			if (ring > 0 && nearest.size() == k && nearest.front().first < seen * seen)
+			{
+				break;
+			}
+			CELL first = Max(middle - CELL(ring, ring), bounds.minimum);
+			CELL last = Min(middle + CELL(ring, ring), bounds.maximum);
+			for (int y = first.Component(1); y <= last.Component(1); y++)
+			{
+				// Whole rows on the faces of the ring, and the two ends of the rows inside it
+				bool face = abs(y - middle.Component(1)) == ring;
+				int step = (face || ring == 0) ? 1 : 2 * ring;
+				for (int x = face ? first.Component(0) : middle.Component(0) - ring; x <= last.Component(0); x += step)
+				{
+					if (x < first.Component(0))
+					{
+						continue;
+					}
+					CELL cell(x, y);
+					unsigned bucket = Bucket(cell);
+					for (unsigned n = offsets[bucket]; n < offsets[bucket + 1]; n++)
+					{
+						unsigned i = indices[n];
+						if (Filed(i, bucket, cell))
+						{
+							KeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[i], center), i));
+						}
+					}
+				}
+			}
+		}
+		std::sort_heap(nearest.begin(), nearest.end());
+		for (unsigned n = 0; n < nearest.size(); n++)
+		{
+			found.push_back(nearest[n].second);
+		}
+		return (unsigned)nearest.size();
+	}
+
+private:
+	enum { PENDING = 0xFFFFFFFFu, REMOVED = 0xFFFFFFFEu }; // filed[] of points outside the buckets
+	typedef std::pair<typename ScalarType<TYPE>::type, unsigned> CANDIDATE;
+
+	unsigned Bucket(const CELL& cell) const { return HashCell(cell) & bucketMask; }
+
+	// Whether the index found in bucket belongs to cell (other cells share buckets, and moved points leave stale indices)
+	bool Filed(const unsigned& index, const unsigned& bucket, const CELL& cell) const { return filed[index] == bucket && cells[index] == cell; }
+
+	void AddPending(const unsigned& index)
+	{
+		pending.push_back(index);
+		if (pending.size() > 32 + live / 8)
+		{
+			Rebuild();
+		}
+	}
+
+	TYPE cellSize;
+	unsigned live; // Points not removed
+	unsigned bucketMask;
+	AABB2<int> bounds; // Of every point's cell, and of cells points have left since the last Rebuild()
+	std::vector<VECTOR> points; // By index
+	std::vector<CELL> cells; // By index
+	std::vector<unsigned> filed; // By index: the bucket whose indices list it, PENDING or REMOVED
+	std::vector<unsigned> offsets; // Bucket b's indices are indices[offsets[b]] to indices[offsets[b + 1] - 1]
+	std::vector<unsigned> indices;
+	std::vector<unsigned> pending; // Points no bucket lists yet
+	std::vector<unsigned> freeIndices; // Removed, for Insert() to reuse
+};
+
+// 3D grid of points. Insert(), Remove() and Move() keep the layout up to date: points inserted, or moved
+// to another bucket, wait in a short pending list that queries scan directly, and are filed into the buckets
+// by Rebuild() once the list grows. Indices from Build() and Insert() stay the same until the point is removed
+template <typename TYPE>
+class HASH_GRID3
+{
+public:
+	typedef VECTOR3<TYPE> VECTOR;
+	typedef VECTOR3<int> CELL;
+
+	// Constructors
+	explicit HASH_GRID3(const TYPE& cellSize) : cellSize(cellSize), live(0) { Rebuild(); }
+	HASH_GRID3(const TYPE& cellSize, const VECTOR* points, const unsigned& count) : cellSize(cellSize) { Build(points, count); }
+
+	// Replaces every point with points[0] to points[count - 1], which get indices 0 to count - 1
+	void Build(const VECTOR* points, const unsigned& count)
+	{
+		this->points.assign(points, points + count);
+		cells.resize(count);
+		for (unsigned i = 0; i < count; i++)
+		{
+			cells[i] = CellOf(points[i]);
+		}
+		filed.assign(count, PENDING);
+		freeIndices.clear();
+		live = count;
+		Rebuild();
+	}
+
+#ifdef SVML_USE_THREADS
+	// Build() on a pool: the same layout, bucket by bucket, as the serial one
+	void Build(const Bulk::SPAN<const VECTOR>& points, const size_t& grain = Bulk::DEFAULT_GRAIN, Bulk::WORK_POOL& pool = Bulk::DefaultPool())
+	{
+		unsigned count = (unsigned)points.count;
+		this->points.resize(count);
+		cells.resize(count);
+		filed.resize(count);
+		freeIndices.clear();
+		pending.clear();
+		live = count;
+		unsigned buckets = HashGridBuckets(count);
+		bucketMask = buckets - 1;
+
+		// Bucket sizes, counted concurrently
+		std::vector< std::atomic<unsigned> > next(buckets);
+		Bulk::ParallelFor(count, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; i++)
+			{
+				this->points[i] = points[i];
+				cells[i] = CellOf(points[i]);
+				filed[i] = Bucket(cells[i]);
+				next[filed[i]].fetch_add(1, std::memory_order_relaxed);
+			}
+		}, grain, pool);
+		bounds = Bulk::ReduceChunks(count, AABB3<int>::Empty(), [&](size_t begin, size_t end) { return Fit(&cells[begin], (unsigned)(end - begin)); },
+		                            [](const AABB3<int>& a, const AABB3<int>& b) { return Union(a, b); }, grain, pool);
+
+		offsets.resize(buckets + 1);
+		offsets[0] = 0;
+		for (unsigned bucket = 0; bucket < buckets; bucket++)
+		{
+			offsets[bucket + 1] = offsets[bucket] + next[bucket].load(std::memory_order_relaxed);
+			next[bucket].store(offsets[bucket], std::memory_order_relaxed);
+		}
+
+		// Scattered in any order, then each bucket sorted by index as the serial counting sort leaves it
+		indices.resize(count);
+		Bulk::ParallelFor(count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { indices[next[filed[i]].fetch_add(1, std::memory_order_relaxed)] = (unsigned)i; } }, grain, pool);
+		Bulk::ParallelFor(buckets, [&](size_t begin, size_t end) { for (size_t bucket = begin; bucket < end; bucket++) { std::sort(indices.begin() + offsets[bucket], indices.begin() + offsets[bucket + 1]); } }, grain, pool);
+	}
+#endif
+
+	// Adds a point and returns its index (one freed by Remove(), if there is any)
+	unsigned Insert(const VECTOR& point)
+	{
+		unsigned index;
+		if (freeIndices.empty())
+		{
+			index = (unsigned)points.size();
+			points.push_back(point);
+			cells.push_back(CellOf(point));
+			filed.push_back(PENDING);
+		}
+		else
+		{
+			index = freeIndices.back();
+			freeIndices.pop_back();
+			points[index] = point;
+			cells[index] = CellOf(point);
+			filed[index] = PENDING;
+		}
+		live++;
+		bounds = Union(bounds, cells[index]);
+		AddPending(index);
+		return index;
+	}
+
+	void Remove(const unsigned& index)
+	{
+		if (filed[index] == PENDING)
+		{
+			*std::find(pending.begin(), pending.end(), index) = pending.back();
+			pending.pop_back();
+		}
+		filed[index] = REMOVED;
+		freeIndices.push_back(index);
+		live--;
+	}
+
+	// A point moved within its bucket stays filed there
+	void Move(const unsigned& index, const VECTOR& point)
+	{
+		points[index] = point;
+		cells[index] = CellOf(point);
+		bounds = Union(bounds, cells[index]);
+		if (filed[index] != PENDING && filed[index] != Bucket(cells[index]))
+		{
+			filed[index] = PENDING;
+			AddPending(index);
+		}
+	}
+
+	// Files the pending points, with buckets for the points there are now (Insert() and Move() call it as the list grows)
+	void Rebuild()
+	{
+		unsigned buckets = HashGridBuckets(live);
+		bucketMask = buckets - 1;
+		offsets.assign(buckets + 1, 0);
+		bounds = AABB3<int>::Empty();
+		for (unsigned i = 0; i < points.size(); i++)
+		{
+			if (filed[i] != REMOVED)
+			{
+				filed[i] = Bucket(cells[i]);
+				offsets[filed[i] + 1]++;
+				bounds = Union(bounds, cells[i]);
+			}
+		}
+		for (unsigned bucket = 0; bucket < buckets; bucket++)
+		{
+			offsets[bucket + 1] += offsets[bucket];
+		}
+		std::vector<unsigned> next(offsets.begin(), offsets.end() - 1);
+		indices.resize(live);
+		for (unsigned i = 0; i < points.size(); i++)
+		{
+			if (filed[i] != REMOVED)
+			{
+				indices[next[filed[i]]++] = i;
+			}
+		}
+		pending.clear();
+	}
+
+	// Element access
+	unsigned Count() const { return live; }
+	VECTOR Get(const unsigned& index) const { return points[index]; }
+	TYPE CellSize() const { return cellSize; }
+	CELL CellOf(const VECTOR& point) const { return CELL(Clamp(Floor(point / cellSize), (TYPE)-HASH_GRID_CELL_LIMIT, (TYPE)HASH_GRID_CELL_LIMIT)); }
+
+	// Appends the indices of the points within radius of center (inclusive) to found, and returns how many there were
+	unsigned QueryRadius(const VECTOR& center, const TYPE& radius, std::vector<unsigned>& found) const
+	{
+		size_t before = found.size();
+		TYPE radiusSquared = radius * radius;
+		for (unsigned p = 0; p < pending.size(); p++)
+		{
+			if (DistanceSquared(points[pending[p]], center) <= radiusSquared)
+			{
+				found.push_back(pending[p]);
+			}
+		}
+		VECTOR reach(radius, radius, radius);
+		CELL first = Max(CellOf(center - reach), bounds.minimum);
+		CELL last = Min(CellOf(center + reach), bounds.maximum);
+		for (int z = first.Component(2); z <= last.Component(2); z++)
+		{
+			for (int y = first.Component(1); y <= last.Component(1); y++)
+			{
+				for (int x = first.Component(0); x <= last.Component(0); x++)
+				{
+					CELL cell(x, y, z);
+					unsigned bucket = Bucket(cell);
+					for (unsigned k = offsets[bucket]; k < offsets[bucket + 1]; k++)
+					{
+						unsigned i = indices[k];
+						if (Filed(i, bucket, cell) && DistanceSquared(points[i], center) <= radiusSquared)
+						{
+							found.push_back(i);
+						}
+					}
+				}
+			}
+		}
+		return (unsigned)(found.size() - before);
+	}
+
+	// Appends the indices of the k points nearest to center to found, nearest first (the lower index first among
+	// equally near ones), and returns how many there were: k, or Count() if that is less. The search visits rings of
+	// cells around center's until every point not yet seen must be farther than the k nearest found
+	unsigned QueryNearest(const VECTOR& center, const unsigned& k, std::vector<unsigned>& found) const
+	{
+		if (k == 0 || live == 0)
+		{
+			return 0;
+		}
+		std::vector<CANDIDATE> nearest; // Max-heap of the nearest so far
+		nearest.reserve(k + 1);
+		for (unsigned p = 0; p < pending.size(); p++)
+		{
+			KeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[pending[p]], center), pending[p]));
+		}
+
+		// Rings closer than the bounds are empty, and those past the farthest side of them as well
+		CELL middle = CellOf(center);
+		int64_t firstRing = 0, lastRing = 0;
+		for (unsigned axis = 0; axis < 3; axis++)
+		{
+			int64_t below = (int64_t)bounds.minimum.Component(axis) - middle.Component(axis);
+			int64_t above = (int64_t)middle.Component(axis) - bounds.maximum.Component(axis);
+			firstRing = std::max(firstRing, std::max(below, above));
+			lastRing = std::max(lastRing, std::max(-below, -above));
+		}
+		for (int ring = (int)firstRing; ring <= (int)lastRing; ring++)
+		{
+			// Every point nearer than (ring - 1) cells to center has been seen
+			TYPE seen = (TYPE)(ring - 1) * cellSize;
+			if (ring > 0 && nearest.size() == k && nearest.front().first < seen * seen)
+			{
+				break;
+			}
+			CELL first = Max(middle - CELL(ring, ring, ring), bounds.minimum);
+			CELL last = Min(middle + CELL(ring, ring, ring), bounds.maximum);
+			for (int z = first.Component(2); z <= last.Component(2); z++)
+			{
+				for (int y = first.Component(1); y <= last.Component(1); y++)
+				{
+					// Whole rows on the faces of the ring, and the two ends of the rows inside it
+					bool face = abs(y - middle.Component(1)) == ring || abs(z - middle.Component(2)) == ring;
+					int step = (face || ring == 0) ? 1 : 2 * ring;
+					for (int x = face ? first.Component(0) : middle.Component(0) - ring; x <= last.Component(0); x += step)
+					{
+						if (x < first.Component(0))
+						{
+							continue;
+						}
+						CELL cell(x, y, z);
+						unsigned bucket = Bucket(cell);
+						for (unsigned n = offsets[bucket]; n < offsets[bucket + 1]; n++)
+						{
+							unsigned i = indices[n];
+							if (Filed(i, bucket, cell))
+							{
+								KeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[i], center), i));
+							}
+						}
+					}
+				}
+			}
+		}
+		std::sort_heap(nearest.begin(), nearest.end());
+		for (unsigned n = 0; n < nearest.size(); n++)
+		{
+			found.push_back(nearest[n].second);
+		}
+		return (unsigned)nearest.size();
+	}
+
+private:
+	enum { PENDING = 0xFFFFFFFFu, REMOVED = 0xFFFFFFFEu }; // filed[] of points outside the buckets
+	typedef std::pair<typename ScalarType<TYPE>::type, unsigned> CANDIDATE;
+
+	unsigned Bucket(const CELL& cell) const { return HashCell(cell) & bucketMask; }
+
+	// Whether the index found in bucket belongs to cell (other cells share buckets, and moved points leave stale indices)
+	bool Filed(const unsigned& index, const unsigned& bucket, const CELL& cell) const { return filed[index] == bucket && cells[index] == cell; }
+
+	void AddPending(const unsigned& index)
+	{
+		pending.push_back(index);
+		if (pending.size() > 32 + live / 8)
+		{
+			Rebuild();
+		}
+	}
+
+	TYPE cellSize;
+	unsigned live; // Points not removed
+	unsigned bucketMask;
+	AABB3<int> bounds; // Of every point's cell, and of cells points have left since the last Rebuild()
+	std::vector<VECTOR> points; // By index
+	std::vector<CELL> cells; // By index
+	std::vector<unsigned> filed; // By index: the bucket whose indices list it, PENDING or REMOVED
+	std::vector<unsigned> offsets; // Bucket b's indices are indices[offsets[b]] to indices[offsets[b + 1] - 1]
+	std::vector<unsigned> indices;
+	std::vector<unsigned> pending; // Points no bucket lists yet
+	std::vector<unsigned> freeIndices; // Removed, for Insert() to reuse
+};
+
+//----------------------------------------------------------------------
+// 
+// Sec. 17 - Kd-trees and bounding volume hierarchies
+// 
+//----------------------------------------------------------------------
+
+// Most points in a kd-tree leaf, and bins per axis and most primitives in a leaf of a BVH
+const unsigned KD_TREE_LEAF = 8;
+const unsigned BVH_BINS = 16;
+const unsigned BVH_MAX_LEAF = 8;
+
+// A copy of count elements in aligned storage (0 when count is 0), to free with AlignedFree()
+template <typename TYPE> TYPE* AlignedCopy(const TYPE* elements, const unsigned& count)
+{
+	if (count == 0) { return 0; }
+	TYPE* copy = (TYPE*)AlignedAllocate(count * sizeof(TYPE));
+	memcpy(copy, elements, count * sizeof(TYPE));
+	return copy;
+}
+
+// Squared distance from point to the nearest point of box (0 inside)
+template <typename TYPE> TYPE DistanceSquared(const AABB3<TYPE>& box, const VECTOR3<TYPE>& point) { return DistanceSquared(point, Max(box.minimum, Min(point, box.maximum))); }
+
+// The ray origin + distance * direction against triangle abc, either side facing (Moller-Trumbore): true when it
+// hits within maxDistance, distance is where
+template <typename TYPE> bool IntersectTriangle(const VECTOR3<TYPE>& origin, const VECTOR3<TYPE>& direction, const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b, const VECTOR3<TYPE>& c, const TYPE& maxDistance, TYPE& distance)
+{
+	VECTOR3<TYPE> edge1 = b - a;
+	VECTOR3<TYPE> edge2 = c - a;
+	VECTOR3<TYPE> p = Cross(direction, edge2);
+	TYPE determinant = Dot(edge1, p);
+	if (determinant == 0)
+	{
+		return false;
+	}
+	TYPE inverse = (TYPE)1 / determinant;
+	VECTOR3<TYPE> t = origin - a;
+	TYPE u = Dot(t, p) * inverse;
+	if (u < 0 || u > 1)
+	{
+		return false;
+	}
+	VECTOR3<TYPE> q = Cross(t, edge1);
+	TYPE v = Dot(direction, q) * inverse;
+	if (v < 0 || u + v > 1)
+	{
+		return false;
+	}
+	distance = Dot(edge2, q) * inverse;
+	return distance >= 0 && distance <= maxDistance;
+}
+
+// BVH bin of a centroid coordinate, scale being BVH_BINS over the extent of the centroids (a scale too large to be
+// finite puts everything in the last bin)
+template <typename TYPE> unsigned BvhBin(const TYPE& centroid, const TYPE& minimum, const TYPE& scale)
+{
+	TYPE position = (centroid - minimum) * scale;
+	return (position < (TYPE)(BVH_BINS - 1)) ? (unsigned)position : BVH_BINS - 1;
+}
+
+// 2D tree of points, split at the median of the widest axis down to KD_TREE_LEAF points per leaf. Build()
+// gives points[i] index i, which the queries return
+template <typename TYPE>
+class KD_TREE2
+{
+public:
+	typedef VECTOR2<TYPE> VECTOR;
+
+	// Constructors
+	KD_TREE2() : nodes(0), nodeCount(0), depth(0) {}
+	KD_TREE2(const VECTOR* points, const unsigned& count) : nodes(0), nodeCount(0) { Build(points, count); }
+	KD_TREE2(const KD_TREE2& other) : points(other.points), indices(other.indices), nodes(AlignedCopy(other.nodes, other.nodeCount)), nodeCount(other.nodeCount), depth(other.depth) {}
+	~KD_TREE2() { AlignedFree(nodes); }
+
+	const KD_TREE2& operator=(const KD_TREE2& rhs)
+	{
+		if (this != &rhs)
+		{
+			points = rhs.points;
+			indices = rhs.indices;
+			AlignedFree(nodes);
+			nodes = AlignedCopy(rhs.nodes, rhs.nodeCount);
+			nodeCount = rhs.nodeCount;
+			depth = rhs.depth;
+		}
+		return *this;
+	}
+
+	void Build(const VECTOR* points, const unsigned& count)
+	{
+		this->points.assign(points, points + count);
+		indices.resize(count);
+		for (unsigned i = 0; i < count; i++)
+		{
+			indices[i] = i;
+		}
+		std::vector<NODE> built;
+		depth = 0;
+		if (count > 0)
+		{
+			BuildNode(built, 0, count, 1);
+		}
+		AlignedFree(nodes);
+		nodes = AlignedCopy(built.empty() ? 0 : &built[0], (unsigned)built.size());
+		nodeCount = (unsigned)built.size();
+
+		// Points in leaf order
+		for (unsigned i = 0; i < count; i++)
+		{
+			this->points[i] = points[indices[i]];
+		}
+	}
+
+	// Element access
+	unsigned Count() const { return (unsigned)points.size(); }
+
+	// Appends the indices of the points within radius of center (inclusive) to found, and returns how many there were
+	unsigned QueryRadius(const VECTOR& center, const TYPE& radius, std::vector<unsigned>& found) const
+	{
+		size_t before = found.size();
+		TYPE radiusSquared = radius * radius;
+		std::vector<unsigned> stack;
+		stack.reserve(depth + 1);
+		if (nodeCount > 0)
+		{
+			stack.push_back(0);
+		}
+		while (!stack.empty())
+		{
+			unsigned index = stack.back();
+			const NODE& node = nodes[index];
+			stack.pop_back();
+			if (node.count > 0)
+			{
+				for (unsigned i = node.next; i < node.next + node.count; i++)
+				{
+					if (DistanceSquared(points[i], center) <= radiusSquared)
+					{
+						found.push_back(indices[i]);
+					}
+				}
+				continue;
+			}
+			TYPE offset = center.Component(node.axis) - node.split;
+			if (offset <= radius)
+			{
+				stack.push_back(index + 1);
+			}
+			if (-offset <= radius)
+			{
+				stack.push_back(node.next);
+			}
+		}
+		return (unsigned)(found.size() - before);
+	}
+
+	// Appends the indices of the k points nearest to center to found, nearest first (the lower index first among
+	// equally near ones), and returns how many there were: k, or Count() if that is less
+	unsigned QueryNearest(const VECTOR& center, const unsigned& k, std::vector<unsigned>& found) const
+	{
+		if (k == 0 || nodeCount == 0)
+		{
+			return 0;
+		}
+		std::vector<CANDIDATE> nearest; // Max-heap of the nearest so far
+		nearest.reserve(k + 1);
+		std::vector<CANDIDATE> stack; // Nodes to visit, with the squared distance to the side of the split they are on
+		stack.reserve(depth + 1);
+		stack.push_back(CANDIDATE(0, 0));
+		while (!stack.empty())
+		{
+			CANDIDATE entry = stack.back();
+			stack.pop_back();
+			if (nearest.size() == k && entry.first > nearest.front().first)
+			{
+				continue;
+			}
+			const NODE& node = nodes[entry.second];
+			if (node.count > 0)
+			{
+				for (unsigned i = node.next; i < node.next + node.count; i++)
+				{
+					KeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[i], center), indices[i]));
+				}
+				continue;
+			}
+			// The far side first, so the near one is visited next
+			TYPE offset = center.Component(node.axis) - node.split;
+			stack.push_back(CANDIDATE(offset * offset, (offset < 0) ? node.next : entry.second + 1));
+			stack.push_back(CANDIDATE(entry.first, (offset < 0) ? entry.second + 1 : node.next));
+		}
+		std::sort_heap(nearest.begin(), nearest.end());
+		for (unsigned n = 0; n < nearest.size(); n++)
+		{
+			found.push_back(nearest[n].second);
+		}
+		return (unsigned)nearest.size();
+	}
+
+	// Index of the point nearest to center (the tree must not be empty)
+	unsigned Nearest(const VECTOR& center) const
+	{
+		std::vector<unsigned> found;
+		QueryNearest(center, 1, found);
+		return found[0];
+	}
+
+private:
+	typedef std::pair<typename ScalarType<TYPE>::type, unsigned> CANDIDATE;
+
+	// 16 bytes for float, four to a cache line. An internal node's left child follows it, and holds the points up to
+	// split on axis; a leaf has count points from points[next]
+	struct NODE
+	{
+		TYPE split;
+		unsigned axis;
+		unsigned next; // The right child of an internal node, the first point of a leaf
+		unsigned count; // 0 for internal nodes
+
+		NODE() : split(0), axis(0), next(0), count(0) {}
+	};
+
+	// Orders point indices along one axis (by index among equal coordinates)
+	struct AXIS_LESS
+	{
+		const VECTOR* points;
+		unsigned axis;
+
+		AXIS_LESS(const VECTOR* points, const unsigned& axis) : points(points), axis(axis) {}
+		bool operator()(const unsigned& a, const unsigned& b) const { return points[a].Component(axis) < points[b].Component(axis) || (points[a].Component(axis) == points[b].Component(axis) && a < b); }
+	};
+
+	void BuildNode(std::vector<NODE>& built, const unsigned& first, const unsigned& last, const unsigned& level)
+	{
+		unsigned index = (unsigned)built.size();
+		built.push_back(NODE());
+		depth = std::max(depth, level);
+		if (last - first <= KD_TREE_LEAF)
+		{
+			built[index].next = first;
+			built[index].count = last - first;
+			return;
+		}
+		AABB2<TYPE> bounds = AABB2<TYPE>::Empty();
+		for (unsigned i = first; i < last; i++)
+		{
+			bounds = Union(bounds, points[indices[i]]);
+		}
+		VECTOR size = Size(bounds);
+		unsigned axis = 0;
+		for (unsigned a = 1; a < 2; a++)
+		{
+			if (size.Component(a) > size.Component(axis))
+			{
+				axis = a;
+			}
+		}
+		unsigned middle = first + (last - first) / 2;
+		std::nth_element(indices.begin() + first, indices.begin() + middle, indices.begin() + last, AXIS_LESS(&points[0], axis));
+		built[index].split = points[indices[middle]].Component(axis);
+		built[index].axis = axis;
+		BuildNode(built, first, middle, level + 1);
+		built[index].next = (unsigned)built.size();
+		BuildNode(built, middle, last, level + 1);
+	}
+
+	std::vector<VECTOR> points; // In leaf order
+	std::vector<unsigned> indices; // Of points[i], given to Build()
+	NODE* nodes;
+	unsigned nodeCount;
+	unsigned depth; // Levels of nodes
+};
+
+// 3D tree of points, split at the median of the widest axis down to KD_TREE_LEAF points per leaf. Build()
+// gives points[i] index i, which the queries return
+template <typename TYPE>
+class KD_TREE3
+{
+public:
+	typedef VECTOR3<TYPE> VECTOR;
+
+	// Constructors
+	KD_TREE3() : nodes(0), nodeCount(0), depth(0) {}
+	KD_TREE3(const VECTOR* points, const unsigned& count) : nodes(0), nodeCount(0) { Build(points, count); }
+	KD_TREE3(const KD_TREE3& other) : points(other.points), indices(other.indices), nodes(AlignedCopy(other.nodes, other.nodeCount)), nodeCount(other.nodeCount), depth(other.depth) {}
+	~KD_TREE3() { AlignedFree(nodes); }
+
+	const KD_TREE3& operator=(const KD_TREE3& rhs)
+	{
+		if (this != &rhs)
+		{
+			points = rhs.points;
+			indices = rhs.indices;
+			AlignedFree(nodes);
+			nodes = AlignedCopy(rhs.nodes, rhs.nodeCount);
+			nodeCount = rhs.nodeCount;
+			depth = rhs.depth;
+		}
+		return *this;
+	}
+
+	void Build(const VECTOR* points, const unsigned& count)
+	{
+		this->points.assign(points, points + count);
+		indices.resize(count);
+		for (unsigned i = 0; i < count; i++)
+		{
+			indices[i] = i;
+		}
+		std::vector<NODE> built;
+		depth = 0;
+		if (count > 0)
+		{
+			BuildNode(built, 0, count, 1);
+		}
+		AlignedFree(nodes);
+		nodes = AlignedCopy(built.empty() ? 0 : &built[0], (unsigned)built.size());
+		nodeCount = (unsigned)built.size();
+
+		// Points in leaf order
+		for (unsigned i = 0; i < count; i++)
+		{
+			this->points[i] = points[indices[i]];
+		}
+	}
+
+	// Element access
+	unsigned Count() const { return (unsigned)points.size(); }
+
+	// Appends the indices of the points within radius of center (inclusive) to found, and returns how many there were
+	unsigned QueryRadius(const VECTOR& center, const TYPE& radius, std::vector<unsigned>& found) const
+	{
+		size_t before = found.size();
+		TYPE radiusSquared = radius * radius;
+		std::vector<unsigned> stack;
+		stack.reserve(depth + 1);
+		if (nodeCount > 0)
+		{
+			stack.push_back(0);
+		}
+		while (!stack.empty())
+		{
+			unsigned index = stack.back();
+			const NODE& node = nodes[index];
+			stack.pop_back();
+			if (node.count > 0)
+			{
+				for (unsigned i = node.next; i < node.next + node.count; i++)
+				{
+					if (DistanceSquared(points[i], center) <= radiusSquared)
+					{
+						found.push_back(indices[i]);
+					}
+				}
+				continue;
+			}
+			TYPE offset = center.Component(node.axis) - node.split;
+			if (offset <= radius)
+			{
+				stack.push_back(index + 1);
+			}
+			if (-offset <= radius)
+			{
+				stack.push_back(node.next);
+			}
+		}
+		return (unsigned)(found.size() - before);
+	}
+
+	// Appends the indices of the k points nearest to center to found, nearest first (the lower index first among
+	// equally near ones), and returns how many there were: k, or Count() if that is less
+	unsigned QueryNearest(const VECTOR& center, const unsigned& k, std::vector<unsigned>& found) const
+	{
+		if (k == 0 || nodeCount == 0)
+		{
+			return 0;
+		}
+		std::vector<CANDIDATE> nearest; // Max-heap of the nearest so far
+		nearest.reserve(k + 1);
+		std::vector<CANDIDATE> stack; // Nodes to visit, with the squared distance to the side of the split they are on
+		stack.reserve(depth + 1);
+		stack.push_back(CANDIDATE(0, 0));
+		while (!stack.empty())
+		{
+			CANDIDATE entry = stack.back();
+			stack.pop_back();
+			if (nearest.size() == k && entry.first > nearest.front().first)
+			{
+				continue;
+			}
+			const NODE& node = nodes[entry.second];
+			if (node.count > 0)
+			{
+				for (unsigned i = node.next; i < node.next + node.count; i++)
+				{
+					KeepNearest(nearest, k, CANDIDATE(DistanceSquared(points[i], center), indices[i]));
+				}
+				continue;
+			}
+			// The far side first, so the near one is visited next
+			TYPE offset = center.Component(node.axis) - node.split;
+			stack.push_back(CANDIDATE(offset * offset, (offset < 0) ? node.next : entry.second + 1));
+			stack.push_back(CANDIDATE(entry.first, (offset < 0) ? entry.second + 1 : node.next));
+		}
+		std::sort_heap(nearest.begin(), nearest.end());
+		for (unsigned n = 0; n < nearest.size(); n++)
+		{
+			found.push_back(nearest[n].second);
+		}
+		return (unsigned)nearest.size();
+	}
+
+	// Index of the point nearest to center (the tree must not be empty)
+	unsigned Nearest(const VECTOR& center) const
+	{
+		std::vector<unsigned> found;
+		QueryNearest(center, 1, found);
+		return found[0];
+	}
+
+private:
+	typedef std::pair<typename ScalarType<TYPE>::type, unsigned> CANDIDATE;
+
+	// 16 bytes for float, four to a cache line. An internal node's left child follows it, and holds the points up to
+	// split on axis; a leaf has count points from points[next]
+	struct NODE
+	{
+		TYPE split;
+		unsigned axis;
+		unsigned next; // The right child of an internal node, the first point of a leaf
+		unsigned count; // 0 for internal nodes
+
+		NODE() : split(0), axis(0), next(0), count(0) {}
+	};
+
+	// Orders point indices along one axis (by index among equal coordinates)
+	struct AXIS_LESS
+	{
+		const VECTOR* points;
+		unsigned axis;
+
+		AXIS_LESS(const VECTOR* points, const unsigned& axis) : points(points), axis(axis) {}
+		bool operator()(const unsigned& a, const unsigned& b) const { return points[a].Component(axis) < points[b].Component(axis) || (points[a].Component(axis) == points[b].Component(axis) && a < b); }
+	};
+
+	void BuildNode(std::vector<NODE>& built, const unsigned& first, const unsigned& last, const unsigned& level)
+	{
+		unsigned index = (unsigned)built.size();
+		built.push_back(NODE());
+		depth = std::max(depth, level);
+		if (last - first <= KD_TREE_LEAF)
+		{
+			built[index].next = first;
+			built[index].count = last - first;
+			return;
+		}
+		AABB3<TYPE> bounds = AABB3<TYPE>::Empty();
+		for (unsigned i = first; i < last; i++)
+		{
+			bounds = Union(bounds, points[indices[i]]);
+		}
+		VECTOR size = Size(bounds);
+		unsigned axis = 0;
+		for (unsigned a = 1; a < 3; a++)
+		{
+			if (size.Component(a) > size.Component(axis))
+			{
+				axis = a;
+			}
+		}
+		unsigned middle = first + (last - first) / 2;
+		std::nth_element(indices.begin() + first, indices.begin() + middle, indices.begin() + last, AXIS_LESS(&points[0], axis));
+		built[index].split = points[indices[middle]].Component(axis);
+		built[index].axis = axis;
+		BuildNode(built, first, middle, level + 1);
+		built[index].next = (unsigned)built.size();
+		BuildNode(built, middle, last, level + 1);
+	}
+
+	std::vector<VECTOR> points; // In leaf order
+	std::vector<unsigned> indices; // Of points[i], given to Build()
+	NODE* nodes;
+	unsigned nodeCount;
+	unsigned depth; // Levels of nodes
+};
+
+// Node of a BVH3: four children, each an internal node or a leaf. Unused slots have empty boxes (which nothing
+// hits or overlaps), and child and count 0. 128 bytes for float, two cache lines
+template <typename TYPE>
+struct BVH3_NODE
+{
+	AABB3_PACKET<TYPE, 4> bounds;
+	unsigned child[4]; // The node index of an internal child, the first primitive slot of a leaf
+	unsigned count[4]; // Primitives in a leaf, 0 for an internal child
+
+	BVH3_NODE() { for (unsigned i = 0; i < 4; i++) { child[i] = count[i] = 0; } }
+};
+
+// Bounding volume hierarchy of boxes, built by binned surface area heuristic (BVH_BINS bins per axis, leaves of up
+// to BVH_MAX_LEAF primitives). Build() gives boxes[i] index i, which the queries return. The nodes are a flat array
+// with the root first, and a leaf's primitives are Primitive(child) to Primitive(child + count - 1)
+template <typename TYPE>
+class BVH3
+{
+public:
+	typedef VECTOR3<TYPE> VECTOR;
+	typedef AABB3<TYPE> BOX;
+	typedef BVH3_NODE<TYPE> NODE;
+
+	// Constructors
+	BVH3() : nodes(0), nodeCount(0), depth(0) { NoPool(); }
+	BVH3(const BOX* boxes, const unsigned& count) : nodes(0), nodeCount(0) { NoPool(); Build(boxes, count); }
+	BVH3(const BVH3& other) : boxes(other.boxes), order(other.order), nodes(AlignedCopy(other.nodes, other.nodeCount)), nodeCount(other.nodeCount), depth(other.depth) { NoPool(); }
+	~BVH3() { AlignedFree(nodes); }
+
+	const BVH3& operator=(const BVH3& rhs)
+	{
+		if (this != &rhs)
+		{
+			boxes = rhs.boxes;
+			order = rhs.order;
+			AlignedFree(nodes);
+			nodes = AlignedCopy(rhs.nodes, rhs.nodeCount);
+			nodeCount = rhs.nodeCount;
+			depth = rhs.depth;
+		}
+		return *this;
+	}
+
+	// Replaces every primitive with boxes[0] to boxes[count - 1] (Fit(vertices, 3) is the box of a triangle)
+	void Build(const BOX* boxes, const unsigned& count)
+	{
+		primitives.resize(count);
+		for (unsigned i = 0; i < count; i++)
+		{
+			primitives[i] = PRIMITIVE(boxes[i], i);
+		}
+		BuildNodes();
+	}
+
+#ifdef SVML_USE_THREADS
+	// Build() on a pool: the ranges of more than grain primitives are measured and binned in parallel, which gives
+	// exactly the tree the serial one does
+	void Build(const Bulk::SPAN<const BOX>& boxes, const size_t& grain = Bulk::DEFAULT_GRAIN, Bulk::WORK_POOL& pool = Bulk::DefaultPool())
+	{
+		unsigned count = (unsigned)boxes.count;
+		primitives.resize(count);
+		Bulk::ParallelFor(count, [&](size_t begin, size_t end) { for (size_t i = begin; i < end; i++) { primitives[i] = PRIMITIVE(boxes[i], (unsigned)i); } }, grain, pool);
+		this->grain = grain;
+		this->pool = &pool;
+		BuildNodes();
+		NoPool();
+	}
+#endif
+
+	// Element access
+	unsigned Count() const { return (unsigned)boxes.size(); }
+	unsigned NodeCount() const { return nodeCount; }
+	const NODE* Nodes() const { return nodes; }
+	unsigned Primitive(const unsigned& slot) const { return order[slot]; } // The index of the box in a leaf slot
+	BOX Bounds() const
+	{
+		BOX bounds = BOX::Empty();
+		for (unsigned c = 0; c < 4 && nodeCount > 0; c++)
+		{
+			bounds = Union(bounds, nodes[0].bounds.Get(c));
+		}
+		return bounds;
+	}
+
+	// The nearest hit along the ray origin + distance * direction up to maxDistance: intersect(index, maxDistance) is
+	// called for the primitives whose boxes the ray hits, nearest box first, and when the primitive is hit nearer than
+	// maxDistance lowers maxDistance to the hit and returns true. On a hit, maxDistance is its distance and index its
+	// primitive
+	template <typename INTERSECT> bool IntersectRay(const VECTOR& origin, const VECTOR& direction, INTERSECT& intersect, TYPE& maxDistance, unsigned& index) const
+	{
+		VECTOR inverseDirection = (TYPE)1 / direction;
+		bool hit = false;
+		std::vector< std::pair<TYPE, unsigned> > stack; // Nodes to visit, with the distance the ray enters them at
+		stack.reserve(3 * depth + 1);
+		if (nodeCount > 0)
+		{
+			stack.push_back(std::pair<TYPE, unsigned>(0, 0));
+		}
+		while (!stack.empty())
+		{
+			std::pair<TYPE, unsigned> entry = stack.back();
+			stack.pop_back();
+			if (entry.first > maxDistance)
+			{
+				continue;
+			}
+			const NODE& node = nodes[entry.second];
+			TYPE distances[4];
+			unsigned slots[4];
+			unsigned hits = SortHits(SVML::IntersectRay(node.bounds, origin, inverseDirection, maxDistance, distances), distances, slots);
+
+			// Leaves nearest first, then the internal children pushed so the nearest is visited next
+			for (unsigned h = 0; h < hits; h++)
+			{
+				unsigned c = slots[h];
+				for (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c] && distances[c] <= maxDistance; slot++)
+				{
+					if (intersect(order[slot], maxDistance))
+					{
+						hit = true;
+						index = order[slot];
+					}
+				}
+			}
+			for (unsigned h = hits; h-- > 0;)
+			{
+				if (node.count[slots[h]] == 0)
+				{
+					stack.push_back(std::pair<TYPE, unsigned>(distances[slots[h]], node.child[slots[h]]));
+				}
+			}
+		}
+		return hit;
+	}
+
+	// Appends the indices of the boxes that overlap box (touching counts) to found, and returns how many there were
+	unsigned QueryBox(const BOX& box, std::vector<unsigned>& found) const
+	{
+		size_t before = found.size();
+		std::vector<unsigned> stack;
+		stack.reserve(3 * depth + 1);
+		if (nodeCount > 0)
+		{
+			stack.push_back(0);
+		}
+		while (!stack.empty())
+		{
+			const NODE& node = nodes[stack.back()];
+			stack.pop_back();
+			for (unsigned c = 0; c < 4; c++)
+			{
+				if (!Overlaps(node.bounds.Get(c), box))
+				{
+					continue;
+				}
+				if (node.count[c] == 0)
+				{
+					stack.push_back(node.child[c]);
+				}
+				for (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c]; slot++)
+				{
+					if (Overlaps(boxes[slot], box))
+					{
+						found.push_back(order[slot]);
+					}
+				}
+			}
+		}
+		return (unsigned)(found.size() - before);
+	}
+
+	// Appends the indices of the boxes within radius of center (inclusive, measured to the nearest point of the box) to
+	// found, and returns how many there were
+	unsigned QueryRadius(const VECTOR& center, const TYPE& radius, std::vector<unsigned>& found) const
+	{
+		size_t before = found.size();
+		TYPE radiusSquared = radius * radius;
+		std::vector<unsigned> stack;
+		stack.reserve(3 * depth + 1);
+		if (nodeCount > 0)
+		{
+			stack.push_back(0);
+		}
+		while (!stack.empty())
+		{
+			const NODE& node = nodes[stack.back()];
+			stack.pop_back();
+			for (unsigned c = 0; c < 4; c++)
+			{
+				if ((node.child[c] == 0 && node.count[c] == 0) || DistanceSquared(node.bounds.Get(c), center) > radiusSquared)
+				{
+					continue;
+				}
+				if (node.count[c] == 0)
+				{
+					stack.push_back(node.child[c]);
+				}
+				for (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c]; slot++)
+				{
+					if (DistanceSquared(boxes[slot], center) <= radiusSquared)
+					{
+						found.push_back(order[slot]);
+					}
+				}
+			}
+		}
+		return (unsigned)(found.size() - before);
+	}
+
+	// Appends the indices of the k boxes nearest to center (0 for those containing it) to found, nearest first (the
+	// lower index first among equally near ones), and returns how many there were: k, or Count() if that is less
+	unsigned QueryNearest(const VECTOR& center, const unsigned& k, std::vector<unsigned>& found) const
+	{
+		if (k == 0 || nodeCount == 0)
+		{
+			return 0;
+		}
+		std::vector<CANDIDATE> nearest; // Max-heap of the nearest so far
+		nearest.reserve(k + 1);
+		std::vector<CANDIDATE> stack; // Nodes to visit, with the squared distance to their boxes
+		stack.reserve(3 * depth + 1);
+		stack.push_back(CANDIDATE(0, 0));
+		while (!stack.empty())
+		{
+			CANDIDATE entry = stack.back();
+			stack.pop_back();
+			if (nearest.size() == k && entry.first > nearest.front().first)
+			{
+				continue;
+			}
+			const NODE& node = nodes[entry.second];
+			TYPE distances[4];
+			unsigned slots[4];
+			unsigned used = 0;
+			for (unsigned c = 0; c < 4; c++)
+			{
+				if (node.child[c] != 0 || node.count[c] != 0)
+				{
+					distances[c] = DistanceSquared(node.bounds.Get(c), center);
+					used |= 1u << c;
+				}
+			}
+			unsigned children = SortHits(used, distances, slots);
+			for (unsigned h = 0; h < children; h++)
+			{
+				unsigned c = slots[h];
+				for (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c]; slot++)
+				{
+					KeepNearest(nearest, k, CANDIDATE(DistanceSquared(boxes[slot], center), order[slot]));
+				}
+			}
+			for (unsigned h = children; h-- > 0;)
+			{
+				if (node.count[slots[h]] == 0)
+				{
+					stack.push_back(CANDIDATE(distances[slots[h]], node.child[slots[h]]));
+				}
+			}
+		}
+		std::sort_heap(nearest.begin(), nearest.end());
+		for (unsigned n = 0; n < nearest.size(); n++)
+		{
+			found.push_back(nearest[n].second);
+		}
+		return (unsigned)nearest.size();
+	}
+
+private:
+	typedef std::pair<typename ScalarType<TYPE>::type, unsigned> CANDIDATE;
+
+	// Primitives first to last - 1, their bounds and the bounds of their centroids, and whether they
+	// become a leaf or else where they split: bins 0 to bin on axis go left (axis 3 splits them in half)
+	struct RANGE
+	{
+		unsigned first, last;
+		BOX bounds, centroids;
+		bool leaf;
+		unsigned axis, bin;
+	};
+
+	// Primitives and bounds per bin, on each axis (the bounds of empty bins are left unset)
+	struct BINS
+	{
+		BOX bounds[3][BVH_BINS];
+		unsigned counts[3][BVH_BINS];
+
+		BINS() { memset(counts, 0, sizeof(counts)); }
+		void Add(const unsigned& axis, const unsigned& bin, const BOX& box, const unsigned& count)
+		{
+			bounds[axis][bin] = (counts[axis][bin] > 0) ? Union(bounds[axis][bin], box) : box;
+			counts[axis][bin] += count;
+		}
+		void Add(const BINS& other) { for (unsigned axis = 0; axis < 3; axis++) { for (unsigned bin = 0; bin < BVH_BINS; bin++) { if (other.counts[axis][bin] > 0) { Add(axis, bin, other.bounds[axis][bin], other.counts[axis][bin]); } } } }
+	};
+
+	// A box being built into the tree, with its centroid and index
+	struct PRIMITIVE
+	{
+		BOX box;
+		VECTOR centroid;
+		unsigned index;
+
+		PRIMITIVE() {}
+		PRIMITIVE(const BOX& box, const unsigned& index) : box(box), centroid(Center(box)), index(index) {}
+	};
+
+	// Whether a primitive goes to the left of a range's split
+	struct LEFT_OF_SPLIT
+	{
+		unsigned axis, bin;
+		TYPE minimum, scale;
+
+		LEFT_OF_SPLIT(const RANGE& range) : axis(range.axis), bin(range.bin), minimum(range.centroids.minimum.Component(range.axis)), scale((TYPE)BVH_BINS / Size(range.centroids).Component(range.axis)) {}
+		bool operator()(const PRIMITIVE& primitive) const { return BvhBin(primitive.centroid.Component(axis), minimum, scale) <= bin; }
+	};
+
+	void NoPool()
+	{
+#ifdef SVML_USE_THREADS
+		pool = 0;
+#endif
+	}
+
+	// The set bits of hits, as slots in order of distance (then slot), and how many there are
+	static unsigned SortHits(const unsigned& hits, const TYPE distances[4], unsigned slots[4])
+	{
+		unsigned count = 0;
+		for (unsigned c = 0; c < 4; c++)
+		{
+			if ((hits >> c) & 1)
+			{
+				unsigned h = count++;
+				for (; h > 0 && distances[slots[h - 1]] > distances[c]; h--)
+				{
+					slots[h] = slots[h - 1];
+				}
+				slots[h] = c;
+			}
+		}
+		return count;
+	}
+
+	void BuildNodes()
+	{
+		std::vector<NODE> built;
+		depth = 0;
+		if (!primitives.empty())
+		{
+			RANGE root;
+			root.first = 0;
+			root.last = (unsigned)primitives.size();
+			Evaluate(root);
+			BuildNode(built, root, 1);
+		}
+		AlignedFree(nodes);
+		nodes = AlignedCopy(built.empty() ? 0 : &built[0], (unsigned)built.size());
+		nodeCount = (unsigned)built.size();
+
+		boxes.resize(primitives.size());
+		order.resize(primitives.size());
+		for (unsigned slot = 0; slot < primitives.size(); slot++)
+		{
+			boxes[slot] = primitives[slot].box;
+			order[slot] = primitives[slot].index;
+		}
+		std::vector<PRIMITIVE>().swap(primitives);
+	}
+
+	// Splits the largest of the child ranges that are not leaves until there are four children
+	unsigned BuildNode(std::vector<NODE>& built, const RANGE& range, const unsigned& level)
+	{
+		unsigned index = (unsigned)built.size();
+		built.push_back(NODE());
+		depth = std::max(depth, level);
+		RANGE children[4];
+		children[0] = range;
+		unsigned used = 1;
+		while (used < 4)
+		{
+			int largest = -1;
+			for (unsigned c = 0; c < used; c++)
+			{
+				if (!children[c].leaf && (largest < 0 || SurfaceArea(children[c].bounds) > SurfaceArea(children[largest].bounds)))
+				{
+					largest = (int)c;
+				}
+			}
+			if (largest < 0)
+			{
+				break;
+			}
+			Split(children[largest], children[used]);
+			used++;
+		}
+		NODE node;
+		for (unsigned c = 0; c < used; c++)
+		{
+			node.bounds.Set(c, children[c].bounds);
+			node.child[c] = children[c].leaf ? children[c].first : BuildNode(built, children[c], level + 1);
+			node.count[c] = children[c].leaf ? children[c].last - children[c].first : 0;
+		}
+		built[index] = node;
+		return index;
+	}
+
+	// Moves the primitives right of range's split to right, and evaluates both halves
+	void Split(RANGE& range, RANGE& right)
+	{
+		unsigned middle = range.first + (range.last - range.first) / 2;
+		if (range.axis < 3)
+		{
+			middle = (unsigned)(std::partition(primitives.begin() + range.first, primitives.begin() + range.last, LEFT_OF_SPLIT(range)) - primitives.begin());
+		}
+		right.first = middle;
+		right.last = range.last;
+		range.last = middle;
+		Evaluate(range);
+		Evaluate(right);
+	}
+
+	// Measures a range and decides its split: the binned split of the least surface area heuristic cost (each side's
+	// surface area times its primitives), or a leaf when it is small and that costs less
+	void Evaluate(RANGE& range)
+	{
+		unsigned count = range.last - range.first;
+		Measure(range);
+		range.leaf = count <= 1;
+		range.axis = 3;
+		range.bin = 0;
+		if (range.leaf)
+		{
+			return;
+		}
+		BINS bins = Bin(range);
+		VECTOR extent = Size(range.centroids);
+		TYPE best = 0;
+		for (unsigned axis = 0; axis < 3; axis++)
+		{
+			if (!(extent.Component(axis) > 0))
+			{
+				continue;
+			}
+			TYPE rightCosts[BVH_BINS];
+			BOX side = BOX::Empty();
+			unsigned sideCount = 0;
+			TYPE sideCost = 0;
+			for (unsigned bin = BVH_BINS - 1; bin > 0; bin--)
+			{
+				if (bins.counts[axis][bin] > 0)
+				{
+					side = Union(side, bins.bounds[axis][bin]);
+					sideCount += bins.counts[axis][bin];
+					sideCost = SurfaceArea(side) * (TYPE)sideCount;
+				}
+				rightCosts[bin] = sideCost;
+			}
+			side = BOX::Empty();
+			sideCount = 0;
+			for (unsigned bin = 0; bin + 1 < BVH_BINS; bin++)
+			{
+				if (bins.counts[axis][bin] == 0)
+				{
+					continue; // The same split as the last bin's
+				}
+				side = Union(side, bins.bounds[axis][bin]);
+				sideCount += bins.counts[axis][bin];
+				if (sideCount == count)
+				{
+					continue;
+				}
+				TYPE cost = SurfaceArea(side) * (TYPE)sideCount + rightCosts[bin + 1];
+				if (range.axis == 3 || cost < best)
+				{
+					best = cost;
+					range.axis = axis;
+					range.bin = bin;
+				}
+			}
+		}
+
+		// Relative to the cost of intersecting a primitive, visiting a node costs one as well
+		TYPE area = SurfaceArea(range.bounds);
+		if (count <= BVH_MAX_LEAF)
+		{
+			range.leaf = range.axis == 3 || area * (TYPE)count <= area + best;
+		}
+	}
+
+	void Measure(RANGE& range) const
+	{
+#ifdef SVML_USE_THREADS
+		if (pool != 0 && range.last - range.first > grain)
+		{
+			typedef std::pair<BOX, BOX> BOUNDS;
+			BOUNDS measured = Bulk::ReduceChunks(range.last - range.first, BOUNDS(BOX::Empty(), BOX::Empty()), [&](size_t begin, size_t end)
+			{
+				BOUNDS chunk(BOX::Empty(), BOX::Empty());
+				for (size_t i = range.first + begin; i < range.first + end; i++)
+				{
+					chunk.first = Union(chunk.first, primitives[i].box);
+					chunk.second = Union(chunk.second, primitives[i].centroid);
+				}
+				return chunk;
+			}, [](const BOUNDS& a, const BOUNDS& b) { return BOUNDS(Union(a.first, b.first), Union(a.second, b.second)); }, grain, *pool);
+			range.bounds = measured.first;
+			range.centroids = measured.second;
+			return;
+		}
+#endif
+		range.bounds = range.centroids = BOX::Empty();
+		for (unsigned i = range.first; i < range.last; i++)
+		{
+			range.bounds = Union(range.bounds, primitives[i].box);
+			range.centroids = Union(range.centroids, primitives[i].centroid);
+		}
+	}
+
+	void BinRange(BINS& bins, const RANGE& range, const unsigned& first, const unsigned& last) const
+	{
+		VECTOR extent = Size(range.centroids);
+		for (unsigned axis = 0; axis < 3; axis++)
+		{
+			if (!(extent.Component(axis) > 0))
+			{
+				continue;
+			}
+			TYPE minimum = range.centroids.minimum.Component(axis);
+			TYPE scale = (TYPE)BVH_BINS / extent.Component(axis);
+			for (unsigned i = first; i < last; i++)
+			{
+				bins.Add(axis, BvhBin(primitives[i].centroid.Component(axis), minimum, scale), primitives[i].box, 1);
+			}
+		}
+	}
+
+	BINS Bin(const RANGE& range) const
+	{
+#ifdef SVML_USE_THREADS
+		if (pool != 0 && range.last - range.first > grain)
+		{
+			return Bulk::ReduceChunks(range.last - range.first, BINS(), [&](size_t begin, size_t end)
+			{
+				BINS chunk;
+				BinRange(chunk, range, range.first + (unsigned)begin, range.first + (unsigned)end);
+				return chunk;
+			}, [](BINS a, const BINS& b) { a.Add(b); return a; }, grain, *pool);
+		}
+#endif
+		BINS bins;
+		BinRange(bins, range, range.first, range.last);
+		return bins;
+	}
+
+	std::vector<BOX> boxes; // In leaf order
+	std::vector<unsigned> order; // Of boxes[slot], given to Build()
+	std::vector<PRIMITIVE> primitives; // While building
+	NODE* nodes;
+	unsigned nodeCount;
+	unsigned depth; // Levels of nodes
+#ifdef SVML_USE_THREADS
+	Bulk::WORK_POOL* pool; // While building, when the pool builds it
+	size_t grain;
+#endif
+};
+
+//----------------------------------------------------------------------
+// 
+// Sec. 18 - Binary files of vectors
+// 
+//----------------------------------------------------------------------
+
+#ifdef SVML_USE_FILES
+// Version of the format VECTOR_FILE_WRITER writes (VECTOR_FILE reads this one and earlier), and the bytes before the
+// first vector, so vectors start on a cache line of the mapping
+const unsigned VECTOR_FILE_VERSION = 1;
+const unsigned VECTOR_FILE_HEADER_BYTES = 64;
+
+// Layouts
+const unsigned VECTOR_FILE_AOS = 0; // Whole vectors one after another, as they are in memory (SSE vec3 keeps its fourth lane)
+const unsigned VECTOR_FILE_SOA = 1; // Every x, then every y and so on, each array starting on a 64-byte boundary
+
+// Component kinds (VECTOR_FILE_NATIVE asks a writer for the vectors' own)
+const unsigned VECTOR_FILE_NATIVE = 0;
+const unsigned VECTOR_FILE_FLOAT32 = 1;
+const unsigned VECTOR_FILE_FLOAT64 = 2;
+const unsigned VECTOR_FILE_INT32 = 3;
+const unsigned VECTOR_FILE_FLOAT16 = 4; // HALF
+const unsigned VECTOR_FILE_BFLOAT16 = 5;
+const unsigned VECTOR_FILE_FIXED = 6; // FIXED's raw Q16.16 int32_t
+
+// Vectors written in blocks of this many, when they have to be converted or split into components first
+const unsigned VECTOR_FILE_BLOCK = 256;
+
+// Everything before the vectors. Multibyte fields and components are in the writer's byte order, which byteOrder
+// records: 0x0102 as written, so it reads 0x0201 on a machine of the other order
+struct VECTOR_FILE_HEADER
+{
+	char magic[4]; // "SVML"
+	uint16_t version;
+	uint16_t byteOrder;
+	uint64_t count;
+	uint8_t kind;
+	uint8_t dimension;
+	uint8_t layout;
+	uint8_t stride; // Bytes from one vector to the next in AOS files
+	uint8_t reserved[44];
+};
+
+// Kind of components of TYPE (there is none for other types, which can't be stored)
+template <typename TYPE> struct VectorFileKind;
+template <> struct VectorFileKind<float> { enum { value = VECTOR_FILE_FLOAT32 }; };
+template <> struct VectorFileKind<double> { enum { value = VECTOR_FILE_FLOAT64 }; };
+template <> struct VectorFileKind<int> { enum { value = VECTOR_FILE_INT32 }; };
+template <> struct VectorFileKind<HALF> { enum { value = VECTOR_FILE_FLOAT16 }; };
+template <> struct VectorFileKind<BFLOAT16> { enum { value = VECTOR_FILE_BFLOAT16 }; };
+template <> struct VectorFileKind<FIXED> { enum { value = VECTOR_FILE_FIXED }; };
+
+// Bytes of a component of kind (0 for no kind)
+inline unsigned VectorFileComponentBytes(const unsigned& kind)
+{
+	static const unsigned bytes[7] = { 0, 4, 8, 4, 2, 2, 4 };
+	return (kind < 7) ? bytes[kind] : 0;
+}
+
+// Offset of the array of component axis in a SOA file of count components of kind
+inline uint64_t VectorFileArrayOffset(const uint64_t& count, const unsigned& kind, const unsigned& axis)
+{
+	uint64_t arrayBytes = (count * VectorFileComponentBytes(kind) + SOA_ALIGNMENT - 1) / SOA_ALIGNMENT * SOA_ALIGNMENT;
+	return VECTOR_FILE_HEADER_BYTES + axis * arrayBytes;
+}
+
+// value with its bytes reversed
+template <typename TYPE> TYPE VectorFileSwap(const TYPE& value)
+{
+	unsigned char bytes[sizeof(TYPE)];
+	memcpy(bytes, &value, sizeof(TYPE));
+	std::reverse(bytes, bytes + sizeof(TYPE));
+	TYPE swapped;
+	memcpy(&swapped, bytes, sizeof(TYPE));
+	return swapped;
+}
+
+// A component as a double, which holds every kind exactly
+template <typename TYPE> double VectorFileValue(const TYPE& value) { return (double)value; }
+inline double VectorFileValue(const FIXED& value) { return value.ToDouble(); }
+
+// The component of kind at bytes, reversed first when swap is set
+inline double VectorFileDecode(const unsigned char* bytes, const unsigned& kind, const bool& swap)
+{
+	unsigned char value[8];
+	unsigned size = VectorFileComponentBytes(kind);
+	for (unsigned i = 0; i < size; i++)
+	{
+		value[i] = bytes[swap ? size - 1 - i : i];
+	}
+	float single;
+	double wide;
+	int32_t integer;
+	uint16_t bits;
+	switch (kind)
+	{
+		case VECTOR_FILE_FLOAT32: memcpy(&single, value, 4); return single;
+		case VECTOR_FILE_FLOAT64: memcpy(&wide, value, 8); return wide;
+		case VECTOR_FILE_INT32: memcpy(&integer, value, 4); return integer;
+		case VECTOR_FILE_FLOAT16: memcpy(&bits, value, 2); return HalfBitsToFloat(bits);
+		case VECTOR_FILE_BFLOAT16: memcpy(&bits, value, 2); return Bfloat16BitsToFloat(bits);
+		case VECTOR_FILE_FIXED: memcpy(&integer, value, 4); return integer / 65536.0;
+	}
+	return 0;
+}
+
+// Seeks file to offset (past 2 GB where the platform can)
+inline bool VectorFileSeek(FILE* file, const uint64_t& offset)
+{
+#if defined(_WIN32)
+	return _fseeki64(file, (__int64)offset, SEEK_SET) == 0;
+#elif defined(SVML_HAS_MMAP)
+	return fseeko(file, (off_t)offset, SEEK_SET) == 0;
+#else
+	return fseek(file, (long)offset, SEEK_SET) == 0;
+#endif
+}
+
+// Dimension of VECTOR, and a VECTOR from the doubles of its components
+template <typename VECTOR> struct VectorFileDimension;
+template <typename TYPE> struct VectorFileDimension< VECTOR2<TYPE> > { enum { value = 2 }; };
+template <typename TYPE> void VectorFromComponents(VECTOR2<TYPE>& out, const double* values) { out = VECTOR2<TYPE>((TYPE)values[0], (TYPE)values[1]); }
+template <typename TYPE> struct VectorFileDimension< VECTOR3<TYPE> > { enum { value = 3 }; };
+template <typename TYPE> void VectorFromComponents(VECTOR3<TYPE>& out, const double* values) { out = VECTOR3<TYPE>((TYPE)values[0], (TYPE)values[1], (TYPE)values[2]); }
+template <typename TYPE> struct VectorFileDimension< VECTOR4<TYPE> > { enum { value = 4 }; };
+template <typename TYPE> void VectorFromComponents(VECTOR4<TYPE>& out, const double* values) { out = VECTOR4<TYPE>((TYPE)values[0], (TYPE)values[1], (TYPE)values[2], (TYPE)values[3]); }
+
+// Streams vectors of VECTOR to a file: Write() blocks of them, as many times as needed, then Close() (the destructor
+// closes too). kind VECTOR_FILE_FLOAT16 or VECTOR_FILE_BFLOAT16 halves the vectors on the way out. A SOA file takes
+// its count up front, since each component array starts where the one before it ends
+template <typename VECTOR>
+class VECTOR_FILE_WRITER
+{
+public:
+	typedef typename ComponentType<VECTOR>::type TYPE;
+
+	// Constructors
+	VECTOR_FILE_WRITER(const char* path, const unsigned& layout = VECTOR_FILE_AOS, const unsigned& kind = VECTOR_FILE_NATIVE, const uint64_t& count = 0) : file(0), written(0), failed(false)
+	{
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, "SVML", 4);
+		header.version = VECTOR_FILE_VERSION;
+		header.byteOrder = 0x0102;
+		header.count = (layout == VECTOR_FILE_SOA) ? count : 0;
+		header.kind = (uint8_t)((kind == VECTOR_FILE_NATIVE) ? (unsigned)VectorFileKind<TYPE>::value : kind);
+		header.dimension = (uint8_t)VectorFileDimension<VECTOR>::value;
+		header.layout = (uint8_t)layout;
+		header.stride = (uint8_t)(Native() ? sizeof(VECTOR) : header.dimension * VectorFileComponentBytes(header.kind));
+		if (!Native() && header.kind != VECTOR_FILE_FLOAT16 && header.kind != VECTOR_FILE_BFLOAT16)
+		{
+			FatalError("vector files store the vectors' own components, VECTOR_FILE_FLOAT16 or VECTOR_FILE_BFLOAT16");
+		}
+		file = fopen(path, "wb");
+		failed = (file == 0) || fwrite(&header, sizeof(header), 1, file) != 1;
+	}
+	~VECTOR_FILE_WRITER() { Close(); }
+
+	bool IsOpen() const { return file != 0; }
+	uint64_t Count() const { return written; }
+
+	// Appends vectors[0] to vectors[count - 1]: false if the file didn't open or a write failed (then every later
+	// call fails too), or if a SOA file would pass its count
+	bool Write(const VECTOR* vectors, const size_t& count)
+	{
+		if (file == 0 || failed || (header.layout == VECTOR_FILE_SOA && count > header.count - written))
+		{
+			return false;
+		}
+		if (header.layout == VECTOR_FILE_AOS && Native())
+		{
+			failed = fwrite(vectors, sizeof(VECTOR), count, file) != count;
+		}
+		else
+		{
+			for (size_t first = 0; first < count && !failed; first += VECTOR_FILE_BLOCK)
+			{
+				size_t block = min(count - first, (size_t)VECTOR_FILE_BLOCK);
+				if (header.layout == VECTOR_FILE_AOS)
+				{
+					WriteComponents(vectors + first, block, 0, header.dimension);
+				}
+				for (unsigned axis = 0; axis < header.dimension && header.layout == VECTOR_FILE_SOA; axis++)
+				{
+					uint64_t offset = VectorFileArrayOffset(header.count, header.kind, axis) + (written + first) * VectorFileComponentBytes(header.kind);
+					failed = failed || !VectorFileSeek(file, offset);
+					WriteComponents(vectors + first, block, axis, 1);
+				}
+			}
+		}
+		written += failed ? 0 : count;
+		return !failed;
+	}
+
+	// Finishes the file: false if it didn't open, anything failed to write or a SOA file got fewer vectors than its count
+	bool Close()
+	{
+		if (file == 0)
+		{
+			return false;
+		}
+		if (header.layout == VECTOR_FILE_AOS)
+		{
+			header.count = written;
+			failed = failed || !VectorFileSeek(file, 0) || fwrite(&header, sizeof(header), 1, file) != 1;
+		}
+		failed = failed || written != header.count;
+		failed = (fclose(file) != 0) || failed;
+		file = 0;
+		return !failed;
+	}
+
+private:
+	VECTOR_FILE_HEADER header;
+	FILE* file;
+	uint64_t written;
+	bool failed;
+
+	VECTOR_FILE_WRITER(const VECTOR_FILE_WRITER&);
+	const VECTOR_FILE_WRITER& operator=(const VECTOR_FILE_WRITER&);
+
+	bool Native() const { return header.kind == VectorFileKind<TYPE>::value; }
+
+	// Components firstAxis to firstAxis + axes - 1 of count vectors (no more than VECTOR_FILE_BLOCK), interleaved, in
+	// the file's kind
+	void WriteComponents(const VECTOR* vectors, const size_t& count, const unsigned& firstAxis, const unsigned& axes)
+	{
+		size_t components = count * axes;
+		if (Native())
+		{
+			TYPE values[VECTOR_FILE_BLOCK * 4];
+			for (size_t i = 0; i < components; i++)
+			{
+				values[i] = vectors[i / axes].Component(firstAxis + (unsigned)(i % axes));
+			}
+			failed = failed || fwrite(values, sizeof(TYPE), components, file) != components;
+			return;
+		}
+		float values[VECTOR_FILE_BLOCK * 4];
+		for (size_t i = 0; i < components; i++)
+		{
+			values[i] = (float)VectorFileValue(vectors[i / axes].Component(firstAxis + (unsigned)(i % axes)));
+		}
+		if (header.kind == VECTOR_FILE_FLOAT16)
+		{
+			HALF halves[VECTOR_FILE_BLOCK * 4];
+			ConvertComponents(halves, values, components);
+			failed = failed || fwrite(halves, sizeof(HALF), components, file) != components;
+		}
+		else
+		{
+			BFLOAT16 bfloats[VECTOR_FILE_BLOCK * 4];
+			ConvertComponents(bfloats, values, components);
+			failed = failed || fwrite(bfloats, sizeof(BFLOAT16), components, file) != components;
+		}
+	}
+};
+
+// A vector file mapped into memory (read into aligned memory where there's no mmap()). When it holds exactly the
+// type asked for, in this machine's byte order, Vectors() and the views point straight into the mapping, with no
+// copy or parse step; Read() converts any file. The mapping is private: changes through them never reach the file
+class VECTOR_FILE
+{
+public:
+	// Constructors
+	VECTOR_FILE() : bytes(0), size(0) { Close(); }
+	explicit VECTOR_FILE(const char* path) : bytes(0), size(0) { Open(path); }
+	~VECTOR_FILE() { Close(); }
+
+	// Maps path: false if it's missing, not a vector file, of a later version or shorter than its header says
+	bool Open(const char* path)
+	{
+		Close();
+		if (!Map(path) || size < sizeof(header))
+		{
+			Close();
+			return false;
+		}
+		memcpy(&header, bytes, sizeof(header));
+		swapped = header.byteOrder == 0x0201;
+		if (swapped)
+		{
+			header.version = VectorFileSwap(header.version);
+			header.count = VectorFileSwap(header.count);
+		}
+		unsigned componentBytes = VectorFileComponentBytes(header.kind);
+		bool valid = memcmp(header.magic, "SVML", 4) == 0 && (header.byteOrder == 0x0102 || swapped) && header.version >= 1 && header.version <= VECTOR_FILE_VERSION &&
+		             componentBytes != 0 && header.dimension >= 2 && header.dimension <= 4 && header.layout <= VECTOR_FILE_SOA &&
+		             (header.layout == VECTOR_FILE_SOA || header.stride >= header.dimension * componentBytes);
+		if (!valid || header.count > (size - VECTOR_FILE_HEADER_BYTES) / componentBytes || End() > size)
+		{
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	void Close()
+	{
+#ifdef SVML_HAS_MMAP
+		if (bytes != 0)
+		{
+			munmap(bytes, (size_t)size);
+		}
+#else
+		AlignedFree(bytes);
+#endif
+		bytes = 0;
+		size = 0;
+		swapped = false;
+		memset(&header, 0, sizeof(header));
+	}
+
+	bool IsOpen() const { return bytes != 0; }
+	size_t Count() const { return (size_t)header.count; }
+	unsigned Dimension() const { return header.dimension; }
+	unsigned Kind() const { return header.kind; }
+	unsigned Layout() const { return header.layout; }
+	unsigned Stride() const { return header.stride; }
+	bool NativeByteOrder() const { return !swapped; }
+
+	// The vectors, in the mapping, if this is an AOS file of VECTOR (same components, dimension and size) in this
+	// machine's byte order: 0 otherwise
+	template <typename VECTOR> VECTOR* Vectors() const
+	{
+		bool same = Holds<typename ComponentType<VECTOR>::type>(VECTOR_FILE_AOS) && header.dimension == VectorFileDimension<VECTOR>::value && header.stride == sizeof(VECTOR);
+		return same ? (VECTOR*)(bytes + VECTOR_FILE_HEADER_BYTES) : 0;
+	}
+
+	// The array of component axis, in the mapping, if this is a SOA file of TYPE in this machine's byte order: 0 otherwise
+	template <typename TYPE> TYPE* Components(const unsigned& axis) const
+	{
+		return (Holds<TYPE>(VECTOR_FILE_SOA) && axis < header.dimension) ? (TYPE*)(bytes + VectorFileArrayOffset(header.count, header.kind, axis)) : 0;
+	}
+
+	// View of a SOA file of 2D vectors of TYPE, in the mapping: empty (no arrays, count 0) otherwise
+	template <typename TYPE> VECTOR2_SOA_VIEW<TYPE> View2() const
+	{
+		bool same = header.dimension == 2 && Components<TYPE>(0) != 0;
+		return VECTOR2_SOA_VIEW<TYPE>(same ? Components<TYPE>(0) : 0, same ? Components<TYPE>(1) : 0, same ? (unsigned)header.count : 0);
+	}
+
+	// View of a SOA file of 3D vectors of TYPE, in the mapping: empty (no arrays, count 0) otherwise
+	template <typename TYPE> VECTOR3_SOA_VIEW<TYPE> View3() const
+	{
+		bool same = header.dimension == 3 && Components<TYPE>(0) != 0;
+		return VECTOR3_SOA_VIEW<TYPE>(same ? Components<TYPE>(0) : 0, same ? Components<TYPE>(1) : 0, same ? Components<TYPE>(2) : 0, same ? (unsigned)header.count : 0);
+	}
+
+	// View of a SOA file of 4D vectors of TYPE, in the mapping: empty (no arrays, count 0) otherwise
+	template <typename TYPE> VECTOR4_SOA_VIEW<TYPE> View4() const
+	{
+		bool same = header.dimension == 4 && Components<TYPE>(0) != 0;
+		return VECTOR4_SOA_VIEW<TYPE>(same ? Components<TYPE>(0) : 0, same ? Components<TYPE>(1) : 0, same ? Components<TYPE>(2) : 0, same ? Components<TYPE>(3) : 0, same ? (unsigned)header.count : 0);
+	}
+
+	// Vectors first to first + count - 1 into out, whatever the file's layout, kind and byte order: false (and out
+	// unchanged) if out's vectors have another dimension or the range passes Count()
+	template <typename VECTOR> bool Read(VECTOR* out, const size_t& first, const size_t& count) const
+	{
+		if (!IsOpen() || header.dimension != VectorFileDimension<VECTOR>::value || first > header.count || count > header.count - first)
+		{
+			return false;
+		}
+		if (Vectors<VECTOR>() != 0)
+		{
+			memcpy(out, Vectors<VECTOR>() + first, count * sizeof(VECTOR));
+			return true;
+		}
+		double values[4];
+		for (size_t i = 0; i < count; i++)
+		{
+			for (unsigned axis = 0; axis < header.dimension; axis++)
+			{
+				values[axis] = VectorFileDecode(Address(first + i, axis), header.kind, swapped);
+			}
+			VectorFromComponents(out[i], values);
+		}
+		return true;
+	}
+
+private:
+	VECTOR_FILE_HEADER header;
+	unsigned char* bytes;
+	uint64_t size;
+	bool swapped;
+
+	VECTOR_FILE(const VECTOR_FILE&);
+	const VECTOR_FILE& operator=(const VECTOR_FILE&);
+
+	// Maps (or reads) the whole of path into bytes
+	bool Map(const char* path)
+	{
+#ifdef SVML_HAS_MMAP
+		int descriptor = open(path, O_RDONLY);
+		if (descriptor < 0)
+		{
+			return false;
+		}
+		struct stat status;
+		if (fstat(descriptor, &status) == 0 && status.st_size > 0)
+		{
+			void* mapping = mmap(0, (size_t)status.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+			if (mapping != MAP_FAILED)
+			{
+				bytes = (unsigned char*)mapping;
+				size = (uint64_t)status.st_size;
+			}
+		}
+		close(descriptor);
+#else
+		FILE* file = fopen(path, "rb");
+		if (file == 0)
+		{
+			return false;
+		}
+		long length = (fseek(file, 0, SEEK_END) == 0) ? ftell(file) : -1;
+		if (length > 0 && fseek(file, 0, SEEK_SET) == 0)
+		{
+			bytes = (unsigned char*)AlignedAllocate((size_t)length);
+			size = (uint64_t)length;
+			if (bytes != 0 && fread(bytes, 1, (size_t)length, file) != (size_t)length)
+			{
+				Close();
+			}
+		}
+		fclose(file);
+#endif
+		return bytes != 0;
+	}
+
+	// One past the last byte of the vectors
+	uint64_t End() const
+	{
+		if (header.layout == VECTOR_FILE_AOS)
+		{
+			return VECTOR_FILE_HEADER_BYTES + header.count * header.stride;
+		}
+		return VectorFileArrayOffset(header.count, header.kind, header.dimension - 1) + header.count * VectorFileComponentBytes(header.kind);
+	}
+
+	// Whether the vectors are components of TYPE in layout, in this machine's byte order
+	template <typename TYPE> bool Holds(const unsigned& layout) const { return IsOpen() && !swapped && header.layout == layout && header.kind == (unsigned)VectorFileKind<TYPE>::value; }
+
+	// Component axis of vector index
+	const unsigned char* Address(const size_t& index, const unsigned& axis) const
+	{
+		if (header.layout == VECTOR_FILE_AOS)
+		{
+			return bytes + VECTOR_FILE_HEADER_BYTES + index * header.stride + axis * VectorFileComponentBytes(header.kind);
+		}
+		return bytes + VectorFileArrayOffset(header.count, header.kind, axis) + index * VectorFileComponentBytes(header.kind);
+	}
+};
+
+#endif // SVML_USE_FILES
+
+//----------------------------------------------------------------------
+// 
+// Sec. 19 - Text formatting and parsing without allocation
+// 
+//----------------------------------------------------------------------
+
+// Every text function takes first as 0 to mean an earlier step failed, and passes it on, so calls chain without checks
+
+// Copies text, length characters, to first: one past the last character, or 0 if it doesn't fit in [first, last)
+inline char* CharsCopy(char* first, char* last, const char* text, const size_t& length)
+{
+	if (first == 0 || (size_t)(last - first) < length)
+	{
+		return 0;
+	}
+	memcpy(first, text, length);
+	return first + length;
+}
+
+// Shortest text that reads back as value (std::to_chars() where the library has it; otherwise the fewest sprintf()
+// digits, from all a float or double always keeps, that strtod() reads back): one past the last character, or 0 if
+// it doesn't fit in [first, last)
+inline char* ComponentToChars(char* first, char* last, const float& value)
+{
+	if (first == 0)
+	{
+		return 0;
+	}
+#ifdef SVML_HAS_TO_CHARS
+	std::to_chars_result result = std::to_chars(first, last, value);
+	return (result.ec == std::errc()) ? result.ptr : 0;
+#else
+	char buffer[32];
+	int length = 0;
+	for (int precision = 6; precision <= 9; precision++)
+	{
+		length = sprintf(buffer, "%.*g", precision, (double)value);
+		if ((float)strtod(buffer, 0) == value || value != value)
+		{
+			break;
+		}
+	}
+	return CharsCopy(first, last, buffer, (size_t)length);
+#endif
+}
+inline char* ComponentToChars(char* first, char* last, const double& value)
+{
+	if (first == 0)
+	{
+		return 0;
+	}
+#ifdef SVML_HAS_TO_CHARS
+	std::to_chars_result result = std::to_chars(first, last, value);
+	return (result.ec == std::errc()) ? result.ptr : 0;
+#else
+	char buffer[32];
+	int length = 0;
+	for (int precision = 15; precision <= 17; precision++)
+	{
+		length = sprintf(buffer, "%.*g", precision, (double)value);
+		if (strtod(buffer, 0) == value || value != value)
+		{
+			break;
+		}
+	}
+	return CharsCopy(first, last, buffer, (size_t)length);
+#endif
+}
+inline char* ComponentToChars(char* first, char* last, const int& value)
+{
+	if (first == 0)
+	{
+		return 0;
+	}
+	char buffer[12];
+	char* digit = buffer + 12;
+	unsigned magnitude = (value < 0) ? 0u - (unsigned)value : (unsigned)value;
+	do
+	{
+		*--digit = (char)('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
+	if (value < 0)
+	{
+		*--digit = '-';
+	}
+	return CharsCopy(first, last, digit, (size_t)(buffer + 12 - digit));
+}
+inline char* ComponentToChars(char* first, char* last, const HALF& value) { return ComponentToChars(first, last, (float)value); }
+inline char* ComponentToChars(char* first, char* last, const BFLOAT16& value) { return ComponentToChars(first, last, (float)value); }
+inline char* ComponentToChars(char* first, char* last, const FIXED& value) { return ComponentToChars(first, last, value.ToDouble()); }
+
+// Skips spaces and tabs
+inline const char* CharsSkipBlanks(const char* first, const char* last)
+{
+	while (first != 0 && first != last && (*first == ' ' || *first == '\t'))
+	{
+		first++;
+	}
+	return first;
+}
+
+// Skips spaces and tabs, then character: one past it, or 0 if it isn't next
+inline const char* CharsExpect(const char* first, const char* last, const char& character)
+{
+	first = CharsSkipBlanks(first, last);
+	return (first != 0 && first != last && *first == character) ? first + 1 : 0;
+}
+
+// Skips a separator between components: at least one space or tab if separator is either, or else separator with any
+// spaces and tabs around it
+inline const char* CharsSeparator(const char* first, const char* last, const char& separator)
+{
+	if (separator != ' ' && separator != '\t')
+	{
+		return CharsExpect(first, last, separator);
+	}
+	const char* end = CharsSkipBlanks(first, last);
+	return (end != first) ? end : 0;
+}
+
+// Whether character can be part of a number for strtod() (digits, signs, points, exponents, inf and nan)
+inline bool IsNumberChar(const char& character)
+{
+	return (character >= '0' && character <= '9') || (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || character == '.' || character == '+' || character == '-';
+}
+
+// Reads a component, after any spaces and tabs: one past its last character, or 0 if there isn't one (value unchanged)
+inline const char* ComponentFromChars(const char* first, const char* last, float& value)
+{
+	first = CharsSkipBlanks(first, last);
+	if (first == 0)
+	{
+		return 0;
+	}
+#ifdef SVML_HAS_TO_CHARS
+	if (first != last && *first == '+') // from_chars() takes no '+'
+	{
+		first++;
+		if (first != last && *first == '-')
+		{
+			return 0;
+		}
+	}
+	std::from_chars_result result = std::from_chars(first, last, value);
+	return (result.ec == std::errc()) ? result.ptr : 0;
+#else
+	char buffer[64];
+	size_t length = 0;
+	while (first + length != last && length < 63 && IsNumberChar(first[length]))
+	{
+		buffer[length] = first[length];
+		length++;
+	}
+	buffer[length] = 0;
+	char* end;
+	double parsed = strtod(buffer, &end);
+	if (end == buffer)
+	{
+		return 0;
+	}
+	value = (float)parsed;
+	return first + (end - buffer);
+#endif
+}
+inline const char* ComponentFromChars(const char* first, const char* last, double& value)
+{
+	first = CharsSkipBlanks(first, last);
+	if (first == 0)
+	{
+		return 0;
+	}
+#ifdef SVML_HAS_TO_CHARS
+	if (first != last && *first == '+') // from_chars() takes no '+'
+	{
+		first++;
+		if (first != last && *first == '-')
+		{
+			return 0;
+		}
+	}
+	std::from_chars_result result = std::from_chars(first, last, value);
+	return (result.ec == std::errc()) ? result.ptr : 0;
+#else
+	char buffer[64];
+	size_t length = 0;
+	while (first + length != last && length < 63 && IsNumberChar(first[length]))
+	{
+		buffer[length] = first[length];
+		length++;
+	}
+	buffer[length] = 0;
+	char* end;
+	double parsed = strtod(buffer, &end);
+	if (end == buffer)
+	{
+		return 0;
+	}
+	value = parsed;
+	return first + (end - buffer);
+#endif
+}
+inline const char* ComponentFromChars(const char* first, const char* last, int& value)
+{
+	first = CharsSkipBlanks(first, last);
+	if (first == 0 || first == last)
+	{
+		return 0;
+	}
+	bool negative = *first == '-';
+	const char* digit = (negative || *first == '+') ? first + 1 : first;
+	const char* digits = digit;
+	int64_t magnitude = 0;
+	while (digit != last && *digit >= '0' && *digit <= '9' && magnitude <= ((int64_t)1 << 31))
+	{
+		magnitude = magnitude * 10 + (*digit - '0');
+		digit++;
+	}
+	if (digit == digits || magnitude > ((int64_t)1 << 31) - (negative ? 0 : 1))
+	{
+		return 0;
+	}
+	value = (int)(negative ? -magnitude : magnitude);
+	return digit;
+}
+inline const char* ComponentFromChars(const char* first, const char* last, HALF& value)
+{
+	float single;
+	first = ComponentFromChars(first, last, single);
+	if (first != 0)
+	{
+		value = HALF(single);
+	}
+	return first;
+}
+inline const char* ComponentFromChars(const char* first, const char* last, BFLOAT16& value)
+{
+	float single;
+	first = ComponentFromChars(first, last, single);
+	if (first != 0)
+	{
+		value = BFLOAT16(single);
+	}
+	return first;
+}
+inline const char* ComponentFromChars(const char* first, const char* last, FIXED& value)
+{
+	double wide;
+	first = ComponentFromChars(first, last, wide);
+	if (first != 0)
+	{
+		value = FIXED(wide);
+	}
+	return first;
+}
+
+// Skips spaces, tabs and a carriage return: last if nothing else is left before it, 0 otherwise
+inline const char* CharsLineEnd(const char* first, const char* last)
+{
+	first = CharsSkipBlanks(first, last);
+	if (first != 0 && first != last && *first == '\r')
+	{
+		first++;
+	}
+	return (first == last) ? first : 0;
+}
+
+// 2D ToChars(): the vector as ToString() writes it, with each component's shortest round-trip text, into
+// [first, last). One past the last character (there is no terminating 0), or 0 if it doesn't fit
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, char* >::type ToChars(char* first, char* last, const SWIZZLE& vector) { return ToChars(first, last, typename SWIZZLE::PARENT(vector)); }
+template <typename TYPE> char* ToChars(char* first, char* last, const VECTOR2<TYPE>& vector)
+{
+	first = CharsCopy(first, last, "(", 1);
+	first = ComponentToChars(first, last, vector.Component(0));
+	first = CharsCopy(first, last, ", ", 2);
+	first = ComponentToChars(first, last, vector.Component(1));
+	return CharsCopy(first, last, ")", 1);
+}
+
+// 2D FromChars(): reads a vector as ToChars() writes it (spaces optional) from [first, last). One past
+// the ')', or 0 if there isn't such a vector (vector unchanged)
+template <typename TYPE> const char* FromChars(const char* first, const char* last, VECTOR2<TYPE>& vector)
+{
+	TYPE x = TYPE(), y = TYPE();
+	first = CharsExpect(first, last, '(');
+	first = ComponentFromChars(first, last, x);
+	first = CharsExpect(first, last, ',');
+	first = ComponentFromChars(first, last, y);
+	first = CharsExpect(first, last, ')');
+	if (first != 0)
+	{
+		vector = VECTOR2<TYPE>(x, y);
+	}
+	return first;
+}
+
+// 2D FormatLines(): vectors[0] to vectors[count - 1] one per line, as prefix, the components between
+// separators, and '\n' ("v " and ' ' for OBJ vertices, "" and ',' for CSV). One past the last character, or 0
+// if they don't fit in [first, last)
+template <typename TYPE> char* FormatLines(char* first, char* last, const VECTOR2<TYPE>* vectors, const size_t& count, const char& separator = ',', const char* prefix = "")
+{
+	size_t prefixLength = strlen(prefix);
+	for (size_t i = 0; i < count && first != 0; i++)
+	{
+		first = CharsCopy(first, last, prefix, prefixLength);
+		first = ComponentToChars(first, last, vectors[i].Component(0));
+		first = CharsCopy(first, last, &separator, 1);
+		first = ComponentToChars(first, last, vectors[i].Component(1));
+		first = CharsCopy(first, last, "\n", 1);
+	}
+	return first;
+}
+
+// 2D ParseLines(): reads vectors from lines as FormatLines() writes them (\r\n too) into vectors, up to
+// capacity of them, skipping blank lines and lines that don't start with prefix (such as an OBJ file's "vn" and "f"
+// lines). Stops at the first line it can't read, or at last: returns where it stopped, and sets parsed
+template <typename TYPE> const char* ParseLines(const char* first, const char* last, VECTOR2<TYPE>* vectors, const size_t& capacity, size_t& parsed, const char& separator = ',', const char* prefix = "")
+{
+	size_t prefixLength = strlen(prefix);
+	parsed = 0;
+	while (first != last && parsed < capacity)
+	{
+		const char* end = (const char*)memchr(first, '\n', (size_t)(last - first));
+		end = (end != 0) ? end : last;
+		const char* next = (end != last) ? end + 1 : last;
+		if (CharsLineEnd(first, end) != 0 || (size_t)(end - first) < prefixLength || memcmp(first, prefix, prefixLength) != 0)
+		{
+			first = next;
+			continue;
+		}
+		TYPE x = TYPE(), y = TYPE();
+		const char* read = first + prefixLength;
+		read = ComponentFromChars(read, end, x);
+		read = CharsSeparator(read, end, separator);
+		read = ComponentFromChars(read, end, y);
+		if (CharsLineEnd(read, end) == 0)
+		{
+			return first;
+		}
+		vectors[parsed++] = VECTOR2<TYPE>(x, y);
+		first = next;
+	}
+	return first;
+}
+
+// 3D ToChars(): the vector as ToString() writes it, with each component's shortest round-trip text, into
+// [first, last). One past the last character (there is no terminating 0), or 0 if it doesn't fit
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, char* >::type ToChars(char* first, char* last, const SWIZZLE& vector) { return ToChars(first, last, typename SWIZZLE::PARENT(vector)); }
+template <typename TYPE> char* ToChars(char* first, char* last, const VECTOR3<TYPE>& vector)
+{
+	first = CharsCopy(first, last, "(", 1);
+	first = ComponentToChars(first, last, vector.Component(0));
+	first = CharsCopy(first, last, ", ", 2);
+	first = ComponentToChars(first, last, vector.Component(1));
+	first = CharsCopy(first, last, ", ", 2);
+	first = ComponentToChars(first, last, vector.Component(2));
+	return CharsCopy(first, last, ")", 1);
+}
+
+// 3D FromChars(): reads a vector as ToChars() writes it (spaces optional) from [first, last). One past
+// the ')', or 0 if there isn't such a vector (vector unchanged)
+template <typename TYPE> const char* FromChars(const char* first, const char* last, VECTOR3<TYPE>& vector)
+{
+	TYPE x = TYPE(), y = TYPE(), z = TYPE();
+	first = CharsExpect(first, last, '(');
+	first = ComponentFromChars(first, last, x);
+	first = CharsExpect(first, last, ',');
+	first = ComponentFromChars(first, last, y);
+	first = CharsExpect(first, last, ',');
+	first = ComponentFromChars(first, last, z);
+	first = CharsExpect(first, last, ')');
+	if (first != 0)
+	{
+		vector = VECTOR3<TYPE>(x, y, z);
+	}
+	return first;
+}
+
+// 3D FormatLines(): vectors[0] to vectors[count - 1] one per line, as prefix, the components between
+// separators, and '\n' ("v " and ' ' for OBJ vertices, "" and ',' for CSV). One past the last character, or 0
+// if they don't fit in [first, last)
+template <typename TYPE> char* FormatLines(char* first, char* last, const VECTOR3<TYPE>* vectors, const size_t& count, const char& separator = ',', const char* prefix = "")
+{
+	size_t prefixLength = strlen(prefix);
+	for (size_t i = 0; i < count && first != 0; i++)
+	{
+		first = CharsCopy(first, last, prefix, prefixLength);
+		first = ComponentToChars(first, last, vectors[i].Component(0));
+		first = CharsCopy(first, last, &separator, 1);
+		first = ComponentToChars(first, last, vectors[i].Component(1));
+		first = CharsCopy(first, last, &separator, 1);
+		first = ComponentToChars(first, last, vectors[i].Component(2));
+		first = CharsCopy(first, last, "\n", 1);
+	}
+	return first;
+}
+
+// 3D ParseLines(): reads vectors from lines as FormatLines() writes them (\r\n too) into vectors, up to
+// capacity of them, skipping blank lines and lines that don't start with prefix (such as an OBJ file's "vn" and "f"
+// lines). Stops at the first line it can't read, or at last: returns where it stopped, and sets parsed
+template <typename TYPE> const char* ParseLines(const char* first, const char* last, VECTOR3<TYPE>* vectors, const size_t& capacity, size_t& parsed, const char& separator = ',', const char* prefix = "")
+{
+	size_t prefixLength = strlen(prefix);
+	parsed = 0;
+	while (first != last && parsed < capacity)
+	{
+		const char* end = (const char*)memchr(first, '\n', (size_t)(last - first));
+		end = (end != 0) ? end : last;
+		const char* next = (end != last) ? end + 1 : last;
+		if (CharsLineEnd(first, end) != 0 || (size_t)(end - first) < prefixLength || memcmp(first, prefix, prefixLength) != 0)
+		{
+			first = next;
+			continue;
+		}
+		TYPE x = TYPE(), y = TYPE(), z = TYPE();
+		const char* read = first + prefixLength;
+		read = ComponentFromChars(read, end, x);
+		read = CharsSeparator(read, end, separator);
+		read = ComponentFromChars(read, end, y);
+		read = CharsSeparator(read, end, separator);
+		read = ComponentFromChars(read, end, z);
+		if (CharsLineEnd(read, end) == 0)
+		{
+			return first;
+		}
+		vectors[parsed++] = VECTOR3<TYPE>(x, y, z);
+		first = next;
+	}
+	return first;
+}
+
+// 4D ToChars(): the vector as ToString() writes it, with each component's shortest round-trip text, into
+// [first, last). One past the last character (there is no terminating 0), or 0 if it doesn't fit
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, char* >::type ToChars(char* first, char* last, const SWIZZLE& vector) { return ToChars(first, last, typename SWIZZLE::PARENT(vector)); }
+template <typename TYPE> char* ToChars(char* first, char* last, const VECTOR4<TYPE>& vector)
+{
+	first = CharsCopy(first, last, "(", 1);
+	first = ComponentToChars(first, last, vector.Component(0));
+	first = CharsCopy(first, last, ", ", 2);
+	first = ComponentToChars(first, last, vector.Component(1));
+	first = CharsCopy(first, last, ", ", 2);
+	first = ComponentToChars(first, last, vector.Component(2));
+	first = CharsCopy(first, last, ", ", 2);
+	first = ComponentToChars(first, last, vector.Component(3));
+	return CharsCopy(first, last, ")", 1);
+}
+
+// 4D FromChars(): reads a vector as ToChars() writes it (spaces optional) from [first, last). One past
+// the ')', or 0 if there isn't such a vector (vector unchanged)
+template <typename TYPE> const char* FromChars(const char* first, const char* last, VECTOR4<TYPE>& vector)
+{
+	TYPE x = TYPE(), y = TYPE(), z = TYPE(), w = TYPE();
+	first = CharsExpect(first, last, '(');
+	first = ComponentFromChars(first, last, x);
+	first = CharsExpect(first, last, ',');
+	first = ComponentFromChars(first, last, y);
+	first = CharsExpect(first, last, ',');
+	first = ComponentFromChars(first, last, z);
+	first = CharsExpect(first, last, ',');
+	first = ComponentFromChars(first, last, w);
+	first = CharsExpect(first, last, ')');
+	if (first != 0)
+	{
+		vector = VECTOR4<TYPE>(x, y, z, w);
+	}
+	return first;
+}
+
+// 4D FormatLines(): vectors[0] to vectors[count - 1] one per line, as prefix, the components between
+// separators, and '\n' ("v " and ' ' for OBJ vertices, "" and ',' for CSV). One past the last character, or 0
+// if they don't fit in [first, last)
+template <typename TYPE> char* FormatLines(char* first, char* last, const VECTOR4<TYPE>* vectors, const size_t& count, const char& separator = ',', const char* prefix = "")
+{
+	size_t prefixLength = strlen(prefix);
+	for (size_t i = 0; i < count && first != 0; i++)
+	{
+		first = CharsCopy(first, last, prefix, prefixLength);
+		first = ComponentToChars(first, last, vectors[i].Component(0));
+		first = CharsCopy(first, last, &separator, 1);
+		first = ComponentToChars(first, last, vectors[i].Component(1));
+		first = CharsCopy(first, last, &separator, 1);
+		first = ComponentToChars(first, last, vectors[i].Component(2));
+		first = CharsCopy(first, last, &separator, 1);
+		first = ComponentToChars(first, last, vectors[i].Component(3));
+		first = CharsCopy(first, last, "\n", 1);
+	}
+	return first;
+}
+
+// 4D ParseLines(): reads vectors from lines as FormatLines() writes them (\r\n too) into vectors, up to
+// capacity of them, skipping blank lines and lines that don't start with prefix (such as an OBJ file's "vn" and "f"
+// lines). Stops at the first line it can't read, or at last: returns where it stopped, and sets parsed
+template <typename TYPE> const char* ParseLines(const char* first, const char* last, VECTOR4<TYPE>* vectors, const size_t& capacity, size_t& parsed, const char& separator = ',', const char* prefix = "")
+{
+	size_t prefixLength = strlen(prefix);
+	parsed = 0;
+	while (first != last && parsed < capacity)
+	{
+		const char* end = (const char*)memchr(first, '\n', (size_t)(last - first));
+		end = (end != 0) ? end : last;
+		const char* next = (end != last) ? end + 1 : last;
+		if (CharsLineEnd(first, end) != 0 || (size_t)(end - first) < prefixLength || memcmp(first, prefix, prefixLength) != 0)
+		{
+			first = next;
+			continue;
+		}
+		TYPE x = TYPE(), y = TYPE(), z = TYPE(), w = TYPE();
+		const char* read = first + prefixLength;
+		read = ComponentFromChars(read, end, x);
+		read = CharsSeparator(read, end, separator);
+		read = ComponentFromChars(read, end, y);
+		read = CharsSeparator(read, end, separator);
+		read = ComponentFromChars(read, end, z);
+		read = CharsSeparator(read, end, separator);
+		read = ComponentFromChars(read, end, w);
+		if (CharsLineEnd(read, end) == 0)
+		{
+			return first;
+		}
+		vectors[parsed++] = VECTOR4<TYPE>(x, y, z, w);
+		first = next;
+	}
+	return first;
+}
+
+
+} // SVML namespace
+
+// Printing (define SVML_NO_IOSTREAM to leave out svml_io.h, and with it <ostream> and <sstream>)
+#ifndef SVML_NO_IOSTREAM
+#include "svml_io.h"
+#endif
 
 #endif // SVML_H
@@ -0,0 +1,1283 @@
+#ifndef SVML_CORE_H
+#define SVML_CORE_H
+
+/*
+
+SVML - Simple Vector Math Library
+Author: Dwight House ( http://dwighthouse.com )
+Assistance by: Dr. Dmitri Volper, Mike Fried, Jeff Hubbard, Chris Peters
+
+Instructions and Information: https://github.com/dwighthouse/svml
+
+Colossians 3:23-24
+
+Copyright (c) 2010-2015 Dwight House
+
+*/
+
+#include <stdio.h> // printf, sprintf, FILE, fopen, fwrite, fread, fseek
+#include <math.h> // sqrt, fabs, min, max, ceil, floor, sin, cos
+#include <stdlib.h> // malloc, free
+#include <string.h> // memcpy, memset
+#include <limits> // numeric_limits
+#include <stdint.h> // int32_t, int64_t
+#include <vector> // vector
+#include <algorithm> // max, min, sort, find, nth_element, partition, push_heap, pop_heap, sort_heap
+
+// Constant expressions (C++14 and later; constexpr functions in C++11 are too limited)
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define SVML_HAS_CONSTEXPR
+#define SVML_CONSTEXPR constexpr
+#else
+#define SVML_CONSTEXPR inline
+#endif
+
+// Shortest round-trip number text for ToChars() and FromChars(): std::to_chars() and std::from_chars() where the
+// library has them for floating point (C++17), sprintf() and strtod() otherwise
+#if (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)) && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv> // to_chars, from_chars
+#endif
+#endif
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define SVML_HAS_TO_CHARS
+#endif
+
+// Vectors of class components (VECTOR3<HALF>, VECTOR2<FIXED> and the like, C++11 and later): a defaulted constructor
+// keeps the component trivial, as a member of the vector's union must be
+#if __cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L)
+#define SVML_HAS_CLASS_COMPONENTS
+#endif
+
+// Precision of the square roots in Normalize(), .Normalize(), .Length and Distance()
+// (define SVML_PRECISION as one of these before including svml.h)
+#define SVML_PRECISION_EXACT 0 // sqrt() and division (default)
+#define SVML_PRECISION_REFINED 1 // float: SSE reciprocal square root estimate plus one Newton-Raphson step
+#define SVML_PRECISION_ESTIMATE 2 // float: SSE reciprocal square root estimate alone
+#ifndef SVML_PRECISION
+#define SVML_PRECISION SVML_PRECISION_EXACT
+#endif
+#if SVML_PRECISION != SVML_PRECISION_EXACT && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define SVML_FAST_RSQRT // Without SSE the fast modes fall back to sqrt()
+#endif
+
+#if defined(SVML_USE_SSE) || defined(SVML_FAST_RSQRT)
+#include <xmmintrin.h> // __m128, SSE intrinsics
+#endif
+#ifdef SVML_USE_SSE
+#ifdef __SSE4_1__
+#include <smmintrin.h> // _mm_ceil_ps, _mm_floor_ps, _mm_mullo_epi32
+#endif
+#ifdef __SSE2__
+#include <emmintrin.h> // __m128i, bfloat16 conversion, SimdSinCos()
+#endif
+#if defined(__AVX__) || defined(__F16C__) || defined(__AVX512F__)
+#include <immintrin.h> // __m256d, _mm_cvtps_ph, _mm_cvtph_ps, _mm512_cvtps_ph
+#endif
+#endif
+
+// Parallel bulk operations on spans (define SVML_USE_THREADS, C++11 and later)
+#ifdef SVML_USE_THREADS
+#if __cplusplus < 201103L && !(defined(_MSVC_LANG) && _MSVC_LANG >= 201103L)
+#error "SVML_USE_THREADS needs C++11 (std::thread)"
+#endif
+#include <atomic> // atomic
+#include <condition_variable> // condition_variable
+#include <mutex> // mutex, lock_guard, unique_lock
+#include <thread> // thread
+#endif
+
+// Float bulk kernels for SSE2, AVX2 and AVX-512, picked at run time (SVML_USE_THREADS on x86-64 with GCC, Clang or
+// MSVC, and the exact SVML_PRECISION; define SVML_NO_DISPATCH to keep the plain loops)
+#if defined(SVML_USE_THREADS) && !defined(SVML_NO_DISPATCH) && SVML_PRECISION == SVML_PRECISION_EXACT && (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+#define SVML_HAS_DISPATCH
+#include <immintrin.h> // __m256, __m512, AVX2 and AVX-512 intrinsics
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h> // __cpuidex, _xgetbv
+#define SVML_TARGET(isa)
+#elif defined(__clang__)
+#define SVML_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SVML_TARGET(isa) __attribute__((target(isa), optimize("fp-contract=off"))) // AVX-512 brings FMA, which would change the bits
+#endif
+#endif
+
+// Binary files of vectors, memory-mapped where there's mmap() (define SVML_USE_FILES)
+#ifdef SVML_USE_FILES
+#if defined(__unix__) || defined(__APPLE__)
+#define SVML_HAS_MMAP
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
+#endif
+#endif
+
+namespace SVML
+{
+
+//----------------------------------------------------------------------
+// 
+// Sec. 01 - Startup, globals, predefinitions, types
+// 
+//----------------------------------------------------------------------
+
+using std::max;
+using std::min;
+
+// Typedefs
+typedef float SCALAR_TYPE;
+
+// Global constants
+const SCALAR_TYPE COMPARISON_EPSILON = (SCALAR_TYPE)0.000001; // Used by AlmostEqual()
+
+// Scalar type of vectors of TYPE: what their lengths, dot products and distances return, and what scalar factors
+// they take. TYPE itself, so double vectors keep double precision and int vectors stay integer; the storage types
+// HALF and BFLOAT16 compute in float
+template <typename TYPE> struct ScalarType
+{
+	typedef TYPE type;
+	static type Epsilon() { return ((type)COMPARISON_EPSILON > 0) ? (type)COMPARISON_EPSILON : (type)1; } // Used by AlmostEqual(); integers must match exactly
+};
+
+// Type of the angles and Lerp() deltas vectors of TYPE take: their ScalarType, except that integer vectors rotate
+// and interpolate by SCALAR_TYPE, as an integer delta or angle could only be a whole turn or a whole step
+template <typename TYPE, bool INTEGER = std::numeric_limits<TYPE>::is_integer> struct RealType { typedef typename ScalarType<TYPE>::type type; };
+template <typename TYPE> struct RealType<TYPE, true> { typedef SCALAR_TYPE type; };
+
+// Mask of the component-wise comparisons of vectors of TYPE, given the MASK2 to MASK4 of their dimension. That mask
+// itself, except for WIDE components, which compare lane by lane into a mask per lane
+template <typename TYPE, typename MASK> struct MaskType { typedef MASK type; };
+
+// Predefines
+template <typename TYPE> union VECTOR2;
+template <typename TYPE> union VECTOR3;
+template <typename TYPE> union VECTOR4;
+template <typename TYPE> struct MATRIX2;
+template <typename TYPE> struct MATRIX3;
+template <typename TYPE> struct MATRIX4;
+template <typename TYPE> struct QUATERNION;
+template <typename TYPE> struct ROTATION2;
+template <typename TYPE> struct AABB2;
+template <typename TYPE> struct AABB3;
+template <typename TYPE> class HASH_GRID2;
+template <typename TYPE> class HASH_GRID3;
+template <typename TYPE> class KD_TREE2;
+template <typename TYPE> class KD_TREE3;
+template <typename TYPE> class BVH3;
+struct MASK2;
+struct MASK3;
+struct MASK4;
+struct HALF;
+struct BFLOAT16;
+struct FIXED;
+template <typename TYPE, int N> struct WIDE;
+
+// Default types (BUILT-IN TYPE CUSTOMIZATION HERE!)
+typedef VECTOR2<float> vec2;
+typedef VECTOR3<float> vec3;
+typedef VECTOR4<float> vec4;
+typedef MASK2 bvec2;
+typedef MASK3 bvec3;
+typedef MASK4 bvec4;
+typedef MATRIX2<float> mat2;
+typedef MATRIX3<float> mat3;
+typedef MATRIX4<float> mat4;
+typedef QUATERNION<float> quat;
+typedef ROTATION2<float> rot2;
+typedef AABB2<float> aabb2;
+typedef AABB3<float> aabb3;
+typedef HASH_GRID2<float> hashgrid2;
+typedef HASH_GRID3<float> hashgrid3;
+typedef KD_TREE2<float> kdtree2;
+typedef KD_TREE3<float> kdtree3;
+typedef BVH3<float> bvh3;
+#ifdef SVML_HAS_CLASS_COMPONENTS
+typedef VECTOR2<HALF> f16vec2;
+typedef VECTOR3<HALF> f16vec3;
+typedef VECTOR4<HALF> f16vec4;
+typedef VECTOR2<BFLOAT16> bf16vec2;
+typedef VECTOR3<BFLOAT16> bf16vec3;
+typedef VECTOR4<BFLOAT16> bf16vec4;
+typedef VECTOR2<FIXED> fxvec2;
+typedef VECTOR3<FIXED> fxvec3;
+typedef VECTOR4<FIXED> fxvec4;
+typedef VECTOR2< WIDE<float, 8> > wvec2;
+typedef VECTOR3< WIDE<float, 8> > wvec3;
+typedef VECTOR4< WIDE<float, 8> > wvec4;
+#endif
+// etc.
+
+// Swizzles write a vector's components through one struct type and read them through another, so the
+// compiler must not assume accesses through different swizzle types are independent
+#if defined(__GNUC__)
+#define SVML_MAY_ALIAS __attribute__((__may_alias__))
+#else
+#define SVML_MAY_ALIAS
+#endif
+
+// Out of bounds access and other misuse print an error and exit, with printf() so that only svml_io.h needs iostreams
+#if defined(__GNUC__)
+#define SVML_NORETURN __attribute__((__noreturn__))
+#elif defined(_MSC_VER)
+#define SVML_NORETURN __declspec(noreturn)
+#else
+#define SVML_NORETURN
+#endif
+SVML_NORETURN inline void FatalError(const char* message) { printf("Fatal Error: %s\n", message); exit(-1); }
+SVML_NORETURN inline void FatalError(const char* message, const unsigned& index) { printf("Fatal Error: %s\n - Index:  %u\n", message, index); exit(-1); }
+
+// SIMD storage (define SVML_USE_SSE to back VECTOR3<float> and VECTOR4<float> with an __m128, and with SSE4.1
+// VECTOR3<int> and VECTOR4<int> with an __m128i)
+struct NO_SIMD {};
+template <typename TYPE, int DIMENSION> struct SimdStorage { typedef NO_SIMD type; };
+#ifdef SVML_USE_SSE
+template <> struct SimdStorage<float, 3> { typedef __m128 type; };
+template <> struct SimdStorage<float, 4> { typedef __m128 type; };
+#ifdef __SSE4_1__
+template <> struct SimdStorage<int, 3> { typedef __m128i type; };
+template <> struct SimdStorage<int, 4> { typedef __m128i type; };
+#endif
+#endif
+
+
+
+//----------------------------------------------------------------------
+// 
+// Sec. 02 - Math utilities not specific to vectors
+// 
+//----------------------------------------------------------------------
+
+SVML_CONSTEXPR SCALAR_TYPE DegToRad(const SCALAR_TYPE& degrees)
+{
+	return degrees * (SCALAR_TYPE)0.017453292519943; // (pi / 180)
+}
+
+SVML_CONSTEXPR SCALAR_TYPE RadToDeg(const SCALAR_TYPE& radians)
+{
+	return radians * (SCALAR_TYPE)57.295779513082325; // (180 / pi)
+}
+
+inline SCALAR_TYPE Lerp(const SCALAR_TYPE& start, const SCALAR_TYPE& end, const SCALAR_TYPE& delta)
+{
+	return start + delta * (end - start);
+}
+
+// Square roots under SVML_PRECISION (only float has the fast versions, other types always use sqrt())
+template <typename TYPE> inline TYPE PrecisionDivideBySqrt(const TYPE& numerator, const TYPE& x) { return numerator / sqrt(x); }
+template <typename TYPE> inline TYPE PrecisionSqrt(const TYPE& x) { return sqrt(x); }
+#ifdef SVML_FAST_RSQRT
+// 1 / sqrt() of the low lane
+inline __m128 SimdReciprocalSqrt(const __m128& x)
+{
+	__m128 estimate = _mm_rsqrt_ss(x); // Relative error below 1.5 * 2^-12
+#if SVML_PRECISION == SVML_PRECISION_REFINED
+	// Newton-Raphson: estimate * (1.5 - 0.5 * x * estimate^2), which roughly squares the relative error
+	estimate = _mm_mul_ss(estimate, _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), x), _mm_mul_ss(estimate, estimate))));
+#endif
+	return estimate;
+}
+
+inline float PrecisionDivideBySqrt(const float& numerator, const float& x) { return numerator * _mm_cvtss_f32(SimdReciprocalSqrt(_mm_set_ss(x))); }
+inline float PrecisionSqrt(const float& x) { return (x > 0) ? PrecisionDivideBySqrt(x, x) : 0; } // x * (1 / sqrt(x)), which is infinite at 0
+#endif // SVML_FAST_RSQRT
+
+// The square root of the sum of the squares of two or three components, and a numerator divided by it, for .Length,
+// Normalize() and Distance(). FIXED has its own, as its squares leave its range long before its lengths do
+template <typename TYPE> inline TYPE PrecisionLength(const TYPE& x, const TYPE& y) { TYPE squared = x * x + y * y; return PrecisionSqrt(squared); }
+template <typename TYPE> inline TYPE PrecisionLength(const TYPE& x, const TYPE& y, const TYPE& z) { TYPE squared = x * x + y * y + z * z; return PrecisionSqrt(squared); }
+template <typename TYPE> inline TYPE PrecisionDivideByLength(const TYPE& numerator, const TYPE& x, const TYPE& y) { TYPE squared = x * x + y * y; return PrecisionDivideBySqrt(numerator, squared); }
+template <typename TYPE> inline TYPE PrecisionDivideByLength(const TYPE& numerator, const TYPE& x, const TYPE& y, const TYPE& z) { TYPE squared = x * x + y * y + z * z; return PrecisionDivideBySqrt(numerator, squared); }
+
+// Per-component helpers of the GLSL-style vector functions (Abs(), Sign(), Clamp(), Step(), SmoothStep(), Fract(),
+// Mod() and Log2())
+template <typename TYPE> inline TYPE ComponentAbs(const TYPE& x) { return (x <= (TYPE)0) ? (TYPE)0 - x : x; } // 0 - x so that -0 gives +0
+template <typename TYPE> inline TYPE ComponentSign(const TYPE& x) { return (x > (TYPE)0) ? (TYPE)1 : ((x < (TYPE)0) ? (TYPE)-1 : (TYPE)0); }
+template <typename TYPE> inline TYPE ComponentClamp(const TYPE& x, const TYPE& minimum, const TYPE& maximum) { return min(max(x, minimum), maximum); }
+template <typename TYPE> inline TYPE ComponentStep(const TYPE& edge, const TYPE& x) { return (x < edge) ? (TYPE)0 : (TYPE)1; }
+template <typename TYPE> inline TYPE ComponentSmoothStep(const TYPE& edge0, const TYPE& edge1, const TYPE& x)
+{
+	TYPE t = ComponentClamp((x - edge0) / (edge1 - edge0), (TYPE)0, (TYPE)1);
+	return t * t * ((TYPE)3 - (TYPE)2 * t);
+}
+template <typename TYPE> inline TYPE ComponentFract(const TYPE& x) { return x - floor(x); }
+template <typename TYPE> inline TYPE ComponentMod(const TYPE& x, const TYPE& y) { return x - y * floor(x / y); }
+// log2() is not in C++98's <math.h>. The exponent comes from frexp(), so powers of two are exact
+template <typename TYPE> inline TYPE ComponentLog2(const TYPE& x)
+{
+	int exponent;
+	TYPE mantissa = frexp(x, &exponent); // In [0.5, 1) for finite x other than 0
+	return (TYPE)(exponent - 1) + log(mantissa * (TYPE)2) / log((TYPE)2);
+}
+
+// Half-precision storage. HALF is an IEEE 754 binary16 (11 significant bits, up to 65504) and BFLOAT16 the upper half of
+// a float (8 significant bits, the range of a float). Both convert to and from float, rounding to nearest even, so
+// arithmetic on them happens in float and VECTOR3<HALF> is storage for 6 bytes
+inline unsigned FloatBits(const float& value) { unsigned bits; memcpy(&bits, &value, sizeof(bits)); return bits; }
+inline float BitsToFloat(const unsigned& bits) { float value; memcpy(&value, &bits, sizeof(value)); return value; }
+
+// NaNs keep their sign and top significand bits and become quiet, as F16C does
+inline unsigned short FloatToHalfBits(const float& value)
+{
+	unsigned bits = FloatBits(value);
+	unsigned sign = (bits >> 16) & 0x8000;
+	unsigned magnitude = bits & 0x7FFFFFFF;
+	if (magnitude >= 0x7F800000) { return (unsigned short)(sign | 0x7C00 | ((magnitude > 0x7F800000) ? (0x200 | ((magnitude >> 13) & 0x3FF)) : 0)); }
+	if (magnitude >= 0x477FF000) { return (unsigned short)(sign | 0x7C00); } // 65520 and above round to infinity
+	if (magnitude < 0x38800000)
+	{
+		// Subnormal: the significand in units of 2^-24, rounded to nearest even
+		unsigned exponent = magnitude >> 23;
+		if (exponent < 102) { return (unsigned short)sign; }
+		unsigned significand = (magnitude & 0x7FFFFF) | 0x800000;
+		unsigned shift = 126 - exponent;
+		unsigned result = significand >> shift;
+		unsigned remainder = significand & ((1u << shift) - 1);
+		unsigned halfway = 1u << (shift - 1);
+		if (remainder > halfway || (remainder == halfway && (result & 1))) { result++; }
+		return (unsigned short)(sign | result);
+	}
+	// Rebias the exponent and round the 13 dropped bits (a carry correctly moves into the exponent)
+	unsigned rebiased = magnitude - 0x38000000;
+	return (unsigned short)(sign | ((rebiased + 0xFFF + ((rebiased >> 13) & 1)) >> 13));
+}
+
+inline float HalfBitsToFloat(const unsigned short& bits)
+{
+	unsigned sign = (unsigned)(bits & 0x8000) << 16;
+	unsigned exponent = (bits >> 10) & 0x1F;
+	unsigned significand = bits & 0x3FF;
+	if (exponent == 0x1F) { return BitsToFloat(sign | 0x7F800000 | (significand << 13) | (significand ? 0x400000 : 0)); }
+	if (exponent != 0) { return BitsToFloat(sign | ((exponent + 112) << 23) | (significand << 13)); }
+	if (significand == 0) { return BitsToFloat(sign); }
+	// Subnormal: normalize the significand
+	exponent = 113;
+	while (!(significand & 0x400))
+	{
+		significand <<= 1;
+		exponent--;
+	}
+	return BitsToFloat(sign | (exponent << 23) | ((significand & 0x3FF) << 13));
+}
+
+inline unsigned short FloatToBfloat16Bits(const float& value)
+{
+	unsigned bits = FloatBits(value);
+	if ((bits & 0x7FFFFFFF) > 0x7F800000) { return (unsigned short)((bits >> 16) | 0x40); }
+	return (unsigned short)((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+
+inline float Bfloat16BitsToFloat(const unsigned short& bits) { return BitsToFloat((unsigned)bits << 16); }
+
+struct HALF
+{
+	unsigned short bits;
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+	HALF() = default;
+#else
+	HALF() {}
+#endif
+	HALF(const float& value) : bits(FloatToHalfBits(value)) {}
+	operator float() const { return HalfBitsToFloat(bits); }
+	static HALF FromBits(const unsigned short& bits) { HALF half; half.bits = bits; return half; }
+
+	const HALF& operator+=(const float& rhs) { return *this = HALF((float)*this + rhs); }
+	const HALF& operator-=(const float& rhs) { return *this = HALF((float)*this - rhs); }
+	const HALF& operator*=(const float& rhs) { return *this = HALF((float)*this * rhs); }
+	const HALF& operator/=(const float& rhs) { return *this = HALF((float)*this / rhs); }
+};
+
+struct BFLOAT16
+{
+	unsigned short bits;
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+	BFLOAT16() = default;
+#else
+	BFLOAT16() {}
+#endif
+	BFLOAT16(const float& value) : bits(FloatToBfloat16Bits(value)) {}
+	operator float() const { return Bfloat16BitsToFloat(bits); }
+	static BFLOAT16 FromBits(const unsigned short& bits) { BFLOAT16 bfloat; bfloat.bits = bits; return bfloat; }
+
+	const BFLOAT16& operator+=(const float& rhs) { return *this = BFLOAT16((float)*this + rhs); }
+	const BFLOAT16& operator-=(const float& rhs) { return *this = BFLOAT16((float)*this - rhs); }
+	const BFLOAT16& operator*=(const float& rhs) { return *this = BFLOAT16((float)*this * rhs); }
+	const BFLOAT16& operator/=(const float& rhs) { return *this = BFLOAT16((float)*this / rhs); }
+};
+
+// The type arithmetic on TYPE widens to: float for HALF and BFLOAT16, so their single-component swizzles and
+// lengths convert to float in one step, and a type nothing converts to for every other TYPE
+template <typename TYPE> struct WidenedType { struct NONE {}; typedef NONE type; };
+template <> struct WidenedType<HALF> { typedef float type; };
+template <> struct WidenedType<BFLOAT16> { typedef float type; };
+
+// Vectors of HALF and BFLOAT16 take and return float scalars
+template <> struct ScalarType<HALF> { typedef float type; static type Epsilon() { return COMPARISON_EPSILON; } };
+template <> struct ScalarType<BFLOAT16> { typedef float type; static type Epsilon() { return COMPARISON_EPSILON; } };
+
+// Q16.16 fixed point. FIXED holds its value times 65536 in an int32_t (-32768 to 32767.99998 in steps of 2^-16) and
+// computes with integers alone, so the same inputs give the same bits on every compiler and platform, for lockstep
+// simulations. Results round to nearest and saturate at the ends of the range instead of wrapping; division by zero
+// saturates towards the sign of the numerator. sqrt() is an integer square root and sin() and cos() are CORDIC, accurate
+// to about one step
+inline int32_t FixedSaturate(const int64_t& raw) { return (raw > 0x7FFFFFFF) ? 0x7FFFFFFF : ((raw < -(int64_t)0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : (int32_t)raw); }
+
+// value / 2^shift rounded down, and rounded to nearest (halfway up), without shifting negative numbers
+inline int64_t FixedFloorShift(const int64_t& value, const unsigned& shift) { return (value >= 0) ? (value >> shift) : -((-value - 1) >> shift) - 1; }
+inline int64_t FixedRoundShift(const int64_t& value, const unsigned& shift) { return FixedFloorShift(value + ((int64_t)1 << (shift - 1)), shift); }
+
+inline int32_t FixedDivide(const int32_t& numerator, const int64_t& denominator)
+{
+	if (denominator == 0) { return (numerator > 0) ? 0x7FFFFFFF : ((numerator < 0) ? -0x7FFFFFFF - 1 : 0); }
+	// Magnitudes, rounded to nearest with halfway away from zero
+	int64_t scaled = (int64_t)numerator * 65536;
+	int64_t magnitude = (scaled < 0) ? -scaled : scaled;
+	int64_t divisor = (denominator < 0) ? -(int64_t)denominator : (int64_t)denominator;
+	int64_t quotient = (magnitude + divisor / 2) / divisor;
+	return FixedSaturate(((scaled < 0) != (denominator < 0)) ? -quotient : quotient);
+}
+
+// Digit by digit square root, rounded to nearest. Of raw * 65536 for FIXED, and of a sum of Q32.32 squares for lengths
+inline uint64_t FixedSqrt64(const uint64_t& value)
+{
+	uint64_t remainder = value;
+	uint64_t root = 0;
+	uint64_t bit = (uint64_t)1 << 62;
+	while (bit > remainder) { bit >>= 2; }
+	while (bit != 0)
+	{
+		if (remainder >= root + bit)
+		{
+			remainder -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (remainder > root) ? root + 1 : root; // remainder is value - root^2, past halfway when above root
+}
+inline int32_t FixedSqrt(const int32_t& raw) { return (raw <= 0) ? 0 : (int32_t)FixedSqrt64((uint64_t)raw << 16); } // 0 for negative numbers
+
+// CORDIC in Q2.30: the angle is reduced to [-pi/2, pi/2] and rotated towards zero by atan(2^-i), i = 0 to 29, starting
+// from (K, 0) so the gain of the rotations is cancelled
+inline void FixedSinCos(const int32_t& radians, int32_t& sine, int32_t& cosine)
+{
+	static const int32_t arctangents[30] = { 843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851, 8388437, 4194283, 2097149, 1048576, 524288, 262144, 131072, 65536, 32768, 16384, 8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8, 4, 2 };
+	const int64_t twoPi = ((int64_t)6 << 32) + 1216271633; // Q32 (C++98 has no 64-bit literals)
+	const int64_t halfPi = 1686629713; // Q30
+	const int64_t pi = halfPi * 2;
+
+	// Into [-pi, pi) in Q32, then Q30
+	int64_t reduced = ((int64_t)radians * 65536) % twoPi;
+	if (reduced < 0) { reduced += twoPi; }
+	if (reduced >= twoPi / 2) { reduced -= twoPi; }
+	int64_t angle = FixedRoundShift(reduced, 2);
+	int64_t cosineSign = 1;
+	if (angle > halfPi) { angle = pi - angle; cosineSign = -1; }
+	else if (angle < -halfPi) { angle = -pi - angle; cosineSign = -1; }
+
+	int64_t x = 652032874; // K = 0.607252935 in Q30
+	int64_t y = 0;
+	for (unsigned i = 0; i < 30; i++)
+	{
+		int64_t xStep = FixedFloorShift(x, i);
+		int64_t yStep = FixedFloorShift(y, i);
+		if (angle >= 0)
+		{
+			x -= yStep;
+			y += xStep;
+			angle -= arctangents[i];
+		}
+		else
+		{
+			x += yStep;
+			y -= xStep;
+			angle += arctangents[i];
+		}
+	}
+	sine = (int32_t)FixedRoundShift(y, 14);
+	cosine = (int32_t)(cosineSign * FixedRoundShift(x, 14));
+}
+
+struct FIXED
+{
+	int32_t raw;
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+	FIXED() = default;
+#else
+	FIXED() {}
+#endif
+	FIXED(const int& value) : raw(FixedSaturate((int64_t)value * 65536)) {}
+	FIXED(const unsigned& value) : raw(FixedSaturate((int64_t)value * 65536)) {}
+	FIXED(const float& value) : raw(RawFromDouble(value)) {}
+	FIXED(const double& value) : raw(RawFromDouble(value)) {}
+	static FIXED FromRaw(const int32_t& raw) { FIXED fixed; fixed.raw = raw; return fixed; }
+	double ToDouble() const { return raw / 65536.0; }
+	float ToFloat() const { return (float)ToDouble(); }
+
+	// Rounded to nearest with halfway away from zero, saturated, and 0 for NaN. Multiplying by 65536 is exact
+	static int32_t RawFromDouble(const double& value)
+	{
+		double scaled = value * 65536.0;
+		if (scaled != scaled) { return 0; }
+		if (scaled >= 2147483647.0) { return 0x7FFFFFFF; }
+		if (scaled <= -2147483648.0) { return -0x7FFFFFFF - 1; }
+		return (int32_t)((scaled >= 0) ? floor(scaled + 0.5) : ceil(scaled - 0.5));
+	}
+
+	friend FIXED operator+(const FIXED& lhs, const FIXED& rhs) { return FromRaw(FixedSaturate((int64_t)lhs.raw + rhs.raw)); }
+	friend FIXED operator-(const FIXED& lhs, const FIXED& rhs) { return FromRaw(FixedSaturate((int64_t)lhs.raw - rhs.raw)); }
+	friend FIXED operator*(const FIXED& lhs, const FIXED& rhs) { return FromRaw(FixedSaturate(FixedRoundShift((int64_t)lhs.raw * rhs.raw, 16))); }
+	friend FIXED operator/(const FIXED& lhs, const FIXED& rhs) { return FromRaw(FixedDivide(lhs.raw, rhs.raw)); }
+	friend FIXED operator-(const FIXED& value) { return FromRaw(FixedSaturate(-(int64_t)value.raw)); }
+	const FIXED& operator+=(const FIXED& rhs) { return *this = *this + rhs; }
+	const FIXED& operator-=(const FIXED& rhs) { return *this = *this - rhs; }
+	const FIXED& operator*=(const FIXED& rhs) { return *this = *this * rhs; }
+	const FIXED& operator/=(const FIXED& rhs) { return *this = *this / rhs; }
+
+	friend bool operator==(const FIXED& lhs, const FIXED& rhs) { return lhs.raw == rhs.raw; }
+	friend bool operator!=(const FIXED& lhs, const FIXED& rhs) { return lhs.raw != rhs.raw; }
+	friend bool operator<(const FIXED& lhs, const FIXED& rhs) { return lhs.raw < rhs.raw; }
+	friend bool operator>(const FIXED& lhs, const FIXED& rhs) { return lhs.raw > rhs.raw; }
+	friend bool operator<=(const FIXED& lhs, const FIXED& rhs) { return lhs.raw <= rhs.raw; }
+	friend bool operator>=(const FIXED& lhs, const FIXED& rhs) { return lhs.raw >= rhs.raw; }
+
+	// The <math.h> functions the vector functions call, found through FIXED arguments only
+	friend FIXED fabs(const FIXED& value) { return (value.raw < 0) ? -value : value; }
+	friend FIXED floor(const FIXED& value) { return FromRaw((int32_t)(FixedFloorShift(value.raw, 16) * 65536)); }
+	friend FIXED ceil(const FIXED& value) { return FromRaw(FixedSaturate(-FixedFloorShift(-(int64_t)value.raw, 16) * 65536)); }
+	friend FIXED sqrt(const FIXED& value) { return FromRaw(FixedSqrt(value.raw)); }
+	friend FIXED sin(const FIXED& radians) { int32_t sine, cosine; FixedSinCos(radians.raw, sine, cosine); return FromRaw(sine); }
+	friend FIXED cos(const FIXED& radians) { int32_t sine, cosine; FixedSinCos(radians.raw, sine, cosine); return FromRaw(cosine); }
+};
+
+// .Length, Normalize() and Distance() of fixed-point vectors: the squares of the raw values are Q32.32, summed in 64 bits
+// and rooted back to Q16.16, so only lengths past the range of FIXED saturate (Dot() and DistanceSquared() past 181 do)
+inline uint64_t FixedSquare(const FIXED& value) { return (uint64_t)((int64_t)value.raw * value.raw); }
+inline FIXED PrecisionLength(const FIXED& x, const FIXED& y) { return FIXED::FromRaw(FixedSaturate((int64_t)FixedSqrt64(FixedSquare(x) + FixedSquare(y)))); }
+inline FIXED PrecisionLength(const FIXED& x, const FIXED& y, const FIXED& z) { return FIXED::FromRaw(FixedSaturate((int64_t)FixedSqrt64(FixedSquare(x) + FixedSquare(y) + FixedSquare(z)))); }
+inline FIXED PrecisionDivideByLength(const FIXED& numerator, const FIXED& x, const FIXED& y) { return FIXED::FromRaw(FixedDivide(numerator.raw, (int64_t)FixedSqrt64(FixedSquare(x) + FixedSquare(y)))); }
+inline FIXED PrecisionDivideByLength(const FIXED& numerator, const FIXED& x, const FIXED& y, const FIXED& z) { return FIXED::FromRaw(FixedDivide(numerator.raw, (int64_t)FixedSqrt64(FixedSquare(x) + FixedSquare(y) + FixedSquare(z)))); }
+
+// Fixed-point vectors keep fixed-point lengths, dot products and scalars; AlmostEqual() allows one step of difference
+template <> struct ScalarType<FIXED>
+{
+	typedef FIXED type;
+	static type Epsilon() { return FIXED::FromRaw(2); }
+};
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// Lane-packed components. WIDE<TYPE, N> is N values of TYPE side by side, and arithmetic and the <math.h> functions
+// work lane by lane, so a vector of WIDE<float, 8> is eight vectors processed with the instructions of one (with
+// SVML_USE_SSE, float lanes go through SSE, and AVX where it's enabled). Comparisons are true when they hold in every
+// lane, so == and AlmostEqual() on vectors of WIDE compare all N vectors; choices made lane by lane go through the
+// component-wise comparisons, which give a mask per lane, Select(), and Max(), Min(), Abs(), Sign(), Step(), Clamp()
+// and the like, which don't branch
+template <typename TYPE, int N> struct WideKernels
+{
+	static void Add(TYPE* out, const TYPE* a, const TYPE* b) { for (int i = 0; i < N; i++) { out[i] = a[i] + b[i]; } }
+	static void Subtract(TYPE* out, const TYPE* a, const TYPE* b) { for (int i = 0; i < N; i++) { out[i] = a[i] - b[i]; } }
+	static void Multiply(TYPE* out, const TYPE* a, const TYPE* b) { for (int i = 0; i < N; i++) { out[i] = a[i] * b[i]; } }
+	static void Divide(TYPE* out, const TYPE* a, const TYPE* b) { for (int i = 0; i < N; i++) { out[i] = a[i] / b[i]; } }
+	static void Negate(TYPE* out, const TYPE* a) { for (int i = 0; i < N; i++) { out[i] = -a[i]; } }
+	static void Fabs(TYPE* out, const TYPE* a) { for (int i = 0; i < N; i++) { out[i] = fabs(a[i]); } }
+	static void Max(TYPE* out, const TYPE* a, const TYPE* b) { for (int i = 0; i < N; i++) { out[i] = (a[i] < b[i]) ? b[i] : a[i]; } }
+	static void Min(TYPE* out, const TYPE* a, const TYPE* b) { for (int i = 0; i < N; i++) { out[i] = (b[i] < a[i]) ? b[i] : a[i]; } }
+	static void Sqrt(TYPE* out, const TYPE* a) { for (int i = 0; i < N; i++) { out[i] = sqrt(a[i]); } }
+	static void Floor(TYPE* out, const TYPE* a) { for (int i = 0; i < N; i++) { out[i] = floor(a[i]); } }
+	static void Ceil(TYPE* out, const TYPE* a) { for (int i = 0; i < N; i++) { out[i] = ceil(a[i]); } }
+};
+#ifdef SVML_USE_SSE
+// Eight lanes per instruction with AVX and four with SSE, then any left over one at a time. Every operation loads and
+// stores whole registers: compilers left to vectorize the loops above split the copies of WIDE into halves, and
+// loading a register that two smaller stores just wrote stalls
+template <int N> struct WideKernels<float, N>
+{
+	static void Add(float* out, const float* a, const float* b)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))); }
+		for (; i < N; i++) { out[i] = a[i] + b[i]; }
+	}
+	static void Subtract(float* out, const float* a, const float* b)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))); }
+		for (; i < N; i++) { out[i] = a[i] - b[i]; }
+	}
+	static void Multiply(float* out, const float* a, const float* b)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))); }
+		for (; i < N; i++) { out[i] = a[i] * b[i]; }
+	}
+	static void Divide(float* out, const float* a, const float* b)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_div_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_div_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))); }
+		for (; i < N; i++) { out[i] = a[i] / b[i]; }
+	}
+	static void Negate(float* out, const float* a)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_xor_ps(_mm256_loadu_ps(a + i), _mm256_set1_ps(-0.0f))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_xor_ps(_mm_loadu_ps(a + i), _mm_set1_ps(-0.0f))); }
+		for (; i < N; i++) { out[i] = -a[i]; }
+	}
+	static void Fabs(float* out, const float* a)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_loadu_ps(a + i))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_loadu_ps(a + i))); }
+		for (; i < N; i++) { out[i] = fabs(a[i]); }
+	}
+	static void Max(float* out, const float* a, const float* b)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_max_ps(_mm256_loadu_ps(b + i), _mm256_loadu_ps(a + i))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_max_ps(_mm_loadu_ps(b + i), _mm_loadu_ps(a + i))); }
+		for (; i < N; i++) { out[i] = (a[i] < b[i]) ? b[i] : a[i]; }
+	}
+	static void Min(float* out, const float* a, const float* b)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_min_ps(_mm256_loadu_ps(b + i), _mm256_loadu_ps(a + i))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_min_ps(_mm_loadu_ps(b + i), _mm_loadu_ps(a + i))); }
+		for (; i < N; i++) { out[i] = (b[i] < a[i]) ? b[i] : a[i]; }
+	}
+	static void Sqrt(float* out, const float* a)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_loadu_ps(a + i))); }
+#endif
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_loadu_ps(a + i))); }
+		for (; i < N; i++) { out[i] = sqrt(a[i]); }
+	}
+	static void Floor(float* out, const float* a)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_floor_ps(_mm256_loadu_ps(a + i))); }
+#endif
+#ifdef __SSE4_1__
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_floor_ps(_mm_loadu_ps(a + i))); }
+#endif
+		for (; i < N; i++) { out[i] = floor(a[i]); }
+	}
+	static void Ceil(float* out, const float* a)
+	{
+		int i = 0;
+#ifdef __AVX__
+		for (; i + 8 <= N; i += 8) { _mm256_storeu_ps(out + i, _mm256_ceil_ps(_mm256_loadu_ps(a + i))); }
+#endif
+#ifdef __SSE4_1__
+		for (; i + 4 <= N; i += 4) { _mm_storeu_ps(out + i, _mm_ceil_ps(_mm_loadu_ps(a + i))); }
+#endif
+		for (; i < N; i++) { out[i] = ceil(a[i]); }
+	}
+};
+#endif
+
+template <typename TYPE, int N> struct WIDE
+{
+	TYPE lane[N];
+
+	WIDE() = default;
+	WIDE(const int& value) { Fill((TYPE)value); }
+	WIDE(const unsigned& value) { Fill((TYPE)value); }
+	WIDE(const float& value) { Fill((TYPE)value); }
+	WIDE(const double& value) { Fill((TYPE)value); }
+	static WIDE Load(const TYPE* values) { WIDE wide; for (int i = 0; i < N; i++) { wide.lane[i] = values[i]; } return wide; }
+	void Store(TYPE* values) const { for (int i = 0; i < N; i++) { values[i] = lane[i]; } }
+	void Fill(const TYPE& value) { for (int i = 0; i < N; i++) { lane[i] = value; } }
+
+	TYPE& operator[](const int& index) { return lane[index]; }
+	const TYPE& operator[](const int& index) const { return lane[index]; }
+
+	friend WIDE operator+(const WIDE& lhs, const WIDE& rhs) { WIDE result; WideKernels<TYPE, N>::Add(result.lane, lhs.lane, rhs.lane); return result; }
+	friend WIDE operator-(const WIDE& lhs, const WIDE& rhs) { WIDE result; WideKernels<TYPE, N>::Subtract(result.lane, lhs.lane, rhs.lane); return result; }
+	friend WIDE operator*(const WIDE& lhs, const WIDE& rhs) { WIDE result; WideKernels<TYPE, N>::Multiply(result.lane, lhs.lane, rhs.lane); return result; }
+	friend WIDE operator/(const WIDE& lhs, const WIDE& rhs) { WIDE result; WideKernels<TYPE, N>::Divide(result.lane, lhs.lane, rhs.lane); return result; }
+	friend WIDE operator-(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Negate(result.lane, value.lane); return result; }
+	const WIDE& operator+=(const WIDE& rhs) { return *this = *this + rhs; }
+	const WIDE& operator-=(const WIDE& rhs) { return *this = *this - rhs; }
+	const WIDE& operator*=(const WIDE& rhs) { return *this = *this * rhs; }
+	const WIDE& operator/=(const WIDE& rhs) { return *this = *this / rhs; }
+
+	// True when true in every lane (except !=, which is true when any lane differs)
+	friend bool operator==(const WIDE& lhs, const WIDE& rhs) { bool all = true; for (int i = 0; i < N; i++) { all = all && lhs.lane[i] == rhs.lane[i]; } return all; }
+	friend bool operator!=(const WIDE& lhs, const WIDE& rhs) { return !(lhs == rhs); }
+	friend bool operator<(const WIDE& lhs, const WIDE& rhs) { bool all = true; for (int i = 0; i < N; i++) { all = all && lhs.lane[i] < rhs.lane[i]; } return all; }
+	friend bool operator>(const WIDE& lhs, const WIDE& rhs) { return rhs < lhs; }
+	friend bool operator<=(const WIDE& lhs, const WIDE& rhs) { bool all = true; for (int i = 0; i < N; i++) { all = all && lhs.lane[i] <= rhs.lane[i]; } return all; }
+	friend bool operator>=(const WIDE& lhs, const WIDE& rhs) { return rhs <= lhs; }
+
+	// The <math.h> functions and std::max() and std::min() the vector functions call, lane by lane and found through WIDE
+	// arguments only
+	friend WIDE fabs(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Fabs(result.lane, value.lane); return result; }
+	friend WIDE floor(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Floor(result.lane, value.lane); return result; }
+	friend WIDE ceil(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Ceil(result.lane, value.lane); return result; }
+	friend WIDE sqrt(const WIDE& value) { WIDE result; WideKernels<TYPE, N>::Sqrt(result.lane, value.lane); return result; }
+	friend WIDE sin(const WIDE& radians) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = sin(radians.lane[i]); } return result; }
+	friend WIDE cos(const WIDE& radians) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = cos(radians.lane[i]); } return result; }
+	friend WIDE tan(const WIDE& radians) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = tan(radians.lane[i]); } return result; }
+	friend WIDE atan2(const WIDE& y, const WIDE& x) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = atan2(y.lane[i], x.lane[i]); } return result; }
+	friend WIDE exp(const WIDE& value) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = exp(value.lane[i]); } return result; }
+	friend WIDE log(const WIDE& value) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = log(value.lane[i]); } return result; }
+	friend WIDE pow(const WIDE& base, const WIDE& exponent) { WIDE result; for (int i = 0; i < N; i++) { result.lane[i] = pow(base.lane[i], exponent.lane[i]); } return result; }
+	friend WIDE max(const WIDE& a, const WIDE& b) { WIDE result; WideKernels<TYPE, N>::Max(result.lane, a.lane, b.lane); return result; }
+	friend WIDE min(const WIDE& a, const WIDE& b) { WIDE result; WideKernels<TYPE, N>::Min(result.lane, a.lane, b.lane); return result; }
+};
+
+// The per-component helpers that branch, lane by lane instead
+template <typename TYPE, int N> inline WIDE<TYPE, N> ComponentAbs(const WIDE<TYPE, N>& x) { WIDE<TYPE, N> result; for (int i = 0; i < N; i++) { result.lane[i] = ComponentAbs(x.lane[i]); } return result; }
+template <typename TYPE, int N> inline WIDE<TYPE, N> ComponentSign(const WIDE<TYPE, N>& x) { WIDE<TYPE, N> result; for (int i = 0; i < N; i++) { result.lane[i] = ComponentSign(x.lane[i]); } return result; }
+template <typename TYPE, int N> inline WIDE<TYPE, N> ComponentStep(const WIDE<TYPE, N>& edge, const WIDE<TYPE, N>& x) { WIDE<TYPE, N> result; for (int i = 0; i < N; i++) { result.lane[i] = ComponentStep(edge.lane[i], x.lane[i]); } return result; }
+template <typename TYPE, int N> inline WIDE<TYPE, N> ComponentLog2(const WIDE<TYPE, N>& x) { WIDE<TYPE, N> result; for (int i = 0; i < N; i++) { result.lane[i] = ComponentLog2(x.lane[i]); } return result; }
+
+// Vectors of WIDE take WIDE scalars (a plain number fills every lane); AlmostEqual() uses TYPE's epsilon in every lane
+template <typename TYPE, int N> struct ScalarType< WIDE<TYPE, N> >
+{
+	typedef WIDE<TYPE, N> type;
+	static type Epsilon() { WIDE<TYPE, N> epsilon; epsilon.Fill(ScalarType<TYPE>::Epsilon()); return epsilon; }
+};
+template <typename TYPE, int N, typename MASK> struct MaskType< WIDE<TYPE, N>, MASK > { typedef WIDE<MASK, N> type; }; // Lane i is vector i's mask
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+
+
+//----------------------------------------------------------------------
+// 
+// Sec. 03 - SFINAE utilities
+// 
+//----------------------------------------------------------------------
+
+// EnableIf
+template <typename TYPE, typename R, bool b = TYPE::value> struct EnableIf {};
+template <typename TYPE, typename R> struct EnableIf<TYPE, R, true> { typedef R type; };
+
+// Generic types
+template <typename TYPE> struct Is2D { enum { value = false }; };
+template <typename TYPE> struct Is3D { enum { value = false }; };
+template <typename TYPE> struct Is4D { enum { value = false }; };
+
+// Specific type
+template <typename TYPE> struct Is2D< VECTOR2<TYPE> > { enum { value = true }; };
+template <typename TYPE> struct Is3D< VECTOR3<TYPE> > { enum { value = true }; };
+template <typename TYPE> struct Is4D< VECTOR4<TYPE> > { enum { value = true }; };
+
+// Same type
+template <typename A, typename B> struct IsSame { enum { value = false }; };
+template <typename TYPE> struct IsSame<TYPE, TYPE> { enum { value = true }; };
+
+#ifdef SVML_USE_SSE
+// Sum of the x, y, and z lanes (in that order, matching the scalar code)
+inline __m128 SimdHorizontalAdd3(const __m128& a)
+{
+	return _mm_add_ss(_mm_add_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(a, a));
+}
+
+inline SCALAR_TYPE SimdDot3(const __m128& a, const __m128& b)
+{
+	return _mm_cvtss_f32(SimdHorizontalAdd3(_mm_mul_ps(a, b)));
+}
+
+// Takes x, y, and z from xyz and w from w
+inline __m128 SimdReplaceW(const __m128& xyz, const __m128& w)
+{
+	return _mm_shuffle_ps(xyz, _mm_unpackhi_ps(xyz, w), _MM_SHUFFLE(3, 0, 1, 0));
+}
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+// All ones in lane i where bit i of a mask is set
+inline __m128 SimdLaneMask(const unsigned& bits)
+{
+	__m128i lanes = _mm_setr_epi32(1, 2, 4, 8);
+	return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)bits), lanes), lanes));
+}
+
+// The lanes of a where laneMask is all ones, and of b where it is zero
+inline __m128 SimdBlend(const __m128& laneMask, const __m128& a, const __m128& b)
+{
+#ifdef __SSE4_1__
+	return _mm_blendv_ps(b, a, laneMask);
+#else
+	return _mm_or_ps(_mm_and_ps(laneMask, a), _mm_andnot_ps(laneMask, b));
+#endif
+}
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline int SimdDot3i(const __m128i& a, const __m128i& b)
+{
+	__m128i products = _mm_mullo_epi32(a, b);
+	return _mm_cvtsi128_si32(_mm_add_epi32(_mm_add_epi32(products, _mm_shuffle_epi32(products, _MM_SHUFFLE(1, 1, 1, 1))), _mm_shuffle_epi32(products, _MM_SHUFFLE(2, 2, 2, 2))));
+}
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+// Sum of the x, y, and z products, in that order
+inline double SimdDot3d(const __m256d& a, const __m256d& b)
+{
+	__m256d products = _mm256_mul_pd(a, b);
+	__m128d xy = _mm256_castpd256_pd128(products);
+	return _mm_cvtsd_f64(_mm_add_sd(_mm_add_sd(xy, _mm_unpackhi_pd(xy, xy)), _mm256_extractf128_pd(products, 1)));
+}
+#endif // SVML_USE_SSE && __AVX__
+
+#ifdef SVML_USE_SSE
+// 1 / sqrt() of every lane under SVML_PRECISION
+inline __m128 SimdInverseSqrt(const __m128& x)
+{
+#ifdef SVML_FAST_RSQRT
+	__m128 estimate = _mm_rsqrt_ps(x); // Relative error below 1.5 * 2^-12
+#if SVML_PRECISION == SVML_PRECISION_REFINED
+	estimate = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), _mm_mul_ps(estimate, estimate))));
+#endif
+	return estimate;
+#else
+	return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(x));
+#endif
+}
+
+// t^2 (3 - 2 t) with t = (x - edge0) / (edge1 - edge0) clamped to [0, 1]
+inline __m128 SimdSmoothStep(const __m128& edge0, const __m128& edge1, const __m128& x)
+{
+	__m128 t = _mm_div_ps(_mm_sub_ps(x, edge0), _mm_sub_ps(edge1, edge0));
+	t = _mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_setzero_ps(), t));
+	return _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_set1_ps(2.0f), t)));
+}
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+// floor() of every lane. Without SSE4.1: truncate, then step down the lanes that went up (from 2^23 on, every float is
+// whole already)
+inline __m128 SimdFloor(const __m128& x)
+{
+#ifdef __SSE4_1__
+	return _mm_floor_ps(x);
+#else
+	__m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+	truncated = _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, x), _mm_set1_ps(1.0f)));
+	return SimdBlend(_mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), _mm_set1_ps(8388608.0f)), truncated, x);
+#endif
+}
+
+// The lanes of result, and NaN where x is NaN
+inline __m128 SimdKeepNaN(const __m128& x, const __m128& result)
+{
+	return SimdBlend(_mm_cmpunord_ps(x, x), x, result);
+}
+
+// x 2^n for whole n from -252 to 252, with 2^n as two factors so that results in the denormals come out
+inline __m128 SimdScaleByPowerOfTwo(const __m128& x, const __m128i& n)
+{
+	__m128i half = _mm_srai_epi32(n, 1);
+	__m128 first = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(half, _mm_set1_epi32(127)), 23));
+	__m128 second = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(n, half), _mm_set1_epi32(127)), 23));
+	return _mm_mul_ps(_mm_mul_ps(x, first), second);
+}
+
+// e^x (the Cephes expf polynomial: x = n ln 2 + r with |r| <= ln 2 / 2, and e^r from a degree 7 polynomial). Relative
+// error below 1e-7 for normal results. Overflows to infinity above 88.72 and underflows through the denormals to 0 below -103.97
+inline __m128 SimdExp(const __m128& x)
+{
+	__m128 clamped = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-104.0f)), _mm_set1_ps(89.0f));
+	__m128i n = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(1.44269504088896341f))); // Rounded to nearest
+	__m128 fn = _mm_cvtepi32_ps(n);
+	// ln 2 in two parts, the first short enough that fn times it is exact
+	__m128 r = _mm_sub_ps(_mm_sub_ps(clamped, _mm_mul_ps(fn, _mm_set1_ps(0.693359375f))), _mm_mul_ps(fn, _mm_set1_ps(-2.12194440e-4f)));
+	__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(1.9875691500e-4f), r), _mm_set1_ps(1.3981999507e-3f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(8.3334519073e-3f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(4.1665795894e-2f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.6666665459e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.0000001201e-1f));
+	p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, _mm_mul_ps(r, r)), r), _mm_set1_ps(1.0f));
+	return SimdKeepNaN(x, SimdScaleByPowerOfTwo(p, n));
+}
+
+// 2^x (the Cephes exp2f polynomial: x = n + r with |r| <= 1 / 2, and 2^r from a degree 6 polynomial). Relative error
+// below 1.5e-7 for normal results. Overflows to infinity from 128 and underflows through the denormals to 0 below -150
+inline __m128 SimdExp2(const __m128& x)
+{
+	__m128 clamped = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-151.0f)), _mm_set1_ps(129.0f));
+	__m128i n = _mm_cvtps_epi32(clamped);
+	__m128 r = _mm_sub_ps(clamped, _mm_cvtepi32_ps(n));
+	__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(1.535336188319500e-4f), r), _mm_set1_ps(1.339887440266574e-3f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(9.618437357674640e-3f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.550332471162809e-2f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(2.402264791363012e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(6.931472028550421e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.0f));
+	return SimdKeepNaN(x, SimdScaleByPowerOfTwo(p, n));
+}
+
+// The reduction shared by SimdLog() and SimdLog2() (Cephes logf): x = (1 + m) 2^e with 1 + m in [sqrt(1/2), sqrt(2)),
+// and the polynomial part of log(1 + m) = m - m^2 / 2 + m^3 P(m). Denormals are scaled by 2^23 first
+inline __m128 SimdLogReduce(const __m128& x, __m128& m, __m128& e)
+{
+	__m128 denormal = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	__m128i bits = _mm_castps_si128(SimdBlend(denormal, _mm_mul_ps(x, _mm_set1_ps(8388608.0f)), x));
+	__m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000))); // In [0.5, 1)
+	e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+	e = _mm_sub_ps(e, _mm_and_ps(denormal, _mm_set1_ps(23.0f)));
+	// Below sqrt(1/2), twice the mantissa and one less in the exponent
+	__m128 below = _mm_cmplt_ps(mantissa, _mm_set1_ps(0.707106781186547524f));
+	e = _mm_sub_ps(e, _mm_and_ps(below, _mm_set1_ps(1.0f)));
+	m = _mm_sub_ps(_mm_add_ps(mantissa, _mm_and_ps(below, mantissa)), _mm_set1_ps(1.0f));
+	__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(7.0376836292e-2f), m), _mm_set1_ps(-1.1514610310e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.1676998740e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.2420140846e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.4249322787e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.6668057665e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(2.0000714765e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-2.4999993993e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(3.3333331174e-1f));
+	return _mm_mul_ps(_mm_mul_ps(p, m), _mm_mul_ps(m, m));
+}
+
+// The logarithm of 0 is -infinity, of infinity infinity, and of negative numbers and NaN NaN
+inline __m128 SimdLogSpecialValues(const __m128& x, const __m128& result)
+{
+	__m128 infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());
+	__m128 special = SimdBlend(_mm_cmpeq_ps(x, infinity), infinity, result);
+	special = SimdBlend(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_setzero_ps(), infinity), special);
+	return _mm_or_ps(special, _mm_cmpnge_ps(x, _mm_setzero_ps())); // All bits set is a NaN
+}
+
+// Natural logarithm (Cephes logf). Absolute error below 5e-8 for x in [0.5, 2] (around 1, where the result is
+// near 0), relative error below 1e-7 elsewhere
+inline __m128 SimdLog(const __m128& x)
+{
+	__m128 m, e;
+	__m128 y = SimdLogReduce(x, m, e);
+	y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+	y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), _mm_mul_ps(m, m)));
+	return SimdLogSpecialValues(x, _mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(0.693359375f))));
+}
+
+// Base 2 logarithm (Cephes log2f). Powers of two are exact; absolute error below 1e-7 for x in [0.5, 2], relative
+// error below 1e-7 elsewhere
+inline __m128 SimdLog2(const __m128& x)
+{
+	__m128 m, e;
+	__m128 y = SimdLogReduce(x, m, e);
+	y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), _mm_mul_ps(m, m)));
+	// log2(e) - 1, so that the products are small corrections to y + m
+	__m128 log2eMinusOne = _mm_set1_ps(0.44269504088896340736f);
+	__m128 z = _mm_add_ps(_mm_mul_ps(y, log2eMinusOne), _mm_mul_ps(m, log2eMinusOne));
+	return SimdLogSpecialValues(x, _mm_add_ps(_mm_add_ps(_mm_add_ps(z, y), m), e));
+}
+
+// x^y as 2^(y log2(|x|)). Relative error below 1.5e-7 * (1 + |y log2(x)|), so it grows towards the ends of the float
+// range. Negative finite x gives a negative result for odd whole y and NaN for y that is not whole; y = 0 and x = 1
+// give 1 even when the other is NaN, and so does x = -1 with infinite y
+inline __m128 SimdPow(const __m128& x, const __m128& y)
+{
+	__m128 signMask = _mm_set1_ps(-0.0f);
+	__m128 one = _mm_set1_ps(1.0f);
+	__m128 infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());
+	__m128 result = SimdExp2(_mm_mul_ps(y, SimdLog2(_mm_andnot_ps(signMask, x))));
+	__m128 whole = _mm_cmpeq_ps(SimdFloor(y), y);
+	__m128 oddSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_cvttps_epi32(y), 31)); // From 2^31 the conversion gives 0x80000000, and those are even anyway
+	result = _mm_or_ps(result, _mm_and_ps(_mm_and_ps(x, signMask), _mm_and_ps(whole, oddSign)));
+	result = _mm_or_ps(result, _mm_andnot_ps(whole, _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_cmpneq_ps(x, _mm_sub_ps(_mm_setzero_ps(), infinity)))));
+	result = SimdBlend(_mm_and_ps(_mm_cmpeq_ps(x, _mm_set1_ps(-1.0f)), _mm_cmpeq_ps(_mm_andnot_ps(signMask, y), infinity)), one, result);
+	return SimdBlend(_mm_or_ps(_mm_cmpeq_ps(y, _mm_setzero_ps()), _mm_cmpeq_ps(x, one)), one, result);
+}
+
+// Sine and cosine of four angles at once (the Cephes single-precision polynomials: the angle is reduced to within
+// pi / 4 of a multiple of pi / 2 in three steps, then the polynomial for that octant is picked). Within 2e-7 of sin()
+// and cos() up to 8192 radians; lanes past that (and infinities) are done by sin() and cos()
+inline void SimdSinCos(const __m128& angles, __m128& sine, __m128& cosine)
+{
+	__m128 signMask = _mm_set1_ps(-0.0f);
+	__m128 x = _mm_andnot_ps(signMask, angles);
+	__m128 sineSign = _mm_and_ps(angles, signMask);
+
+	// Octant j, rounded up to even, and the angle less j pi / 4
+	__m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+	j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	__m128 y = _mm_cvtepi32_ps(j);
+	x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+	x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+	x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));
+	sineSign = _mm_xor_ps(sineSign, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));
+	__m128 cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+	__m128 sinePolynomial = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+	__m128 z = _mm_mul_ps(x, x);
+	__m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), z), _mm_set1_ps(-1.388731625493765e-3f));
+	c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(4.166664568298827e-2f));
+	c = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(c, z), z), _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+	__m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), z), _mm_set1_ps(8.3321608736e-3f));
+	s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(-1.6666654611e-1f));
+	s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), x), x);
+
+	sine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(sinePolynomial, s), _mm_andnot_ps(sinePolynomial, c)), sineSign);
+	cosine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(sinePolynomial, c), _mm_andnot_ps(sinePolynomial, s)), cosineSign);
+
+	if (_mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(signMask, angles), _mm_set1_ps(8192.0f))) != 0)
+	{
+		float lanes[4], sines[4], cosines[4];
+		_mm_storeu_ps(lanes, angles);
+		_mm_storeu_ps(sines, sine);
+		_mm_storeu_ps(cosines, cosine);
+		for (unsigned lane = 0; lane < 4; lane++)
+		{
+			if (fabs(lanes[lane]) > 8192.0f)
+			{
+				sines[lane] = sin(lanes[lane]);
+				cosines[lane] = cos(lanes[lane]);
+			}
+		}
+		sine = _mm_loadu_ps(sines);
+		cosine = _mm_loadu_ps(cosines);
+	}
+}
+
+inline __m128 SimdSin(const __m128& x) { __m128 sine, cosine; SimdSinCos(x, sine, cosine); return sine; }
+inline __m128 SimdCos(const __m128& x) { __m128 sine, cosine; SimdSinCos(x, sine, cosine); return cosine; }
+// Relative error below 4e-7 up to 8192 radians, except within 1e-3 of the odd multiples of pi / 2 where tan() goes to infinity
+inline __m128 SimdTan(const __m128& x) { __m128 sine, cosine; SimdSinCos(x, sine, cosine); return _mm_div_ps(sine, cosine); }
+
+// atan2(y, x) (the Cephes atanf polynomial for a = min(|x|, |y|) / max(|x|, |y|), which is within [0, 1], then moved
+// into the octant of (x, y)). Relative error below 3e-7. Both zero give 0 or pi with the signs atan2() gives, both
+// infinite the odd multiples of pi / 4, and NaN in either gives NaN
+inline __m128 SimdAtan2(const __m128& y, const __m128& x)
+{
+	__m128 signMask = _mm_set1_ps(-0.0f);
+	__m128 one = _mm_set1_ps(1.0f);
+	__m128 absY = _mm_andnot_ps(signMask, y);
+	__m128 absX = _mm_andnot_ps(signMask, x);
+	__m128 smaller = _mm_min_ps(absY, absX);
+	__m128 larger = _mm_max_ps(absY, absX);
+	__m128 a = SimdBlend(_mm_cmpeq_ps(smaller, larger), one, _mm_div_ps(smaller, larger));
+	a = _mm_andnot_ps(_mm_cmpeq_ps(larger, _mm_setzero_ps()), a);
+	// Above tan(pi / 8), atan(a) = pi / 4 + atan((a - 1) / (a + 1))
+	__m128 above = _mm_cmpgt_ps(a, _mm_set1_ps(0.4142135623730950f));
+	a = SimdBlend(above, _mm_div_ps(_mm_sub_ps(a, one), _mm_add_ps(a, one)), a);
+	__m128 z = _mm_mul_ps(a, a);
+	__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(8.05374449538e-2f), z), _mm_set1_ps(-1.38776856032e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(1.99777106478e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(-3.33329491539e-1f));
+	__m128 angle = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), a), a), _mm_and_ps(above, _mm_set1_ps(0.785398163397448f)));
+	// pi / 2 - angle where |y| > |x|, pi - angle where x is negative (-0 included), then the sign of y
+	angle = SimdBlend(_mm_cmpgt_ps(absY, absX), _mm_sub_ps(_mm_set1_ps(1.570796326794897f), angle), angle);
+	angle = SimdBlend(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31)), _mm_sub_ps(_mm_set1_ps(3.141592653589793f), angle), angle);
+	angle = _mm_or_ps(angle, _mm_and_ps(y, signMask));
+	return _mm_or_ps(angle, _mm_cmpunord_ps(y, x));
+}
+#endif // SVML_USE_SSE && __SSE2__
+
+
+// Expression templates (arithmetic on swizzles is recorded, then evaluated in one pass per component)
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct EXPRESSION2;
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct EXPRESSION3;
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct EXPRESSION4;
+
+// Component type of a vector
+template <typename TYPE> struct ComponentType {};
+template <typename TYPE> struct ComponentType< VECTOR2<TYPE> > { typedef TYPE type; };
+template <typename TYPE> struct ComponentType< VECTOR3<TYPE> > { typedef TYPE type; };
+template <typename TYPE> struct ComponentType< VECTOR4<TYPE> > { typedef TYPE type; };
+
+// Leaf operands
+template <typename TYPE> struct EXPRESSION_SCALAR // TYPE is the scalar type of the vector's components
+{
+	TYPE value;
+	explicit EXPRESSION_SCALAR(const TYPE& value) : value(value) {}
+	TYPE Component(const unsigned&) const { return value; }
+};
+struct EXPRESSION_NONE {}; // Right-hand side of unary operations
+
+// Vectors and swizzles are held by reference, nested expressions and scalars by value
+template <typename OPERAND> struct ExpressionStorage { typedef const OPERAND& type; };
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct ExpressionStorage< EXPRESSION2<TYPE, LHS, RHS, OPERATION> > { typedef const EXPRESSION2<TYPE, LHS, RHS, OPERATION> type; };
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct ExpressionStorage< EXPRESSION3<TYPE, LHS, RHS, OPERATION> > { typedef const EXPRESSION3<TYPE, LHS, RHS, OPERATION> type; };
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION> struct ExpressionStorage< EXPRESSION4<TYPE, LHS, RHS, OPERATION> > { typedef const EXPRESSION4<TYPE, LHS, RHS, OPERATION> type; };
+template <typename TYPE> struct ExpressionStorage< EXPRESSION_SCALAR<TYPE> > { typedef const EXPRESSION_SCALAR<TYPE> type; };
+template <> struct ExpressionStorage<EXPRESSION_NONE> { typedef const EXPRESSION_NONE type; };
+
+// Operations
+struct EXPRESSION_ADD { template <typename TYPE, typename LHS, typename RHS> static TYPE Apply(const unsigned& index, const LHS& lhs, const RHS& rhs) { return lhs.Component(index) + rhs.Component(index); } };
+struct EXPRESSION_SUBTRACT { template <typename TYPE, typename LHS, typename RHS> static TYPE Apply(const unsigned& index, const LHS& lhs, const RHS& rhs) { return lhs.Component(index) - rhs.Component(index); } };
+struct EXPRESSION_MULTIPLY { template <typename TYPE, typename LHS, typename RHS> static TYPE Apply(const unsigned& index, const LHS& lhs, const RHS& rhs) { return lhs.Component(index) * rhs.Component(index); } };
+struct EXPRESSION_DIVIDE { template <typename TYPE, typename LHS, typename RHS> static TYPE Apply(const unsigned& index, const LHS& lhs, const RHS& rhs) { return lhs.Component(index) / rhs.Component(index); } };
+struct EXPRESSION_NEGATE { template <typename TYPE, typename LHS, typename RHS> static TYPE Apply(const unsigned& index, const LHS& lhs, const RHS&) { return (index == 3) ? lhs.Component(index) : -lhs.Component(index); } };
+
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION>
+struct EXPRESSION2
+{
+	typedef VECTOR2<TYPE> PARENT;
+	
+	typename ExpressionStorage<LHS>::type lhs;
+	typename ExpressionStorage<RHS>::type rhs;
+	
+	EXPRESSION2(const LHS& lhs, const RHS& rhs) : lhs(lhs), rhs(rhs) {}
+	
+	TYPE Component(const unsigned& index) const { return OPERATION::template Apply<TYPE>(index, lhs, rhs); }
+	operator VECTOR2<TYPE>() const { return VECTOR2<TYPE>(Component(0), Component(1)); }
+};
+
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION>
+struct EXPRESSION3
+{
+	typedef VECTOR3<TYPE> PARENT;
+	
+	typename ExpressionStorage<LHS>::type lhs;
+	typename ExpressionStorage<RHS>::type rhs;
+	
+	EXPRESSION3(const LHS& lhs, const RHS& rhs) : lhs(lhs), rhs(rhs) {}
+	
+	TYPE Component(const unsigned& index) const { return OPERATION::template Apply<TYPE>(index, lhs, rhs); }
+	operator VECTOR3<TYPE>() const { return VECTOR3<TYPE>(Component(0), Component(1), Component(2)); }
+};
+
+template <typename TYPE, typename LHS, typename RHS, typename OPERATION>
+struct EXPRESSION4
+{
+	typedef VECTOR4<TYPE> PARENT;
+	
+	typename ExpressionStorage<LHS>::type lhs;
+	typename ExpressionStorage<RHS>::type rhs;
+	
+	EXPRESSION4(const LHS& lhs, const RHS& rhs) : lhs(lhs), rhs(rhs) {}
+	
+	TYPE Component(const unsigned& index) const { return OPERATION::template Apply<TYPE>(index, lhs, rhs); }
+	operator VECTOR4<TYPE>() const { return VECTOR4<TYPE>(Component(0), Component(1), Component(2), Component(3)); }
+};
+
+
+// Swizzles: SWIZZLE<VECTOR, I0, I1, I2, I3> is the vector made of components I0, I1, ... of VECTOR, and every
+// swizzle member of a vector is one of these (VECTOR4<TYPE>::zyx is SWIZZLE<VECTOR4<TYPE>, 2, 1, 0>, unused indices are -1)
+
+// Number of components of a vector, and the vector of TYPE with SIZE components (Make() ignores the components it has no room for)
+template <typename VECTOR> struct VectorSize {};
+template <typename TYPE> struct VectorSize< VECTOR2<TYPE> > { enum { value = 2 }; };
+template <typename TYPE> struct VectorSize< VECTOR3<TYPE> > { enum { value = 3 }; };
+template <typename TYPE> struct VectorSize< VECTOR4<TYPE> > { enum { value = 4 }; };
+template <typename TYPE, int SIZE> struct VectorOfSize {};
+template <typename TYPE> struct VectorOfSize<TYPE, 2> { typedef VECTOR2<TYPE> type; static type Make(const TYPE& x, const TYPE& y, const TYPE&, const TYPE&) { return type(x, y); } };
+template <typename TYPE> struct VectorOfSize<TYPE, 3> { typedef VECTOR3<TYPE> type; static type Make(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE&) { return type(x, y, z); } };
+template <typename TYPE> struct VectorOfSize<TYPE, 4> { typedef VECTOR4<TYPE> type; static type Make(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w) { return type(x, y, z, w); } };
+
+// Swizzle writes
+struct SWIZZLE_ASSIGN { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs = rhs; } };
+struct SWIZZLE_ADD { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs += rhs; } };
+struct SWIZZLE_SUBTRACT { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs -= rhs; } };
+struct SWIZZLE_MULTIPLY { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs *= rhs; } };
+struct SWIZZLE_DIVIDE { template <typename TYPE> static void Apply(TYPE& lhs, const TYPE& rhs) { lhs /= rhs; } };
+
+// Scalar right-hand side of a swizzle write (a component, where EXPRESSION_SCALAR holds a ScalarType)
+template <typename TYPE> struct SWIZZLE_SCALAR { const TYPE& value; explicit SWIZZLE_SCALAR(const TYPE& value) : value(value) {} TYPE Component(const unsigned&) const { return value; } };
+
+// The components of VECTOR, shared by all of its swizzles through the union
+template <typename VECTOR>
+struct SVML_MAY_ALIAS SWIZZLE_STORAGE
+{
+protected:
+	typename ComponentType<VECTOR>::type c[VectorSize<VECTOR>::value];
+};
+
+// Swizzles with a repeated component (xxy) are read-only, and most swizzles are, so they get only the reads
+template <typename VECTOR, int I0, int I1 = -1, int I2 = -1, int I3 = -1, bool WRITABLE = (I0 != I1 && I0 != I2 && I0 != I3 && (I2 < 0 || I1 != I2) && (I3 < 0 || (I1 != I3 && I2 != I3)))>
+struct SWIZZLE;
+
+template <typename VECTOR, int I0, int I1, int I2, int I3>
+struct SVML_MAY_ALIAS SWIZZLE<VECTOR, I0, I1, I2, I3, false> : SWIZZLE_STORAGE<VECTOR>
+{
+	typedef typename ComponentType<VECTOR>::type TYPE;
+	enum { COUNT = (I2 < 0) ? 2 : ((I3 < 0) ? 3 : 4) };
+	typedef typename VectorOfSize<TYPE, COUNT>::type PARENT;
+
+	operator PARENT() const { return VectorOfSize<TYPE, COUNT>::Make(this->c[I0], this->c[I1], this->c[(I2 < 0) ? 0 : I2], this->c[(I3 < 0) ? 0 : I3]); }
+	TYPE Component(const unsigned& index) const { return this->c[Index(index)]; }
+
+protected:
+	static int Index(const unsigned& index) { return (index == 0) ? I0 : ((index == 1) ? I1 : ((index == 2) ? I2 : I3)); }
+};
+
+template <typename VECTOR, int I0, int I1, int I2, int I3>
+struct SVML_MAY_ALIAS SWIZZLE<VECTOR, I0, I1, I2, I3, true> : SWIZZLE<VECTOR, I0, I1, I2, I3, false>
+{
+	typedef typename ComponentType<VECTOR>::type TYPE;
+	typedef typename SWIZZLE<VECTOR, I0, I1, I2, I3, false>::PARENT PARENT;
+
+	// From a vector, swizzle or expression of the same size
+	const SWIZZLE& operator=(const PARENT& rhs) { return Write<SWIZZLE_ASSIGN>(rhs); }
+	const SWIZZLE& operator+=(const PARENT& rhs) { return Write<SWIZZLE_ADD>(rhs); }
+	const SWIZZLE& operator-=(const PARENT& rhs) { return Write<SWIZZLE_SUBTRACT>(rhs); }
+	const SWIZZLE& operator*=(const PARENT& rhs) { return Write<SWIZZLE_MULTIPLY>(rhs); }
+	const SWIZZLE& operator/=(const PARENT& rhs) { return Write<SWIZZLE_DIVIDE>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator=(const SOURCE& rhs) { return Write<SWIZZLE_ASSIGN>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator+=(const SOURCE& rhs) { return Write<SWIZZLE_ADD>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator-=(const SOURCE& rhs) { return Write<SWIZZLE_SUBTRACT>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator*=(const SOURCE& rhs) { return Write<SWIZZLE_MULTIPLY>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< typename SOURCE::PARENT, PARENT >, const SWIZZLE& >::type operator/=(const SOURCE& rhs) { return Write<SWIZZLE_DIVIDE>(rhs); }
+	// From the owning vector, its first components (v4.zyx = v4b is v4.zyx = v4b.xyz)
+	template <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator=(const SOURCE& rhs) { return Write<SWIZZLE_ASSIGN>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator+=(const SOURCE& rhs) { return Write<SWIZZLE_ADD>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator-=(const SOURCE& rhs) { return Write<SWIZZLE_SUBTRACT>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator*=(const SOURCE& rhs) { return Write<SWIZZLE_MULTIPLY>(rhs); }
+	template <typename SOURCE> typename EnableIf< IsSame< SOURCE, VECTOR >, const SWIZZLE& >::type operator/=(const SOURCE& rhs) { return Write<SWIZZLE_DIVIDE>(rhs); }
+	const SWIZZLE& operator*=(const TYPE& rhs) { return Write<SWIZZLE_MULTIPLY>(SWIZZLE_SCALAR<TYPE>(rhs)); }
+	const SWIZZLE& operator/=(const TYPE& rhs) { return Write<SWIZZLE_DIVIDE>(SWIZZLE_SCALAR<TYPE>(rhs)); }
+
+private:
+	// Every component is read before any is written, so the right-hand side may read this vector
+	template <typename OPERATION, typename SOURCE> const SWIZZLE& Write(const SOURCE& rhs)
+	{
+		TYPE values[SWIZZLE::COUNT];
+		for (unsigned i = 0; i < SWIZZLE::COUNT; i++) { values[i] = rhs.Component(i); }
+		for (unsigned i = 0; i < SWIZZLE::COUNT; i++) { OPERATION::Apply(this->c[SWIZZLE::Index(i)], values[i]); }
+		return *this;
+	}
+};
+
+// Single components act as the component itself
+template <typename VECTOR, int I0>
+struct SVML_MAY_ALIAS SWIZZLE<VECTOR, I0, -1, -1, -1, true> : SWIZZLE_STORAGE<VECTOR>
+{
+	typedef typename ComponentType<VECTOR>::type TYPE;
+
+	operator TYPE() const { return this->c[I0]; }
+	operator typename WidenedType<TYPE>::type() const { return this->c[I0]; } // HALF components read straight as float
+	const SWIZZLE& operator=(const TYPE& rhs) { this->c[I0] = rhs; return *this; }
+	const SWIZZLE& operator+=(const TYPE& rhs) { this->c[I0] += rhs; return *this; }
+	const SWIZZLE& operator-=(const TYPE& rhs) { this->c[I0] -= rhs; return *this; }
+	const SWIZZLE& operator*=(const TYPE& rhs) { this->c[I0] *= rhs; return *this; }
+	const SWIZZLE& operator/=(const TYPE& rhs) { this->c[I0] /= rhs; return *this; }
+};
+
+} // SVML namespace
+
+#endif // SVML_CORE_H
@@ -0,0 +1,227 @@
+#ifndef SVML_IO_H
+#define SVML_IO_H
+
+/*
+
+SVML - Simple Vector Math Library
+Author: Dwight House ( http://dwighthouse.com )
+Assistance by: Dr. Dmitri Volper, Mike Fried, Jeff Hubbard, Chris Peters
+
+Instructions and Information: https://github.com/dwighthouse/svml
+
+Colossians 3:23-24
+
+Copyright (c) 2010-2015 Dwight House
+
+*/
+
+#include <ostream> // ostream
+#include <sstream> // ostringstream, string
+#include "svml.h"
+
+namespace SVML
+{
+
+//----------------------------------------------------------------------
+// 
+// Sec. 20 - operator<< and ToString() for printing
+// 
+//----------------------------------------------------------------------
+
+using std::string;
+using std::ostream;
+using std::ostringstream;
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// Fixed-point operator<<, as the double it holds
+inline ostream& operator<<(ostream& out, const FIXED& value) { return out << value.ToDouble(); }
+
+// Lane-packed operator<<, every lane in brackets
+template <typename TYPE, int N> ostream& operator<<(ostream& out, const WIDE<TYPE, N>& value)
+{
+	out << "[";
+	for (int i = 0; i < N; i++) { out << ((i > 0) ? ", " : "") << value.lane[i]; }
+	return out << "]";
+}
+
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+// 2D operator<< and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const VECTOR2<TYPE>& printVector)
+{
+	os << "(" << printVector.Component(0) << ", " << printVector.Component(1) << ")";
+	return os;
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, ostream >::type& operator<<(ostream& os, const SWIZZLE& printVector) { return os << typename SWIZZLE::PARENT(printVector); }
+template <typename TYPE> string ToString(const VECTOR2<TYPE>& printVector)
+{
+	std::ostringstream buffer;
+	buffer << printVector;
+	return buffer.str();
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, string >::type ToString(const SWIZZLE& printSwizzle) { return ToString(typename SWIZZLE::PARENT(printSwizzle)); }
+
+// 2D mask operator<< and ToString()
+inline ostream& operator<<(ostream& os, const MASK2& printMask)
+{
+	os << "(" << (printMask[0] ? "true" : "false") << ", " << (printMask[1] ? "true" : "false") << ")";
+	return os;
+}
+inline string ToString(const MASK2& printMask)
+{
+	std::ostringstream buffer;
+	buffer << printMask;
+	return buffer.str();
+}
+
+// 3D operator<< and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const VECTOR3<TYPE>& printVector)
+{
+	os << "(" << printVector.Component(0) << ", " << printVector.Component(1) << ", " << printVector.Component(2) << ")";
+	return os;
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, ostream >::type& operator<<(ostream& os, const SWIZZLE& printVector) { return os << typename SWIZZLE::PARENT(printVector); }
+template <typename TYPE> string ToString(const VECTOR3<TYPE>& printVector)
+{
+	std::ostringstream buffer;
+	buffer << printVector;
+	return buffer.str();
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, string >::type ToString(const SWIZZLE& printSwizzle) { return ToString(typename SWIZZLE::PARENT(printSwizzle)); }
+
+// 3D mask operator<< and ToString()
+inline ostream& operator<<(ostream& os, const MASK3& printMask)
+{
+	os << "(" << (printMask[0] ? "true" : "false") << ", " << (printMask[1] ? "true" : "false") << ", " << (printMask[2] ? "true" : "false") << ")";
+	return os;
+}
+inline string ToString(const MASK3& printMask)
+{
+	std::ostringstream buffer;
+	buffer << printMask;
+	return buffer.str();
+}
+
+// 4D operator<< and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const VECTOR4<TYPE>& printVector)
+{
+	os << "(" << printVector.Component(0) << ", " << printVector.Component(1) << ", " << printVector.Component(2) << ", " << printVector.Component(3) << ")";
+	return os;
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, ostream >::type& operator<<(ostream& os, const SWIZZLE& printVector) { return os << typename SWIZZLE::PARENT(printVector); }
+template <typename TYPE> string ToString(const VECTOR4<TYPE>& printVector)
+{
+	std::ostringstream buffer;
+	buffer << printVector;
+	return buffer.str();
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, string >::type ToString(const SWIZZLE& printSwizzle) { return ToString(typename SWIZZLE::PARENT(printSwizzle)); }
+
+// 4D mask operator<< and ToString()
+inline ostream& operator<<(ostream& os, const MASK4& printMask)
+{
+	os << "(" << (printMask[0] ? "true" : "false") << ", " << (printMask[1] ? "true" : "false") << ", " << (printMask[2] ? "true" : "false") << ", " << (printMask[3] ? "true" : "false") << ")";
+	return os;
+}
+inline string ToString(const MASK4& printMask)
+{
+	std::ostringstream buffer;
+	buffer << printMask;
+	return buffer.str();
+}
+
+// 2x2 operator<< (one column at a time) and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const MATRIX2<TYPE>& printMatrix)
+{
+	os << "(" << printMatrix[0] << ", " << printMatrix[1] << ")";
+	return os;
+}
+template <typename TYPE> string ToString(const MATRIX2<TYPE>& printMatrix)
+{
+	std::ostringstream buffer;
+	buffer << printMatrix;
+	return buffer.str();
+}
+
+// 3x3 operator<< (one column at a time) and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const MATRIX3<TYPE>& printMatrix)
+{
+	os << "(" << printMatrix[0] << ", " << printMatrix[1] << ", " << printMatrix[2] << ")";
+	return os;
+}
+template <typename TYPE> string ToString(const MATRIX3<TYPE>& printMatrix)
+{
+	std::ostringstream buffer;
+	buffer << printMatrix;
+	return buffer.str();
+}
+
+// 4x4 operator<< (one column at a time) and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const MATRIX4<TYPE>& printMatrix)
+{
+	os << "(" << printMatrix[0] << ", " << printMatrix[1] << ", " << printMatrix[2] << ", " << printMatrix[3] << ")";
+	return os;
+}
+template <typename TYPE> string ToString(const MATRIX4<TYPE>& printMatrix)
+{
+	std::ostringstream buffer;
+	buffer << printMatrix;
+	return buffer.str();
+}
+
+// Quaternion operator<< and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const QUATERNION<TYPE>& printQuaternion)
+{
+	os << "(" << printQuaternion.x << ", " << printQuaternion.y << ", " << printQuaternion.z << ", " << printQuaternion.w << ")";
+	return os;
+}
+template <typename TYPE> string ToString(const QUATERNION<TYPE>& printQuaternion)
+{
+	std::ostringstream buffer;
+	buffer << printQuaternion;
+	return buffer.str();
+}
+
+// Rotation operator<< and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const ROTATION2<TYPE>& printRotation)
+{
+	os << "(" << printRotation.c << ", " << printRotation.s << ")";
+	return os;
+}
+template <typename TYPE> string ToString(const ROTATION2<TYPE>& printRotation)
+{
+	std::ostringstream buffer;
+	buffer << printRotation;
+	return buffer.str();
+}
+
+// 2D box operator<< and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const AABB2<TYPE>& printBox)
+{
+	os << "(" << printBox.minimum << ", " << printBox.maximum << ")";
+	return os;
+}
+template <typename TYPE> string ToString(const AABB2<TYPE>& printBox)
+{
+	std::ostringstream buffer;
+	buffer << printBox;
+	return buffer.str();
+}
+
+// 3D box operator<< and ToString()
+template <typename TYPE> ostream& operator<<(ostream& os, const AABB3<TYPE>& printBox)
+{
+	os << "(" << printBox.minimum << ", " << printBox.maximum << ")";
+	return os;
+}
+template <typename TYPE> string ToString(const AABB3<TYPE>& printBox)
+{
+	std::ostringstream buffer;
+	buffer << printBox;
+	return buffer.str();
+}
+
+
+} // SVML namespace
+
+#endif // SVML_IO_H
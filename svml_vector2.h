@@ -0,0 +1,688 @@
+#ifndef SVML_VECTOR2_H
+#define SVML_VECTOR2_H
+
+/*
+
+SVML - Simple Vector Math Library
+Author: Dwight House ( http://dwighthouse.com )
+Assistance by: Dr. Dmitri Volper, Mike Fried, Jeff Hubbard, Chris Peters
+
+Instructions and Information: https://github.com/dwighthouse/svml
+
+Colossians 3:23-24
+
+Copyright (c) 2010-2015 Dwight House
+
+*/
+
+#include "svml_core.h"
+
+namespace SVML
+{
+
+//----------------------------------------------------------------------
+// 
+// Sec. 04 - 2D vector type and associated functions
+// 
+//----------------------------------------------------------------------
+
+template <typename TYPE>
+union VECTOR2
+{
+private:
+	struct { TYPE x, y; } v;
+
+	// Length property
+	struct LENGTH
+	{
+	private:
+		TYPE x, y;
+		TYPE ApplyLength(const TYPE& newMag)
+		{
+			TYPE inverseScaledMagnitude = PrecisionDivideByLength(newMag, x, y);
+			x *= inverseScaledMagnitude;
+			y *= inverseScaledMagnitude;
+			return newMag;
+		}
+		TYPE Magnitude() const { return PrecisionLength(x, y); }
+	public:
+		operator TYPE() const { return Magnitude(); }
+		operator typename WidenedType<TYPE>::type() const { return Magnitude(); }
+		TYPE operator=(const TYPE& rhs) { return ApplyLength(rhs); }
+		TYPE operator+=(const TYPE& rhs) { return ApplyLength(Magnitude() + rhs); }
+		TYPE operator-=(const TYPE& rhs) { return ApplyLength(Magnitude() - rhs); }
+		TYPE operator*=(const TYPE& rhs) { return ApplyLength(Magnitude() * rhs); }
+		TYPE operator/=(const TYPE& rhs) { return ApplyLength(Magnitude() / rhs); }
+	};
+
+public:
+	VECTOR2() {}
+#ifdef SVML_HAS_CONSTEXPR
+	constexpr VECTOR2(const TYPE& x, const TYPE& y) : v{x, y} {}
+#else
+	VECTOR2(const TYPE& x, const TYPE& y) { v.x = x; v.y = y; }
+#endif
+	// From another component type (VECTOR2<float> from VECTOR2<HALF>, say), a cast per component
+	template <typename OTHER> explicit VECTOR2(const VECTOR2<OTHER>& other) { *this = VECTOR2((TYPE)other.Component(0), (TYPE)other.Component(1)); }
+
+	// Swizzle variables
+	SWIZZLE<VECTOR2<TYPE>, 0> x, r, s;
+	SWIZZLE<VECTOR2<TYPE>, 1> y, g, t;
+	SWIZZLE<VECTOR2<TYPE>, 0, 0> xx, rr, ss;
+	SWIZZLE<VECTOR2<TYPE>, 0, 1> xy, rg, st;
+	SWIZZLE<VECTOR2<TYPE>, 1, 0> yx, gr, ts;
+	SWIZZLE<VECTOR2<TYPE>, 1, 1> yy, gg, tt;
+	SWIZZLE<VECTOR2<TYPE>, 0, 0, 0> xxx, rrr, sss;
+	SWIZZLE<VECTOR2<TYPE>, 0, 0, 1> xxy, rrg, sst;
+	SWIZZLE<VECTOR2<TYPE>, 0, 1, 0> xyx, rgr, sts;
+	SWIZZLE<VECTOR2<TYPE>, 0, 1, 1> xyy, rgg, stt;
+	SWIZZLE<VECTOR2<TYPE>, 1, 0, 0> yxx, grr, tss;
+	SWIZZLE<VECTOR2<TYPE>, 1, 0, 1> yxy, grg, tst;
+	SWIZZLE<VECTOR2<TYPE>, 1, 1, 0> yyx, ggr, tts;
+	SWIZZLE<VECTOR2<TYPE>, 1, 1, 1> yyy, ggg, ttt;
+	SWIZZLE<VECTOR2<TYPE>, 0, 0, 0, 0> xxxx, rrrr, ssss;
+	SWIZZLE<VECTOR2<TYPE>, 0, 0, 0, 1> xxxy, rrrg, ssst;
+	SWIZZLE<VECTOR2<TYPE>, 0, 0, 1, 0> xxyx, rrgr, ssts;
+	SWIZZLE<VECTOR2<TYPE>, 0, 0, 1, 1> xxyy, rrgg, sstt;
+	SWIZZLE<VECTOR2<TYPE>, 0, 1, 0, 0> xyxx, rgrr, stss;
+	SWIZZLE<VECTOR2<TYPE>, 0, 1, 0, 1> xyxy, rgrg, stst;
+	SWIZZLE<VECTOR2<TYPE>, 0, 1, 1, 0> xyyx, rggr, stts;
+	SWIZZLE<VECTOR2<TYPE>, 0, 1, 1, 1> xyyy, rggg, sttt;
+	SWIZZLE<VECTOR2<TYPE>, 1, 0, 0, 0> yxxx, grrr, tsss;
+	SWIZZLE<VECTOR2<TYPE>, 1, 0, 0, 1> yxxy, grrg, tsst;
+	SWIZZLE<VECTOR2<TYPE>, 1, 0, 1, 0> yxyx, grgr, tsts;
+	SWIZZLE<VECTOR2<TYPE>, 1, 0, 1, 1> yxyy, grgg, tstt;
+	SWIZZLE<VECTOR2<TYPE>, 1, 1, 0, 0> yyxx, ggrr, ttss;
+	SWIZZLE<VECTOR2<TYPE>, 1, 1, 0, 1> yyxy, ggrg, ttst;
+	SWIZZLE<VECTOR2<TYPE>, 1, 1, 1, 0> yyyx, gggr, ttts;
+	SWIZZLE<VECTOR2<TYPE>, 1, 1, 1, 1> yyyy, gggg, tttt;
+
+	// Length property
+	LENGTH Length;
+
+	// Assignment operators (default for = is fine)
+	const VECTOR2& operator+=(const VECTOR2& rhs) { v.x += rhs.v.x; v.y += rhs.v.y; return *this; }
+	const VECTOR2& operator-=(const VECTOR2& rhs) { v.x -= rhs.v.x; v.y -= rhs.v.y; return *this; }
+	const VECTOR2& operator*=(const VECTOR2& rhs) { v.x *= rhs.v.x; v.y *= rhs.v.y; return *this; }
+	const VECTOR2& operator/=(const VECTOR2& rhs) { v.x /= rhs.v.x; v.y /= rhs.v.y; return *this; }
+	const VECTOR2& operator*=(const TYPE& rhs) { v.x *= rhs; v.y *= rhs; return *this; }
+	const VECTOR2& operator/=(const TYPE& rhs) { v.x /= rhs; v.y /= rhs; return *this; }
+
+	// Component access for expression templates and constant expressions
+	SVML_CONSTEXPR TYPE Component(const unsigned& index) const { return (index == 0) ? v.x : (v.y); }
+
+	// Array notation access
+	const TYPE& operator[](const unsigned& index)
+	{
+		if (index == 0) { return v.x; }
+		else if (index == 1) { return v.y; }
+		else { FatalError("Attempted out of bounds bracket access of 2D vector.", index); }
+	}
+
+	// Negation
+	SVML_CONSTEXPR VECTOR2 operator-() const { return VECTOR2(-v.x, -v.y); }
+
+#ifdef SVML_FAST_RSQRT
+	void Normalize() { *this *= PrecisionDivideByLength((TYPE)1, v.x, v.y); }
+#else
+	void Normalize() { *this /= this->Length; }
+#endif
+};
+
+// 2D Negate [-]
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_NONE, EXPRESSION_NEGATE > >::type operator-(const SWIZZLE& toNegate)
+{
+	return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_NONE, EXPRESSION_NEGATE >(toNegate, EXPRESSION_NONE());
+}
+
+// 2D Addition [+]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_ADD > >::type >::type operator+(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_ADD >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR2<TYPE>, EXPRESSION_ADD > >::type operator+(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR2<TYPE>, EXPRESSION_ADD >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR2<TYPE>, SWIZZLE, EXPRESSION_ADD > >::type operator+(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR2<TYPE>, SWIZZLE, EXPRESSION_ADD >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> operator+(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return VECTOR2<TYPE>(lhs.Component(0) + rhs.Component(0), lhs.Component(1) + rhs.Component(1));
+}
+
+// 2D Subtraction [-]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_SUBTRACT > >::type >::type operator-(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR2<TYPE>, EXPRESSION_SUBTRACT > >::type operator-(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR2<TYPE>, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR2<TYPE>, SWIZZLE, EXPRESSION_SUBTRACT > >::type operator-(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR2<TYPE>, SWIZZLE, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> operator-(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return VECTOR2<TYPE>(lhs.Component(0) - rhs.Component(0), lhs.Component(1) - rhs.Component(1));
+}
+
+// 2D Multiplication [*]: Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_MULTIPLY > >::type >::type operator*(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR2<TYPE>, EXPRESSION_MULTIPLY > >::type operator*(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR2<TYPE>, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR2<TYPE>, SWIZZLE, EXPRESSION_MULTIPLY > >::type operator*(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR2<TYPE>, SWIZZLE, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> operator*(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return VECTOR2<TYPE>(lhs.Component(0) * rhs.Component(0), lhs.Component(1) * rhs.Component(1));
+}
+
+// 2D Division [/]: Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_DIVIDE > >::type >::type operator/(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR2<TYPE>, EXPRESSION_DIVIDE > >::type operator/(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR2<TYPE>, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR2<TYPE>, SWIZZLE, EXPRESSION_DIVIDE > >::type operator/(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR2<TYPE>, SWIZZLE, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> operator/(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return VECTOR2<TYPE>(lhs.Component(0) / rhs.Component(0), lhs.Component(1) / rhs.Component(1));
+}
+
+// 2D Multiplication [*]: Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_MULTIPLY > >::type operator*(const SWIZZLE& lhs, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_MULTIPLY >(lhs, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(rhs)); }
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_MULTIPLY > >::type operator*(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& lhs, const SWIZZLE& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_MULTIPLY >(EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(lhs), rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> operator*(const VECTOR2<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs)
+{
+	return VECTOR2<TYPE>(lhs.Component(0) * rhs, lhs.Component(1) * rhs);
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return VECTOR2<TYPE>(lhs * rhs.Component(0), lhs * rhs.Component(1));
+}
+
+// 2D Division [/]: Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_DIVIDE > >::type operator/(const SWIZZLE& lhs, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_DIVIDE >(lhs, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(rhs)); }
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_DIVIDE > >::type operator/(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& lhs, const SWIZZLE& rhs) { return EXPRESSION2< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_DIVIDE >(EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(lhs), rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> operator/(const VECTOR2<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs)
+{
+	return VECTOR2<TYPE>(lhs.Component(0) / rhs, lhs.Component(1) / rhs);
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> operator/(const typename ScalarType<TYPE>::type& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return VECTOR2<TYPE>(lhs / rhs.Component(0), lhs / rhs.Component(1));
+}
+
+// 2D component-wise comparison result: bit i is set where component i compared true
+struct MASK2
+{
+	unsigned bits;
+
+	// Constructors
+	SVML_CONSTEXPR MASK2() : bits(0) {}
+	SVML_CONSTEXPR MASK2(const bool& x, const bool& y) : bits((x ? 1u : 0u) | (y ? 2u : 0u)) {}
+	static SVML_CONSTEXPR MASK2 FromBits(const unsigned& bits) { return MASK2(bits & 3u, 0); } // Only the low 2 bits are kept
+
+	SVML_CONSTEXPR bool operator[](const unsigned& index) const { return ((bits >> index) & 1u) != 0; }
+
+private:
+	SVML_CONSTEXPR MASK2(const unsigned& bits, int) : bits(bits) {}
+};
+
+// 2D mask [&], [|], [^], [!], [==], [!=], Any(), All()
+SVML_CONSTEXPR MASK2 operator&(const MASK2& lhs, const MASK2& rhs) { return MASK2::FromBits(lhs.bits & rhs.bits); }
+SVML_CONSTEXPR MASK2 operator|(const MASK2& lhs, const MASK2& rhs) { return MASK2::FromBits(lhs.bits | rhs.bits); }
+SVML_CONSTEXPR MASK2 operator^(const MASK2& lhs, const MASK2& rhs) { return MASK2::FromBits(lhs.bits ^ rhs.bits); }
+SVML_CONSTEXPR MASK2 operator!(const MASK2& mask) { return MASK2::FromBits(~mask.bits); }
+SVML_CONSTEXPR bool operator==(const MASK2& lhs, const MASK2& rhs) { return lhs.bits == rhs.bits; }
+SVML_CONSTEXPR bool operator!=(const MASK2& lhs, const MASK2& rhs) { return lhs.bits != rhs.bits; }
+SVML_CONSTEXPR bool Any(const MASK2& mask) { return mask.bits != 0; }
+SVML_CONSTEXPR bool All(const MASK2& mask) { return mask.bits == 3u; }
+
+// 2D Equal To [==]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator==(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) == typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator==(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) == rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator==(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs == typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator==(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return !(lhs.Component(0) != rhs.Component(0) || lhs.Component(1) != rhs.Component(1));
+}
+
+// 2D Not Equal To [!=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator!=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) != typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator!=(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) != rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator!=(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs != typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator!=(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return lhs.Component(0) != rhs.Component(0) || lhs.Component(1) != rhs.Component(1);
+}
+
+// 2D AlmostEqual()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type AlmostEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqual((typename SWIZZLE0::PARENT(lhs)), (typename SWIZZLE1::PARENT(rhs))); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return AlmostEqual((typename SWIZZLE::PARENT(lhs)), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqual(lhs, (typename SWIZZLE::PARENT(rhs))); }
+template <typename TYPE> bool AlmostEqual(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return fabs(lhs.Component(0) - rhs.Component(0)) < ScalarType<TYPE>::Epsilon() && fabs(lhs.Component(1) - rhs.Component(1)) < ScalarType<TYPE>::Epsilon();
+}
+
+// 2D Less Than [<]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) < typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator<(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) < rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator<(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs < typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator<(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return lhs.Component(0) < rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && lhs.Component(1) < rhs.Component(1));
+}
+
+// 2D Greater Than [>]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) > typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator>(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) > rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator>(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs > typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator>(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return lhs.Component(0) > rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && lhs.Component(1) > rhs.Component(1));
+}
+
+// 2D Less Than Or Equal To [<=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) <= typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator<=(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) <= rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator<=(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs <= typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator<=(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return lhs.Component(0) < rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && lhs.Component(1) <= rhs.Component(1));
+}
+
+// 2D Greater Than Or Equal To [<=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) >= typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator>=(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) >= rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, bool >::type operator>=(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return lhs >= typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator>=(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs)
+{
+	return lhs.Component(0) > rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && lhs.Component(1) >= rhs.Component(1));
+}
+
+// 2D component-wise comparisons: Equal(), NotEqual(), AlmostEqualMask(), LessThan(), GreaterThan(), LessThanEqual(), GreaterThanEqual()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK2 >::type >::type >::type Equal(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return Equal(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type Equal(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return Equal(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type Equal(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return Equal(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK2 Equal(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs) { return MASK2(lhs.Component(0) == rhs.Component(0), lhs.Component(1) == rhs.Component(1)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK2 >::type >::type >::type NotEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return NotEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type NotEqual(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return NotEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type NotEqual(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return NotEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK2 NotEqual(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs) { return MASK2(lhs.Component(0) != rhs.Component(0), lhs.Component(1) != rhs.Component(1)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK2 >::type >::type >::type AlmostEqualMask(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqualMask(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type AlmostEqualMask(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return AlmostEqualMask(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type AlmostEqualMask(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqualMask(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> inline MASK2 AlmostEqualMask(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs) { return MASK2(fabs(lhs.Component(0) - rhs.Component(0)) < ScalarType<TYPE>::Epsilon(), fabs(lhs.Component(1) - rhs.Component(1)) < ScalarType<TYPE>::Epsilon()); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK2 >::type >::type >::type LessThan(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return LessThan(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type LessThan(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return LessThan(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type LessThan(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return LessThan(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK2 LessThan(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs) { return MASK2(lhs.Component(0) < rhs.Component(0), lhs.Component(1) < rhs.Component(1)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK2 >::type >::type >::type GreaterThan(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return GreaterThan(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type GreaterThan(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return GreaterThan(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type GreaterThan(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return GreaterThan(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK2 GreaterThan(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs) { return MASK2(lhs.Component(0) > rhs.Component(0), lhs.Component(1) > rhs.Component(1)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK2 >::type >::type >::type LessThanEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return LessThanEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type LessThanEqual(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return LessThanEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type LessThanEqual(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return LessThanEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK2 LessThanEqual(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs) { return MASK2(lhs.Component(0) <= rhs.Component(0), lhs.Component(1) <= rhs.Component(1)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK2 >::type >::type >::type GreaterThanEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return GreaterThanEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type GreaterThanEqual(const SWIZZLE& lhs, const VECTOR2<TYPE>& rhs) { return GreaterThanEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK2>::type >::type GreaterThanEqual(const VECTOR2<TYPE>& lhs, const SWIZZLE& rhs) { return GreaterThanEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK2 GreaterThanEqual(const VECTOR2<TYPE>& lhs, const VECTOR2<TYPE>& rhs) { return MASK2(lhs.Component(0) >= rhs.Component(0), lhs.Component(1) >= rhs.Component(1)); }
+
+// 2D Select(): Component-wise mask ? a : b
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Select(const typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK2 >::type& mask, const SWIZZLE0& a, const SWIZZLE1& b) { return Select(mask, typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Select(const typename MaskType<TYPE, MASK2>::type& mask, const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Select(mask, typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Select(const typename MaskType<TYPE, MASK2>::type& mask, const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Select(mask, a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> Select(const MASK2& mask, const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+{
+	return VECTOR2<TYPE>(mask[0] ? a.Component(0) : b.Component(0), mask[1] ? a.Component(1) : b.Component(1));
+}
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// 2D component-wise comparisons of vectors of WIDE, into a mask per lane
+template <typename TYPE, int N> WIDE<MASK2, N> Equal(const VECTOR2< WIDE<TYPE, N> >& lhs, const VECTOR2< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1);
+	WIDE<MASK2, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK2(lhs0.lane[i] == rhs0.lane[i], lhs1.lane[i] == rhs1.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK2, N> NotEqual(const VECTOR2< WIDE<TYPE, N> >& lhs, const VECTOR2< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1);
+	WIDE<MASK2, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK2(lhs0.lane[i] != rhs0.lane[i], lhs1.lane[i] != rhs1.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK2, N> AlmostEqualMask(const VECTOR2< WIDE<TYPE, N> >& lhs, const VECTOR2< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1);
+	WIDE<MASK2, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK2(fabs(lhs0.lane[i] - rhs0.lane[i]) < ScalarType<TYPE>::Epsilon(), fabs(lhs1.lane[i] - rhs1.lane[i]) < ScalarType<TYPE>::Epsilon()); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK2, N> LessThan(const VECTOR2< WIDE<TYPE, N> >& lhs, const VECTOR2< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1);
+	WIDE<MASK2, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK2(lhs0.lane[i] < rhs0.lane[i], lhs1.lane[i] < rhs1.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK2, N> GreaterThan(const VECTOR2< WIDE<TYPE, N> >& lhs, const VECTOR2< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1);
+	WIDE<MASK2, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK2(lhs0.lane[i] > rhs0.lane[i], lhs1.lane[i] > rhs1.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK2, N> LessThanEqual(const VECTOR2< WIDE<TYPE, N> >& lhs, const VECTOR2< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1);
+	WIDE<MASK2, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK2(lhs0.lane[i] <= rhs0.lane[i], lhs1.lane[i] <= rhs1.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK2, N> GreaterThanEqual(const VECTOR2< WIDE<TYPE, N> >& lhs, const VECTOR2< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1);
+	WIDE<MASK2, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK2(lhs0.lane[i] >= rhs0.lane[i], lhs1.lane[i] >= rhs1.lane[i]); }
+	return result;
+}
+
+// 2D masks per lane [&], [|], [^], [!], Any(), All(), lane by lane
+template <int N> WIDE<MASK2, N> operator&(const WIDE<MASK2, N>& lhs, const WIDE<MASK2, N>& rhs) { WIDE<MASK2, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] & rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK2, N> operator|(const WIDE<MASK2, N>& lhs, const WIDE<MASK2, N>& rhs) { WIDE<MASK2, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] | rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK2, N> operator^(const WIDE<MASK2, N>& lhs, const WIDE<MASK2, N>& rhs) { WIDE<MASK2, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] ^ rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK2, N> operator!(const WIDE<MASK2, N>& mask) { WIDE<MASK2, N> result; for (int i = 0; i < N; i++) { result.lane[i] = !mask.lane[i]; } return result; }
+template <int N> WIDE<bool, N> Any(const WIDE<MASK2, N>& mask) { WIDE<bool, N> result; for (int i = 0; i < N; i++) { result.lane[i] = Any(mask.lane[i]); } return result; }
+template <int N> WIDE<bool, N> All(const WIDE<MASK2, N>& mask) { WIDE<bool, N> result; for (int i = 0; i < N; i++) { result.lane[i] = All(mask.lane[i]); } return result; }
+
+// 2D Select() by a mask per lane: per component and lane, a where the lane's mask is set and b elsewhere
+template <typename TYPE, int N> VECTOR2< WIDE<TYPE, N> > Select(const WIDE<MASK2, N>& mask, const VECTOR2< WIDE<TYPE, N> >& a, const VECTOR2< WIDE<TYPE, N> >& b)
+{
+	WIDE<TYPE, N> a0 = a.Component(0), b0 = b.Component(0), a1 = a.Component(1), b1 = b.Component(1);
+	for (int i = 0; i < N; i++)
+	{
+		if (mask.lane[i][0]) { b0.lane[i] = a0.lane[i]; }
+		if (mask.lane[i][1]) { b1.lane[i] = a1.lane[i]; }
+	}
+	return VECTOR2< WIDE<TYPE, N> >(b0, b1);
+}
+
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+// 2D Normalize()
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Normalize(const SWIZZLE& toNormalize) { return Normalize(typename SWIZZLE::PARENT(toNormalize)); }
+template <typename TYPE> VECTOR2<TYPE> Normalize(const VECTOR2<TYPE>& toNormalize)
+{
+#ifdef SVML_FAST_RSQRT
+	return toNormalize * PrecisionDivideByLength((TYPE)1, toNormalize.Component(0), toNormalize.Component(1));
+#else
+	return toNormalize / toNormalize.Length;
+#endif
+}
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// 2D fixed-point Normalize(), each component divided by the length summed in 64 bits
+inline VECTOR2<FIXED> Normalize(const VECTOR2<FIXED>& toNormalize)
+{
+	return VECTOR2<FIXED>(PrecisionDivideByLength(toNormalize.Component(0), toNormalize.Component(0), toNormalize.Component(1)), PrecisionDivideByLength(toNormalize.Component(1), toNormalize.Component(0), toNormalize.Component(1)));
+}
+template <> inline void VECTOR2<FIXED>::Normalize() { *this = SVML::Normalize(*this); }
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+// 2D Dot()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type Dot(const SWIZZLE0& a, const SWIZZLE1& b) { return Dot(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Dot(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Dot(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Dot(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Dot(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR typename ScalarType<TYPE>::type Dot(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+{
+	return a.Component(0) * b.Component(0) + a.Component(1) * b.Component(1);
+}
+
+// 2D Perpendicular()
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Perpendicular(const SWIZZLE& toPerpendicular) { return Perpendicular(typename SWIZZLE::PARENT(toPerpendicular)); }
+template <typename TYPE> VECTOR2<TYPE> Perpendicular(const VECTOR2<TYPE>& toPerpendicular)
+{
+	return VECTOR2<TYPE>(-toPerpendicular.y, toPerpendicular.x);
+}
+
+// 2D Project()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Project(const SWIZZLE0& projectThis, const SWIZZLE1& ontoThis) { return Project(typename SWIZZLE0::PARENT(projectThis), typename SWIZZLE1::PARENT(ontoThis)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const SWIZZLE& projectThis, const VECTOR2<TYPE>& ontoThis) { return Project(typename SWIZZLE::PARENT(projectThis), ontoThis); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const VECTOR2<TYPE>& projectThis, const SWIZZLE& ontoThis) { return Project(projectThis, typename SWIZZLE::PARENT(ontoThis)); }
+template <typename TYPE> VECTOR2<TYPE> Project(const VECTOR2<TYPE>& projectThis, const VECTOR2<TYPE>& ontoThis)
+{
+	return (Dot(projectThis, ontoThis) / Dot(ontoThis, ontoThis)) * ontoThis;
+}
+
+// 2D Rotate()
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& vector, const typename RealType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& angle) { return Rotate(typename SWIZZLE::PARENT(vector), angle); }
+template <typename TYPE> VECTOR2<TYPE> Rotate(const VECTOR2<TYPE>& vector, const typename RealType<TYPE>::type& angle)
+{
+	return Rotate(vector, ROTATION2< typename RealType<TYPE>::type >(angle));
+}
+
+// 2D Lerp()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Lerp(const SWIZZLE0& start, const SWIZZLE1& end, const typename RealType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type& delta) { return Lerp(typename SWIZZLE0::PARENT(start), typename SWIZZLE1::PARENT(end), delta); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const SWIZZLE& start, const VECTOR2<TYPE>& end, const typename RealType<TYPE>::type& delta) { return Lerp(typename SWIZZLE::PARENT(start), end, delta); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const VECTOR2<TYPE>& start, const SWIZZLE& end, const typename RealType<TYPE>::type& delta) { return Lerp(start, typename SWIZZLE::PARENT(end), delta); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> Lerp(const VECTOR2<TYPE>& start, const VECTOR2<TYPE>& end, const typename RealType<TYPE>::type& delta)
+{
+	return VECTOR2<TYPE>(start.Component(0) + delta * (end.Component(0) - start.Component(0)),
+	                     start.Component(1) + delta * (end.Component(1) - start.Component(1)));
+}
+
+// 2D Max(): Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Max(const SWIZZLE0& a, const SWIZZLE1& b) { return Max(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Max(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Max(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> Max(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+{
+	return VECTOR2<TYPE>(max(a.Component(0), b.Component(0)), max(a.Component(1), b.Component(1)));
+}
+
+// 2D Min(): Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Min(const SWIZZLE0& a, const SWIZZLE1& b) { return Min(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Min(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Min(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> Min(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+{
+	return VECTOR2<TYPE>(min(a.Component(0), b.Component(0)), min(a.Component(1), b.Component(1)));
+}
+
+// 2D Max(): Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum) { return Max(typename SWIZZLE::PARENT(a), maximum); }
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum, const SWIZZLE& b) { return Max(maximum, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> Max(const VECTOR2<TYPE>& a, const typename ScalarType<TYPE>::type& maximum)
+{
+	return VECTOR2<TYPE>(max((typename ScalarType<TYPE>::type)a.Component(0), maximum), max((typename ScalarType<TYPE>::type)a.Component(1), maximum));
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> Max(const typename ScalarType<TYPE>::type& maximum, const VECTOR2<TYPE>& b)
+{
+	return VECTOR2<TYPE>(max(maximum, (typename ScalarType<TYPE>::type)b.Component(0)), max(maximum, (typename ScalarType<TYPE>::type)b.Component(1)));
+}
+
+// 2D Min(): Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum) { return Min(typename SWIZZLE::PARENT(a), minimum); }
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum, const SWIZZLE& b) { return Min(minimum, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> Min(const VECTOR2<TYPE>& a, const typename ScalarType<TYPE>::type& minimum)
+{
+	return VECTOR2<TYPE>(min((typename ScalarType<TYPE>::type)a.Component(0), minimum), min((typename ScalarType<TYPE>::type)a.Component(1), minimum));
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR2<TYPE> Min(const typename ScalarType<TYPE>::type& minimum, const VECTOR2<TYPE>& b)
+{
+	return VECTOR2<TYPE>(min(minimum, (typename ScalarType<TYPE>::type)b.Component(0)), min(minimum, (typename ScalarType<TYPE>::type)b.Component(1)));
+}
+
+// 2D Ceil()
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Ceil(const SWIZZLE& toCeil) { return Ceil(typename SWIZZLE::PARENT(toCeil)); }
+template <typename TYPE> VECTOR2<TYPE> Ceil(const VECTOR2<TYPE>& toCeil)
+{
+	return VECTOR2<TYPE>(ceil(toCeil.Component(0)), ceil(toCeil.Component(1)));
+}
+
+// 2D Floor()
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Floor(const SWIZZLE& toFloor) { return Floor(typename SWIZZLE::PARENT(toFloor)); }
+template <typename TYPE> VECTOR2<TYPE> Floor(const VECTOR2<TYPE>& toFloor)
+{
+	return VECTOR2<TYPE>(floor(toFloor.Component(0)), floor(toFloor.Component(1)));
+}
+
+// 2D Abs(), Sign()
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Abs(const SWIZZLE& a) { return Abs(typename SWIZZLE::PARENT(a)); }
+template <typename TYPE> VECTOR2<TYPE> Abs(const VECTOR2<TYPE>& a)
+{
+	return VECTOR2<TYPE>(ComponentAbs((typename ScalarType<TYPE>::type)a.Component(0)), ComponentAbs((typename ScalarType<TYPE>::type)a.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sign(const SWIZZLE& a) { return Sign(typename SWIZZLE::PARENT(a)); }
+template <typename TYPE> VECTOR2<TYPE> Sign(const VECTOR2<TYPE>& a)
+{
+	return VECTOR2<TYPE>(ComponentSign((typename ScalarType<TYPE>::type)a.Component(0)), ComponentSign((typename ScalarType<TYPE>::type)a.Component(1)));
+}
+
+// 2D Clamp(), Saturate(): min(max(x, minimum), maximum), component-wise or by scalars
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Clamp(const SWIZZLE& x, const typename SWIZZLE::PARENT& minimum, const typename SWIZZLE::PARENT& maximum) { return Clamp(typename SWIZZLE::PARENT(x), minimum, maximum); }
+template <typename TYPE> VECTOR2<TYPE> Clamp(const VECTOR2<TYPE>& x, const VECTOR2<TYPE>& minimum, const VECTOR2<TYPE>& maximum)
+{
+	return VECTOR2<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)minimum.Component(0), (typename ScalarType<TYPE>::type)maximum.Component(0)), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)minimum.Component(1), (typename ScalarType<TYPE>::type)maximum.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Clamp(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum) { return Clamp(typename SWIZZLE::PARENT(x), minimum, maximum); }
+template <typename TYPE> VECTOR2<TYPE> Clamp(const VECTOR2<TYPE>& x, const typename ScalarType<TYPE>::type& minimum, const typename ScalarType<TYPE>::type& maximum)
+{
+	return VECTOR2<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), minimum, maximum), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), minimum, maximum));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Saturate(const SWIZZLE& x) { return Saturate(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Saturate(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1));
+}
+
+// 2D Step(): 0 where x < edge, otherwise 1. SmoothStep(): Hermite interpolation between 0 at edge0 and 1 at edge1
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Step(const SWIZZLE0& edge, const SWIZZLE1& x) { return Step(typename SWIZZLE0::PARENT(edge), typename SWIZZLE1::PARENT(x)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const SWIZZLE& edge, const VECTOR2<TYPE>& x) { return Step(typename SWIZZLE::PARENT(edge), x); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const VECTOR2<TYPE>& edge, const SWIZZLE& x) { return Step(edge, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Step(const VECTOR2<TYPE>& edge, const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(ComponentStep((typename ScalarType<TYPE>::type)edge.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), ComponentStep((typename ScalarType<TYPE>::type)edge.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge, const SWIZZLE& x) { return Step(edge, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Step(const typename ScalarType<TYPE>::type& edge, const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(0)), ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type SmoothStep(const typename SWIZZLE::PARENT& edge0, const typename SWIZZLE::PARENT& edge1, const SWIZZLE& x) { return SmoothStep(edge0, edge1, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> SmoothStep(const VECTOR2<TYPE>& edge0, const VECTOR2<TYPE>& edge1, const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(0), (typename ScalarType<TYPE>::type)edge1.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(1), (typename ScalarType<TYPE>::type)edge1.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type SmoothStep(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge0, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge1, const SWIZZLE& x) { return SmoothStep(edge0, edge1, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> SmoothStep(const typename ScalarType<TYPE>::type& edge0, const typename ScalarType<TYPE>::type& edge1, const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(0)), ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(1)));
+}
+
+// 2D Fract(): x - Floor(x). Mod(): x - y * Floor(x / y), so the result takes the sign of y
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Fract(const SWIZZLE& x) { return Fract(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Fract(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(ComponentFract((typename ScalarType<TYPE>::type)x.Component(0)), ComponentFract((typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Mod(const SWIZZLE0& x, const SWIZZLE1& y) { return Mod(typename SWIZZLE0::PARENT(x), typename SWIZZLE1::PARENT(y)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const SWIZZLE& x, const VECTOR2<TYPE>& y) { return Mod(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const VECTOR2<TYPE>& x, const SWIZZLE& y) { return Mod(x, typename SWIZZLE::PARENT(y)); }
+template <typename TYPE> VECTOR2<TYPE> Mod(const VECTOR2<TYPE>& x, const VECTOR2<TYPE>& y)
+{
+	return VECTOR2<TYPE>(ComponentMod((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)y.Component(0)), ComponentMod((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)y.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& y) { return Mod(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE> VECTOR2<TYPE> Mod(const VECTOR2<TYPE>& x, const typename ScalarType<TYPE>::type& y)
+{
+	return VECTOR2<TYPE>(ComponentMod((typename ScalarType<TYPE>::type)x.Component(0), y), ComponentMod((typename ScalarType<TYPE>::type)x.Component(1), y));
+}
+
+// 2D Sqrt(), InverseSqrt(): the second under SVML_PRECISION
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sqrt(const SWIZZLE& x) { return Sqrt(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Sqrt(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(sqrt((typename ScalarType<TYPE>::type)x.Component(0)), sqrt((typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type InverseSqrt(const SWIZZLE& x) { return InverseSqrt(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> InverseSqrt(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(0)), PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(1)));
+}
+
+// 2D Exp(), Exp2(), Log(), Log2(), Pow()
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Exp(const SWIZZLE& x) { return Exp(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Exp(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(exp((typename ScalarType<TYPE>::type)x.Component(0)), exp((typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Exp2(const SWIZZLE& x) { return Exp2(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Exp2(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(0)), pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Log(const SWIZZLE& x) { return Log(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Log(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(log((typename ScalarType<TYPE>::type)x.Component(0)), log((typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Log2(const SWIZZLE& x) { return Log2(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Log2(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(ComponentLog2((typename ScalarType<TYPE>::type)x.Component(0)), ComponentLog2((typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Pow(const SWIZZLE0& x, const SWIZZLE1& y) { return Pow(typename SWIZZLE0::PARENT(x), typename SWIZZLE1::PARENT(y)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const SWIZZLE& x, const VECTOR2<TYPE>& y) { return Pow(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const VECTOR2<TYPE>& x, const SWIZZLE& y) { return Pow(x, typename SWIZZLE::PARENT(y)); }
+template <typename TYPE> VECTOR2<TYPE> Pow(const VECTOR2<TYPE>& x, const VECTOR2<TYPE>& y)
+{
+	return VECTOR2<TYPE>(pow((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)y.Component(0)), pow((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)y.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& y) { return Pow(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE> VECTOR2<TYPE> Pow(const VECTOR2<TYPE>& x, const typename ScalarType<TYPE>::type& y)
+{
+	return VECTOR2<TYPE>(pow((typename ScalarType<TYPE>::type)x.Component(0), y), pow((typename ScalarType<TYPE>::type)x.Component(1), y));
+}
+
+// 2D Sin(), Cos(), SinCos(), Tan(), Atan2(): radians. Atan2(y, x) is GLSL's atan(y, x)
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sin(const SWIZZLE& x) { return Sin(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Sin(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(sin((typename ScalarType<TYPE>::type)x.Component(0)), sin((typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cos(const SWIZZLE& x) { return Cos(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Cos(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(cos((typename ScalarType<TYPE>::type)x.Component(0)), cos((typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, void >::type SinCos(const SWIZZLE& x, typename SWIZZLE::PARENT& sine, typename SWIZZLE::PARENT& cosine) { SinCos(typename SWIZZLE::PARENT(x), sine, cosine); }
+template <typename TYPE> void SinCos(const VECTOR2<TYPE>& x, VECTOR2<TYPE>& sine, VECTOR2<TYPE>& cosine)
+{
+	VECTOR2<TYPE> s = Sin(x); // x may be sine or cosine
+	cosine = Cos(x);
+	sine = s;
+}
+template <typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Tan(const SWIZZLE& x) { return Tan(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Tan(const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(tan((typename ScalarType<TYPE>::type)x.Component(0)), tan((typename ScalarType<TYPE>::type)x.Component(1)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Atan2(const SWIZZLE0& y, const SWIZZLE1& x) { return Atan2(typename SWIZZLE0::PARENT(y), typename SWIZZLE1::PARENT(x)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Atan2(const SWIZZLE& y, const VECTOR2<TYPE>& x) { return Atan2(typename SWIZZLE::PARENT(y), x); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Atan2(const VECTOR2<TYPE>& y, const SWIZZLE& x) { return Atan2(y, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR2<TYPE> Atan2(const VECTOR2<TYPE>& y, const VECTOR2<TYPE>& x)
+{
+	return VECTOR2<TYPE>(atan2((typename ScalarType<TYPE>::type)y.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), atan2((typename ScalarType<TYPE>::type)y.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)));
+}
+
+// 2D Distance()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type Distance(const SWIZZLE0& a, const SWIZZLE1& b) { return Distance(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Distance(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return Distance(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Distance(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return Distance(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> typename ScalarType<TYPE>::type Distance(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+{
+	return PrecisionLength((typename ScalarType<TYPE>::type)(a.x - b.x), (typename ScalarType<TYPE>::type)(a.y - b.y));
+}
+
+// 2D DistanceSquared()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is2D< typename SWIZZLE0::PARENT >, typename EnableIf< Is2D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type DistanceSquared(const SWIZZLE0& a, const SWIZZLE1& b) { return DistanceSquared(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type DistanceSquared(const SWIZZLE& a, const VECTOR2<TYPE>& b) { return DistanceSquared(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is2D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type DistanceSquared(const VECTOR2<TYPE>& a, const SWIZZLE& b) { return DistanceSquared(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> typename ScalarType<TYPE>::type DistanceSquared(const VECTOR2<TYPE>& a, const VECTOR2<TYPE>& b)
+{
+	return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y);
+}
+
+
+} // SVML namespace
+
+#endif // SVML_VECTOR2_H
@@ -0,0 +1,1111 @@
+#ifndef SVML_VECTOR3_H
+#define SVML_VECTOR3_H
+
+/*
+
+SVML - Simple Vector Math Library
+Author: Dwight House ( http://dwighthouse.com )
+Assistance by: Dr. Dmitri Volper, Mike Fried, Jeff Hubbard, Chris Peters
+
+Instructions and Information: https://github.com/dwighthouse/svml
+
+Colossians 3:23-24
+
+Copyright (c) 2010-2015 Dwight House
+
+*/
+
+#include "svml_vector2.h"
+
+namespace SVML
+{
+
+//----------------------------------------------------------------------
+// 
+// Sec. 05 - 3D vector type and associated functions
+// 
+//----------------------------------------------------------------------
+
+template <typename TYPE>
+union VECTOR3
+{
+private:
+	struct { TYPE x, y, z; } v;
+	typename SimdStorage<TYPE, 3>::type simd;
+
+	// Length property
+	struct LENGTH
+	{
+	private:
+		TYPE x, y, z;
+		TYPE ApplyLength(const TYPE& newMag)
+		{
+			TYPE inverseScaledMagnitude = PrecisionDivideByLength(newMag, x, y, z);
+			x *= inverseScaledMagnitude;
+			y *= inverseScaledMagnitude;
+			z *= inverseScaledMagnitude;
+			return newMag;
+		}
+		TYPE Magnitude() const { return PrecisionLength(x, y, z); }
+	public:
+		operator TYPE() const { return Magnitude(); }
+		operator typename WidenedType<TYPE>::type() const { return Magnitude(); }
+		TYPE operator=(const TYPE& rhs) { return ApplyLength(rhs); }
+		TYPE operator+=(const TYPE& rhs) { return ApplyLength(Magnitude() + rhs); }
+		TYPE operator-=(const TYPE& rhs) { return ApplyLength(Magnitude() - rhs); }
+		TYPE operator*=(const TYPE& rhs) { return ApplyLength(Magnitude() * rhs); }
+		TYPE operator/=(const TYPE& rhs) { return ApplyLength(Magnitude() / rhs); }
+	};
+
+public:
+	VECTOR3() {}
+#ifdef SVML_HAS_CONSTEXPR
+	constexpr VECTOR3(const TYPE& x, const TYPE& y, const TYPE& z) : v{x, y, z} {}
+	constexpr VECTOR3(const VECTOR2<TYPE>& xy, const TYPE& z) : v{xy.Component(0), xy.Component(1), z} {}
+	constexpr VECTOR3(const TYPE& x, const VECTOR2<TYPE>& yz) : v{x, yz.Component(0), yz.Component(1)} {}
+#else
+	VECTOR3(const TYPE& x, const TYPE& y, const TYPE& z) { v.x = x; v.y = y; v.z = z; }
+	VECTOR3(const VECTOR2<TYPE>& xy, const TYPE& z) { v.x = xy.Component(0); v.y = xy.Component(1); v.z = z; }
+	VECTOR3(const TYPE& x, const VECTOR2<TYPE>& yz) { v.x = x; v.y = yz.Component(0); v.z = yz.Component(1); }
+#endif
+	// From another component type (VECTOR3<float> from VECTOR3<HALF>, say), a cast per component
+	template <typename OTHER> explicit VECTOR3(const VECTOR3<OTHER>& other) { *this = VECTOR3((TYPE)other.Component(0), (TYPE)other.Component(1), (TYPE)other.Component(2)); }
+
+	// Packed storage (NO_SIMD unless SVML_USE_SSE is defined and TYPE is float, or int with SSE4.1)
+	typedef typename SimdStorage<TYPE, 3>::type SIMD;
+	explicit VECTOR3(const SIMD& packed) : simd(packed) {}
+	const SIMD& Simd() const { return simd; }
+
+	// Swizzle variables
+	SWIZZLE<VECTOR3<TYPE>, 0> x, r, s;
+	SWIZZLE<VECTOR3<TYPE>, 1> y, g, t;
+	SWIZZLE<VECTOR3<TYPE>, 2> z, b, p;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0> xx, rr, ss;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1> xy, rg, st;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2> xz, rb, sp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0> yx, gr, ts;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1> yy, gg, tt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2> yz, gb, tp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0> zx, br, ps;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1> zy, bg, pt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2> zz, bb, pp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 0> xxx, rrr, sss;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 1> xxy, rrg, sst;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 2> xxz, rrb, ssp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 0> xyx, rgr, sts;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 1> xyy, rgg, stt;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 2> xyz, rgb, stp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 0> xzx, rbr, sps;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 1> xzy, rbg, spt;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 2> xzz, rbb, spp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 0> yxx, grr, tss;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 1> yxy, grg, tst;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 2> yxz, grb, tsp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 0> yyx, ggr, tts;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 1> yyy, ggg, ttt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 2> yyz, ggb, ttp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 0> yzx, gbr, tps;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 1> yzy, gbg, tpt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 2> yzz, gbb, tpp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 0> zxx, brr, pss;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 1> zxy, brg, pst;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 2> zxz, brb, psp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 0> zyx, bgr, pts;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 1> zyy, bgg, ptt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 2> zyz, bgb, ptp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 0> zzx, bbr, pps;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 1> zzy, bbg, ppt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 2> zzz, bbb, ppp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 0, 0> xxxx, rrrr, ssss;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 0, 1> xxxy, rrrg, ssst;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 0, 2> xxxz, rrrb, sssp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 1, 0> xxyx, rrgr, ssts;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 1, 1> xxyy, rrgg, sstt;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 1, 2> xxyz, rrgb, sstp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 2, 0> xxzx, rrbr, ssps;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 2, 1> xxzy, rrbg, sspt;
+	SWIZZLE<VECTOR3<TYPE>, 0, 0, 2, 2> xxzz, rrbb, sspp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 0, 0> xyxx, rgrr, stss;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 0, 1> xyxy, rgrg, stst;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 0, 2> xyxz, rgrb, stsp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 1, 0> xyyx, rggr, stts;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 1, 1> xyyy, rggg, sttt;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 1, 2> xyyz, rggb, sttp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 2, 0> xyzx, rgbr, stps;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 2, 1> xyzy, rgbg, stpt;
+	SWIZZLE<VECTOR3<TYPE>, 0, 1, 2, 2> xyzz, rgbb, stpp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 0, 0> xzxx, rbrr, spss;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 0, 1> xzxy, rbrg, spst;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 0, 2> xzxz, rbrb, spsp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 1, 0> xzyx, rbgr, spts;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 1, 1> xzyy, rbgg, sptt;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 1, 2> xzyz, rbgb, sptp;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 2, 0> xzzx, rbbr, spps;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 2, 1> xzzy, rbbg, sppt;
+	SWIZZLE<VECTOR3<TYPE>, 0, 2, 2, 2> xzzz, rbbb, sppp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 0, 0> yxxx, grrr, tsss;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 0, 1> yxxy, grrg, tsst;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 0, 2> yxxz, grrb, tssp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 1, 0> yxyx, grgr, tsts;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 1, 1> yxyy, grgg, tstt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 1, 2> yxyz, grgb, tstp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 2, 0> yxzx, grbr, tsps;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 2, 1> yxzy, grbg, tspt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 0, 2, 2> yxzz, grbb, tspp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 0, 0> yyxx, ggrr, ttss;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 0, 1> yyxy, ggrg, ttst;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 0, 2> yyxz, ggrb, ttsp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 1, 0> yyyx, gggr, ttts;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 1, 1> yyyy, gggg, tttt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 1, 2> yyyz, gggb, tttp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 2, 0> yyzx, ggbr, ttps;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 2, 1> yyzy, ggbg, ttpt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 1, 2, 2> yyzz, ggbb, ttpp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 0, 0> yzxx, gbrr, tpss;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 0, 1> yzxy, gbrg, tpst;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 0, 2> yzxz, gbrb, tpsp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 1, 0> yzyx, gbgr, tpts;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 1, 1> yzyy, gbgg, tptt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 1, 2> yzyz, gbgb, tptp;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 2, 0> yzzx, gbbr, tpps;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 2, 1> yzzy, gbbg, tppt;
+	SWIZZLE<VECTOR3<TYPE>, 1, 2, 2, 2> yzzz, gbbb, tppp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 0, 0> zxxx, brrr, psss;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 0, 1> zxxy, brrg, psst;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 0, 2> zxxz, brrb, pssp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 1, 0> zxyx, brgr, psts;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 1, 1> zxyy, brgg, pstt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 1, 2> zxyz, brgb, pstp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 2, 0> zxzx, brbr, psps;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 2, 1> zxzy, brbg, pspt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 0, 2, 2> zxzz, brbb, pspp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 0, 0> zyxx, bgrr, ptss;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 0, 1> zyxy, bgrg, ptst;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 0, 2> zyxz, bgrb, ptsp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 1, 0> zyyx, bggr, ptts;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 1, 1> zyyy, bggg, pttt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 1, 2> zyyz, bggb, pttp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 2, 0> zyzx, bgbr, ptps;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 2, 1> zyzy, bgbg, ptpt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 1, 2, 2> zyzz, bgbb, ptpp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 0, 0> zzxx, bbrr, ppss;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 0, 1> zzxy, bbrg, ppst;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 0, 2> zzxz, bbrb, ppsp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 1, 0> zzyx, bbgr, ppts;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 1, 1> zzyy, bbgg, pptt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 1, 2> zzyz, bbgb, pptp;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 2, 0> zzzx, bbbr, ppps;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 2, 1> zzzy, bbbg, pppt;
+	SWIZZLE<VECTOR3<TYPE>, 2, 2, 2, 2> zzzz, bbbb, pppp;
+
+	// Length property
+	LENGTH Length;
+
+	// Assignment operators (default for = is fine)
+	const VECTOR3& operator+=(const VECTOR3& rhs) { v.x += rhs.v.x; v.y += rhs.v.y; v.z += rhs.v.z; return *this; }
+	const VECTOR3& operator-=(const VECTOR3& rhs) { v.x -= rhs.v.x; v.y -= rhs.v.y; v.z -= rhs.v.z; return *this; }
+	const VECTOR3& operator*=(const VECTOR3& rhs) { v.x *= rhs.v.x; v.y *= rhs.v.y; v.z *= rhs.v.z; return *this; }
+	const VECTOR3& operator/=(const VECTOR3& rhs) { v.x /= rhs.v.x; v.y /= rhs.v.y; v.z /= rhs.v.z; return *this; }
+	const VECTOR3& operator*=(const TYPE& rhs) { v.x *= rhs; v.y *= rhs; v.z *= rhs; return *this; }
+	const VECTOR3& operator/=(const TYPE& rhs) { v.x /= rhs; v.y /= rhs; v.z /= rhs; return *this; }
+
+	// Component access for expression templates and constant expressions
+	SVML_CONSTEXPR TYPE Component(const unsigned& index) const { return (index == 0) ? v.x : ((index == 1) ? v.y : (v.z)); }
+
+	// Array notation access
+	const TYPE& operator[](const unsigned& index)
+	{
+		if (index == 0) { return v.x; }
+		else if (index == 1) { return v.y; }
+		else if (index == 2) { return v.z; }
+		else { FatalError("Attempted out of bounds bracket access of 3D vector.", index); }
+	}
+
+	// Negation
+	SVML_CONSTEXPR VECTOR3 operator-() const { return VECTOR3(-v.x, -v.y, -v.z); }
+
+#ifdef SVML_FAST_RSQRT
+	void Normalize() { *this *= PrecisionDivideByLength((TYPE)1, v.x, v.y, v.z); }
+#else
+	void Normalize() { *this /= this->Length; }
+#endif
+};
+
+// 3D SSE member specializations
+#ifdef SVML_USE_SSE
+template <> inline VECTOR3<float>::VECTOR3(const float& x, const float& y, const float& z) { simd = _mm_set_ps(0.0f, z, y, x); }
+template <> inline VECTOR3<float>::VECTOR3(const VECTOR2<float>& xy, const float& z) { simd = _mm_set_ps(0.0f, z, xy.y, xy.x); }
+template <> inline VECTOR3<float>::VECTOR3(const float& x, const VECTOR2<float>& yz) { simd = _mm_set_ps(0.0f, yz.y, yz.x, x); }
+template <> inline const VECTOR3<float>& VECTOR3<float>::operator+=(const VECTOR3<float>& rhs) { simd = _mm_add_ps(simd, rhs.simd); return *this; }
+template <> inline const VECTOR3<float>& VECTOR3<float>::operator-=(const VECTOR3<float>& rhs) { simd = _mm_sub_ps(simd, rhs.simd); return *this; }
+template <> inline const VECTOR3<float>& VECTOR3<float>::operator*=(const VECTOR3<float>& rhs) { simd = _mm_mul_ps(simd, rhs.simd); return *this; }
+template <> inline const VECTOR3<float>& VECTOR3<float>::operator/=(const VECTOR3<float>& rhs) { simd = _mm_div_ps(simd, SimdReplaceW(rhs.simd, _mm_set1_ps(1.0f))); return *this; }
+template <> inline const VECTOR3<float>& VECTOR3<float>::operator*=(const float& rhs) { simd = _mm_mul_ps(simd, _mm_set1_ps(rhs)); return *this; }
+template <> inline const VECTOR3<float>& VECTOR3<float>::operator/=(const float& rhs) { simd = _mm_div_ps(simd, _mm_set1_ps(rhs)); return *this; }
+template <> inline VECTOR3<float> VECTOR3<float>::operator-() const { return VECTOR3<float>(_mm_xor_ps(simd, _mm_set1_ps(-0.0f))); }
+#endif // SVML_USE_SSE
+
+// 3D SSE4.1 integer member specializations (division stays component by component)
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+template <> inline VECTOR3<int>::VECTOR3(const int& x, const int& y, const int& z) { simd = _mm_set_epi32(0, z, y, x); }
+template <> inline VECTOR3<int>::VECTOR3(const VECTOR2<int>& xy, const int& z) { simd = _mm_set_epi32(0, z, xy.y, xy.x); }
+template <> inline VECTOR3<int>::VECTOR3(const int& x, const VECTOR2<int>& yz) { simd = _mm_set_epi32(0, yz.y, yz.x, x); }
+template <> inline const VECTOR3<int>& VECTOR3<int>::operator+=(const VECTOR3<int>& rhs) { simd = _mm_add_epi32(simd, rhs.simd); return *this; }
+template <> inline const VECTOR3<int>& VECTOR3<int>::operator-=(const VECTOR3<int>& rhs) { simd = _mm_sub_epi32(simd, rhs.simd); return *this; }
+template <> inline const VECTOR3<int>& VECTOR3<int>::operator*=(const VECTOR3<int>& rhs) { simd = _mm_mullo_epi32(simd, rhs.simd); return *this; }
+template <> inline const VECTOR3<int>& VECTOR3<int>::operator*=(const int& rhs) { simd = _mm_mullo_epi32(simd, _mm_set1_epi32(rhs)); return *this; }
+template <> inline VECTOR3<int> VECTOR3<int>::operator-() const { return VECTOR3<int>(_mm_sub_epi32(_mm_setzero_si128(), simd)); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Negate [-]
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_NONE, EXPRESSION_NEGATE > >::type operator-(const SWIZZLE& toNegate)
+{
+	return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_NONE, EXPRESSION_NEGATE >(toNegate, EXPRESSION_NONE());
+}
+
+// 3D Addition [+]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_ADD > >::type >::type operator+(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_ADD >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR3<TYPE>, EXPRESSION_ADD > >::type operator+(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR3<TYPE>, EXPRESSION_ADD >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR3<TYPE>, SWIZZLE, EXPRESSION_ADD > >::type operator+(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR3<TYPE>, SWIZZLE, EXPRESSION_ADD >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> operator+(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return VECTOR3<TYPE>(lhs.Component(0) + rhs.Component(0), lhs.Component(1) + rhs.Component(1), lhs.Component(2) + rhs.Component(2));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> operator+(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return VECTOR3<float>(_mm_add_ps(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> operator+(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return VECTOR3<int>(_mm_add_epi32(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Subtraction [-]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_SUBTRACT > >::type >::type operator-(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR3<TYPE>, EXPRESSION_SUBTRACT > >::type operator-(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR3<TYPE>, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR3<TYPE>, SWIZZLE, EXPRESSION_SUBTRACT > >::type operator-(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR3<TYPE>, SWIZZLE, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> operator-(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return VECTOR3<TYPE>(lhs.Component(0) - rhs.Component(0), lhs.Component(1) - rhs.Component(1), lhs.Component(2) - rhs.Component(2));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> operator-(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return VECTOR3<float>(_mm_sub_ps(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> operator-(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return VECTOR3<int>(_mm_sub_epi32(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Multiplication [*]: Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_MULTIPLY > >::type >::type operator*(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR3<TYPE>, EXPRESSION_MULTIPLY > >::type operator*(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR3<TYPE>, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR3<TYPE>, SWIZZLE, EXPRESSION_MULTIPLY > >::type operator*(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR3<TYPE>, SWIZZLE, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> operator*(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return VECTOR3<TYPE>(lhs.Component(0) * rhs.Component(0), lhs.Component(1) * rhs.Component(1), lhs.Component(2) * rhs.Component(2));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> operator*(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return VECTOR3<float>(_mm_mul_ps(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> operator*(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return VECTOR3<int>(_mm_mullo_epi32(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Division [/]: Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_DIVIDE > >::type >::type operator/(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR3<TYPE>, EXPRESSION_DIVIDE > >::type operator/(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR3<TYPE>, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR3<TYPE>, SWIZZLE, EXPRESSION_DIVIDE > >::type operator/(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR3<TYPE>, SWIZZLE, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> operator/(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return VECTOR3<TYPE>(lhs.Component(0) / rhs.Component(0), lhs.Component(1) / rhs.Component(1), lhs.Component(2) / rhs.Component(2));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> operator/(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return VECTOR3<float>(_mm_div_ps(lhs.Simd(), SimdReplaceW(rhs.Simd(), _mm_set1_ps(1.0f)))); }
+#endif // SVML_USE_SSE
+
+// 3D Multiplication [*]: Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_MULTIPLY > >::type operator*(const SWIZZLE& lhs, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_MULTIPLY >(lhs, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(rhs)); }
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_MULTIPLY > >::type operator*(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& lhs, const SWIZZLE& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_MULTIPLY >(EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(lhs), rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> operator*(const VECTOR3<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs)
+{
+	return VECTOR3<TYPE>(lhs.Component(0) * rhs, lhs.Component(1) * rhs, lhs.Component(2) * rhs);
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return VECTOR3<TYPE>(lhs * rhs.Component(0), lhs * rhs.Component(1), lhs * rhs.Component(2));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> operator*(const VECTOR3<float>& lhs, const SCALAR_TYPE& rhs) { return VECTOR3<float>(_mm_mul_ps(lhs.Simd(), _mm_set1_ps(rhs))); }
+inline VECTOR3<float> operator*(const SCALAR_TYPE& lhs, const VECTOR3<float>& rhs) { return VECTOR3<float>(_mm_mul_ps(_mm_set1_ps(lhs), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> operator*(const VECTOR3<int>& lhs, const int& rhs) { return VECTOR3<int>(_mm_mullo_epi32(lhs.Simd(), _mm_set1_epi32(rhs))); }
+inline VECTOR3<int> operator*(const int& lhs, const VECTOR3<int>& rhs) { return VECTOR3<int>(_mm_mullo_epi32(_mm_set1_epi32(lhs), rhs.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Division [/]: Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_DIVIDE > >::type operator/(const SWIZZLE& lhs, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_DIVIDE >(lhs, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(rhs)); }
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_DIVIDE > >::type operator/(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& lhs, const SWIZZLE& rhs) { return EXPRESSION3< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_DIVIDE >(EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(lhs), rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> operator/(const VECTOR3<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs)
+{
+	return VECTOR3<TYPE>(lhs.Component(0) / rhs, lhs.Component(1) / rhs, lhs.Component(2) / rhs);
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> operator/(const typename ScalarType<TYPE>::type& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return VECTOR3<TYPE>(lhs / rhs.Component(0), lhs / rhs.Component(1), lhs / rhs.Component(2));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> operator/(const VECTOR3<float>& lhs, const SCALAR_TYPE& rhs) { return VECTOR3<float>(_mm_div_ps(lhs.Simd(), _mm_set1_ps(rhs))); }
+inline VECTOR3<float> operator/(const SCALAR_TYPE& lhs, const VECTOR3<float>& rhs) { return VECTOR3<float>(_mm_div_ps(_mm_set1_ps(lhs), SimdReplaceW(rhs.Simd(), _mm_set1_ps(1.0f)))); }
+#endif // SVML_USE_SSE
+
+// 3D component-wise comparison result: bit i is set where component i compared true
+struct MASK3
+{
+	unsigned bits;
+
+	// Constructors
+	SVML_CONSTEXPR MASK3() : bits(0) {}
+	SVML_CONSTEXPR MASK3(const bool& x, const bool& y, const bool& z) : bits((x ? 1u : 0u) | (y ? 2u : 0u) | (z ? 4u : 0u)) {}
+	static SVML_CONSTEXPR MASK3 FromBits(const unsigned& bits) { return MASK3(bits & 7u, 0); } // Only the low 3 bits are kept
+
+	SVML_CONSTEXPR bool operator[](const unsigned& index) const { return ((bits >> index) & 1u) != 0; }
+
+private:
+	SVML_CONSTEXPR MASK3(const unsigned& bits, int) : bits(bits) {}
+};
+
+// 3D mask [&], [|], [^], [!], [==], [!=], Any(), All()
+SVML_CONSTEXPR MASK3 operator&(const MASK3& lhs, const MASK3& rhs) { return MASK3::FromBits(lhs.bits & rhs.bits); }
+SVML_CONSTEXPR MASK3 operator|(const MASK3& lhs, const MASK3& rhs) { return MASK3::FromBits(lhs.bits | rhs.bits); }
+SVML_CONSTEXPR MASK3 operator^(const MASK3& lhs, const MASK3& rhs) { return MASK3::FromBits(lhs.bits ^ rhs.bits); }
+SVML_CONSTEXPR MASK3 operator!(const MASK3& mask) { return MASK3::FromBits(~mask.bits); }
+SVML_CONSTEXPR bool operator==(const MASK3& lhs, const MASK3& rhs) { return lhs.bits == rhs.bits; }
+SVML_CONSTEXPR bool operator!=(const MASK3& lhs, const MASK3& rhs) { return lhs.bits != rhs.bits; }
+SVML_CONSTEXPR bool Any(const MASK3& mask) { return mask.bits != 0; }
+SVML_CONSTEXPR bool All(const MASK3& mask) { return mask.bits == 7u; }
+
+// 3D Equal To [==]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator==(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) == typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator==(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) == rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator==(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs == typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator==(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return !(lhs.Component(0) != rhs.Component(0) || lhs.Component(1) != rhs.Component(1) || lhs.Component(2) != rhs.Component(2));
+}
+
+// 3D Not Equal To [!=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator!=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) != typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator!=(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) != rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator!=(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs != typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator!=(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return lhs.Component(0) != rhs.Component(0) || lhs.Component(1) != rhs.Component(1) || lhs.Component(2) != rhs.Component(2);
+}
+
+// 3D AlmostEqual()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type AlmostEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqual((typename SWIZZLE0::PARENT(lhs)), (typename SWIZZLE1::PARENT(rhs))); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return AlmostEqual((typename SWIZZLE::PARENT(lhs)), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqual(lhs, (typename SWIZZLE::PARENT(rhs))); }
+template <typename TYPE> bool AlmostEqual(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return fabs(lhs.Component(0) - rhs.Component(0)) < ScalarType<TYPE>::Epsilon() && fabs(lhs.Component(1) - rhs.Component(1)) < ScalarType<TYPE>::Epsilon() && fabs(lhs.Component(2) - rhs.Component(2)) < ScalarType<TYPE>::Epsilon();
+}
+
+// 3D Less Than [<]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) < typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator<(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) < rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator<(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs < typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator<(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return lhs.Component(0) < rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && (lhs.Component(1) < rhs.Component(1) || (lhs.Component(1) == rhs.Component(1) && lhs.Component(2) < rhs.Component(2))));
+}
+
+// 3D Greater Than [>]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) > typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator>(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) > rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator>(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs > typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator>(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return lhs.Component(0) > rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && (lhs.Component(1) > rhs.Component(1) || (lhs.Component(1) == rhs.Component(1) && lhs.Component(2) > rhs.Component(2))));
+}
+
+// 3D Less Than Or Equal To [<=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) <= typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator<=(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) <= rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator<=(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs <= typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator<=(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return lhs.Component(0) < rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && (lhs.Component(1) < rhs.Component(1) || (lhs.Component(1) == rhs.Component(1) && lhs.Component(2) <= rhs.Component(2))));
+}
+
+// 3D Greater Than Or Equal To [<=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) >= typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator>=(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) >= rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, bool >::type operator>=(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return lhs >= typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator>=(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs)
+{
+	return lhs.Component(0) > rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && (lhs.Component(1) > rhs.Component(1) || (lhs.Component(1) == rhs.Component(1) && lhs.Component(2) >= rhs.Component(2))));
+}
+
+// 3D component-wise comparisons: Equal(), NotEqual(), AlmostEqualMask(), LessThan(), GreaterThan(), LessThanEqual(), GreaterThanEqual()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK3 >::type >::type >::type Equal(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return Equal(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type Equal(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return Equal(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type Equal(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return Equal(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK3 Equal(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs) { return MASK3(lhs.Component(0) == rhs.Component(0), lhs.Component(1) == rhs.Component(1), lhs.Component(2) == rhs.Component(2)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK3 >::type >::type >::type NotEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return NotEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type NotEqual(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return NotEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type NotEqual(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return NotEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK3 NotEqual(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs) { return MASK3(lhs.Component(0) != rhs.Component(0), lhs.Component(1) != rhs.Component(1), lhs.Component(2) != rhs.Component(2)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK3 >::type >::type >::type AlmostEqualMask(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqualMask(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type AlmostEqualMask(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return AlmostEqualMask(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type AlmostEqualMask(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqualMask(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> inline MASK3 AlmostEqualMask(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs) { return MASK3(fabs(lhs.Component(0) - rhs.Component(0)) < ScalarType<TYPE>::Epsilon(), fabs(lhs.Component(1) - rhs.Component(1)) < ScalarType<TYPE>::Epsilon(), fabs(lhs.Component(2) - rhs.Component(2)) < ScalarType<TYPE>::Epsilon()); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK3 >::type >::type >::type LessThan(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return LessThan(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type LessThan(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return LessThan(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type LessThan(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return LessThan(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK3 LessThan(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs) { return MASK3(lhs.Component(0) < rhs.Component(0), lhs.Component(1) < rhs.Component(1), lhs.Component(2) < rhs.Component(2)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK3 >::type >::type >::type GreaterThan(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return GreaterThan(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type GreaterThan(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return GreaterThan(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type GreaterThan(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return GreaterThan(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK3 GreaterThan(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs) { return MASK3(lhs.Component(0) > rhs.Component(0), lhs.Component(1) > rhs.Component(1), lhs.Component(2) > rhs.Component(2)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK3 >::type >::type >::type LessThanEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return LessThanEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type LessThanEqual(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return LessThanEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type LessThanEqual(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return LessThanEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK3 LessThanEqual(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs) { return MASK3(lhs.Component(0) <= rhs.Component(0), lhs.Component(1) <= rhs.Component(1), lhs.Component(2) <= rhs.Component(2)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK3 >::type >::type >::type GreaterThanEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return GreaterThanEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type GreaterThanEqual(const SWIZZLE& lhs, const VECTOR3<TYPE>& rhs) { return GreaterThanEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK3>::type >::type GreaterThanEqual(const VECTOR3<TYPE>& lhs, const SWIZZLE& rhs) { return GreaterThanEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK3 GreaterThanEqual(const VECTOR3<TYPE>& lhs, const VECTOR3<TYPE>& rhs) { return MASK3(lhs.Component(0) >= rhs.Component(0), lhs.Component(1) >= rhs.Component(1), lhs.Component(2) >= rhs.Component(2)); }
+
+#ifdef SVML_USE_SSE
+inline MASK3 Equal(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_cmpeq_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK3 NotEqual(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_cmpneq_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK3 LessThan(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_cmplt_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK3 GreaterThan(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_cmpgt_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK3 LessThanEqual(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_cmple_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK3 GreaterThanEqual(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_cmpge_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK3 AlmostEqualMask(const VECTOR3<float>& lhs, const VECTOR3<float>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(lhs.Simd(), rhs.Simd())), _mm_set1_ps(ScalarType<float>::Epsilon())))); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline MASK3 Equal(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK3 NotEqual(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return MASK3::FromBits(~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK3 LessThan(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK3 GreaterThan(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return MASK3::FromBits(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK3 LessThanEqual(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return MASK3::FromBits(~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK3 GreaterThanEqual(const VECTOR3<int>& lhs, const VECTOR3<int>& rhs) { return MASK3::FromBits(~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(lhs.Simd(), rhs.Simd())))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Select(): Component-wise mask ? a : b
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Select(const typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK3 >::type& mask, const SWIZZLE0& a, const SWIZZLE1& b) { return Select(mask, typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Select(const typename MaskType<TYPE, MASK3>::type& mask, const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Select(mask, typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Select(const typename MaskType<TYPE, MASK3>::type& mask, const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Select(mask, a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Select(const MASK3& mask, const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+{
+	return VECTOR3<TYPE>(mask[0] ? a.Component(0) : b.Component(0), mask[1] ? a.Component(1) : b.Component(1), mask[2] ? a.Component(2) : b.Component(2));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Select(const MASK3& mask, const VECTOR3<float>& a, const VECTOR3<float>& b) { return VECTOR3<float>(SimdBlend(SimdLaneMask(mask.bits), a.Simd(), b.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> Select(const MASK3& mask, const VECTOR3<int>& a, const VECTOR3<int>& b) { return VECTOR3<int>(_mm_castps_si128(SimdBlend(SimdLaneMask(mask.bits), _mm_castsi128_ps(a.Simd()), _mm_castsi128_ps(b.Simd())))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// 3D component-wise comparisons of vectors of WIDE, into a mask per lane
+template <typename TYPE, int N> WIDE<MASK3, N> Equal(const VECTOR3< WIDE<TYPE, N> >& lhs, const VECTOR3< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2);
+	WIDE<MASK3, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK3(lhs0.lane[i] == rhs0.lane[i], lhs1.lane[i] == rhs1.lane[i], lhs2.lane[i] == rhs2.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK3, N> NotEqual(const VECTOR3< WIDE<TYPE, N> >& lhs, const VECTOR3< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2);
+	WIDE<MASK3, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK3(lhs0.lane[i] != rhs0.lane[i], lhs1.lane[i] != rhs1.lane[i], lhs2.lane[i] != rhs2.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK3, N> AlmostEqualMask(const VECTOR3< WIDE<TYPE, N> >& lhs, const VECTOR3< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2);
+	WIDE<MASK3, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK3(fabs(lhs0.lane[i] - rhs0.lane[i]) < ScalarType<TYPE>::Epsilon(), fabs(lhs1.lane[i] - rhs1.lane[i]) < ScalarType<TYPE>::Epsilon(), fabs(lhs2.lane[i] - rhs2.lane[i]) < ScalarType<TYPE>::Epsilon()); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK3, N> LessThan(const VECTOR3< WIDE<TYPE, N> >& lhs, const VECTOR3< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2);
+	WIDE<MASK3, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK3(lhs0.lane[i] < rhs0.lane[i], lhs1.lane[i] < rhs1.lane[i], lhs2.lane[i] < rhs2.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK3, N> GreaterThan(const VECTOR3< WIDE<TYPE, N> >& lhs, const VECTOR3< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2);
+	WIDE<MASK3, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK3(lhs0.lane[i] > rhs0.lane[i], lhs1.lane[i] > rhs1.lane[i], lhs2.lane[i] > rhs2.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK3, N> LessThanEqual(const VECTOR3< WIDE<TYPE, N> >& lhs, const VECTOR3< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2);
+	WIDE<MASK3, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK3(lhs0.lane[i] <= rhs0.lane[i], lhs1.lane[i] <= rhs1.lane[i], lhs2.lane[i] <= rhs2.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK3, N> GreaterThanEqual(const VECTOR3< WIDE<TYPE, N> >& lhs, const VECTOR3< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2);
+	WIDE<MASK3, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK3(lhs0.lane[i] >= rhs0.lane[i], lhs1.lane[i] >= rhs1.lane[i], lhs2.lane[i] >= rhs2.lane[i]); }
+	return result;
+}
+
+// 3D masks per lane [&], [|], [^], [!], Any(), All(), lane by lane
+template <int N> WIDE<MASK3, N> operator&(const WIDE<MASK3, N>& lhs, const WIDE<MASK3, N>& rhs) { WIDE<MASK3, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] & rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK3, N> operator|(const WIDE<MASK3, N>& lhs, const WIDE<MASK3, N>& rhs) { WIDE<MASK3, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] | rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK3, N> operator^(const WIDE<MASK3, N>& lhs, const WIDE<MASK3, N>& rhs) { WIDE<MASK3, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] ^ rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK3, N> operator!(const WIDE<MASK3, N>& mask) { WIDE<MASK3, N> result; for (int i = 0; i < N; i++) { result.lane[i] = !mask.lane[i]; } return result; }
+template <int N> WIDE<bool, N> Any(const WIDE<MASK3, N>& mask) { WIDE<bool, N> result; for (int i = 0; i < N; i++) { result.lane[i] = Any(mask.lane[i]); } return result; }
+template <int N> WIDE<bool, N> All(const WIDE<MASK3, N>& mask) { WIDE<bool, N> result; for (int i = 0; i < N; i++) { result.lane[i] = All(mask.lane[i]); } return result; }
+
+// 3D Select() by a mask per lane: per component and lane, a where the lane's mask is set and b elsewhere
+template <typename TYPE, int N> VECTOR3< WIDE<TYPE, N> > Select(const WIDE<MASK3, N>& mask, const VECTOR3< WIDE<TYPE, N> >& a, const VECTOR3< WIDE<TYPE, N> >& b)
+{
+	WIDE<TYPE, N> a0 = a.Component(0), b0 = b.Component(0), a1 = a.Component(1), b1 = b.Component(1), a2 = a.Component(2), b2 = b.Component(2);
+	for (int i = 0; i < N; i++)
+	{
+		if (mask.lane[i][0]) { b0.lane[i] = a0.lane[i]; }
+		if (mask.lane[i][1]) { b1.lane[i] = a1.lane[i]; }
+		if (mask.lane[i][2]) { b2.lane[i] = a2.lane[i]; }
+	}
+	return VECTOR3< WIDE<TYPE, N> >(b0, b1, b2);
+}
+
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+// 3D Normalize()
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Normalize(const SWIZZLE& toNormalize) { return Normalize(typename SWIZZLE::PARENT(toNormalize)); }
+template <typename TYPE> VECTOR3<TYPE> Normalize(const VECTOR3<TYPE>& toNormalize)
+{
+#ifdef SVML_FAST_RSQRT
+	return toNormalize * PrecisionDivideByLength((TYPE)1, toNormalize.Component(0), toNormalize.Component(1), toNormalize.Component(2));
+#else
+	return toNormalize / toNormalize.Length;
+#endif
+}
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// 3D fixed-point Normalize(), each component divided by the length summed in 64 bits
+inline VECTOR3<FIXED> Normalize(const VECTOR3<FIXED>& toNormalize)
+{
+	return VECTOR3<FIXED>(PrecisionDivideByLength(toNormalize.Component(0), toNormalize.Component(0), toNormalize.Component(1), toNormalize.Component(2)), PrecisionDivideByLength(toNormalize.Component(1), toNormalize.Component(0), toNormalize.Component(1), toNormalize.Component(2)), PrecisionDivideByLength(toNormalize.Component(2), toNormalize.Component(0), toNormalize.Component(1), toNormalize.Component(2)));
+}
+template <> inline void VECTOR3<FIXED>::Normalize() { *this = SVML::Normalize(*this); }
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Normalize(const VECTOR3<float>& toNormalize)
+{
+#ifdef SVML_FAST_RSQRT
+	__m128 scale = SimdReciprocalSqrt(SimdHorizontalAdd3(_mm_mul_ps(toNormalize.Simd(), toNormalize.Simd())));
+	return VECTOR3<float>(_mm_mul_ps(toNormalize.Simd(), _mm_shuffle_ps(scale, scale, 0)));
+#else
+	__m128 length = _mm_sqrt_ss(SimdHorizontalAdd3(_mm_mul_ps(toNormalize.Simd(), toNormalize.Simd())));
+	return VECTOR3<float>(_mm_div_ps(toNormalize.Simd(), _mm_shuffle_ps(length, length, 0)));
+#endif
+}
+#endif // SVML_USE_SSE
+
+// 3D Dot()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type Dot(const SWIZZLE0& a, const SWIZZLE1& b) { return Dot(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Dot(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Dot(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Dot(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Dot(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR typename ScalarType<TYPE>::type Dot(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+{
+	return a.Component(0) * b.Component(0) + a.Component(1) * b.Component(1) + a.Component(2) * b.Component(2);
+}
+
+#ifdef SVML_USE_SSE
+inline SCALAR_TYPE Dot(const VECTOR3<float>& a, const VECTOR3<float>& b) { return SimdDot3(a.Simd(), b.Simd()); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline int Dot(const VECTOR3<int>& a, const VECTOR3<int>& b) { return SimdDot3i(a.Simd(), b.Simd()); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Cross()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Cross(const SWIZZLE0& a, const SWIZZLE1& b) { return Cross(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cross(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Cross(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cross(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Cross(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Cross(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+{
+	return VECTOR3<TYPE>(a.Component(1) * b.Component(2) - a.Component(2) * b.Component(1),
+	                     a.Component(2) * b.Component(0) - a.Component(0) * b.Component(2),
+	                     a.Component(0) * b.Component(1) - a.Component(1) * b.Component(0));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Cross(const VECTOR3<float>& a, const VECTOR3<float>& b)
+{
+	__m128 aYZX = _mm_shuffle_ps(a.Simd(), a.Simd(), _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 bYZX = _mm_shuffle_ps(b.Simd(), b.Simd(), _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 c = _mm_sub_ps(_mm_mul_ps(a.Simd(), bYZX), _mm_mul_ps(aYZX, b.Simd()));
+	return VECTOR3<float>(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+}
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> Cross(const VECTOR3<int>& a, const VECTOR3<int>& b)
+{
+	__m128i c = _mm_sub_epi32(_mm_mullo_epi32(a.Simd(), _mm_shuffle_epi32(b.Simd(), _MM_SHUFFLE(3, 0, 2, 1))), _mm_mullo_epi32(_mm_shuffle_epi32(a.Simd(), _MM_SHUFFLE(3, 0, 2, 1)), b.Simd()));
+	return VECTOR3<int>(_mm_shuffle_epi32(c, _MM_SHUFFLE(3, 0, 2, 1)));
+}
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Project()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Project(const SWIZZLE0& projectThis, const SWIZZLE1& ontoThis) { return Project(typename SWIZZLE0::PARENT(projectThis), typename SWIZZLE1::PARENT(ontoThis)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const SWIZZLE& projectThis, const VECTOR3<TYPE>& ontoThis) { return Project(typename SWIZZLE::PARENT(projectThis), ontoThis); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const VECTOR3<TYPE>& projectThis, const SWIZZLE& ontoThis) { return Project(projectThis, typename SWIZZLE::PARENT(ontoThis)); }
+template <typename TYPE> VECTOR3<TYPE> Project(const VECTOR3<TYPE>& projectThis, const VECTOR3<TYPE>& ontoThis)
+{
+	return (Dot(projectThis, ontoThis) / Dot(ontoThis, ontoThis)) * ontoThis;
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Project(const VECTOR3<float>& projectThis, const VECTOR3<float>& ontoThis)
+{
+	__m128 scale = _mm_set1_ps(SimdDot3(projectThis.Simd(), ontoThis.Simd()) / SimdDot3(ontoThis.Simd(), ontoThis.Simd()));
+	return VECTOR3<float>(_mm_mul_ps(scale, ontoThis.Simd()));
+}
+#endif // SVML_USE_SSE
+
+// 3D Rotate()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Rotate(const SWIZZLE0& toRotate, const SWIZZLE1& rotationAxis, const typename RealType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type& radians) { return Rotate(typename SWIZZLE0::PARENT(toRotate), typename SWIZZLE1::PARENT(rotationAxis), radians); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& toRotate, const VECTOR3<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians) { return Rotate(typename SWIZZLE::PARENT(toRotate), rotationAxis, radians); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const VECTOR3<TYPE>& toRotate, const SWIZZLE& rotationAxis, const typename RealType<TYPE>::type& radians) { return Rotate(toRotate, typename SWIZZLE::PARENT(rotationAxis), radians); }
+template <typename TYPE> VECTOR3<TYPE> Rotate(const VECTOR3<TYPE>& toRotate, const VECTOR3<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians)
+{
+	return Rotate(toRotate, QUATERNION< typename RealType<TYPE>::type >(VECTOR3< typename RealType<TYPE>::type >(rotationAxis), radians));
+}
+
+// 3D Lerp()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Lerp(const SWIZZLE0& start, const SWIZZLE1& end, const typename RealType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type& delta) { return Lerp(typename SWIZZLE0::PARENT(start), typename SWIZZLE1::PARENT(end), delta); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const SWIZZLE& start, const VECTOR3<TYPE>& end, const typename RealType<TYPE>::type& delta) { return Lerp(typename SWIZZLE::PARENT(start), end, delta); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const VECTOR3<TYPE>& start, const SWIZZLE& end, const typename RealType<TYPE>::type& delta) { return Lerp(start, typename SWIZZLE::PARENT(end), delta); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Lerp(const VECTOR3<TYPE>& start, const VECTOR3<TYPE>& end, const typename RealType<TYPE>::type& delta)
+{
+	return VECTOR3<TYPE>(start.Component(0) + delta * (end.Component(0) - start.Component(0)),
+	                     start.Component(1) + delta * (end.Component(1) - start.Component(1)),
+	                     start.Component(2) + delta * (end.Component(2) - start.Component(2)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Lerp(const VECTOR3<float>& start, const VECTOR3<float>& end, const SCALAR_TYPE& delta) { return VECTOR3<float>(_mm_add_ps(start.Simd(), _mm_mul_ps(_mm_set1_ps(delta), _mm_sub_ps(end.Simd(), start.Simd())))); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> Lerp(const VECTOR3<int>& start, const VECTOR3<int>& end, const SCALAR_TYPE& delta) { return VECTOR3<int>(_mm_cvttps_epi32(_mm_add_ps(_mm_cvtepi32_ps(start.Simd()), _mm_mul_ps(_mm_set1_ps(delta), _mm_cvtepi32_ps(_mm_sub_epi32(end.Simd(), start.Simd())))))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Max(): Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Max(const SWIZZLE0& a, const SWIZZLE1& b) { return Max(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Max(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Max(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Max(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+{
+	return VECTOR3<TYPE>(max(a.Component(0), b.Component(0)), max(a.Component(1), b.Component(1)), max(a.Component(2), b.Component(2)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Max(const VECTOR3<float>& a, const VECTOR3<float>& b) { return VECTOR3<float>(_mm_max_ps(b.Simd(), a.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> Max(const VECTOR3<int>& a, const VECTOR3<int>& b) { return VECTOR3<int>(_mm_max_epi32(b.Simd(), a.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Min(): Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Min(const SWIZZLE0& a, const SWIZZLE1& b) { return Min(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Min(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Min(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Min(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+{
+	return VECTOR3<TYPE>(min(a.Component(0), b.Component(0)), min(a.Component(1), b.Component(1)), min(a.Component(2), b.Component(2)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Min(const VECTOR3<float>& a, const VECTOR3<float>& b) { return VECTOR3<float>(_mm_min_ps(b.Simd(), a.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> Min(const VECTOR3<int>& a, const VECTOR3<int>& b) { return VECTOR3<int>(_mm_min_epi32(b.Simd(), a.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Max(): Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum) { return Max(typename SWIZZLE::PARENT(a), maximum); }
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum, const SWIZZLE& b) { return Max(maximum, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Max(const VECTOR3<TYPE>& a, const typename ScalarType<TYPE>::type& maximum)
+{
+	return VECTOR3<TYPE>(max((typename ScalarType<TYPE>::type)a.Component(0), maximum), max((typename ScalarType<TYPE>::type)a.Component(1), maximum), max((typename ScalarType<TYPE>::type)a.Component(2), maximum));
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Max(const typename ScalarType<TYPE>::type& maximum, const VECTOR3<TYPE>& b)
+{
+	return VECTOR3<TYPE>(max(maximum, (typename ScalarType<TYPE>::type)b.Component(0)), max(maximum, (typename ScalarType<TYPE>::type)b.Component(1)), max(maximum, (typename ScalarType<TYPE>::type)b.Component(2)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Max(const VECTOR3<float>& a, const SCALAR_TYPE& maximum) { return VECTOR3<float>(_mm_max_ps(_mm_set1_ps(maximum), a.Simd())); }
+inline VECTOR3<float> Max(const SCALAR_TYPE& maximum, const VECTOR3<float>& b) { return VECTOR3<float>(_mm_max_ps(b.Simd(), _mm_set1_ps(maximum))); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> Max(const VECTOR3<int>& a, const int& maximum) { return VECTOR3<int>(_mm_max_epi32(_mm_set1_epi32(maximum), a.Simd())); }
+inline VECTOR3<int> Max(const int& maximum, const VECTOR3<int>& b) { return VECTOR3<int>(_mm_max_epi32(b.Simd(), _mm_set1_epi32(maximum))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Min(): Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum) { return Min(typename SWIZZLE::PARENT(a), minimum); }
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum, const SWIZZLE& b) { return Min(minimum, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Min(const VECTOR3<TYPE>& a, const typename ScalarType<TYPE>::type& minimum)
+{
+	return VECTOR3<TYPE>(min((typename ScalarType<TYPE>::type)a.Component(0), minimum), min((typename ScalarType<TYPE>::type)a.Component(1), minimum), min((typename ScalarType<TYPE>::type)a.Component(2), minimum));
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR3<TYPE> Min(const typename ScalarType<TYPE>::type& minimum, const VECTOR3<TYPE>& b)
+{
+	return VECTOR3<TYPE>(min(minimum, (typename ScalarType<TYPE>::type)b.Component(0)), min(minimum, (typename ScalarType<TYPE>::type)b.Component(1)), min(minimum, (typename ScalarType<TYPE>::type)b.Component(2)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Min(const VECTOR3<float>& a, const SCALAR_TYPE& minimum) { return VECTOR3<float>(_mm_min_ps(_mm_set1_ps(minimum), a.Simd())); }
+inline VECTOR3<float> Min(const SCALAR_TYPE& minimum, const VECTOR3<float>& b) { return VECTOR3<float>(_mm_min_ps(b.Simd(), _mm_set1_ps(minimum))); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<int> Min(const VECTOR3<int>& a, const int& minimum) { return VECTOR3<int>(_mm_min_epi32(_mm_set1_epi32(minimum), a.Simd())); }
+inline VECTOR3<int> Min(const int& minimum, const VECTOR3<int>& b) { return VECTOR3<int>(_mm_min_epi32(b.Simd(), _mm_set1_epi32(minimum))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Ceil()
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Ceil(const SWIZZLE& toCeil) { return Ceil(typename SWIZZLE::PARENT(toCeil)); }
+template <typename TYPE> VECTOR3<TYPE> Ceil(const VECTOR3<TYPE>& toCeil)
+{
+	return VECTOR3<TYPE>(ceil(toCeil.Component(0)), ceil(toCeil.Component(1)), ceil(toCeil.Component(2)));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<float> Ceil(const VECTOR3<float>& toCeil) { return VECTOR3<float>(_mm_ceil_ps(toCeil.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Floor()
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Floor(const SWIZZLE& toFloor) { return Floor(typename SWIZZLE::PARENT(toFloor)); }
+template <typename TYPE> VECTOR3<TYPE> Floor(const VECTOR3<TYPE>& toFloor)
+{
+	return VECTOR3<TYPE>(floor(toFloor.Component(0)), floor(toFloor.Component(1)), floor(toFloor.Component(2)));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR3<float> Floor(const VECTOR3<float>& toFloor) { return VECTOR3<float>(_mm_floor_ps(toFloor.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 3D Abs(), Sign()
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Abs(const SWIZZLE& a) { return Abs(typename SWIZZLE::PARENT(a)); }
+template <typename TYPE> VECTOR3<TYPE> Abs(const VECTOR3<TYPE>& a)
+{
+	return VECTOR3<TYPE>(ComponentAbs((typename ScalarType<TYPE>::type)a.Component(0)), ComponentAbs((typename ScalarType<TYPE>::type)a.Component(1)), ComponentAbs((typename ScalarType<TYPE>::type)a.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sign(const SWIZZLE& a) { return Sign(typename SWIZZLE::PARENT(a)); }
+template <typename TYPE> VECTOR3<TYPE> Sign(const VECTOR3<TYPE>& a)
+{
+	return VECTOR3<TYPE>(ComponentSign((typename ScalarType<TYPE>::type)a.Component(0)), ComponentSign((typename ScalarType<TYPE>::type)a.Component(1)), ComponentSign((typename ScalarType<TYPE>::type)a.Component(2)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Abs(const VECTOR3<float>& a) { return VECTOR3<float>(_mm_andnot_ps(_mm_set1_ps(-0.0f), a.Simd())); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Sign(const VECTOR3<float>& a) { return VECTOR3<float>(_mm_sub_ps(_mm_and_ps(_mm_cmpgt_ps(a.Simd(), _mm_setzero_ps()), _mm_set1_ps(1.0f)), _mm_and_ps(_mm_cmplt_ps(a.Simd(), _mm_setzero_ps()), _mm_set1_ps(1.0f)))); }
+#endif // SVML_USE_SSE
+
+// 3D Clamp(), Saturate(): min(max(x, minimum), maximum), component-wise or by scalars
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Clamp(const SWIZZLE& x, const typename SWIZZLE::PARENT& minimum, const typename SWIZZLE::PARENT& maximum) { return Clamp(typename SWIZZLE::PARENT(x), minimum, maximum); }
+template <typename TYPE> VECTOR3<TYPE> Clamp(const VECTOR3<TYPE>& x, const VECTOR3<TYPE>& minimum, const VECTOR3<TYPE>& maximum)
+{
+	return VECTOR3<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)minimum.Component(0), (typename ScalarType<TYPE>::type)maximum.Component(0)), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)minimum.Component(1), (typename ScalarType<TYPE>::type)maximum.Component(1)), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(2), (typename ScalarType<TYPE>::type)minimum.Component(2), (typename ScalarType<TYPE>::type)maximum.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Clamp(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum) { return Clamp(typename SWIZZLE::PARENT(x), minimum, maximum); }
+template <typename TYPE> VECTOR3<TYPE> Clamp(const VECTOR3<TYPE>& x, const typename ScalarType<TYPE>::type& minimum, const typename ScalarType<TYPE>::type& maximum)
+{
+	return VECTOR3<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), minimum, maximum), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), minimum, maximum), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(2), minimum, maximum));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Saturate(const SWIZZLE& x) { return Saturate(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Saturate(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(2), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Clamp(const VECTOR3<float>& x, const VECTOR3<float>& minimum, const VECTOR3<float>& maximum) { return VECTOR3<float>(_mm_min_ps(maximum.Simd(), _mm_max_ps(minimum.Simd(), x.Simd()))); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Clamp(const VECTOR3<float>& x, const SCALAR_TYPE& minimum, const SCALAR_TYPE& maximum) { return VECTOR3<float>(_mm_min_ps(_mm_set1_ps(maximum), _mm_max_ps(_mm_set1_ps(minimum), x.Simd()))); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Saturate(const VECTOR3<float>& x) { return VECTOR3<float>(_mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_setzero_ps(), x.Simd()))); }
+#endif // SVML_USE_SSE
+
+// 3D Step(): 0 where x < edge, otherwise 1. SmoothStep(): Hermite interpolation between 0 at edge0 and 1 at edge1
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Step(const SWIZZLE0& edge, const SWIZZLE1& x) { return Step(typename SWIZZLE0::PARENT(edge), typename SWIZZLE1::PARENT(x)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const SWIZZLE& edge, const VECTOR3<TYPE>& x) { return Step(typename SWIZZLE::PARENT(edge), x); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const VECTOR3<TYPE>& edge, const SWIZZLE& x) { return Step(edge, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Step(const VECTOR3<TYPE>& edge, const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(ComponentStep((typename ScalarType<TYPE>::type)edge.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), ComponentStep((typename ScalarType<TYPE>::type)edge.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)), ComponentStep((typename ScalarType<TYPE>::type)edge.Component(2), (typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge, const SWIZZLE& x) { return Step(edge, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Step(const typename ScalarType<TYPE>::type& edge, const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(0)), ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(1)), ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type SmoothStep(const typename SWIZZLE::PARENT& edge0, const typename SWIZZLE::PARENT& edge1, const SWIZZLE& x) { return SmoothStep(edge0, edge1, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> SmoothStep(const VECTOR3<TYPE>& edge0, const VECTOR3<TYPE>& edge1, const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(0), (typename ScalarType<TYPE>::type)edge1.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(1), (typename ScalarType<TYPE>::type)edge1.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)), ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(2), (typename ScalarType<TYPE>::type)edge1.Component(2), (typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type SmoothStep(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge0, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge1, const SWIZZLE& x) { return SmoothStep(edge0, edge1, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> SmoothStep(const typename ScalarType<TYPE>::type& edge0, const typename ScalarType<TYPE>::type& edge1, const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(0)), ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(1)), ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(2)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Step(const VECTOR3<float>& edge, const VECTOR3<float>& x) { return VECTOR3<float>(_mm_andnot_ps(_mm_cmplt_ps(x.Simd(), edge.Simd()), _mm_set1_ps(1.0f))); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Step(const SCALAR_TYPE& edge, const VECTOR3<float>& x) { return VECTOR3<float>(_mm_andnot_ps(_mm_cmplt_ps(x.Simd(), _mm_set1_ps(edge)), _mm_set1_ps(1.0f))); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> SmoothStep(const VECTOR3<float>& edge0, const VECTOR3<float>& edge1, const VECTOR3<float>& x) { return VECTOR3<float>(SimdSmoothStep(edge0.Simd(), SimdReplaceW(edge1.Simd(), _mm_set1_ps(1.0f)), x.Simd())); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> SmoothStep(const SCALAR_TYPE& edge0, const SCALAR_TYPE& edge1, const VECTOR3<float>& x) { return VECTOR3<float>(SimdSmoothStep(_mm_set1_ps(edge0), _mm_set1_ps(edge1), x.Simd())); }
+#endif // SVML_USE_SSE
+
+// 3D Fract(): x - Floor(x). Mod(): x - y * Floor(x / y), so the result takes the sign of y
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Fract(const SWIZZLE& x) { return Fract(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Fract(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(ComponentFract((typename ScalarType<TYPE>::type)x.Component(0)), ComponentFract((typename ScalarType<TYPE>::type)x.Component(1)), ComponentFract((typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Mod(const SWIZZLE0& x, const SWIZZLE1& y) { return Mod(typename SWIZZLE0::PARENT(x), typename SWIZZLE1::PARENT(y)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const SWIZZLE& x, const VECTOR3<TYPE>& y) { return Mod(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const VECTOR3<TYPE>& x, const SWIZZLE& y) { return Mod(x, typename SWIZZLE::PARENT(y)); }
+template <typename TYPE> VECTOR3<TYPE> Mod(const VECTOR3<TYPE>& x, const VECTOR3<TYPE>& y)
+{
+	return VECTOR3<TYPE>(ComponentMod((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)y.Component(0)), ComponentMod((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)y.Component(1)), ComponentMod((typename ScalarType<TYPE>::type)x.Component(2), (typename ScalarType<TYPE>::type)y.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& y) { return Mod(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE> VECTOR3<TYPE> Mod(const VECTOR3<TYPE>& x, const typename ScalarType<TYPE>::type& y)
+{
+	return VECTOR3<TYPE>(ComponentMod((typename ScalarType<TYPE>::type)x.Component(0), y), ComponentMod((typename ScalarType<TYPE>::type)x.Component(1), y), ComponentMod((typename ScalarType<TYPE>::type)x.Component(2), y));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Fract(const VECTOR3<float>& x) { return VECTOR3<float>(_mm_sub_ps(x.Simd(), SimdFloor(x.Simd()))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Mod(const VECTOR3<float>& x, const VECTOR3<float>& y) { return VECTOR3<float>(_mm_sub_ps(x.Simd(), _mm_mul_ps(y.Simd(), SimdFloor(_mm_div_ps(x.Simd(), SimdReplaceW(y.Simd(), _mm_set1_ps(1.0f))))))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Mod(const VECTOR3<float>& x, const SCALAR_TYPE& y) { return VECTOR3<float>(_mm_sub_ps(x.Simd(), _mm_mul_ps(_mm_set1_ps(y), SimdFloor(_mm_div_ps(x.Simd(), _mm_set1_ps(y)))))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+// 3D Sqrt(), InverseSqrt(): the second under SVML_PRECISION
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sqrt(const SWIZZLE& x) { return Sqrt(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Sqrt(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(sqrt((typename ScalarType<TYPE>::type)x.Component(0)), sqrt((typename ScalarType<TYPE>::type)x.Component(1)), sqrt((typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type InverseSqrt(const SWIZZLE& x) { return InverseSqrt(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> InverseSqrt(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(0)), PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(1)), PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(2)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> Sqrt(const VECTOR3<float>& x) { return VECTOR3<float>(_mm_sqrt_ps(x.Simd())); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR3<float> InverseSqrt(const VECTOR3<float>& x) { return VECTOR3<float>(SimdInverseSqrt(SimdReplaceW(x.Simd(), _mm_set1_ps(1.0f)))); }
+#endif // SVML_USE_SSE
+
+// 3D Exp(), Exp2(), Log(), Log2(), Pow()
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Exp(const SWIZZLE& x) { return Exp(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Exp(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(exp((typename ScalarType<TYPE>::type)x.Component(0)), exp((typename ScalarType<TYPE>::type)x.Component(1)), exp((typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Exp2(const SWIZZLE& x) { return Exp2(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Exp2(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(0)), pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(1)), pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Log(const SWIZZLE& x) { return Log(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Log(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(log((typename ScalarType<TYPE>::type)x.Component(0)), log((typename ScalarType<TYPE>::type)x.Component(1)), log((typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Log2(const SWIZZLE& x) { return Log2(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Log2(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(ComponentLog2((typename ScalarType<TYPE>::type)x.Component(0)), ComponentLog2((typename ScalarType<TYPE>::type)x.Component(1)), ComponentLog2((typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Pow(const SWIZZLE0& x, const SWIZZLE1& y) { return Pow(typename SWIZZLE0::PARENT(x), typename SWIZZLE1::PARENT(y)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const SWIZZLE& x, const VECTOR3<TYPE>& y) { return Pow(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const VECTOR3<TYPE>& x, const SWIZZLE& y) { return Pow(x, typename SWIZZLE::PARENT(y)); }
+template <typename TYPE> VECTOR3<TYPE> Pow(const VECTOR3<TYPE>& x, const VECTOR3<TYPE>& y)
+{
+	return VECTOR3<TYPE>(pow((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)y.Component(0)), pow((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)y.Component(1)), pow((typename ScalarType<TYPE>::type)x.Component(2), (typename ScalarType<TYPE>::type)y.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& y) { return Pow(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE> VECTOR3<TYPE> Pow(const VECTOR3<TYPE>& x, const typename ScalarType<TYPE>::type& y)
+{
+	return VECTOR3<TYPE>(pow((typename ScalarType<TYPE>::type)x.Component(0), y), pow((typename ScalarType<TYPE>::type)x.Component(1), y), pow((typename ScalarType<TYPE>::type)x.Component(2), y));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Exp(const VECTOR3<float>& x) { return VECTOR3<float>(SimdExp(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Exp2(const VECTOR3<float>& x) { return VECTOR3<float>(SimdExp2(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Log(const VECTOR3<float>& x) { return VECTOR3<float>(SimdLog(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Log2(const VECTOR3<float>& x) { return VECTOR3<float>(SimdLog2(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Pow(const VECTOR3<float>& x, const VECTOR3<float>& y) { return VECTOR3<float>(SimdPow(SimdReplaceW(x.Simd(), _mm_set1_ps(1.0f)), y.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Pow(const VECTOR3<float>& x, const SCALAR_TYPE& y) { return VECTOR3<float>(SimdPow(SimdReplaceW(x.Simd(), _mm_set1_ps(1.0f)), _mm_set1_ps(y))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+// 3D Sin(), Cos(), SinCos(), Tan(), Atan2(): radians. Atan2(y, x) is GLSL's atan(y, x)
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sin(const SWIZZLE& x) { return Sin(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Sin(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(sin((typename ScalarType<TYPE>::type)x.Component(0)), sin((typename ScalarType<TYPE>::type)x.Component(1)), sin((typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cos(const SWIZZLE& x) { return Cos(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Cos(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(cos((typename ScalarType<TYPE>::type)x.Component(0)), cos((typename ScalarType<TYPE>::type)x.Component(1)), cos((typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, void >::type SinCos(const SWIZZLE& x, typename SWIZZLE::PARENT& sine, typename SWIZZLE::PARENT& cosine) { SinCos(typename SWIZZLE::PARENT(x), sine, cosine); }
+template <typename TYPE> void SinCos(const VECTOR3<TYPE>& x, VECTOR3<TYPE>& sine, VECTOR3<TYPE>& cosine)
+{
+	VECTOR3<TYPE> s = Sin(x); // x may be sine or cosine
+	cosine = Cos(x);
+	sine = s;
+}
+template <typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Tan(const SWIZZLE& x) { return Tan(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Tan(const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(tan((typename ScalarType<TYPE>::type)x.Component(0)), tan((typename ScalarType<TYPE>::type)x.Component(1)), tan((typename ScalarType<TYPE>::type)x.Component(2)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Atan2(const SWIZZLE0& y, const SWIZZLE1& x) { return Atan2(typename SWIZZLE0::PARENT(y), typename SWIZZLE1::PARENT(x)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Atan2(const SWIZZLE& y, const VECTOR3<TYPE>& x) { return Atan2(typename SWIZZLE::PARENT(y), x); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Atan2(const VECTOR3<TYPE>& y, const SWIZZLE& x) { return Atan2(y, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR3<TYPE> Atan2(const VECTOR3<TYPE>& y, const VECTOR3<TYPE>& x)
+{
+	return VECTOR3<TYPE>(atan2((typename ScalarType<TYPE>::type)y.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), atan2((typename ScalarType<TYPE>::type)y.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)), atan2((typename ScalarType<TYPE>::type)y.Component(2), (typename ScalarType<TYPE>::type)x.Component(2)));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Sin(const VECTOR3<float>& x) { return VECTOR3<float>(SimdSin(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Cos(const VECTOR3<float>& x) { return VECTOR3<float>(SimdCos(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline void SinCos(const VECTOR3<float>& x, VECTOR3<float>& sine, VECTOR3<float>& cosine)
+{
+	__m128 s, c;
+	SimdSinCos(x.Simd(), s, c);
+	sine = VECTOR3<float>(s);
+	cosine = VECTOR3<float>(c);
+}
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Tan(const VECTOR3<float>& x) { return VECTOR3<float>(SimdTan(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR3<float> Atan2(const VECTOR3<float>& y, const VECTOR3<float>& x) { return VECTOR3<float>(SimdAtan2(y.Simd(), SimdReplaceW(x.Simd(), _mm_set1_ps(1.0f)))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+// 3D Distance()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type Distance(const SWIZZLE0& a, const SWIZZLE1& b) { return Distance(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Distance(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return Distance(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Distance(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return Distance(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> typename ScalarType<TYPE>::type Distance(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+{
+	return PrecisionLength((typename ScalarType<TYPE>::type)(a.x - b.x), (typename ScalarType<TYPE>::type)(a.y - b.y), (typename ScalarType<TYPE>::type)(a.z - b.z));
+}
+
+#ifdef SVML_USE_SSE
+inline SCALAR_TYPE Distance(const VECTOR3<float>& a, const VECTOR3<float>& b) { __m128 d = _mm_sub_ps(a.Simd(), b.Simd()); return PrecisionSqrt(SimdDot3(d, d)); }
+#endif // SVML_USE_SSE
+
+// 3D DistanceSquared()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is3D< typename SWIZZLE0::PARENT >, typename EnableIf< Is3D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type DistanceSquared(const SWIZZLE0& a, const SWIZZLE1& b) { return DistanceSquared(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type DistanceSquared(const SWIZZLE& a, const VECTOR3<TYPE>& b) { return DistanceSquared(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is3D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type DistanceSquared(const VECTOR3<TYPE>& a, const SWIZZLE& b) { return DistanceSquared(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> typename ScalarType<TYPE>::type DistanceSquared(const VECTOR3<TYPE>& a, const VECTOR3<TYPE>& b)
+{
+	return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z);
+}
+
+#ifdef SVML_USE_SSE
+inline SCALAR_TYPE DistanceSquared(const VECTOR3<float>& a, const VECTOR3<float>& b) { __m128 d = _mm_sub_ps(a.Simd(), b.Simd()); return SimdDot3(d, d); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline int DistanceSquared(const VECTOR3<int>& a, const VECTOR3<int>& b) { __m128i d = _mm_sub_epi32(a.Simd(), b.Simd()); return SimdDot3i(d, d); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+
+} // SVML namespace
+
+#endif // SVML_VECTOR3_H
@@ -0,0 +1,1456 @@
+#ifndef SVML_VECTOR4_H
+#define SVML_VECTOR4_H
+
+/*
+
+SVML - Simple Vector Math Library
+Author: Dwight House ( http://dwighthouse.com )
+Assistance by: Dr. Dmitri Volper, Mike Fried, Jeff Hubbard, Chris Peters
+
+Instructions and Information: https://github.com/dwighthouse/svml
+
+Colossians 3:23-24
+
+Copyright (c) 2010-2015 Dwight House
+
+*/
+
+#include "svml_vector3.h"
+
+namespace SVML
+{
+
+//----------------------------------------------------------------------
+// 
+// Sec. 06 - 4D vector type and associated functions
+// 
+//----------------------------------------------------------------------
+
+template <typename TYPE>
+union VECTOR4
+{
+private:
+	struct { TYPE x, y, z, w; } v;
+	typename SimdStorage<TYPE, 4>::type simd;
+
+	// Length property
+	struct LENGTH
+	{
+	private:
+		TYPE x, y, z, w;
+		TYPE ApplyLength(const TYPE& newMag)
+		{
+			TYPE inverseScaledMagnitude = PrecisionDivideByLength(newMag, x, y, z);
+			x *= inverseScaledMagnitude;
+			y *= inverseScaledMagnitude;
+			z *= inverseScaledMagnitude;
+			return newMag;
+		}
+		TYPE Magnitude() const { return PrecisionLength(x, y, z); }
+	public:
+		operator TYPE() const { return Magnitude(); }
+		operator typename WidenedType<TYPE>::type() const { return Magnitude(); }
+		TYPE operator=(const TYPE& rhs) { return ApplyLength(rhs); }
+		TYPE operator+=(const TYPE& rhs) { return ApplyLength(Magnitude() + rhs); }
+		TYPE operator-=(const TYPE& rhs) { return ApplyLength(Magnitude() - rhs); }
+		TYPE operator*=(const TYPE& rhs) { return ApplyLength(Magnitude() * rhs); }
+		TYPE operator/=(const TYPE& rhs) { return ApplyLength(Magnitude() / rhs); }
+	};
+
+public:
+	VECTOR4() {}
+#ifdef SVML_HAS_CONSTEXPR
+	constexpr VECTOR4(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w) : v{x, y, z, w} {}
+	constexpr VECTOR4(const TYPE& x, const TYPE& y, const VECTOR2<TYPE>& zw) : v{x, y, zw.Component(0), zw.Component(1)} {}
+	constexpr VECTOR4(const TYPE& x, const VECTOR2<TYPE>& yz, const TYPE& w) : v{x, yz.Component(0), yz.Component(1), w} {}
+	constexpr VECTOR4(const VECTOR2<TYPE>& xy, const TYPE& z, const TYPE& w) : v{xy.Component(0), xy.Component(1), z, w} {}
+	constexpr VECTOR4(const VECTOR2<TYPE>& xy, const VECTOR2<TYPE>& zw) : v{xy.Component(0), xy.Component(1), zw.Component(0), zw.Component(1)} {}
+	constexpr VECTOR4(const TYPE& x, const VECTOR3<TYPE>& yzw) : v{x, yzw.Component(0), yzw.Component(1), yzw.Component(2)} {}
+	constexpr VECTOR4(const VECTOR3<TYPE>& xyz, const TYPE& w) : v{xyz.Component(0), xyz.Component(1), xyz.Component(2), w} {}
+#else
+	VECTOR4(const TYPE& x, const TYPE& y, const TYPE& z, const TYPE& w) { v.x = x; v.y = y; v.z = z; v.w = w; }
+	VECTOR4(const TYPE& x, const TYPE& y, const VECTOR2<TYPE>& zw) { v.x = x; v.y = y; v.z = zw.Component(0); v.w = zw.Component(1); }
+	VECTOR4(const TYPE& x, const VECTOR2<TYPE>& yz, const TYPE& w) { v.x = x; v.y = yz.Component(0); v.z = yz.Component(1); v.w = w; }
+	VECTOR4(const VECTOR2<TYPE>& xy, const TYPE& z, const TYPE& w) { v.x = xy.Component(0); v.y = xy.Component(1); v.z = z; v.w = w; }
+	VECTOR4(const VECTOR2<TYPE>& xy, const VECTOR2<TYPE>& zw) { v.x = xy.Component(0); v.y = xy.Component(1); v.z = zw.Component(0); v.w = zw.Component(1); }
+	VECTOR4(const TYPE& x, const VECTOR3<TYPE>& yzw) { v.x = x; v.y = yzw.Component(0); v.z = yzw.Component(1); v.w = yzw.Component(2); }
+	VECTOR4(const VECTOR3<TYPE>& xyz, const TYPE& w) { v.x = xyz.Component(0); v.y = xyz.Component(1); v.z = xyz.Component(2); v.w = w; }
+#endif
+	// From another component type (VECTOR4<float> from VECTOR4<HALF>, say), a cast per component
+	template <typename OTHER> explicit VECTOR4(const VECTOR4<OTHER>& other) { *this = VECTOR4((TYPE)other.Component(0), (TYPE)other.Component(1), (TYPE)other.Component(2), (TYPE)other.Component(3)); }
+
+	// Packed storage (NO_SIMD unless SVML_USE_SSE is defined and TYPE is float, or int with SSE4.1)
+	typedef typename SimdStorage<TYPE, 4>::type SIMD;
+	explicit VECTOR4(const SIMD& packed) : simd(packed) {}
+	const SIMD& Simd() const { return simd; }
+
+	// Swizzle variables
+	SWIZZLE<VECTOR4<TYPE>, 0> x, r, s;
+	SWIZZLE<VECTOR4<TYPE>, 1> y, g, t;
+	SWIZZLE<VECTOR4<TYPE>, 2> z, b, p;
+	SWIZZLE<VECTOR4<TYPE>, 3> w, a, q;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0> xx, rr, ss;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1> xy, rg, st;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2> xz, rb, sp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3> xw, ra, sq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0> yx, gr, ts;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1> yy, gg, tt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2> yz, gb, tp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3> yw, ga, tq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0> zx, br, ps;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1> zy, bg, pt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2> zz, bb, pp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3> zw, ba, pq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0> wx, ar, qs;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1> wy, ag, qt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2> wz, ab, qp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3> ww, aa, qq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 0> xxx, rrr, sss;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 1> xxy, rrg, sst;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 2> xxz, rrb, ssp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 3> xxw, rra, ssq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 0> xyx, rgr, sts;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 1> xyy, rgg, stt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 2> xyz, rgb, stp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 3> xyw, rga, stq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 0> xzx, rbr, sps;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 1> xzy, rbg, spt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 2> xzz, rbb, spp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 3> xzw, rba, spq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 0> xwx, rar, sqs;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 1> xwy, rag, sqt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 2> xwz, rab, sqp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 3> xww, raa, sqq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 0> yxx, grr, tss;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 1> yxy, grg, tst;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 2> yxz, grb, tsp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 3> yxw, gra, tsq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 0> yyx, ggr, tts;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 1> yyy, ggg, ttt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 2> yyz, ggb, ttp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 3> yyw, gga, ttq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 0> yzx, gbr, tps;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 1> yzy, gbg, tpt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 2> yzz, gbb, tpp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 3> yzw, gba, tpq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 0> ywx, gar, tqs;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 1> ywy, gag, tqt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 2> ywz, gab, tqp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 3> yww, gaa, tqq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 0> zxx, brr, pss;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 1> zxy, brg, pst;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 2> zxz, brb, psp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 3> zxw, bra, psq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 0> zyx, bgr, pts;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 1> zyy, bgg, ptt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 2> zyz, bgb, ptp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 3> zyw, bga, ptq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 0> zzx, bbr, pps;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 1> zzy, bbg, ppt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 2> zzz, bbb, ppp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 3> zzw, bba, ppq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 0> zwx, bar, pqs;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 1> zwy, bag, pqt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 2> zwz, bab, pqp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 3> zww, baa, pqq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 0> wxx, arr, qss;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 1> wxy, arg, qst;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 2> wxz, arb, qsp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 3> wxw, ara, qsq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 0> wyx, agr, qts;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 1> wyy, agg, qtt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 2> wyz, agb, qtp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 3> wyw, aga, qtq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 0> wzx, abr, qps;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 1> wzy, abg, qpt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 2> wzz, abb, qpp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 3> wzw, aba, qpq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 0> wwx, aar, qqs;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 1> wwy, aag, qqt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 2> wwz, aab, qqp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 3> www, aaa, qqq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 0, 0> xxxx, rrrr, ssss;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 0, 1> xxxy, rrrg, ssst;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 0, 2> xxxz, rrrb, sssp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 0, 3> xxxw, rrra, sssq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 1, 0> xxyx, rrgr, ssts;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 1, 1> xxyy, rrgg, sstt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 1, 2> xxyz, rrgb, sstp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 1, 3> xxyw, rrga, sstq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 2, 0> xxzx, rrbr, ssps;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 2, 1> xxzy, rrbg, sspt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 2, 2> xxzz, rrbb, sspp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 2, 3> xxzw, rrba, sspq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 3, 0> xxwx, rrar, ssqs;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 3, 1> xxwy, rrag, ssqt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 3, 2> xxwz, rrab, ssqp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 0, 3, 3> xxww, rraa, ssqq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 0, 0> xyxx, rgrr, stss;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 0, 1> xyxy, rgrg, stst;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 0, 2> xyxz, rgrb, stsp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 0, 3> xyxw, rgra, stsq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 1, 0> xyyx, rggr, stts;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 1, 1> xyyy, rggg, sttt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 1, 2> xyyz, rggb, sttp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 1, 3> xyyw, rgga, sttq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 2, 0> xyzx, rgbr, stps;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 2, 1> xyzy, rgbg, stpt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 2, 2> xyzz, rgbb, stpp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 2, 3> xyzw, rgba, stpq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 3, 0> xywx, rgar, stqs;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 3, 1> xywy, rgag, stqt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 3, 2> xywz, rgab, stqp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 1, 3, 3> xyww, rgaa, stqq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 0, 0> xzxx, rbrr, spss;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 0, 1> xzxy, rbrg, spst;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 0, 2> xzxz, rbrb, spsp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 0, 3> xzxw, rbra, spsq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 1, 0> xzyx, rbgr, spts;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 1, 1> xzyy, rbgg, sptt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 1, 2> xzyz, rbgb, sptp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 1, 3> xzyw, rbga, sptq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 2, 0> xzzx, rbbr, spps;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 2, 1> xzzy, rbbg, sppt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 2, 2> xzzz, rbbb, sppp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 2, 3> xzzw, rbba, sppq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 3, 0> xzwx, rbar, spqs;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 3, 1> xzwy, rbag, spqt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 3, 2> xzwz, rbab, spqp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 2, 3, 3> xzww, rbaa, spqq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 0, 0> xwxx, rarr, sqss;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 0, 1> xwxy, rarg, sqst;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 0, 2> xwxz, rarb, sqsp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 0, 3> xwxw, rara, sqsq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 1, 0> xwyx, ragr, sqts;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 1, 1> xwyy, ragg, sqtt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 1, 2> xwyz, ragb, sqtp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 1, 3> xwyw, raga, sqtq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 2, 0> xwzx, rabr, sqps;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 2, 1> xwzy, rabg, sqpt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 2, 2> xwzz, rabb, sqpp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 2, 3> xwzw, raba, sqpq;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 3, 0> xwwx, raar, sqqs;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 3, 1> xwwy, raag, sqqt;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 3, 2> xwwz, raab, sqqp;
+	SWIZZLE<VECTOR4<TYPE>, 0, 3, 3, 3> xwww, raaa, sqqq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 0, 0> yxxx, grrr, tsss;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 0, 1> yxxy, grrg, tsst;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 0, 2> yxxz, grrb, tssp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 0, 3> yxxw, grra, tssq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 1, 0> yxyx, grgr, tsts;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 1, 1> yxyy, grgg, tstt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 1, 2> yxyz, grgb, tstp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 1, 3> yxyw, grga, tstq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 2, 0> yxzx, grbr, tsps;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 2, 1> yxzy, grbg, tspt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 2, 2> yxzz, grbb, tspp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 2, 3> yxzw, grba, tspq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 3, 0> yxwx, grar, tsqs;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 3, 1> yxwy, grag, tsqt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 3, 2> yxwz, grab, tsqp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 0, 3, 3> yxww, graa, tsqq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 0, 0> yyxx, ggrr, ttss;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 0, 1> yyxy, ggrg, ttst;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 0, 2> yyxz, ggrb, ttsp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 0, 3> yyxw, ggra, ttsq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 1, 0> yyyx, gggr, ttts;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 1, 1> yyyy, gggg, tttt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 1, 2> yyyz, gggb, tttp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 1, 3> yyyw, ggga, tttq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 2, 0> yyzx, ggbr, ttps;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 2, 1> yyzy, ggbg, ttpt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 2, 2> yyzz, ggbb, ttpp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 2, 3> yyzw, ggba, ttpq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 3, 0> yywx, ggar, ttqs;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 3, 1> yywy, ggag, ttqt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 3, 2> yywz, ggab, ttqp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 1, 3, 3> yyww, ggaa, ttqq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 0, 0> yzxx, gbrr, tpss;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 0, 1> yzxy, gbrg, tpst;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 0, 2> yzxz, gbrb, tpsp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 0, 3> yzxw, gbra, tpsq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 1, 0> yzyx, gbgr, tpts;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 1, 1> yzyy, gbgg, tptt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 1, 2> yzyz, gbgb, tptp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 1, 3> yzyw, gbga, tptq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 2, 0> yzzx, gbbr, tpps;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 2, 1> yzzy, gbbg, tppt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 2, 2> yzzz, gbbb, tppp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 2, 3> yzzw, gbba, tppq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 3, 0> yzwx, gbar, tpqs;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 3, 1> yzwy, gbag, tpqt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 3, 2> yzwz, gbab, tpqp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 2, 3, 3> yzww, gbaa, tpqq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 0, 0> ywxx, garr, tqss;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 0, 1> ywxy, garg, tqst;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 0, 2> ywxz, garb, tqsp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 0, 3> ywxw, gara, tqsq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 1, 0> ywyx, gagr, tqts;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 1, 1> ywyy, gagg, tqtt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 1, 2> ywyz, gagb, tqtp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 1, 3> ywyw, gaga, tqtq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 2, 0> ywzx, gabr, tqps;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 2, 1> ywzy, gabg, tqpt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 2, 2> ywzz, gabb, tqpp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 2, 3> ywzw, gaba, tqpq;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 3, 0> ywwx, gaar, tqqs;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 3, 1> ywwy, gaag, tqqt;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 3, 2> ywwz, gaab, tqqp;
+	SWIZZLE<VECTOR4<TYPE>, 1, 3, 3, 3> ywww, gaaa, tqqq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 0, 0> zxxx, brrr, psss;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 0, 1> zxxy, brrg, psst;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 0, 2> zxxz, brrb, pssp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 0, 3> zxxw, brra, pssq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 1, 0> zxyx, brgr, psts;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 1, 1> zxyy, brgg, pstt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 1, 2> zxyz, brgb, pstp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 1, 3> zxyw, brga, pstq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 2, 0> zxzx, brbr, psps;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 2, 1> zxzy, brbg, pspt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 2, 2> zxzz, brbb, pspp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 2, 3> zxzw, brba, pspq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 3, 0> zxwx, brar, psqs;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 3, 1> zxwy, brag, psqt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 3, 2> zxwz, brab, psqp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 0, 3, 3> zxww, braa, psqq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 0, 0> zyxx, bgrr, ptss;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 0, 1> zyxy, bgrg, ptst;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 0, 2> zyxz, bgrb, ptsp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 0, 3> zyxw, bgra, ptsq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 1, 0> zyyx, bggr, ptts;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 1, 1> zyyy, bggg, pttt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 1, 2> zyyz, bggb, pttp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 1, 3> zyyw, bgga, pttq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 2, 0> zyzx, bgbr, ptps;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 2, 1> zyzy, bgbg, ptpt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 2, 2> zyzz, bgbb, ptpp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 2, 3> zyzw, bgba, ptpq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 3, 0> zywx, bgar, ptqs;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 3, 1> zywy, bgag, ptqt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 3, 2> zywz, bgab, ptqp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 1, 3, 3> zyww, bgaa, ptqq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 0, 0> zzxx, bbrr, ppss;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 0, 1> zzxy, bbrg, ppst;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 0, 2> zzxz, bbrb, ppsp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 0, 3> zzxw, bbra, ppsq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 1, 0> zzyx, bbgr, ppts;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 1, 1> zzyy, bbgg, pptt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 1, 2> zzyz, bbgb, pptp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 1, 3> zzyw, bbga, pptq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 2, 0> zzzx, bbbr, ppps;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 2, 1> zzzy, bbbg, pppt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 2, 2> zzzz, bbbb, pppp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 2, 3> zzzw, bbba, pppq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 3, 0> zzwx, bbar, ppqs;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 3, 1> zzwy, bbag, ppqt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 3, 2> zzwz, bbab, ppqp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 2, 3, 3> zzww, bbaa, ppqq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 0, 0> zwxx, barr, pqss;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 0, 1> zwxy, barg, pqst;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 0, 2> zwxz, barb, pqsp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 0, 3> zwxw, bara, pqsq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 1, 0> zwyx, bagr, pqts;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 1, 1> zwyy, bagg, pqtt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 1, 2> zwyz, bagb, pqtp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 1, 3> zwyw, baga, pqtq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 2, 0> zwzx, babr, pqps;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 2, 1> zwzy, babg, pqpt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 2, 2> zwzz, babb, pqpp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 2, 3> zwzw, baba, pqpq;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 3, 0> zwwx, baar, pqqs;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 3, 1> zwwy, baag, pqqt;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 3, 2> zwwz, baab, pqqp;
+	SWIZZLE<VECTOR4<TYPE>, 2, 3, 3, 3> zwww, baaa, pqqq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 0, 0> wxxx, arrr, qsss;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 0, 1> wxxy, arrg, qsst;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 0, 2> wxxz, arrb, qssp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 0, 3> wxxw, arra, qssq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 1, 0> wxyx, argr, qsts;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 1, 1> wxyy, argg, qstt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 1, 2> wxyz, argb, qstp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 1, 3> wxyw, arga, qstq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 2, 0> wxzx, arbr, qsps;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 2, 1> wxzy, arbg, qspt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 2, 2> wxzz, arbb, qspp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 2, 3> wxzw, arba, qspq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 3, 0> wxwx, arar, qsqs;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 3, 1> wxwy, arag, qsqt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 3, 2> wxwz, arab, qsqp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 0, 3, 3> wxww, araa, qsqq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 0, 0> wyxx, agrr, qtss;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 0, 1> wyxy, agrg, qtst;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 0, 2> wyxz, agrb, qtsp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 0, 3> wyxw, agra, qtsq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 1, 0> wyyx, aggr, qtts;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 1, 1> wyyy, aggg, qttt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 1, 2> wyyz, aggb, qttp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 1, 3> wyyw, agga, qttq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 2, 0> wyzx, agbr, qtps;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 2, 1> wyzy, agbg, qtpt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 2, 2> wyzz, agbb, qtpp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 2, 3> wyzw, agba, qtpq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 3, 0> wywx, agar, qtqs;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 3, 1> wywy, agag, qtqt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 3, 2> wywz, agab, qtqp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 1, 3, 3> wyww, agaa, qtqq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 0, 0> wzxx, abrr, qpss;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 0, 1> wzxy, abrg, qpst;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 0, 2> wzxz, abrb, qpsp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 0, 3> wzxw, abra, qpsq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 1, 0> wzyx, abgr, qpts;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 1, 1> wzyy, abgg, qptt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 1, 2> wzyz, abgb, qptp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 1, 3> wzyw, abga, qptq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 2, 0> wzzx, abbr, qpps;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 2, 1> wzzy, abbg, qppt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 2, 2> wzzz, abbb, qppp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 2, 3> wzzw, abba, qppq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 3, 0> wzwx, abar, qpqs;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 3, 1> wzwy, abag, qpqt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 3, 2> wzwz, abab, qpqp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 2, 3, 3> wzww, abaa, qpqq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 0, 0> wwxx, aarr, qqss;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 0, 1> wwxy, aarg, qqst;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 0, 2> wwxz, aarb, qqsp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 0, 3> wwxw, aara, qqsq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 1, 0> wwyx, aagr, qqts;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 1, 1> wwyy, aagg, qqtt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 1, 2> wwyz, aagb, qqtp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 1, 3> wwyw, aaga, qqtq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 2, 0> wwzx, aabr, qqps;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 2, 1> wwzy, aabg, qqpt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 2, 2> wwzz, aabb, qqpp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 2, 3> wwzw, aaba, qqpq;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 3, 0> wwwx, aaar, qqqs;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 3, 1> wwwy, aaag, qqqt;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 3, 2> wwwz, aaab, qqqp;
+	SWIZZLE<VECTOR4<TYPE>, 3, 3, 3, 3> wwww, aaaa, qqqq;
+
+	// Length property
+	LENGTH Length;
+
+	// Assignment operators (default for = is fine)
+	const VECTOR4& operator+=(const VECTOR4& rhs) { v.x += rhs.v.x; v.y += rhs.v.y; v.z += rhs.v.z; v.w += rhs.v.w; return *this; }
+	const VECTOR4& operator-=(const VECTOR4& rhs) { v.x -= rhs.v.x; v.y -= rhs.v.y; v.z -= rhs.v.z; v.w -= rhs.v.w; return *this; }
+	const VECTOR4& operator*=(const VECTOR4& rhs) { v.x *= rhs.v.x; v.y *= rhs.v.y; v.z *= rhs.v.z; v.w *= rhs.v.w; return *this; }
+	const VECTOR4& operator/=(const VECTOR4& rhs) { v.x /= rhs.v.x; v.y /= rhs.v.y; v.z /= rhs.v.z; v.w /= rhs.v.w; return *this; }
+	const VECTOR4& operator*=(const TYPE& rhs) { v.x *= rhs; v.y *= rhs; v.z *= rhs; v.w *= rhs; return *this; }
+	const VECTOR4& operator/=(const TYPE& rhs) { v.x /= rhs; v.y /= rhs; v.z /= rhs; v.w /= rhs; return *this; }
+
+	// Component access for expression templates and constant expressions
+	SVML_CONSTEXPR TYPE Component(const unsigned& index) const { return (index == 0) ? v.x : ((index == 1) ? v.y : ((index == 2) ? v.z : (v.w))); }
+
+	// Array notation access
+	const TYPE& operator[](const unsigned& index)
+	{
+		if (index == 0) { return v.x; }
+		else if (index == 1) { return v.y; }
+		else if (index == 2) { return v.z; }
+		else if (index == 3) { return v.w; }
+		else { FatalError("Attempted out of bounds bracket access of 4D vector.", index); }
+	}
+
+	// Negation
+	SVML_CONSTEXPR VECTOR4 operator-() const { return VECTOR4(-v.x, -v.y, -v.z, v.w); }
+
+#ifdef SVML_FAST_RSQRT
+	void Normalize() { (*this).xyz *= PrecisionDivideByLength((TYPE)1, v.x, v.y, v.z); }
+#else
+	void Normalize() { (*this).xyz /= this->Length; }
+#endif
+};
+
+// 4D SSE member specializations
+#ifdef SVML_USE_SSE
+template <> inline VECTOR4<float>::VECTOR4(const float& x, const float& y, const float& z, const float& w) { simd = _mm_set_ps(w, z, y, x); }
+template <> inline VECTOR4<float>::VECTOR4(const float& x, const float& y, const VECTOR2<float>& zw) { simd = _mm_set_ps(zw.y, zw.x, y, x); }
+template <> inline VECTOR4<float>::VECTOR4(const float& x, const VECTOR2<float>& yz, const float& w) { simd = _mm_set_ps(w, yz.y, yz.x, x); }
+template <> inline VECTOR4<float>::VECTOR4(const VECTOR2<float>& xy, const float& z, const float& w) { simd = _mm_set_ps(w, z, xy.y, xy.x); }
+template <> inline VECTOR4<float>::VECTOR4(const VECTOR2<float>& xy, const VECTOR2<float>& zw) { simd = _mm_set_ps(zw.y, zw.x, xy.y, xy.x); }
+template <> inline VECTOR4<float>::VECTOR4(const float& x, const VECTOR3<float>& yzw) { simd = _mm_set_ps(yzw.z, yzw.y, yzw.x, x); }
+template <> inline VECTOR4<float>::VECTOR4(const VECTOR3<float>& xyz, const float& w) { simd = SimdReplaceW(xyz.Simd(), _mm_set1_ps(w)); }
+template <> inline const VECTOR4<float>& VECTOR4<float>::operator+=(const VECTOR4<float>& rhs) { simd = _mm_add_ps(simd, rhs.simd); return *this; }
+template <> inline const VECTOR4<float>& VECTOR4<float>::operator-=(const VECTOR4<float>& rhs) { simd = _mm_sub_ps(simd, rhs.simd); return *this; }
+template <> inline const VECTOR4<float>& VECTOR4<float>::operator*=(const VECTOR4<float>& rhs) { simd = _mm_mul_ps(simd, rhs.simd); return *this; }
+template <> inline const VECTOR4<float>& VECTOR4<float>::operator/=(const VECTOR4<float>& rhs) { simd = _mm_div_ps(simd, rhs.simd); return *this; }
+template <> inline const VECTOR4<float>& VECTOR4<float>::operator*=(const float& rhs) { simd = _mm_mul_ps(simd, _mm_set1_ps(rhs)); return *this; }
+template <> inline const VECTOR4<float>& VECTOR4<float>::operator/=(const float& rhs) { simd = _mm_div_ps(simd, _mm_set1_ps(rhs)); return *this; }
+template <> inline VECTOR4<float> VECTOR4<float>::operator-() const { return VECTOR4<float>(_mm_xor_ps(simd, _mm_set_ps(0.0f, -0.0f, -0.0f, -0.0f))); }
+#endif // SVML_USE_SSE
+
+// 4D SSE4.1 integer member specializations (division stays component by component)
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+template <> inline VECTOR4<int>::VECTOR4(const int& x, const int& y, const int& z, const int& w) { simd = _mm_set_epi32(w, z, y, x); }
+template <> inline VECTOR4<int>::VECTOR4(const int& x, const int& y, const VECTOR2<int>& zw) { simd = _mm_set_epi32(zw.y, zw.x, y, x); }
+template <> inline VECTOR4<int>::VECTOR4(const int& x, const VECTOR2<int>& yz, const int& w) { simd = _mm_set_epi32(w, yz.y, yz.x, x); }
+template <> inline VECTOR4<int>::VECTOR4(const VECTOR2<int>& xy, const int& z, const int& w) { simd = _mm_set_epi32(w, z, xy.y, xy.x); }
+template <> inline VECTOR4<int>::VECTOR4(const VECTOR2<int>& xy, const VECTOR2<int>& zw) { simd = _mm_set_epi32(zw.y, zw.x, xy.y, xy.x); }
+template <> inline VECTOR4<int>::VECTOR4(const int& x, const VECTOR3<int>& yzw) { simd = _mm_set_epi32(yzw.z, yzw.y, yzw.x, x); }
+template <> inline VECTOR4<int>::VECTOR4(const VECTOR3<int>& xyz, const int& w) { simd = _mm_insert_epi32(xyz.Simd(), w, 3); }
+template <> inline const VECTOR4<int>& VECTOR4<int>::operator+=(const VECTOR4<int>& rhs) { simd = _mm_add_epi32(simd, rhs.simd); return *this; }
+template <> inline const VECTOR4<int>& VECTOR4<int>::operator-=(const VECTOR4<int>& rhs) { simd = _mm_sub_epi32(simd, rhs.simd); return *this; }
+template <> inline const VECTOR4<int>& VECTOR4<int>::operator*=(const VECTOR4<int>& rhs) { simd = _mm_mullo_epi32(simd, rhs.simd); return *this; }
+template <> inline const VECTOR4<int>& VECTOR4<int>::operator*=(const int& rhs) { simd = _mm_mullo_epi32(simd, _mm_set1_epi32(rhs)); return *this; }
+template <> inline VECTOR4<int> VECTOR4<int>::operator-() const { return VECTOR4<int>(_mm_sign_epi32(simd, _mm_set_epi32(1, -1, -1, -1))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 4D AVX double member specializations, through unaligned loads and stores of the components
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> SimdStore4d(const __m256d& packed) { VECTOR4<double> result; _mm256_storeu_pd((double*)&result, packed); return result; }
+template <> inline const VECTOR4<double>& VECTOR4<double>::operator+=(const VECTOR4<double>& rhs) { _mm256_storeu_pd((double*)this, _mm256_add_pd(_mm256_loadu_pd((const double*)&*this), _mm256_loadu_pd((const double*)&rhs))); return *this; }
+template <> inline const VECTOR4<double>& VECTOR4<double>::operator-=(const VECTOR4<double>& rhs) { _mm256_storeu_pd((double*)this, _mm256_sub_pd(_mm256_loadu_pd((const double*)&*this), _mm256_loadu_pd((const double*)&rhs))); return *this; }
+template <> inline const VECTOR4<double>& VECTOR4<double>::operator*=(const VECTOR4<double>& rhs) { _mm256_storeu_pd((double*)this, _mm256_mul_pd(_mm256_loadu_pd((const double*)&*this), _mm256_loadu_pd((const double*)&rhs))); return *this; }
+template <> inline const VECTOR4<double>& VECTOR4<double>::operator/=(const VECTOR4<double>& rhs) { _mm256_storeu_pd((double*)this, _mm256_div_pd(_mm256_loadu_pd((const double*)&*this), _mm256_loadu_pd((const double*)&rhs))); return *this; }
+template <> inline const VECTOR4<double>& VECTOR4<double>::operator*=(const double& rhs) { _mm256_storeu_pd((double*)this, _mm256_mul_pd(_mm256_loadu_pd((const double*)&*this), _mm256_set1_pd(rhs))); return *this; }
+template <> inline const VECTOR4<double>& VECTOR4<double>::operator/=(const double& rhs) { _mm256_storeu_pd((double*)this, _mm256_div_pd(_mm256_loadu_pd((const double*)&*this), _mm256_set1_pd(rhs))); return *this; }
+template <> inline VECTOR4<double> VECTOR4<double>::operator-() const { return SimdStore4d(_mm256_xor_pd(_mm256_loadu_pd((const double*)&*this), _mm256_set_pd(0.0, -0.0, -0.0, -0.0))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Negate [-]
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_NONE, EXPRESSION_NEGATE > >::type operator-(const SWIZZLE& toNegate)
+{
+	return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_NONE, EXPRESSION_NEGATE >(toNegate, EXPRESSION_NONE());
+}
+
+// 4D Addition [+]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_ADD > >::type >::type operator+(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_ADD >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR4<TYPE>, EXPRESSION_ADD > >::type operator+(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR4<TYPE>, EXPRESSION_ADD >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR4<TYPE>, SWIZZLE, EXPRESSION_ADD > >::type operator+(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR4<TYPE>, SWIZZLE, EXPRESSION_ADD >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> operator+(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return VECTOR4<TYPE>(lhs.Component(0) + rhs.Component(0), lhs.Component(1) + rhs.Component(1), lhs.Component(2) + rhs.Component(2), lhs.Component(3) + rhs.Component(3));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> operator+(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return VECTOR4<float>(_mm_add_ps(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> operator+(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return VECTOR4<int>(_mm_add_epi32(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> operator+(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return SimdStore4d(_mm256_add_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Subtraction [-]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_SUBTRACT > >::type >::type operator-(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR4<TYPE>, EXPRESSION_SUBTRACT > >::type operator-(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR4<TYPE>, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR4<TYPE>, SWIZZLE, EXPRESSION_SUBTRACT > >::type operator-(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR4<TYPE>, SWIZZLE, EXPRESSION_SUBTRACT >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> operator-(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return VECTOR4<TYPE>(lhs.Component(0) - rhs.Component(0), lhs.Component(1) - rhs.Component(1), lhs.Component(2) - rhs.Component(2), lhs.Component(3) - rhs.Component(3));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> operator-(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return VECTOR4<float>(_mm_sub_ps(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> operator-(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return VECTOR4<int>(_mm_sub_epi32(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> operator-(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return SimdStore4d(_mm256_sub_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Multiplication [*]: Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_MULTIPLY > >::type >::type operator*(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR4<TYPE>, EXPRESSION_MULTIPLY > >::type operator*(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR4<TYPE>, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR4<TYPE>, SWIZZLE, EXPRESSION_MULTIPLY > >::type operator*(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR4<TYPE>, SWIZZLE, EXPRESSION_MULTIPLY >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> operator*(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return VECTOR4<TYPE>(lhs.Component(0) * rhs.Component(0), lhs.Component(1) * rhs.Component(1), lhs.Component(2) * rhs.Component(2), lhs.Component(3) * rhs.Component(3));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> operator*(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return VECTOR4<float>(_mm_mul_ps(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> operator*(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return VECTOR4<int>(_mm_mullo_epi32(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> operator*(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return SimdStore4d(_mm256_mul_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Division [/]: Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_DIVIDE > >::type >::type operator/(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE0::PARENT >::type, SWIZZLE0, SWIZZLE1, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR4<TYPE>, EXPRESSION_DIVIDE > >::type operator/(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, VECTOR4<TYPE>, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR4<TYPE>, SWIZZLE, EXPRESSION_DIVIDE > >::type operator/(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, VECTOR4<TYPE>, SWIZZLE, EXPRESSION_DIVIDE >(lhs, rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> operator/(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return VECTOR4<TYPE>(lhs.Component(0) / rhs.Component(0), lhs.Component(1) / rhs.Component(1), lhs.Component(2) / rhs.Component(2), lhs.Component(3) / rhs.Component(3));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> operator/(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return VECTOR4<float>(_mm_div_ps(lhs.Simd(), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> operator/(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return SimdStore4d(_mm256_div_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Multiplication [*]: Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_MULTIPLY > >::type operator*(const SWIZZLE& lhs, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_MULTIPLY >(lhs, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(rhs)); }
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_MULTIPLY > >::type operator*(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& lhs, const SWIZZLE& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_MULTIPLY >(EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(lhs), rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> operator*(const VECTOR4<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs)
+{
+	return VECTOR4<TYPE>(lhs.Component(0) * rhs, lhs.Component(1) * rhs, lhs.Component(2) * rhs, lhs.Component(3) * rhs);
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> operator*(const typename ScalarType<TYPE>::type& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return VECTOR4<TYPE>(lhs * rhs.Component(0), lhs * rhs.Component(1), lhs * rhs.Component(2), lhs * rhs.Component(3));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> operator*(const VECTOR4<float>& lhs, const SCALAR_TYPE& rhs) { return VECTOR4<float>(_mm_mul_ps(lhs.Simd(), _mm_set1_ps(rhs))); }
+inline VECTOR4<float> operator*(const SCALAR_TYPE& lhs, const VECTOR4<float>& rhs) { return VECTOR4<float>(_mm_mul_ps(_mm_set1_ps(lhs), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> operator*(const VECTOR4<int>& lhs, const int& rhs) { return VECTOR4<int>(_mm_mullo_epi32(lhs.Simd(), _mm_set1_epi32(rhs))); }
+inline VECTOR4<int> operator*(const int& lhs, const VECTOR4<int>& rhs) { return VECTOR4<int>(_mm_mullo_epi32(_mm_set1_epi32(lhs), rhs.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> operator*(const VECTOR4<double>& lhs, const double& rhs) { return SimdStore4d(_mm256_mul_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_set1_pd(rhs))); }
+inline VECTOR4<double> operator*(const double& lhs, const VECTOR4<double>& rhs) { return SimdStore4d(_mm256_mul_pd(_mm256_set1_pd(lhs), _mm256_loadu_pd((const double*)&rhs))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Division [/]: Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_DIVIDE > >::type operator/(const SWIZZLE& lhs, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, SWIZZLE, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, EXPRESSION_DIVIDE >(lhs, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(rhs)); }
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_DIVIDE > >::type operator/(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& lhs, const SWIZZLE& rhs) { return EXPRESSION4< typename ComponentType< typename SWIZZLE::PARENT >::type, EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >, SWIZZLE, EXPRESSION_DIVIDE >(EXPRESSION_SCALAR< typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type >(lhs), rhs); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> operator/(const VECTOR4<TYPE>& lhs, const typename ScalarType<TYPE>::type& rhs)
+{
+	return VECTOR4<TYPE>(lhs.Component(0) / rhs, lhs.Component(1) / rhs, lhs.Component(2) / rhs, lhs.Component(3) / rhs);
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> operator/(const typename ScalarType<TYPE>::type& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return VECTOR4<TYPE>(lhs / rhs.Component(0), lhs / rhs.Component(1), lhs / rhs.Component(2), lhs / rhs.Component(3));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> operator/(const VECTOR4<float>& lhs, const SCALAR_TYPE& rhs) { return VECTOR4<float>(_mm_div_ps(lhs.Simd(), _mm_set1_ps(rhs))); }
+inline VECTOR4<float> operator/(const SCALAR_TYPE& lhs, const VECTOR4<float>& rhs) { return VECTOR4<float>(_mm_div_ps(_mm_set1_ps(lhs), rhs.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> operator/(const VECTOR4<double>& lhs, const double& rhs) { return SimdStore4d(_mm256_div_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_set1_pd(rhs))); }
+inline VECTOR4<double> operator/(const double& lhs, const VECTOR4<double>& rhs) { return SimdStore4d(_mm256_div_pd(_mm256_set1_pd(lhs), _mm256_loadu_pd((const double*)&rhs))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D component-wise comparison result: bit i is set where component i compared true
+struct MASK4
+{
+	unsigned bits;
+
+	// Constructors
+	SVML_CONSTEXPR MASK4() : bits(0) {}
+	SVML_CONSTEXPR MASK4(const bool& x, const bool& y, const bool& z, const bool& w) : bits((x ? 1u : 0u) | (y ? 2u : 0u) | (z ? 4u : 0u) | (w ? 8u : 0u)) {}
+	static SVML_CONSTEXPR MASK4 FromBits(const unsigned& bits) { return MASK4(bits & 15u, 0); } // Only the low 4 bits are kept
+
+	SVML_CONSTEXPR bool operator[](const unsigned& index) const { return ((bits >> index) & 1u) != 0; }
+
+private:
+	SVML_CONSTEXPR MASK4(const unsigned& bits, int) : bits(bits) {}
+};
+
+// 4D mask [&], [|], [^], [!], [==], [!=], Any(), All()
+SVML_CONSTEXPR MASK4 operator&(const MASK4& lhs, const MASK4& rhs) { return MASK4::FromBits(lhs.bits & rhs.bits); }
+SVML_CONSTEXPR MASK4 operator|(const MASK4& lhs, const MASK4& rhs) { return MASK4::FromBits(lhs.bits | rhs.bits); }
+SVML_CONSTEXPR MASK4 operator^(const MASK4& lhs, const MASK4& rhs) { return MASK4::FromBits(lhs.bits ^ rhs.bits); }
+SVML_CONSTEXPR MASK4 operator!(const MASK4& mask) { return MASK4::FromBits(~mask.bits); }
+SVML_CONSTEXPR bool operator==(const MASK4& lhs, const MASK4& rhs) { return lhs.bits == rhs.bits; }
+SVML_CONSTEXPR bool operator!=(const MASK4& lhs, const MASK4& rhs) { return lhs.bits != rhs.bits; }
+SVML_CONSTEXPR bool Any(const MASK4& mask) { return mask.bits != 0; }
+SVML_CONSTEXPR bool All(const MASK4& mask) { return mask.bits == 15u; }
+
+// 4D Equal To [==]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator==(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) == typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator==(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) == rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator==(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs == typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator==(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return !(lhs.Component(0) != rhs.Component(0) || lhs.Component(1) != rhs.Component(1) || lhs.Component(2) != rhs.Component(2) || lhs.Component(3) != rhs.Component(3));
+}
+
+// 4D Not Equal To [!=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator!=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) != typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator!=(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) != rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator!=(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs != typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator!=(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return lhs.Component(0) != rhs.Component(0) || lhs.Component(1) != rhs.Component(1) || lhs.Component(2) != rhs.Component(2) || lhs.Component(3) != rhs.Component(3);
+}
+
+// 4D AlmostEqual()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type AlmostEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqual((typename SWIZZLE0::PARENT(lhs)), (typename SWIZZLE1::PARENT(rhs))); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return AlmostEqual((typename SWIZZLE::PARENT(lhs)), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type AlmostEqual(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqual(lhs, (typename SWIZZLE::PARENT(rhs))); }
+template <typename TYPE> bool AlmostEqual(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return fabs(lhs.Component(0) - rhs.Component(0)) < ScalarType<TYPE>::Epsilon() && fabs(lhs.Component(1) - rhs.Component(1)) < ScalarType<TYPE>::Epsilon() && fabs(lhs.Component(2) - rhs.Component(2)) < ScalarType<TYPE>::Epsilon() && fabs(lhs.Component(3) - rhs.Component(3)) < ScalarType<TYPE>::Epsilon();
+}
+
+// 4D Less Than [<]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) < typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator<(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) < rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator<(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs < typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator<(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return lhs.Component(0) < rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && (lhs.Component(1) < rhs.Component(1) || (lhs.Component(1) == rhs.Component(1) && (lhs.Component(2) < rhs.Component(2) || (lhs.Component(2) == rhs.Component(2) && lhs.Component(3) < rhs.Component(3))))));
+}
+
+// 4D Greater Than [>]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) > typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator>(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) > rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator>(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs > typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator>(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return lhs.Component(0) > rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && (lhs.Component(1) > rhs.Component(1) || (lhs.Component(1) == rhs.Component(1) && (lhs.Component(2) > rhs.Component(2) || (lhs.Component(2) == rhs.Component(2) && lhs.Component(3) > rhs.Component(3))))));
+}
+
+// 4D Less Than Or Equal To [<=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator<=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) <= typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator<=(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) <= rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator<=(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs <= typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator<=(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return lhs.Component(0) < rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && (lhs.Component(1) < rhs.Component(1) || (lhs.Component(1) == rhs.Component(1) && (lhs.Component(2) < rhs.Component(2) || (lhs.Component(2) == rhs.Component(2) && lhs.Component(3) <= rhs.Component(3))))));
+}
+
+// 4D Greater Than Or Equal To [<=]
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, bool >::type >::type operator>=(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return typename SWIZZLE0::PARENT(lhs) >= typename SWIZZLE1::PARENT(rhs); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator>=(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return typename SWIZZLE::PARENT(lhs) >= rhs; }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, bool >::type operator>=(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return lhs >= typename SWIZZLE::PARENT(rhs); }
+template <typename TYPE> SVML_CONSTEXPR bool operator>=(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs)
+{
+	return lhs.Component(0) > rhs.Component(0) || (lhs.Component(0) == rhs.Component(0) && (lhs.Component(1) > rhs.Component(1) || (lhs.Component(1) == rhs.Component(1) && (lhs.Component(2) > rhs.Component(2) || (lhs.Component(2) == rhs.Component(2) && lhs.Component(3) >= rhs.Component(3))))));
+}
+
+// 4D component-wise comparisons: Equal(), NotEqual(), AlmostEqualMask(), LessThan(), GreaterThan(), LessThanEqual(), GreaterThanEqual()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK4 >::type >::type >::type Equal(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return Equal(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type Equal(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return Equal(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type Equal(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return Equal(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK4 Equal(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs) { return MASK4(lhs.Component(0) == rhs.Component(0), lhs.Component(1) == rhs.Component(1), lhs.Component(2) == rhs.Component(2), lhs.Component(3) == rhs.Component(3)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK4 >::type >::type >::type NotEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return NotEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type NotEqual(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return NotEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type NotEqual(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return NotEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK4 NotEqual(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs) { return MASK4(lhs.Component(0) != rhs.Component(0), lhs.Component(1) != rhs.Component(1), lhs.Component(2) != rhs.Component(2), lhs.Component(3) != rhs.Component(3)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK4 >::type >::type >::type AlmostEqualMask(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return AlmostEqualMask(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type AlmostEqualMask(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return AlmostEqualMask(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type AlmostEqualMask(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return AlmostEqualMask(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> inline MASK4 AlmostEqualMask(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs) { return MASK4(fabs(lhs.Component(0) - rhs.Component(0)) < ScalarType<TYPE>::Epsilon(), fabs(lhs.Component(1) - rhs.Component(1)) < ScalarType<TYPE>::Epsilon(), fabs(lhs.Component(2) - rhs.Component(2)) < ScalarType<TYPE>::Epsilon(), fabs(lhs.Component(3) - rhs.Component(3)) < ScalarType<TYPE>::Epsilon()); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK4 >::type >::type >::type LessThan(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return LessThan(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type LessThan(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return LessThan(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type LessThan(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return LessThan(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK4 LessThan(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs) { return MASK4(lhs.Component(0) < rhs.Component(0), lhs.Component(1) < rhs.Component(1), lhs.Component(2) < rhs.Component(2), lhs.Component(3) < rhs.Component(3)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK4 >::type >::type >::type GreaterThan(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return GreaterThan(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type GreaterThan(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return GreaterThan(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type GreaterThan(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return GreaterThan(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK4 GreaterThan(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs) { return MASK4(lhs.Component(0) > rhs.Component(0), lhs.Component(1) > rhs.Component(1), lhs.Component(2) > rhs.Component(2), lhs.Component(3) > rhs.Component(3)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK4 >::type >::type >::type LessThanEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return LessThanEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type LessThanEqual(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return LessThanEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type LessThanEqual(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return LessThanEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK4 LessThanEqual(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs) { return MASK4(lhs.Component(0) <= rhs.Component(0), lhs.Component(1) <= rhs.Component(1), lhs.Component(2) <= rhs.Component(2), lhs.Component(3) <= rhs.Component(3)); }
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK4 >::type >::type >::type GreaterThanEqual(const SWIZZLE0& lhs, const SWIZZLE1& rhs) { return GreaterThanEqual(typename SWIZZLE0::PARENT(lhs), typename SWIZZLE1::PARENT(rhs)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type GreaterThanEqual(const SWIZZLE& lhs, const VECTOR4<TYPE>& rhs) { return GreaterThanEqual(typename SWIZZLE::PARENT(lhs), rhs); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename MaskType<TYPE, MASK4>::type >::type GreaterThanEqual(const VECTOR4<TYPE>& lhs, const SWIZZLE& rhs) { return GreaterThanEqual(lhs, typename SWIZZLE::PARENT(rhs)); }
+template <typename TYPE> SVML_CONSTEXPR MASK4 GreaterThanEqual(const VECTOR4<TYPE>& lhs, const VECTOR4<TYPE>& rhs) { return MASK4(lhs.Component(0) >= rhs.Component(0), lhs.Component(1) >= rhs.Component(1), lhs.Component(2) >= rhs.Component(2), lhs.Component(3) >= rhs.Component(3)); }
+
+#ifdef SVML_USE_SSE
+inline MASK4 Equal(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_cmpeq_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK4 NotEqual(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_cmpneq_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK4 LessThan(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_cmplt_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK4 GreaterThan(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_cmpgt_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK4 LessThanEqual(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_cmple_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK4 GreaterThanEqual(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_cmpge_ps(lhs.Simd(), rhs.Simd()))); }
+inline MASK4 AlmostEqualMask(const VECTOR4<float>& lhs, const VECTOR4<float>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(lhs.Simd(), rhs.Simd())), _mm_set1_ps(ScalarType<float>::Epsilon())))); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline MASK4 Equal(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK4 NotEqual(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return MASK4::FromBits(~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK4 LessThan(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK4 GreaterThan(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return MASK4::FromBits(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK4 LessThanEqual(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return MASK4::FromBits(~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(lhs.Simd(), rhs.Simd())))); }
+inline MASK4 GreaterThanEqual(const VECTOR4<int>& lhs, const VECTOR4<int>& rhs) { return MASK4::FromBits(~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(lhs.Simd(), rhs.Simd())))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline MASK4 Equal(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return MASK4::FromBits(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs), _CMP_EQ_OQ))); }
+inline MASK4 NotEqual(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return MASK4::FromBits(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs), _CMP_NEQ_UQ))); }
+inline MASK4 LessThan(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return MASK4::FromBits(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs), _CMP_LT_OQ))); }
+inline MASK4 GreaterThan(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return MASK4::FromBits(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs), _CMP_GT_OQ))); }
+inline MASK4 LessThanEqual(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return MASK4::FromBits(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs), _CMP_LE_OQ))); }
+inline MASK4 GreaterThanEqual(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return MASK4::FromBits(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs), _CMP_GE_OQ))); }
+inline MASK4 AlmostEqualMask(const VECTOR4<double>& lhs, const VECTOR4<double>& rhs) { return MASK4::FromBits(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(_mm256_loadu_pd((const double*)&lhs), _mm256_loadu_pd((const double*)&rhs))), _mm256_set1_pd(ScalarType<double>::Epsilon()), _CMP_LT_OQ))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Select(): Component-wise mask ? a : b
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Select(const typename MaskType< typename ComponentType< typename SWIZZLE0::PARENT >::type, MASK4 >::type& mask, const SWIZZLE0& a, const SWIZZLE1& b) { return Select(mask, typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Select(const typename MaskType<TYPE, MASK4>::type& mask, const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Select(mask, typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Select(const typename MaskType<TYPE, MASK4>::type& mask, const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Select(mask, a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Select(const MASK4& mask, const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+{
+	return VECTOR4<TYPE>(mask[0] ? a.Component(0) : b.Component(0), mask[1] ? a.Component(1) : b.Component(1), mask[2] ? a.Component(2) : b.Component(2), mask[3] ? a.Component(3) : b.Component(3));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Select(const MASK4& mask, const VECTOR4<float>& a, const VECTOR4<float>& b) { return VECTOR4<float>(SimdBlend(SimdLaneMask(mask.bits), a.Simd(), b.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> Select(const MASK4& mask, const VECTOR4<int>& a, const VECTOR4<int>& b) { return VECTOR4<int>(_mm_castps_si128(SimdBlend(SimdLaneMask(mask.bits), _mm_castsi128_ps(a.Simd()), _mm_castsi128_ps(b.Simd())))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// 4D component-wise comparisons of vectors of WIDE, into a mask per lane
+template <typename TYPE, int N> WIDE<MASK4, N> Equal(const VECTOR4< WIDE<TYPE, N> >& lhs, const VECTOR4< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2), lhs3 = lhs.Component(3), rhs3 = rhs.Component(3);
+	WIDE<MASK4, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK4(lhs0.lane[i] == rhs0.lane[i], lhs1.lane[i] == rhs1.lane[i], lhs2.lane[i] == rhs2.lane[i], lhs3.lane[i] == rhs3.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK4, N> NotEqual(const VECTOR4< WIDE<TYPE, N> >& lhs, const VECTOR4< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2), lhs3 = lhs.Component(3), rhs3 = rhs.Component(3);
+	WIDE<MASK4, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK4(lhs0.lane[i] != rhs0.lane[i], lhs1.lane[i] != rhs1.lane[i], lhs2.lane[i] != rhs2.lane[i], lhs3.lane[i] != rhs3.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK4, N> AlmostEqualMask(const VECTOR4< WIDE<TYPE, N> >& lhs, const VECTOR4< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2), lhs3 = lhs.Component(3), rhs3 = rhs.Component(3);
+	WIDE<MASK4, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK4(fabs(lhs0.lane[i] - rhs0.lane[i]) < ScalarType<TYPE>::Epsilon(), fabs(lhs1.lane[i] - rhs1.lane[i]) < ScalarType<TYPE>::Epsilon(), fabs(lhs2.lane[i] - rhs2.lane[i]) < ScalarType<TYPE>::Epsilon(), fabs(lhs3.lane[i] - rhs3.lane[i]) < ScalarType<TYPE>::Epsilon()); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK4, N> LessThan(const VECTOR4< WIDE<TYPE, N> >& lhs, const VECTOR4< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2), lhs3 = lhs.Component(3), rhs3 = rhs.Component(3);
+	WIDE<MASK4, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK4(lhs0.lane[i] < rhs0.lane[i], lhs1.lane[i] < rhs1.lane[i], lhs2.lane[i] < rhs2.lane[i], lhs3.lane[i] < rhs3.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK4, N> GreaterThan(const VECTOR4< WIDE<TYPE, N> >& lhs, const VECTOR4< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2), lhs3 = lhs.Component(3), rhs3 = rhs.Component(3);
+	WIDE<MASK4, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK4(lhs0.lane[i] > rhs0.lane[i], lhs1.lane[i] > rhs1.lane[i], lhs2.lane[i] > rhs2.lane[i], lhs3.lane[i] > rhs3.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK4, N> LessThanEqual(const VECTOR4< WIDE<TYPE, N> >& lhs, const VECTOR4< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2), lhs3 = lhs.Component(3), rhs3 = rhs.Component(3);
+	WIDE<MASK4, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK4(lhs0.lane[i] <= rhs0.lane[i], lhs1.lane[i] <= rhs1.lane[i], lhs2.lane[i] <= rhs2.lane[i], lhs3.lane[i] <= rhs3.lane[i]); }
+	return result;
+}
+template <typename TYPE, int N> WIDE<MASK4, N> GreaterThanEqual(const VECTOR4< WIDE<TYPE, N> >& lhs, const VECTOR4< WIDE<TYPE, N> >& rhs)
+{
+	WIDE<TYPE, N> lhs0 = lhs.Component(0), rhs0 = rhs.Component(0), lhs1 = lhs.Component(1), rhs1 = rhs.Component(1), lhs2 = lhs.Component(2), rhs2 = rhs.Component(2), lhs3 = lhs.Component(3), rhs3 = rhs.Component(3);
+	WIDE<MASK4, N> result;
+	for (int i = 0; i < N; i++) { result.lane[i] = MASK4(lhs0.lane[i] >= rhs0.lane[i], lhs1.lane[i] >= rhs1.lane[i], lhs2.lane[i] >= rhs2.lane[i], lhs3.lane[i] >= rhs3.lane[i]); }
+	return result;
+}
+
+// 4D masks per lane [&], [|], [^], [!], Any(), All(), lane by lane
+template <int N> WIDE<MASK4, N> operator&(const WIDE<MASK4, N>& lhs, const WIDE<MASK4, N>& rhs) { WIDE<MASK4, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] & rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK4, N> operator|(const WIDE<MASK4, N>& lhs, const WIDE<MASK4, N>& rhs) { WIDE<MASK4, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] | rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK4, N> operator^(const WIDE<MASK4, N>& lhs, const WIDE<MASK4, N>& rhs) { WIDE<MASK4, N> result; for (int i = 0; i < N; i++) { result.lane[i] = lhs.lane[i] ^ rhs.lane[i]; } return result; }
+template <int N> WIDE<MASK4, N> operator!(const WIDE<MASK4, N>& mask) { WIDE<MASK4, N> result; for (int i = 0; i < N; i++) { result.lane[i] = !mask.lane[i]; } return result; }
+template <int N> WIDE<bool, N> Any(const WIDE<MASK4, N>& mask) { WIDE<bool, N> result; for (int i = 0; i < N; i++) { result.lane[i] = Any(mask.lane[i]); } return result; }
+template <int N> WIDE<bool, N> All(const WIDE<MASK4, N>& mask) { WIDE<bool, N> result; for (int i = 0; i < N; i++) { result.lane[i] = All(mask.lane[i]); } return result; }
+
+// 4D Select() by a mask per lane: per component and lane, a where the lane's mask is set and b elsewhere
+template <typename TYPE, int N> VECTOR4< WIDE<TYPE, N> > Select(const WIDE<MASK4, N>& mask, const VECTOR4< WIDE<TYPE, N> >& a, const VECTOR4< WIDE<TYPE, N> >& b)
+{
+	WIDE<TYPE, N> a0 = a.Component(0), b0 = b.Component(0), a1 = a.Component(1), b1 = b.Component(1), a2 = a.Component(2), b2 = b.Component(2), a3 = a.Component(3), b3 = b.Component(3);
+	for (int i = 0; i < N; i++)
+	{
+		if (mask.lane[i][0]) { b0.lane[i] = a0.lane[i]; }
+		if (mask.lane[i][1]) { b1.lane[i] = a1.lane[i]; }
+		if (mask.lane[i][2]) { b2.lane[i] = a2.lane[i]; }
+		if (mask.lane[i][3]) { b3.lane[i] = a3.lane[i]; }
+	}
+	return VECTOR4< WIDE<TYPE, N> >(b0, b1, b2, b3);
+}
+
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+// 4D Normalize()
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Normalize(const SWIZZLE& toNormalize) { return Normalize(typename SWIZZLE::PARENT(toNormalize)); }
+template <typename TYPE> VECTOR4<TYPE> Normalize(const VECTOR4<TYPE>& toNormalize)
+{
+	return VECTOR4<TYPE>(Normalize(toNormalize.xyz), toNormalize.w);
+}
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+// 4D fixed-point Normalize(), each component divided by the length summed in 64 bits
+template <> inline void VECTOR4<FIXED>::Normalize() { *this = SVML::Normalize(*this); }
+#endif // SVML_HAS_CLASS_COMPONENTS
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Normalize(const VECTOR4<float>& toNormalize)
+{
+#ifdef SVML_FAST_RSQRT
+	__m128 scale = SimdReciprocalSqrt(SimdHorizontalAdd3(_mm_mul_ps(toNormalize.Simd(), toNormalize.Simd())));
+	return VECTOR4<float>(_mm_mul_ps(toNormalize.Simd(), SimdReplaceW(_mm_shuffle_ps(scale, scale, 0), _mm_set1_ps(1.0f))));
+#else
+	__m128 length = _mm_sqrt_ss(SimdHorizontalAdd3(_mm_mul_ps(toNormalize.Simd(), toNormalize.Simd())));
+	return VECTOR4<float>(_mm_div_ps(toNormalize.Simd(), SimdReplaceW(_mm_shuffle_ps(length, length, 0), _mm_set1_ps(1.0f))));
+#endif
+}
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Normalize(const VECTOR4<double>& toNormalize)
+{
+	__m256d packed = _mm256_loadu_pd((const double*)&toNormalize);
+#ifdef SVML_FAST_RSQRT
+	double scale = PrecisionDivideBySqrt(1.0, SimdDot3d(packed, packed));
+	return SimdStore4d(_mm256_mul_pd(packed, _mm256_set_pd(1.0, scale, scale, scale)));
+#else
+	double length = PrecisionSqrt(SimdDot3d(packed, packed));
+	return SimdStore4d(_mm256_div_pd(packed, _mm256_set_pd(1.0, length, length, length)));
+#endif
+}
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Dot()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type Dot(const SWIZZLE0& a, const SWIZZLE1& b) { return Dot(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Dot(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Dot(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Dot(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Dot(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR typename ScalarType<TYPE>::type Dot(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+{
+	return a.Component(0) * b.Component(0) + a.Component(1) * b.Component(1) + a.Component(2) * b.Component(2);
+}
+
+#ifdef SVML_USE_SSE
+inline SCALAR_TYPE Dot(const VECTOR4<float>& a, const VECTOR4<float>& b) { return SimdDot3(a.Simd(), b.Simd()); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline int Dot(const VECTOR4<int>& a, const VECTOR4<int>& b) { return SimdDot3i(a.Simd(), b.Simd()); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline double Dot(const VECTOR4<double>& a, const VECTOR4<double>& b) { return SimdDot3d(_mm256_loadu_pd((const double*)&a), _mm256_loadu_pd((const double*)&b)); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Cross()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Cross(const SWIZZLE0& a, const SWIZZLE1& b) { return Cross(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cross(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Cross(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cross(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Cross(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Cross(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+{
+	return VECTOR4<TYPE>(a.Component(1) * b.Component(2) - a.Component(2) * b.Component(1),
+	                     a.Component(2) * b.Component(0) - a.Component(0) * b.Component(2),
+	                     a.Component(0) * b.Component(1) - a.Component(1) * b.Component(0),
+	                     a.Component(3));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Cross(const VECTOR4<float>& a, const VECTOR4<float>& b)
+{
+	__m128 aYZX = _mm_shuffle_ps(a.Simd(), a.Simd(), _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 bYZX = _mm_shuffle_ps(b.Simd(), b.Simd(), _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 c = _mm_sub_ps(_mm_mul_ps(a.Simd(), bYZX), _mm_mul_ps(aYZX, b.Simd()));
+	return VECTOR4<float>(SimdReplaceW(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)), a.Simd()));
+}
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> Cross(const VECTOR4<int>& a, const VECTOR4<int>& b)
+{
+	__m128i c = _mm_sub_epi32(_mm_mullo_epi32(a.Simd(), _mm_shuffle_epi32(b.Simd(), _MM_SHUFFLE(3, 0, 2, 1))), _mm_mullo_epi32(_mm_shuffle_epi32(a.Simd(), _MM_SHUFFLE(3, 0, 2, 1)), b.Simd()));
+	return VECTOR4<int>(_mm_blend_epi16(_mm_shuffle_epi32(c, _MM_SHUFFLE(3, 0, 2, 1)), a.Simd(), 0xC0));
+}
+#endif // SVML_USE_SSE && __SSE4_1__
+
+// 4D Project()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Project(const SWIZZLE0& projectThis, const SWIZZLE1& ontoThis) { return Project(typename SWIZZLE0::PARENT(projectThis), typename SWIZZLE1::PARENT(ontoThis)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const SWIZZLE& projectThis, const VECTOR4<TYPE>& ontoThis) { return Project(typename SWIZZLE::PARENT(projectThis), ontoThis); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Project(const VECTOR4<TYPE>& projectThis, const SWIZZLE& ontoThis) { return Project(projectThis, typename SWIZZLE::PARENT(ontoThis)); }
+template <typename TYPE> VECTOR4<TYPE> Project(const VECTOR4<TYPE>& projectThis, const VECTOR4<TYPE>& ontoThis)
+{
+	return VECTOR4<TYPE>(Project(projectThis.xyz, ontoThis.xyz), ontoThis.w);
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Project(const VECTOR4<float>& projectThis, const VECTOR4<float>& ontoThis)
+{
+	__m128 scale = _mm_set1_ps(SimdDot3(projectThis.Simd(), ontoThis.Simd()) / SimdDot3(ontoThis.Simd(), ontoThis.Simd()));
+	return VECTOR4<float>(_mm_mul_ps(SimdReplaceW(scale, _mm_set1_ps(1.0f)), ontoThis.Simd()));
+}
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Project(const VECTOR4<double>& projectThis, const VECTOR4<double>& ontoThis)
+{
+	__m256d onto = _mm256_loadu_pd((const double*)&ontoThis);
+	double scale = SimdDot3d(_mm256_loadu_pd((const double*)&projectThis), onto) / SimdDot3d(onto, onto);
+	return SimdStore4d(_mm256_mul_pd(_mm256_set_pd(1.0, scale, scale, scale), onto));
+}
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Rotate()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Rotate(const SWIZZLE0& toRotate, const SWIZZLE1& rotationAxis, const typename RealType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type& radians) { return Rotate(typename SWIZZLE0::PARENT(toRotate), typename SWIZZLE1::PARENT(rotationAxis), radians); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const SWIZZLE& toRotate, const VECTOR4<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians) { return Rotate(typename SWIZZLE::PARENT(toRotate), rotationAxis, radians); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Rotate(const VECTOR4<TYPE>& toRotate, const SWIZZLE& rotationAxis, const typename RealType<TYPE>::type& radians) { return Rotate(toRotate, typename SWIZZLE::PARENT(rotationAxis), radians); }
+template <typename TYPE> VECTOR4<TYPE> Rotate(const VECTOR4<TYPE>& toRotate, const VECTOR4<TYPE>& rotationAxis, const typename RealType<TYPE>::type& radians)
+{
+	return VECTOR4<TYPE>(Rotate(toRotate.xyz, rotationAxis.xyz, radians), toRotate.w);
+}
+
+// 4D Lerp()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Lerp(const SWIZZLE0& start, const SWIZZLE1& end, const typename RealType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type& delta) { return Lerp(typename SWIZZLE0::PARENT(start), typename SWIZZLE1::PARENT(end), delta); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const SWIZZLE& start, const VECTOR4<TYPE>& end, const typename RealType<TYPE>::type& delta) { return Lerp(typename SWIZZLE::PARENT(start), end, delta); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Lerp(const VECTOR4<TYPE>& start, const SWIZZLE& end, const typename RealType<TYPE>::type& delta) { return Lerp(start, typename SWIZZLE::PARENT(end), delta); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Lerp(const VECTOR4<TYPE>& start, const VECTOR4<TYPE>& end, const typename RealType<TYPE>::type& delta)
+{
+	return VECTOR4<TYPE>(start.Component(0) + delta * (end.Component(0) - start.Component(0)),
+	                     start.Component(1) + delta * (end.Component(1) - start.Component(1)),
+	                     start.Component(2) + delta * (end.Component(2) - start.Component(2)),
+	                     start.Component(3) + delta * (end.Component(3) - start.Component(3)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Lerp(const VECTOR4<float>& start, const VECTOR4<float>& end, const SCALAR_TYPE& delta) { return VECTOR4<float>(_mm_add_ps(start.Simd(), _mm_mul_ps(_mm_set1_ps(delta), _mm_sub_ps(end.Simd(), start.Simd())))); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> Lerp(const VECTOR4<int>& start, const VECTOR4<int>& end, const SCALAR_TYPE& delta) { return VECTOR4<int>(_mm_cvttps_epi32(_mm_add_ps(_mm_cvtepi32_ps(start.Simd()), _mm_mul_ps(_mm_set1_ps(delta), _mm_cvtepi32_ps(_mm_sub_epi32(end.Simd(), start.Simd())))))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Lerp(const VECTOR4<double>& start, const VECTOR4<double>& end, const double& delta) { return SimdStore4d(_mm256_add_pd(_mm256_loadu_pd((const double*)&start), _mm256_mul_pd(_mm256_set1_pd(delta), _mm256_sub_pd(_mm256_loadu_pd((const double*)&end), _mm256_loadu_pd((const double*)&start))))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Max(): Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Max(const SWIZZLE0& a, const SWIZZLE1& b) { return Max(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Max(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Max(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Max(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+{
+	return VECTOR4<TYPE>(max(a.Component(0), b.Component(0)), max(a.Component(1), b.Component(1)), max(a.Component(2), b.Component(2)), max(a.Component(3), b.Component(3)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Max(const VECTOR4<float>& a, const VECTOR4<float>& b) { return VECTOR4<float>(_mm_max_ps(b.Simd(), a.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> Max(const VECTOR4<int>& a, const VECTOR4<int>& b) { return VECTOR4<int>(_mm_max_epi32(b.Simd(), a.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Max(const VECTOR4<double>& a, const VECTOR4<double>& b) { return SimdStore4d(_mm256_max_pd(_mm256_loadu_pd((const double*)&b), _mm256_loadu_pd((const double*)&a))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Min(): Component-wise
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Min(const SWIZZLE0& a, const SWIZZLE1& b) { return Min(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Min(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Min(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Min(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+{
+	return VECTOR4<TYPE>(min(a.Component(0), b.Component(0)), min(a.Component(1), b.Component(1)), min(a.Component(2), b.Component(2)), min(a.Component(3), b.Component(3)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Min(const VECTOR4<float>& a, const VECTOR4<float>& b) { return VECTOR4<float>(_mm_min_ps(b.Simd(), a.Simd())); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> Min(const VECTOR4<int>& a, const VECTOR4<int>& b) { return VECTOR4<int>(_mm_min_epi32(b.Simd(), a.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Min(const VECTOR4<double>& a, const VECTOR4<double>& b) { return SimdStore4d(_mm256_min_pd(_mm256_loadu_pd((const double*)&b), _mm256_loadu_pd((const double*)&a))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Max(): Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const SWIZZLE& a, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum) { return Max(typename SWIZZLE::PARENT(a), maximum); }
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Max(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum, const SWIZZLE& b) { return Max(maximum, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Max(const VECTOR4<TYPE>& a, const typename ScalarType<TYPE>::type& maximum)
+{
+	return VECTOR4<TYPE>(max((typename ScalarType<TYPE>::type)a.Component(0), maximum), max((typename ScalarType<TYPE>::type)a.Component(1), maximum), max((typename ScalarType<TYPE>::type)a.Component(2), maximum), max((typename ScalarType<TYPE>::type)a.Component(3), maximum));
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Max(const typename ScalarType<TYPE>::type& maximum, const VECTOR4<TYPE>& b)
+{
+	return VECTOR4<TYPE>(max(maximum, (typename ScalarType<TYPE>::type)b.Component(0)), max(maximum, (typename ScalarType<TYPE>::type)b.Component(1)), max(maximum, (typename ScalarType<TYPE>::type)b.Component(2)), max(maximum, (typename ScalarType<TYPE>::type)b.Component(3)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Max(const VECTOR4<float>& a, const SCALAR_TYPE& maximum) { return VECTOR4<float>(_mm_max_ps(_mm_set1_ps(maximum), a.Simd())); }
+inline VECTOR4<float> Max(const SCALAR_TYPE& maximum, const VECTOR4<float>& b) { return VECTOR4<float>(_mm_max_ps(b.Simd(), _mm_set1_ps(maximum))); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> Max(const VECTOR4<int>& a, const int& maximum) { return VECTOR4<int>(_mm_max_epi32(_mm_set1_epi32(maximum), a.Simd())); }
+inline VECTOR4<int> Max(const int& maximum, const VECTOR4<int>& b) { return VECTOR4<int>(_mm_max_epi32(b.Simd(), _mm_set1_epi32(maximum))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Max(const VECTOR4<double>& a, const double& maximum) { return SimdStore4d(_mm256_max_pd(_mm256_set1_pd(maximum), _mm256_loadu_pd((const double*)&a))); }
+inline VECTOR4<double> Max(const double& maximum, const VECTOR4<double>& b) { return SimdStore4d(_mm256_max_pd(_mm256_loadu_pd((const double*)&b), _mm256_set1_pd(maximum))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Min(): Scalar
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const SWIZZLE& a, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum) { return Min(typename SWIZZLE::PARENT(a), minimum); }
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Min(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum, const SWIZZLE& b) { return Min(minimum, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Min(const VECTOR4<TYPE>& a, const typename ScalarType<TYPE>::type& minimum)
+{
+	return VECTOR4<TYPE>(min((typename ScalarType<TYPE>::type)a.Component(0), minimum), min((typename ScalarType<TYPE>::type)a.Component(1), minimum), min((typename ScalarType<TYPE>::type)a.Component(2), minimum), min((typename ScalarType<TYPE>::type)a.Component(3), minimum));
+}
+template <typename TYPE> SVML_CONSTEXPR VECTOR4<TYPE> Min(const typename ScalarType<TYPE>::type& minimum, const VECTOR4<TYPE>& b)
+{
+	return VECTOR4<TYPE>(min(minimum, (typename ScalarType<TYPE>::type)b.Component(0)), min(minimum, (typename ScalarType<TYPE>::type)b.Component(1)), min(minimum, (typename ScalarType<TYPE>::type)b.Component(2)), min(minimum, (typename ScalarType<TYPE>::type)b.Component(3)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Min(const VECTOR4<float>& a, const SCALAR_TYPE& minimum) { return VECTOR4<float>(_mm_min_ps(_mm_set1_ps(minimum), a.Simd())); }
+inline VECTOR4<float> Min(const SCALAR_TYPE& minimum, const VECTOR4<float>& b) { return VECTOR4<float>(_mm_min_ps(b.Simd(), _mm_set1_ps(minimum))); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<int> Min(const VECTOR4<int>& a, const int& minimum) { return VECTOR4<int>(_mm_min_epi32(_mm_set1_epi32(minimum), a.Simd())); }
+inline VECTOR4<int> Min(const int& minimum, const VECTOR4<int>& b) { return VECTOR4<int>(_mm_min_epi32(b.Simd(), _mm_set1_epi32(minimum))); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Min(const VECTOR4<double>& a, const double& minimum) { return SimdStore4d(_mm256_min_pd(_mm256_set1_pd(minimum), _mm256_loadu_pd((const double*)&a))); }
+inline VECTOR4<double> Min(const double& minimum, const VECTOR4<double>& b) { return SimdStore4d(_mm256_min_pd(_mm256_loadu_pd((const double*)&b), _mm256_set1_pd(minimum))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Ceil()
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Ceil(const SWIZZLE& toCeil) { return Ceil(typename SWIZZLE::PARENT(toCeil)); }
+template <typename TYPE> VECTOR4<TYPE> Ceil(const VECTOR4<TYPE>& toCeil)
+{
+	return VECTOR4<TYPE>(ceil(toCeil.Component(0)), ceil(toCeil.Component(1)), ceil(toCeil.Component(2)), ceil(toCeil.Component(3)));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<float> Ceil(const VECTOR4<float>& toCeil) { return VECTOR4<float>(_mm_ceil_ps(toCeil.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Ceil(const VECTOR4<double>& toCeil) { return SimdStore4d(_mm256_ceil_pd(_mm256_loadu_pd((const double*)&toCeil))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Floor()
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Floor(const SWIZZLE& toFloor) { return Floor(typename SWIZZLE::PARENT(toFloor)); }
+template <typename TYPE> VECTOR4<TYPE> Floor(const VECTOR4<TYPE>& toFloor)
+{
+	return VECTOR4<TYPE>(floor(toFloor.Component(0)), floor(toFloor.Component(1)), floor(toFloor.Component(2)), floor(toFloor.Component(3)));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline VECTOR4<float> Floor(const VECTOR4<float>& toFloor) { return VECTOR4<float>(_mm_floor_ps(toFloor.Simd())); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline VECTOR4<double> Floor(const VECTOR4<double>& toFloor) { return SimdStore4d(_mm256_floor_pd(_mm256_loadu_pd((const double*)&toFloor))); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D Abs(), Sign()
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Abs(const SWIZZLE& a) { return Abs(typename SWIZZLE::PARENT(a)); }
+template <typename TYPE> VECTOR4<TYPE> Abs(const VECTOR4<TYPE>& a)
+{
+	return VECTOR4<TYPE>(ComponentAbs((typename ScalarType<TYPE>::type)a.Component(0)), ComponentAbs((typename ScalarType<TYPE>::type)a.Component(1)), ComponentAbs((typename ScalarType<TYPE>::type)a.Component(2)), ComponentAbs((typename ScalarType<TYPE>::type)a.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sign(const SWIZZLE& a) { return Sign(typename SWIZZLE::PARENT(a)); }
+template <typename TYPE> VECTOR4<TYPE> Sign(const VECTOR4<TYPE>& a)
+{
+	return VECTOR4<TYPE>(ComponentSign((typename ScalarType<TYPE>::type)a.Component(0)), ComponentSign((typename ScalarType<TYPE>::type)a.Component(1)), ComponentSign((typename ScalarType<TYPE>::type)a.Component(2)), ComponentSign((typename ScalarType<TYPE>::type)a.Component(3)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Abs(const VECTOR4<float>& a) { return VECTOR4<float>(_mm_andnot_ps(_mm_set1_ps(-0.0f), a.Simd())); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Sign(const VECTOR4<float>& a) { return VECTOR4<float>(_mm_sub_ps(_mm_and_ps(_mm_cmpgt_ps(a.Simd(), _mm_setzero_ps()), _mm_set1_ps(1.0f)), _mm_and_ps(_mm_cmplt_ps(a.Simd(), _mm_setzero_ps()), _mm_set1_ps(1.0f)))); }
+#endif // SVML_USE_SSE
+
+// 4D Clamp(), Saturate(): min(max(x, minimum), maximum), component-wise or by scalars
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Clamp(const SWIZZLE& x, const typename SWIZZLE::PARENT& minimum, const typename SWIZZLE::PARENT& maximum) { return Clamp(typename SWIZZLE::PARENT(x), minimum, maximum); }
+template <typename TYPE> VECTOR4<TYPE> Clamp(const VECTOR4<TYPE>& x, const VECTOR4<TYPE>& minimum, const VECTOR4<TYPE>& maximum)
+{
+	return VECTOR4<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)minimum.Component(0), (typename ScalarType<TYPE>::type)maximum.Component(0)), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)minimum.Component(1), (typename ScalarType<TYPE>::type)maximum.Component(1)), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(2), (typename ScalarType<TYPE>::type)minimum.Component(2), (typename ScalarType<TYPE>::type)maximum.Component(2)), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(3), (typename ScalarType<TYPE>::type)minimum.Component(3), (typename ScalarType<TYPE>::type)maximum.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Clamp(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& minimum, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& maximum) { return Clamp(typename SWIZZLE::PARENT(x), minimum, maximum); }
+template <typename TYPE> VECTOR4<TYPE> Clamp(const VECTOR4<TYPE>& x, const typename ScalarType<TYPE>::type& minimum, const typename ScalarType<TYPE>::type& maximum)
+{
+	return VECTOR4<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), minimum, maximum), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), minimum, maximum), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(2), minimum, maximum), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(3), minimum, maximum));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Saturate(const SWIZZLE& x) { return Saturate(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Saturate(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(ComponentClamp((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(2), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1), ComponentClamp((typename ScalarType<TYPE>::type)x.Component(3), (typename ScalarType<TYPE>::type)0, (typename ScalarType<TYPE>::type)1));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Clamp(const VECTOR4<float>& x, const VECTOR4<float>& minimum, const VECTOR4<float>& maximum) { return VECTOR4<float>(_mm_min_ps(maximum.Simd(), _mm_max_ps(minimum.Simd(), x.Simd()))); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Clamp(const VECTOR4<float>& x, const SCALAR_TYPE& minimum, const SCALAR_TYPE& maximum) { return VECTOR4<float>(_mm_min_ps(_mm_set1_ps(maximum), _mm_max_ps(_mm_set1_ps(minimum), x.Simd()))); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Saturate(const VECTOR4<float>& x) { return VECTOR4<float>(_mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_setzero_ps(), x.Simd()))); }
+#endif // SVML_USE_SSE
+
+// 4D Step(): 0 where x < edge, otherwise 1. SmoothStep(): Hermite interpolation between 0 at edge0 and 1 at edge1
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Step(const SWIZZLE0& edge, const SWIZZLE1& x) { return Step(typename SWIZZLE0::PARENT(edge), typename SWIZZLE1::PARENT(x)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const SWIZZLE& edge, const VECTOR4<TYPE>& x) { return Step(typename SWIZZLE::PARENT(edge), x); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const VECTOR4<TYPE>& edge, const SWIZZLE& x) { return Step(edge, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Step(const VECTOR4<TYPE>& edge, const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(ComponentStep((typename ScalarType<TYPE>::type)edge.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), ComponentStep((typename ScalarType<TYPE>::type)edge.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)), ComponentStep((typename ScalarType<TYPE>::type)edge.Component(2), (typename ScalarType<TYPE>::type)x.Component(2)), ComponentStep((typename ScalarType<TYPE>::type)edge.Component(3), (typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Step(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge, const SWIZZLE& x) { return Step(edge, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Step(const typename ScalarType<TYPE>::type& edge, const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(0)), ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(1)), ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(2)), ComponentStep(edge, (typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type SmoothStep(const typename SWIZZLE::PARENT& edge0, const typename SWIZZLE::PARENT& edge1, const SWIZZLE& x) { return SmoothStep(edge0, edge1, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> SmoothStep(const VECTOR4<TYPE>& edge0, const VECTOR4<TYPE>& edge1, const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(0), (typename ScalarType<TYPE>::type)edge1.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(1), (typename ScalarType<TYPE>::type)edge1.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)), ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(2), (typename ScalarType<TYPE>::type)edge1.Component(2), (typename ScalarType<TYPE>::type)x.Component(2)), ComponentSmoothStep((typename ScalarType<TYPE>::type)edge0.Component(3), (typename ScalarType<TYPE>::type)edge1.Component(3), (typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type SmoothStep(const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge0, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& edge1, const SWIZZLE& x) { return SmoothStep(edge0, edge1, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> SmoothStep(const typename ScalarType<TYPE>::type& edge0, const typename ScalarType<TYPE>::type& edge1, const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(0)), ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(1)), ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(2)), ComponentSmoothStep(edge0, edge1, (typename ScalarType<TYPE>::type)x.Component(3)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Step(const VECTOR4<float>& edge, const VECTOR4<float>& x) { return VECTOR4<float>(_mm_andnot_ps(_mm_cmplt_ps(x.Simd(), edge.Simd()), _mm_set1_ps(1.0f))); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Step(const SCALAR_TYPE& edge, const VECTOR4<float>& x) { return VECTOR4<float>(_mm_andnot_ps(_mm_cmplt_ps(x.Simd(), _mm_set1_ps(edge)), _mm_set1_ps(1.0f))); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> SmoothStep(const VECTOR4<float>& edge0, const VECTOR4<float>& edge1, const VECTOR4<float>& x) { return VECTOR4<float>(SimdSmoothStep(edge0.Simd(), edge1.Simd(), x.Simd())); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> SmoothStep(const SCALAR_TYPE& edge0, const SCALAR_TYPE& edge1, const VECTOR4<float>& x) { return VECTOR4<float>(SimdSmoothStep(_mm_set1_ps(edge0), _mm_set1_ps(edge1), x.Simd())); }
+#endif // SVML_USE_SSE
+
+// 4D Fract(): x - Floor(x). Mod(): x - y * Floor(x / y), so the result takes the sign of y
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Fract(const SWIZZLE& x) { return Fract(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Fract(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(ComponentFract((typename ScalarType<TYPE>::type)x.Component(0)), ComponentFract((typename ScalarType<TYPE>::type)x.Component(1)), ComponentFract((typename ScalarType<TYPE>::type)x.Component(2)), ComponentFract((typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Mod(const SWIZZLE0& x, const SWIZZLE1& y) { return Mod(typename SWIZZLE0::PARENT(x), typename SWIZZLE1::PARENT(y)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const SWIZZLE& x, const VECTOR4<TYPE>& y) { return Mod(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const VECTOR4<TYPE>& x, const SWIZZLE& y) { return Mod(x, typename SWIZZLE::PARENT(y)); }
+template <typename TYPE> VECTOR4<TYPE> Mod(const VECTOR4<TYPE>& x, const VECTOR4<TYPE>& y)
+{
+	return VECTOR4<TYPE>(ComponentMod((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)y.Component(0)), ComponentMod((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)y.Component(1)), ComponentMod((typename ScalarType<TYPE>::type)x.Component(2), (typename ScalarType<TYPE>::type)y.Component(2)), ComponentMod((typename ScalarType<TYPE>::type)x.Component(3), (typename ScalarType<TYPE>::type)y.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Mod(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& y) { return Mod(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE> VECTOR4<TYPE> Mod(const VECTOR4<TYPE>& x, const typename ScalarType<TYPE>::type& y)
+{
+	return VECTOR4<TYPE>(ComponentMod((typename ScalarType<TYPE>::type)x.Component(0), y), ComponentMod((typename ScalarType<TYPE>::type)x.Component(1), y), ComponentMod((typename ScalarType<TYPE>::type)x.Component(2), y), ComponentMod((typename ScalarType<TYPE>::type)x.Component(3), y));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Fract(const VECTOR4<float>& x) { return VECTOR4<float>(_mm_sub_ps(x.Simd(), SimdFloor(x.Simd()))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Mod(const VECTOR4<float>& x, const VECTOR4<float>& y) { return VECTOR4<float>(_mm_sub_ps(x.Simd(), _mm_mul_ps(y.Simd(), SimdFloor(_mm_div_ps(x.Simd(), y.Simd()))))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Mod(const VECTOR4<float>& x, const SCALAR_TYPE& y) { return VECTOR4<float>(_mm_sub_ps(x.Simd(), _mm_mul_ps(_mm_set1_ps(y), SimdFloor(_mm_div_ps(x.Simd(), _mm_set1_ps(y)))))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+// 4D Sqrt(), InverseSqrt(): the second under SVML_PRECISION
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sqrt(const SWIZZLE& x) { return Sqrt(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Sqrt(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(sqrt((typename ScalarType<TYPE>::type)x.Component(0)), sqrt((typename ScalarType<TYPE>::type)x.Component(1)), sqrt((typename ScalarType<TYPE>::type)x.Component(2)), sqrt((typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type InverseSqrt(const SWIZZLE& x) { return InverseSqrt(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> InverseSqrt(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(0)), PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(1)), PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(2)), PrecisionDivideBySqrt((typename ScalarType<TYPE>::type)1, (typename ScalarType<TYPE>::type)x.Component(3)));
+}
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> Sqrt(const VECTOR4<float>& x) { return VECTOR4<float>(_mm_sqrt_ps(x.Simd())); }
+#endif // SVML_USE_SSE
+
+#ifdef SVML_USE_SSE
+inline VECTOR4<float> InverseSqrt(const VECTOR4<float>& x) { return VECTOR4<float>(SimdInverseSqrt(x.Simd())); }
+#endif // SVML_USE_SSE
+
+// 4D Exp(), Exp2(), Log(), Log2(), Pow()
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Exp(const SWIZZLE& x) { return Exp(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Exp(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(exp((typename ScalarType<TYPE>::type)x.Component(0)), exp((typename ScalarType<TYPE>::type)x.Component(1)), exp((typename ScalarType<TYPE>::type)x.Component(2)), exp((typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Exp2(const SWIZZLE& x) { return Exp2(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Exp2(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(0)), pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(1)), pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(2)), pow((typename ScalarType<TYPE>::type)2, (typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Log(const SWIZZLE& x) { return Log(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Log(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(log((typename ScalarType<TYPE>::type)x.Component(0)), log((typename ScalarType<TYPE>::type)x.Component(1)), log((typename ScalarType<TYPE>::type)x.Component(2)), log((typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Log2(const SWIZZLE& x) { return Log2(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Log2(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(ComponentLog2((typename ScalarType<TYPE>::type)x.Component(0)), ComponentLog2((typename ScalarType<TYPE>::type)x.Component(1)), ComponentLog2((typename ScalarType<TYPE>::type)x.Component(2)), ComponentLog2((typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Pow(const SWIZZLE0& x, const SWIZZLE1& y) { return Pow(typename SWIZZLE0::PARENT(x), typename SWIZZLE1::PARENT(y)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const SWIZZLE& x, const VECTOR4<TYPE>& y) { return Pow(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const VECTOR4<TYPE>& x, const SWIZZLE& y) { return Pow(x, typename SWIZZLE::PARENT(y)); }
+template <typename TYPE> VECTOR4<TYPE> Pow(const VECTOR4<TYPE>& x, const VECTOR4<TYPE>& y)
+{
+	return VECTOR4<TYPE>(pow((typename ScalarType<TYPE>::type)x.Component(0), (typename ScalarType<TYPE>::type)y.Component(0)), pow((typename ScalarType<TYPE>::type)x.Component(1), (typename ScalarType<TYPE>::type)y.Component(1)), pow((typename ScalarType<TYPE>::type)x.Component(2), (typename ScalarType<TYPE>::type)y.Component(2)), pow((typename ScalarType<TYPE>::type)x.Component(3), (typename ScalarType<TYPE>::type)y.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Pow(const SWIZZLE& x, const typename ScalarType< typename ComponentType< typename SWIZZLE::PARENT >::type >::type& y) { return Pow(typename SWIZZLE::PARENT(x), y); }
+template <typename TYPE> VECTOR4<TYPE> Pow(const VECTOR4<TYPE>& x, const typename ScalarType<TYPE>::type& y)
+{
+	return VECTOR4<TYPE>(pow((typename ScalarType<TYPE>::type)x.Component(0), y), pow((typename ScalarType<TYPE>::type)x.Component(1), y), pow((typename ScalarType<TYPE>::type)x.Component(2), y), pow((typename ScalarType<TYPE>::type)x.Component(3), y));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Exp(const VECTOR4<float>& x) { return VECTOR4<float>(SimdExp(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Exp2(const VECTOR4<float>& x) { return VECTOR4<float>(SimdExp2(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Log(const VECTOR4<float>& x) { return VECTOR4<float>(SimdLog(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Log2(const VECTOR4<float>& x) { return VECTOR4<float>(SimdLog2(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Pow(const VECTOR4<float>& x, const VECTOR4<float>& y) { return VECTOR4<float>(SimdPow(x.Simd(), y.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Pow(const VECTOR4<float>& x, const SCALAR_TYPE& y) { return VECTOR4<float>(SimdPow(x.Simd(), _mm_set1_ps(y))); }
+#endif // SVML_USE_SSE && __SSE2__
+
+// 4D Sin(), Cos(), SinCos(), Tan(), Atan2(): radians. Atan2(y, x) is GLSL's atan(y, x)
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Sin(const SWIZZLE& x) { return Sin(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Sin(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(sin((typename ScalarType<TYPE>::type)x.Component(0)), sin((typename ScalarType<TYPE>::type)x.Component(1)), sin((typename ScalarType<TYPE>::type)x.Component(2)), sin((typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Cos(const SWIZZLE& x) { return Cos(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Cos(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(cos((typename ScalarType<TYPE>::type)x.Component(0)), cos((typename ScalarType<TYPE>::type)x.Component(1)), cos((typename ScalarType<TYPE>::type)x.Component(2)), cos((typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, void >::type SinCos(const SWIZZLE& x, typename SWIZZLE::PARENT& sine, typename SWIZZLE::PARENT& cosine) { SinCos(typename SWIZZLE::PARENT(x), sine, cosine); }
+template <typename TYPE> void SinCos(const VECTOR4<TYPE>& x, VECTOR4<TYPE>& sine, VECTOR4<TYPE>& cosine)
+{
+	VECTOR4<TYPE> s = Sin(x); // x may be sine or cosine
+	cosine = Cos(x);
+	sine = s;
+}
+template <typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Tan(const SWIZZLE& x) { return Tan(typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Tan(const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(tan((typename ScalarType<TYPE>::type)x.Component(0)), tan((typename ScalarType<TYPE>::type)x.Component(1)), tan((typename ScalarType<TYPE>::type)x.Component(2)), tan((typename ScalarType<TYPE>::type)x.Component(3)));
+}
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename SWIZZLE0::PARENT >::type >::type Atan2(const SWIZZLE0& y, const SWIZZLE1& x) { return Atan2(typename SWIZZLE0::PARENT(y), typename SWIZZLE1::PARENT(x)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Atan2(const SWIZZLE& y, const VECTOR4<TYPE>& x) { return Atan2(typename SWIZZLE::PARENT(y), x); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename SWIZZLE::PARENT >::type Atan2(const VECTOR4<TYPE>& y, const SWIZZLE& x) { return Atan2(y, typename SWIZZLE::PARENT(x)); }
+template <typename TYPE> VECTOR4<TYPE> Atan2(const VECTOR4<TYPE>& y, const VECTOR4<TYPE>& x)
+{
+	return VECTOR4<TYPE>(atan2((typename ScalarType<TYPE>::type)y.Component(0), (typename ScalarType<TYPE>::type)x.Component(0)), atan2((typename ScalarType<TYPE>::type)y.Component(1), (typename ScalarType<TYPE>::type)x.Component(1)), atan2((typename ScalarType<TYPE>::type)y.Component(2), (typename ScalarType<TYPE>::type)x.Component(2)), atan2((typename ScalarType<TYPE>::type)y.Component(3), (typename ScalarType<TYPE>::type)x.Component(3)));
+}
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Sin(const VECTOR4<float>& x) { return VECTOR4<float>(SimdSin(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Cos(const VECTOR4<float>& x) { return VECTOR4<float>(SimdCos(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline void SinCos(const VECTOR4<float>& x, VECTOR4<float>& sine, VECTOR4<float>& cosine)
+{
+	__m128 s, c;
+	SimdSinCos(x.Simd(), s, c);
+	sine = VECTOR4<float>(s);
+	cosine = VECTOR4<float>(c);
+}
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Tan(const VECTOR4<float>& x) { return VECTOR4<float>(SimdTan(x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+inline VECTOR4<float> Atan2(const VECTOR4<float>& y, const VECTOR4<float>& x) { return VECTOR4<float>(SimdAtan2(y.Simd(), x.Simd())); }
+#endif // SVML_USE_SSE && __SSE2__
+
+// 4D Distance()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type Distance(const SWIZZLE0& a, const SWIZZLE1& b) { return Distance(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Distance(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return Distance(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type Distance(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return Distance(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> typename ScalarType<TYPE>::type Distance(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+{
+	return Distance(a.xyz, b.xyz);
+}
+
+#ifdef SVML_USE_SSE
+inline SCALAR_TYPE Distance(const VECTOR4<float>& a, const VECTOR4<float>& b) { __m128 d = _mm_sub_ps(a.Simd(), b.Simd()); return PrecisionSqrt(SimdDot3(d, d)); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline double Distance(const VECTOR4<double>& a, const VECTOR4<double>& b) { __m256d d = _mm256_sub_pd(_mm256_loadu_pd((const double*)&a), _mm256_loadu_pd((const double*)&b)); return PrecisionSqrt(SimdDot3d(d, d)); }
+#endif // SVML_USE_SSE && __AVX__
+
+// 4D DistanceSquared()
+template <typename SWIZZLE0, typename SWIZZLE1> inline typename EnableIf< Is4D< typename SWIZZLE0::PARENT >, typename EnableIf< Is4D< typename SWIZZLE1::PARENT >, typename ScalarType< typename ComponentType< typename SWIZZLE0::PARENT >::type >::type >::type >::type DistanceSquared(const SWIZZLE0& a, const SWIZZLE1& b) { return DistanceSquared(typename SWIZZLE0::PARENT(a), typename SWIZZLE1::PARENT(b)); }
+template <typename SWIZZLE, typename TYPE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type DistanceSquared(const SWIZZLE& a, const VECTOR4<TYPE>& b) { return DistanceSquared(typename SWIZZLE::PARENT(a), b); }
+template <typename TYPE, typename SWIZZLE> inline typename EnableIf< Is4D< typename SWIZZLE::PARENT >, typename ScalarType<TYPE>::type >::type DistanceSquared(const VECTOR4<TYPE>& a, const SWIZZLE& b) { return DistanceSquared(a, typename SWIZZLE::PARENT(b)); }
+template <typename TYPE> typename ScalarType<TYPE>::type DistanceSquared(const VECTOR4<TYPE>& a, const VECTOR4<TYPE>& b)
+{
+	return DistanceSquared(a.xyz, b.xyz);
+}
+
+#ifdef SVML_USE_SSE
+inline SCALAR_TYPE DistanceSquared(const VECTOR4<float>& a, const VECTOR4<float>& b) { __m128 d = _mm_sub_ps(a.Simd(), b.Simd()); return SimdDot3(d, d); }
+#endif // SVML_USE_SSE
+
+#if defined(SVML_USE_SSE) && defined(__SSE4_1__)
+inline int DistanceSquared(const VECTOR4<int>& a, const VECTOR4<int>& b) { __m128i d = _mm_sub_epi32(a.Simd(), b.Simd()); return SimdDot3i(d, d); }
+#endif // SVML_USE_SSE && __SSE4_1__
+
+#if defined(SVML_USE_SSE) && defined(__AVX__)
+inline double DistanceSquared(const VECTOR4<double>& a, const VECTOR4<double>& b) { __m256d d = _mm256_sub_pd(_mm256_loadu_pd((const double*)&a), _mm256_loadu_pd((const double*)&b)); return SimdDot3d(d, d); }
+#endif // SVML_USE_SSE && __AVX__
+
+
+} // SVML namespace
+
+#endif // SVML_VECTOR4_H
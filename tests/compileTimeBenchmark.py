@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# Compile-time benchmark: compiles the same N translation units against two versions of the svml headers and
+# reports the size of the headers they include, the compile time, the peak compiler memory and the static
+# initializers in the objects of each.
+#
+#	python3 tests/compileTimeBenchmark.py --old HEAD~1 --count 16 --flags=-O2
+#	python3 tests/compileTimeBenchmark.py --old HEAD~1 --header svml_vector4.h
+#
+# --old is a git revision (its svml*.h are taken from git), a directory holding svml*.h or the path of another
+# svml.h. --header is the header the translation units include (svml.h by default); an old version without it is
+# measured with its svml.h. Linux and macOS only.
+
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+REPOSITORY = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Typical use: a few swizzle reads, a swizzle write and the common functions, in every dimension
+TRANSLATION_UNIT = """#include "%(header)s"
+
+using namespace SVML;
+
+vec3 Function%(index)d(const vec2& a, const vec3& b, const vec4& c)
+{
+	vec3 result = b.zyx + c.xyz * a.x;
+	result.zyx = b + c.wzy;
+	vec4 color = c.bgra * 0.5f;
+	return Cross(result, b.yzx) * Dot(Normalize(b), color.xyz) + vec3(a.yx, Distance(a, a.yy));
+}
+"""
+
+
+def ReadFiles(paths):
+	headers = {}
+	for path in paths:
+		with open(path, "rb") as header:
+			headers[os.path.basename(path)] = header.read()
+	return headers
+
+
+# Every svml*.h of a version, by name
+def ReadHeaders(old):
+	if os.path.isfile(old):
+		return {"svml.h": ReadFiles([old])[os.path.basename(old)]}
+	if os.path.isdir(old):
+		return ReadFiles(glob.glob(os.path.join(old, "svml*.h")))
+	names = subprocess.check_output(["git", "ls-tree", "--name-only", old], cwd=REPOSITORY).decode().split()
+	return dict((name, subprocess.check_output(["git", "show", old + ":" + name], cwd=REPOSITORY)) for name in names if name.startswith("svml") and name.endswith(".h"))
+
+
+# Wall time and peak resident memory (of the compiler and everything it runs) of one command
+def Measure(command):
+	start = time.time()
+	process = subprocess.Popen(command)
+	_, status, usage = os.wait4(process.pid, 0)
+	seconds = time.time() - start
+	if status != 0:
+		sys.exit("Failed: " + " ".join(command))
+	# ru_maxrss is in kilobytes on Linux and in bytes on macOS
+	peakMegabytes = usage.ru_maxrss / (1024.0 * 1024.0 if sys.platform == "darwin" else 1024.0)
+	return seconds, peakMegabytes
+
+
+# The svml headers a translation unit reaches, from the compiler's dependency list
+def IncludedHeaders(arguments, include, source):
+	dependencies = subprocess.check_output([arguments.cxx] + arguments.flags.split() + ["-I", include, "-M", source]).decode()
+	return set(os.path.basename(path) for path in dependencies.replace("\\\n", " ").split() if os.path.dirname(os.path.abspath(path)) == include and path.endswith(".h"))
+
+
+# Functions run before main(): one per translation unit that needs dynamic initialization, such as <iostream>'s
+def StaticInitializers(objects):
+	symbols = subprocess.check_output(["nm"] + objects).decode()
+	return sum(1 for line in symbols.splitlines() if len(line.split()) == 3 and line.split()[1] in "Tt" and "_GLOBAL__sub_I" in line.split()[2])
+
+
+def Benchmark(name, headers, arguments, directory):
+	include = os.path.join(directory, name)
+	os.mkdir(include)
+	for headerName, header in headers.items():
+		with open(os.path.join(include, headerName), "wb") as out:
+			out.write(header)
+	headerName = arguments.header if arguments.header in headers else "svml.h"
+
+	totalSeconds = 0.0
+	peakMegabytes = 0.0
+	objects = []
+	for index in range(arguments.count):
+		source = os.path.join(include, "unit%d.cpp" % index)
+		with open(source, "w") as out:
+			out.write(TRANSLATION_UNIT % {"header": headerName, "index": index})
+		seconds, megabytes = Measure([arguments.cxx] + arguments.flags.split() + ["-I", include, "-c", source, "-o", source + ".o"])
+		totalSeconds += seconds
+		peakMegabytes = max(peakMegabytes, megabytes)
+		objects.append(source + ".o")
+
+	included = [headers[headerName] for headerName in IncludedHeaders(arguments, include, os.path.join(include, "unit0.cpp"))]
+	return {"bytes": sum(len(header) for header in included), "lines": sum(header.count(b"\n") for header in included), "seconds": totalSeconds, "megabytes": peakMegabytes,
+	        "initializers": StaticInitializers(objects)}
+
+
+def main():
+	parser = argparse.ArgumentParser(description="Compare the cost of compiling the svml headers against an older version")
+	parser.add_argument("--old", default="HEAD", help="git revision, directory or svml.h path to compare against (default HEAD)")
+	parser.add_argument("--header", default="svml.h", help="header the translation units include (default svml.h)")
+	parser.add_argument("--count", type=int, default=8, help="translation units compiled per header (default 8)")
+	parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"), help="compiler (default $CXX or g++)")
+	parser.add_argument("--flags", default="-O2", help="compiler flags (default -O2)")
+	arguments = parser.parse_args()
+
+	newHeaders = ReadFiles(glob.glob(os.path.join(REPOSITORY, "svml*.h")))
+	oldHeaders = ReadHeaders(arguments.old)
+
+	directory = tempfile.mkdtemp()
+	try:
+		old = Benchmark("old", oldHeaders, arguments, directory)
+		new = Benchmark("new", newHeaders, arguments, directory)
+	finally:
+		shutil.rmtree(directory)
+
+	print("%d translation units, %s %s" % (arguments.count, arguments.cxx, arguments.flags))
+	print("%-24s %12s %12s %8s" % ("", arguments.old, arguments.header, "new/old"))
+	for label, key, format in (("header bytes", "bytes", "%12d"), ("header lines", "lines", "%12d"), ("compile seconds", "seconds", "%12.2f"), ("peak compiler MB", "megabytes", "%12.1f"),
+	                           ("static initializers", "initializers", "%12d")):
+		print(("%-24s " + format + " " + format + " %8s") % (label, old[key], new[key], ("%8.2f" % (new[key] / float(old[key]))) if old[key] else "-"))
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,7347 @@
+// SVML benchmarks, generated by generation/BuildBenchmark.pl
+//
+// Build with optimizations and run from the repository root:
+//   g++ -O2 -I. tests/performanceTest.cpp -o performanceTest
+//   ./performanceTest --benchmark_min_time=0.5 --benchmark_filter=/3D/ > results.json
+//
+// The output is in the Google Benchmark JSON format, so two runs can be compared with its tools/compare.py.
+// "throughput" cases work on independent elements, "latency" cases feed each result into the next call.
+// The "swizzle" form passes reversed swizzles (.yx, .zyx, .wzyx) where the "vector" form passes vectors,
+// so the difference between the two is the cost of going through the swizzle overloads.
+
+#include <iostream>
+#include <string>
+#include <stdlib.h> // atof
+#include <time.h>
+#if __cplusplus >= 201103L
+#include <chrono>
+#endif
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+#include "svml.h"
+
+using std::cout;
+using std::string;
+using SVML::SCALAR_TYPE;
+using SVML::vec2;
+using SVML::vec3;
+using SVML::vec4;
+using SVML::mat2;
+using SVML::mat3;
+using SVML::mat4;
+using SVML::quat;
+using SVML::vec2_soa;
+using SVML::vec3_soa;
+using SVML::vec4_soa;
+using SVML::aabb2;
+using SVML::aabb3;
+using SVML::AABB2_PACKET;
+using SVML::AABB3_PACKET;
+
+// Working set, a power of two that fits in L1
+const unsigned DATA_SIZE = 256;
+const unsigned DATA_MASK = DATA_SIZE - 1;
+
+vec2 a2[DATA_SIZE], b2[DATA_SIZE], axis2[DATA_SIZE], out2[DATA_SIZE];
+vec3 a3[DATA_SIZE], b3[DATA_SIZE], axis3[DATA_SIZE], out3[DATA_SIZE];
+vec4 a4[DATA_SIZE], b4[DATA_SIZE], axis4[DATA_SIZE], out4[DATA_SIZE];
+mat2 matrix2[DATA_SIZE], otherMatrix2[DATA_SIZE], outMatrix2[DATA_SIZE];
+mat3 matrix3[DATA_SIZE], otherMatrix3[DATA_SIZE], outMatrix3[DATA_SIZE];
+mat4 matrix4[DATA_SIZE], otherMatrix4[DATA_SIZE], outMatrix4[DATA_SIZE];
+quat rotations[DATA_SIZE], otherRotations[DATA_SIZE], outRotations[DATA_SIZE];
+mat3 outRotationMatrix[DATA_SIZE];
+SCALAR_TYPE scalars[DATA_SIZE];
+SCALAR_TYPE outScalar[DATA_SIZE];
+bool outBool[DATA_SIZE];
+string outString;
+char outChars[256];
+
+aabb2 boxes2[DATA_SIZE], outBox2;
+aabb3 boxes3[DATA_SIZE], outBox3;
+AABB2_PACKET<float, 4> packets4x2[DATA_SIZE / 4];
+AABB3_PACKET<float, 4> packets4x3[DATA_SIZE / 4];
+AABB2_PACKET<float, 8> packets8x2[DATA_SIZE / 8];
+AABB3_PACKET<float, 8> packets8x3[DATA_SIZE / 8];
+vec2 rayOrigins2[DATA_SIZE], rayInverses2[DATA_SIZE];
+vec3 rayOrigins3[DATA_SIZE], rayInverses3[DATA_SIZE];
+unsigned outHits[DATA_SIZE];
+
+vec2_soa soaA2, soaB2, soaOut2;
+vec3_soa soaA3, soaB3, soaOut3;
+vec4_soa soaA4, soaB4, soaOut4;
+
+// Forces the value to be computed and stored
+template <typename TYPE> inline void DoNotOptimize(const TYPE& value)
+{
+#if defined(__GNUC__)
+	asm volatile("" : : "m"(value) : "memory");
+#else
+	static const void* volatile sink;
+	sink = &value;
+#endif
+}
+
+inline double WallSeconds()
+{
+#if __cplusplus >= 201103L
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+	return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+inline double CpuSeconds()
+{
+	return (double)clock() / CLOCKS_PER_SEC;
+}
+
+void SetUp()
+{
+	for (unsigned n = 0; n < DATA_SIZE; n++)
+	{
+		SCALAR_TYPE t = (SCALAR_TYPE)n / DATA_SIZE;
+		
+		a4[n] = vec4(t + 0.5f, 1.5f - t, t * 2.0f - 1.0f, 1.0f);
+		b4[n] = vec4(1.0f - t, t + 0.25f, 0.75f, t - 0.5f);
+		axis4[n] = vec4(Normalize(vec3(t, 1.0f - t, 0.5f)), 0.0f);
+		a3[n] = a4[n].xyz;
+		b3[n] = b4[n].xyz;
+		axis3[n] = axis4[n].xyz;
+		a2[n] = a4[n].xy;
+		b2[n] = b4[n].xy;
+		axis2[n] = axis4[n].xy;
+		scalars[n] = t + 0.5f;
+		
+		matrix4[n] = mat4(a4[n], b4[n], axis4[n], vec4(t, -t, 0.5f, 1.0f));
+		otherMatrix4[n] = mat4(b4[n], axis4[n], a4[n], vec4(0.25f, t, -t, 1.0f));
+		matrix3[n] = mat3(a3[n], b3[n], axis3[n]);
+		otherMatrix3[n] = mat3(b3[n], axis3[n], a3[n]);
+		matrix2[n] = mat2(a2[n], b2[n]);
+		otherMatrix2[n] = mat2(b2[n], a2[n]);
+		rotations[n] = quat(axis3[n], scalars[n]);
+		otherRotations[n] = quat(Normalize(b3[n]), t * 3.0f);
+	}
+	
+	soaA2 = vec2_soa(a2, DATA_SIZE);
+	soaB2 = vec2_soa(b2, DATA_SIZE);
+	soaOut2 = vec2_soa(DATA_SIZE);
+	soaA3 = vec3_soa(a3, DATA_SIZE);
+	soaB3 = vec3_soa(b3, DATA_SIZE);
+	soaOut3 = vec3_soa(DATA_SIZE);
+	soaA4 = vec4_soa(a4, DATA_SIZE);
+	soaB4 = vec4_soa(b4, DATA_SIZE);
+	soaOut4 = vec4_soa(DATA_SIZE);
+	
+#ifdef __SSE__
+	// Flush denormals to zero, so long latency chains that drift towards zero do not slow down
+	_mm_setcsr(_mm_getcsr() | 0x8040);
+#endif
+}
+
+typedef void (*BENCHMARK_FUNCTION)(const unsigned& iterations);
+
+struct BENCHMARK
+{
+	const char* name;
+	BENCHMARK_FUNCTION function;
+	unsigned itemsPerIteration;
+};
+
+//----------------------------------------------------------------------
+// 2D
+//----------------------------------------------------------------------
+
+void Throughput_ToParent_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = vec2(a2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_ToParent_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = vec2(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToParent_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = vec2(a2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_ToParent_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = vec2(r.yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToString_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outString = ToString(a2[n]); DoNotOptimize(outString);
+	}
+}
+
+void Latency_ToString_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)ToString(r).size();
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToString_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outString = ToString(a2[n].yx); DoNotOptimize(outString);
+	}
+}
+
+void Latency_ToString_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)ToString(r.yx).size();
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToChars_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		DoNotOptimize(ToChars(outChars, outChars + 256, a2[n]));
+	}
+}
+
+void Latency_ToChars_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)(ToChars(outChars, outChars + 256, r) - outChars);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToChars_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		DoNotOptimize(ToChars(outChars, outChars + 256, a2[n].yx));
+	}
+}
+
+void Latency_ToChars_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)(ToChars(outChars, outChars + 256, r.yx) - outChars);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Negate_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = -a2[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Negate_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = -r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Negate_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = -a2[n].yx; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Negate_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = -r.yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Add_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n] + b2[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Add_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r + b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Add_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n].yx + b2[n].yx; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Add_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.yx + b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Subtract_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n] - b2[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Subtract_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r - b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Subtract_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n].yx - b2[n].yx; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Subtract_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.yx - b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Multiply_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n] * b2[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Multiply_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Multiply_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n].yx * b2[n].yx; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Multiply_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.yx * b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Divide_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n] / b2[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Divide_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r / b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Divide_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n].yx / b2[n].yx; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Divide_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.yx / b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalar_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n] * scalars[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MultiplyScalar_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalar_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n].yx * scalars[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MultiplyScalar_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.yx * scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalarLeft_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = scalars[n] * a2[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MultiplyScalarLeft_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] * r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalarLeft_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = scalars[n] * a2[n].yx; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MultiplyScalarLeft_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] * r.yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalar_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n] / scalars[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_DivideScalar_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r / scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalar_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = a2[n].yx / scalars[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_DivideScalar_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.yx / scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalarLeft_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = scalars[n] / a2[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_DivideScalarLeft_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] / r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalarLeft_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = scalars[n] / a2[n].yx; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_DivideScalarLeft_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] / r.yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_EqualTo_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n] == b2[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_EqualTo_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r == b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_EqualTo_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n].yx == b2[n].yx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_EqualTo_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.yx == b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_NotEqualTo_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n] != b2[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_NotEqualTo_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r != b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_NotEqualTo_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n].yx != b2[n].yx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_NotEqualTo_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.yx != b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_AlmostEqual_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = AlmostEqual(a2[n], b2[n]); DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_AlmostEqual_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += AlmostEqual(r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_AlmostEqual_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = AlmostEqual(a2[n].yx, b2[n].yx); DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_AlmostEqual_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += AlmostEqual(r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThan_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n] < b2[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThan_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r < b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThan_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n].yx < b2[n].yx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThan_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.yx < b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThan_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n] > b2[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThan_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r > b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThan_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n].yx > b2[n].yx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThan_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.yx > b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThanOrEqual_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n] <= b2[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThanOrEqual_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r <= b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThanOrEqual_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n].yx <= b2[n].yx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThanOrEqual_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.yx <= b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThanOrEqual_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n] >= b2[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThanOrEqual_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r >= b2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThanOrEqual_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a2[n].yx >= b2[n].yx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThanOrEqual_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.yx >= b2[n].yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Select_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Select(LessThan(a2[n], b2[n]), a2[n], b2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Select_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Select(LessThan(r, b2[n]), r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Select_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Select(LessThan(a2[n].yx, b2[n].yx), a2[n].yx, b2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Select_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Select(LessThan(r.yx, b2[n].yx), r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Normalize_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Normalize(a2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Normalize_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Normalize(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Normalize_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Normalize(a2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Normalize_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Normalize(r.yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Length_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = vec2(a2[n]).Length; DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Length_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = vec2(r).Length;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Length_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = vec2(a2[n].yx).Length; DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Length_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = vec2(r.yx).Length;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Dot_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Dot(a2[n], b2[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Dot_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Dot(r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Dot_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Dot(a2[n].yx, b2[n].yx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Dot_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Dot(r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Perpendicular_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Perpendicular(a2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Perpendicular_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Perpendicular(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Perpendicular_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Perpendicular(a2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Perpendicular_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Perpendicular(r.yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Project_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Project(a2[n], b2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Project_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Project(r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Project_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Project(a2[n].yx, b2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Project_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Project(r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Rotate_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Rotate(a2[n], scalars[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Rotate_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Rotate_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Rotate(a2[n].yx, scalars[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Rotate_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r.yx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Lerp_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Lerp(a2[n], b2[n], scalars[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Lerp_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Lerp(r, b2[n], scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Lerp_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Lerp(a2[n].yx, b2[n].yx, scalars[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Lerp_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Lerp(r.yx, b2[n].yx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Max_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Max(a2[n], b2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Max_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Max_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Max(a2[n].yx, b2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Max_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Min_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Min(a2[n], b2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Min_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Min_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Min(a2[n].yx, b2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Min_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MaxScalar_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Max(a2[n], scalars[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MaxScalar_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MaxScalar_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Max(a2[n].yx, scalars[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MaxScalar_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r.yx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MinScalar_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Min(a2[n], scalars[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MinScalar_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MinScalar_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Min(a2[n].yx, scalars[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MinScalar_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r.yx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Ceil_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Ceil(a2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Ceil_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Ceil(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Ceil_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Ceil(a2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Ceil_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Ceil(r.yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Floor_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Floor(a2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Floor_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Floor(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Floor_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Floor(a2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Floor_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Floor(r.yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Clamp_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Clamp(a2[n], scalars[n], scalars[n] + 1); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Clamp_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Clamp(r, scalars[n], scalars[n] + 1);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Clamp_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Clamp(a2[n].yx, scalars[n], scalars[n] + 1); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Clamp_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Clamp(r.yx, scalars[n], scalars[n] + 1);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Exp_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Exp(a2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Exp_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Exp(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Exp_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Exp(a2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Exp_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Exp(r.yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Sin_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Sin(a2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Sin_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Sin(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Sin_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Sin(a2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Sin_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Sin(r.yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Atan2_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Atan2(a2[n], b2[n]); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Atan2_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Atan2(r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Atan2_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = Atan2(a2[n].yx, b2[n].yx); DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_Atan2_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Atan2(r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Distance_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Distance(a2[n], b2[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Distance_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Distance(r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Distance_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Distance(a2[n].yx, b2[n].yx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Distance_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Distance(r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DistanceSquared_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = DistanceSquared(a2[n], b2[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_DistanceSquared_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = DistanceSquared(r, b2[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DistanceSquared_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = DistanceSquared(a2[n].yx, b2[n].yx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_DistanceSquared_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = DistanceSquared(r.yx, b2[n].yx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiplyVector_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = matrix2[n] * a2[n]; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MatrixMultiplyVector_2D_vector(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = matrix2[n] * r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiplyVector_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out2[n] = matrix2[n] * a2[n].yx; DoNotOptimize(out2[n]);
+	}
+}
+
+void Latency_MatrixMultiplyVector_2D_swizzle(const unsigned& iterations)
+{
+	vec2 r = a2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = matrix2[n] * r.yx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiply_2D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix2[n] = matrix2[n] * otherMatrix2[n]; DoNotOptimize(outMatrix2[n]);
+	}
+}
+
+void Latency_MatrixMultiply_2D_matrix(const unsigned& iterations)
+{
+	mat2 r = matrix2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * otherMatrix2[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Transpose_2D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix2[n] = Transpose(matrix2[n]); DoNotOptimize(outMatrix2[n]);
+	}
+}
+
+void Latency_Transpose_2D_matrix(const unsigned& iterations)
+{
+	mat2 r = matrix2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Transpose(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Determinant_2D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Determinant(matrix2[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Determinant_2D_matrix(const unsigned& iterations)
+{
+	mat2 r = matrix2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r[0].x = Determinant(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Inverse_2D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix2[n] = Inverse(matrix2[n]); DoNotOptimize(outMatrix2[n]);
+	}
+}
+
+void Latency_Inverse_2D_matrix(const unsigned& iterations)
+{
+	mat2 r = matrix2[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Inverse(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Transform_2D_array(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(out2, matrix2[0], a2, DATA_SIZE); DoNotOptimize(out2);
+	}
+}
+
+void Throughput_BatchNegate_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Negate(soaOut2, soaA2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNegate_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Negate(soaOut2, soaA2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchAdd_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Add(soaOut2, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchAdd_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Add(soaOut2, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchSubtract_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Subtract(soaOut2, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchSubtract_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Subtract(soaOut2, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiply_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut2, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiply_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut2, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivide_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut2, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivide_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut2, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiplyScalar_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut2, soaA2, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiplyScalar_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut2, soaA2.yx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivideScalar_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut2, soaA2, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivideScalar_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut2, soaA2.yx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNormalize_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Normalize(soaOut2, soaA2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNormalize_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Normalize(soaOut2, soaA2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDot_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Dot(outScalar, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDot_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Dot(outScalar, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchProject_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Project(soaOut2, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchProject_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Project(soaOut2, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotate_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut2, soaA2, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotate_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut2, soaA2.yx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchLerp_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Lerp(soaOut2, soaA2, soaB2, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchLerp_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Lerp(soaOut2, soaA2.yx, soaB2.yx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMax_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Max(soaOut2, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMax_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Max(soaOut2, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMin_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Min(soaOut2, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMin_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Min(soaOut2, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCeil_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Ceil(soaOut2, soaA2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCeil_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Ceil(soaOut2, soaA2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchFloor_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Floor(soaOut2, soaA2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchFloor_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Floor(soaOut2, soaA2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistance_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Distance(outScalar, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistance_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Distance(outScalar, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistanceSquared_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		DistanceSquared(outScalar, soaA2, soaB2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistanceSquared_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		DistanceSquared(outScalar, soaA2.yx, soaB2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchTransform_2D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(soaOut2, matrix2[0], soaA2);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchTransform_2D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(soaOut2, matrix2[0], soaA2.yx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+//----------------------------------------------------------------------
+// 3D
+//----------------------------------------------------------------------
+
+void Throughput_ToParent_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = vec3(a3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_ToParent_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = vec3(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToParent_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = vec3(a3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_ToParent_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = vec3(r.zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToString_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outString = ToString(a3[n]); DoNotOptimize(outString);
+	}
+}
+
+void Latency_ToString_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)ToString(r).size();
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToString_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outString = ToString(a3[n].zyx); DoNotOptimize(outString);
+	}
+}
+
+void Latency_ToString_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)ToString(r.zyx).size();
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToChars_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		DoNotOptimize(ToChars(outChars, outChars + 256, a3[n]));
+	}
+}
+
+void Latency_ToChars_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)(ToChars(outChars, outChars + 256, r) - outChars);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToChars_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		DoNotOptimize(ToChars(outChars, outChars + 256, a3[n].zyx));
+	}
+}
+
+void Latency_ToChars_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)(ToChars(outChars, outChars + 256, r.zyx) - outChars);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Negate_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = -a3[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Negate_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = -r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Negate_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = -a3[n].zyx; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Negate_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = -r.zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Add_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n] + b3[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Add_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r + b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Add_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n].zyx + b3[n].zyx; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Add_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.zyx + b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Subtract_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n] - b3[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Subtract_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r - b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Subtract_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n].zyx - b3[n].zyx; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Subtract_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.zyx - b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Multiply_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n] * b3[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Multiply_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Multiply_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n].zyx * b3[n].zyx; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Multiply_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.zyx * b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Divide_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n] / b3[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Divide_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r / b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Divide_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n].zyx / b3[n].zyx; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Divide_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.zyx / b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalar_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n] * scalars[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MultiplyScalar_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalar_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n].zyx * scalars[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MultiplyScalar_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.zyx * scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalarLeft_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = scalars[n] * a3[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MultiplyScalarLeft_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] * r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalarLeft_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = scalars[n] * a3[n].zyx; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MultiplyScalarLeft_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] * r.zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalar_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n] / scalars[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_DivideScalar_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r / scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalar_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = a3[n].zyx / scalars[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_DivideScalar_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.zyx / scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalarLeft_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = scalars[n] / a3[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_DivideScalarLeft_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] / r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalarLeft_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = scalars[n] / a3[n].zyx; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_DivideScalarLeft_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] / r.zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_EqualTo_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n] == b3[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_EqualTo_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r == b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_EqualTo_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n].zyx == b3[n].zyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_EqualTo_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.zyx == b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_NotEqualTo_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n] != b3[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_NotEqualTo_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r != b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_NotEqualTo_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n].zyx != b3[n].zyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_NotEqualTo_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.zyx != b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_AlmostEqual_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = AlmostEqual(a3[n], b3[n]); DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_AlmostEqual_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += AlmostEqual(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_AlmostEqual_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = AlmostEqual(a3[n].zyx, b3[n].zyx); DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_AlmostEqual_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += AlmostEqual(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThan_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n] < b3[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThan_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r < b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThan_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n].zyx < b3[n].zyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThan_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.zyx < b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThan_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n] > b3[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThan_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r > b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThan_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n].zyx > b3[n].zyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThan_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.zyx > b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThanOrEqual_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n] <= b3[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThanOrEqual_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r <= b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThanOrEqual_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n].zyx <= b3[n].zyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThanOrEqual_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.zyx <= b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThanOrEqual_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n] >= b3[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThanOrEqual_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r >= b3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThanOrEqual_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a3[n].zyx >= b3[n].zyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThanOrEqual_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.zyx >= b3[n].zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Select_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Select(LessThan(a3[n], b3[n]), a3[n], b3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Select_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Select(LessThan(r, b3[n]), r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Select_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Select(LessThan(a3[n].zyx, b3[n].zyx), a3[n].zyx, b3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Select_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Select(LessThan(r.zyx, b3[n].zyx), r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Normalize_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Normalize(a3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Normalize_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Normalize(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Normalize_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Normalize(a3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Normalize_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Normalize(r.zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Length_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = vec3(a3[n]).Length; DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Length_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = vec3(r).Length;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Length_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = vec3(a3[n].zyx).Length; DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Length_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = vec3(r.zyx).Length;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Dot_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Dot(a3[n], b3[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Dot_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Dot(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Dot_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Dot(a3[n].zyx, b3[n].zyx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Dot_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Dot(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Cross_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Cross(a3[n], b3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Cross_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Cross(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Cross_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Cross(a3[n].zyx, b3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Cross_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Cross(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Project_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Project(a3[n], b3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Project_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Project(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Project_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Project(a3[n].zyx, b3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Project_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Project(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Rotate_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Rotate(a3[n], axis3[n], scalars[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Rotate_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r, axis3[n], scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Rotate_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Rotate(a3[n].zyx, axis3[n].zyx, scalars[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Rotate_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r.zyx, axis3[n].zyx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Lerp_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Lerp(a3[n], b3[n], scalars[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Lerp_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Lerp(r, b3[n], scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Lerp_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Lerp(a3[n].zyx, b3[n].zyx, scalars[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Lerp_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Lerp(r.zyx, b3[n].zyx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Max_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Max(a3[n], b3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Max_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Max_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Max(a3[n].zyx, b3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Max_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Min_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Min(a3[n], b3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Min_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Min_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Min(a3[n].zyx, b3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Min_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MaxScalar_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Max(a3[n], scalars[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MaxScalar_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MaxScalar_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Max(a3[n].zyx, scalars[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MaxScalar_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r.zyx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MinScalar_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Min(a3[n], scalars[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MinScalar_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MinScalar_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Min(a3[n].zyx, scalars[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MinScalar_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r.zyx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Ceil_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Ceil(a3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Ceil_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Ceil(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Ceil_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Ceil(a3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Ceil_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Ceil(r.zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Floor_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Floor(a3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Floor_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Floor(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Floor_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Floor(a3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Floor_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Floor(r.zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Clamp_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Clamp(a3[n], scalars[n], scalars[n] + 1); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Clamp_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Clamp(r, scalars[n], scalars[n] + 1);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Clamp_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Clamp(a3[n].zyx, scalars[n], scalars[n] + 1); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Clamp_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Clamp(r.zyx, scalars[n], scalars[n] + 1);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Exp_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Exp(a3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Exp_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Exp(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Exp_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Exp(a3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Exp_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Exp(r.zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Sin_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Sin(a3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Sin_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Sin(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Sin_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Sin(a3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Sin_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Sin(r.zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Atan2_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Atan2(a3[n], b3[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Atan2_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Atan2(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Atan2_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Atan2(a3[n].zyx, b3[n].zyx); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_Atan2_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Atan2(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Distance_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Distance(a3[n], b3[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Distance_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Distance(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Distance_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Distance(a3[n].zyx, b3[n].zyx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Distance_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Distance(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DistanceSquared_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = DistanceSquared(a3[n], b3[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_DistanceSquared_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = DistanceSquared(r, b3[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DistanceSquared_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = DistanceSquared(a3[n].zyx, b3[n].zyx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_DistanceSquared_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = DistanceSquared(r.zyx, b3[n].zyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiplyVector_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = matrix3[n] * a3[n]; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MatrixMultiplyVector_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = matrix3[n] * r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiplyVector_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = matrix3[n] * a3[n].zyx; DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_MatrixMultiplyVector_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = matrix3[n] * r.zyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_RotateQuaternion_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Rotate(a3[n], rotations[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_RotateQuaternion_3D_vector(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r, rotations[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_RotateQuaternion_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out3[n] = Rotate(a3[n].zyx, rotations[n]); DoNotOptimize(out3[n]);
+	}
+}
+
+void Latency_RotateQuaternion_3D_swizzle(const unsigned& iterations)
+{
+	vec3 r = a3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r.zyx, rotations[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiply_3D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix3[n] = matrix3[n] * otherMatrix3[n]; DoNotOptimize(outMatrix3[n]);
+	}
+}
+
+void Latency_MatrixMultiply_3D_matrix(const unsigned& iterations)
+{
+	mat3 r = matrix3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * otherMatrix3[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Transpose_3D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix3[n] = Transpose(matrix3[n]); DoNotOptimize(outMatrix3[n]);
+	}
+}
+
+void Latency_Transpose_3D_matrix(const unsigned& iterations)
+{
+	mat3 r = matrix3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Transpose(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Determinant_3D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Determinant(matrix3[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Determinant_3D_matrix(const unsigned& iterations)
+{
+	mat3 r = matrix3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r[0].x = Determinant(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Inverse_3D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix3[n] = Inverse(matrix3[n]); DoNotOptimize(outMatrix3[n]);
+	}
+}
+
+void Latency_Inverse_3D_matrix(const unsigned& iterations)
+{
+	mat3 r = matrix3[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Inverse(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Transform_3D_array(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(out3, matrix3[0], a3, DATA_SIZE); DoNotOptimize(out3);
+	}
+}
+
+void Throughput_RotateQuaternion_3D_array(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(out3, a3, rotations[0], DATA_SIZE); DoNotOptimize(out3);
+	}
+}
+
+void Throughput_BatchNegate_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Negate(soaOut3, soaA3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNegate_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Negate(soaOut3, soaA3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchAdd_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Add(soaOut3, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchAdd_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Add(soaOut3, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchSubtract_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Subtract(soaOut3, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchSubtract_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Subtract(soaOut3, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiply_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut3, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiply_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut3, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivide_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut3, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivide_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut3, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiplyScalar_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut3, soaA3, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiplyScalar_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut3, soaA3.zyx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivideScalar_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut3, soaA3, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivideScalar_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut3, soaA3.zyx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNormalize_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Normalize(soaOut3, soaA3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNormalize_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Normalize(soaOut3, soaA3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDot_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Dot(outScalar, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDot_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Dot(outScalar, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCross_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Cross(soaOut3, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCross_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Cross(soaOut3, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchProject_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Project(soaOut3, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchProject_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Project(soaOut3, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotate_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut3, soaA3, axis3[0], scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotate_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut3, soaA3.zyx, axis3[0], scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchLerp_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Lerp(soaOut3, soaA3, soaB3, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchLerp_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Lerp(soaOut3, soaA3.zyx, soaB3.zyx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMax_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Max(soaOut3, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMax_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Max(soaOut3, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMin_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Min(soaOut3, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMin_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Min(soaOut3, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCeil_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Ceil(soaOut3, soaA3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCeil_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Ceil(soaOut3, soaA3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchFloor_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Floor(soaOut3, soaA3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchFloor_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Floor(soaOut3, soaA3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistance_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Distance(outScalar, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistance_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Distance(outScalar, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistanceSquared_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		DistanceSquared(outScalar, soaA3, soaB3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistanceSquared_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		DistanceSquared(outScalar, soaA3.zyx, soaB3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchTransform_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(soaOut3, matrix3[0], soaA3);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchTransform_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(soaOut3, matrix3[0], soaA3.zyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotateQuaternion_3D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut3, soaA3, rotations[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotateQuaternion_3D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut3, soaA3.zyx, rotations[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+//----------------------------------------------------------------------
+// 4D
+//----------------------------------------------------------------------
+
+void Throughput_ToParent_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = vec4(a4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_ToParent_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = vec4(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToParent_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = vec4(a4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_ToParent_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = vec4(r.wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToString_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outString = ToString(a4[n]); DoNotOptimize(outString);
+	}
+}
+
+void Latency_ToString_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)ToString(r).size();
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToString_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outString = ToString(a4[n].wzyx); DoNotOptimize(outString);
+	}
+}
+
+void Latency_ToString_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)ToString(r.wzyx).size();
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToChars_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		DoNotOptimize(ToChars(outChars, outChars + 256, a4[n]));
+	}
+}
+
+void Latency_ToChars_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)(ToChars(outChars, outChars + 256, r) - outChars);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToChars_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		DoNotOptimize(ToChars(outChars, outChars + 256, a4[n].wzyx));
+	}
+}
+
+void Latency_ToChars_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = (SCALAR_TYPE)(ToChars(outChars, outChars + 256, r.wzyx) - outChars);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Negate_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = -a4[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Negate_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = -r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Negate_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = -a4[n].wzyx; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Negate_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = -r.wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Add_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n] + b4[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Add_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r + b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Add_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n].wzyx + b4[n].wzyx; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Add_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.wzyx + b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Subtract_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n] - b4[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Subtract_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r - b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Subtract_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n].wzyx - b4[n].wzyx; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Subtract_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.wzyx - b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Multiply_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n] * b4[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Multiply_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Multiply_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n].wzyx * b4[n].wzyx; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Multiply_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.wzyx * b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Divide_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n] / b4[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Divide_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r / b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Divide_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n].wzyx / b4[n].wzyx; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Divide_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.wzyx / b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalar_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n] * scalars[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MultiplyScalar_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalar_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n].wzyx * scalars[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MultiplyScalar_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.wzyx * scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalarLeft_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = scalars[n] * a4[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MultiplyScalarLeft_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] * r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MultiplyScalarLeft_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = scalars[n] * a4[n].wzyx; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MultiplyScalarLeft_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] * r.wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalar_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n] / scalars[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_DivideScalar_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r / scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalar_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = a4[n].wzyx / scalars[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_DivideScalar_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r.wzyx / scalars[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalarLeft_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = scalars[n] / a4[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_DivideScalarLeft_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] / r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DivideScalarLeft_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = scalars[n] / a4[n].wzyx; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_DivideScalarLeft_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = scalars[n] / r.wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_EqualTo_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n] == b4[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_EqualTo_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r == b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_EqualTo_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n].wzyx == b4[n].wzyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_EqualTo_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.wzyx == b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_NotEqualTo_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n] != b4[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_NotEqualTo_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r != b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_NotEqualTo_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n].wzyx != b4[n].wzyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_NotEqualTo_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.wzyx != b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_AlmostEqual_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = AlmostEqual(a4[n], b4[n]); DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_AlmostEqual_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += AlmostEqual(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_AlmostEqual_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = AlmostEqual(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_AlmostEqual_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += AlmostEqual(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThan_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n] < b4[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThan_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r < b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThan_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n].wzyx < b4[n].wzyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThan_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.wzyx < b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThan_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n] > b4[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThan_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r > b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThan_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n].wzyx > b4[n].wzyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThan_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.wzyx > b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThanOrEqual_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n] <= b4[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThanOrEqual_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r <= b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_LessThanOrEqual_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n].wzyx <= b4[n].wzyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_LessThanOrEqual_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.wzyx <= b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThanOrEqual_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n] >= b4[n]; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThanOrEqual_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r >= b4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_GreaterThanOrEqual_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outBool[n] = a4[n].wzyx >= b4[n].wzyx; DoNotOptimize(outBool[n]);
+	}
+}
+
+void Latency_GreaterThanOrEqual_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x += r.wzyx >= b4[n].wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Select_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Select(LessThan(a4[n], b4[n]), a4[n], b4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Select_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Select(LessThan(r, b4[n]), r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Select_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Select(LessThan(a4[n].wzyx, b4[n].wzyx), a4[n].wzyx, b4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Select_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Select(LessThan(r.wzyx, b4[n].wzyx), r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Normalize_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Normalize(a4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Normalize_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Normalize(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Normalize_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Normalize(a4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Normalize_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Normalize(r.wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Length_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = vec4(a4[n]).Length; DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Length_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = vec4(r).Length;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Length_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = vec4(a4[n].wzyx).Length; DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Length_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r.x = vec4(r.wzyx).Length;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Dot_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Dot(a4[n], b4[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Dot_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Dot(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Dot_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Dot(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Dot_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Dot(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Cross_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Cross(a4[n], b4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Cross_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Cross(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Cross_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Cross(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Cross_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Cross(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Project_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Project(a4[n], b4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Project_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Project(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Project_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Project(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Project_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Project(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Rotate_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Rotate(a4[n], axis4[n], scalars[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Rotate_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r, axis4[n], scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Rotate_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Rotate(a4[n].wzyx, axis4[n].wzyx, scalars[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Rotate_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r.wzyx, axis4[n].wzyx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Lerp_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Lerp(a4[n], b4[n], scalars[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Lerp_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Lerp(r, b4[n], scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Lerp_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Lerp(a4[n].wzyx, b4[n].wzyx, scalars[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Lerp_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Lerp(r.wzyx, b4[n].wzyx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Max_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Max(a4[n], b4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Max_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Max_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Max(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Max_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Min_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Min(a4[n], b4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Min_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Min_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Min(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Min_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MaxScalar_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Max(a4[n], scalars[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MaxScalar_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MaxScalar_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Max(a4[n].wzyx, scalars[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MaxScalar_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Max(r.wzyx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MinScalar_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Min(a4[n], scalars[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MinScalar_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MinScalar_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Min(a4[n].wzyx, scalars[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MinScalar_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Min(r.wzyx, scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Ceil_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Ceil(a4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Ceil_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Ceil(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Ceil_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Ceil(a4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Ceil_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Ceil(r.wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Floor_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Floor(a4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Floor_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Floor(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Floor_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Floor(a4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Floor_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Floor(r.wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Clamp_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Clamp(a4[n], scalars[n], scalars[n] + 1); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Clamp_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Clamp(r, scalars[n], scalars[n] + 1);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Clamp_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Clamp(a4[n].wzyx, scalars[n], scalars[n] + 1); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Clamp_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Clamp(r.wzyx, scalars[n], scalars[n] + 1);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Exp_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Exp(a4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Exp_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Exp(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Exp_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Exp(a4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Exp_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Exp(r.wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Sin_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Sin(a4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Sin_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Sin(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Sin_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Sin(a4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Sin_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Sin(r.wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Atan2_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Atan2(a4[n], b4[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Atan2_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Atan2(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Atan2_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Atan2(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_Atan2_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Atan2(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Distance_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Distance(a4[n], b4[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Distance_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Distance(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Distance_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Distance(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Distance_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = Distance(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DistanceSquared_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = DistanceSquared(a4[n], b4[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_DistanceSquared_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = DistanceSquared(r, b4[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_DistanceSquared_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = DistanceSquared(a4[n].wzyx, b4[n].wzyx); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_DistanceSquared_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r.x = DistanceSquared(r.wzyx, b4[n].wzyx);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiplyVector_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = matrix4[n] * a4[n]; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MatrixMultiplyVector_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = matrix4[n] * r;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiplyVector_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = matrix4[n] * a4[n].wzyx; DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_MatrixMultiplyVector_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = matrix4[n] * r.wzyx;
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_RotateQuaternion_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Rotate(a4[n], rotations[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_RotateQuaternion_4D_vector(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r, rotations[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_RotateQuaternion_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		out4[n] = Rotate(a4[n].wzyx, rotations[n]); DoNotOptimize(out4[n]);
+	}
+}
+
+void Latency_RotateQuaternion_4D_swizzle(const unsigned& iterations)
+{
+	vec4 r = a4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Rotate(r.wzyx, rotations[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_MatrixMultiply_4D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix4[n] = matrix4[n] * otherMatrix4[n]; DoNotOptimize(outMatrix4[n]);
+	}
+}
+
+void Latency_MatrixMultiply_4D_matrix(const unsigned& iterations)
+{
+	mat4 r = matrix4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * otherMatrix4[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Transpose_4D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix4[n] = Transpose(matrix4[n]); DoNotOptimize(outMatrix4[n]);
+	}
+}
+
+void Latency_Transpose_4D_matrix(const unsigned& iterations)
+{
+	mat4 r = matrix4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Transpose(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Determinant_4D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outScalar[n] = Determinant(matrix4[n]); DoNotOptimize(outScalar[n]);
+	}
+}
+
+void Latency_Determinant_4D_matrix(const unsigned& iterations)
+{
+	mat4 r = matrix4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r[0].x = Determinant(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Inverse_4D_matrix(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outMatrix4[n] = Inverse(matrix4[n]); DoNotOptimize(outMatrix4[n]);
+	}
+}
+
+void Latency_Inverse_4D_matrix(const unsigned& iterations)
+{
+	mat4 r = matrix4[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		r = Inverse(r);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Transform_4D_array(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(out4, matrix4[0], a4, DATA_SIZE); DoNotOptimize(out4);
+	}
+}
+
+void Throughput_RotateQuaternion_4D_array(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(out4, a4, rotations[0], DATA_SIZE); DoNotOptimize(out4);
+	}
+}
+
+void Throughput_BatchNegate_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Negate(soaOut4, soaA4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNegate_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Negate(soaOut4, soaA4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchAdd_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Add(soaOut4, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchAdd_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Add(soaOut4, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchSubtract_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Subtract(soaOut4, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchSubtract_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Subtract(soaOut4, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiply_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut4, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiply_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut4, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivide_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut4, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivide_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut4, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiplyScalar_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut4, soaA4, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMultiplyScalar_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Multiply(soaOut4, soaA4.wzyx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivideScalar_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut4, soaA4, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDivideScalar_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Divide(soaOut4, soaA4.wzyx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNormalize_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Normalize(soaOut4, soaA4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchNormalize_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Normalize(soaOut4, soaA4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDot_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Dot(outScalar, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDot_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Dot(outScalar, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCross_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Cross(soaOut4, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCross_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Cross(soaOut4, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchProject_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Project(soaOut4, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchProject_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Project(soaOut4, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotate_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut4, soaA4, axis4[0], scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotate_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut4, soaA4.wzyx, axis4[0], scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchLerp_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Lerp(soaOut4, soaA4, soaB4, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchLerp_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Lerp(soaOut4, soaA4.wzyx, soaB4.wzyx, scalars[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMax_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Max(soaOut4, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMax_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Max(soaOut4, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMin_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Min(soaOut4, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchMin_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Min(soaOut4, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCeil_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Ceil(soaOut4, soaA4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchCeil_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Ceil(soaOut4, soaA4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchFloor_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Floor(soaOut4, soaA4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchFloor_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Floor(soaOut4, soaA4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistance_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Distance(outScalar, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistance_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Distance(outScalar, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistanceSquared_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		DistanceSquared(outScalar, soaA4, soaB4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchDistanceSquared_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		DistanceSquared(outScalar, soaA4.wzyx, soaB4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchTransform_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(soaOut4, matrix4[0], soaA4);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchTransform_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Transform(soaOut4, matrix4[0], soaA4.wzyx);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotateQuaternion_4D_vector(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut4, soaA4, rotations[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+void Throughput_BatchRotateQuaternion_4D_swizzle(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		Rotate(soaOut4, soaA4.wzyx, rotations[0]);
+		DoNotOptimize(outScalar);
+	}
+}
+
+//----------------------------------------------------------------------
+// Quaternions
+//----------------------------------------------------------------------
+
+void Throughput_QuaternionMultiply_quaternion(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outRotations[n] = rotations[n] * otherRotations[n]; DoNotOptimize(outRotations[n]);
+	}
+}
+
+void Latency_QuaternionMultiply_quaternion(const unsigned& iterations)
+{
+	quat r = rotations[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = r * otherRotations[n];
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Nlerp_quaternion(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outRotations[n] = Nlerp(rotations[n], otherRotations[n], scalars[n]); DoNotOptimize(outRotations[n]);
+	}
+}
+
+void Latency_Nlerp_quaternion(const unsigned& iterations)
+{
+	quat r = rotations[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Nlerp(r, otherRotations[n], scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_Slerp_quaternion(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outRotations[n] = Slerp(rotations[n], otherRotations[n], scalars[n]); DoNotOptimize(outRotations[n]);
+	}
+}
+
+void Latency_Slerp_quaternion(const unsigned& iterations)
+{
+	quat r = rotations[0];
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		r = Slerp(r, otherRotations[n], scalars[n]);
+	}
+	DoNotOptimize(r);
+}
+
+void Throughput_ToMatrix_quaternion(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outRotationMatrix[n] = ToMatrix(rotations[n]); DoNotOptimize(outRotationMatrix[n]);
+	}
+}
+
+//----------------------------------------------------------------------
+// Bounding boxes
+//----------------------------------------------------------------------
+
+void Throughput_Fit_2D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		outBox2 = Fit(a2, DATA_SIZE); DoNotOptimize(outBox2);
+	}
+}
+
+void Throughput_BatchFit_2D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		outBox2 = Fit(soaA2); DoNotOptimize(outBox2);
+	}
+}
+
+void Throughput_IntersectRay_2D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outHits[n] = IntersectRay(boxes2[n], rayOrigins2[n], rayInverses2[n], 100.0f, outScalar[0]); DoNotOptimize(outHits[n]);
+	}
+}
+
+void Throughput_IntersectRayPacket4_2D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outHits[n] = IntersectRay(packets4x2[n & (DATA_MASK / 4)], rayOrigins2[n], rayInverses2[n], 100.0f, outScalar); DoNotOptimize(outHits[n]);
+	}
+}
+
+void Throughput_IntersectRayPacket8_2D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outHits[n] = IntersectRay(packets8x2[n & (DATA_MASK / 8)], rayOrigins2[n], rayInverses2[n], 100.0f, outScalar); DoNotOptimize(outHits[n]);
+	}
+}
+
+void Throughput_Fit_3D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		outBox3 = Fit(a3, DATA_SIZE); DoNotOptimize(outBox3);
+	}
+}
+
+void Throughput_BatchFit_3D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		outBox3 = Fit(soaA3); DoNotOptimize(outBox3);
+	}
+}
+
+void Throughput_IntersectRay_3D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outHits[n] = IntersectRay(boxes3[n], rayOrigins3[n], rayInverses3[n], 100.0f, outScalar[0]); DoNotOptimize(outHits[n]);
+	}
+}
+
+void Throughput_IntersectRayPacket4_3D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outHits[n] = IntersectRay(packets4x3[n & (DATA_MASK / 4)], rayOrigins3[n], rayInverses3[n], 100.0f, outScalar); DoNotOptimize(outHits[n]);
+	}
+}
+
+void Throughput_IntersectRayPacket8_3D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		unsigned n = i & DATA_MASK;
+		outHits[n] = IntersectRay(packets8x3[n & (DATA_MASK / 8)], rayOrigins3[n], rayInverses3[n], 100.0f, outScalar); DoNotOptimize(outHits[n]);
+	}
+}
+
+//----------------------------------------------------------------------
+// Reductions
+//----------------------------------------------------------------------
+
+void Throughput_Sum_2D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		out2[0] = Sum(a2, DATA_SIZE); DoNotOptimize(out2[0]);
+	}
+}
+
+void Throughput_Centroid_2D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		out2[0] = Centroid(a2, DATA_SIZE); DoNotOptimize(out2[0]);
+	}
+}
+
+void Throughput_Covariance_2D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		outMatrix2[0] = Covariance(a2, DATA_SIZE); DoNotOptimize(outMatrix2[0]);
+	}
+}
+
+void Throughput_Sum_3D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		out3[0] = Sum(a3, DATA_SIZE); DoNotOptimize(out3[0]);
+	}
+}
+
+void Throughput_Centroid_3D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		out3[0] = Centroid(a3, DATA_SIZE); DoNotOptimize(out3[0]);
+	}
+}
+
+void Throughput_Covariance_3D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		outMatrix3[0] = Covariance(a3, DATA_SIZE); DoNotOptimize(outMatrix3[0]);
+	}
+}
+
+void Throughput_Sum_4D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		out4[0] = Sum(a4, DATA_SIZE); DoNotOptimize(out4[0]);
+	}
+}
+
+void Throughput_Centroid_4D(const unsigned& iterations)
+{
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		out4[0] = Centroid(a4, DATA_SIZE); DoNotOptimize(out4[0]);
+	}
+}
+
+const BENCHMARK benchmarks[] =
+{
+	{ "BM_ToParent/2D/vector/throughput", Throughput_ToParent_2D_vector, 1 },
+	{ "BM_ToParent/2D/vector/latency", Latency_ToParent_2D_vector, 1 },
+	{ "BM_ToParent/2D/swizzle/throughput", Throughput_ToParent_2D_swizzle, 1 },
+	{ "BM_ToParent/2D/swizzle/latency", Latency_ToParent_2D_swizzle, 1 },
+	{ "BM_ToString/2D/vector/throughput", Throughput_ToString_2D_vector, 1 },
+	{ "BM_ToString/2D/vector/latency", Latency_ToString_2D_vector, 1 },
+	{ "BM_ToString/2D/swizzle/throughput", Throughput_ToString_2D_swizzle, 1 },
+	{ "BM_ToString/2D/swizzle/latency", Latency_ToString_2D_swizzle, 1 },
+	{ "BM_ToChars/2D/vector/throughput", Throughput_ToChars_2D_vector, 1 },
+	{ "BM_ToChars/2D/vector/latency", Latency_ToChars_2D_vector, 1 },
+	{ "BM_ToChars/2D/swizzle/throughput", Throughput_ToChars_2D_swizzle, 1 },
+	{ "BM_ToChars/2D/swizzle/latency", Latency_ToChars_2D_swizzle, 1 },
+	{ "BM_Negate/2D/vector/throughput", Throughput_Negate_2D_vector, 1 },
+	{ "BM_Negate/2D/vector/latency", Latency_Negate_2D_vector, 1 },
+	{ "BM_Negate/2D/swizzle/throughput", Throughput_Negate_2D_swizzle, 1 },
+	{ "BM_Negate/2D/swizzle/latency", Latency_Negate_2D_swizzle, 1 },
+	{ "BM_Add/2D/vector/throughput", Throughput_Add_2D_vector, 1 },
+	{ "BM_Add/2D/vector/latency", Latency_Add_2D_vector, 1 },
+	{ "BM_Add/2D/swizzle/throughput", Throughput_Add_2D_swizzle, 1 },
+	{ "BM_Add/2D/swizzle/latency", Latency_Add_2D_swizzle, 1 },
+	{ "BM_Subtract/2D/vector/throughput", Throughput_Subtract_2D_vector, 1 },
+	{ "BM_Subtract/2D/vector/latency", Latency_Subtract_2D_vector, 1 },
+	{ "BM_Subtract/2D/swizzle/throughput", Throughput_Subtract_2D_swizzle, 1 },
+	{ "BM_Subtract/2D/swizzle/latency", Latency_Subtract_2D_swizzle, 1 },
+	{ "BM_Multiply/2D/vector/throughput", Throughput_Multiply_2D_vector, 1 },
+	{ "BM_Multiply/2D/vector/latency", Latency_Multiply_2D_vector, 1 },
+	{ "BM_Multiply/2D/swizzle/throughput", Throughput_Multiply_2D_swizzle, 1 },
+	{ "BM_Multiply/2D/swizzle/latency", Latency_Multiply_2D_swizzle, 1 },
+	{ "BM_Divide/2D/vector/throughput", Throughput_Divide_2D_vector, 1 },
+	{ "BM_Divide/2D/vector/latency", Latency_Divide_2D_vector, 1 },
+	{ "BM_Divide/2D/swizzle/throughput", Throughput_Divide_2D_swizzle, 1 },
+	{ "BM_Divide/2D/swizzle/latency", Latency_Divide_2D_swizzle, 1 },
+	{ "BM_MultiplyScalar/2D/vector/throughput", Throughput_MultiplyScalar_2D_vector, 1 },
+	{ "BM_MultiplyScalar/2D/vector/latency", Latency_MultiplyScalar_2D_vector, 1 },
+	{ "BM_MultiplyScalar/2D/swizzle/throughput", Throughput_MultiplyScalar_2D_swizzle, 1 },
+	{ "BM_MultiplyScalar/2D/swizzle/latency", Latency_MultiplyScalar_2D_swizzle, 1 },
+	{ "BM_MultiplyScalarLeft/2D/vector/throughput", Throughput_MultiplyScalarLeft_2D_vector, 1 },
+	{ "BM_MultiplyScalarLeft/2D/vector/latency", Latency_MultiplyScalarLeft_2D_vector, 1 },
+	{ "BM_MultiplyScalarLeft/2D/swizzle/throughput", Throughput_MultiplyScalarLeft_2D_swizzle, 1 },
+	{ "BM_MultiplyScalarLeft/2D/swizzle/latency", Latency_MultiplyScalarLeft_2D_swizzle, 1 },
+	{ "BM_DivideScalar/2D/vector/throughput", Throughput_DivideScalar_2D_vector, 1 },
+	{ "BM_DivideScalar/2D/vector/latency", Latency_DivideScalar_2D_vector, 1 },
+	{ "BM_DivideScalar/2D/swizzle/throughput", Throughput_DivideScalar_2D_swizzle, 1 },
+	{ "BM_DivideScalar/2D/swizzle/latency", Latency_DivideScalar_2D_swizzle, 1 },
+	{ "BM_DivideScalarLeft/2D/vector/throughput", Throughput_DivideScalarLeft_2D_vector, 1 },
+	{ "BM_DivideScalarLeft/2D/vector/latency", Latency_DivideScalarLeft_2D_vector, 1 },
+	{ "BM_DivideScalarLeft/2D/swizzle/throughput", Throughput_DivideScalarLeft_2D_swizzle, 1 },
+	{ "BM_DivideScalarLeft/2D/swizzle/latency", Latency_DivideScalarLeft_2D_swizzle, 1 },
+	{ "BM_EqualTo/2D/vector/throughput", Throughput_EqualTo_2D_vector, 1 },
+	{ "BM_EqualTo/2D/vector/latency", Latency_EqualTo_2D_vector, 1 },
+	{ "BM_EqualTo/2D/swizzle/throughput", Throughput_EqualTo_2D_swizzle, 1 },
+	{ "BM_EqualTo/2D/swizzle/latency", Latency_EqualTo_2D_swizzle, 1 },
+	{ "BM_NotEqualTo/2D/vector/throughput", Throughput_NotEqualTo_2D_vector, 1 },
+	{ "BM_NotEqualTo/2D/vector/latency", Latency_NotEqualTo_2D_vector, 1 },
+	{ "BM_NotEqualTo/2D/swizzle/throughput", Throughput_NotEqualTo_2D_swizzle, 1 },
+	{ "BM_NotEqualTo/2D/swizzle/latency", Latency_NotEqualTo_2D_swizzle, 1 },
+	{ "BM_AlmostEqual/2D/vector/throughput", Throughput_AlmostEqual_2D_vector, 1 },
+	{ "BM_AlmostEqual/2D/vector/latency", Latency_AlmostEqual_2D_vector, 1 },
+	{ "BM_AlmostEqual/2D/swizzle/throughput", Throughput_AlmostEqual_2D_swizzle, 1 },
+	{ "BM_AlmostEqual/2D/swizzle/latency", Latency_AlmostEqual_2D_swizzle, 1 },
+	{ "BM_LessThan/2D/vector/throughput", Throughput_LessThan_2D_vector, 1 },
+	{ "BM_LessThan/2D/vector/latency", Latency_LessThan_2D_vector, 1 },
+	{ "BM_LessThan/2D/swizzle/throughput", Throughput_LessThan_2D_swizzle, 1 },
+	{ "BM_LessThan/2D/swizzle/latency", Latency_LessThan_2D_swizzle, 1 },
+	{ "BM_GreaterThan/2D/vector/throughput", Throughput_GreaterThan_2D_vector, 1 },
+	{ "BM_GreaterThan/2D/vector/latency", Latency_GreaterThan_2D_vector, 1 },
+	{ "BM_GreaterThan/2D/swizzle/throughput", Throughput_GreaterThan_2D_swizzle, 1 },
+	{ "BM_GreaterThan/2D/swizzle/latency", Latency_GreaterThan_2D_swizzle, 1 },
+	{ "BM_LessThanOrEqual/2D/vector/throughput", Throughput_LessThanOrEqual_2D_vector, 1 },
+	{ "BM_LessThanOrEqual/2D/vector/latency", Latency_LessThanOrEqual_2D_vector, 1 },
+	{ "BM_LessThanOrEqual/2D/swizzle/throughput", Throughput_LessThanOrEqual_2D_swizzle, 1 },
+	{ "BM_LessThanOrEqual/2D/swizzle/latency", Latency_LessThanOrEqual_2D_swizzle, 1 },
+	{ "BM_GreaterThanOrEqual/2D/vector/throughput", Throughput_GreaterThanOrEqual_2D_vector, 1 },
+	{ "BM_GreaterThanOrEqual/2D/vector/latency", Latency_GreaterThanOrEqual_2D_vector, 1 },
+	{ "BM_GreaterThanOrEqual/2D/swizzle/throughput", Throughput_GreaterThanOrEqual_2D_swizzle, 1 },
+	{ "BM_GreaterThanOrEqual/2D/swizzle/latency", Latency_GreaterThanOrEqual_2D_swizzle, 1 },
+	{ "BM_Select/2D/vector/throughput", Throughput_Select_2D_vector, 1 },
+	{ "BM_Select/2D/vector/latency", Latency_Select_2D_vector, 1 },
+	{ "BM_Select/2D/swizzle/throughput", Throughput_Select_2D_swizzle, 1 },
+	{ "BM_Select/2D/swizzle/latency", Latency_Select_2D_swizzle, 1 },
+	{ "BM_Normalize/2D/vector/throughput", Throughput_Normalize_2D_vector, 1 },
+	{ "BM_Normalize/2D/vector/latency", Latency_Normalize_2D_vector, 1 },
+	{ "BM_Normalize/2D/swizzle/throughput", Throughput_Normalize_2D_swizzle, 1 },
+	{ "BM_Normalize/2D/swizzle/latency", Latency_Normalize_2D_swizzle, 1 },
+	{ "BM_Length/2D/vector/throughput", Throughput_Length_2D_vector, 1 },
+	{ "BM_Length/2D/vector/latency", Latency_Length_2D_vector, 1 },
+	{ "BM_Length/2D/swizzle/throughput", Throughput_Length_2D_swizzle, 1 },
+	{ "BM_Length/2D/swizzle/latency", Latency_Length_2D_swizzle, 1 },
+	{ "BM_Dot/2D/vector/throughput", Throughput_Dot_2D_vector, 1 },
+	{ "BM_Dot/2D/vector/latency", Latency_Dot_2D_vector, 1 },
+	{ "BM_Dot/2D/swizzle/throughput", Throughput_Dot_2D_swizzle, 1 },
+	{ "BM_Dot/2D/swizzle/latency", Latency_Dot_2D_swizzle, 1 },
+	{ "BM_Perpendicular/2D/vector/throughput", Throughput_Perpendicular_2D_vector, 1 },
+	{ "BM_Perpendicular/2D/vector/latency", Latency_Perpendicular_2D_vector, 1 },
+	{ "BM_Perpendicular/2D/swizzle/throughput", Throughput_Perpendicular_2D_swizzle, 1 },
+	{ "BM_Perpendicular/2D/swizzle/latency", Latency_Perpendicular_2D_swizzle, 1 },
+	{ "BM_Project/2D/vector/throughput", Throughput_Project_2D_vector, 1 },
+	{ "BM_Project/2D/vector/latency", Latency_Project_2D_vector, 1 },
+	{ "BM_Project/2D/swizzle/throughput", Throughput_Project_2D_swizzle, 1 },
+	{ "BM_Project/2D/swizzle/latency", Latency_Project_2D_swizzle, 1 },
+	{ "BM_Rotate/2D/vector/throughput", Throughput_Rotate_2D_vector, 1 },
+	{ "BM_Rotate/2D/vector/latency", Latency_Rotate_2D_vector, 1 },
+	{ "BM_Rotate/2D/swizzle/throughput", Throughput_Rotate_2D_swizzle, 1 },
+	{ "BM_Rotate/2D/swizzle/latency", Latency_Rotate_2D_swizzle, 1 },
+	{ "BM_Lerp/2D/vector/throughput", Throughput_Lerp_2D_vector, 1 },
+	{ "BM_Lerp/2D/vector/latency", Latency_Lerp_2D_vector, 1 },
+	{ "BM_Lerp/2D/swizzle/throughput", Throughput_Lerp_2D_swizzle, 1 },
+	{ "BM_Lerp/2D/swizzle/latency", Latency_Lerp_2D_swizzle, 1 },
+	{ "BM_Max/2D/vector/throughput", Throughput_Max_2D_vector, 1 },
+	{ "BM_Max/2D/vector/latency", Latency_Max_2D_vector, 1 },
+	{ "BM_Max/2D/swizzle/throughput", Throughput_Max_2D_swizzle, 1 },
+	{ "BM_Max/2D/swizzle/latency", Latency_Max_2D_swizzle, 1 },
+	{ "BM_Min/2D/vector/throughput", Throughput_Min_2D_vector, 1 },
+	{ "BM_Min/2D/vector/latency", Latency_Min_2D_vector, 1 },
+	{ "BM_Min/2D/swizzle/throughput", Throughput_Min_2D_swizzle, 1 },
+	{ "BM_Min/2D/swizzle/latency", Latency_Min_2D_swizzle, 1 },
+	{ "BM_MaxScalar/2D/vector/throughput", Throughput_MaxScalar_2D_vector, 1 },
+	{ "BM_MaxScalar/2D/vector/latency", Latency_MaxScalar_2D_vector, 1 },
+	{ "BM_MaxScalar/2D/swizzle/throughput", Throughput_MaxScalar_2D_swizzle, 1 },
+	{ "BM_MaxScalar/2D/swizzle/latency", Latency_MaxScalar_2D_swizzle, 1 },
+	{ "BM_MinScalar/2D/vector/throughput", Throughput_MinScalar_2D_vector, 1 },
+	{ "BM_MinScalar/2D/vector/latency", Latency_MinScalar_2D_vector, 1 },
+	{ "BM_MinScalar/2D/swizzle/throughput", Throughput_MinScalar_2D_swizzle, 1 },
+	{ "BM_MinScalar/2D/swizzle/latency", Latency_MinScalar_2D_swizzle, 1 },
+	{ "BM_Ceil/2D/vector/throughput", Throughput_Ceil_2D_vector, 1 },
+	{ "BM_Ceil/2D/vector/latency", Latency_Ceil_2D_vector, 1 },
+	{ "BM_Ceil/2D/swizzle/throughput", Throughput_Ceil_2D_swizzle, 1 },
+	{ "BM_Ceil/2D/swizzle/latency", Latency_Ceil_2D_swizzle, 1 },
+	{ "BM_Floor/2D/vector/throughput", Throughput_Floor_2D_vector, 1 },
+	{ "BM_Floor/2D/vector/latency", Latency_Floor_2D_vector, 1 },
+	{ "BM_Floor/2D/swizzle/throughput", Throughput_Floor_2D_swizzle, 1 },
+	{ "BM_Floor/2D/swizzle/latency", Latency_Floor_2D_swizzle, 1 },
+	{ "BM_Clamp/2D/vector/throughput", Throughput_Clamp_2D_vector, 1 },
+	{ "BM_Clamp/2D/vector/latency", Latency_Clamp_2D_vector, 1 },
+	{ "BM_Clamp/2D/swizzle/throughput", Throughput_Clamp_2D_swizzle, 1 },
+	{ "BM_Clamp/2D/swizzle/latency", Latency_Clamp_2D_swizzle, 1 },
+	{ "BM_Exp/2D/vector/throughput", Throughput_Exp_2D_vector, 1 },
+	{ "BM_Exp/2D/vector/latency", Latency_Exp_2D_vector, 1 },
+	{ "BM_Exp/2D/swizzle/throughput", Throughput_Exp_2D_swizzle, 1 },
+	{ "BM_Exp/2D/swizzle/latency", Latency_Exp_2D_swizzle, 1 },
+	{ "BM_Sin/2D/vector/throughput", Throughput_Sin_2D_vector, 1 },
+	{ "BM_Sin/2D/vector/latency", Latency_Sin_2D_vector, 1 },
+	{ "BM_Sin/2D/swizzle/throughput", Throughput_Sin_2D_swizzle, 1 },
+	{ "BM_Sin/2D/swizzle/latency", Latency_Sin_2D_swizzle, 1 },
+	{ "BM_Atan2/2D/vector/throughput", Throughput_Atan2_2D_vector, 1 },
+	{ "BM_Atan2/2D/vector/latency", Latency_Atan2_2D_vector, 1 },
+	{ "BM_Atan2/2D/swizzle/throughput", Throughput_Atan2_2D_swizzle, 1 },
+	{ "BM_Atan2/2D/swizzle/latency", Latency_Atan2_2D_swizzle, 1 },
+	{ "BM_Distance/2D/vector/throughput", Throughput_Distance_2D_vector, 1 },
+	{ "BM_Distance/2D/vector/latency", Latency_Distance_2D_vector, 1 },
+	{ "BM_Distance/2D/swizzle/throughput", Throughput_Distance_2D_swizzle, 1 },
+	{ "BM_Distance/2D/swizzle/latency", Latency_Distance_2D_swizzle, 1 },
+	{ "BM_DistanceSquared/2D/vector/throughput", Throughput_DistanceSquared_2D_vector, 1 },
+	{ "BM_DistanceSquared/2D/vector/latency", Latency_DistanceSquared_2D_vector, 1 },
+	{ "BM_DistanceSquared/2D/swizzle/throughput", Throughput_DistanceSquared_2D_swizzle, 1 },
+	{ "BM_DistanceSquared/2D/swizzle/latency", Latency_DistanceSquared_2D_swizzle, 1 },
+	{ "BM_MatrixMultiplyVector/2D/vector/throughput", Throughput_MatrixMultiplyVector_2D_vector, 1 },
+	{ "BM_MatrixMultiplyVector/2D/vector/latency", Latency_MatrixMultiplyVector_2D_vector, 1 },
+	{ "BM_MatrixMultiplyVector/2D/swizzle/throughput", Throughput_MatrixMultiplyVector_2D_swizzle, 1 },
+	{ "BM_MatrixMultiplyVector/2D/swizzle/latency", Latency_MatrixMultiplyVector_2D_swizzle, 1 },
+	{ "BM_MatrixMultiply/2D/matrix/throughput", Throughput_MatrixMultiply_2D_matrix, 1 },
+	{ "BM_MatrixMultiply/2D/matrix/latency", Latency_MatrixMultiply_2D_matrix, 1 },
+	{ "BM_Transpose/2D/matrix/throughput", Throughput_Transpose_2D_matrix, 1 },
+	{ "BM_Transpose/2D/matrix/latency", Latency_Transpose_2D_matrix, 1 },
+	{ "BM_Determinant/2D/matrix/throughput", Throughput_Determinant_2D_matrix, 1 },
+	{ "BM_Determinant/2D/matrix/latency", Latency_Determinant_2D_matrix, 1 },
+	{ "BM_Inverse/2D/matrix/throughput", Throughput_Inverse_2D_matrix, 1 },
+	{ "BM_Inverse/2D/matrix/latency", Latency_Inverse_2D_matrix, 1 },
+	{ "BM_Transform/2D/array/throughput", Throughput_Transform_2D_array, DATA_SIZE },
+	{ "BM_BatchNegate/2D/vector/throughput", Throughput_BatchNegate_2D_vector, DATA_SIZE },
+	{ "BM_BatchNegate/2D/swizzle/throughput", Throughput_BatchNegate_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchAdd/2D/vector/throughput", Throughput_BatchAdd_2D_vector, DATA_SIZE },
+	{ "BM_BatchAdd/2D/swizzle/throughput", Throughput_BatchAdd_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchSubtract/2D/vector/throughput", Throughput_BatchSubtract_2D_vector, DATA_SIZE },
+	{ "BM_BatchSubtract/2D/swizzle/throughput", Throughput_BatchSubtract_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchMultiply/2D/vector/throughput", Throughput_BatchMultiply_2D_vector, DATA_SIZE },
+	{ "BM_BatchMultiply/2D/swizzle/throughput", Throughput_BatchMultiply_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchDivide/2D/vector/throughput", Throughput_BatchDivide_2D_vector, DATA_SIZE },
+	{ "BM_BatchDivide/2D/swizzle/throughput", Throughput_BatchDivide_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchMultiplyScalar/2D/vector/throughput", Throughput_BatchMultiplyScalar_2D_vector, DATA_SIZE },
+	{ "BM_BatchMultiplyScalar/2D/swizzle/throughput", Throughput_BatchMultiplyScalar_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchDivideScalar/2D/vector/throughput", Throughput_BatchDivideScalar_2D_vector, DATA_SIZE },
+	{ "BM_BatchDivideScalar/2D/swizzle/throughput", Throughput_BatchDivideScalar_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchNormalize/2D/vector/throughput", Throughput_BatchNormalize_2D_vector, DATA_SIZE },
+	{ "BM_BatchNormalize/2D/swizzle/throughput", Throughput_BatchNormalize_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchDot/2D/vector/throughput", Throughput_BatchDot_2D_vector, DATA_SIZE },
+	{ "BM_BatchDot/2D/swizzle/throughput", Throughput_BatchDot_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchProject/2D/vector/throughput", Throughput_BatchProject_2D_vector, DATA_SIZE },
+	{ "BM_BatchProject/2D/swizzle/throughput", Throughput_BatchProject_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchRotate/2D/vector/throughput", Throughput_BatchRotate_2D_vector, DATA_SIZE },
+	{ "BM_BatchRotate/2D/swizzle/throughput", Throughput_BatchRotate_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchLerp/2D/vector/throughput", Throughput_BatchLerp_2D_vector, DATA_SIZE },
+	{ "BM_BatchLerp/2D/swizzle/throughput", Throughput_BatchLerp_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchMax/2D/vector/throughput", Throughput_BatchMax_2D_vector, DATA_SIZE },
+	{ "BM_BatchMax/2D/swizzle/throughput", Throughput_BatchMax_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchMin/2D/vector/throughput", Throughput_BatchMin_2D_vector, DATA_SIZE },
+	{ "BM_BatchMin/2D/swizzle/throughput", Throughput_BatchMin_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchCeil/2D/vector/throughput", Throughput_BatchCeil_2D_vector, DATA_SIZE },
+	{ "BM_BatchCeil/2D/swizzle/throughput", Throughput_BatchCeil_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchFloor/2D/vector/throughput", Throughput_BatchFloor_2D_vector, DATA_SIZE },
+	{ "BM_BatchFloor/2D/swizzle/throughput", Throughput_BatchFloor_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchDistance/2D/vector/throughput", Throughput_BatchDistance_2D_vector, DATA_SIZE },
+	{ "BM_BatchDistance/2D/swizzle/throughput", Throughput_BatchDistance_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchDistanceSquared/2D/vector/throughput", Throughput_BatchDistanceSquared_2D_vector, DATA_SIZE },
+	{ "BM_BatchDistanceSquared/2D/swizzle/throughput", Throughput_BatchDistanceSquared_2D_swizzle, DATA_SIZE },
+	{ "BM_BatchTransform/2D/vector/throughput", Throughput_BatchTransform_2D_vector, DATA_SIZE },
+	{ "BM_BatchTransform/2D/swizzle/throughput", Throughput_BatchTransform_2D_swizzle, DATA_SIZE },
+	{ "BM_ToParent/3D/vector/throughput", Throughput_ToParent_3D_vector, 1 },
+	{ "BM_ToParent/3D/vector/latency", Latency_ToParent_3D_vector, 1 },
+	{ "BM_ToParent/3D/swizzle/throughput", Throughput_ToParent_3D_swizzle, 1 },
+	{ "BM_ToParent/3D/swizzle/latency", Latency_ToParent_3D_swizzle, 1 },
+	{ "BM_ToString/3D/vector/throughput", Throughput_ToString_3D_vector, 1 },
+	{ "BM_ToString/3D/vector/latency", Latency_ToString_3D_vector, 1 },
+	{ "BM_ToString/3D/swizzle/throughput", Throughput_ToString_3D_swizzle, 1 },
+	{ "BM_ToString/3D/swizzle/latency", Latency_ToString_3D_swizzle, 1 },
+	{ "BM_ToChars/3D/vector/throughput", Throughput_ToChars_3D_vector, 1 },
+	{ "BM_ToChars/3D/vector/latency", Latency_ToChars_3D_vector, 1 },
+	{ "BM_ToChars/3D/swizzle/throughput", Throughput_ToChars_3D_swizzle, 1 },
+	{ "BM_ToChars/3D/swizzle/latency", Latency_ToChars_3D_swizzle, 1 },
+	{ "BM_Negate/3D/vector/throughput", Throughput_Negate_3D_vector, 1 },
+	{ "BM_Negate/3D/vector/latency", Latency_Negate_3D_vector, 1 },
+	{ "BM_Negate/3D/swizzle/throughput", Throughput_Negate_3D_swizzle, 1 },
+	{ "BM_Negate/3D/swizzle/latency", Latency_Negate_3D_swizzle, 1 },
+	{ "BM_Add/3D/vector/throughput", Throughput_Add_3D_vector, 1 },
+	{ "BM_Add/3D/vector/latency", Latency_Add_3D_vector, 1 },
+	{ "BM_Add/3D/swizzle/throughput", Throughput_Add_3D_swizzle, 1 },
+	{ "BM_Add/3D/swizzle/latency", Latency_Add_3D_swizzle, 1 },
+	{ "BM_Subtract/3D/vector/throughput", Throughput_Subtract_3D_vector, 1 },
+	{ "BM_Subtract/3D/vector/latency", Latency_Subtract_3D_vector, 1 },
+	{ "BM_Subtract/3D/swizzle/throughput", Throughput_Subtract_3D_swizzle, 1 },
+	{ "BM_Subtract/3D/swizzle/latency", Latency_Subtract_3D_swizzle, 1 },
+	{ "BM_Multiply/3D/vector/throughput", Throughput_Multiply_3D_vector, 1 },
+	{ "BM_Multiply/3D/vector/latency", Latency_Multiply_3D_vector, 1 },
+	{ "BM_Multiply/3D/swizzle/throughput", Throughput_Multiply_3D_swizzle, 1 },
+	{ "BM_Multiply/3D/swizzle/latency", Latency_Multiply_3D_swizzle, 1 },
+	{ "BM_Divide/3D/vector/throughput", Throughput_Divide_3D_vector, 1 },
+	{ "BM_Divide/3D/vector/latency", Latency_Divide_3D_vector, 1 },
+	{ "BM_Divide/3D/swizzle/throughput", Throughput_Divide_3D_swizzle, 1 },
+	{ "BM_Divide/3D/swizzle/latency", Latency_Divide_3D_swizzle, 1 },
+	{ "BM_MultiplyScalar/3D/vector/throughput", Throughput_MultiplyScalar_3D_vector, 1 },
+	{ "BM_MultiplyScalar/3D/vector/latency", Latency_MultiplyScalar_3D_vector, 1 },
+	{ "BM_MultiplyScalar/3D/swizzle/throughput", Throughput_MultiplyScalar_3D_swizzle, 1 },
+	{ "BM_MultiplyScalar/3D/swizzle/latency", Latency_MultiplyScalar_3D_swizzle, 1 },
+	{ "BM_MultiplyScalarLeft/3D/vector/throughput", Throughput_MultiplyScalarLeft_3D_vector, 1 },
+	{ "BM_MultiplyScalarLeft/3D/vector/latency", Latency_MultiplyScalarLeft_3D_vector, 1 },
+	{ "BM_MultiplyScalarLeft/3D/swizzle/throughput", Throughput_MultiplyScalarLeft_3D_swizzle, 1 },
+	{ "BM_MultiplyScalarLeft/3D/swizzle/latency", Latency_MultiplyScalarLeft_3D_swizzle, 1 },
+	{ "BM_DivideScalar/3D/vector/throughput", Throughput_DivideScalar_3D_vector, 1 },
+	{ "BM_DivideScalar/3D/vector/latency", Latency_DivideScalar_3D_vector, 1 },
+	{ "BM_DivideScalar/3D/swizzle/throughput", Throughput_DivideScalar_3D_swizzle, 1 },
+	{ "BM_DivideScalar/3D/swizzle/latency", Latency_DivideScalar_3D_swizzle, 1 },
+	{ "BM_DivideScalarLeft/3D/vector/throughput", Throughput_DivideScalarLeft_3D_vector, 1 },
+	{ "BM_DivideScalarLeft/3D/vector/latency", Latency_DivideScalarLeft_3D_vector, 1 },
+	{ "BM_DivideScalarLeft/3D/swizzle/throughput", Throughput_DivideScalarLeft_3D_swizzle, 1 },
+	{ "BM_DivideScalarLeft/3D/swizzle/latency", Latency_DivideScalarLeft_3D_swizzle, 1 },
+	{ "BM_EqualTo/3D/vector/throughput", Throughput_EqualTo_3D_vector, 1 },
+	{ "BM_EqualTo/3D/vector/latency", Latency_EqualTo_3D_vector, 1 },
+	{ "BM_EqualTo/3D/swizzle/throughput", Throughput_EqualTo_3D_swizzle, 1 },
+	{ "BM_EqualTo/3D/swizzle/latency", Latency_EqualTo_3D_swizzle, 1 },
+	{ "BM_NotEqualTo/3D/vector/throughput", Throughput_NotEqualTo_3D_vector, 1 },
+	{ "BM_NotEqualTo/3D/vector/latency", Latency_NotEqualTo_3D_vector, 1 },
+	{ "BM_NotEqualTo/3D/swizzle/throughput", Throughput_NotEqualTo_3D_swizzle, 1 },
+	{ "BM_NotEqualTo/3D/swizzle/latency", Latency_NotEqualTo_3D_swizzle, 1 },
+	{ "BM_AlmostEqual/3D/vector/throughput", Throughput_AlmostEqual_3D_vector, 1 },
+	{ "BM_AlmostEqual/3D/vector/latency", Latency_AlmostEqual_3D_vector, 1 },
+	{ "BM_AlmostEqual/3D/swizzle/throughput", Throughput_AlmostEqual_3D_swizzle, 1 },
+	{ "BM_AlmostEqual/3D/swizzle/latency", Latency_AlmostEqual_3D_swizzle, 1 },
+	{ "BM_LessThan/3D/vector/throughput", Throughput_LessThan_3D_vector, 1 },
+	{ "BM_LessThan/3D/vector/latency", Latency_LessThan_3D_vector, 1 },
+	{ "BM_LessThan/3D/swizzle/throughput", Throughput_LessThan_3D_swizzle, 1 },
+	{ "BM_LessThan/3D/swizzle/latency", Latency_LessThan_3D_swizzle, 1 },
+	{ "BM_GreaterThan/3D/vector/throughput", Throughput_GreaterThan_3D_vector, 1 },
+	{ "BM_GreaterThan/3D/vector/latency", Latency_GreaterThan_3D_vector, 1 },
+	{ "BM_GreaterThan/3D/swizzle/throughput", Throughput_GreaterThan_3D_swizzle, 1 },
+	{ "BM_GreaterThan/3D/swizzle/latency", Latency_GreaterThan_3D_swizzle, 1 },
+	{ "BM_LessThanOrEqual/3D/vector/throughput", Throughput_LessThanOrEqual_3D_vector, 1 },
+	{ "BM_LessThanOrEqual/3D/vector/latency", Latency_LessThanOrEqual_3D_vector, 1 },
+	{ "BM_LessThanOrEqual/3D/swizzle/throughput", Throughput_LessThanOrEqual_3D_swizzle, 1 },
+	{ "BM_LessThanOrEqual/3D/swizzle/latency", Latency_LessThanOrEqual_3D_swizzle, 1 },
+	{ "BM_GreaterThanOrEqual/3D/vector/throughput", Throughput_GreaterThanOrEqual_3D_vector, 1 },
+	{ "BM_GreaterThanOrEqual/3D/vector/latency", Latency_GreaterThanOrEqual_3D_vector, 1 },
+	{ "BM_GreaterThanOrEqual/3D/swizzle/throughput", Throughput_GreaterThanOrEqual_3D_swizzle, 1 },
+	{ "BM_GreaterThanOrEqual/3D/swizzle/latency", Latency_GreaterThanOrEqual_3D_swizzle, 1 },
+	{ "BM_Select/3D/vector/throughput", Throughput_Select_3D_vector, 1 },
+	{ "BM_Select/3D/vector/latency", Latency_Select_3D_vector, 1 },
+	{ "BM_Select/3D/swizzle/throughput", Throughput_Select_3D_swizzle, 1 },
+	{ "BM_Select/3D/swizzle/latency", Latency_Select_3D_swizzle, 1 },
+	{ "BM_Normalize/3D/vector/throughput", Throughput_Normalize_3D_vector, 1 },
+	{ "BM_Normalize/3D/vector/latency", Latency_Normalize_3D_vector, 1 },
+	{ "BM_Normalize/3D/swizzle/throughput", Throughput_Normalize_3D_swizzle, 1 },
+	{ "BM_Normalize/3D/swizzle/latency", Latency_Normalize_3D_swizzle, 1 },
+	{ "BM_Length/3D/vector/throughput", Throughput_Length_3D_vector, 1 },
+	{ "BM_Length/3D/vector/latency", Latency_Length_3D_vector, 1 },
+	{ "BM_Length/3D/swizzle/throughput", Throughput_Length_3D_swizzle, 1 },
+	{ "BM_Length/3D/swizzle/latency", Latency_Length_3D_swizzle, 1 },
+	{ "BM_Dot/3D/vector/throughput", Throughput_Dot_3D_vector, 1 },
+	{ "BM_Dot/3D/vector/latency", Latency_Dot_3D_vector, 1 },
+	{ "BM_Dot/3D/swizzle/throughput", Throughput_Dot_3D_swizzle, 1 },
+	{ "BM_Dot/3D/swizzle/latency", Latency_Dot_3D_swizzle, 1 },
+	{ "BM_Cross/3D/vector/throughput", Throughput_Cross_3D_vector, 1 },
+	{ "BM_Cross/3D/vector/latency", Latency_Cross_3D_vector, 1 },
+	{ "BM_Cross/3D/swizzle/throughput", Throughput_Cross_3D_swizzle, 1 },
+	{ "BM_Cross/3D/swizzle/latency", Latency_Cross_3D_swizzle, 1 },
+	{ "BM_Project/3D/vector/throughput", Throughput_Project_3D_vector, 1 },
+	{ "BM_Project/3D/vector/latency", Latency_Project_3D_vector, 1 },
+	{ "BM_Project/3D/swizzle/throughput", Throughput_Project_3D_swizzle, 1 },
+	{ "BM_Project/3D/swizzle/latency", Latency_Project_3D_swizzle, 1 },
+	{ "BM_Rotate/3D/vector/throughput", Throughput_Rotate_3D_vector, 1 },
+	{ "BM_Rotate/3D/vector/latency", Latency_Rotate_3D_vector, 1 },
+	{ "BM_Rotate/3D/swizzle/throughput", Throughput_Rotate_3D_swizzle, 1 },
+	{ "BM_Rotate/3D/swizzle/latency", Latency_Rotate_3D_swizzle, 1 },
+	{ "BM_Lerp/3D/vector/throughput", Throughput_Lerp_3D_vector, 1 },
+	{ "BM_Lerp/3D/vector/latency", Latency_Lerp_3D_vector, 1 },
+	{ "BM_Lerp/3D/swizzle/throughput", Throughput_Lerp_3D_swizzle, 1 },
+	{ "BM_Lerp/3D/swizzle/latency", Latency_Lerp_3D_swizzle, 1 },
+	{ "BM_Max/3D/vector/throughput", Throughput_Max_3D_vector, 1 },
+	{ "BM_Max/3D/vector/latency", Latency_Max_3D_vector, 1 },
+	{ "BM_Max/3D/swizzle/throughput", Throughput_Max_3D_swizzle, 1 },
+	{ "BM_Max/3D/swizzle/latency", Latency_Max_3D_swizzle, 1 },
+	{ "BM_Min/3D/vector/throughput", Throughput_Min_3D_vector, 1 },
+	{ "BM_Min/3D/vector/latency", Latency_Min_3D_vector, 1 },
+	{ "BM_Min/3D/swizzle/throughput", Throughput_Min_3D_swizzle, 1 },
+	{ "BM_Min/3D/swizzle/latency", Latency_Min_3D_swizzle, 1 },
+	{ "BM_MaxScalar/3D/vector/throughput", Throughput_MaxScalar_3D_vector, 1 },
+	{ "BM_MaxScalar/3D/vector/latency", Latency_MaxScalar_3D_vector, 1 },
+	{ "BM_MaxScalar/3D/swizzle/throughput", Throughput_MaxScalar_3D_swizzle, 1 },
+	{ "BM_MaxScalar/3D/swizzle/latency", Latency_MaxScalar_3D_swizzle, 1 },
+	{ "BM_MinScalar/3D/vector/throughput", Throughput_MinScalar_3D_vector, 1 },
+	{ "BM_MinScalar/3D/vector/latency", Latency_MinScalar_3D_vector, 1 },
+	{ "BM_MinScalar/3D/swizzle/throughput", Throughput_MinScalar_3D_swizzle, 1 },
+	{ "BM_MinScalar/3D/swizzle/latency", Latency_MinScalar_3D_swizzle, 1 },
+	{ "BM_Ceil/3D/vector/throughput", Throughput_Ceil_3D_vector, 1 },
+	{ "BM_Ceil/3D/vector/latency", Latency_Ceil_3D_vector, 1 },
+	{ "BM_Ceil/3D/swizzle/throughput", Throughput_Ceil_3D_swizzle, 1 },
+	{ "BM_Ceil/3D/swizzle/latency", Latency_Ceil_3D_swizzle, 1 },
+	{ "BM_Floor/3D/vector/throughput", Throughput_Floor_3D_vector, 1 },
+	{ "BM_Floor/3D/vector/latency", Latency_Floor_3D_vector, 1 },
+	{ "BM_Floor/3D/swizzle/throughput", Throughput_Floor_3D_swizzle, 1 },
+	{ "BM_Floor/3D/swizzle/latency", Latency_Floor_3D_swizzle, 1 },
+	{ "BM_Clamp/3D/vector/throughput", Throughput_Clamp_3D_vector, 1 },
+	{ "BM_Clamp/3D/vector/latency", Latency_Clamp_3D_vector, 1 },
+	{ "BM_Clamp/3D/swizzle/throughput", Throughput_Clamp_3D_swizzle, 1 },
+	{ "BM_Clamp/3D/swizzle/latency", Latency_Clamp_3D_swizzle, 1 },
+	{ "BM_Exp/3D/vector/throughput", Throughput_Exp_3D_vector, 1 },
+	{ "BM_Exp/3D/vector/latency", Latency_Exp_3D_vector, 1 },
+	{ "BM_Exp/3D/swizzle/throughput", Throughput_Exp_3D_swizzle, 1 },
+	{ "BM_Exp/3D/swizzle/latency", Latency_Exp_3D_swizzle, 1 },
+	{ "BM_Sin/3D/vector/throughput", Throughput_Sin_3D_vector, 1 },
+	{ "BM_Sin/3D/vector/latency", Latency_Sin_3D_vector, 1 },
+	{ "BM_Sin/3D/swizzle/throughput", Throughput_Sin_3D_swizzle, 1 },
+	{ "BM_Sin/3D/swizzle/latency", Latency_Sin_3D_swizzle, 1 },
+	{ "BM_Atan2/3D/vector/throughput", Throughput_Atan2_3D_vector, 1 },
+	{ "BM_Atan2/3D/vector/latency", Latency_Atan2_3D_vector, 1 },
+	{ "BM_Atan2/3D/swizzle/throughput", Throughput_Atan2_3D_swizzle, 1 },
+	{ "BM_Atan2/3D/swizzle/latency", Latency_Atan2_3D_swizzle, 1 },
+	{ "BM_Distance/3D/vector/throughput", Throughput_Distance_3D_vector, 1 },
+	{ "BM_Distance/3D/vector/latency", Latency_Distance_3D_vector, 1 },
+	{ "BM_Distance/3D/swizzle/throughput", Throughput_Distance_3D_swizzle, 1 },
+	{ "BM_Distance/3D/swizzle/latency", Latency_Distance_3D_swizzle, 1 },
+	{ "BM_DistanceSquared/3D/vector/throughput", Throughput_DistanceSquared_3D_vector, 1 },
+	{ "BM_DistanceSquared/3D/vector/latency", Latency_DistanceSquared_3D_vector, 1 },
+	{ "BM_DistanceSquared/3D/swizzle/throughput", Throughput_DistanceSquared_3D_swizzle, 1 },
+	{ "BM_DistanceSquared/3D/swizzle/latency", Latency_DistanceSquared_3D_swizzle, 1 },
+	{ "BM_MatrixMultiplyVector/3D/vector/throughput", Throughput_MatrixMultiplyVector_3D_vector, 1 },
+	{ "BM_MatrixMultiplyVector/3D/vector/latency", Latency_MatrixMultiplyVector_3D_vector, 1 },
+	{ "BM_MatrixMultiplyVector/3D/swizzle/throughput", Throughput_MatrixMultiplyVector_3D_swizzle, 1 },
+	{ "BM_MatrixMultiplyVector/3D/swizzle/latency", Latency_MatrixMultiplyVector_3D_swizzle, 1 },
+	{ "BM_RotateQuaternion/3D/vector/throughput", Throughput_RotateQuaternion_3D_vector, 1 },
+	{ "BM_RotateQuaternion/3D/vector/latency", Latency_RotateQuaternion_3D_vector, 1 },
+	{ "BM_RotateQuaternion/3D/swizzle/throughput", Throughput_RotateQuaternion_3D_swizzle, 1 },
+	{ "BM_RotateQuaternion/3D/swizzle/latency", Latency_RotateQuaternion_3D_swizzle, 1 },
+	{ "BM_MatrixMultiply/3D/matrix/throughput", Throughput_MatrixMultiply_3D_matrix, 1 },
+	{ "BM_MatrixMultiply/3D/matrix/latency", Latency_MatrixMultiply_3D_matrix, 1 },
+	{ "BM_Transpose/3D/matrix/throughput", Throughput_Transpose_3D_matrix, 1 },
+	{ "BM_Transpose/3D/matrix/latency", Latency_Transpose_3D_matrix, 1 },
+	{ "BM_Determinant/3D/matrix/throughput", Throughput_Determinant_3D_matrix, 1 },
+	{ "BM_Determinant/3D/matrix/latency", Latency_Determinant_3D_matrix, 1 },
+	{ "BM_Inverse/3D/matrix/throughput", Throughput_Inverse_3D_matrix, 1 },
+	{ "BM_Inverse/3D/matrix/latency", Latency_Inverse_3D_matrix, 1 },
+	{ "BM_Transform/3D/array/throughput", Throughput_Transform_3D_array, DATA_SIZE },
+	{ "BM_RotateQuaternion/3D/array/throughput", Throughput_RotateQuaternion_3D_array, DATA_SIZE },
+	{ "BM_BatchNegate/3D/vector/throughput", Throughput_BatchNegate_3D_vector, DATA_SIZE },
+	{ "BM_BatchNegate/3D/swizzle/throughput", Throughput_BatchNegate_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchAdd/3D/vector/throughput", Throughput_BatchAdd_3D_vector, DATA_SIZE },
+	{ "BM_BatchAdd/3D/swizzle/throughput", Throughput_BatchAdd_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchSubtract/3D/vector/throughput", Throughput_BatchSubtract_3D_vector, DATA_SIZE },
+	{ "BM_BatchSubtract/3D/swizzle/throughput", Throughput_BatchSubtract_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchMultiply/3D/vector/throughput", Throughput_BatchMultiply_3D_vector, DATA_SIZE },
+	{ "BM_BatchMultiply/3D/swizzle/throughput", Throughput_BatchMultiply_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchDivide/3D/vector/throughput", Throughput_BatchDivide_3D_vector, DATA_SIZE },
+	{ "BM_BatchDivide/3D/swizzle/throughput", Throughput_BatchDivide_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchMultiplyScalar/3D/vector/throughput", Throughput_BatchMultiplyScalar_3D_vector, DATA_SIZE },
+	{ "BM_BatchMultiplyScalar/3D/swizzle/throughput", Throughput_BatchMultiplyScalar_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchDivideScalar/3D/vector/throughput", Throughput_BatchDivideScalar_3D_vector, DATA_SIZE },
+	{ "BM_BatchDivideScalar/3D/swizzle/throughput", Throughput_BatchDivideScalar_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchNormalize/3D/vector/throughput", Throughput_BatchNormalize_3D_vector, DATA_SIZE },
+	{ "BM_BatchNormalize/3D/swizzle/throughput", Throughput_BatchNormalize_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchDot/3D/vector/throughput", Throughput_BatchDot_3D_vector, DATA_SIZE },
+	{ "BM_BatchDot/3D/swizzle/throughput", Throughput_BatchDot_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchCross/3D/vector/throughput", Throughput_BatchCross_3D_vector, DATA_SIZE },
+	{ "BM_BatchCross/3D/swizzle/throughput", Throughput_BatchCross_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchProject/3D/vector/throughput", Throughput_BatchProject_3D_vector, DATA_SIZE },
+	{ "BM_BatchProject/3D/swizzle/throughput", Throughput_BatchProject_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchRotate/3D/vector/throughput", Throughput_BatchRotate_3D_vector, DATA_SIZE },
+	{ "BM_BatchRotate/3D/swizzle/throughput", Throughput_BatchRotate_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchLerp/3D/vector/throughput", Throughput_BatchLerp_3D_vector, DATA_SIZE },
+	{ "BM_BatchLerp/3D/swizzle/throughput", Throughput_BatchLerp_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchMax/3D/vector/throughput", Throughput_BatchMax_3D_vector, DATA_SIZE },
+	{ "BM_BatchMax/3D/swizzle/throughput", Throughput_BatchMax_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchMin/3D/vector/throughput", Throughput_BatchMin_3D_vector, DATA_SIZE },
+	{ "BM_BatchMin/3D/swizzle/throughput", Throughput_BatchMin_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchCeil/3D/vector/throughput", Throughput_BatchCeil_3D_vector, DATA_SIZE },
+	{ "BM_BatchCeil/3D/swizzle/throughput", Throughput_BatchCeil_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchFloor/3D/vector/throughput", Throughput_BatchFloor_3D_vector, DATA_SIZE },
+	{ "BM_BatchFloor/3D/swizzle/throughput", Throughput_BatchFloor_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchDistance/3D/vector/throughput", Throughput_BatchDistance_3D_vector, DATA_SIZE },
+	{ "BM_BatchDistance/3D/swizzle/throughput", Throughput_BatchDistance_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchDistanceSquared/3D/vector/throughput", Throughput_BatchDistanceSquared_3D_vector, DATA_SIZE },
+	{ "BM_BatchDistanceSquared/3D/swizzle/throughput", Throughput_BatchDistanceSquared_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchTransform/3D/vector/throughput", Throughput_BatchTransform_3D_vector, DATA_SIZE },
+	{ "BM_BatchTransform/3D/swizzle/throughput", Throughput_BatchTransform_3D_swizzle, DATA_SIZE },
+	{ "BM_BatchRotateQuaternion/3D/vector/throughput", Throughput_BatchRotateQuaternion_3D_vector, DATA_SIZE },
+	{ "BM_BatchRotateQuaternion/3D/swizzle/throughput", Throughput_BatchRotateQuaternion_3D_swizzle, DATA_SIZE },
+	{ "BM_ToParent/4D/vector/throughput", Throughput_ToParent_4D_vector, 1 },
+	{ "BM_ToParent/4D/vector/latency", Latency_ToParent_4D_vector, 1 },
+	{ "BM_ToParent/4D/swizzle/throughput", Throughput_ToParent_4D_swizzle, 1 },
+	{ "BM_ToParent/4D/swizzle/latency", Latency_ToParent_4D_swizzle, 1 },
+	{ "BM_ToString/4D/vector/throughput", Throughput_ToString_4D_vector, 1 },
+	{ "BM_ToString/4D/vector/latency", Latency_ToString_4D_vector, 1 },
+	{ "BM_ToString/4D/swizzle/throughput", Throughput_ToString_4D_swizzle, 1 },
+	{ "BM_ToString/4D/swizzle/latency", Latency_ToString_4D_swizzle, 1 },
+	{ "BM_ToChars/4D/vector/throughput", Throughput_ToChars_4D_vector, 1 },
+	{ "BM_ToChars/4D/vector/latency", Latency_ToChars_4D_vector, 1 },
+	{ "BM_ToChars/4D/swizzle/throughput", Throughput_ToChars_4D_swizzle, 1 },
+	{ "BM_ToChars/4D/swizzle/latency", Latency_ToChars_4D_swizzle, 1 },
+	{ "BM_Negate/4D/vector/throughput", Throughput_Negate_4D_vector, 1 },
+	{ "BM_Negate/4D/vector/latency", Latency_Negate_4D_vector, 1 },
+	{ "BM_Negate/4D/swizzle/throughput", Throughput_Negate_4D_swizzle, 1 },
+	{ "BM_Negate/4D/swizzle/latency", Latency_Negate_4D_swizzle, 1 },
+	{ "BM_Add/4D/vector/throughput", Throughput_Add_4D_vector, 1 },
+	{ "BM_Add/4D/vector/latency", Latency_Add_4D_vector, 1 },
+	{ "BM_Add/4D/swizzle/throughput", Throughput_Add_4D_swizzle, 1 },
+	{ "BM_Add/4D/swizzle/latency", Latency_Add_4D_swizzle, 1 },
+	{ "BM_Subtract/4D/vector/throughput", Throughput_Subtract_4D_vector, 1 },
+	{ "BM_Subtract/4D/vector/latency", Latency_Subtract_4D_vector, 1 },
+	{ "BM_Subtract/4D/swizzle/throughput", Throughput_Subtract_4D_swizzle, 1 },
+	{ "BM_Subtract/4D/swizzle/latency", Latency_Subtract_4D_swizzle, 1 },
+	{ "BM_Multiply/4D/vector/throughput", Throughput_Multiply_4D_vector, 1 },
+	{ "BM_Multiply/4D/vector/latency", Latency_Multiply_4D_vector, 1 },
+	{ "BM_Multiply/4D/swizzle/throughput", Throughput_Multiply_4D_swizzle, 1 },
+	{ "BM_Multiply/4D/swizzle/latency", Latency_Multiply_4D_swizzle, 1 },
+	{ "BM_Divide/4D/vector/throughput", Throughput_Divide_4D_vector, 1 },
+	{ "BM_Divide/4D/vector/latency", Latency_Divide_4D_vector, 1 },
+	{ "BM_Divide/4D/swizzle/throughput", Throughput_Divide_4D_swizzle, 1 },
+	{ "BM_Divide/4D/swizzle/latency", Latency_Divide_4D_swizzle, 1 },
+	{ "BM_MultiplyScalar/4D/vector/throughput", Throughput_MultiplyScalar_4D_vector, 1 },
+	{ "BM_MultiplyScalar/4D/vector/latency", Latency_MultiplyScalar_4D_vector, 1 },
+	{ "BM_MultiplyScalar/4D/swizzle/throughput", Throughput_MultiplyScalar_4D_swizzle, 1 },
+	{ "BM_MultiplyScalar/4D/swizzle/latency", Latency_MultiplyScalar_4D_swizzle, 1 },
+	{ "BM_MultiplyScalarLeft/4D/vector/throughput", Throughput_MultiplyScalarLeft_4D_vector, 1 },
+	{ "BM_MultiplyScalarLeft/4D/vector/latency", Latency_MultiplyScalarLeft_4D_vector, 1 },
+	{ "BM_MultiplyScalarLeft/4D/swizzle/throughput", Throughput_MultiplyScalarLeft_4D_swizzle, 1 },
+	{ "BM_MultiplyScalarLeft/4D/swizzle/latency", Latency_MultiplyScalarLeft_4D_swizzle, 1 },
+	{ "BM_DivideScalar/4D/vector/throughput", Throughput_DivideScalar_4D_vector, 1 },
+	{ "BM_DivideScalar/4D/vector/latency", Latency_DivideScalar_4D_vector, 1 },
+	{ "BM_DivideScalar/4D/swizzle/throughput", Throughput_DivideScalar_4D_swizzle, 1 },
+	{ "BM_DivideScalar/4D/swizzle/latency", Latency_DivideScalar_4D_swizzle, 1 },
+	{ "BM_DivideScalarLeft/4D/vector/throughput", Throughput_DivideScalarLeft_4D_vector, 1 },
+	{ "BM_DivideScalarLeft/4D/vector/latency", Latency_DivideScalarLeft_4D_vector, 1 },
+	{ "BM_DivideScalarLeft/4D/swizzle/throughput", Throughput_DivideScalarLeft_4D_swizzle, 1 },
+	{ "BM_DivideScalarLeft/4D/swizzle/latency", Latency_DivideScalarLeft_4D_swizzle, 1 },
+	{ "BM_EqualTo/4D/vector/throughput", Throughput_EqualTo_4D_vector, 1 },
+	{ "BM_EqualTo/4D/vector/latency", Latency_EqualTo_4D_vector, 1 },
+	{ "BM_EqualTo/4D/swizzle/throughput", Throughput_EqualTo_4D_swizzle, 1 },
+	{ "BM_EqualTo/4D/swizzle/latency", Latency_EqualTo_4D_swizzle, 1 },
+	{ "BM_NotEqualTo/4D/vector/throughput", Throughput_NotEqualTo_4D_vector, 1 },
+	{ "BM_NotEqualTo/4D/vector/latency", Latency_NotEqualTo_4D_vector, 1 },
+	{ "BM_NotEqualTo/4D/swizzle/throughput", Throughput_NotEqualTo_4D_swizzle, 1 },
+	{ "BM_NotEqualTo/4D/swizzle/latency", Latency_NotEqualTo_4D_swizzle, 1 },
+	{ "BM_AlmostEqual/4D/vector/throughput", Throughput_AlmostEqual_4D_vector, 1 },
+	{ "BM_AlmostEqual/4D/vector/latency", Latency_AlmostEqual_4D_vector, 1 },
+	{ "BM_AlmostEqual/4D/swizzle/throughput", Throughput_AlmostEqual_4D_swizzle, 1 },
+	{ "BM_AlmostEqual/4D/swizzle/latency", Latency_AlmostEqual_4D_swizzle, 1 },
+	{ "BM_LessThan/4D/vector/throughput", Throughput_LessThan_4D_vector, 1 },
+	{ "BM_LessThan/4D/vector/latency", Latency_LessThan_4D_vector, 1 },
+	{ "BM_LessThan/4D/swizzle/throughput", Throughput_LessThan_4D_swizzle, 1 },
+	{ "BM_LessThan/4D/swizzle/latency", Latency_LessThan_4D_swizzle, 1 },
+	{ "BM_GreaterThan/4D/vector/throughput", Throughput_GreaterThan_4D_vector, 1 },
+	{ "BM_GreaterThan/4D/vector/latency", Latency_GreaterThan_4D_vector, 1 },
+	{ "BM_GreaterThan/4D/swizzle/throughput", Throughput_GreaterThan_4D_swizzle, 1 },
+	{ "BM_GreaterThan/4D/swizzle/latency", Latency_GreaterThan_4D_swizzle, 1 },
+	{ "BM_LessThanOrEqual/4D/vector/throughput", Throughput_LessThanOrEqual_4D_vector, 1 },
+	{ "BM_LessThanOrEqual/4D/vector/latency", Latency_LessThanOrEqual_4D_vector, 1 },
+	{ "BM_LessThanOrEqual/4D/swizzle/throughput", Throughput_LessThanOrEqual_4D_swizzle, 1 },
+	{ "BM_LessThanOrEqual/4D/swizzle/latency", Latency_LessThanOrEqual_4D_swizzle, 1 },
+	{ "BM_GreaterThanOrEqual/4D/vector/throughput", Throughput_GreaterThanOrEqual_4D_vector, 1 },
+	{ "BM_GreaterThanOrEqual/4D/vector/latency", Latency_GreaterThanOrEqual_4D_vector, 1 },
+	{ "BM_GreaterThanOrEqual/4D/swizzle/throughput", Throughput_GreaterThanOrEqual_4D_swizzle, 1 },
+	{ "BM_GreaterThanOrEqual/4D/swizzle/latency", Latency_GreaterThanOrEqual_4D_swizzle, 1 },
+	{ "BM_Select/4D/vector/throughput", Throughput_Select_4D_vector, 1 },
+	{ "BM_Select/4D/vector/latency", Latency_Select_4D_vector, 1 },
+	{ "BM_Select/4D/swizzle/throughput", Throughput_Select_4D_swizzle, 1 },
+	{ "BM_Select/4D/swizzle/latency", Latency_Select_4D_swizzle, 1 },
+	{ "BM_Normalize/4D/vector/throughput", Throughput_Normalize_4D_vector, 1 },
+	{ "BM_Normalize/4D/vector/latency", Latency_Normalize_4D_vector, 1 },
+	{ "BM_Normalize/4D/swizzle/throughput", Throughput_Normalize_4D_swizzle, 1 },
+	{ "BM_Normalize/4D/swizzle/latency", Latency_Normalize_4D_swizzle, 1 },
+	{ "BM_Length/4D/vector/throughput", Throughput_Length_4D_vector, 1 },
+	{ "BM_Length/4D/vector/latency", Latency_Length_4D_vector, 1 },
+	{ "BM_Length/4D/swizzle/throughput", Throughput_Length_4D_swizzle, 1 },
+	{ "BM_Length/4D/swizzle/latency", Latency_Length_4D_swizzle, 1 },
+	{ "BM_Dot/4D/vector/throughput", Throughput_Dot_4D_vector, 1 },
+	{ "BM_Dot/4D/vector/latency", Latency_Dot_4D_vector, 1 },
+	{ "BM_Dot/4D/swizzle/throughput", Throughput_Dot_4D_swizzle, 1 },
+	{ "BM_Dot/4D/swizzle/latency", Latency_Dot_4D_swizzle, 1 },
+	{ "BM_Cross/4D/vector/throughput", Throughput_Cross_4D_vector, 1 },
+	{ "BM_Cross/4D/vector/latency", Latency_Cross_4D_vector, 1 },
+	{ "BM_Cross/4D/swizzle/throughput", Throughput_Cross_4D_swizzle, 1 },
+	{ "BM_Cross/4D/swizzle/latency", Latency_Cross_4D_swizzle, 1 },
+	{ "BM_Project/4D/vector/throughput", Throughput_Project_4D_vector, 1 },
+	{ "BM_Project/4D/vector/latency", Latency_Project_4D_vector, 1 },
+	{ "BM_Project/4D/swizzle/throughput", Throughput_Project_4D_swizzle, 1 },
+	{ "BM_Project/4D/swizzle/latency", Latency_Project_4D_swizzle, 1 },
+	{ "BM_Rotate/4D/vector/throughput", Throughput_Rotate_4D_vector, 1 },
+	{ "BM_Rotate/4D/vector/latency", Latency_Rotate_4D_vector, 1 },
+	{ "BM_Rotate/4D/swizzle/throughput", Throughput_Rotate_4D_swizzle, 1 },
+	{ "BM_Rotate/4D/swizzle/latency", Latency_Rotate_4D_swizzle, 1 },
+	{ "BM_Lerp/4D/vector/throughput", Throughput_Lerp_4D_vector, 1 },
+	{ "BM_Lerp/4D/vector/latency", Latency_Lerp_4D_vector, 1 },
+	{ "BM_Lerp/4D/swizzle/throughput", Throughput_Lerp_4D_swizzle, 1 },
+	{ "BM_Lerp/4D/swizzle/latency", Latency_Lerp_4D_swizzle, 1 },
+	{ "BM_Max/4D/vector/throughput", Throughput_Max_4D_vector, 1 },
+	{ "BM_Max/4D/vector/latency", Latency_Max_4D_vector, 1 },
+	{ "BM_Max/4D/swizzle/throughput", Throughput_Max_4D_swizzle, 1 },
+	{ "BM_Max/4D/swizzle/latency", Latency_Max_4D_swizzle, 1 },
+	{ "BM_Min/4D/vector/throughput", Throughput_Min_4D_vector, 1 },
+	{ "BM_Min/4D/vector/latency", Latency_Min_4D_vector, 1 },
+	{ "BM_Min/4D/swizzle/throughput", Throughput_Min_4D_swizzle, 1 },
+	{ "BM_Min/4D/swizzle/latency", Latency_Min_4D_swizzle, 1 },
+	{ "BM_MaxScalar/4D/vector/throughput", Throughput_MaxScalar_4D_vector, 1 },
+	{ "BM_MaxScalar/4D/vector/latency", Latency_MaxScalar_4D_vector, 1 },
+	{ "BM_MaxScalar/4D/swizzle/throughput", Throughput_MaxScalar_4D_swizzle, 1 },
+	{ "BM_MaxScalar/4D/swizzle/latency", Latency_MaxScalar_4D_swizzle, 1 },
+	{ "BM_MinScalar/4D/vector/throughput", Throughput_MinScalar_4D_vector, 1 },
+	{ "BM_MinScalar/4D/vector/latency", Latency_MinScalar_4D_vector, 1 },
+	{ "BM_MinScalar/4D/swizzle/throughput", Throughput_MinScalar_4D_swizzle, 1 },
+	{ "BM_MinScalar/4D/swizzle/latency", Latency_MinScalar_4D_swizzle, 1 },
+	{ "BM_Ceil/4D/vector/throughput", Throughput_Ceil_4D_vector, 1 },
+	{ "BM_Ceil/4D/vector/latency", Latency_Ceil_4D_vector, 1 },
+	{ "BM_Ceil/4D/swizzle/throughput", Throughput_Ceil_4D_swizzle, 1 },
+	{ "BM_Ceil/4D/swizzle/latency", Latency_Ceil_4D_swizzle, 1 },
+	{ "BM_Floor/4D/vector/throughput", Throughput_Floor_4D_vector, 1 },
+	{ "BM_Floor/4D/vector/latency", Latency_Floor_4D_vector, 1 },
+	{ "BM_Floor/4D/swizzle/throughput", Throughput_Floor_4D_swizzle, 1 },
+	{ "BM_Floor/4D/swizzle/latency", Latency_Floor_4D_swizzle, 1 },
+	{ "BM_Clamp/4D/vector/throughput", Throughput_Clamp_4D_vector, 1 },
+	{ "BM_Clamp/4D/vector/latency", Latency_Clamp_4D_vector, 1 },
+	{ "BM_Clamp/4D/swizzle/throughput", Throughput_Clamp_4D_swizzle, 1 },
+	{ "BM_Clamp/4D/swizzle/latency", Latency_Clamp_4D_swizzle, 1 },
+	{ "BM_Exp/4D/vector/throughput", Throughput_Exp_4D_vector, 1 },
+	{ "BM_Exp/4D/vector/latency", Latency_Exp_4D_vector, 1 },
+	{ "BM_Exp/4D/swizzle/throughput", Throughput_Exp_4D_swizzle, 1 },
+	{ "BM_Exp/4D/swizzle/latency", Latency_Exp_4D_swizzle, 1 },
+	{ "BM_Sin/4D/vector/throughput", Throughput_Sin_4D_vector, 1 },
+	{ "BM_Sin/4D/vector/latency", Latency_Sin_4D_vector, 1 },
+	{ "BM_Sin/4D/swizzle/throughput", Throughput_Sin_4D_swizzle, 1 },
+	{ "BM_Sin/4D/swizzle/latency", Latency_Sin_4D_swizzle, 1 },
+	{ "BM_Atan2/4D/vector/throughput", Throughput_Atan2_4D_vector, 1 },
+	{ "BM_Atan2/4D/vector/latency", Latency_Atan2_4D_vector, 1 },
+	{ "BM_Atan2/4D/swizzle/throughput", Throughput_Atan2_4D_swizzle, 1 },
+	{ "BM_Atan2/4D/swizzle/latency", Latency_Atan2_4D_swizzle, 1 },
+	{ "BM_Distance/4D/vector/throughput", Throughput_Distance_4D_vector, 1 },
+	{ "BM_Distance/4D/vector/latency", Latency_Distance_4D_vector, 1 },
+	{ "BM_Distance/4D/swizzle/throughput", Throughput_Distance_4D_swizzle, 1 },
+	{ "BM_Distance/4D/swizzle/latency", Latency_Distance_4D_swizzle, 1 },
+	{ "BM_DistanceSquared/4D/vector/throughput", Throughput_DistanceSquared_4D_vector, 1 },
+	{ "BM_DistanceSquared/4D/vector/latency", Latency_DistanceSquared_4D_vector, 1 },
+	{ "BM_DistanceSquared/4D/swizzle/throughput", Throughput_DistanceSquared_4D_swizzle, 1 },
+	{ "BM_DistanceSquared/4D/swizzle/latency", Latency_DistanceSquared_4D_swizzle, 1 },
+	{ "BM_MatrixMultiplyVector/4D/vector/throughput", Throughput_MatrixMultiplyVector_4D_vector, 1 },
+	{ "BM_MatrixMultiplyVector/4D/vector/latency", Latency_MatrixMultiplyVector_4D_vector, 1 },
+	{ "BM_MatrixMultiplyVector/4D/swizzle/throughput", Throughput_MatrixMultiplyVector_4D_swizzle, 1 },
+	{ "BM_MatrixMultiplyVector/4D/swizzle/latency", Latency_MatrixMultiplyVector_4D_swizzle, 1 },
+	{ "BM_RotateQuaternion/4D/vector/throughput", Throughput_RotateQuaternion_4D_vector, 1 },
+	{ "BM_RotateQuaternion/4D/vector/latency", Latency_RotateQuaternion_4D_vector, 1 },
+	{ "BM_RotateQuaternion/4D/swizzle/throughput", Throughput_RotateQuaternion_4D_swizzle, 1 },
+	{ "BM_RotateQuaternion/4D/swizzle/latency", Latency_RotateQuaternion_4D_swizzle, 1 },
+	{ "BM_MatrixMultiply/4D/matrix/throughput", Throughput_MatrixMultiply_4D_matrix, 1 },
+	{ "BM_MatrixMultiply/4D/matrix/latency", Latency_MatrixMultiply_4D_matrix, 1 },
+	{ "BM_Transpose/4D/matrix/throughput", Throughput_Transpose_4D_matrix, 1 },
+	{ "BM_Transpose/4D/matrix/latency", Latency_Transpose_4D_matrix, 1 },
+	{ "BM_Determinant/4D/matrix/throughput", Throughput_Determinant_4D_matrix, 1 },
+	{ "BM_Determinant/4D/matrix/latency", Latency_Determinant_4D_matrix, 1 },
+	{ "BM_Inverse/4D/matrix/throughput", Throughput_Inverse_4D_matrix, 1 },
+	{ "BM_Inverse/4D/matrix/latency", Latency_Inverse_4D_matrix, 1 },
+	{ "BM_Transform/4D/array/throughput", Throughput_Transform_4D_array, DATA_SIZE },
+	{ "BM_RotateQuaternion/4D/array/throughput", Throughput_RotateQuaternion_4D_array, DATA_SIZE },
+	{ "BM_BatchNegate/4D/vector/throughput", Throughput_BatchNegate_4D_vector, DATA_SIZE },
+	{ "BM_BatchNegate/4D/swizzle/throughput", Throughput_BatchNegate_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchAdd/4D/vector/throughput", Throughput_BatchAdd_4D_vector, DATA_SIZE },
+	{ "BM_BatchAdd/4D/swizzle/throughput", Throughput_BatchAdd_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchSubtract/4D/vector/throughput", Throughput_BatchSubtract_4D_vector, DATA_SIZE },
+	{ "BM_BatchSubtract/4D/swizzle/throughput", Throughput_BatchSubtract_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchMultiply/4D/vector/throughput", Throughput_BatchMultiply_4D_vector, DATA_SIZE },
+	{ "BM_BatchMultiply/4D/swizzle/throughput", Throughput_BatchMultiply_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchDivide/4D/vector/throughput", Throughput_BatchDivide_4D_vector, DATA_SIZE },
+	{ "BM_BatchDivide/4D/swizzle/throughput", Throughput_BatchDivide_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchMultiplyScalar/4D/vector/throughput", Throughput_BatchMultiplyScalar_4D_vector, DATA_SIZE },
+	{ "BM_BatchMultiplyScalar/4D/swizzle/throughput", Throughput_BatchMultiplyScalar_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchDivideScalar/4D/vector/throughput", Throughput_BatchDivideScalar_4D_vector, DATA_SIZE },
+	{ "BM_BatchDivideScalar/4D/swizzle/throughput", Throughput_BatchDivideScalar_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchNormalize/4D/vector/throughput", Throughput_BatchNormalize_4D_vector, DATA_SIZE },
+	{ "BM_BatchNormalize/4D/swizzle/throughput", Throughput_BatchNormalize_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchDot/4D/vector/throughput", Throughput_BatchDot_4D_vector, DATA_SIZE },
+	{ "BM_BatchDot/4D/swizzle/throughput", Throughput_BatchDot_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchCross/4D/vector/throughput", Throughput_BatchCross_4D_vector, DATA_SIZE },
+	{ "BM_BatchCross/4D/swizzle/throughput", Throughput_BatchCross_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchProject/4D/vector/throughput", Throughput_BatchProject_4D_vector, DATA_SIZE },
+	{ "BM_BatchProject/4D/swizzle/throughput", Throughput_BatchProject_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchRotate/4D/vector/throughput", Throughput_BatchRotate_4D_vector, DATA_SIZE },
+	{ "BM_BatchRotate/4D/swizzle/throughput", Throughput_BatchRotate_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchLerp/4D/vector/throughput", Throughput_BatchLerp_4D_vector, DATA_SIZE },
+	{ "BM_BatchLerp/4D/swizzle/throughput", Throughput_BatchLerp_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchMax/4D/vector/throughput", Throughput_BatchMax_4D_vector, DATA_SIZE },
+	{ "BM_BatchMax/4D/swizzle/throughput", Throughput_BatchMax_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchMin/4D/vector/throughput", Throughput_BatchMin_4D_vector, DATA_SIZE },
+	{ "BM_BatchMin/4D/swizzle/throughput", Throughput_BatchMin_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchCeil/4D/vector/throughput", Throughput_BatchCeil_4D_vector, DATA_SIZE },
+	{ "BM_BatchCeil/4D/swizzle/throughput", Throughput_BatchCeil_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchFloor/4D/vector/throughput", Throughput_BatchFloor_4D_vector, DATA_SIZE },
+	{ "BM_BatchFloor/4D/swizzle/throughput", Throughput_BatchFloor_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchDistance/4D/vector/throughput", Throughput_BatchDistance_4D_vector, DATA_SIZE },
+	{ "BM_BatchDistance/4D/swizzle/throughput", Throughput_BatchDistance_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchDistanceSquared/4D/vector/throughput", Throughput_BatchDistanceSquared_4D_vector, DATA_SIZE },
+	{ "BM_BatchDistanceSquared/4D/swizzle/throughput", Throughput_BatchDistanceSquared_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchTransform/4D/vector/throughput", Throughput_BatchTransform_4D_vector, DATA_SIZE },
+	{ "BM_BatchTransform/4D/swizzle/throughput", Throughput_BatchTransform_4D_swizzle, DATA_SIZE },
+	{ "BM_BatchRotateQuaternion/4D/vector/throughput", Throughput_BatchRotateQuaternion_4D_vector, DATA_SIZE },
+	{ "BM_BatchRotateQuaternion/4D/swizzle/throughput", Throughput_BatchRotateQuaternion_4D_swizzle, DATA_SIZE },
+	{ "BM_QuaternionMultiply/quaternion/throughput", Throughput_QuaternionMultiply_quaternion, 1 },
+	{ "BM_QuaternionMultiply/quaternion/latency", Latency_QuaternionMultiply_quaternion, 1 },
+	{ "BM_Nlerp/quaternion/throughput", Throughput_Nlerp_quaternion, 1 },
+	{ "BM_Nlerp/quaternion/latency", Latency_Nlerp_quaternion, 1 },
+	{ "BM_Slerp/quaternion/throughput", Throughput_Slerp_quaternion, 1 },
+	{ "BM_Slerp/quaternion/latency", Latency_Slerp_quaternion, 1 },
+	{ "BM_ToMatrix/quaternion/throughput", Throughput_ToMatrix_quaternion, 1 },
+	{ "BM_Fit/2D/throughput", Throughput_Fit_2D, DATA_SIZE },
+	{ "BM_BatchFit/2D/throughput", Throughput_BatchFit_2D, DATA_SIZE },
+	{ "BM_IntersectRay/2D/throughput", Throughput_IntersectRay_2D, 1 },
+	{ "BM_IntersectRayPacket4/2D/throughput", Throughput_IntersectRayPacket4_2D, 4 },
+	{ "BM_IntersectRayPacket8/2D/throughput", Throughput_IntersectRayPacket8_2D, 8 },
+	{ "BM_Fit/3D/throughput", Throughput_Fit_3D, DATA_SIZE },
+	{ "BM_BatchFit/3D/throughput", Throughput_BatchFit_3D, DATA_SIZE },
+	{ "BM_IntersectRay/3D/throughput", Throughput_IntersectRay_3D, 1 },
+	{ "BM_IntersectRayPacket4/3D/throughput", Throughput_IntersectRayPacket4_3D, 4 },
+	{ "BM_IntersectRayPacket8/3D/throughput", Throughput_IntersectRayPacket8_3D, 8 },
+	{ "BM_Sum/2D/throughput", Throughput_Sum_2D, DATA_SIZE },
+	{ "BM_Centroid/2D/throughput", Throughput_Centroid_2D, DATA_SIZE },
+	{ "BM_Covariance/2D/throughput", Throughput_Covariance_2D, DATA_SIZE },
+	{ "BM_Sum/3D/throughput", Throughput_Sum_3D, DATA_SIZE },
+	{ "BM_Centroid/3D/throughput", Throughput_Centroid_3D, DATA_SIZE },
+	{ "BM_Covariance/3D/throughput", Throughput_Covariance_3D, DATA_SIZE },
+	{ "BM_Sum/4D/throughput", Throughput_Sum_4D, DATA_SIZE },
+	{ "BM_Centroid/4D/throughput", Throughput_Centroid_4D, DATA_SIZE }
+};
+
+int main(int argc, char* argv[])
+{
+	double minTime = 0.1;
+	string filter = "";
+	
+	for (int i = 1; i < argc; i++)
+	{
+		string argument = argv[i];
+		
+		if (argument.find("--benchmark_min_time=") == 0)
+		{
+			minTime = atof(argument.substr(21).c_str());
+		}
+		else if (argument.find("--benchmark_filter=") == 0)
+		{
+			filter = argument.substr(19);
+		}
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--benchmark_min_time=<seconds>] [--benchmark_filter=<substring>]" << std::endl;
+			return 1;
+		}
+	}
+	
+	SetUp();
+	
+	char date[32];
+	time_t now = time(0);
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+	
+	cout << "{\n";
+	cout << "  \"context\": {\n";
+	cout << "    \"date\": \"" << date << "\",\n";
+	cout << "    \"executable\": \"" << argv[0] << "\",\n";
+#ifdef NDEBUG
+	cout << "    \"library_build_type\": \"release\",\n";
+#else
+	cout << "    \"library_build_type\": \"debug\",\n";
+#endif
+	cout << "    \"svml_precision\": " << SVML_PRECISION << ",\n";
+#ifdef SVML_USE_SSE
+	cout << "    \"svml_use_sse\": true\n";
+#else
+	cout << "    \"svml_use_sse\": false\n";
+#endif
+	cout << "  },\n";
+	cout << "  \"benchmarks\": [";
+	
+	bool first = true;
+	for (unsigned b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++)
+	{
+		if (string(benchmarks[b].name).find(filter) == string::npos)
+		{
+			continue;
+		}
+		
+		// Grow the iteration count until one run takes at least minTime
+		double iterations = 1;
+		double wall = 0;
+		double cpu = 0;
+		while (true)
+		{
+			double wallStart = WallSeconds();
+			double cpuStart = CpuSeconds();
+			benchmarks[b].function((unsigned)iterations);
+			wall = WallSeconds() - wallStart;
+			cpu = CpuSeconds() - cpuStart;
+			
+			if (wall >= minTime || iterations >= 1e9)
+			{
+				break;
+			}
+			
+			double multiplier = (wall > minTime / 100) ? (minTime * 1.4 / wall) : 10;
+			iterations = (multiplier > 10) ? iterations * 10 : (double)(unsigned)(iterations * multiplier + 1);
+		}
+		
+		cout << (first ? "\n" : ",\n");
+		first = false;
+		cout << "    {\n";
+		cout << "      \"name\": \"" << benchmarks[b].name << "\",\n";
+		cout << "      \"run_name\": \"" << benchmarks[b].name << "\",\n";
+		cout << "      \"run_type\": \"iteration\",\n";
+		cout << "      \"repetitions\": 1,\n";
+		cout << "      \"repetition_index\": 0,\n";
+		cout << "      \"threads\": 1,\n";
+		cout << "      \"iterations\": " << (unsigned)iterations << ",\n";
+		cout << "      \"real_time\": " << wall * 1e9 / iterations << ",\n";
+		cout << "      \"cpu_time\": " << cpu * 1e9 / iterations << ",\n";
+		cout << "      \"time_unit\": \"ns\",\n";
+		cout << "      \"items_per_second\": " << ((wall > 0) ? iterations * benchmarks[b].itemsPerIteration / wall : 0) << "\n";
+		cout << "    }";
+	}
+	cout << "\n  ]\n";
+	cout << "}\n";
+	
+	return 0;
+}
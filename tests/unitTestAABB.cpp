@@ -0,0 +1,128 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::aabb2;
+	using SVML::aabb3;
+	using SVML::vec3_soa;
+	using SVML::AABB3;
+	using SVML::AABB2_PACKET;
+	using SVML::AABB3_PACKET;
+	using SVML::VECTOR3;
+
+	//////////////////////////////////
+	//
+	// Construction and queries
+	//
+	//////////////////////////////////
+
+	aabb3 box(vec3(-1, -2, -3), vec3(1, 2, 3));
+	PerformTest("Center() Size() SurfaceArea() Volume()", "3D", "functionality", Center(box) == vec3(0, 0, 0) && Size(box) == vec3(2, 4, 6) && SurfaceArea(box) == 88 && Volume(box) == 48);
+	PerformTest("Area()", "2D", "functionality", Area(aabb2(vec2(1, 1), vec2(3, 4))) == 6);
+
+	PerformTest("Empty() IsEmpty()", "2D 3D", "functionality", IsEmpty(aabb3::Empty()) && IsEmpty(aabb2::Empty()) && !IsEmpty(box) && !IsEmpty(aabb3(vec3(1, 1, 1))));
+
+	PerformTest("Contains()", "3D", "points and boxes", Contains(box, vec3(1, 2, 3)) && !Contains(box, vec3(0, 0, 3.5f)) && Contains(box, vec3(3, 2, 1).zyx) && Contains(box, aabb3(vec3(0, 0, 0), vec3(1, 1, 1))) && !Contains(box, aabb3(vec3(0, 0, 0), vec3(2, 1, 1))));
+
+	PerformTest("ToString()", "3D", "functionality", ToString(aabb3(vec3(1, 2, 3), vec3(4, 5, 6))) == "((1, 2, 3), (4, 5, 6))");
+
+	//////////////////////////////////
+	//
+	// Union and intersection
+	//
+	//////////////////////////////////
+
+	aabb3 other(vec3(0, 1, 2), vec3(5, 5, 5));
+	PerformTest("Union()", "3D", "boxes and points", Union(box, other) == aabb3(vec3(-1, -2, -3), vec3(5, 5, 5)) && Union(aabb3::Empty(), box) == box && Union(box, vec3(0, 9, 0)) == aabb3(vec3(-1, -2, -3), vec3(1, 9, 3)));
+	PerformTest("Intersection() Overlaps()", "3D", "functionality", Intersection(box, other) == aabb3(vec3(0, 1, 2), vec3(1, 2, 3)) && Overlaps(box, other) && !Overlaps(box, aabb3(vec3(2, 0, 0), vec3(3, 1, 1))) && IsEmpty(Intersection(box, aabb3(vec3(2, 0, 0), vec3(3, 1, 1)))));
+
+	//////////////////////////////////
+	//
+	// Fit
+	//
+	//////////////////////////////////
+
+	// An odd count covers the remainder of the paired loops, and more than SOA_LANES covers the lane blocks
+	const unsigned count = 37;
+	vec3 points[count];
+	vec2 flat[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		points[i] = vec3((float)(i % 7) - 3, (float)(i * i % 11), -(float)i);
+		flat[i] = points[i].xy;
+	}
+	aabb3 fitted = Fit(points, count);
+	PerformTest("Fit()", "3D", "array", fitted == aabb3(vec3(-3, 0, -36), vec3(3, 9, 0)));
+	PerformTest("Fit()", "2D", "array", Fit(flat, count) == aabb2(vec2(-3, 0), vec2(3, 9)) && Fit(flat, 1) == aabb2(flat[0]) && IsEmpty(Fit(flat, 0)));
+
+	vec3_soa batch(points, count);
+	PerformTest("Fit()", "3D", "batch matches array", Fit(batch) == fitted && Fit(batch.zyx) == aabb3(fitted.minimum.zyx, fitted.maximum.zyx));
+
+	VECTOR3<int> integers[2] = { VECTOR3<int>(1, -5, 3), VECTOR3<int>(-2, 4, 0) };
+	PerformTest("Fit() Empty()", "3D int", "component type", Fit(integers, 2) == AABB3<int>(VECTOR3<int>(-2, -5, 0), VECTOR3<int>(1, 4, 3)) && IsEmpty(AABB3<int>::Empty()));
+
+	//////////////////////////////////
+	//
+	// Ray intersection
+	//
+	//////////////////////////////////
+
+	float distance = -1;
+	vec3 origin(-5, 0, 0);
+	vec3 inverseDirection = 1.0f / vec3(1, 0, 0);
+	PerformTest("IntersectRay()", "3D", "axis-parallel ray", IntersectRay(box, origin, inverseDirection, 100.0f, distance) && distance == 4);
+	PerformTest("IntersectRay()", "3D", "misses, too short, origin inside", !IntersectRay(box, vec3(-5, 3, 0), inverseDirection, 100.0f, distance) && !IntersectRay(box, origin, inverseDirection, 3.0f, distance) && IntersectRay(box, vec3(0, 0, 0), inverseDirection, 100.0f, distance) && distance == 0);
+
+	// A box the ray passes exactly through the edge of still counts
+	PerformTest("IntersectRay()", "3D", "diagonal", IntersectRay(box, vec3(-2, -3, -4), 1.0f / vec3(1, 1, 1), 100.0f, distance) && distance == 1 && !IntersectRay(box, vec3(-2, 3, 0), 1.0f / vec3(1, 1, 0), 100.0f, distance));
+
+	// Eight boxes along x: every other one is offset in y, so the ray hits the even ones
+	AABB3_PACKET<float, 8> packet;
+	AABB2_PACKET<float, 8> packet2;
+	for (unsigned i = 0; i < 8; i++)
+	{
+		aabb3 slot(vec3((float)i * 3, (float)(i % 2) * 5 - 1, -1), vec3((float)i * 3 + 1, (float)(i % 2) * 5 + 1, 1));
+		packet.Set(i, slot);
+		packet2.Set(i, aabb2(slot.minimum.xy, slot.maximum.xy));
+	}
+	float distances[8];
+	float distances2[8];
+	unsigned hits = IntersectRay(packet, origin, inverseDirection, 100.0f, distances);
+	unsigned hits2 = IntersectRay(packet2, vec2(origin.xy), vec2(inverseDirection.xy), 100.0f, distances2);
+	bool sameAsSingle = true;
+	for (unsigned i = 0; i < 8; i++)
+	{
+		float single = -1;
+		bool hit = IntersectRay(packet.Get(i), origin, inverseDirection, 100.0f, single);
+		sameAsSingle = sameAsSingle && (hit == (((hits >> i) & 1) != 0)) && (!hit || (single == distances[i] && single == distances2[i]));
+	}
+	PerformTest("IntersectRay()", "3D packet", "hit mask", hits == 0x55 && sameAsSingle && distances[2] == 11);
+	PerformTest("IntersectRay()", "2D packet", "hit mask", hits2 == 0x55);
+
+	AABB3_PACKET<float, 4> unused;
+	unused.Set(1, box);
+	PerformTest("IntersectRay()", "3D packet", "empty slots never hit", IntersectRay(unused, origin, inverseDirection, 100.0f, distances) == 0x2 && unused.Get(1) == box);
+
+	return 0;
+}
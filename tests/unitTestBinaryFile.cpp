@@ -0,0 +1,217 @@
+#include <iostream>
+#include <vector>
+#include <stdio.h>
+
+#define SVML_USE_FILES
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Deterministic pseudo-random coordinates in [-range, range)
+float Coordinate(unsigned& state, const float& range)
+{
+	state = state * 1664525u + 1013904223u;
+	return ((float)(state >> 8) / 16777216.0f * 2.0f - 1.0f) * range;
+}
+
+// Writes vectors in blocks of 300 (so some calls split across the writer's own blocks)
+template <typename VECTOR> bool WriteFile(const char* path, const vector<VECTOR>& vectors, const unsigned& layout, const unsigned& kind)
+{
+	SVML::VECTOR_FILE_WRITER<VECTOR> writer(path, layout, kind, vectors.size());
+	for (size_t first = 0; first < vectors.size(); first += 300)
+	{
+		if (!writer.Write(&vectors[first], std::min((size_t)300, vectors.size() - first)))
+		{
+			return false;
+		}
+	}
+	return writer.Count() == vectors.size() && writer.Close();
+}
+
+template <typename VECTOR> bool ReadsBack(SVML::VECTOR_FILE& file, const vector<VECTOR>& vectors)
+{
+	vector<VECTOR> read(vectors.size());
+	return file.Count() == vectors.size() && file.Read(&read[0], 0, read.size()) && read == vectors;
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::HALF;
+	using SVML::BFLOAT16;
+	using SVML::VECTOR_FILE;
+	using SVML::VECTOR_FILE_WRITER;
+
+	const char* path = "unitTestBinaryFile.tmp";
+	unsigned state = 12345;
+
+	vector<vec3> points3;
+	vector<vec4> points4;
+	vector< SVML::VECTOR4<double> > wide4;
+	vector< SVML::VECTOR2<int> > cells2;
+	for (unsigned i = 0; i < 1000; i++)
+	{
+		float x = Coordinate(state, 50.0f), y = Coordinate(state, 50.0f), z = Coordinate(state, 50.0f);
+		points3.push_back(vec3(x, y, z));
+		points4.push_back(vec4(x, y, z, (float)i));
+		wide4.push_back(SVML::VECTOR4<double>(x / 3.0, y / 7.0, z, -(double)i));
+		cells2.push_back(SVML::VECTOR2<int>((int)(x * 1000.0f), -(int)i));
+	}
+
+	//////////////////////////////////
+	//
+	// Array of structures
+	//
+	//////////////////////////////////
+
+	bool written = WriteFile(path, points3, SVML::VECTOR_FILE_AOS, SVML::VECTOR_FILE_NATIVE);
+	VECTOR_FILE file(path);
+	vec3* mapped = file.Vectors<vec3>();
+	bool same = mapped != 0 && file.Count() == 1000;
+	for (unsigned i = 0; i < 1000 && same; i++)
+	{
+		same = mapped[i] == points3[i];
+	}
+	PerformTest("VECTOR_FILE_WRITER VECTOR_FILE Vectors()", "3D", "zero-copy round trip", written && same && file.Dimension() == 3 && file.Kind() == SVML::VECTOR_FILE_FLOAT32 &&
+	                                                                                     file.Stride() == sizeof(vec3) && file.NativeByteOrder() && (size_t)mapped % 64 == 0);
+
+	// Changes through the mapping are private
+	mapped[5] = vec3(0.0f, 0.0f, 0.0f);
+	file.Open(path);
+	PerformTest("VECTOR_FILE Vectors()", "3D", "private mapping", file.Vectors<vec3>()[5] == points3[5] && ReadsBack(file, points3));
+
+	vec3 one[2];
+	PerformTest("VECTOR_FILE Vectors() Read()", "2D 3D 4D", "refuses other types and ranges", file.Vectors< SVML::VECTOR3<double> >() == 0 && file.Vectors<vec4>() == 0 &&
+	                                                                                       !file.Read((vec2*)one, 0, 1) && !file.Read(one, 999, 2) && file.Read(one, 998, 2) && one[1] == points3[999]);
+
+	PerformTest("VECTOR_FILE_WRITER VECTOR_FILE Read()", "2D 4D", "double and int round trip", WriteFile(path, wide4, SVML::VECTOR_FILE_AOS, SVML::VECTOR_FILE_NATIVE) && file.Open(path) && ReadsBack(file, wide4) &&
+	                                                                                          WriteFile(path, cells2, SVML::VECTOR_FILE_AOS, SVML::VECTOR_FILE_NATIVE) && file.Open(path) && ReadsBack(file, cells2));
+
+	//////////////////////////////////
+	//
+	// Structure of arrays
+	//
+	//////////////////////////////////
+
+	written = WriteFile(path, points3, SVML::VECTOR_FILE_SOA, SVML::VECTOR_FILE_NATIVE);
+	file.Open(path);
+	SVML::VECTOR3_SOA_VIEW<float> view = file.View3<float>();
+	same = view.count == 1000 && (size_t)view.x % 64 == 0 && (size_t)view.y % 64 == 0 && (size_t)view.z % 64 == 0;
+	for (unsigned i = 0; i < 1000 && same; i++)
+	{
+		same = view.Get(i) == points3[i];
+	}
+	PerformTest("VECTOR_FILE_WRITER VECTOR_FILE View3()", "3D", "zero-copy round trip", written && same && file.Layout() == SVML::VECTOR_FILE_SOA && file.Vectors<vec3>() == 0 && ReadsBack(file, points3));
+	PerformTest("VECTOR_FILE View4() Components()", "3D 4D", "refuses other types", file.View4<float>().count == 0 && file.View4<float>().x == 0 && file.Components<double>(0) == 0 && file.Components<float>(3) == 0);
+
+	VECTOR_FILE_WRITER<vec4>* soa = new VECTOR_FILE_WRITER<vec4>(path, SVML::VECTOR_FILE_SOA, SVML::VECTOR_FILE_NATIVE, 10);
+	bool refused = soa->Write(&points4[0], 6) && !soa->Write(&points4[0], 5) && soa->Write(&points4[0], 3) && !soa->Close();
+	delete soa;
+	PerformTest("VECTOR_FILE_WRITER Write() Close()", "4D", "holds SOA files to their count", refused && !file.Open(path));
+
+	//////////////////////////////////
+	//
+	// Half-precision storage
+	//
+	//////////////////////////////////
+
+	vector<vec3> halved3;
+	vector<vec4> bfloats4;
+	for (unsigned i = 0; i < 1000; i++)
+	{
+		halved3.push_back(vec3((float)HALF(points3[i].Component(0)), (float)HALF(points3[i].Component(1)), (float)HALF(points3[i].Component(2))));
+		bfloats4.push_back(vec4((float)BFLOAT16(points4[i].Component(0)), (float)BFLOAT16(points4[i].Component(1)), (float)BFLOAT16(points4[i].Component(2)), (float)BFLOAT16(points4[i].Component(3))));
+	}
+	PerformTest("VECTOR_FILE_WRITER VECTOR_FILE Read()", "3D", "half AOS", WriteFile(path, points3, SVML::VECTOR_FILE_AOS, SVML::VECTOR_FILE_FLOAT16) && file.Open(path) &&
+	                                                                       file.Kind() == SVML::VECTOR_FILE_FLOAT16 && file.Stride() == 6 && file.Vectors<vec3>() == 0 && ReadsBack(file, halved3));
+	PerformTest("VECTOR_FILE_WRITER VECTOR_FILE Read()", "4D", "bfloat16 SOA", WriteFile(path, points4, SVML::VECTOR_FILE_SOA, SVML::VECTOR_FILE_BFLOAT16) && file.Open(path) && ReadsBack(file, bfloats4) &&
+	                                                                           file.Components<BFLOAT16>(3)[7].bits == BFLOAT16(7.0f).bits);
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+	// Zero-copy half vectors, widened in bulk
+	WriteFile(path, points3, SVML::VECTOR_FILE_AOS, SVML::VECTOR_FILE_FLOAT16);
+	file.Open(path);
+	vector<vec3> widened(1000);
+	bool halves = file.Vectors<SVML::f16vec3>() != 0;
+	if (halves)
+	{
+		SVML::Convert(&widened[0], file.Vectors<SVML::f16vec3>(), 1000);
+	}
+	vector<SVML::fxvec2> fixed2;
+	for (unsigned i = 0; i < 1000; i++)
+	{
+		fixed2.push_back(SVML::fxvec2(SVML::FIXED(points3[i].Component(0)), SVML::FIXED::FromRaw(-(int)i)));
+	}
+	vector<vec2> fromFixed(1000);
+	bool fixedRead = WriteFile(path, fixed2, SVML::VECTOR_FILE_SOA, SVML::VECTOR_FILE_NATIVE) && file.Open(path) && file.Read(&fromFixed[0], 0, 1000) &&
+	                 file.View2<SVML::FIXED>().x[9].raw == fixed2[9].Component(0).raw && fromFixed[3] == vec2(fixed2[3].Component(0).ToFloat(), fixed2[3].Component(1).ToFloat());
+	PerformTest("VECTOR_FILE Vectors() Read()", "2D 3D", "half and fixed vectors", halves && widened == halved3 && fixedRead);
+#endif
+
+	//////////////////////////////////
+	//
+	// Other byte order and bad files
+	//
+	//////////////////////////////////
+
+	// The file a machine of the other byte order would write
+	WriteFile(path, points4, SVML::VECTOR_FILE_AOS, SVML::VECTOR_FILE_NATIVE);
+	SVML::VECTOR_FILE_HEADER header;
+	FILE* out = fopen(path, "r+b");
+	fread(&header, sizeof(header), 1, out);
+	header.version = SVML::VectorFileSwap(header.version);
+	header.byteOrder = SVML::VectorFileSwap(header.byteOrder);
+	header.count = SVML::VectorFileSwap(header.count);
+	vector<float> components(4000);
+	fread(&components[0], sizeof(float), 4000, out);
+	for (unsigned i = 0; i < 4000; i++)
+	{
+		components[i] = SVML::VectorFileSwap(components[i]);
+	}
+	fseek(out, 0, SEEK_SET);
+	fwrite(&header, sizeof(header), 1, out);
+	fwrite(&components[0], sizeof(float), 4000, out);
+	fclose(out);
+	PerformTest("VECTOR_FILE Read()", "4D", "other byte order", file.Open(path) && !file.NativeByteOrder() && file.Vectors<vec4>() == 0 && ReadsBack(file, points4));
+
+	// Missing, truncated and not vector files
+	WriteFile(path, points4, SVML::VECTOR_FILE_AOS, SVML::VECTOR_FILE_NATIVE);
+	out = fopen(path, "r+b");
+	fwrite("NOT", 1, 3, out);
+	fclose(out);
+	bool bad = !file.Open(path) && !file.IsOpen() && file.Count() == 0;
+	WriteFile(path, vector<vec4>(points4.begin(), points4.begin() + 10), SVML::VECTOR_FILE_AOS, SVML::VECTOR_FILE_NATIVE);
+	bool complete = file.Open(path);
+	out = fopen(path, "ab");
+	fwrite(&points4[0], 1, 1, out);
+	fclose(out);
+	out = fopen(path, "r+b");
+	fread(&header, sizeof(header), 1, out);
+	header.count = 11;
+	fseek(out, 0, SEEK_SET);
+	fwrite(&header, sizeof(header), 1, out);
+	fclose(out);
+	PerformTest("VECTOR_FILE Open()", "4D", "refuses missing, truncated and other files", bad && complete && !file.Open(path) && !file.Open("unitTestBinaryFile.missing"));
+
+	remove(path);
+
+	return 0;
+}
@@ -0,0 +1,153 @@
+#define SVML_USE_THREADS
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::quat;
+	using SVML::aabb3;
+	using SVML::Bulk::SPAN;
+	using SVML::Bulk::WORK_POOL;
+
+	// Not a multiple of any grain used below, so every run has a short last chunk
+	const size_t count = 10007;
+	std::vector<vec3> points(count);
+	std::vector<vec3> others(count);
+	std::vector<vec2> flat(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		points[i] = vec3((float)(i % 97) * 0.37f - 11, (float)(i % 13) + 0.25f, 1.0f / (float)(i + 1) - (float)(i % 5));
+		others[i] = vec3((float)(i % 7) + 1, -(float)(i % 3), (float)(i % 11) * 0.5f + 0.5f);
+		flat[i] = points[i].xy;
+	}
+	SPAN<const vec3> a(&points[0], count);
+	SPAN<const vec3> b(&others[0], count);
+	std::vector<vec3> result(count);
+	SPAN<vec3> out(&result[0], count);
+
+	WORK_POOL one(1);
+	WORK_POOL three(3);
+	WORK_POOL eight(8);
+
+	// Inlined into a different loop the compiler may contract or reorder differently (FMA), so element-wise results are compared with a tolerance
+	const float tolerance = 0.001f;
+
+	//////////////////////////////////
+	//
+	// Element-wise operations match the scalar functions
+	//
+	//////////////////////////////////
+
+	SVML::Bulk::Normalize(out, a, 64, three);
+	bool same = true;
+	for (size_t i = 0; i < count; i++) { same = same && Distance(result[i], Normalize(points[i])) < tolerance; }
+	PerformTest("Normalize()", "3D", "matches serial", same);
+
+	SVML::Bulk::Cross(out, a, b, 100, eight);
+	same = true;
+	for (size_t i = 0; i < count; i++) { same = same && Distance(result[i], Cross(points[i], others[i])) < tolerance; }
+	PerformTest("Cross()", "3D", "matches serial", same);
+
+	std::vector<float> dots(count);
+	SVML::Bulk::Dot(SPAN<float>(&dots[0], count), a, b, 1000, three);
+	same = true;
+	for (size_t i = 0; i < count; i++) { same = same && fabs(dots[i] - Dot(points[i], others[i])) < tolerance; }
+	PerformTest("Dot()", "3D", "scalar output", same);
+
+	// The output may be one of the inputs
+	result = points;
+	SVML::Bulk::Multiply(out, out, 2.0f, 1, eight);
+	SVML::Bulk::Add(out, out, b, 333, three);
+	same = true;
+	for (size_t i = 0; i < count; i++) { same = same && Distance(result[i], points[i] * 2.0f + others[i]) < tolerance; }
+	PerformTest("Multiply() Add()", "3D", "in place", same);
+
+	quat rotation(vec3(0, 0, 1), 0.5f);
+	SVML::Bulk::Rotate(out, a, rotation, 500, eight);
+	same = true;
+	for (size_t i = 0; i < count; i++) { same = same && Distance(result[i], Rotate(points[i], rotation)) < tolerance; }
+	std::vector<vec2> flatResult(count);
+	SVML::Bulk::Rotate(SPAN<vec2>(&flatResult[0], count), SPAN<const vec2>(&flat[0], count), 0.5f);
+	for (size_t i = 0; i < count; i++) { same = same && Distance(flatResult[i], Rotate(flat[i], 0.5f)) < tolerance; }
+	std::vector<float> angles(count);
+	for (size_t i = 0; i < count; i++) { angles[i] = (float)i * 0.001f; }
+	SVML::Bulk::Rotate(SPAN<vec2>(&flatResult[0], count), SPAN<const vec2>(&flat[0], count), &angles[0], 500, eight);
+	for (size_t i = 0; i < count; i++) { same = same && Distance(flatResult[i], Rotate(flat[i], angles[i])) < tolerance * (1.0f + Distance(flat[i], vec2(0, 0))); }
+	PerformTest("Rotate()", "2D 3D", "matches serial", same);
+
+	//////////////////////////////////
+	//
+	// Reductions are identical whatever the thread count
+	//
+	//////////////////////////////////
+
+	vec3 sum = SVML::Bulk::Sum(a, 256, one);
+	PerformTest("Sum()", "3D", "same with 1, 3 and 8 threads", sum == SVML::Bulk::Sum(a, 256, three) && sum == SVML::Bulk::Sum(a, 256, eight));
+	PerformTest("Centroid()", "3D", "same with 1, 3 and 8 threads", SVML::Bulk::Centroid(a, 256, one) == SVML::Bulk::Centroid(a, 256, eight) && SVML::Bulk::Centroid(a, 256, three) == sum / (float)count);
+
+	// Blocks of REDUCTION_BLOCK points, combined pairwise: the grain does not change the result either
+	PerformTest("Sum() Centroid()", "3D", "same as serial for any grain", sum == SVML::Sum(&points[0], (unsigned)count) && SVML::Bulk::Sum(a, 1, eight) == sum && SVML::Bulk::Sum(a, 100000, three) == sum && SVML::Bulk::Centroid(a) == SVML::Centroid(&points[0], (unsigned)count));
+	SVML::mat3 covariance = SVML::Covariance(&points[0], (unsigned)count);
+	PerformTest("Covariance()", "3D", "same as serial for any grain and thread count", SVML::Bulk::Covariance(a, 256, one) == covariance && SVML::Bulk::Covariance(a, 1, eight) == covariance && SVML::Bulk::Covariance(a, 5000, three) == covariance);
+
+	aabb3 fitted = Fit(&points[0], (unsigned)count);
+	PerformTest("Fit()", "3D", "matches serial", SVML::Bulk::Fit(a, 100, one) == fitted && SVML::Bulk::Fit(a, 100, eight) == fitted && SVML::Bulk::Fit(a) == fitted);
+
+	PerformTest("Sum() Centroid() Fit()", "3D", "empty span", SVML::Bulk::Sum(SPAN<const vec3>()) == vec3(0, 0, 0) && SVML::Bulk::Centroid(SPAN<const vec3>()) == vec3(0, 0, 0) && IsEmpty(SVML::Bulk::Fit(SPAN<const vec3>())));
+
+	//////////////////////////////////
+	//
+	// Generic ForEach, Transform, Reduce and ParallelFor
+	//
+	//////////////////////////////////
+
+	std::vector<vec4> colors(count, vec4(0.5f, 0.25f, 1, 1));
+	SVML::Bulk::ForEach(SPAN<vec4>(&colors[0], count), [](vec4& color) { color.rgb *= 2.0f; }, 128, three);
+	SVML::Bulk::Transform(out, SPAN<const vec4>(&colors[0], count), [](const vec4& color) { return vec3(color.bgr); }, 128, eight);
+	same = true;
+	for (size_t i = 0; i < count; i++) { same = same && colors[i] == vec4(1, 0.5f, 2, 1) && result[i] == vec3(2, 0.5f, 1); }
+	PerformTest("ForEach() Transform()", "4D", "functionality", same);
+
+	float longest = SVML::Bulk::Reduce(a, 0.0f, [](float sofar, const vec3& point) { return std::max(sofar, (float)point.Length); }, [](float lhs, float rhs) { return std::max(lhs, rhs); }, 64, eight);
+	float expected = 0;
+	for (size_t i = 0; i < count; i++) { expected = std::max(expected, (float)points[i].Length); }
+	PerformTest("Reduce()", "3D", "functionality", longest == expected);
+
+	// A ParallelFor inside a running job runs on the calling worker instead of deadlocking
+	std::vector<unsigned> visits(count, 0);
+	SVML::Bulk::ParallelFor(16, [&](size_t begin, size_t end)
+	{
+		for (size_t job = begin; job < end; job++)
+		{
+			SVML::Bulk::ParallelFor(count, [&](size_t first, size_t last) { for (size_t i = first; i < last; i++) { if (i % 16 == job) { visits[i]++; } } }, 1000, three);
+		}
+	}, 1, three);
+	same = true;
+	for (size_t i = 0; i < count; i++) { same = same && visits[i] == 1; }
+	PerformTest("ParallelFor()", "", "nested", same && three.Threads() == 3 && SVML::Bulk::DefaultPool().Threads() >= 1);
+
+	return 0;
+}
@@ -0,0 +1,151 @@
+#include <iostream>
+#include <limits>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Relative error of each component against a double-precision result, or absolute error where that result is within
+// [-1, 1] (so values near zero are not judged by the last bits)
+double WorstError(const SVML::vec4& result, const double expected[4])
+{
+	double worst = 0;
+	for (unsigned d = 0; d < 4; d++)
+	{
+		double error = fabs((double)result.Component(d) - expected[d]) / ((fabs(expected[d]) > 1) ? fabs(expected[d]) : 1);
+		worst = std::max(worst, error);
+	}
+	return worst;
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+
+	//////////////////////////////////
+	//
+	// Common functions
+	//
+	//////////////////////////////////
+
+	vec3 a(-2.5f, 0.0f, 1.75f);
+	vec4 b(-0.25f, 3.5f, -7.0f, 0.5f);
+	PerformTest("Abs() Sign()", "2D 3D 4D", "functionality", Abs(a) == vec3(2.5f, 0.0f, 1.75f) && Sign(a) == vec3(-1.0f, 0.0f, 1.0f) && Abs(b.wzyx) == vec4(0.5f, 7.0f, 3.5f, 0.25f) &&
+	                                                       Sign(vec2(-0.0f, 1e-30f)) == vec2(0.0f, 1.0f) && Sign(b) == vec4(-1.0f, 1.0f, -1.0f, 1.0f));
+	PerformTest("Clamp() Saturate()", "2D 3D 4D", "functionality", Clamp(a, -1.0f, 1.0f) == vec3(-1.0f, 0.0f, 1.0f) && Clamp(b, vec4(0, 0, -8, 1), vec4(1, 2, -6, 2)) == vec4(0.0f, 2.0f, -7.0f, 1.0f) &&
+	                                                             Saturate(b) == vec4(0.0f, 1.0f, 0.0f, 0.5f) && Clamp(a.zyx, a, a.zzz) == vec3(1.75f, 0.0f, 1.75f) && Saturate(vec2(2.0f, 0.25f)) == vec2(1.0f, 0.25f));
+	PerformTest("Step() SmoothStep()", "2D 3D 4D", "functionality", Step(0.0f, a) == vec3(0.0f, 1.0f, 1.0f) && Step(a.zzz, a) == vec3(0.0f, 0.0f, 1.0f) && SmoothStep(0.0f, 1.0f, b) == vec4(0.0f, 1.0f, 0.0f, 0.5f) &&
+	                                                              SmoothStep(vec2(0.0f, 1.0f), vec2(4.0f, 3.0f), vec2(1.0f, 2.5f)) == vec2(0.15625f, 0.84375f) && SmoothStep(-1.0f, 1.0f, a.xyz) == vec3(0.0f, 0.5f, 1.0f));
+	PerformTest("Fract() Mod()", "2D 3D 4D", "functionality", Fract(a) == vec3(0.5f, 0.0f, 0.75f) && Mod(b, 2.0f) == vec4(1.75f, 1.5f, 1.0f, 0.5f) && Mod(b, vec4(1, -2, 3, -4)) == vec4(0.75f, -0.5f, 2.0f, -3.5f) &&
+	                                                        Mod(a.xz, vec2(2.0f, 0.5f)) == vec2(1.5f, 0.25f) && Fract(vec2(-1e10f, 1e10f)) == vec2(0.0f, 0.0f));
+
+	SVML::VECTOR3<int> cells(-3, 0, 7);
+	PerformTest("Abs() Sign() Clamp() Step()", "3D", "int", Abs(cells) == SVML::VECTOR3<int>(3, 0, 7) && Sign(cells) == SVML::VECTOR3<int>(-1, 0, 1) && Clamp(cells, 0, 5) == SVML::VECTOR3<int>(0, 0, 5) &&
+	                                                      Step(1, cells.zyx) == SVML::VECTOR3<int>(1, 0, 0));
+
+	//////////////////////////////////
+	//
+	// Exponentials, logarithms and trigonometry: within the error bounds of the SSE versions (the <math.h> ones used
+	// without SVML_USE_SSE are more accurate)
+	//
+	//////////////////////////////////
+
+	double exponential = 0, logarithm = 0, power = 0, trigonometry = 0, arcTangent = 0;
+	for (int i = -2000; i < 2000; i++)
+	{
+		float t = (float)i * 0.04317f;
+		vec4 x(t, t * 0.5f + 0.1f, -t * 0.25f, t * 0.01f);
+		vec4 positive = Abs(x) * 3.7f + vec4(1e-30f, 0.001f, 1.0f, 0.5f);
+		double expected[4];
+
+		for (unsigned d = 0; d < 4; d++) { expected[d] = exp((double)x.Component(d)); }
+		exponential = std::max(exponential, WorstError(Exp(x), expected));
+		for (unsigned d = 0; d < 4; d++) { expected[d] = pow(2.0, (double)x.Component(d)); }
+		exponential = std::max(exponential, WorstError(Exp2(x), expected));
+		for (unsigned d = 0; d < 4; d++) { expected[d] = log((double)positive.Component(d)); }
+		logarithm = std::max(logarithm, WorstError(Log(positive), expected));
+		for (unsigned d = 0; d < 4; d++) { expected[d] = log((double)positive.Component(d)) / log(2.0); }
+		logarithm = std::max(logarithm, WorstError(Log2(positive), expected));
+		vec4 exponents(x.Component(1) * 0.1f, 2.0f, -1.5f, x.Component(0) * 0.05f);
+		vec4 powers = Pow(positive, exponents);
+		for (unsigned d = 0; d < 4; d++)
+		{
+			double expectedPower = pow((double)positive.Component(d), (double)exponents.Component(d));
+			double scale = 1 + fabs((double)exponents.Component(d) * log((double)positive.Component(d)) / log(2.0)); // The bound grows with |y log2(x)|
+			power = std::max(power, fabs(powers.Component(d) - expectedPower) / (expectedPower * scale));
+		}
+		vec3 angles(x.Component(0), x.Component(1) * 20.0f, x.Component(2) * 100.0f);
+		vec3 sine, cosine;
+		SinCos(angles, sine, cosine);
+		for (unsigned d = 0; d < 3; d++)
+		{
+			trigonometry = std::max(trigonometry, std::max(fabs(sine.Component(d) - sin((double)angles.Component(d))), fabs(cosine.Component(d) - cos((double)angles.Component(d)))));
+		}
+		trigonometry = (sine == Sin(angles) && cosine == Cos(angles)) ? trigonometry : 1;
+		for (unsigned d = 0; d < 4; d++) { expected[d] = atan2((double)x.Component(d), (double)x.Component(3 - d)); }
+		arcTangent = std::max(arcTangent, WorstError(Atan2(x, x.wzyx), expected));
+	}
+	PerformTest("Exp() Exp2()", "4D", "accuracy", exponential < 1.5e-7);
+	PerformTest("Log() Log2()", "4D", "accuracy", logarithm < 1e-7);
+	PerformTest("Pow()", "4D", "accuracy", power < 1.5e-7);
+	PerformTest("SinCos() Sin() Cos()", "3D", "accuracy and agreement", trigonometry < 2e-7);
+	PerformTest("Atan2()", "4D", "accuracy", arcTangent < 3e-7);
+
+	vec4 tangent = Tan(vec4(0.5f, -1.2f, 3.0f, 100.0f));
+	PerformTest("Tan()", "4D", "accuracy", fabs(tangent.Component(0) - tan(0.5)) < 4e-7 * tan(0.5) && fabs(tangent.Component(1) - tan(-1.2f)) < 4e-7 * fabs(tan(-1.2f)) &&
+	                                      fabs(tangent.Component(3) - tan(100.0)) < 4e-7 * fabs(tan(100.0)) && Tan(vec2(0.5f, 0.0f)) == vec2(tan(0.5f), 0.0f));
+
+	// Exact where the result is
+	PerformTest("Exp2() Log2() Pow() Sqrt()", "3D 4D", "exact results", Exp2(vec4(0, 10, -3, 127)) == vec4(1.0f, 1024.0f, 0.125f, 1.7014118e38f) && Log2(vec4(1, 1024, 0.125f, 1e-45f)) == vec4(0.0f, 10.0f, -3.0f, -149.0f) &&
+	                                                                     Pow(vec3(2.0f, -2.0f, 16.0f), vec3(10.0f, 3.0f, 0.5f)) == vec3(1024.0f, -8.0f, 4.0f) && Sqrt(a.zzz * a.zzz) == a.zzz &&
+	                                                                     InverseSqrt(vec3(4.0f, 16.0f, 0.25f)).Component(2) > 1.999f);
+
+	float infinity = std::numeric_limits<float>::infinity();
+	vec4 logs = Log(vec4(0.0f, -1.0f, infinity, 1.0f));
+	vec4 exps = Exp(vec4(-200.0f, 200.0f, -infinity, 0.0f));
+	vec4 powers = Pow(vec4(-2.0f, 0.0f, 1.0f, -8.0f), vec4(0.5f, -1.0f, infinity, 0.0f));
+	vec4 arcs = Atan2(vec4(0.0f, -0.0f, 1.0f, infinity), vec4(-1.0f, 0.0f, 0.0f, infinity));
+	PerformTest("Log() Exp() Pow() Atan2()", "4D", "special values", logs.Component(0) == -infinity && logs.Component(1) != logs.Component(1) && logs.Component(2) == infinity && logs.Component(3) == 0 &&
+	                                                                 exps == vec4(0.0f, infinity, 0.0f, 1.0f) && powers.Component(0) != powers.Component(0) && powers.Component(1) == infinity &&
+	                                                                 powers.Component(2) == 1 && powers.Component(3) == 1 && fabs(arcs.Component(0) - 3.14159265f) < 1e-6f && arcs.Component(1) == 0 &&
+	                                                                 fabs(arcs.Component(2) - 1.57079633f) < 1e-6f && fabs(arcs.Component(3) - 0.78539816f) < 1e-6f);
+
+	// pow() gives 1 for -1 to either infinity, and negative infinity to a fraction isn't NaN
+	vec4 infinitePowers = Pow(vec4(-1.0f, -1.0f, -infinity, -infinity), vec4(infinity, -infinity, 0.5f, 3.0f));
+	PerformTest("Pow()", "3D 4D", "infinities", infinitePowers == vec4(1.0f, 1.0f, infinity, -infinity) && Pow(vec3(-1.0f, -infinity, -1.0f), vec3(-infinity, -0.5f, 3.0f)) == vec3(1.0f, 0.0f, -1.0f) &&
+	                                            Pow(vec4(-1.0f, 1.0f, -3.0f, -infinity), -infinity) == vec4(1.0f, 1.0f, 0.0f, 0.0f));
+
+	// Swizzles, and the sine written over the angles
+	vec3 angles(0.5f, 1.0f, 2.0f);
+	vec3 cosine;
+	SinCos(angles.zyx, angles, cosine);
+	PerformTest("Exp() Pow() Atan2() SinCos() (swizzle)", "3D", "functionality", Exp(a.zyx) == Exp(vec3(a.zyx)) && Pow(a.zzz, a.xxx) == Pow(vec3(a.zzz), vec3(a.xxx)) && Pow(b.xy, 2.0f) == Pow(vec2(b.xy), 2.0f) &&
+	                                                                            Atan2(a.yyy, a) == Atan2(vec3(a.yyy), a) && angles == Sin(vec3(2.0f, 1.0f, 0.5f)) && cosine == Cos(vec3(2.0f, 1.0f, 0.5f)));
+
+	PerformTest("Exp() Log() Atan2()", "2D 3D", "double", AlmostEqual(Exp(SVML::VECTOR3<double>(1, 0, -1)), SVML::VECTOR3<double>(exp(1.0), 1, exp(-1.0))) &&
+	                                                     Log(SVML::VECTOR2<double>(1, exp(2.0))) == SVML::VECTOR2<double>(0, 2) && Atan2(SVML::VECTOR2<double>(1, -1), SVML::VECTOR2<double>(1, 0)) == SVML::VECTOR2<double>(atan2(1.0, 1.0), atan2(-1.0, 0.0)));
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+	SVML::f16vec3 half(SVML::HALF(4.0f), SVML::HALF(-2.0f), SVML::HALF(0.25f));
+	PerformTest("Sqrt() Abs() Log2()", "3D", "half", Sqrt(Abs(half)) == SVML::f16vec3(SVML::HALF(2.0f), SVML::HALF(1.4140625f), SVML::HALF(0.5f)) && Log2(Abs(half)) == SVML::f16vec3(SVML::HALF(2.0f), SVML::HALF(1.0f), SVML::HALF(-2.0f)));
+#endif
+
+	return 0;
+}
@@ -0,0 +1,108 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::VECTOR3;
+	using SVML::VECTOR4;
+
+	typedef VECTOR3<double> dvec3;
+	typedef VECTOR4<double> dvec4;
+	typedef VECTOR3<int> ivec3;
+	typedef VECTOR4<int> ivec4;
+
+	//////////////////////////////////
+	//
+	// Scalars follow the component type
+	//
+	//////////////////////////////////
+
+	// None of these survive a round trip through float
+	dvec3 position(6378137.1, 0.1, -0.3);
+	dvec3 step(0.0, 0.001, 0.0);
+	PerformTest("* / (scalar)", "3D double", "no narrowing", position * 0.1 == dvec3(6378137.1 * 0.1, 0.1 * 0.1, -0.3 * 0.1) && 0.1 / position == dvec3(0.1 / 6378137.1, 0.1 / 0.1, 0.1 / -0.3));
+	PerformTest("Dot() Distance() Length", "3D double", "double results", sizeof(Dot(position, step)) == sizeof(double) && Dot(position, step) == 0.1 * 0.001 &&
+	                                                                    fabs(Distance(position, position + step) - 0.001) < 1e-9 && (double)step.Length == 0.001);
+
+	ivec3 large(16777217, -3, 7);
+	PerformTest("* / (scalar)", "3D int", "integer arithmetic", large * 1 == large && large / 2 == ivec3(8388608, -1, 3) && 3 * large == ivec3(50331651, -9, 21) &&
+	                                                                AlmostEqual(large, large) && !AlmostEqual(large, large + ivec3(0, 0, 1)));
+	PerformTest("Dot() DistanceSquared()", "3D int", "integer results", sizeof(Dot(large, large)) == sizeof(int) && Dot(ivec3(16777217, 1, 0), ivec3(1, 1, 5)) == 16777218 && DistanceSquared(ivec3(1, 2, 3), ivec3(4, 6, 3)) == 25);
+	PerformTest("Lerp() Rotate()", "2D 3D int", "float deltas and angles", Lerp(SVML::VECTOR2<int>(0, 0), SVML::VECTOR2<int>(10, 10), 0.5) == SVML::VECTOR2<int>(5, 5) &&
+	                                                                         Rotate(SVML::VECTOR2<int>(10, 0), 1.5707963f) == SVML::VECTOR2<int>(0, 10) && Rotate(ivec3(10, 0, 0), ivec3(0, 0, 1), 1.5707963f) == ivec3(0, 10, 0));
+
+	//////////////////////////////////
+	//
+	// Packed overloads must match the generic templates exactly
+	// (explicit template arguments select the generic path; build with
+	// SVML_USE_SSE and -mavx / -msse4.1 to test the packed ones)
+	//
+	//////////////////////////////////
+
+	dvec4 a(1.5, -2.25, 3.1, 0.75);
+	dvec4 b(-0.5, 4.3, 2.0, 2.5);
+
+	PerformTest("+ - * /", "4D double", "matches template", (a + b == SVML::operator+<double>(a, b)) &&
+	                                                       (a - b == SVML::operator-<double>(a, b)) &&
+	                                                       (a * b == SVML::operator*<double>(a, b)) &&
+	                                                       (a / b == SVML::operator/<double>(a, b)) &&
+	                                                       (a * 3.3 == SVML::operator*<double>(a, 3.3)) &&
+	                                                       (3.3 / a == SVML::operator/<double>(3.3, a)));
+
+	dvec4 compound = a;
+	compound += b;
+	compound *= 0.3;
+	compound /= b;
+	PerformTest("+= *= /= -", "4D double", "functionality", compound == ((a + b) * 0.3) / b && -a == dvec4(-1.5, 2.25, -3.1, 0.75));
+
+	PerformTest("Dot() Distance() DistanceSquared()", "4D double", "matches template", Dot(a, b) == SVML::Dot<double>(a, b) &&
+	                                                                                  Distance(a, b) == SVML::Distance<double>(a, b) &&
+	                                                                                  DistanceSquared(a, b) == SVML::DistanceSquared<double>(a, b));
+
+	PerformTest("Normalize() Project() Lerp()", "4D double", "matches template", Normalize(a) == SVML::Normalize<double>(a) &&
+	                                                                            Project(a, b) == SVML::Project<double>(a, b) &&
+	                                                                            Lerp(a, b, 0.3) == SVML::Lerp<double>(a, b, 0.3));
+
+	PerformTest("Min() Max() Floor() Ceil()", "4D double", "matches template", Min(a, b) == SVML::Min<double>(a, b) && Max(a, 1.0) == SVML::Max<double>(a, 1.0) &&
+	                                                                          Floor(a) == SVML::Floor<double>(a) && Ceil(a) == SVML::Ceil<double>(a));
+
+	ivec3 c(7, -3, 12);
+	ivec3 d(-2, 5, 4);
+	ivec4 e(7, -3, 12, 9);
+	ivec4 f(-2, 5, 4, -6);
+
+	PerformTest("+ - * (scalar)", "3D 4D int", "matches template", (c + d == SVML::operator+<int>(c, d)) && (c - d == SVML::operator-<int>(c, d)) &&
+	                                                              (e * f == SVML::operator*<int>(e, f)) && (e * 5 == SVML::operator*<int>(e, 5)) && (5 * c == SVML::operator*<int>(5, c)));
+
+	ivec4 integerCompound = e;
+	integerCompound -= f;
+	integerCompound *= 2;
+	PerformTest("-= *= / -", "3D 4D int", "functionality", integerCompound == ivec4(18, -16, 16, 30) && e / f == ivec4(-3, 0, 3, -1) && -c == ivec3(-7, 3, -12) && -e == ivec4(-7, 3, -12, 9));
+
+	PerformTest("Dot() Cross() DistanceSquared()", "3D 4D int", "matches template", Dot(e, f) == SVML::Dot<int>(e, f) && Cross(c, d) == SVML::Cross<int>(c, d) &&
+	                                                                               Cross(e, f) == SVML::Cross<int>(e, f) && DistanceSquared(c, d) == SVML::DistanceSquared<int>(c, d));
+
+	PerformTest("Min() Max() Lerp()", "3D 4D int", "matches template", Min(c, d) == SVML::Min<int>(c, d) && Max(3, e) == SVML::Max<int>(3, e) && Lerp(c, d, 0.25f) == SVML::Lerp<int>(c, d, 0.25f));
+
+	PerformTest("constructors", "4D int", "from 3D and 2D", ivec4(c, 1) == ivec4(7, -3, 12, 1) && ivec4(SVML::VECTOR2<int>(1, 2), SVML::VECTOR2<int>(3, 4)) == ivec4(1, 2, 3, 4) && ivec3(c.zx, 8) == ivec3(12, 7, 8));
+
+	return 0;
+}
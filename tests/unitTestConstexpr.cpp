@@ -0,0 +1,108 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Everything here is evaluated by the compiler from C++14 on (the same checks run at runtime before that)
+#ifdef SVML_HAS_CONSTEXPR
+#define CONSTANT constexpr
+#define CHECK_AT_COMPILE_TIME(test) static_assert(test, #test)
+#else
+#define CONSTANT const
+#define CHECK_AT_COMPILE_TIME(test)
+#endif
+
+// Integer components keep the checks exact, and short ones are never packed when SVML_USE_SSE is defined
+typedef SVML::VECTOR2<short> ivec2;
+typedef SVML::VECTOR3<short> ivec3;
+typedef SVML::VECTOR4<short> ivec4;
+
+// A constant table, built without any code running at startup
+CONSTANT ivec3 directions[] = { ivec3(1, 0, 0), ivec3(0, 1, 0), ivec3(0, 0, 1) };
+
+int main (int argc, char * const argv[])
+{
+	using SVML::DegToRad;
+	using SVML::RadToDeg;
+
+	//////////////////////////////////
+	//
+	// Construction and component access
+	//
+	//////////////////////////////////
+
+	CONSTANT ivec2 xy(1, 2);
+	CONSTANT ivec4 built(xy, ivec2(3, 4));
+	CONSTANT ivec4 fromThree(ivec3(xy, 3), 4);
+	CHECK_AT_COMPILE_TIME(built.Component(0) == 1 && built.Component(3) == 4);
+	CHECK_AT_COMPILE_TIME(fromThree == built);
+	PerformTest("constructors Component()", "2D 3D 4D", "constant", built.Component(2) == 3 && fromThree == built && built.x == 1);
+
+	//////////////////////////////////
+	//
+	// Arithmetic and comparisons
+	//
+	//////////////////////////////////
+
+	CONSTANT ivec3 a(1, 2, 3);
+	CONSTANT ivec3 b(4, 5, 6);
+	CONSTANT ivec3 sum = a + b;
+	CONSTANT ivec3 mixed = -(a * 2 - b / ivec3(2, 5, 3)) * 3;
+	CHECK_AT_COMPILE_TIME(sum == ivec3(5, 7, 9));
+	CHECK_AT_COMPILE_TIME(mixed == ivec3(0, -9, -12));
+	PerformTest("+ - * / negation", "3D", "constant", sum == ivec3(5, 7, 9) && mixed == ivec3(0, -9, -12));
+
+	CHECK_AT_COMPILE_TIME(a < b && b > a && a <= a && b >= a && a != b && ivec3(1, 2, 4) > a && !(ivec3(1, 2, 4) < a));
+	PerformTest("== != < > <= >=", "3D", "constant", a < b && ivec3(1, 2, 4) > a && a <= a);
+
+	CHECK_AT_COMPILE_TIME(LessThan(a, ivec3(3, 2, 1)) == SVML::bvec3(true, false, false) && All(GreaterThanEqual(b, a)) && !Any(Equal(a, b)));
+	CHECK_AT_COMPILE_TIME(Select(LessThan(a, ivec3(3, 2, 1)), a, b) == ivec3(1, 5, 6) && Select(SVML::bvec4(false, true, true, false), ivec4(1, 2, 3, 4), ivec4(0, 0, 0, 0)) == ivec4(0, 2, 3, 0));
+	PerformTest("LessThan() Select()", "3D 4D", "constant", Select(LessThan(a, ivec3(3, 2, 1)), a, b) == ivec3(1, 5, 6) && All(GreaterThanEqual(b, a)));
+
+	//////////////////////////////////
+	//
+	// Functions
+	//
+	//////////////////////////////////
+
+	CHECK_AT_COMPILE_TIME(Dot(a, b) == 32);
+	CHECK_AT_COMPILE_TIME(Dot(ivec4(1, 2, 3, 100), ivec4(4, 5, 6, 100)) == 32);
+	CHECK_AT_COMPILE_TIME(Cross(directions[0], directions[1]) == directions[2]);
+	CHECK_AT_COMPILE_TIME(Cross(ivec4(1, 0, 0, 7), ivec4(0, 1, 0, 0)) == ivec4(0, 0, 1, 7));
+	PerformTest("Dot() Cross()", "3D 4D", "constant", Dot(a, b) == 32 && Cross(directions[0], directions[1]) == directions[2]);
+
+	CHECK_AT_COMPILE_TIME(Lerp(ivec2(0, 10), ivec2(10, 20), 0.5f) == ivec2(5, 15));
+	CHECK_AT_COMPILE_TIME(Max(a, ivec3(3, 2, 1)) == ivec3(3, 2, 3) && Min(a, ivec3(3, 2, 1)) == ivec3(1, 2, 1));
+	CHECK_AT_COMPILE_TIME(Max(a, 2) == ivec3(2, 2, 3) && Min(2, a) == ivec3(1, 2, 2));
+	PerformTest("Lerp() Max() Min()", "2D 3D", "constant", Lerp(ivec2(0, 10), ivec2(10, 20), 0.5f) == ivec2(5, 15) && Max(a, ivec3(3, 2, 1)) == ivec3(3, 2, 3));
+
+	CONSTANT float quarterTurn = DegToRad(90.0f);
+	CHECK_AT_COMPILE_TIME(quarterTurn > 1.5707f && quarterTurn < 1.5709f && RadToDeg(quarterTurn) > 89.999f && RadToDeg(quarterTurn) < 90.001f);
+	PerformTest("DegToRad() RadToDeg()", "Scalar", "constant", fabs(RadToDeg(quarterTurn) - 90.0f) < 0.001f);
+
+#ifndef SVML_USE_SSE
+	// Without SSE storage float vectors are constant as well
+	CONSTANT SVML::vec3 up(0.0f, 1.0f, 0.0f);
+	CONSTANT SVML::vec3 right = Cross(up, SVML::vec3(0.0f, 0.0f, 1.0f));
+	CHECK_AT_COMPILE_TIME(right == SVML::vec3(1.0f, 0.0f, 0.0f) && Dot(right, up) == 0.0f);
+	PerformTest("Cross() Dot()", "3D float", "constant", right == SVML::vec3(1.0f, 0.0f, 0.0f));
+#endif
+
+	return 0;
+}
@@ -0,0 +1,53 @@
+// Build this one with -std=c++98: it checks that every header still compiles, and the vectors still work, without C++11
+#if __cplusplus >= 201103L
+#error "unitTestCpp98.cpp checks the C++98 build; compile it with -std=c++98"
+#endif
+
+#include <iostream>
+
+#include "svml.h"
+#include "svml_io.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+	const bool classComponents = true;
+#else
+	const bool classComponents = false;
+#endif
+	PerformTest("SVML_HAS_CLASS_COMPONENTS", "", "not defined before C++11", !classComponents);
+
+	vec3 a(3, 0, 4);
+	vec4 b(a, 1);
+	b.xy += vec2(1, 1);
+	PerformTest("Normalize() Dot() Length", "2D 3D 4D", "float vectors", Normalize(a) == vec3(0.6f, 0, 0.8f) && Dot(a, a) == 25 && (float)a.Length == 5 && Normalize(b) == vec4(Normalize(b.xyz), 1) &&
+	                                                                      Normalize(vec2(0, 2)) == vec2(0, 1));
+
+	a.Normalize();
+	PerformTest("Normalize()", "3D", "member", a == vec3(0.6f, 0, 0.8f));
+
+	PerformTest("ToString()", "3D", "svml_io.h", ToString(vec3(1, 2, 3)) == "(1, 2, 3)");
+
+	return 0;
+}
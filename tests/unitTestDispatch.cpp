@@ -0,0 +1,161 @@
+#define SVML_USE_THREADS
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+#ifdef SVML_HAS_DISPATCH
+const char* isaNames[] = { "SSE2", "AVX2", "AVX-512" };
+
+// With FMA available (-mfma, -march=native) the compiler may contract the per-vector functions, which the kernels never
+// are, so the two can differ in the last bits unless this file is built with -ffp-contract=off
+#ifdef __FMA__
+inline bool SameResult(const float& result, const float& expected) { return fabs(result - expected) <= 1e-4f * (1 + fabs(expected)); }
+inline bool SameResult(const SVML::vec2& result, const SVML::vec2& expected) { return SameResult(result.x, expected.x) && SameResult(result.y, expected.y); }
+inline bool SameResult(const SVML::vec3& result, const SVML::vec3& expected) { return SameResult(result.xy, expected.xy) && SameResult(result.z, expected.z); }
+inline bool SameResult(const SVML::vec4& result, const SVML::vec4& expected) { return SameResult(result.xyz, expected.xyz) && SameResult(result.w, expected.w); }
+#else
+template <typename TYPE> bool SameResult(const TYPE& result, const TYPE& expected) { return result == expected; }
+#endif
+
+// Every float bulk kernel against the per-vector functions, bit for bit without contraction
+template <typename VECTOR> bool MatchesPerVector(const std::vector<VECTOR>& points, const std::vector<VECTOR>& others, SVML::Bulk::WORK_POOL& pool)
+{
+	using SVML::Bulk::SPAN;
+
+	size_t count = points.size();
+	SPAN<const VECTOR> a(&points[0], count);
+	SPAN<const VECTOR> b(&others[0], count);
+	std::vector<VECTOR> result(count);
+	SPAN<VECTOR> out(&result[0], count);
+	std::vector<float> scalars(count);
+	SPAN<float> scalarOut(&scalars[0], count);
+
+	bool same = true;
+	SVML::Bulk::Normalize(out, a, 1000, pool);
+	for (size_t i = 0; i < count; i++) { same = same && SameResult(result[i], Normalize(points[i])); }
+	SVML::Bulk::Dot(scalarOut, a, b, 1000, pool);
+	for (size_t i = 0; i < count; i++) { same = same && SameResult(scalars[i], Dot(points[i], others[i])); }
+	SVML::Bulk::Distance(scalarOut, a, b, 1000, pool);
+	for (size_t i = 0; i < count; i++) { same = same && SameResult(scalars[i], Distance(points[i], others[i])); }
+	SVML::Bulk::DistanceSquared(scalarOut, a, b, 1000, pool);
+	for (size_t i = 0; i < count; i++) { same = same && SameResult(scalars[i], DistanceSquared(points[i], others[i])); }
+	return same;
+}
+#endif
+
+int main (int argc, char * const argv[])
+{
+#ifdef SVML_HAS_DISPATCH
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::quat;
+	using SVML::rot2;
+	using SVML::Bulk::SPAN;
+	using SVML::Bulk::WORK_POOL;
+	using SVML::Bulk::ISA;
+
+	// Read on first use, so it has to be set before any bulk call
+#ifdef _WIN32
+	_putenv_s("SVML_BULK_ISA", "sse2");
+#else
+	setenv("SVML_BULK_ISA", "sse2", 1);
+#endif
+
+	// Not a multiple of any register width, so every chunk ends with vectors left over
+	const size_t count = 10007;
+	std::vector<vec2> flat(count), flatOthers(count);
+	std::vector<vec3> points(count), others(count);
+	std::vector<vec4> colors(count), colorOthers(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		points[i] = vec3((float)(i % 97) * 0.37f - 11, (float)(i % 13) + 0.25f, 1.0f / (float)(i + 1) - (float)(i % 5));
+		others[i] = vec3((float)(i % 7) + 1, -(float)(i % 3), (float)(i % 11) * 0.5f + 0.5f);
+		flat[i] = points[i].xy;
+		flatOthers[i] = others[i].zx;
+		colors[i] = vec4(points[i], (float)i);
+		colorOthers[i] = vec4(others[i], -(float)i);
+	}
+
+	WORK_POOL three(3);
+
+	//////////////////////////////////
+	//
+	// Choosing the instruction set
+	//
+	//////////////////////////////////
+
+	ISA supported = SVML::Bulk::SupportedIsa();
+	PerformTest("ActiveIsa()", "", "SVML_BULK_ISA caps the choice", SVML::Bulk::ActiveIsa() == SVML::Bulk::ISA_SSE2);
+	PerformTest("SelectIsa()", "", "no higher than supported", SVML::Bulk::SelectIsa(SVML::Bulk::ISA_AVX512) == supported && SVML::Bulk::ActiveIsa() == supported &&
+	                                                          SVML::Bulk::SelectIsa(SVML::Bulk::ISA_SSE2) == SVML::Bulk::ISA_SSE2);
+
+	//////////////////////////////////
+	//
+	// Every instruction set gives the bits of the per-vector functions
+	//
+	//////////////////////////////////
+
+	quat rotation(vec3(0.3f, -1.0f, 0.5f), 0.7f);
+	SVML::mat3 matrix = ToMatrix(rotation);
+	rot2 turn(0.5f);
+	for (int isa = SVML::Bulk::ISA_SSE2; isa <= supported; isa++)
+	{
+		SVML::Bulk::SelectIsa((ISA)isa);
+		string name = isaNames[isa];
+		PerformTest("Normalize() Dot() Distance() DistanceSquared()", "2D 3D 4D", name, MatchesPerVector(flat, flatOthers, three) && MatchesPerVector(points, others, three) &&
+		                                                                                MatchesPerVector(colors, colorOthers, three));
+
+		// The serial batch Rotate() is Transform() by ToMatrix(), which the kernels follow
+		std::vector<vec3> rotated(count), expected(count);
+		SVML::Bulk::Rotate(SPAN<vec3>(&rotated[0], count), SPAN<const vec3>(&points[0], count), rotation, 1000, three);
+		SVML::Rotate(&expected[0], &points[0], rotation, (unsigned)count);
+		bool same = true;
+		for (size_t i = 0; i < count; i++) { same = same && SameResult(rotated[i], expected[i]); }
+		SVML::Bulk::Transform(SPAN<vec3>(&rotated[0], count), matrix, SPAN<const vec3>(&points[0], count), 1000, three);
+		for (size_t i = 0; i < count; i++) { same = same && SameResult(rotated[i], expected[i]); }
+		std::vector<vec4> rotatedColors(colors);
+		SVML::Bulk::Rotate(SPAN<vec4>(&rotatedColors[0], count), SPAN<const vec4>(&rotatedColors[0], count), rotation, 1000, three);
+		for (size_t i = 0; i < count; i++) { same = same && SameResult(rotatedColors[i], vec4(expected[i], colors[i].w)); }
+		std::vector<vec2> turned(count);
+		SVML::Bulk::Rotate(SPAN<vec2>(&turned[0], count), SPAN<const vec2>(&flat[0], count), turn, 1000, three);
+		for (size_t i = 0; i < count; i++) { same = same && SameResult(turned[i], Rotate(flat[i], turn)); }
+		PerformTest("Rotate() Transform()", "2D 3D 4D", name + ", in place too", same);
+	}
+
+	// Vectors left over at the end of a chunk, and spans shorter than a register
+	std::vector<vec3> normals(count, vec3(0, 0, 0));
+	bool same = true;
+	for (size_t length = 0; length < 40; length++)
+	{
+		SVML::Bulk::SelectIsa((ISA)(length % (supported + 1)));
+		SVML::Bulk::Normalize(SPAN<vec3>(&normals[0], length), SPAN<const vec3>(&points[length], length), 7, three);
+		for (size_t i = 0; i < length; i++) { same = same && SameResult(normals[i], Normalize(points[length + i])); }
+		same = same && normals[length] == vec3(0, 0, 0);
+	}
+	PerformTest("Normalize()", "3D", "short spans and odd grains", same);
+#else
+	cout << "No runtime dispatch in this build" << endl;
+#endif
+
+	return 0;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+
+	//////////////////////////////////
+	//
+	// Swizzle arithmetic is evaluated lazily and must match eager evaluation
+	//
+	//////////////////////////////////
+
+	vec3 a(1, 2, 3);
+	vec3 b(4, 5, 6);
+	vec3 c(7, 8, 9);
+	vec3 d(10, 11, 12);
+
+	vec3 eager = vec3(a.zyx) + vec3(b.xxy) * vec3(c.yzx) - d;
+	vec3 lazy = a.zyx + b.xxy * c.yzx - d;
+	PerformTest("+ * -", "3D", "swizzle chain", lazy == eager && lazy == vec3(25, 27, 24));
+
+	lazy = a.zyx * 2.0f + 1.0f / b.xyz;
+	PerformTest("* / (scalar)", "3D", "swizzle chain", lazy == vec3(a.zyx) * 2.0f + 1.0f / b);
+
+	lazy = -a.zyx - b;
+	PerformTest("- (negate)", "3D", "swizzle chain", lazy == vec3(-7, -7, -7));
+
+	vec4 e(1, 2, 3, 4);
+	vec4 negated = -e.xyzw;
+	PerformTest("- (negate)", "4D", "keeps w", negated == -e);
+
+	PerformTest("Dot()", "3D", "expression argument", Dot(a.zyx + b, c) == Dot(vec3(a.zyx) + b, c));
+
+	// Expressions have no members but Component(); converting one gives its components, swizzles and Length
+	PerformTest("vec3()", "2D 3D", "members of an expression", vec3(a.zyx + b).xy == vec2(7, 7) && vec3(a.zyx + b).x == 7 && (float)vec3(a.zyx - a).Length == (float)vec3(2, 0, -2).Length &&
+	                                                            (a.zyx + b).Component(2) == 7);
+
+	//////////////////////////////////
+	//
+	// Assignment to swizzles reads every component before writing
+	//
+	//////////////////////////////////
+
+	vec3 target(1, 2, 3);
+	target.zyx = target.xyz + target.yzx;
+	PerformTest("= (swizzle)", "3D", "aliased expression", target == vec3(4, 5, 3));
+
+	target = vec3(1, 2, 3);
+	target.zyx += target.xyz * 2.0f;
+	PerformTest("+= (swizzle)", "3D", "aliased expression", target == vec3(7, 6, 5));
+
+	vec4 homogeneous(0, 0, 0, 1);
+	homogeneous.xyz = a.zyx + b.xyz;
+	PerformTest("= (swizzle)", "4D", "3D expression", homogeneous == vec4(7, 7, 7, 1));
+
+	vec2 flat(1, 2);
+	flat.yx -= flat.xy * flat.yx;
+	PerformTest("-= (swizzle)", "2D", "aliased expression", flat == vec2(-1, 0));
+
+	return 0;
+}
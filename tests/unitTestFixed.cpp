@@ -0,0 +1,112 @@
+#include <iostream>
+#include <math.h>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::max;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Fixed-point vectors need C++11: g++ -std=c++11 -I. tests/unitTestFixed.cpp
+int main (int argc, char * const argv[])
+{
+	using SVML::FIXED;
+	using SVML::fxvec2;
+	using SVML::fxvec3;
+	using SVML::fxvec4;
+
+	const double step = 1.0 / 65536.0;
+
+	//////////////////////////////////
+	//
+	// Scalar arithmetic
+	//
+	//////////////////////////////////
+
+	PerformTest("FIXED()", "scalar", "conversions", FIXED(1).raw == 65536 && FIXED(-2.5f).raw == -163840 && FIXED(0.1).raw == 6554 && FIXED(-0.1).raw == -6554 && FIXED(3u).ToDouble() == 3 && FIXED(1.5).ToFloat() == 1.5f);
+
+	FIXED largest = FIXED::FromRaw(0x7FFFFFFF);
+	FIXED smallest = FIXED::FromRaw(-0x7FFFFFFF - 1);
+	PerformTest("FIXED()", "scalar", "saturation", FIXED(40000) == largest && FIXED(-1.0e9) == smallest && largest + FIXED(1) == largest && smallest - FIXED(1) == smallest && FIXED(300) * FIXED(300) == largest && -smallest == largest && FIXED(1.0e30f) == largest);
+
+	PerformTest("operator/", "scalar", "rounding and division by zero", (FIXED(1) / FIXED(3)).raw == 21845 && (FIXED(2) / FIXED(3)).raw == 43691 && (FIXED(-2) / FIXED(3)).raw == -43691 && FIXED(1) / FIXED(0) == largest && FIXED(-1) / FIXED(0) == smallest && FIXED(0) / FIXED(0) == FIXED(0));
+
+	PerformTest("operator*", "scalar", "rounds to nearest", (FIXED::FromRaw(3) * FIXED(0.5)).raw == 2 && (FIXED::FromRaw(-3) * FIXED(0.5)).raw == -1 && FIXED(1.5) * FIXED(-4) == FIXED(-6));
+
+	PerformTest("floor() ceil() fabs()", "scalar", "functionality", floor(FIXED(-1.5)) == FIXED(-2) && ceil(FIXED(-1.5)) == FIXED(-1) && ceil(FIXED(1.25)) == FIXED(2) && floor(FIXED(3)) == FIXED(3) && ceil(smallest) == FIXED(-32768) && fabs(FIXED(-3.5)) == FIXED(3.5));
+
+	// sqrt() is the exact square root rounded to nearest, so it is within half a step
+	bool sqrtRounded = sqrt(FIXED(0)) == FIXED(0) && sqrt(FIXED(-4)) == FIXED(0) && sqrt(FIXED(16)) == FIXED(4);
+	for (long long raw = 1; raw <= 0x7FFFFFFF; raw += 65521)
+	{
+		FIXED value = FIXED::FromRaw((int32_t)raw);
+		sqrtRounded = sqrtRounded && fabs(sqrt(value).ToDouble() - sqrt(value.ToDouble())) <= step / 2;
+	}
+	PerformTest("sqrt()", "scalar", "correctly rounded", sqrtRounded);
+
+	double worst = 0;
+	for (long long raw = -0x7FFFFFFF - 1; raw <= 0x7FFFFFFF; raw += 196613)
+	{
+		FIXED angle = FIXED::FromRaw((int32_t)raw);
+		worst = max(worst, max(fabs(sin(angle).ToDouble() - sin(angle.ToDouble())), fabs(cos(angle).ToDouble() - cos(angle.ToDouble()))));
+	}
+	PerformTest("sin() cos()", "scalar", "within one step over the whole range", worst <= step && sin(FIXED(0)) == FIXED(0) && cos(FIXED(0)) == FIXED(1));
+
+	// Integer arithmetic alone, so these are the same bits everywhere
+	PerformTest("sqrt() sin() cos()", "scalar", "bit-exact results", sqrt(FIXED(2)).raw == 92682 && sin(FIXED(1)).raw == 55147 && cos(FIXED(1)).raw == 35409 && sin(FIXED(-1000)).raw == -54190);
+
+	//////////////////////////////////
+	//
+	// Vectors
+	//
+	//////////////////////////////////
+
+	fxvec2 a(3, 4);
+	fxvec3 b(1, 2, 2);
+	PerformTest("Length Distance() Dot()", "2D 3D", "fixed-point results", (FIXED)a.Length == FIXED(5) && Distance(a, fxvec2(0, 0)) == FIXED(5) && Dot(b, b) == FIXED(9) && DistanceSquared(b, fxvec3(0, 0, 0)) == FIXED(9));
+
+	// The squares of these leave the range of FIXED, their lengths do not
+	fxvec2 far(200, 0);
+	PerformTest("Length Distance() Normalize()", "2D 3D 4D", "past the range of the squares", (FIXED)far.Length == FIXED(200) && Distance(far, fxvec2(0, 0)) == FIXED(200) && Normalize(far) == fxvec2(1, 0) &&
+	                                                                                        (FIXED)fxvec3(3000, 4000, 0).Length == FIXED(5000) && Distance(fxvec4(0, 0, 0, 9), fxvec4(-3000, 0, 4000, 1)) == FIXED(5000));
+
+	// Lengths past the range of FIXED itself, about 51962 and 42426
+	fxvec3 huge(30000, 30000, 30000);
+	fxvec4 huge4(-30000, 0, 30000, 7);
+	huge.Normalize();
+	PerformTest("Normalize()", "2D 3D 4D", "past the range of FIXED", AlmostEqual(Normalize(fxvec3(30000, 30000, 30000)), fxvec3(0.57735f, 0.57735f, 0.57735f)) && AlmostEqual(huge, fxvec3(0.57735f, 0.57735f, 0.57735f)) &&
+	                                                                  AlmostEqual(Normalize(fxvec2(30000, -30000)), fxvec2(0.70711f, -0.70711f)) && AlmostEqual(Normalize(huge4), fxvec4(-0.70711f, 0, 0.70711f, 7)));
+
+	fxvec3 normalized = Normalize(fxvec3(1, 2, 3));
+	PerformTest("Normalize()", "3D", "bit-exact result", normalized.Component(0).raw == 17515 && normalized.Component(1).raw == 35031 && normalized.Component(2).raw == 52546 && AlmostEqual(Normalize(b), fxvec3(FIXED(1) / FIXED(3), FIXED(2) / FIXED(3), FIXED(2) / FIXED(3))));
+
+	fxvec2 rotated = Rotate(a, FIXED(0.5));
+	fxvec3 rotated3 = Rotate(fxvec3(1, 0, 0), fxvec3(0, 0.6, 0.8), FIXED(2));
+	PerformTest("Rotate()", "2D 3D", "bit-exact results", rotated.Component(0).raw == 46859 && rotated.Component(1).raw == 324312 && rotated3.Component(0).raw == -27276 && rotated3.Component(1).raw == 47674 && rotated3.Component(2).raw == -35756);
+	PerformTest("Rotate()", "2D", "quarter turn", Rotate(a, FIXED(1.5707963)) == fxvec2(-4, 3));
+
+	PerformTest("Min() Max() Lerp()", "2D 3D", "fixed-point scalars", Min(a, FIXED(3.5)) == fxvec2(3, 3.5) && Max(b, 1.5) == fxvec3(1.5, 2, 2) && Lerp(a, fxvec2(5, 6), 0.5f) == fxvec2(4, 5));
+
+	fxvec3 c = b;
+	c.zx *= FIXED(2);
+	c.xy += a.yx * 2;
+	PerformTest("swizzles", "3D", "scalar operations", c == fxvec3(10, 8, 4) && 2.5 * b.zyx == fxvec3(5, 5, 2.5) && Cross(b, fxvec3(0, 0, 1)) == fxvec3(2, -1, 0));
+
+	PerformTest("AlmostEqual()", "4D", "one step apart", AlmostEqual(fxvec4(1, 2, 3, 4), fxvec4(1, 2, 3, FIXED::FromRaw(4 * 65536 + 1))) && !AlmostEqual(fxvec4(1, 2, 3, 4), fxvec4(1, 2, 3, FIXED::FromRaw(4 * 65536 + 2))));
+
+	return 0;
+}
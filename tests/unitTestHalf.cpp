@@ -0,0 +1,164 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Half-precision vectors need C++11: g++ -std=c++11 -I. tests/unitTestHalf.cpp, and -DSVML_USE_SSE -mf16c for the F16C kernels
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::f16vec2;
+	using SVML::f16vec3;
+	using SVML::f16vec4;
+	using SVML::bf16vec3;
+	using SVML::bf16vec4;
+	using SVML::HALF;
+	using SVML::BFLOAT16;
+	using SVML::FloatBits;
+	using SVML::HalfBitsToFloat;
+
+	//////////////////////////////////
+	//
+	// Scalar conversions
+	//
+	//////////////////////////////////
+
+	PerformTest("HALF()", "scalar", "exact values", HALF(1.0f).bits == 0x3C00 && HALF(-2.0f).bits == 0xC000 && HALF(65504.0f).bits == 0x7BFF && HALF(0.0f).bits == 0 && HALF(-0.0f).bits == 0x8000);
+
+	// 2049 is halfway between 2048 and 2050, so it rounds to the even significand; 65520 is halfway to infinity
+	PerformTest("HALF()", "scalar", "round to nearest even", (float)HALF(2049.0f) == 2048 && (float)HALF(2051.0f) == 2052 && (float)HALF(65519.0f) == 65504 && HALF(65520.0f).bits == 0x7C00);
+
+	float smallest = HalfBitsToFloat(1);
+	PerformTest("HALF()", "scalar", "subnormals", smallest == 1.0f / 16777216.0f && HALF(smallest).bits == 1 && HALF(smallest * 0.5f).bits == 0 && HALF(smallest * 0.75f).bits == 1 && (float)HALF(6.0e-5f) == HalfBitsToFloat(HALF(6.0e-5f).bits));
+
+	float infinity = HalfBitsToFloat(0x7C00);
+	float nan = HalfBitsToFloat(0x7E00);
+	PerformTest("HALF()", "scalar", "infinity and NaN", infinity > 3.0e38f && HALF(infinity).bits == 0x7C00 && HALF(-infinity).bits == 0xFC00 && nan != nan && (HALF(nan).bits & 0x7E00) == 0x7E00);
+
+	bool roundTrips = true;
+	for (unsigned bits = 0; bits < 0x10000; bits++)
+	{
+		if ((bits & 0x7C00) != 0x7C00 || (bits & 0x3FF) == 0)
+		{
+			roundTrips = roundTrips && HALF(HalfBitsToFloat((unsigned short)bits)).bits == bits;
+		}
+	}
+	PerformTest("HALF()", "scalar", "every value round trips", roundTrips);
+
+	// 1 + 2^-8 is halfway between 1 and the next bfloat16
+	PerformTest("BFLOAT16()", "scalar", "rounding and range", BFLOAT16(1.0f).bits == 0x3F80 && (float)BFLOAT16(1.00390625f) == 1 && (float)BFLOAT16(1.01171875f) == 1.015625f && (float)BFLOAT16(1.0e30f) > 9.9e29f && (float)BFLOAT16(nan) != (float)BFLOAT16(nan));
+
+	//////////////////////////////////
+	//
+	// Vectors
+	//
+	//////////////////////////////////
+
+	PerformTest("sizeof()", "2D 3D 4D", "storage", sizeof(f16vec2) == 4 && sizeof(f16vec3) == 6 && sizeof(f16vec4) == 8 && sizeof(bf16vec3) == 6);
+
+	f16vec3 a(1.5f, 2, 3);
+	f16vec3 b = a + a;
+	PerformTest("operator+ operator* Dot()", "3D", "arithmetic in float", b == f16vec3(3, 4, 6) && vec3(a * 2.0f) == vec3(3, 4, 6) && (float)Dot(a, b) == 30.5f);
+
+	// Each operation rounds its result back to HALF
+	f16vec3 third = f16vec3(1, 1, 1) / 3.0f;
+	PerformTest("operator/", "3D", "rounds to storage", (float)third.x == HalfBitsToFloat(HALF(1.0f / 3.0f).bits) && (float)third.x != 1.0f / 3.0f);
+
+	// Normalize() and Length round their intermediate results to HALF as well
+	vec3 unit = vec3(Normalize(f16vec3(0, 3, 4)));
+	float length = (float)a.Length;
+	PerformTest("Normalize() Length Distance()", "3D", "functionality", (float)f16vec3(0, 3, 4).Length == 5 && Distance(unit, vec3(0, 0.6f, 0.8f)) < 0.001f && length > 3.9f && length < 3.91f && (float)Distance(a, b) > 3.9f && (float)Distance(a, b) < 3.91f);
+
+	f16vec3 c = a;
+	c.xy = a.zy;
+	c.zyx += f16vec3(1, 2, 3);
+	f16vec2 swizzled = c.zx;
+	PerformTest("swizzles", "3D", "read and write", c == f16vec3(6, 4, 4) && swizzled == f16vec2(4, 6) && c.z * 2.0f == 8 && f16vec4(c, 1).wzyx == f16vec4(1, 4, 4, 6));
+
+	PerformTest("VECTOR4()", "4D", "between component types", vec4(bf16vec4(1, 2, 3, 4)) == vec4(1, 2, 3, 4) && bf16vec4(vec4(1.0f, 0.5f, 256, -8)) == bf16vec4(1.0f, 0.5f, 256, -8));
+
+	//////////////////////////////////
+	//
+	// Bulk conversion
+	//
+	//////////////////////////////////
+
+	// An odd count past 16 components covers the wide loops and the scalar remainder, and the last 3D vector the padded path
+	const unsigned count = 23;
+	vec2 points2[count], back2[count];
+	vec3 points3[count], back3[count];
+	vec4 points4[count], back4[count];
+	f16vec2 half2[count];
+	f16vec3 half3[count];
+	f16vec4 half4[count];
+	bf16vec3 bfloat3[count];
+	bf16vec4 bfloat4[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		float value = (float)i * 1.37f - 11.0f;
+		points2[i] = vec2(value, 1.0f / (value + 0.5f));
+		points3[i] = vec3(value * value * value, -value, 1.0e-6f * value);
+		points4[i] = vec4(points3[i], (float)i * 4096.0f);
+	}
+	points3[3] = vec3(infinity, 70000, -0.0f);
+
+	Convert(half2, points2, count);
+	Convert(half3, points3, count);
+	Convert(half4, points4, count);
+	bool matches = true;
+	for (unsigned i = 0; i < count; i++)
+	{
+		matches = matches && half2[i] == f16vec2(points2[i]) && half3[i] == f16vec3(points3[i]) && half4[i] == f16vec4(points4[i]);
+		for (unsigned j = 0; j < 3; j++)
+		{
+			matches = matches && half3[i].Component(j).bits == HALF(points3[i].Component(j)).bits;
+		}
+	}
+	PerformTest("Convert()", "2D 3D 4D", "to HALF matches HALF()", matches);
+
+	Convert(back2, half2, count);
+	Convert(back3, half3, count);
+	Convert(back4, half4, count);
+	matches = true;
+	for (unsigned i = 0; i < count; i++)
+	{
+		matches = matches && back2[i] == vec2(half2[i]) && back3[i] == vec3(half3[i]) && back4[i] == vec4(half4[i]);
+	}
+	PerformTest("Convert()", "2D 3D 4D", "from HALF matches float()", matches && back3[3] == vec3(infinity, infinity, 0) && FloatBits(back3[3].z) == 0x80000000);
+
+	Convert(bfloat3, points3, count);
+	Convert(bfloat4, points4, count);
+	Convert(back3, bfloat3, count);
+	Convert(back4, bfloat4, count);
+	matches = true;
+	for (unsigned i = 0; i < count; i++)
+	{
+		matches = matches && bfloat3[i] == bf16vec3(points3[i]) && bfloat4[i] == bf16vec4(points4[i]) && back3[i] == vec3(bfloat3[i]) && back4[i] == vec4(bfloat4[i]);
+	}
+	PerformTest("Convert()", "3D 4D", "BFLOAT16 both ways", matches);
+
+	// Converting one vector must not write past it
+	f16vec3 guarded[2] = { f16vec3(9, 9, 9), f16vec3(9, 9, 9) };
+	Convert(guarded, points3, 1);
+	PerformTest("Convert()", "3D", "writes only count vectors", guarded[0] == f16vec3(points3[0]) && guarded[1] == f16vec3(9, 9, 9));
+
+	return 0;
+}
@@ -0,0 +1,224 @@
+// The parallel Build() needs C++11; before that the serial one is tested alone
+#if __cplusplus >= 201103L
+#define SVML_USE_THREADS
+#endif
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Deterministic pseudo-random coordinates in [-range, range)
+float Coordinate(unsigned& state, const float& range)
+{
+	state = state * 1664525u + 1013904223u;
+	return ((float)(state >> 8) / 16777216.0f * 2.0f - 1.0f) * range;
+}
+
+template <typename GRID, typename VECTOR> vector<unsigned> BruteRadius(const GRID& grid, const vector<bool>& live, const VECTOR& center, const float& radius)
+{
+	vector<unsigned> found;
+	for (unsigned i = 0; i < live.size(); i++)
+	{
+		if (live[i] && DistanceSquared(grid.Get(i), center) <= radius * radius)
+		{
+			found.push_back(i);
+		}
+	}
+	return found;
+}
+
+template <typename GRID, typename VECTOR> vector<unsigned> BruteNearest(const GRID& grid, const vector<bool>& live, const VECTOR& center, const unsigned& k)
+{
+	vector< std::pair<float, unsigned> > all;
+	for (unsigned i = 0; i < live.size(); i++)
+	{
+		if (live[i])
+		{
+			all.push_back(std::make_pair((float)DistanceSquared(grid.Get(i), center), i));
+		}
+	}
+	std::sort(all.begin(), all.end());
+	vector<unsigned> found;
+	for (unsigned i = 0; i < k && i < all.size(); i++)
+	{
+		found.push_back(all[i].second);
+	}
+	return found;
+}
+
+template <typename GRID, typename VECTOR> bool MatchesBruteForce(const GRID& grid, const vector<bool>& live, const vector<VECTOR>& centers, const float& radius, const unsigned& k)
+{
+	for (unsigned c = 0; c < centers.size(); c++)
+	{
+		vector<unsigned> found;
+		if (grid.QueryRadius(centers[c], radius, found) != found.size())
+		{
+			return false;
+		}
+		std::sort(found.begin(), found.end());
+		if (found != BruteRadius(grid, live, centers[c], radius))
+		{
+			return false;
+		}
+		found.clear();
+		grid.QueryNearest(centers[c], k, found);
+		if (found != BruteNearest(grid, live, centers[c], k))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::hashgrid2;
+	using SVML::hashgrid3;
+
+	unsigned state = 12345;
+
+	vector<vec2> points2;
+	vector<vec3> points3;
+	for (unsigned i = 0; i < 2000; i++)
+	{
+		float x = Coordinate(state, 50.0f), y = Coordinate(state, 50.0f), z = Coordinate(state, 50.0f);
+		points2.push_back(vec2(x, y));
+		points3.push_back(vec3(x, y, z));
+	}
+	vector<vec2> centers2;
+	vector<vec3> centers3;
+	for (unsigned i = 0; i < 40; i++)
+	{
+		// Some of the centers far outside the points
+		float range = (i % 4 == 0) ? 200.0f : 60.0f;
+		float x = Coordinate(state, range), y = Coordinate(state, range), z = Coordinate(state, range);
+		centers2.push_back(vec2(x, y));
+		centers3.push_back(vec3(x, y, z));
+	}
+	vector<bool> live(points2.size(), true);
+
+	//////////////////////////////////
+	//
+	// Queries against brute force
+	//
+	//////////////////////////////////
+
+	hashgrid2 grid2(4.0f, &points2[0], (unsigned)points2.size());
+	hashgrid3 grid3(4.0f, &points3[0], (unsigned)points3.size());
+
+	PerformTest("Build() Count() CellOf()", "2D 3D", "functionality", grid2.Count() == 2000 && grid3.Count() == 2000 && grid2.Get(7) == points2[7] &&
+	                                                              grid3.CellOf(vec3(-0.5f, 4.0f, 9.0f)) == SVML::VECTOR3<int>(-1, 1, 2));
+
+	PerformTest("QueryRadius() QueryNearest()", "2D", "matches brute force", MatchesBruteForce(grid2, live, centers2, 3.0f, 5) && MatchesBruteForce(grid2, live, centers2, 11.0f, 1));
+	PerformTest("QueryRadius() QueryNearest()", "3D", "matches brute force", MatchesBruteForce(grid3, live, centers3, 7.5f, 8) && MatchesBruteForce(grid3, live, centers3, 0.5f, 30));
+
+	vector<unsigned> found;
+	PerformTest("QueryNearest()", "3D", "nearest first, no more than Count()", grid3.QueryNearest(vec3(0.0f, 0.0f, 0.0f), 5000, found) == 2000 && found == BruteNearest(grid3, live, vec3(0.0f, 0.0f, 0.0f), 2000));
+
+	hashgrid3 empty(1.0f);
+	found.clear();
+	PerformTest("QueryRadius() QueryNearest()", "3D", "empty grid", empty.QueryRadius(vec3(0.0f, 0.0f, 0.0f), 10.0f, found) == 0 && empty.QueryNearest(vec3(0.0f, 0.0f, 0.0f), 3, found) == 0 && found.empty());
+
+	// Query cells past the range of int
+	hashgrid2 near2(4.0f, &points2[0], 100);
+	hashgrid3 near3(4.0f, &points3[0], 100);
+	vector<bool> first(100, true);
+	found.clear();
+	PerformTest("QueryRadius() QueryNearest()", "2D 3D", "far centers and huge radii", near3.QueryNearest(vec3(1e12f, 0.0f, 0.0f), 3, found) == 3 && found == BruteNearest(near3, first, vec3(1e12f, 0.0f, 0.0f), 3) &&
+	                                                                                   near3.QueryRadius(vec3(50.0f, 0.0f, 0.0f), 3e9f, found) == 100 && near2.QueryRadius(vec2(-4e10f, 1e10f), 1e11f, found) == 100);
+
+	//////////////////////////////////
+	//
+	// Incremental changes
+	//
+	//////////////////////////////////
+
+	// Removing a third, moving a third and inserting into the freed indices
+	for (unsigned i = 0; i < 2000; i += 3)
+	{
+		grid2.Remove(i);
+		grid3.Remove(i);
+		live[i] = false;
+	}
+	PerformTest("Remove()", "2D 3D", "matches brute force", grid3.Count() == 1333 && MatchesBruteForce(grid2, live, centers2, 6.0f, 4) && MatchesBruteForce(grid3, live, centers3, 6.0f, 4));
+
+	for (unsigned i = 1; i < 2000; i += 3)
+	{
+		float x = Coordinate(state, 1.0f), y = Coordinate(state, 1.0f), z = Coordinate(state, 30.0f);
+		grid2.Move(i, grid2.Get(i) + vec2(x, y));
+		grid3.Move(i, grid3.Get(i) + vec3(x, y, z));
+	}
+	PerformTest("Move()", "2D 3D", "matches brute force", MatchesBruteForce(grid2, live, centers2, 6.0f, 4) && MatchesBruteForce(grid3, live, centers3, 6.0f, 4));
+
+	bool reused = true;
+	for (unsigned i = 0; i < 100; i++)
+	{
+		vec2 point2(Coordinate(state, 80.0f), Coordinate(state, 80.0f));
+		vec3 point3(point2, Coordinate(state, 80.0f));
+		unsigned index = grid2.Insert(point2);
+		reused = reused && index == grid3.Insert(point3) && !live[index];
+		live[index] = true;
+	}
+	PerformTest("Insert()", "2D 3D", "reuses indices", reused && grid2.Count() == 1433 && grid3.Count() == 1433);
+	PerformTest("Insert()", "2D 3D", "matches brute force", MatchesBruteForce(grid2, live, centers2, 6.0f, 4) && MatchesBruteForce(grid3, live, centers3, 9.0f, 12));
+
+	grid3.Rebuild();
+	PerformTest("Rebuild()", "3D", "matches brute force", MatchesBruteForce(grid3, live, centers3, 9.0f, 12));
+
+	// A few changes stay pending (not yet filed in a bucket)
+	hashgrid2 small(1.0f);
+	unsigned a = small.Insert(vec2(0.5f, 0.5f));
+	unsigned b = small.Insert(vec2(3.5f, 0.5f));
+	small.Insert(vec2(-2.0f, 0.0f));
+	small.Move(b, vec2(1.5f, 0.5f));
+	small.Remove(a);
+	found.clear();
+	PerformTest("Insert() Move() Remove()", "2D", "pending points", small.Count() == 2 && small.QueryNearest(vec2(0.0f, 0.0f), 1, found) == 1 && found[0] == b &&
+	                                                                  small.QueryRadius(vec2(0.0f, 0.0f), 1.9f, found) == 1);
+
+	//////////////////////////////////
+	//
+	// Parallel build
+	//
+	//////////////////////////////////
+
+#ifdef SVML_USE_THREADS
+	hashgrid3 serial(4.0f, &points3[0], (unsigned)points3.size());
+	hashgrid3 parallel(4.0f);
+	SVML::Bulk::WORK_POOL three(3);
+	parallel.Build(SVML::Bulk::SPAN<const vec3>(&points3[0], points3.size()), 64, three);
+	vector<bool> all(points3.size(), true);
+	bool same = parallel.Count() == serial.Count();
+	for (unsigned c = 0; c < centers3.size(); c++)
+	{
+		vector<unsigned> fromSerial, fromParallel;
+		serial.QueryRadius(centers3[c], 9.0f, fromSerial);
+		parallel.QueryRadius(centers3[c], 9.0f, fromParallel);
+		same = same && fromSerial == fromParallel;
+	}
+	PerformTest("Build() (parallel)", "3D", "same order as serial", same && MatchesBruteForce(parallel, all, centers3, 5.0f, 6));
+#endif
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+// The 3D header first, so it has to compile on its own, without svml.h or any iostreams
+#include "svml_vector3.h"
+
+#ifdef SVML_H
+const bool includedSvml = true;
+#else
+const bool includedSvml = false;
+#endif
+
+SVML::vec3 LeanFunction(const SVML::vec3& a, const SVML::vec3& b)
+{
+	using SVML::vec2;
+	using SVML::vec3;
+
+	vec3 result = a.zyx + b * 2.0f;
+	result.xy = vec2(result.yx) * 0.5f;
+	return Cross(result, a) + Normalize(b) * Dot(a, b);
+}
+
+#include "svml_io.h"
+#include <iostream>
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::bvec3;
+	using SVML::mat2;
+	using SVML::quat;
+	using SVML::rot2;
+	using SVML::aabb2;
+
+	//////////////////////////////////
+	//
+	// Vector headers without svml.h
+	//
+	//////////////////////////////////
+
+	vec3 a(1, 2, 3);
+	vec3 b(0, 3, 4);
+	vec3 result(4, 1.5f, 9); // (3 + 0, 2 + 6, 1 + 8), then x and y swapped and halved
+	// LeanFunction() is inlined differently, so with FMA (-mfma, -march=native) it can round differently in the last bits
+	PerformTest("svml_vector3.h", "2D 3D", "included alone", !includedSvml && Distance(LeanFunction(a, b), Cross(result, a) + Normalize(b) * Dot(a, b)) < 1e-4f);
+
+	//////////////////////////////////
+	//
+	// Printing from svml_io.h
+	//
+	//////////////////////////////////
+
+	std::ostringstream printed;
+	printed << a << " " << a.zx << " " << vec4(a, -1);
+	PerformTest("operator<<", "2D 3D 4D", "vectors and swizzles", printed.str() == "(1, 2, 3) (3, 1) (1, 2, 3, -1)");
+
+	PerformTest("ToString()", "2D 3D 4D", "vectors and swizzles", ToString(vec2(0.5f, -2)) == "(0.5, -2)" && ToString(a.zyx) == "(3, 2, 1)" && ToString(SVML::VECTOR4<int>(1, 2, 3, 4)) == "(1, 2, 3, 4)");
+
+	PerformTest("ToString()", "3D", "masks", ToString(LessThan(a, vec3(2, 2, 2))) == "(true, false, false)" && ToString(bvec3()) == "(false, false, false)");
+
+	PerformTest("ToString()", "", "matrices, quaternions, rotations and boxes", ToString(mat2(vec2(1, 2), vec2(3, 4))) == "((1, 2), (3, 4))" && ToString(quat(0, 0, 0, 1)) == "(0, 0, 0, 1)" &&
+	                                                                            ToString(rot2(1, 0)) == "(1, 0)" && ToString(aabb2(vec2(0, 1), vec2(2, 3))) == "((0, 1), (2, 3))");
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+	std::ostringstream components;
+	components << SVML::FIXED(1.5f) << " " << SVML::WIDE<float, 4>(2);
+	PerformTest("operator<<", "", "fixed point and lanes", components.str() == "1.5 [2, 2, 2, 2]" && ToString(SVML::fxvec2(0.25f, -1)) == "(0.25, -1)");
+#endif
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <limits>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Deterministic pseudo-random components from a small set, so equal components come up often
+float Component(unsigned& state)
+{
+	state = state * 1664525u + 1013904223u;
+	return (float)((int)(state >> 28) - 8) * 0.5f;
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::bvec2;
+	using SVML::bvec3;
+	using SVML::bvec4;
+	using SVML::Any;
+	using SVML::All;
+
+	//////////////////////////////////
+	//
+	// Masks
+	//
+	//////////////////////////////////
+
+	bvec3 mask(true, false, true);
+	PerformTest("bvec3", "3D", "construction and lanes", mask.bits == 5u && mask[0] && !mask[1] && mask[2] && bvec3::FromBits(0xFFu).bits == 7u && bvec3().bits == 0u);
+	PerformTest("& | ^ !", "3D", "lane logic", (mask & bvec3(true, true, false)) == bvec3(true, false, false) && (mask | bvec3(false, true, false)) == bvec3(true, true, true) &&
+	                                           (mask ^ bvec3(true, true, true)) == !mask && (!mask).bits == 2u);
+	PerformTest("Any() All()", "2D 3D 4D", "functionality", Any(mask) && !All(mask) && All(mask | !mask) && !Any(bvec2(false, false)) && All(bvec4(true, true, true, true)) &&
+	                                                       !All(bvec4(true, true, true, false)));
+	PerformTest("ToString()", "2D 4D", "functionality", ToString(bvec2(true, false)) == "(true, false)" && ToString(bvec4(false, false, false, true)) == "(false, false, false, true)");
+
+	//////////////////////////////////
+	//
+	// Comparisons, lane by lane against the scalar operators
+	//
+	//////////////////////////////////
+
+	unsigned state = 12345;
+	bool same = true;
+	for (unsigned i = 0; i < 2000; i++)
+	{
+		vec4 a(Component(state), Component(state), Component(state), Component(state));
+		vec4 b(Component(state), Component(state), Component(state), Component(state));
+		bvec4 less = LessThan(a, b), greater = GreaterThan(a, b), lessEqual = LessThanEqual(a, b), greaterEqual = GreaterThanEqual(a, b);
+		bvec4 equal = Equal(a, b), notEqual = NotEqual(a, b);
+		for (unsigned d = 0; d < 4; d++)
+		{
+			float x = a.Component(d), y = b.Component(d);
+			same = same && less[d] == (x < y) && greater[d] == (x > y) && lessEqual[d] == (x <= y) && greaterEqual[d] == (x >= y) && equal[d] == (x == y) && notEqual[d] == (x != y);
+		}
+		vec3 a3(a.xyz), b3(b.xyz);
+		same = same && LessThan(a3, b3) == bvec3(less[0], less[1], less[2]) && GreaterThanEqual(a3, b3) == bvec3(greaterEqual[0], greaterEqual[1], greaterEqual[2]) &&
+		       NotEqual(a3, b3) == bvec3(notEqual[0], notEqual[1], notEqual[2]) && LessThanEqual(vec2(a.xy), vec2(b.xy)) == bvec2(lessEqual[0], lessEqual[1]);
+	}
+	PerformTest("LessThan() GreaterThan() LessThanEqual() GreaterThanEqual() Equal() NotEqual()", "2D 3D 4D", "match scalar operators", same);
+
+	vec3 a(1.0f, 2.0f, 3.0f);
+	vec3 b(3.0f, 2.0f, 1.0f);
+	PerformTest("LessThan() (swizzle)", "3D", "functionality", LessThan(a.zyx, b) == bvec3(false, false, false) && LessThan(a, b.xxx) == bvec3(true, true, false) &&
+	                                                           GreaterThan(a.xy, b.zz) == bvec2(false, true));
+
+	float nan = std::numeric_limits<float>::quiet_NaN();
+	vec4 withNan(nan, 1.0f, nan, 1.0f);
+	vec4 ones(1.0f, 1.0f, 1.0f, 1.0f);
+	PerformTest("LessThanEqual() GreaterThanEqual() Equal() NotEqual()", "4D", "NaN compares false but not-equal", !Any(LessThanEqual(withNan, ones) ^ bvec4(false, true, false, true)) &&
+	                                                                                                              GreaterThanEqual(withNan, ones) == bvec4(false, true, false, true) &&
+	                                                                                                              Equal(withNan, withNan) == bvec4(false, true, false, true) && NotEqual(withNan, ones) == bvec4(true, false, true, false));
+
+	vec4 near(1.0f + SVML::ScalarType<float>::Epsilon() / 2, 1.0f - SVML::ScalarType<float>::Epsilon() * 2, 1.0f, -1.0f);
+	PerformTest("AlmostEqualMask()", "2D 4D", "functionality", AlmostEqualMask(near, ones) == bvec4(true, false, true, false) && AlmostEqualMask(near.xy, ones.xy) == bvec2(true, false) &&
+	                                                          All(AlmostEqualMask(near, near)));
+
+	SVML::VECTOR4<int> cells(-3, 0, 7, 2147483647);
+	SVML::VECTOR4<int> limits(0, 0, 8, -2147483647 - 1);
+	PerformTest("LessThan() LessThanEqual() NotEqual()", "3D 4D", "int", LessThan(cells, limits) == bvec4(true, false, true, false) && LessThanEqual(cells, limits) == bvec4(true, true, true, false) &&
+	                                                                   NotEqual(cells.xyz, limits.xyz) == bvec3(true, false, true) && GreaterThanEqual(cells.xyz, limits.xyz) == bvec3(false, true, false));
+
+	SVML::VECTOR4<double> wide(0.5, -1.0, 2.0, 1e300);
+	PerformTest("GreaterThan() AlmostEqualMask()", "4D", "double", GreaterThan(wide, SVML::VECTOR4<double>(0.25, 0.0, 2.0, 1e299)) == bvec4(true, false, false, true) &&
+	                                                                AlmostEqualMask(wide, SVML::VECTOR4<double>(0.5, -1.0, 2.5, 1e300)) == bvec4(true, true, false, true));
+
+	//////////////////////////////////
+	//
+	// Select
+	//
+	//////////////////////////////////
+
+	PerformTest("Select()", "2D 3D 4D", "functionality", Select(mask, a, vec3(7.0f, 8.0f, 9.0f)) == vec3(1.0f, 8.0f, 3.0f) && Select(bvec2(false, true), vec2(1.0f, 2.0f), vec2(3.0f, 4.0f)) == vec2(3.0f, 2.0f) &&
+	                                                    Select(bvec4(true, false, false, true), vec4(1.0f, 2.0f, 3.0f, 4.0f), ones) == vec4(1.0f, 1.0f, 1.0f, 4.0f));
+	PerformTest("Select() (swizzle)", "3D", "functionality", Select(mask, a.zyx, b) == vec3(3.0f, 2.0f, 1.0f) && Select(!mask, a, b.zzz) == vec3(1.0f, 2.0f, 1.0f) &&
+	                                                        Select(mask, a.xxx, b.yyy) == vec3(1.0f, 2.0f, 1.0f));
+
+	// Clamping and culling without a branch per component
+	vec3 low(-1.0f, -1.0f, -1.0f), high(1.0f, 1.0f, 1.0f);
+	vec3 point(-4.0f, 0.5f, 9.0f);
+	vec3 clamped = Select(LessThan(point, low), low, Select(GreaterThan(point, high), high, point));
+	SVML::VECTOR3<int> inside = Select(LessThan(point, low) | GreaterThan(point, high), SVML::VECTOR3<int>(0, 0, 0), SVML::VECTOR3<int>(1, 1, 1));
+	PerformTest("Select()", "3D", "clamp and cull", clamped == vec3(-1.0f, 0.5f, 1.0f) && inside == SVML::VECTOR3<int>(0, 1, 0) && Any(GreaterThan(point, high)) && !All(LessThan(low, point)));
+
+	return 0;
+}
@@ -0,0 +1,116 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::mat2;
+	using SVML::mat3;
+	using SVML::mat4;
+	using SVML::vec3_soa;
+
+	//////////////////////////////////
+	//
+	// Construction and access (columns are vectors, m[column].row)
+	//
+	//////////////////////////////////
+
+	mat3 m3(vec3(2, 0, 1), vec3(1, 3, 0), vec3(0, 1, 4));
+	PerformTest("[] Row()", "3x3", "functionality", m3[1] == vec3(1, 3, 0) && m3[2].z == 4 && m3.Row(0) == vec3(2, 1, 0));
+	PerformTest("Identity()", "4x4", "functionality", mat4::Identity() == mat4(vec4(1, 0, 0, 0), vec4(0, 1, 0, 0), vec4(0, 0, 1, 0), vec4(0, 0, 0, 1)));
+
+	//////////////////////////////////
+	//
+	// Multiplication
+	//
+	//////////////////////////////////
+
+	PerformTest("* (vector)", "3x3", "functionality", m3 * vec3(1, 2, 3) == vec3(4, 9, 13));
+	PerformTest("* (swizzle)", "3x3", "functionality", m3 * vec3(3, 2, 1).zyx == vec3(4, 9, 13));
+	PerformTest("* (swizzle)", "2x2", "functionality", mat2(vec2(1, 2), vec2(3, 4)) * vec4(0, 1, 0, 2).wy == vec2(5, 8));
+
+	mat4 translate(vec4(1, 0, 0, 0), vec4(0, 1, 0, 0), vec4(0, 0, 1, 0), vec4(5, -2, 3, 1));
+	vec4 point(1, 1, 1, 1);
+	PerformTest("* (vector)", "4x4", "functionality", translate * point == vec4(6, -1, 4, 1) && translate * point.xyzw == vec4(6, -1, 4, 1));
+	PerformTest("* (matrix)", "4x4", "functionality", translate * translate * point == vec4(11, -3, 7, 1) && translate * mat4::Identity() == translate);
+
+	mat3 scaled = m3;
+	scaled *= 2.0f;
+	PerformTest("*= (scalar)", "3x3", "functionality", scaled == m3 * 2.0f && scaled == 2.0f * m3 && scaled - m3 == m3);
+
+	//////////////////////////////////
+	//
+	// Transpose, determinant and inverse
+	//
+	//////////////////////////////////
+
+	PerformTest("Transpose()", "3x3", "functionality", Transpose(m3) == mat3(vec3(2, 1, 0), vec3(0, 3, 1), vec3(1, 0, 4)) && Transpose(Transpose(m3)) == m3);
+
+	PerformTest("Determinant()", "2x2", "functionality", Determinant(mat2(vec2(1, 2), vec2(3, 4))) == -2);
+	PerformTest("Determinant()", "3x3", "functionality", Determinant(m3) == 25);
+
+	mat4 m4(vec4(2, 1, 0, 0), vec4(0, 3, 1, 0), vec4(1, 0, 4, 1), vec4(0, 1, 0, 5));
+	PerformTest("Determinant()", "4x4", "functionality", Determinant(m4) == 127 && Determinant(Transpose(m4)) == 127);
+
+	// Inverses are not exact in floating point, so compare against a looser tolerance than AlmostEqual()
+	const float tolerance = 0.00001f;
+	bool passed = true;
+	mat2 m2(vec2(4, 7), vec2(2, 6));
+	mat2 i2 = Inverse(m2) * m2;
+	mat3 i3 = Inverse(m3) * m3;
+	mat4 i4 = Inverse(m4) * m4;
+	for (unsigned c = 0; c < 2; c++) { passed = passed && Distance(i2[c], mat2::Identity()[c]) < tolerance; }
+	for (unsigned c = 0; c < 3; c++) { passed = passed && Distance(i3[c], mat3::Identity()[c]) < tolerance; }
+	for (unsigned c = 0; c < 4; c++) { passed = passed && Distance(i4[c], mat4::Identity()[c]) < tolerance && fabs(i4[c].w - mat4::Identity()[c].w) < tolerance; }
+	PerformTest("Inverse()", "2x2 3x3 4x4", "inverse * m == identity", passed);
+
+	//////////////////////////////////
+	//
+	// Transforming many vectors
+	//
+	//////////////////////////////////
+
+	const unsigned count = 37;
+	vec3 points[count];
+	vec3 moved[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		points[i] = vec3(i * 0.5f + 1, 3.0f - i, i * 0.25f - 2);
+	}
+
+	passed = true;
+	Transform(moved, m3, points, count);
+	for (unsigned i = 0; i < count; i++) { passed = passed && moved[i] == m3 * points[i]; }
+	PerformTest("Transform()", "3x3 array", "matches per-vector", passed);
+
+	passed = true;
+	vec3_soa batch(points, count);
+	vec3_soa out(count);
+	Transform(out, m3, batch);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == m3 * points[i]; }
+	Transform(out.zyx, m3, batch.zyx);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == vec3(m3 * points[i].zyx).zyx; }
+	PerformTest("Transform()", "3x3 batch", "matches per-vector", passed);
+
+	return 0;
+}
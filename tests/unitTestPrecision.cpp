@@ -0,0 +1,90 @@
+#include <iostream>
+
+// Build once per mode: -DSVML_PRECISION=0, 1 or 2 (with or without -DSVML_USE_SSE)
+#ifndef SVML_PRECISION
+#define SVML_PRECISION SVML_PRECISION_REFINED
+#endif
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::quat;
+
+	// Relative error allowed for each mode, a little above the measured maximum (see docs/Usage.md)
+#if SVML_PRECISION == SVML_PRECISION_ESTIMATE
+	const double tolerance = 0.0007;
+#elif SVML_PRECISION == SVML_PRECISION_REFINED
+	const double tolerance = 0.000001;
+#else
+	const double tolerance = 0.0000004;
+#endif
+
+	const unsigned count = 1000;
+	bool lengthPassed = true;
+	bool normalizePassed = true;
+	bool memberPassed = true;
+	bool distancePassed = true;
+	for (unsigned i = 0; i < count; i++)
+	{
+		// Spread the lengths over several orders of magnitude
+		float scale = (float)pow(10.0, (i % 9) - 4.0);
+		vec3 a(scale * ((i * 37) % 101 - 50.0f), scale * ((i * 53) % 103 - 51.0f), scale * ((i * 71) % 107 - 53.0f));
+		vec3 b(0.25f, -0.5f, 1.0f);
+		double exact = sqrt((double)a.x * a.x + (double)a.y * a.y + (double)a.z * a.z);
+		if (exact == 0)
+		{
+			continue;
+		}
+
+		lengthPassed = lengthPassed && fabs(a.Length - exact) <= tolerance * exact;
+
+		vec3 normalized = Normalize(a);
+		normalizePassed = normalizePassed && fabs(normalized.x - a.x / exact) <= tolerance && fabs(normalized.y - a.y / exact) <= tolerance && fabs(normalized.z - a.z / exact) <= tolerance;
+
+		vec4 member(a, 5.0f);
+		member.Normalize();
+		memberPassed = memberPassed && fabs(member.x - a.x / exact) <= tolerance && fabs(member.z - a.z / exact) <= tolerance && member.w == 5.0f;
+
+		double exactDistance = sqrt(((double)a.x - b.x) * ((double)a.x - b.x) + ((double)a.y - b.y) * ((double)a.y - b.y) + ((double)a.z - b.z) * ((double)a.z - b.z));
+		distancePassed = distancePassed && fabs(Distance(a, b) - exactDistance) <= tolerance * exactDistance;
+	}
+	PerformTest(".Length", "3D", "within the mode's error", lengthPassed);
+	PerformTest("Normalize()", "3D", "within the mode's error", normalizePassed);
+	PerformTest(".Normalize()", "4D", "within the mode's error, keeps w", memberPassed);
+	PerformTest("Distance()", "3D", "within the mode's error", distancePassed);
+
+	vec2 resized(3, 4);
+	resized.Length = 10;
+	PerformTest(".Length =", "2D", "within the mode's error", fabs(resized.x - 6) <= 6 * tolerance && fabs(resized.y - 8) <= 8 * tolerance);
+
+	quat q(1, 2, 3, 4);
+	q = Normalize(q);
+	PerformTest("Normalize()", "Quaternion", "within the mode's error", fabs(Dot(q, q) - 1) <= 2 * tolerance);
+
+	// The reciprocal square root of 0 is infinite, so these must not be computed as x * (1 / sqrt(x))
+	vec3 zero(0, 0, 0);
+	PerformTest(".Length Distance()", "3D", "zero length is 0", zero.Length == 0 && Distance(zero, zero) == 0 && vec4(0, 0, 0, 1).Length == 0);
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::DegToRad;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::quat;
+	using SVML::vec3_soa;
+
+	// Rotations are not exact in floating point
+	const float tolerance = 0.00001f;
+
+	vec3 axis = Normalize(vec3(1, 2, 3));
+	vec3 point(0.5f, -1.0f, 2.0f);
+	float radians = DegToRad(40.0f);
+
+	//////////////////////////////////
+	//
+	// Construction and rotation
+	//
+	//////////////////////////////////
+
+	quat rotation(axis, radians);
+	PerformTest("quat(axis, radians)", "Quaternion", "functionality", fabs(Dot(rotation, rotation) - 1) < tolerance && fabs(rotation.w - cos(radians / 2)) < tolerance);
+
+	vec3 rodrigues = point * cos(radians) + axis * Dot(point, axis) * (1 - cos(radians)) + Cross(axis, point) * sin(radians);
+	PerformTest("Rotate()", "3D", "matches axis-angle formula", Distance(Rotate(point, rotation), rodrigues) < tolerance && Distance(Rotate(point, axis, radians), rodrigues) < tolerance);
+
+	PerformTest("Rotate() (swizzle)", "3D", "functionality", Rotate(point.zyx, rotation) == Rotate(vec3(point.zyx), rotation));
+
+	vec4 homogeneous(point, 7.0f);
+	PerformTest("Rotate()", "4D", "keeps w", Rotate(homogeneous, rotation) == vec4(Rotate(point, rotation), 7.0f) && Rotate(homogeneous.xyzw, rotation).w == 7.0f);
+
+	PerformTest("Rotate()", "3D", "quarter turn", Distance(Rotate(vec3(1, 0, 0), quat(vec3(0, 0, 1), DegToRad(90.0f))), vec3(0, 1, 0)) < tolerance);
+
+	//////////////////////////////////
+	//
+	// Composition, inverse and matrices
+	//
+	//////////////////////////////////
+
+	quat other(Normalize(vec3(0, -1, 1)), 1.0f);
+	PerformTest("* (composition)", "Quaternion", "rotates right then left", Distance(Rotate(point, rotation * other), Rotate(Rotate(point, other), rotation)) < tolerance);
+
+	PerformTest("Inverse() Conjugate()", "Quaternion", "undoes rotation", Distance(Rotate(Rotate(point, rotation), Inverse(rotation)), point) < tolerance &&
+	                                                                           Inverse(rotation) == Conjugate(rotation) * (1 / Dot(rotation, rotation)));
+
+	PerformTest("ToMatrix()", "Quaternion", "matches Rotate()", Distance(ToMatrix(rotation) * point, Rotate(point, rotation)) < tolerance);
+
+	//////////////////////////////////
+	//
+	// Interpolation
+	//
+	//////////////////////////////////
+
+	PerformTest("Slerp()", "Quaternion", "end points", AlmostEqual(Slerp(rotation, other, 0.0f), rotation) && Distance(Rotate(point, Slerp(rotation, other, 1.0f)), Rotate(point, other)) < tolerance);
+
+	quat zero = quat::Identity();
+	quat half = Slerp(zero, quat(vec3(0, 0, 1), DegToRad(80.0f)), 0.25f);
+	PerformTest("Slerp()", "Quaternion", "constant speed", Distance(Rotate(point, half), Rotate(point, vec3(0, 0, 1), DegToRad(20.0f))) < tolerance);
+
+	PerformTest("Slerp()", "Quaternion", "shorter arc", Distance(Rotate(point, Slerp(zero, -rotation, 0.5f)), Rotate(point, axis, radians / 2)) < tolerance);
+
+	quat blended = Nlerp(rotation, other, 0.3f);
+	PerformTest("Nlerp()", "Quaternion", "normalized, close to Slerp()", fabs(Dot(blended, blended) - 1) < tolerance && Dot(blended, Slerp(rotation, other, 0.3f)) > 0.999f);
+
+	//////////////////////////////////
+	//
+	// Rotating many vectors
+	//
+	//////////////////////////////////
+
+	const unsigned count = 37;
+	vec3 points[count];
+	vec3 rotated[count];
+	vec4 homogeneousPoints[count];
+	vec4 homogeneousRotated[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		points[i] = vec3(i * 0.5f + 1, 3.0f - i, i * 0.25f - 2);
+		homogeneousPoints[i] = vec4(points[i], (float)i);
+	}
+
+	bool passed = true;
+	Rotate(rotated, points, rotation, count);
+	Rotate(homogeneousRotated, homogeneousPoints, rotation, count);
+	for (unsigned i = 0; i < count; i++)
+	{
+		passed = passed && Distance(rotated[i], Rotate(points[i], rotation)) < 0.0001f;
+		passed = passed && Distance(homogeneousRotated[i], Rotate(homogeneousPoints[i], rotation)) < 0.0001f && homogeneousRotated[i].w == i;
+	}
+	PerformTest("Rotate()", "3D 4D array", "matches per-vector", passed);
+
+	passed = true;
+	vec3_soa batch(points, count);
+	vec3_soa out(count);
+	Rotate(out, batch, rotation);
+	for (unsigned i = 0; i < count; i++) { passed = passed && Distance(out.Get(i), Rotate(points[i], rotation)) < 0.0001f; }
+	Rotate(out.zyx, batch, rotation);
+	for (unsigned i = 0; i < count; i++) { passed = passed && Distance(out.Get(i).zyx, Rotate(points[i], rotation)) < 0.0001f; }
+	PerformTest("Rotate()", "3D batch", "matches per-vector", passed);
+
+	return 0;
+}
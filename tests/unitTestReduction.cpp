@@ -0,0 +1,106 @@
+#include <cmath>
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::mat2;
+	using SVML::mat3;
+	using SVML::VECTOR3;
+	using SVML::REDUCTION_BLOCK;
+
+	// More than two blocks and not a multiple of 4, so the pairwise tree is uneven and every accumulator is used
+	const unsigned count = 3 * 1024 + 7;
+	static vec3 points[count];
+	static vec2 flat[count];
+	static vec4 colors[count];
+	static VECTOR3<int> integers[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		points[i] = vec3((float)(i % 10), (float)(i % 3) - 1, 0.5f);
+		flat[i] = points[i].xy;
+		colors[i] = vec4(points[i], 1);
+		integers[i] = VECTOR3<int>((int)(i % 10), (int)(i % 3) - 1, 7);
+	}
+
+	//////////////////////////////////
+	//
+	// Sum() and Centroid()
+	//
+	//////////////////////////////////
+
+	// Small integers add exactly in any order
+	vec3 expected(0, 0, 0.5f * count);
+	for (unsigned i = 0; i < count; i++) { expected.xy += points[i].xy; }
+	PerformTest("Sum()", "3D", "exact values", SVML::Sum(points, count) == expected);
+	PerformTest("Sum()", "2D 4D", "exact values", SVML::Sum(flat, count) == vec2(expected.xy) && SVML::Sum(colors, count) == vec4(expected, (float)count));
+	PerformTest("Sum()", "3D int", "component type", SVML::Sum(integers, count) == VECTOR3<int>((int)expected.x, (int)expected.y, 7 * (int)count));
+	PerformTest("Sum() Centroid()", "3D", "empty array", SVML::Sum(points, 0) == vec3(0, 0, 0) && SVML::Centroid(points, 0) == vec3(0, 0, 0));
+	PerformTest("Centroid()", "3D", "functionality", SVML::Distance(SVML::Centroid(points, 10), vec3(4.5f, -0.1f, 0.5f)) < 0.00001f);
+
+	// Blocks are combined pairwise: (0 + 1) + (2 + 3)
+	unsigned blocks = REDUCTION_BLOCK * 3 + 1;
+	vec3 pairwise = (SVML::BlockSum(points, REDUCTION_BLOCK) + SVML::BlockSum(points + REDUCTION_BLOCK, REDUCTION_BLOCK)) + (SVML::BlockSum(points + 2 * REDUCTION_BLOCK, REDUCTION_BLOCK) + SVML::BlockSum(points + 3 * REDUCTION_BLOCK, 1));
+	PerformTest("Sum()", "3D", "pairwise blocks", SVML::Sum(points, blocks) == pairwise);
+
+	// 0.1 is not exact in binary, so a plain loop drifts as the sum grows; the compensated sum stays within a few units in the last place
+	static vec4 tenths[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		tenths[i] = vec4(0.1f, 1000.1f, -0.3f, 1e-4f);
+	}
+	vec4 compensated = SVML::Sum(tenths, count);
+	PerformTest("Sum()", "4D", "compensated", fabs(compensated.x - count * (double)0.1f) <= 0.0005 && fabs(compensated.y - count * (double)1000.1f) <= 0.5 && fabs(compensated.w - count * (double)1e-4f) <= 0.000001);
+
+	//////////////////////////////////
+	//
+	// Covariance()
+	//
+	//////////////////////////////////
+
+	// Points on the line (t, 2t, 5) for t = 0 to 4: the variance of t is 2
+	vec3 line[5];
+	for (unsigned t = 0; t < 5; t++)
+	{
+		line[t] = vec3((float)t, (float)t * 2, 5);
+	}
+	mat3 covariance = SVML::Covariance(line, 5);
+	PerformTest("Covariance()", "3D", "functionality", covariance == mat3(vec3(2, 4, 0), vec3(4, 8, 0), vec3(0, 0, 0)));
+	PerformTest("Covariance()", "2D", "functionality", SVML::Distance(SVML::Covariance(flat, 3)[0], vec2(2.0f / 3, 2.0f / 3)) < 0.00001f && SVML::Distance(SVML::Covariance(flat, 3)[1], vec2(2.0f / 3, 2.0f / 3)) < 0.00001f);
+	PerformTest("Covariance()", "3D", "0 and 1 points", SVML::Covariance(line, 0) == mat3(0.0f) && SVML::Covariance(line + 3, 1) == mat3(0.0f));
+
+	// Far from the origin, the centroid is taken out first, so the small spread survives
+	static vec3 offset[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		offset[i] = points[i] + vec3(10000, -20000, 30000);
+	}
+	mat3 original = SVML::Covariance(points, count);
+	mat3 moved = SVML::Covariance(offset, count);
+	bool close = true;
+	for (unsigned c = 0; c < 3; c++) { close = close && SVML::Distance(original[c], moved[c]) < 0.001f; }
+	PerformTest("Covariance()", "3D", "translated points", close && fabs(original[0].x - 8.2461f) < 0.0001f && original[0].y == original[1].x && original[2].z == 0);
+
+	return 0;
+}
@@ -0,0 +1,141 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::DegToRad;
+	using SVML::vec2;
+	using SVML::rot2;
+	using SVML::vec2_soa;
+
+	// Rotations are not exact in floating point
+	const float tolerance = 0.00001f;
+
+	vec2 point(0.5f, -2.0f);
+	float radians = DegToRad(40.0f);
+
+	//////////////////////////////////
+	//
+	// Construction and rotation
+	//
+	//////////////////////////////////
+
+	rot2 rotation(radians);
+	PerformTest("rot2(radians)", "Rotation2", "functionality", rotation.c == cos(radians) && rotation.s == sin(radians) && fabs(Angle(rotation) - radians) < tolerance &&
+	                                                          rot2::Identity() == rot2(0.0f));
+
+	PerformTest("Rotate()", "2D", "matches Rotate() by angle", Rotate(point, rotation) == Rotate(point, radians) && Rotate(point.yx, rotation) == Rotate(vec2(point.yx), rotation) &&
+	                                                           AlmostEqual(Rotate(vec2(1, 0), rot2(DegToRad(90.0f))), vec2(0, 1)));
+
+	//////////////////////////////////
+	//
+	// Composition, inverse and matrices
+	//
+	//////////////////////////////////
+
+	rot2 other(-1.3f);
+	rot2 both = rotation;
+	both *= other;
+	PerformTest("* (composition)", "Rotation2", "adds angles", AlmostEqual(rotation * other, rot2(radians - 1.3f)) && both == rotation * other &&
+	                                                          Distance(Rotate(point, rotation * other), Rotate(Rotate(point, other), rotation)) < tolerance);
+
+	PerformTest("Inverse() ToMatrix()", "Rotation2", "undo and match Rotate()", Distance(Rotate(Rotate(point, rotation), Inverse(rotation)), point) < tolerance &&
+	                                                                           Distance(ToMatrix(rotation) * point, Rotate(point, rotation)) < tolerance);
+
+	// A thousand compositions drift off the unit circle, Normalize() brings them back
+	rot2 drifted = rot2::Identity();
+	for (unsigned i = 0; i < 1000; i++)
+	{
+		drifted *= rot2(0.001f * (float)i);
+	}
+	rot2 normalized = Normalize(drifted);
+	PerformTest("Normalize()", "Rotation2", "unit length", fabs(normalized.c * normalized.c + normalized.s * normalized.s - 1) < tolerance && fabs(Angle(normalized) - Angle(drifted)) < tolerance);
+
+	//////////////////////////////////
+	//
+	// Interpolation
+	//
+	//////////////////////////////////
+
+	rot2 start(DegToRad(170.0f)), end(DegToRad(-170.0f));
+	PerformTest("Slerp()", "Rotation2", "shorter arc at constant speed", AlmostEqual(Slerp(start, end, 0.0f), start) && AlmostEqual(Slerp(start, end, 1.0f), end) &&
+	                                                                    AlmostEqual(Slerp(start, end, 0.5f), rot2(DegToRad(180.0f))) && AlmostEqual(Slerp(rot2::Identity(), rot2(1.2f), 0.25f), rot2(0.3f)));
+	PerformTest("Nlerp()", "Rotation2", "midpoint", AlmostEqual(Nlerp(start, end, 0.5f), rot2(DegToRad(180.0f))) && AlmostEqual(Nlerp(rot2(0.2f), rot2(0.6f), 0.5f), rot2(0.4f)));
+
+	//////////////////////////////////
+	//
+	// Arrays and batches must agree with the per-vector functions
+	// (37 elements covers full blocks and a remainder)
+	//
+	//////////////////////////////////
+
+	const unsigned count = 37;
+	vec2 points[count], rotated[count], inPlace[count];
+	float angles[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		points[i] = vec2(i * 0.5f + 1, 3.0f - i);
+		inPlace[i] = points[i];
+		angles[i] = (float)i * 0.7f - 12.0f;
+	}
+	angles[5] = 10000.0f;
+	angles[6] = -123456.0f;
+
+	bool passed = true;
+	Rotate(rotated, points, rotation, count);
+	Rotate(inPlace, inPlace, rotation, count);
+	for (unsigned i = 0; i < count; i++) { passed = passed && Distance(rotated[i], Rotate(points[i], rotation)) < 0.0001f && inPlace[i] == rotated[i]; }
+	PerformTest("Rotate()", "2D array", "matches per-vector, in place too", passed);
+
+	passed = true;
+	Rotate(rotated, points, angles, count);
+	for (unsigned i = 0; i < count; i++) { passed = passed && Distance(rotated[i], Rotate(points[i], angles[i])) < 0.0001f; }
+	PerformTest("Rotate()", "2D array", "angle per vector", passed);
+
+	vec2_soa a(points, count);
+	vec2_soa out(count);
+	passed = true;
+	Rotate(out, a, rotation);
+	for (unsigned i = 0; i < count; i++) { passed = passed && Distance(out.Get(i), Rotate(points[i], rotation)) < 0.0001f; }
+	Rotate(out, a, angles);
+	for (unsigned i = 0; i < count; i++) { passed = passed && Distance(out.Get(i), Rotate(points[i], angles[i])) < 0.0001f; }
+	Rotate(a, a, radians);
+	for (unsigned i = 0; i < count; i++) { passed = passed && Distance(a.Get(i), Rotate(points[i], rotation)) < 0.0001f; }
+	PerformTest("Rotate()", "2D batch", "matches per-vector", passed);
+
+#if defined(SVML_USE_SSE) && defined(__SSE2__)
+	// Within 2e-7 of sin() and cos() across the reduced range, and exact for the lanes past it
+	float worst = 0.0f;
+	for (int i = -100000; i <= 100000; i += 4)
+	{
+		__m128 sine, cosine;
+		float x[4], s[4], c[4];
+		for (int lane = 0; lane < 4; lane++) { x[lane] = (float)(i + lane) * 0.0817f; }
+		SVML::SimdSinCos(_mm_loadu_ps(x), sine, cosine);
+		_mm_storeu_ps(s, sine);
+		_mm_storeu_ps(c, cosine);
+		for (int lane = 0; lane < 4; lane++) { worst = std::max(worst, (float)std::max(fabs(s[lane] - sin((double)x[lane])), fabs(c[lane] - cos((double)x[lane])))); }
+	}
+	PerformTest("SimdSinCos()", "SIMD", "accuracy", worst < 2e-7f);
+#endif
+
+	return 0;
+}
@@ -0,0 +1,141 @@
+#include <iostream>
+#include <fenv.h>
+
+#ifndef SVML_USE_SSE
+#define SVML_USE_SSE
+#endif
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+
+	//////////////////////////////////
+	//
+	// SSE overloads must match the generic templates exactly
+	// (explicit template arguments select the generic path)
+	//
+	//////////////////////////////////
+
+	vec3 a(1.5f, -2.25f, 3.0f);
+	vec3 b(-0.5f, 4.0f, 2.0f);
+	vec4 c(1.5f, -2.25f, 3.0f, 0.75f);
+	vec4 d(-0.5f, 4.0f, 2.0f, 2.5f);
+
+	PerformTest("sizeof", "3D", "padding", sizeof(vec3) == 16);
+
+	PerformTest("+ - * /", "3D", "SSE matches template", (a + b == SVML::operator+<float>(a, b)) &&
+	                                                     (a - b == SVML::operator-<float>(a, b)) &&
+	                                                     (a * b == SVML::operator*<float>(a, b)) &&
+	                                                     (a / b == SVML::operator/<float>(a, b)));
+
+	PerformTest("+ - * /", "4D", "SSE matches template", (c + d == SVML::operator+<float>(c, d)) &&
+	                                                     (c - d == SVML::operator-<float>(c, d)) &&
+	                                                     (c * d == SVML::operator*<float>(c, d)) &&
+	                                                     (c / d == SVML::operator/<float>(c, d)));
+
+	PerformTest("* / (scalar)", "3D", "SSE matches template", (a * 3.0f == SVML::operator*<float>(a, 3.0f)) &&
+	                                                          (3.0f * a == SVML::operator*<float>(3.0f, a)) &&
+	                                                          (a / 3.0f == SVML::operator/<float>(a, 3.0f)) &&
+	                                                          (3.0f / a == SVML::operator/<float>(3.0f, a)));
+
+	// The unused fourth lane of vec3 is 0, so dividing by it would raise FE_INVALID (0 / 0) or FE_DIVBYZERO (x / 0)
+	volatile float opaque = 4.0f;
+	vec3 divisor((float)opaque, 5.0f, 6.0f);
+	feclearexcept(FE_ALL_EXCEPT);
+	vec3 quotient = a / divisor;
+	vec3 inverse = 2.0f / divisor;
+	vec3 assigned = a;
+	assigned /= divisor;
+	vec3 remainder = Mod(a, divisor);
+	volatile float sink = quotient.x + inverse.y + assigned.z + remainder.x;
+	(void)sink;
+	PerformTest("/ /= Mod()", "3D", "no exceptions from the padding", fetestexcept(FE_INVALID | FE_DIVBYZERO) == 0);
+
+	PerformTest("- (negate)", "4D", "functionality", (-c == vec4(-1.5f, 2.25f, -3.0f, 0.75f)) &&
+	                                                 (-c.xyzw == vec4(-1.5f, 2.25f, -3.0f, 0.75f)));
+
+	PerformTest("Normalize()", "3D", "SSE matches template", Normalize(a) == SVML::Normalize<float>(a));
+	PerformTest("Normalize()", "4D", "SSE matches template", Normalize(c) == SVML::Normalize<float>(c));
+
+	PerformTest("Dot()", "3D", "SSE matches template", Dot(a, b) == SVML::Dot<float>(a, b));
+	PerformTest("Dot()", "4D", "SSE matches template", Dot(c, d) == SVML::Dot<float>(c, d));
+
+	PerformTest("Cross()", "3D", "SSE matches template", Cross(a, b) == SVML::Cross<float>(a, b));
+	PerformTest("Cross()", "4D", "SSE matches template", Cross(c, d) == SVML::Cross<float>(c, d));
+
+	PerformTest("Project()", "3D", "SSE matches template", Project(a, b) == SVML::Project<float>(a, b));
+	PerformTest("Project()", "4D", "SSE matches template", Project(c, d) == SVML::Project<float>(c, d));
+
+	PerformTest("Lerp()", "3D", "SSE matches template", Lerp(a, b, 0.25f) == SVML::Lerp<float>(a, b, 0.25f));
+	PerformTest("Lerp()", "4D", "SSE matches template", Lerp(c, d, 0.25f) == SVML::Lerp<float>(c, d, 0.25f));
+
+	PerformTest("Max() Min()", "3D", "SSE matches template", (Max(a, b) == SVML::Max<float>(a, b)) &&
+	                                                         (Min(a, b) == SVML::Min<float>(a, b)) &&
+	                                                         (Max(a, 1.0f) == SVML::Max<float>(a, 1.0f)) &&
+	                                                         (Min(1.0f, a) == SVML::Min<float>(1.0f, a)));
+
+	PerformTest("Ceil() Floor()", "4D", "SSE matches template", (Ceil(c) == SVML::Ceil<float>(c)) &&
+	                                                            (Floor(c) == SVML::Floor<float>(c)));
+
+	PerformTest("Distance()", "3D", "SSE matches template", (Distance(a, b) == SVML::Distance<float>(a, b)) &&
+	                                                        (DistanceSquared(a, b) == SVML::DistanceSquared<float>(a, b)));
+
+	PerformTest("Distance()", "4D", "SSE matches template", (Distance(c, d) == SVML::Distance<float>(c, d)) &&
+	                                                        (DistanceSquared(c, d) == SVML::DistanceSquared<float>(c, d)));
+
+	SVML::mat4 m(vec4(2, 1, 0, 0.5f), vec4(0, 3, 1, 0), vec4(1, 0, 4, 1), vec4(0.25f, 1, 0, 5));
+	SVML::mat4 n(vec4(1, 0, 2, 0), vec4(0.5f, 1, 0, 0), vec4(0, 0, 1, 0), vec4(3, -2, 1, 1));
+
+	PerformTest("* (matrix)", "4x4", "SSE matches template", (m * c == SVML::operator*<float>(m, c)) &&
+	                                                         (m * n == SVML::operator*<float>(m, n)) &&
+	                                                         (m * c.wzyx == SVML::operator*<float>(m, vec4(c.wzyx))));
+
+	PerformTest("Transpose()", "4x4", "SSE matches template", Transpose(m) == SVML::Transpose<float>(m));
+
+	PerformTest("Inverse()", "4x4", "SSE close to template", AlmostEqual(Inverse(m), SVML::Inverse<float>(m)) &&
+	                                                         AlmostEqual(Inverse(m) * m, SVML::mat4::Identity()));
+
+	//////////////////////////////////
+	//
+	// Swizzles still read and write through the packed storage
+	//
+	//////////////////////////////////
+
+	vec3 swizzled(1, 2, 3);
+	swizzled.zyx = vec3(4, 5, 6);
+	PerformTest("= (swizzle)", "3D", "functionality", swizzled == vec3(6, 5, 4));
+
+	swizzled.zyx += vec3(0, 1, 1);
+	PerformTest("+= (swizzle)", "3D", "functionality", swizzled == vec3(7, 6, 4));
+
+	PerformTest("+ (swizzle)", "3D", "functionality", swizzled.zyx + vec3(1, 1, 1) == vec3(5, 7, 8));
+
+	vec4 homogeneous(swizzled, 1.0f);
+	homogeneous.xyz *= 2.0f;
+	PerformTest("*= (swizzle)", "4D", "functionality", homogeneous == vec4(14, 12, 8, 1));
+
+	homogeneous += vec4(1, 1, 1, 1);
+	PerformTest("+=", "4D", "functionality", homogeneous == vec4(15, 13, 9, 2));
+
+	return 0;
+}
@@ -0,0 +1,137 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::DegToRad;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::vec3_soa;
+	using SVML::vec4_soa;
+	using SVML::VECTOR3_SOA_VIEW;
+
+	//////////////////////////////////
+	//
+	// Batch kernels must agree with the per-vector functions
+	// (37 elements covers two full blocks and a remainder)
+	//
+	//////////////////////////////////
+
+	const unsigned count = 37;
+	vec3 points[count];
+	vec3 others[count];
+	for (unsigned i = 0; i < count; i++)
+	{
+		points[i] = vec3(i * 0.5f + 1, 3.0f - i, i * 0.25f - 2);
+		others[i] = vec3(2.0f - i * 0.75f, i * 0.125f + 1, 4.0f);
+	}
+
+	vec3_soa a(points, count);
+	vec3_soa b(others, count);
+	vec3_soa out(count);
+	float scalars[count];
+
+	PerformTest("Get()", "3D batch", "functionality", a.Get(5) == points[5] && a.Count() == count);
+
+	bool passed = true;
+	Add(out, a, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == points[i] + others[i]; }
+	PerformTest("Add()", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	Multiply(out, a, 2.0f);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == points[i] * 2.0f; }
+	PerformTest("Multiply() (scalar)", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	Dot(scalars, a, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && scalars[i] == Dot(points[i], others[i]); }
+	PerformTest("Dot()", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	Normalize(out, a);
+	for (unsigned i = 0; i < count; i++) { passed = passed && AlmostEqual(out.Get(i), Normalize(points[i])); }
+	PerformTest("Normalize()", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	Cross(out, a, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == Cross(points[i], others[i]); }
+	PerformTest("Cross()", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	vec3 axis = Normalize(vec3(1, 2, 3));
+	Rotate(out, a, axis, DegToRad(30.0f));
+	for (unsigned i = 0; i < count; i++) { passed = passed && Distance(out.Get(i), Rotate(points[i], axis, DegToRad(30.0f))) < 0.0001f; }
+	PerformTest("Rotate()", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	Lerp(out, a, b, 0.25f);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == Lerp(points[i], others[i], 0.25f); }
+	PerformTest("Lerp()", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	Min(out, a, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == Min(points[i], others[i]); }
+	Max(out, a, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == Max(points[i], others[i]); }
+	PerformTest("Min() Max()", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	Floor(out, a);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == Floor(points[i]); }
+	Ceil(out, a);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == Ceil(points[i]); }
+	PerformTest("Floor() Ceil()", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	Distance(scalars, a, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && scalars[i] == Distance(points[i], others[i]); }
+	PerformTest("Distance()", "3D batch", "matches per-vector", passed);
+
+	//////////////////////////////////
+	//
+	// Swizzle views remap the lanes without copying
+	//
+	//////////////////////////////////
+
+	VECTOR3_SOA_VIEW<float> view = a.zyx;
+	VECTOR3_SOA_VIEW<float> lanes = a;
+	PerformTest(".zyx", "3D batch", "no copy", view.x == lanes.z && view.y == lanes.y && view.z == lanes.x);
+
+	passed = true;
+	Add(out, a.zyx, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && out.Get(i) == points[i].zyx + others[i]; }
+	PerformTest("Add() (swizzle)", "3D batch", "matches per-vector", passed);
+
+	passed = true;
+	vec3_soa inPlace(a);
+	Add(inPlace.zyx, inPlace, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && inPlace.Get(i) == (points[i] + others[i]).zyx; }
+	PerformTest("Add() (swizzle output)", "3D batch", "aliased lanes", passed);
+
+	passed = true;
+	vec4_soa homogeneous(count);
+	Add(homogeneous.xyz, a, b);
+	for (unsigned i = 0; i < count; i++) { passed = passed && homogeneous.Get(i) == vec4(points[i] + others[i], 0); }
+	PerformTest("Add() (4D swizzle output)", "4D batch", "matches per-vector", passed);
+
+	return 0;
+}
@@ -0,0 +1,328 @@
+// The parallel Build() needs C++11; before that the serial one is tested alone
+#if __cplusplus >= 201103L
+#define SVML_USE_THREADS
+#endif
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Deterministic pseudo-random coordinates in [-range, range)
+float Coordinate(unsigned& state, const float& range)
+{
+	state = state * 1664525u + 1013904223u;
+	return ((float)(state >> 8) / 16777216.0f * 2.0f - 1.0f) * range;
+}
+
+template <typename POINT> vector<unsigned> BruteRadius(const vector<POINT>& points, const POINT& center, const float& radius)
+{
+	vector<unsigned> found;
+	for (unsigned i = 0; i < points.size(); i++)
+	{
+		if (DistanceSquared(points[i], center) <= radius * radius)
+		{
+			found.push_back(i);
+		}
+	}
+	return found;
+}
+
+template <typename POINT> vector<unsigned> BruteNearest(const vector<POINT>& points, const POINT& center, const unsigned& k)
+{
+	vector< std::pair<float, unsigned> > all;
+	for (unsigned i = 0; i < points.size(); i++)
+	{
+		all.push_back(std::make_pair((float)DistanceSquared(points[i], center), i));
+	}
+	std::sort(all.begin(), all.end());
+	vector<unsigned> found;
+	for (unsigned i = 0; i < k && i < all.size(); i++)
+	{
+		found.push_back(all[i].second);
+	}
+	return found;
+}
+
+template <typename TREE, typename POINT> bool MatchesBruteForce(const TREE& tree, const vector<POINT>& points, const vector<POINT>& centers, const float& radius, const unsigned& k)
+{
+	for (unsigned c = 0; c < centers.size(); c++)
+	{
+		vector<unsigned> found;
+		if (tree.QueryRadius(centers[c], radius, found) != found.size())
+		{
+			return false;
+		}
+		std::sort(found.begin(), found.end());
+		if (found != BruteRadius(points, centers[c], radius))
+		{
+			return false;
+		}
+		found.clear();
+		tree.QueryNearest(centers[c], k, found);
+		if (found != BruteNearest(points, centers[c], k))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Closest hit of a ray against triangles, as the BVH calls it
+struct TRIANGLES
+{
+	const SVML::vec3* vertices;
+	SVML::vec3 origin, direction;
+
+	TRIANGLES(const SVML::vec3* vertices, const SVML::vec3& origin, const SVML::vec3& direction) : vertices(vertices), origin(origin), direction(direction) {}
+	bool operator()(const unsigned& triangle, float& maxDistance) const
+	{
+		float distance;
+		if (IntersectTriangle(origin, direction, vertices[triangle * 3], vertices[triangle * 3 + 1], vertices[triangle * 3 + 2], maxDistance, distance))
+		{
+			maxDistance = distance;
+			return true;
+		}
+		return false;
+	}
+};
+
+// Every primitive in exactly one leaf, four children or fewer per node, and every box inside its parent's
+bool WellFormed(const SVML::bvh3& bvh)
+{
+	vector<unsigned> seen(bvh.Count(), 0);
+	for (unsigned n = 0; n < bvh.NodeCount(); n++)
+	{
+		const SVML::bvh3::NODE& node = bvh.Nodes()[n];
+		for (unsigned c = 0; c < 4; c++)
+		{
+			SVML::aabb3 box = node.bounds.Get(c);
+			if (node.count[c] > SVML::BVH_MAX_LEAF)
+			{
+				return false;
+			}
+			for (unsigned slot = node.child[c]; slot < node.child[c] + node.count[c]; slot++)
+			{
+				seen[bvh.Primitive(slot)]++;
+			}
+			if (node.count[c] == 0 && node.child[c] != 0)
+			{
+				for (unsigned g = 0; g < 4; g++)
+				{
+					if (!IsEmpty(bvh.Nodes()[node.child[c]].bounds.Get(g)) && !Contains(box, bvh.Nodes()[node.child[c]].bounds.Get(g)))
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+	return std::count(seen.begin(), seen.end(), 1u) == (int)bvh.Count();
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::aabb3;
+	using SVML::kdtree2;
+	using SVML::kdtree3;
+	using SVML::bvh3;
+
+	unsigned state = 4321;
+
+	vector<vec2> points2;
+	vector<vec3> points3;
+	for (unsigned i = 0; i < 3000; i++)
+	{
+		float x = Coordinate(state, 50.0f), y = Coordinate(state, 50.0f), z = Coordinate(state, 10.0f);
+		points2.push_back(vec2(x, y));
+		points3.push_back(vec3(x, y, z));
+	}
+	// Duplicates and points on a line
+	for (unsigned i = 0; i < 40; i++)
+	{
+		points2.push_back(vec2(3.0f, (float)(i % 10)));
+		points3.push_back(vec3(3.0f, 3.0f, (float)(i % 10)));
+	}
+	vector<vec2> centers2;
+	vector<vec3> centers3;
+	for (unsigned i = 0; i < 40; i++)
+	{
+		float range = (i % 4 == 0) ? 200.0f : 60.0f;
+		float x = Coordinate(state, range), y = Coordinate(state, range), z = Coordinate(state, range);
+		centers2.push_back(vec2(x, y));
+		centers3.push_back(vec3(x, y, z));
+	}
+	centers2.push_back(vec2(3.0f, 4.0f));
+	centers3.push_back(vec3(3.0f, 3.0f, 4.0f));
+
+	//////////////////////////////////
+	//
+	// Kd-trees
+	//
+	//////////////////////////////////
+
+	kdtree2 tree2(&points2[0], (unsigned)points2.size());
+	kdtree3 tree3(&points3[0], (unsigned)points3.size());
+
+	PerformTest("QueryRadius() QueryNearest()", "2D", "matches brute force", MatchesBruteForce(tree2, points2, centers2, 4.0f, 6) && MatchesBruteForce(tree2, points2, centers2, 15.0f, 1));
+	PerformTest("QueryRadius() QueryNearest()", "3D", "matches brute force", MatchesBruteForce(tree3, points3, centers3, 7.5f, 12) && MatchesBruteForce(tree3, points3, centers3, 1.0f, 40));
+
+	kdtree3 copy;
+	copy = tree3;
+	vector<unsigned> found;
+	PerformTest("Nearest() QueryNearest() =", "3D", "functionality", copy.Count() == 3040 && copy.Nearest(points3[17]) == 17 &&
+	                                                                copy.QueryNearest(vec3(0.0f, 0.0f, 0.0f), 5000, found) == 3040 && found == BruteNearest(points3, vec3(0.0f, 0.0f, 0.0f), 3040));
+
+	kdtree2 empty;
+	found.clear();
+	PerformTest("QueryRadius() QueryNearest()", "2D", "empty tree", empty.QueryRadius(vec2(0.0f, 0.0f), 10.0f, found) == 0 && empty.QueryNearest(vec2(0.0f, 0.0f), 3, found) == 0 && found.empty());
+
+	//////////////////////////////////
+	//
+	// Bounding volume hierarchies
+	//
+	//////////////////////////////////
+
+	// Small triangles around the points, and their boxes
+	vector<vec3> vertices;
+	vector<aabb3> boxes;
+	for (unsigned i = 0; i < points3.size(); i++)
+	{
+		vertices.push_back(points3[i]);
+		vertices.push_back(points3[i] + vec3(Coordinate(state, 2.0f), Coordinate(state, 2.0f), Coordinate(state, 2.0f)));
+		vertices.push_back(points3[i] + vec3(Coordinate(state, 2.0f), Coordinate(state, 2.0f), Coordinate(state, 2.0f)));
+		boxes.push_back(Fit(&vertices[i * 3], 3));
+	}
+	bvh3 bvh(&boxes[0], (unsigned)boxes.size());
+
+	PerformTest("Build() layout", "3D", "nodes", sizeof(SVML::BVH3_NODE<float>) == 128 && (size_t)bvh.Nodes() % 64 == 0 && WellFormed(bvh) && bvh.Bounds() == Fit(&vertices[0], (unsigned)vertices.size()));
+
+	bool rays = true;
+	unsigned hits = 0;
+	for (unsigned r = 0; r < 200; r++)
+	{
+		vec3 origin(Coordinate(state, 80.0f), Coordinate(state, 80.0f), Coordinate(state, 30.0f));
+		vec3 direction = Normalize(vec3(Coordinate(state, 1.0f), Coordinate(state, 1.0f), Coordinate(state, 0.2f)));
+		if (r % 2 == 1)
+		{
+			direction = Normalize(vertices[r * 27] - origin + vec3(Coordinate(state, 0.5f), Coordinate(state, 0.5f), Coordinate(state, 0.5f))); // Near a triangle
+		}
+		if (r % 10 == 0)
+		{
+			direction = vec3(0.0f, 0.0f, (r % 20 == 0) ? 1.0f : -1.0f); // Zero components
+		}
+		TRIANGLES triangles(&vertices[0], origin, direction);
+
+		float nearest = 500.0f;
+		unsigned expected = 0;
+		bool expectedHit = false;
+		for (unsigned t = 0; t < boxes.size(); t++)
+		{
+			if (triangles(t, nearest))
+			{
+				expected = t;
+				expectedHit = true;
+			}
+		}
+
+		float maxDistance = 500.0f;
+		unsigned index = 0;
+		bool hit = bvh.IntersectRay(origin, direction, triangles, maxDistance, index);
+		rays = rays && hit == expectedHit && (!hit || (maxDistance == nearest && index == expected));
+		hits += hit ? 1 : 0;
+	}
+	PerformTest("IntersectRay()", "3D", "matches brute force", rays && hits > 50);
+
+	bool queries = true;
+	for (unsigned c = 0; c < centers3.size(); c++)
+	{
+		aabb3 query(centers3[c] - vec3(5.0f, 5.0f, 5.0f), centers3[c] + vec3(5.0f, 2.0f, 5.0f));
+		vector<unsigned> overlapping, expected;
+		bvh.QueryBox(query, overlapping);
+		for (unsigned b = 0; b < boxes.size(); b++)
+		{
+			if (Overlaps(boxes[b], query))
+			{
+				expected.push_back(b);
+			}
+		}
+		std::sort(overlapping.begin(), overlapping.end());
+		queries = queries && overlapping == expected;
+	}
+	PerformTest("QueryBox()", "3D", "matches brute force", queries);
+
+	queries = true;
+	for (unsigned c = 0; c < centers3.size(); c++)
+	{
+		vector<unsigned> within, nearest, expectedWithin;
+		vector< std::pair<float, unsigned> > all;
+		for (unsigned b = 0; b < boxes.size(); b++)
+		{
+			float distance = DistanceSquared(boxes[b], centers3[c]);
+			if (distance <= 16.0f)
+			{
+				expectedWithin.push_back(b);
+			}
+			all.push_back(std::make_pair(distance, b));
+		}
+		std::sort(all.begin(), all.end());
+		bvh.QueryRadius(centers3[c], 4.0f, within);
+		bvh.QueryNearest(centers3[c], 10, nearest);
+		std::sort(within.begin(), within.end());
+		queries = queries && within == expectedWithin && nearest.size() == 10;
+		for (unsigned n = 0; n < nearest.size(); n++)
+		{
+			queries = queries && nearest[n] == all[n].second;
+		}
+	}
+	PerformTest("QueryRadius() QueryNearest()", "3D", "matches brute force", queries);
+
+	bvh3 single(&boxes[5], 1);
+	float maxDistance = 100.0f;
+	unsigned index = 99;
+	TRIANGLES miss(&vertices[0], vec3(1000.0f, 0.0f, 0.0f), vec3(1.0f, 0.0f, 0.0f));
+	found.clear();
+	PerformTest("Build() IntersectRay() QueryNearest()", "3D", "one and no primitives", single.NodeCount() == 1 && single.QueryNearest(vec3(0.0f, 0.0f, 0.0f), 3, found) == 1 && found[0] == 0 &&
+	                                                                                  !single.IntersectRay(vec3(1000.0f, 0.0f, 0.0f), vec3(1.0f, 0.0f, 0.0f), miss, maxDistance, index) && index == 99 &&
+	                                                                                  bvh3().NodeCount() == 0 && IsEmpty(bvh3().Bounds()));
+
+	//////////////////////////////////
+	//
+	// Parallel build
+	//
+	//////////////////////////////////
+
+#ifdef SVML_USE_THREADS
+	bvh3 parallel;
+	SVML::Bulk::WORK_POOL three(3);
+	parallel.Build(SVML::Bulk::SPAN<const aabb3>(&boxes[0], boxes.size()), 64, three);
+	bool same = parallel.NodeCount() == bvh.NodeCount() && memcmp(parallel.Nodes(), bvh.Nodes(), bvh.NodeCount() * sizeof(SVML::BVH3_NODE<float>)) == 0;
+	for (unsigned slot = 0; slot < boxes.size(); slot++)
+	{
+		same = same && parallel.Primitive(slot) == bvh.Primitive(slot);
+	}
+	PerformTest("Build() (parallel)", "3D", "same tree as serial", same);
+#endif
+
+	return 0;
+}
@@ -0,0 +1,80 @@
+#include <iostream>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::VECTOR3;
+
+	//////////////////////////////////
+	//
+	// Spellings and layout
+	//
+	//////////////////////////////////
+
+	vec4 a(1, 2, 3, 4);
+	PerformTest(".xzyw .rbga .sptq", "4D", "same components", a.xzyw == vec4(1, 3, 2, 4) && a.rbga == a.xzyw && a.sptq == a.xzyw);
+	PerformTest(".w .a .q", "4D", "read", a.w == 4 && a.a == 4 && a.q == 4);
+	PerformTest("sizeof", "2D 4D", "swizzles add no storage", sizeof(vec2) == 2 * sizeof(float) && sizeof(a.xy) == 4 * sizeof(float) && sizeof(a.wzyx) == 4 * sizeof(float));
+
+	//////////////////////////////////
+	//
+	// Writes
+	//
+	//////////////////////////////////
+
+	vec3 b(1, 2, 3);
+	b.zyx = b;
+	PerformTest(".zyx = vector", "3D", "reversed", b == vec3(3, 2, 1));
+
+	b = vec3(1, 2, 3);
+	b.yzx = b.xyz;
+	PerformTest(".yzx = .xyz", "3D", "reads before writing", b == vec3(3, 1, 2));
+
+	b = vec3(1, 2, 3);
+	b.xy = vec2(7, 8);
+	b.zx += vec2(10, 20);
+	PerformTest(".xy = vec2, .zx += vec2", "3D", "shorter swizzle from a 2D vector", b == vec3(27, 8, 13));
+
+	b = vec3(1, 2, 3);
+	a = vec4(1, 2, 3, 4);
+	a.wx = b.zy;
+	a.yz -= b.xx;
+	PerformTest(".wx = .zy, .yz -= .xx", "4D from 3D", "swizzle of another size", a == vec4(2, 1, 2, 3));
+
+	a = vec4(1, 2, 3, 4);
+	a.zyx *= vec4(10, 100, 1000, 10000);
+	PerformTest(".zyx *= vector", "4D", "owning vector, first components", a == vec4(1000, 200, 30, 4));
+
+	VECTOR3<int> c(1, 2, 3);
+	c.zx *= 3;
+	c.yz /= 2;
+	PerformTest(".zx *= scalar, .yz /= scalar", "3D int", "component type", c == VECTOR3<int>(3, 1, 4));
+
+	a = vec4(1, 2, 3, 4);
+	a.x += 1;
+	a.g *= 5;
+	PerformTest(".x += .g *=", "4D", "single components", a == vec4(2, 10, 3, 4));
+
+	return 0;
+}
@@ -0,0 +1,164 @@
+#include <iostream>
+#include <vector>
+#include <string.h>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Deterministic pseudo-random bits
+unsigned Random(unsigned& state)
+{
+	state = state * 1664525u + 1013904223u;
+	return state;
+}
+
+// Any finite float, tiny and huge ones included
+float AnyFloat(unsigned& state)
+{
+	unsigned bits = Random(state);
+	bits = (bits & 0x807FFFFFu) | ((Random(state) % 254u) << 23);
+	float value;
+	memcpy(&value, &bits, 4);
+	return value;
+}
+
+// The text ToChars() writes, or "overflow"
+template <typename VECTOR> string Text(const VECTOR& vector)
+{
+	char buffer[128];
+	char* end = SVML::ToChars(buffer, buffer + sizeof(buffer), vector);
+	return (end != 0) ? string(buffer, end) : string("overflow");
+}
+
+template <typename VECTOR> bool RoundTrips(const VECTOR& vector)
+{
+	char buffer[128];
+	char* end = SVML::ToChars(buffer, buffer + sizeof(buffer), vector);
+	VECTOR read;
+	return end != 0 && SVML::FromChars(buffer, end, read) == end && read == vector;
+}
+
+int main (int argc, char * const argv[])
+{
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::ToChars;
+	using SVML::FromChars;
+	using SVML::FormatLines;
+	using SVML::ParseLines;
+
+	unsigned state = 12345;
+
+	//////////////////////////////////
+	//
+	// One vector
+	//
+	//////////////////////////////////
+
+	vec3 simple(1.0f, 2.5f, -3.0f);
+	PerformTest("ToChars()", "2D 3D 4D", "ToString() format", Text(simple) == SVML::ToString(simple) && Text(vec2(0.0f, -0.5f)) == "(0, -0.5)" &&
+	                                                          Text(vec4(1.0f, 2.0f, 3.0f, 4.0f)) == SVML::ToString(vec4(1.0f, 2.0f, 3.0f, 4.0f)) && Text(simple.zyx) == "(-3, 2.5, 1)");
+	PerformTest("ToChars()", "3D", "shortest round trip", Text(vec3(0.1f, 1.0f / 3.0f, 16777216.0f)) == "(0.1, 0.33333334, 16777216)" &&
+	                                                      Text(SVML::VECTOR3<double>(0.1, 1.0 / 3.0, 1e300)) == "(0.1, 0.3333333333333333, 1e+300)");
+
+	bool floats = true, doubles = true;
+	for (unsigned i = 0; i < 20000; i++)
+	{
+		vec4 random(AnyFloat(state), AnyFloat(state), AnyFloat(state), AnyFloat(state));
+		floats = floats && RoundTrips(random) && RoundTrips(vec3(random.Component(0), random.Component(1), random.Component(2)));
+		double wide = (double)AnyFloat(state) * (1.0 + (double)Random(state) / 4294967296.0);
+		doubles = doubles && RoundTrips(SVML::VECTOR2<double>(wide, -wide / 7.0));
+	}
+	PerformTest("ToChars() FromChars()", "2D 3D 4D", "float and double round trip", floats && doubles);
+
+	SVML::VECTOR3<int> integers(-2147483647 - 1, 2147483647, 0);
+	PerformTest("ToChars() FromChars()", "3D", "int round trip", Text(integers) == "(-2147483648, 2147483647, 0)" && RoundTrips(integers));
+
+	// Too small a buffer: 0, and nothing written past last
+	char buffer[64];
+	memset(buffer, '#', sizeof(buffer));
+	bool fits = ToChars(buffer, buffer + 11, simple) == 0 && buffer[11] == '#' && ToChars(buffer, buffer + 12, simple) == buffer + 12;
+	PerformTest("ToChars()", "3D", "too small a buffer", fits);
+
+	const char* loose = " ( 1 ,2,\t-3.5e2 ) tail";
+	vec3 read(7.0f, 7.0f, 7.0f);
+	const char* end = FromChars(loose, loose + strlen(loose), read);
+	PerformTest("FromChars()", "3D", "spaces optional", end == loose + 17 && read == vec3(1.0f, 2.0f, -350.0f));
+
+	const char* bad[] = { "(1, 2)", "(1, 2, 3, 4)", "(1, 2, 3", "1, 2, 3)", "(1, x, 3)", "(1,, 3)", "(1, 2, +-3)" };
+	bool refused = true;
+	for (unsigned i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+	{
+		refused = refused && FromChars(bad[i], bad[i] + strlen(bad[i]), read) == 0 && read == vec3(1.0f, 2.0f, -350.0f);
+	}
+	SVML::VECTOR2<int> cell(5, 5);
+	const char* overflow = "(2147483648, 1)";
+	refused = refused && FromChars(overflow, overflow + strlen(overflow), cell) == 0 && cell == SVML::VECTOR2<int>(5, 5);
+	PerformTest("FromChars()", "2D 3D", "refuses other text", refused);
+
+#ifdef SVML_HAS_CLASS_COMPONENTS
+	SVML::f16vec3 half(SVML::HALF(0.1f), SVML::HALF(-2.0f), SVML::HALF(65504.0f));
+	SVML::fxvec2 fixed(SVML::FIXED::FromRaw(1), SVML::FIXED(-3.25));
+	PerformTest("ToChars() FromChars()", "2D 3D", "half and fixed round trip", RoundTrips(half) && RoundTrips(fixed) && Text(fixed) == "(1.52587890625e-05, -3.25)");
+#endif
+
+	//////////////////////////////////
+	//
+	// Arrays of vectors
+	//
+	//////////////////////////////////
+
+	vector<vec3> points(1000);
+	for (unsigned i = 0; i < points.size(); i++)
+	{
+		points[i] = vec3(AnyFloat(state), (float)i, -(float)(Random(state) % 1000) / 8.0f);
+	}
+	vector<char> text(64 * points.size());
+	char* textEnd = FormatLines(&text[0], &text[0] + text.size(), &points[0], points.size());
+	vector<vec3> parsedPoints(points.size());
+	size_t parsed = 0;
+	bool csv = textEnd != 0 && ParseLines(&text[0], textEnd, &parsedPoints[0], parsedPoints.size(), parsed) == textEnd && parsed == points.size() && parsedPoints == points &&
+	           FormatLines(&text[0], &text[0] + 100, &points[0], points.size()) == 0;
+	PerformTest("FormatLines() ParseLines()", "3D", "CSV round trip", csv);
+
+	string obj = "# Two triangles\nv 1 2 3\nvn 0 0 1\nv 4.5\t 5 6\r\n\n  \nf 1 2 3\nv -1e3 0 .5\n";
+	vec3 vertices[4];
+	end = ParseLines(obj.data(), obj.data() + obj.size(), vertices, 4, parsed, ' ', "v ");
+	bool objRead = end == obj.data() + obj.size() && parsed == 3 && vertices[0] == vec3(1.0f, 2.0f, 3.0f) && vertices[1] == vec3(4.5f, 5.0f, 6.0f) &&
+	               vertices[2] == vec3(-1000.0f, 0.0f, 0.5f);
+	obj = "v 1 2 3\nv -1e3 0 0.25";
+	end = ParseLines(obj.data(), obj.data() + obj.size(), vertices, 4, parsed, ' ', "v ");
+	objRead = objRead && end == obj.data() + obj.size() && parsed == 2 && vertices[1] == vec3(-1000.0f, 0.0f, 0.25f);
+	vec4 colors[2];
+	obj = "v 1 2 3 0.5\n";
+	objRead = objRead && ParseLines(obj.data(), obj.data() + obj.size(), colors, 2, parsed, ' ', "v ") == obj.data() + obj.size() && parsed == 1 && colors[0] == vec4(1.0f, 2.0f, 3.0f, 0.5f);
+	PerformTest("ParseLines()", "3D 4D", "OBJ vertices", objRead);
+
+	string csvText = "x,y\n1,2\n3,4\n";
+	vec2 pairs[2];
+	bool stops = ParseLines(csvText.data(), csvText.data() + csvText.size(), pairs, 2, parsed) == csvText.data() && parsed == 0 &&
+	             ParseLines(csvText.data() + 4, csvText.data() + csvText.size(), pairs, 1, parsed) == csvText.data() + 8 && parsed == 1 && pairs[0] == vec2(1.0f, 2.0f);
+	csvText = "1,2\n3,4,5\n";
+	stops = stops && ParseLines(csvText.data(), csvText.data() + csvText.size(), pairs, 2, parsed) == csvText.data() + 4 && parsed == 1;
+	PerformTest("ParseLines()", "2D", "stops at other lines and capacity", stops);
+
+	return 0;
+}
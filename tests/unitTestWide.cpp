@@ -0,0 +1,163 @@
+#include <iostream>
+#include <math.h>
+
+#include "svml.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+void PerformTest(string operation, string dimension, string kindOfTest, bool test)
+{
+	if (test)
+	{
+		cout << operation << ", " << dimension << ", " << kindOfTest << " - check" << endl;
+	}
+	else
+	{
+		cout << "ERROR: " << operation << ", " << dimension << ", " << kindOfTest << endl;
+		exit(-1);
+	}
+}
+
+// Every lane of a wide result next to the same function on that lane's vector. The float functions have SSE versions
+// with SVML_USE_SSE, whose rounding differs, so this allows a little relative error
+bool Close(const float& a, const float& b) { return fabs(a - b) <= 1.0e-5f * (1.0f + fabs(b)); }
+template <typename VECTOR> bool Close(const VECTOR& a, const VECTOR& b) { bool close = true; for (unsigned d = 0; d < sizeof(VECTOR) / sizeof(float) && d < 4; d++) { close = close && Close(a.Component(d), b.Component(d)); } return close; }
+
+template <typename VECTOR, typename WIDE_VECTOR, typename FUNCTION, typename WIDE_FUNCTION> bool LanesMatch(const VECTOR* vectors, FUNCTION function, WIDE_FUNCTION wideFunction)
+{
+	WIDE_VECTOR wide = SVML::Pack<float, 8>(vectors);
+	VECTOR lanes[8];
+	Unpack(lanes, wideFunction(wide));
+	bool same = true;
+	for (int i = 0; i < 8; i++) { same = same && Close(lanes[i], function(vectors[i])); }
+	return same;
+}
+
+// Wide vectors need C++11: g++ -std=c++11 -I. tests/unitTestWide.cpp
+int main (int argc, char * const argv[])
+{
+	using SVML::WIDE;
+	using SVML::vec2;
+	using SVML::vec3;
+	using SVML::vec4;
+	using SVML::wvec2;
+	using SVML::wvec3;
+	using SVML::wvec4;
+	typedef WIDE<float, 8> wfloat;
+
+	vec2 flat[8];
+	vec3 points[8];
+	vec4 colors[8];
+	float angles[8];
+	for (int i = 0; i < 8; i++)
+	{
+		points[i] = vec3(0.37f * (float)i - 1.1f, 2.0f - 0.5f * (float)i, 0.25f + (float)(i % 3));
+		flat[i] = points[i].zx;
+		colors[i] = vec4(points[i].yzx, (float)i - 3.5f);
+		angles[i] = 0.3f * (float)i - 1.0f;
+	}
+
+	//////////////////////////////////
+	//
+	// Scalars
+	//
+	//////////////////////////////////
+
+	wfloat lanes = wfloat::Load(angles);
+	wfloat twice = lanes * 2 + 1.5;
+	bool laneWise = true;
+	for (int i = 0; i < 8; i++) { laneWise = laneWise && twice[i] == angles[i] * 2 + 1.5f && sqrt(fabs(lanes))[i] == sqrtf(fabsf(angles[i])) && floor(lanes)[i] == floorf(angles[i]) && max(lanes, wfloat(0))[i] == std::max(angles[i], 0.0f); }
+	PerformTest("operators, sqrt() fabs() floor() max()", "scalar", "lane by lane", laneWise);
+
+	wfloat copy = lanes;
+	copy[5] += 1;
+	PerformTest("operator== operator< operator!=", "scalar", "true in every lane", lanes == wfloat::Load(angles) && copy != lanes && !(copy == lanes) && lanes < lanes + 1 && !(lanes < copy) && lanes <= copy);
+
+	//////////////////////////////////
+	//
+	// Vectors
+	//
+	//////////////////////////////////
+
+	wvec3 packed = SVML::Pack<float, 8>(points);
+	vec3 unpacked[8];
+	Unpack(unpacked, packed);
+	bool roundTrip = true;
+	for (int i = 0; i < 8; i++) { roundTrip = roundTrip && unpacked[i] == points[i] && packed.Component(0)[i] == points[i].x; }
+	PerformTest("Pack() Unpack()", "3D", "vector i in lane i", roundTrip);
+
+	PerformTest("Normalize() Length", "2D 3D 4D", "every lane", LanesMatch<vec2, wvec2>(flat, [](const vec2& v) { return Normalize(v); }, [](const wvec2& v) { return Normalize(v); }) &&
+	                                                          LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Normalize(v); }, [](const wvec3& v) { return Normalize(v); }) &&
+	                                                          LanesMatch<vec4, wvec4>(colors, [](const vec4& v) { return Normalize(v); }, [](const wvec4& v) { return Normalize(v); }) &&
+	                                                          LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return vec3((float)v.Length, Dot(v, v), Distance(v, vec3(1, 2, 3))); }, [](const wvec3& v) { return wvec3((wfloat)v.Length, Dot(v, v), Distance(v, wvec3(1, 2, 3))); }));
+
+	PerformTest("Cross() Perpendicular()", "2D 3D 4D", "every lane", LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Cross(v, vec3(0.5f, -1, 2)); }, [](const wvec3& v) { return Cross(v, wvec3(0.5f, -1, 2)); }) &&
+	                                                              LanesMatch<vec2, wvec2>(flat, [](const vec2& v) { return Perpendicular(v); }, [](const wvec2& v) { return Perpendicular(v); }) &&
+	                                                              LanesMatch<vec4, wvec4>(colors, [](const vec4& v) { return Cross(v, vec4(0.5f, -1, 2, 1)); }, [](const wvec4& v) { return Cross(v, wvec4(0.5f, -1, 2, 1)); }));
+
+	PerformTest("Rotate()", "2D 3D 4D", "every lane", LanesMatch<vec2, wvec2>(flat, [](const vec2& v) { return Rotate(v, 0.7f); }, [](const wvec2& v) { return Rotate(v, 0.7f); }) &&
+	                                               LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Rotate(v, vec3(0, 0.6f, 0.8f), 2.0f); }, [](const wvec3& v) { return Rotate(v, wvec3(0, 0.6f, 0.8f), 2.0f); }) &&
+	                                               LanesMatch<vec4, wvec4>(colors, [](const vec4& v) { return Rotate(v, vec4(0.8f, 0, 0.6f, 0), -1.0f); }, [](const wvec4& v) { return Rotate(v, wvec4(0.8f, 0, 0.6f, 0), -1.0f); }));
+
+	// A different angle in every lane
+	wvec2 turned = Rotate(SVML::Pack<float, 8>(flat), wfloat::Load(angles));
+	bool perLane = true;
+	for (int i = 0; i < 8; i++) { perLane = perLane && Close(vec2(turned.Component(0)[i], turned.Component(1)[i]), Rotate(flat[i], angles[i])); }
+	PerformTest("Rotate()", "2D", "an angle per lane", perLane);
+
+	PerformTest("Project() Lerp() DistanceSquared()", "3D", "every lane", LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Project(v, vec3(1, 1, 0)) + Lerp(v, vec3(4, 5, 6), 0.25f) * DistanceSquared(v, vec3(0, 0, 1)); },
+	                                                                                                     [](const wvec3& v) { return Project(v, wvec3(1, 1, 0)) + Lerp(v, wvec3(4, 5, 6), 0.25f) * DistanceSquared(v, wvec3(0, 0, 1)); }));
+
+	PerformTest("Max() Min() Ceil() Floor()", "4D", "lane by lane, without branching", LanesMatch<vec4, wvec4>(colors, [](const vec4& v) { return Max(v, vec4(0, 0.5f, -1, 1)) + Min(v, 0.25f) + Ceil(v) * Floor(v); },
+	                                                                                                      [](const wvec4& v) { return Max(v, wvec4(0, 0.5f, -1, 1)) + Min(v, 0.25f) + Ceil(v) * Floor(v); }));
+
+	PerformTest("Abs() Sign() Clamp() Step() SmoothStep()", "3D", "lane by lane, without branching",
+	            LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Abs(v) + Sign(v) + Clamp(v, -0.5f, 0.5f) + Step(0.1f, v) + SmoothStep(-1.0f, 1.0f, v); },
+	                                    [](const wvec3& v) { return Abs(v) + Sign(v) + Clamp(v, -0.5f, 0.5f) + Step(0.1f, v) + SmoothStep(-1.0f, 1.0f, v); }));
+
+	PerformTest("Fract() Mod() Sqrt() InverseSqrt() Pow()", "3D", "lane by lane",
+	            LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Fract(v) + Mod(v, 0.75f) + Sqrt(Abs(v)) + InverseSqrt(Abs(v) + vec3(1, 1, 1)) + Pow(Abs(v), 1.5f); },
+	                                    [](const wvec3& v) { return Fract(v) + Mod(v, 0.75f) + Sqrt(Abs(v)) + InverseSqrt(Abs(v) + wvec3(1, 1, 1)) + Pow(Abs(v), 1.5f); }));
+
+	PerformTest("Exp() Exp2() Log() Log2() Sin() Cos() Tan() Atan2()", "3D", "lane by lane",
+	            LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Exp(v) + Exp2(v) + Log(Abs(v) + vec3(1, 1, 1)) + Log2(Abs(v) + vec3(1, 1, 1)) + Sin(v) * Cos(v) + Tan(v * 0.5f) + Atan2(v, vec3(1, -1, 0.5f)); },
+	                                    [](const wvec3& v) { return Exp(v) + Exp2(v) + Log(Abs(v) + wvec3(1, 1, 1)) + Log2(Abs(v) + wvec3(1, 1, 1)) + Sin(v) * Cos(v) + Tan(v * 0.5f) + Atan2(v, wvec3(1, -1, 0.5f)); }));
+
+	wvec3 c = packed;
+	c.zx *= 2;
+	c.xy += packed.yx * 2;
+	vec3 expected[8];
+	for (int i = 0; i < 8; i++)
+	{
+		expected[i] = points[i];
+		expected[i].zx *= 2;
+		expected[i].xy += points[i].yx * 2;
+	}
+	PerformTest("swizzles", "3D", "scalar operations", c == SVML::Pack<float, 8>(expected) && c.yzx != packed.yzx && 2.5 * packed.zyx == packed.zyx * 2.5f);
+
+	wvec4 colorsPacked = SVML::Pack<float, 8>(colors);
+	wvec4 nudged = colorsPacked;
+	nudged.w += 1.0e-7f;
+	PerformTest("AlmostEqual() operator==", "4D", "all eight vectors", AlmostEqual(colorsPacked, nudged) && colorsPacked != nudged && !AlmostEqual(colorsPacked, colorsPacked + wvec4(0, 0, 0.001f, 0)) && colorsPacked == SVML::Pack<float, 8>(colors));
+
+	wvec3 zero(0, 0, 0);
+	SVML::WIDE<SVML::MASK3, 8> positive = GreaterThan(packed, zero);
+	SVML::WIDE<SVML::MASK3, 8> swizzled = LessThanEqual(packed.zyx, packed);
+	bool masksMatch = true;
+	for (int i = 0; i < 8; i++)
+	{
+		SVML::MASK3 expectedMask = GreaterThan(points[i], vec3(0, 0, 0));
+		masksMatch = masksMatch && positive[i] == expectedMask && swizzled[i] == LessThanEqual(points[i].zyx, points[i]) && (!positive)[i] == !expectedMask &&
+		             (positive & swizzled)[i] == (expectedMask & swizzled[i]) && Any(positive)[i] == Any(expectedMask) && All(positive)[i] == All(expectedMask);
+	}
+	PerformTest("GreaterThan() LessThanEqual() Any() All()", "3D", "a mask per lane", masksMatch);
+
+	PerformTest("Select()", "3D", "lane by lane", LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Select(GreaterThan(v, vec3(0, 0, 0)), v, vec3(0, 0, 0)); },
+	                                                                       [](const wvec3& v) { return Select(GreaterThan(v, wvec3(0, 0, 0)), v, wvec3(0, 0, 0)); }) &&
+	                                              LanesMatch<vec3, wvec3>(points, [](const vec3& v) { return Select(AlmostEqualMask(v.zxy, v), v.yzx, v); },
+	                                                                       [](const wvec3& v) { return Select(AlmostEqualMask(v.zxy, v), v.yzx, v); }));
+
+	return 0;
+}